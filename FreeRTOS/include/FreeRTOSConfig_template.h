@@ -110,6 +110,15 @@
 #define configUSE_COUNTING_SEMAPHORES     1
 #define configGENERATE_RUN_TIME_STATS     0
 
+/* Per task cpu share (task_prof.h): set configGENERATE_RUN_TIME_STATS to 1
+and take the run time counter from the DWT cycle counter. */
+#if (configGENERATE_RUN_TIME_STATS == 1)
+extern void task_prof_init(void);
+extern uint32_t task_prof_runtime(void);
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() task_prof_init()
+#define portGET_RUN_TIME_COUNTER_VALUE()         task_prof_runtime()
+#endif
+
 /* Co-routine definitions. */
 #define configUSE_CO_ROUTINES           0
 #define configMAX_CO_ROUTINE_PRIORITIES (2)
@@ -38,12 +38,43 @@
 
 #include "arch/sys_arch.h"
 
+/*
+ * FreeRTOS queues and semaphores are used directly, without the osEvent copy
+ * and the tick reads of the CMSIS-OS wrappers. Timeouts of lwIP are in ms,
+ * rounded up to whole ticks so a short timeout never turns into a poll.
+ */
+#define SYS_MS_TO_TICKS(ms)		(((TickType_t)(ms) + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS)
+
+static sys_mbox_stat_t mbox_stat;
+
+// note the messages in a mbox with the one posted, or that it was full. The
+// fill is read before the post: once posted, the receiver may free the mbox
+static void sys_mbox_note(UBaseType_t n, int full)
+{
+	taskENTER_CRITICAL();
+	if (n > mbox_stat.max)
+	{
+		mbox_stat.max = (u16_t)n;
+	}
+	if (full)
+	{
+		mbox_stat.full++;
+	}
+	taskEXIT_CRITICAL();
+}
+
 // create messagebox
 err_t sys_mbox_new(sys_mbox_t *mbox, int size)
 {
-	osMessageQDef(QUEUE, size, void *);
+	*mbox = xQueueCreate((UBaseType_t)size, sizeof(void *));
 
-	*mbox = osMessageCreate(osMessageQ(QUEUE), NULL);
+	if (*mbox == NULL)
+	{
+#if SYS_STATS
+		lwip_stats.sys.mbox.err++;
+#endif /* SYS_STATS */
+		return ERR_MEM;
+	}
 
 #if SYS_STATS
 	++lwip_stats.sys.mbox.used;
@@ -52,8 +83,6 @@ err_t sys_mbox_new(sys_mbox_t *mbox, int size)
 		lwip_stats.sys.mbox.max = lwip_stats.sys.mbox.used;
 	}
 #endif /* SYS_STATS */
-	if (*mbox == NULL)
-		return ERR_MEM;
 
 	return ERR_OK;
 }
@@ -61,7 +90,7 @@ err_t sys_mbox_new(sys_mbox_t *mbox, int size)
 // delete messagebox
 void sys_mbox_free(sys_mbox_t *mbox)
 {
-	if (osMessageWaiting(*mbox))
+	if (uxQueueMessagesWaiting(*mbox))
 	{
 		/* Line for breakpoint.  Should never break here! */
 		portNOP();
@@ -72,87 +101,79 @@ void sys_mbox_free(sys_mbox_t *mbox)
 		// TODO notify the user of failure.
 	}
 
-	osMessageDelete(*mbox);
+	vQueueDelete(*mbox);
 
 #if SYS_STATS
 	--lwip_stats.sys.mbox.used;
 #endif /* SYS_STATS */
 }
 
-// post message util success
+// post message, waits while the mbox is full
 void sys_mbox_post(sys_mbox_t *mbox, void *msg)
 {
-	while (osMessagePut(*mbox, (uint32_t)msg, osWaitForever) != osOK)
-		;
+	UBaseType_t n = uxQueueMessagesWaiting(*mbox);
+
+	if (xQueueSendToBack(*mbox, &msg, 0) != pdPASS)
+	{
+		// counted, then blocked on rather than spun on
+		sys_mbox_note(n, 1);
+		while (xQueueSendToBack(*mbox, &msg, portMAX_DELAY) != pdPASS)
+			;
+		return;
+	}
+	sys_mbox_note(n + 1, 0);
 }
 
 // post message one time
 err_t sys_mbox_trypost(sys_mbox_t *mbox, void *msg)
 {
-	err_t result;
+	UBaseType_t n = uxQueueMessagesWaiting(*mbox);
 
-	if (osMessagePut(*mbox, (uint32_t)msg, 0) == osOK)
-	{
-		result = ERR_OK;
-	}
-	else
+	if (xQueueSendToBack(*mbox, &msg, 0) != pdPASS)
 	{
 		// could not post, queue must be full
-		result = ERR_MEM;
-
+		sys_mbox_note(n, 1);
 #if SYS_STATS
 		lwip_stats.sys.mbox.err++;
 #endif /* SYS_STATS */
+		return ERR_MEM;
 	}
+	sys_mbox_note(n + 1, 0);
 
-	return result;
+	return ERR_OK;
 }
 
-// wait message
+// wait message, timeout 0 waits forever
 u32_t sys_arch_mbox_fetch(sys_mbox_t *mbox, void **msg, u32_t timeout)
 {
-	osEvent event;
-	uint32_t starttime = osKernelSysTick();
-	;
+	TickType_t start = xTaskGetTickCount();
 
 	if (timeout != 0)
 	{
-		event = osMessageGet(*mbox, timeout);
-
-		if (event.status == osEventMessage)
-		{
-			*msg = (void *)event.value.v;
-			return (osKernelSysTick() - starttime);
-		}
-		else
+		if (xQueueReceive(*mbox, msg, SYS_MS_TO_TICKS(timeout)) != pdPASS)
 		{
+			*msg = NULL;
 			return SYS_ARCH_TIMEOUT;
 		}
 	}
 	else
 	{
-		event = osMessageGet(*mbox, osWaitForever);
-		*msg = (void *)event.value.v;
-		return (osKernelSysTick() - starttime);
+		while (xQueueReceive(*mbox, msg, portMAX_DELAY) != pdPASS)
+			;
 	}
+
+	return (xTaskGetTickCount() - start) * portTICK_PERIOD_MS;
 }
 
 // try to get message
 u32_t sys_arch_mbox_tryfetch(sys_mbox_t *mbox, void **msg)
 {
-	osEvent event;
-
-	event = osMessageGet(*mbox, 0);
-
-	if (event.status == osEventMessage)
-	{
-		*msg = (void *)event.value.v;
-		return ERR_OK;
-	}
-	else
+	if (xQueueReceive(*mbox, msg, 0) != pdPASS)
 	{
 		return SYS_MBOX_EMPTY;
 	}
+
+	return 0;
 }
 
 // check a messagebox
@@ -169,12 +190,18 @@ void sys_mbox_set_invalid(sys_mbox_t *mbox)
 	*mbox = SYS_MBOX_NULL;
 }
 
+// counters of all mboxes
+void sys_arch_mbox_stat(sys_mbox_stat_t *stat)
+{
+	taskENTER_CRITICAL();
+	*stat = mbox_stat;
+	taskEXIT_CRITICAL();
+}
+
 // create a sem
 err_t sys_sem_new(sys_sem_t *sem, u8_t count)
 {
-	osSemaphoreDef(SEM);
-
-	*sem = osSemaphoreCreate(osSemaphore(SEM), 1);
+	*sem = xSemaphoreCreateBinary();
 
 	if (*sem == NULL)
 	{
@@ -184,9 +211,9 @@ err_t sys_sem_new(sys_sem_t *sem, u8_t count)
 		return ERR_MEM;
 	}
 
-	if (count == 0) // Means it can't be taken
+	if (count != 0) // created taken
 	{
-		osSemaphoreWait(*sem, 0);
+		xSemaphoreGive(*sem);
 	}
 
 #if SYS_STATS
@@ -200,34 +227,31 @@ err_t sys_sem_new(sys_sem_t *sem, u8_t count)
 	return ERR_OK;
 }
 
-// wait a sem
+// wait a sem, timeout 0 waits forever
 u32_t sys_arch_sem_wait(sys_sem_t *sem, u32_t timeout)
 {
-	uint32_t starttime = osKernelSysTick();
+	TickType_t start = xTaskGetTickCount();
 
 	if (timeout != 0)
 	{
-		if (osSemaphoreWait(*sem, timeout) == osOK)
-		{
-			return (osKernelSysTick() - starttime);
-		}
-		else
+		if (xSemaphoreTake(*sem, SYS_MS_TO_TICKS(timeout)) != pdTRUE)
 		{
 			return SYS_ARCH_TIMEOUT;
 		}
 	}
 	else
 	{
-		while (osSemaphoreWait(*sem, osWaitForever) != osOK)
+		while (xSemaphoreTake(*sem, portMAX_DELAY) != pdTRUE)
 			;
-		return (osKernelSysTick() - starttime);
 	}
+
+	return (xTaskGetTickCount() - start) * portTICK_PERIOD_MS;
 }
 
 // send a sem
 void sys_sem_signal(sys_sem_t *sem)
 {
-	osSemaphoreRelease(*sem);
+	xSemaphoreGive(*sem);
 }
 
 // delete a sem
@@ -237,7 +261,7 @@ void sys_sem_free(sys_sem_t *sem)
 	--lwip_stats.sys.sem.used;
 #endif /* SYS_STATS */
 
-	osSemaphoreDelete(*sem);
+	vSemaphoreDelete(*sem);
 }
 
 // check a sem
@@ -254,24 +278,17 @@ void sys_sem_set_invalid(sys_sem_t *sem)
 	*sem = SYS_SEM_NULL;
 }
 
-osMutexId lwip_sys_mutex;
-osMutexDef(lwip_sys_mutex);
 // Initialize sys arch
 void sys_init(void)
 {
-	lwip_sys_mutex = osMutexCreate(osMutex(lwip_sys_mutex));
 }
 
 #if LWIP_COMPAT_MUTEX == 0
 /* Create a new mutex*/
 err_t sys_mutex_new(sys_mutex_t *mutex)
 {
+	*mutex = xSemaphoreCreateMutex();
 
-	osMutexDef(MUTEX);
-
-	*mutex = osMutexCreate(osMutex(MUTEX));
-
-	//*mutex = xSemaphoreCreateMutex();
 	if (*mutex == NULL)
 	{
 #if SYS_STATS
@@ -297,20 +314,21 @@ void sys_mutex_free(sys_mutex_t *mutex)
 	--lwip_stats.sys.mutex.used;
 #endif /* SYS_STATS */
 
-	osMutexDelete(*mutex);
+	vSemaphoreDelete(*mutex);
 }
 /*-----------------------------------------------------------------------------------*/
 /* Lock a mutex*/
 void sys_mutex_lock(sys_mutex_t *mutex)
 {
-	osMutexWait(*mutex, osWaitForever);
+	while (xSemaphoreTake(*mutex, portMAX_DELAY) != pdTRUE)
+		;
 }
 
 /*-----------------------------------------------------------------------------------*/
 /* Unlock a mutex*/
 void sys_mutex_unlock(sys_mutex_t *mutex)
 {
-	osMutexRelease(*mutex);
+	xSemaphoreGive(*mutex);
 }
 #endif /*LWIP_COMPAT_MUTEX*/
 
@@ -318,22 +336,34 @@ void sys_mutex_unlock(sys_mutex_t *mutex)
   Starts a new thread with priority "prio" that will begin its execution in the
   function "thread()". The "arg" argument will be passed as an argument to the
   thread() function. The id of the new thread is returned. Both the id and
-  the priority are system dependent.
+  the priority are system dependent: prio is an osPriority as in lwipopts.h,
+  stacksize is in words as for osThreadDef.
 */
 sys_thread_t sys_thread_new(const char *name, lwip_thread_fn thread , void *arg, int stacksize, int prio)
 {
-  const osThreadDef_t os_thread_def = { (char *)name, (os_pthread)thread, (osPriority)prio, 0, stacksize};
-  return osThreadCreate(&os_thread_def, arg);
+	TaskHandle_t handle = NULL;
+
+	if (xTaskCreate((TaskFunction_t)thread, name, (uint16_t)stacksize, arg,
+	                (UBaseType_t)(tskIDLE_PRIORITY + (prio - osPriorityIdle)), &handle) != pdPASS)
+	{
+		return NULL;
+	}
+	return handle;
 }
 
+/*
+  The protected sections of lwIP (pool and pbuf bookkeeping) are a few
+  instructions long and lwIP only runs in tasks here, so a critical section
+  is far cheaper than the mutex it replaces. The kernel counts the nesting.
+*/
 sys_prot_t sys_arch_protect(void)
 {
-	osMutexWait(lwip_sys_mutex, osWaitForever);
+	taskENTER_CRITICAL();
 	return (sys_prot_t)1;
 }
 
 void sys_arch_unprotect(sys_prot_t pval)
 {
 	(void)pval;
-	osMutexRelease(lwip_sys_mutex);
+	taskEXIT_CRITICAL();
 }
@@ -33,14 +33,24 @@
 #define __ARCH_SYS_ARCH_H__ 
 
 #include "arch/cc.h"
-#include "cmsis_os.h"
+#include "cmsis_os.h"       // osPriority of the thread priorities in lwipopts.h
+#include "queue.h"
+#include "semphr.h"
 
-#define SYS_MBOX_NULL (osMessageQId)0
-#define SYS_SEM_NULL  (osSemaphoreId)0
+#define SYS_MBOX_NULL (QueueHandle_t)0
+#define SYS_SEM_NULL  (SemaphoreHandle_t)0
 
-typedef osSemaphoreId sys_sem_t;
-typedef osSemaphoreId sys_mutex_t;
-typedef osMessageQId  sys_mbox_t;
-typedef osThreadId    sys_thread_t;
+typedef SemaphoreHandle_t sys_sem_t;
+typedef SemaphoreHandle_t sys_mutex_t;
+typedef QueueHandle_t     sys_mbox_t;
+typedef TaskHandle_t      sys_thread_t;
 
-#endif 
+// mailbox counters of sys_arch.c, read with sys_arch_mbox_stat()
+typedef struct {
+	u32_t full;         // posts that found the mbox full
+	u16_t max;          // most messages waiting in any mbox after a post
+} sys_mbox_stat_t;
+
+void sys_arch_mbox_stat(sys_mbox_stat_t *stat);
+
+#endif
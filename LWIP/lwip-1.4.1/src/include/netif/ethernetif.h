@@ -13,8 +13,6 @@
 #define INTERFACE_THREAD_STACK_SIZE            ( 512 )
 
 extern ETH_HandleTypeDef EthHandle;           
-	
-extern sys_sem_t s_xSemaphore;
 
 void KSZ8041NL_reset_port_init(void);
 void KSZ8041NL_reset(void);
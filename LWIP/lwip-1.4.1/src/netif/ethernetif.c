@@ -6,6 +6,7 @@
 #include "string.h"
 #include "user_config.h"
 #include "boardDefinition.h"
+#include "event_trace.h"
 
 // Declare the ETH structure
 ETH_HandleTypeDef EthHandle;
@@ -14,8 +15,8 @@ ETH_DMADescTypeDef DMARxDscrTab[ETH_RXBUFNB];
 uint8_t ETH_Tx_Buff[ETH_TXBUFNB][ETH_TX_BUF_SIZE];
 uint8_t ETH_Rx_Buff[ETH_RXBUFNB][ETH_RX_BUF_SIZE];
 
-/* Semaphore to signal incoming packets */
-osSemaphoreId s_xSemaphore = NULL;
+/* Task woken by the rx interrupt, with a notification */
+static TaskHandle_t eth_input_task = NULL;
 
 
 void KSZ8041NL_reset_port_init(void)
@@ -120,7 +121,13 @@ void ETH_IRQHandler(void)
 
 void HAL_ETH_RxCpltCallback(ETH_HandleTypeDef *heth)
 {
-    osSemaphoreRelease(s_xSemaphore);
+    BaseType_t woken = pdFALSE;
+
+    if (eth_input_task != NULL)
+    {
+        vTaskNotifyGiveFromISR(eth_input_task, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
 }
 
 void HAL_ETH_ErrorCallback(ETH_HandleTypeDef *heth)
@@ -181,12 +188,9 @@ static void low_level_init(struct netif *netif)
     /* Accept broadcast address and ARP traffic */
     netif->flags |= NETIF_FLAG_BROADCAST | NETIF_FLAG_ETHARP;
 
-    osSemaphoreDef(SEM);
-    s_xSemaphore = osSemaphoreCreate(osSemaphore(SEM), 1);
-
     /* create the task that handles the ETH_MAC */
     osThreadDef(EthIf, ethernetif_input, osPriorityHigh, 0, INTERFACE_THREAD_STACK_SIZE);
-    osThreadCreate(osThread(EthIf), netif);
+    eth_input_task = osThreadCreate(osThread(EthIf), netif);
 
     /* Enable MAC and DMA transmission and reception */
     HAL_ETH_Start(&EthHandle);
@@ -264,6 +268,7 @@ error:
 
         EthHandle.Instance->DMATPDR = 0;
     }
+    EVENT_TRACE2(EVENT_NET_ETH_TX, framelength, errval);
     return errval;
 }
 
@@ -361,7 +366,8 @@ void ethernetif_input(void const *argument)
 
     for (;;)
     {
-        if (osSemaphoreWait(s_xSemaphore, osWaitForever) == osOK)
+        /* one notification or many, every frame in the ring is taken */
+        if (ulTaskNotifyTake(pdTRUE, portMAX_DELAY) != 0)
         {
             do
             {
@@ -22,8 +22,8 @@
 #include "commAPI.h"
 #include "user_config.h"
 #include "tcp_driver.h"
-#include "cJSON.h"
 #include "app_version.h"
+#include "event_trace.h"
 
 client_s driver_client;
 client_s driver_data_client;
@@ -32,6 +32,7 @@ uint8_t driver_tx_buf[DRIVER_TX_BUFSIZE];
 uint8_t driver_rx_buf[DRIVER_RX_BUFSIZE];
 uint8_t driver_data_tx_buf[DRIVER_TX_BUFSIZE];
 uint8_t driver_data_rx_buf[DRIVER_RX_BUFSIZE];
+FIFO_SIZE_CHECK(DRIVER_TX_BUFSIZE);
 
 ip_addr_t server_ip;
 
@@ -47,7 +48,9 @@ err_t client_write_data(client_s* client, uint8_t *tx_buf, uint16_t tx_len, uint
 {
 	err_t err;
 
+	EVENT_TRACE2(EVENT_NET_WRITE_BEGIN, client->client, tx_len);
 	err = netconn_write(client->client, tx_buf, tx_len, apiflags);
+	EVENT_TRACE2(EVENT_NET_WRITE_END, client->client, err);
 	if (ERR_IS_FATAL(err))
 	{
 		if (client->client_state == CLIENT_STATE_REQUEST || client->client_state == CLIENT_STATE_INTERACTIVE)
@@ -248,15 +251,21 @@ void driver_interface(void)
 
 
 
+static int driver_data_json_sink(void *ctx, const char *data, uint16_t len)
+{
+    return client_write_data((client_s *)ctx, (uint8_t *)data, len, NETCONN_COPY) == ERR_OK;
+}
+
 void driver_output_data_interface(void)
 {
     static ip_addr_t server_ipaddr;
-    static uint8_t tx_buf[DRIVER_TX_BUFSIZE];
+    static uint8_t tx_buf[64];
+    static uint8_t trace_buf[EVENT_TRACE_FRAME_LEN(EVENT_TRACE_TCP_RECORDS)];
     static uint8_t write_fail = 0;
+    uint8_t *tx_data;
     uint16_t tx_len = 0;
+    int span;
     err_t err;
-    cJSON *root, *fmt;
-    char *out;
     if (is_eth_link_down())
     {
         client_link_down(&driver_data_client);
@@ -312,39 +321,7 @@ void driver_output_data_interface(void)
                 {
                     if (strstr((const char*)driver_data_rx_buf, "get configuration\r\n") != NULL)
                     {
-                        root = cJSON_CreateObject();
-                        cJSON_AddItemToObject(root, "openrtk configuration", fmt = cJSON_CreateObject());
-                        cJSON_AddItemToObject(fmt, "Product Name", cJSON_CreateString(PRODUCT_NAME_STRING));
-                        cJSON_AddItemToObject(fmt, "Product PN", cJSON_CreateString((const char *)platformBuildInfo()));
-                        cJSON_AddItemToObject(fmt, "Product SN", cJSON_CreateNumber(GetUnitSerialNum()));
-                        cJSON_AddItemToObject(fmt, "Version", cJSON_CreateString(APP_VERSION_STRING));
-
-                        uint8_t *user_packet_type = get_user_packet_type();
-                        char packet_type_str[5] = {0};
-                        packet_type_str[0] = user_packet_type[0];
-                        packet_type_str[1] = user_packet_type[1];
-
-                        uint16_t user_packet_rate = get_user_packet_rate();
-
-                        cJSON_AddItemToObject(fmt, "userPacketType", cJSON_CreateString(packet_type_str));
-                        cJSON_AddItemToObject(fmt, "userPacketRate", cJSON_CreateNumber(user_packet_rate));
-
-                        float *ins_para = get_user_ins_para();
-                        cJSON_AddItemToObject(fmt, "leverArmBx", cJSON_CreateNumber(*ins_para));
-                        cJSON_AddItemToObject(fmt, "leverArmBy", cJSON_CreateNumber(*(ins_para + 1)));
-                        cJSON_AddItemToObject(fmt, "leverArmBz", cJSON_CreateNumber(*(ins_para + 2)));
-                        cJSON_AddItemToObject(fmt, "pointOfInterestBx", cJSON_CreateNumber(*(ins_para + 3)));
-                        cJSON_AddItemToObject(fmt, "pointOfInterestBy", cJSON_CreateNumber(*(ins_para + 4)));
-                        cJSON_AddItemToObject(fmt, "pointOfInterestBz", cJSON_CreateNumber(*(ins_para + 5)));
-                        cJSON_AddItemToObject(fmt, "rotationRbvx", cJSON_CreateNumber(*(ins_para + 6)));
-                        cJSON_AddItemToObject(fmt, "rotationRbvy", cJSON_CreateNumber(*(ins_para + 7)));
-                        cJSON_AddItemToObject(fmt, "rotationRbvz", cJSON_CreateNumber(*(ins_para + 8)));
-
-                        out = cJSON_Print(root);
-                        cJSON_Delete(root);
-                        client_write_data(&driver_data_client, out, strlen(out), NETCONN_COPY);
-                        // uart_write_bytes(UART_DEBUG, out, strlen(out), 1);
-                        free(out);
+                        write_configuration_json(driver_data_json_sink, &driver_data_client);
                         debug_com_log_on = 0;
                     }
                     if (strstr((const char*)driver_data_rx_buf, "log debug on\r\n") != NULL)
@@ -353,6 +330,10 @@ void driver_output_data_interface(void)
                         debug_p1_log_delay = 100;
                         driver_data_client.client_state = CLIENT_STATE_INTERACTIVE;
                     }
+                    if (event_trace_command((const char*)driver_data_rx_buf, EVENT_TRACE_SINK_TCP))
+                    {
+                        driver_data_client.client_state = CLIENT_STATE_INTERACTIVE;
+                    }
                 }
                 // if (rx_len && strstr((char *)driver_data_rx_buf, "i am pc") != NULL)
                 // {
@@ -369,16 +350,31 @@ void driver_output_data_interface(void)
             }
             break;
         case CLIENT_STATE_INTERACTIVE:
-            tx_len = fifo_get(&driver_data_client.client_tx_fifo, tx_buf, DRIVER_TX_BUFSIZE);
-            if (tx_len)
+            // send straight out of the fifo, two spans when the data wraps
+            for (span = 0; span < 2; span++)
             {
-                err = client_write_data(&driver_data_client,tx_buf, tx_len, NETCONN_NOFLAG);
+                tx_len = fifo_peek(&driver_data_client.client_tx_fifo, &tx_data);
+                if (tx_len == 0)
+                {
+                    break;
+                }
+                err = client_write_data(&driver_data_client, tx_data, tx_len, NETCONN_COPY);
+                fifo_commit(&driver_data_client.client_tx_fifo, tx_len);
                 if (err != 0) {
                     write_fail++;
                     if (write_fail >= 3)
                     {
                         driver_data_client.client_state = CLIENT_STATE_OFF;
                     }
+                    break;
+                }
+            }
+            if (event_trace_sink() == EVENT_TRACE_SINK_TCP)
+            {
+                tx_len = event_trace_drain(trace_buf, sizeof(trace_buf));
+                if (tx_len)
+                {
+                    client_write_data(&driver_data_client, trace_buf, tx_len, NETCONN_COPY);
                 }
             }
             break;
@@ -394,6 +390,11 @@ void driver_output_data_interface(void)
             break;
 
         case CLIENT_STATE_OFF:
+            // nobody left to drain to
+            if (event_trace_sink() == EVENT_TRACE_SINK_TCP)
+            {
+                event_trace_stop();
+            }
             if (!is_eth_link_down())
             {
                 if (get_eth_mode() == ETHMODE_DHCP)
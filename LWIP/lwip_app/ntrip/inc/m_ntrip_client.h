@@ -11,10 +11,11 @@
 #include "lwip/sys.h"
 #include "lwip/api.h"
 #include "utils.h"
+#include "ntrip_rx.h"
 
 // ntrip buffer size
-#define NTRIP_TX_BUFSIZE 2000
-#define NTRIP_RX_BUFSIZE 2000
+#define NTRIP_TX_BUFSIZE 2048
+#define NTRIP_RX_BUFSIZE 2048
 
 // ntrip client start
 #define NTRIP_START_OFF 0
@@ -50,6 +51,7 @@ void fill_localrtk_request_payload(uint8_t* payload, uint16_t *payloadLen);
 
 err_t ntrip_read_data(uint8_t *rxBuf, uint16_t *rxLen);
 err_t ntrip_push_rx_data(fifo_type* fifo);
+err_t ntrip_queue_rx_data(void);
 err_t ntrip_write_data(uint8_t *txBuf, uint16_t txLen, uint8_t apiflags);
 uint8_t ntrip_push_tx_data(uint8_t* buf, uint16_t len);
 void ntrip_link_down(void);
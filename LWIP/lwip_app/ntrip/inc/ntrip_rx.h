@@ -0,0 +1,42 @@
+#ifndef _NTRIP_RX_H_
+#define _NTRIP_RX_H_
+
+// zero copy receive of both ntrip clients. The client task queues the
+// netbufs here, nothing is copied into ntrip_rx_fifo. The rtcm task reads
+// them with ntrip_rx_input_rtcm3(), which frames them in place, or with
+// ntrip_rx_get() where it had fifo_get() on ntrip_rx_fifo. An application
+// that still reads ntrip_rx_fifo builds with NTRIP_RX_FIFO, which keeps the
+// old copy.
+
+#include <stdint.h>
+#include "lwip/err.h"
+#include "lwip/api.h"
+#include "gnss_data_api.h"
+
+// netbufs queued for the rtcm decoder, power of 2
+#define NTRIP_RX_REFS 4
+
+typedef struct
+{
+    struct netbuf *buf;
+    uint32_t arrival;       // HAL tick at netconn_recv
+} ntrip_rx_ref_t;
+
+// socket arrival to obs_t latency of the correction epochs (ms)
+typedef struct
+{
+    uint32_t n;
+    uint32_t last;
+    uint32_t min;
+    uint32_t max;
+    uint32_t sum;
+} ntrip_rx_latency_t;
+
+err_t ntrip_rx_recv(struct netconn *conn);
+uint16_t ntrip_rx_peek(uint8_t **data, uint32_t *arrival);
+void ntrip_rx_commit(uint16_t len);
+uint16_t ntrip_rx_get(uint8_t *buf, uint16_t len);
+int ntrip_rx_input_rtcm3(unsigned int stnID, gnss_rtcm_t *gnss);
+const ntrip_rx_latency_t *ntrip_rx_latency(void);
+
+#endif
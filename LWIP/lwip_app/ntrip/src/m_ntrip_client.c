@@ -21,6 +21,8 @@ fifo_type ntrip_tx_fifo;
 fifo_type ntrip_rx_fifo;
 CCMRAM uint8_t ntripTxBuf[NTRIP_TX_BUFSIZE];
 CCMRAM uint8_t ntripRxBuf[NTRIP_RX_BUFSIZE];
+FIFO_SIZE_CHECK(NTRIP_TX_BUFSIZE);
+FIFO_SIZE_CHECK(NTRIP_RX_BUFSIZE);
 uint32_t ntripStreamCount = NTRIP_STREAM_CONNECTED_MAX_COUNT;
 
 /** ***************************************************************************
@@ -89,7 +91,6 @@ err_t ntrip_read_data(uint8_t *rxBuf, uint16_t *rxLen)
 	err = netconn_recv(Ntrip_client, &rxNetbuf);
 	if (err == ERR_OK)
 	{
-		taskENTER_CRITICAL();
 		for (q = rxNetbuf->p; q != NULL; q = q->next)
 		{
 			if (q->len > (NTRIP_RX_BUFSIZE - len))
@@ -101,7 +102,6 @@ err_t ntrip_read_data(uint8_t *rxBuf, uint16_t *rxLen)
 				break;
 		}
 		*rxLen = len;
-		taskEXIT_CRITICAL();
 	}
 	netbuf_delete(rxNetbuf);
 
@@ -132,13 +132,10 @@ err_t ntrip_push_rx_data(fifo_type* fifo)
 	err = netconn_recv(Ntrip_client, &rxNetbuf);
 	if (err == ERR_OK)
 	{
-		taskENTER_CRITICAL();
 		for (q = rxNetbuf->p; q != NULL; q = q->next)
 		{
-            fifo_push(fifo, q->payload, q->len);
-            len += q->len;
+            len += fifo_push(fifo, q->payload, q->len);
 		}
-		taskEXIT_CRITICAL();
         //printf("ntrip_push_rx_data=%d\r\n", len);
 	}
 	netbuf_delete(rxNetbuf);
@@ -154,6 +151,28 @@ err_t ntrip_push_rx_data(fifo_type* fifo)
 	return err;
 }
 
+/** ***************************************************************************
+ * @name ntrip_queue_rx_data() 
+ * @brief ntrip client recieve data and queue the netbuf itself for the rtcm
+ *        decoder, see ntrip_rx_recv()
+ * @param N/A
+ * @retval success(ERR_OK) fail(other)
+ ******************************************************************************/
+err_t ntrip_queue_rx_data(void)
+{
+	err_t err = ntrip_rx_recv(Ntrip_client);
+
+	if (ERR_IS_FATAL(err))
+	{
+#ifdef DEVICE_DEBUG
+		printf("ntrip_queue_rx_data fail %d\r\n", err);
+#endif
+		NTRIP_client_state = NTRIP_STATE_CONNECT;
+	}
+	
+	return err;
+}
+
 /** ***************************************************************************
  * @name ntrip_write_data
  * @brief ntrip client write function
@@ -371,7 +390,11 @@ void NTRIP_interface(void)
         break;
 
     case NTRIP_STATE_INTERACTIVE:
+#ifdef NTRIP_RX_FIFO
         err = ntrip_push_rx_data(&ntrip_rx_fifo);
+#else
+        err = ntrip_queue_rx_data();
+#endif
         //printf("rx err=%d\r\n",err);
         txLen = fifo_get(&ntrip_tx_fifo, txBuf, 512);
         if (txLen)
@@ -0,0 +1,197 @@
+#include <string.h>
+#include "ntrip_rx.h"
+#include "stm32f4xx_hal.h"
+
+#if NTRIP_RX_REFS >= MEMP_NUM_NETBUF
+#error "the netbufs queued here take the whole lwip pool"
+#endif
+
+// received netbufs waiting for the rtcm decoder, single producer (NTRIP task)
+// and single consumer, the indexes are free running
+static ntrip_rx_ref_t ntripRxRef[NTRIP_RX_REFS];
+static volatile uint8_t ntripRxRefIn = 0;
+static volatile uint8_t ntripRxRefOut = 0;
+static uint16_t ntripRxOffset = 0;	// bytes read in the current pbuf
+static ntrip_rx_latency_t ntripRxLatency;
+
+/** ***************************************************************************
+ * @name ntrip_rx_recv() 
+ * @brief producer side: receive from the connection and queue the netbuf
+ *        itself for the rtcm decoder, nothing is copied. When the queue is
+ *        full the data stays in the connection and tcp flow control holds
+ *        the caster back.
+ * @param *conn ntrip client connection
+ * @retval success(ERR_OK) fail(other)
+ ******************************************************************************/
+err_t ntrip_rx_recv(struct netconn *conn)
+{
+	struct netbuf *rxNetbuf;
+	uint8_t in = ntripRxRefIn;
+	err_t err;
+
+	if ((uint8_t)(in - ntripRxRefOut) >= NTRIP_RX_REFS)
+	{
+		return ERR_OK;
+	}
+
+	err = netconn_recv(conn, &rxNetbuf);
+	if (err == ERR_OK)
+	{
+		ntripRxRef[in % NTRIP_RX_REFS].buf = rxNetbuf;
+		ntripRxRef[in % NTRIP_RX_REFS].arrival = HAL_GetTick();
+		__DMB();	// the slot before the index that publishes it
+		ntripRxRefIn = in + 1;
+	}
+
+	return err;
+}
+
+/** ***************************************************************************
+ * @name ntrip_rx_peek() 
+ * @brief consumer side: unread bytes of the oldest queued pbuf, in place
+ * @param **data set to the first unread byte
+ *        *arrival set to the HAL tick the netbuf was received at (may be NULL)
+ * @retval number of bytes at *data, 0: nothing queued
+ ******************************************************************************/
+uint16_t ntrip_rx_peek(uint8_t **data, uint32_t *arrival)
+{
+	ntrip_rx_ref_t *ref;
+	void *payload;
+	u16_t len;
+
+	while (ntripRxRefOut != ntripRxRefIn)
+	{
+		__DMB();
+		ref = &ntripRxRef[ntripRxRefOut % NTRIP_RX_REFS];
+		netbuf_data(ref->buf, &payload, &len);
+		if (ntripRxOffset < len)
+		{
+			*data = (uint8_t *)payload + ntripRxOffset;
+			if (arrival)
+			{
+				*arrival = ref->arrival;
+			}
+			return len - ntripRxOffset;
+		}
+		ntripRxOffset = 0;
+		if (netbuf_next(ref->buf) < 0)
+		{
+			// whole chain read, give it back to lwip
+			netbuf_delete(ref->buf);
+			ref->buf = NULL;
+			ntripRxRefOut++;
+		}
+	}
+	return 0;
+}
+
+/** ***************************************************************************
+ * @name ntrip_rx_commit() 
+ * @brief consumer side: mark bytes returned by ntrip_rx_peek() as read, a
+ *        netbuf read to its end goes back to lwip at once so the client
+ *        task can queue the next one
+ * @param len number of bytes
+ * @retval N/A
+ ******************************************************************************/
+void ntrip_rx_commit(uint16_t len)
+{
+	ntrip_rx_ref_t *ref = &ntripRxRef[ntripRxRefOut % NTRIP_RX_REFS];
+	void *payload;
+	u16_t plen;
+
+	if (len == 0 || ntripRxRefOut == ntripRxRefIn)
+	{
+		return;
+	}
+	ntripRxOffset += len;
+	netbuf_data(ref->buf, &payload, &plen);
+	if (ntripRxOffset >= plen)
+	{
+		ntripRxOffset = 0;
+		if (netbuf_next(ref->buf) < 0)
+		{
+			netbuf_delete(ref->buf);
+			ref->buf = NULL;
+			ntripRxRefOut++;
+		}
+	}
+}
+
+/** ***************************************************************************
+ * @name ntrip_rx_get() 
+ * @brief consumer side: copy queued bytes out, in place of fifo_get() on
+ *        ntrip_rx_fifo for a reader that takes the bytes one at a time
+ * @param *buf destination
+ *        len size of buf
+ * @retval number of bytes copied
+ ******************************************************************************/
+uint16_t ntrip_rx_get(uint8_t *buf, uint16_t len)
+{
+	uint8_t *data;
+	uint16_t n, got = 0;
+
+	while (got < len && (n = ntrip_rx_peek(&data, NULL)) != 0)
+	{
+		if (n > len - got)
+		{
+			n = len - got;
+		}
+		memcpy(buf + got, data, n);
+		ntrip_rx_commit(n);
+		got += n;
+	}
+	return got;
+}
+
+/** ***************************************************************************
+ * @name ntrip_rx_input_rtcm3() 
+ * @brief consumer side: run every queued byte through the rtcm3 framer and
+ *        time each observation epoch from the arrival of its first byte
+ * @param stnID station index
+ *        *gnss rtcm data struct
+ * @retval number of observation epochs completed
+ ******************************************************************************/
+int ntrip_rx_input_rtcm3(unsigned int stnID, gnss_rtcm_t *gnss)
+{
+	static uint32_t epochArrival = 0;
+	static uint8_t epochOpen = 0;
+	uint8_t *data;
+	uint32_t arrival, latency;
+	unsigned int nused;
+	uint16_t len;
+	int stat, nepoch = 0;
+
+	while ((len = ntrip_rx_peek(&data, &arrival)) != 0)
+	{
+		if (!epochOpen)
+		{
+			epochArrival = arrival;
+			epochOpen = 1;
+		}
+		input_rtcm3_buf(data, len, stnID, gnss, &nused, &stat);
+		ntrip_rx_commit((uint16_t)nused);
+		if (stat == 1)
+		{
+			latency = HAL_GetTick() - epochArrival;
+			if (ntripRxLatency.n == 0 || latency < ntripRxLatency.min) ntripRxLatency.min = latency;
+			if (latency > ntripRxLatency.max) ntripRxLatency.max = latency;
+			ntripRxLatency.last = latency;
+			ntripRxLatency.sum += latency;
+			ntripRxLatency.n++;
+			epochOpen = 0;
+			nepoch++;
+		}
+	}
+	return nepoch;
+}
+
+/** ***************************************************************************
+ * @name ntrip_rx_latency() 
+ * @brief socket arrival to obs_t latency of the corrections, in ms
+ * @param N/A
+ * @retval statistics since start
+ ******************************************************************************/
+const ntrip_rx_latency_t *ntrip_rx_latency(void)
+{
+	return &ntripRxLatency;
+}
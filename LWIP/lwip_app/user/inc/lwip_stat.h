@@ -0,0 +1,48 @@
+/** ***************************************************************************
+ * @file   lwip_stat.h
+ * @brief  snapshot of the lwIP resource counters, for the NS packet and the
+ *         web page
+ ******************************************************************************/
+#ifndef _LWIP_STAT_H_
+#define _LWIP_STAT_H_
+
+#include <stdint.h>
+
+// pools in the order they are reported, a pool not built in reads as zeros
+typedef enum
+{
+    LWIP_STAT_POOL_PBUF             = 0,    // PBUF_REF/ROM, MEMP_NUM_PBUF
+    LWIP_STAT_POOL_PBUF_POOL        = 1,    // PBUF_POOL_SIZE
+    LWIP_STAT_POOL_TCP_SEG          = 2,
+    LWIP_STAT_POOL_TCP_PCB          = 3,
+    LWIP_STAT_POOL_NETBUF           = 4,
+    LWIP_STAT_POOL_NETCONN          = 5,
+    LWIP_STAT_POOL_TCPIP_MSG_API    = 6,
+    LWIP_STAT_POOL_TCPIP_MSG_INPKT  = 7,
+    LWIP_STAT_POOL_SYS_TIMEOUT      = 8,
+    LWIP_STAT_POOLS                 = 9
+} lwip_stat_pool_enum_t;
+
+typedef struct
+{
+    uint16_t used;
+    uint16_t max;                   // high-water mark
+    uint16_t avail;                 // size of the pool
+    uint32_t err;                   // allocations that failed
+} lwip_stat_pool_t;
+
+typedef struct
+{
+    lwip_stat_pool_t pool[LWIP_STAT_POOLS];
+    lwip_stat_pool_t heap;          // mem_malloc() heap, in bytes
+    uint32_t mbox_full;             // posts that found a mbox full
+    uint16_t mbox_max;              // most messages waiting in a mbox
+    uint32_t tcp_rexmit;            // fast retransmits, MIB2 tcpRetransSegs
+} lwip_stat_t;
+
+extern unsigned long lwip_stat_tcp_rexmit;    // lwip_mib2.c
+
+void lwip_stat_get(lwip_stat_t *stat);
+const char *lwip_stat_pool_name(uint8_t pool);
+
+#endif /* _LWIP_STAT_H_ */
@@ -16,6 +16,7 @@
 #define MEMP_NUM_TCP_PCB_LISTEN        1
 #define MEMP_NUM_TCP_SEG               16
 #define MEMP_NUM_SYS_TIMEOUT           8
+#define MEMP_NUM_NETBUF                7    // NTRIP_RX_REFS held by the ntrip client, one for each other netconn reader
 
 /* ---------- Pbuf ---------- */
 #define PBUF_POOL_SIZE                 12
@@ -48,9 +49,34 @@
 #define LWIP_UDPLITE                   1
 
 /* ---------- Statistics options ---------- */
-#define LWIP_STATS                     0
+/* only the counters of lwip_stat.c: pool, heap and mbox use, all of them
+   updated where lwIP already holds SYS_ARCH_PROTECT */
+#define LWIP_STATS                     1
+#define LWIP_STATS_DISPLAY             0
+#define LINK_STATS                     0
+#define ETHARP_STATS                   0
+#define IP_STATS                       0
+#define IPFRAG_STATS                   0
+#define ICMP_STATS                     0
+#define IGMP_STATS                     0
+#define UDP_STATS                      0
+#define TCP_STATS                      0
+#define MEM_STATS                      1
+#define MEMP_STATS                     1
+#define SYS_STATS                      1
 #define LWIP_PROVIDE_ERRNO             1
 
+/* ---------- MIB2 counters ---------- */
+/* lwIP's MIB2 calls without an agent behind them: lwip_mib2.c keeps
+   tcpRetransSegs for lwip_stat.c and drops the rest, the SNMP pools are
+   left at one entry each */
+#define LWIP_SNMP                      1
+#define MEMP_NUM_SNMP_NODE             1
+#define MEMP_NUM_SNMP_ROOTNODE         1
+#define MEMP_NUM_SNMP_VARBIND          1
+#define MEMP_NUM_SNMP_VALUE            1
+#define SNMP_MAX_VALUE_SIZE            4
+
 /* ---------- link callback options ---------- */
 #define LWIP_NETIF_LINK_CALLBACK       1
 
@@ -175,9 +201,34 @@
 #define LWIP_UDPLITE                   1
 
 /* ---------- Statistics options ---------- */
-#define LWIP_STATS                     0
+/* only the counters of lwip_stat.c: pool, heap and mbox use, all of them
+   updated where lwIP already holds SYS_ARCH_PROTECT */
+#define LWIP_STATS                     1
+#define LWIP_STATS_DISPLAY             0
+#define LINK_STATS                     0
+#define ETHARP_STATS                   0
+#define IP_STATS                       0
+#define IPFRAG_STATS                   0
+#define ICMP_STATS                     0
+#define IGMP_STATS                     0
+#define UDP_STATS                      0
+#define TCP_STATS                      0
+#define MEM_STATS                      1
+#define MEMP_STATS                     1
+#define SYS_STATS                      1
 #define LWIP_PROVIDE_ERRNO             1
 
+/* ---------- MIB2 counters ---------- */
+/* lwIP's MIB2 calls without an agent behind them: lwip_mib2.c keeps
+   tcpRetransSegs for lwip_stat.c and drops the rest, the SNMP pools are
+   left at one entry each */
+#define LWIP_SNMP                      1
+#define MEMP_NUM_SNMP_NODE             1
+#define MEMP_NUM_SNMP_ROOTNODE         1
+#define MEMP_NUM_SNMP_VARBIND          1
+#define MEMP_NUM_SNMP_VALUE            1
+#define SNMP_MAX_VALUE_SIZE            4
+
 /* ---------- link callback options ---------- */
 #define LWIP_NETIF_LINK_CALLBACK       1
 
@@ -0,0 +1,93 @@
+/** ***************************************************************************
+ * @file   lwip_mib2.c
+ * @brief  the MIB2 calls of lwIP (LWIP_SNMP in lwipopts.h), without an agent
+ *
+ * There is no SNMP agent in the build: lwIP calls these where it counts the
+ * MIB2 objects and only tcpRetransSegs is kept, for lwip_stat.c. lwIP 1.4.1
+ * counts it in tcp_rexmit(), the fast retransmits; a retransmission timeout
+ * (tcp_rexmit_rto()) is not a MIB2 event there. The calls lwIP makes are
+ * all here, the rest of snmp.h is not linked in.
+ ******************************************************************************/
+#include "lwip/opt.h"
+
+#if LWIP_SNMP
+
+#include "lwip/snmp.h"
+#include "lwip/snmp_msg.h"
+#include "lwip/sys.h"
+#include "lwip_stat.h"
+
+unsigned long lwip_stat_tcp_rexmit = 0;
+
+void snmp_inc_tcpretranssegs(void)
+{
+    lwip_stat_tcp_rexmit++;
+}
+
+// sysUpTime, in 10 ms, stamps the netif up and down changes
+void snmp_get_sysuptime(u32_t *value)
+{
+    *value = sys_now() / 10;
+}
+
+void snmp_init(void) {}
+
+/* network interface */
+void snmp_add_ifinoctets(struct netif *ni, u32_t value) { (void)ni; (void)value; }
+void snmp_inc_ifinucastpkts(struct netif *ni) { (void)ni; }
+void snmp_add_ifoutoctets(struct netif *ni, u32_t value) { (void)ni; (void)value; }
+void snmp_inc_ifoutucastpkts(struct netif *ni) { (void)ni; }
+void snmp_inc_ifoutdiscards(struct netif *ni) { (void)ni; }
+void snmp_inc_iflist(void) {}
+void snmp_dec_iflist(void) {}
+
+/* ARP */
+void snmp_insert_arpidx_tree(struct netif *ni, ip_addr_t *ip) { (void)ni; (void)ip; }
+void snmp_delete_arpidx_tree(struct netif *ni, ip_addr_t *ip) { (void)ni; (void)ip; }
+
+/* IP */
+void snmp_inc_ipinreceives(void) {}
+void snmp_inc_ipinhdrerrors(void) {}
+void snmp_inc_ipinaddrerrors(void) {}
+void snmp_inc_ipforwdatagrams(void) {}
+void snmp_inc_ipinunknownprotos(void) {}
+void snmp_inc_ipindiscards(void) {}
+void snmp_inc_ipindelivers(void) {}
+void snmp_inc_ipoutrequests(void) {}
+void snmp_inc_ipoutdiscards(void) {}
+void snmp_inc_ipoutnoroutes(void) {}
+void snmp_inc_ipreasmreqds(void) {}
+void snmp_inc_ipreasmfails(void) {}
+void snmp_inc_ipfragoks(void) {}
+void snmp_inc_ipfragcreates(void) {}
+void snmp_insert_ipaddridx_tree(struct netif *ni) { (void)ni; }
+void snmp_delete_ipaddridx_tree(struct netif *ni) { (void)ni; }
+void snmp_insert_iprteidx_tree(u8_t dflt, struct netif *ni) { (void)dflt; (void)ni; }
+void snmp_delete_iprteidx_tree(u8_t dflt, struct netif *ni) { (void)dflt; (void)ni; }
+
+/* ICMP */
+void snmp_inc_icmpinmsgs(void) {}
+void snmp_inc_icmpinerrors(void) {}
+void snmp_inc_icmpoutmsgs(void) {}
+void snmp_inc_icmpouttimeexcds(void) {}
+void snmp_inc_icmpoutechoreps(void) {}
+
+/* TCP */
+void snmp_inc_tcpactiveopens(void) {}
+void snmp_inc_tcppassiveopens(void) {}
+void snmp_inc_tcpattemptfails(void) {}
+void snmp_inc_tcpestabresets(void) {}
+void snmp_inc_tcpinsegs(void) {}
+void snmp_inc_tcpoutsegs(void) {}
+void snmp_inc_tcpinerrs(void) {}
+void snmp_inc_tcpoutrsts(void) {}
+
+/* UDP */
+void snmp_inc_udpindatagrams(void) {}
+void snmp_inc_udpnoports(void) {}
+void snmp_inc_udpinerrors(void) {}
+void snmp_inc_udpoutdatagrams(void) {}
+void snmp_insert_udpidx_tree(struct udp_pcb *pcb) { (void)pcb; }
+void snmp_delete_udpidx_tree(struct udp_pcb *pcb) { (void)pcb; }
+
+#endif /* LWIP_SNMP */
@@ -0,0 +1,121 @@
+/** ***************************************************************************
+ * @file   lwip_stat.c
+ * @brief  snapshot of the lwIP resource counters
+ *
+ * lwIP keeps the pool and heap counters itself (MEMP_STATS, MEM_STATS in
+ * lwipopts.h), sys_arch.c the mbox ones and lwip_mib2.c the retransmits of
+ * MIB2 tcpRetransSegs. Only the pools that can run out under load are
+ * reported.
+ ******************************************************************************/
+#include <string.h>
+#include "lwip/opt.h"
+#include "lwip/timers.h"
+#include "lwip/memp.h"
+#include "lwip/stats.h"
+#include "lwip/sys.h"
+#include "arch/sys_arch.h"
+#include "lwip_stat.h"
+
+#define LWIP_STAT_NO_POOL   0xFF
+
+// lwIP pool of each reported pool
+static const struct
+{
+    uint8_t memp;
+    const char *name;
+} lwip_stat_pools[LWIP_STAT_POOLS] = {
+    {MEMP_PBUF,                 "PBUF"},
+    {MEMP_PBUF_POOL,            "PBUF_POOL"},
+#if LWIP_TCP
+    {MEMP_TCP_SEG,              "TCP_SEG"},
+    {MEMP_TCP_PCB,              "TCP_PCB"},
+#else
+    {LWIP_STAT_NO_POOL,         "TCP_SEG"},
+    {LWIP_STAT_NO_POOL,         "TCP_PCB"},
+#endif
+#if LWIP_NETCONN
+    {MEMP_NETBUF,               "NETBUF"},
+    {MEMP_NETCONN,              "NETCONN"},
+#else
+    {LWIP_STAT_NO_POOL,         "NETBUF"},
+    {LWIP_STAT_NO_POOL,         "NETCONN"},
+#endif
+#if NO_SYS == 0
+    {MEMP_TCPIP_MSG_API,        "TCPIP_MSG_API"},
+#if !LWIP_TCPIP_CORE_LOCKING_INPUT
+    {MEMP_TCPIP_MSG_INPKT,      "TCPIP_MSG_INPKT"},
+#else
+    {LWIP_STAT_NO_POOL,         "TCPIP_MSG_INPKT"},
+#endif
+#else
+    {LWIP_STAT_NO_POOL,         "TCPIP_MSG_API"},
+    {LWIP_STAT_NO_POOL,         "TCPIP_MSG_INPKT"},
+#endif
+#if LWIP_TIMERS
+    {MEMP_SYS_TIMEOUT,          "SYS_TIMEOUT"},
+#else
+    {LWIP_STAT_NO_POOL,         "SYS_TIMEOUT"},
+#endif
+};
+
+
+/** ***************************************************************************
+ * @name lwip_stat_get
+ * @brief copy the counters in one protected section so used and max agree
+ * @param [out] stat: the counters
+ * @retval N/A
+ ******************************************************************************/
+void lwip_stat_get(lwip_stat_t *stat)
+{
+    sys_mbox_stat_t mbox;
+    uint8_t i;
+    SYS_ARCH_DECL_PROTECT(lev);
+
+    memset(stat, 0, sizeof(*stat));
+
+    SYS_ARCH_PROTECT(lev);
+#if MEMP_STATS
+    for (i = 0; i < LWIP_STAT_POOLS; i++)
+    {
+        if (lwip_stat_pools[i].memp != LWIP_STAT_NO_POOL)
+        {
+            const struct stats_mem *m = &lwip_stats.memp[lwip_stat_pools[i].memp];
+
+            stat->pool[i].used = (uint16_t)m->used;
+            stat->pool[i].max = (uint16_t)m->max;
+            stat->pool[i].avail = (uint16_t)m->avail;
+            stat->pool[i].err = m->err;
+        }
+    }
+#else
+    (void)i;
+#endif
+#if MEM_STATS
+    stat->heap.used = (uint16_t)lwip_stats.mem.used;
+    stat->heap.max = (uint16_t)lwip_stats.mem.max;
+    stat->heap.avail = (uint16_t)lwip_stats.mem.avail;
+    stat->heap.err = lwip_stats.mem.err;
+#endif
+    stat->tcp_rexmit = (uint32_t)lwip_stat_tcp_rexmit;
+    sys_arch_mbox_stat(&mbox);
+    SYS_ARCH_UNPROTECT(lev);
+
+    stat->mbox_full = mbox.full;
+    stat->mbox_max = mbox.max;
+}
+
+
+/** ***************************************************************************
+ * @name lwip_stat_pool_name
+ * @brief name of a reported pool
+ * @param [in] pool: lwip_stat_pool_enum_t
+ * @retval name, "" out of range
+ ******************************************************************************/
+const char *lwip_stat_pool_name(uint8_t pool)
+{
+    if (pool >= LWIP_STAT_POOLS)
+    {
+        return "";
+    }
+    return lwip_stat_pools[pool].name;
+}
@@ -63,13 +63,10 @@ err_t netconn_push_rx_data(struct netconn *conn, fifo_type *rx_fifo)
 	err = netconn_recv(conn, &rx_netbuf);
 	if (err == ERR_OK)
 	{
-		taskENTER_CRITICAL();
 		for (q = rx_netbuf->p; q != NULL; q = q->next)
 		{
-            fifo_push(rx_fifo, q->payload, q->len);
-            len += q->len;
+            len += fifo_push(rx_fifo, q->payload, q->len);
 		}
-		taskEXIT_CRITICAL();
 	}
 	netbuf_delete(rx_netbuf);
 
@@ -67,6 +67,12 @@ struct fsdata_chksum {
 };
 #endif /* HTTPD_PRECALCULATED_CHECKSUM */
 
+/** fs_file.flags, set by makefsdata.py */
+#define FS_FILE_FLAGS_GZIP    0x01  /* data is gzip, sent with Content-Encoding */
+#define FS_FILE_FLAGS_NO_SSI  0x02  /* no SSI tags, skip the tag parser */
+
+struct fsdata_file;
+
 struct fs_file {
   const char *data;
   int len;
@@ -77,6 +83,9 @@ struct fs_file {
   u16_t chksum_count;
 #endif /* HTTPD_PRECALCULATED_CHECKSUM */
   u8_t http_header_included;
+  u8_t flags;
+  const char *etag;
+  const struct fsdata_file *identity;
 #if LWIP_HTTPD_CUSTOM_FILES
   u8_t is_custom_file;
 #endif /* LWIP_HTTPD_CUSTOM_FILES */
@@ -89,6 +98,7 @@ struct fs_file *fs_open(const char *name);
 void fs_close(struct fs_file *file);
 int fs_read(struct fs_file *file, char *buffer, int count);
 int fs_bytes_left(struct fs_file *file);
+int fs_use_identity(struct fs_file *file);
 
 #if LWIP_HTTPD_FILE_STATE
 /** This user-defined function is called when a file is opened. */
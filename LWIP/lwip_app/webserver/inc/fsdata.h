@@ -1,6 +1,8 @@
 #ifndef __FSDATA_H__
 #define __FSDATA_H__
 
+/* generated by makefsdata.py, edit the files under fs/ instead */
+
 #ifndef BASE_STATION
 
 #include "fs.h"
@@ -17,432 +19,160 @@ static const unsigned char data__css_style_css[] = {
 0x2f,0x63,0x73,0x73,0x2f,0x73,0x74,0x79,0x6c,0x65,0x2e,0x63,0x73,0x73,0x00,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
+/* "HTTP/1.0 200 OK
 " (17 bytes) */
 0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
-/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
+/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
 " (63 bytes) */
 0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
 0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
 0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
 0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-/* "Content-type: text/css
-
-" (26 bytes) */
+/* "Content-type: text/css
+" (24 bytes) */
 0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
-0x78,0x74,0x2f,0x63,0x73,0x73,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (6552 bytes) */
-0x40,0x69,0x6d,0x70,0x6f,0x72,0x74,0x20,0x75,0x72,0x6c,0x28,0x68,0x74,0x74,0x70,
-0x3a,0x2f,0x2f,0x66,0x6f,0x6e,0x74,0x73,0x2e,0x67,0x6f,0x6f,0x67,0x6c,0x65,0x61,
-0x70,0x69,0x73,0x2e,0x63,0x6f,0x6d,0x2f,0x63,0x73,0x73,0x3f,0x66,0x61,0x6d,0x69,
-0x6c,0x79,0x3d,0x52,0x61,0x6c,0x65,0x77,0x61,0x79,0x3a,0x32,0x30,0x30,0x2c,0x34,
-0x30,0x30,0x2c,0x37,0x30,0x30,0x2c,0x38,0x30,0x30,0x29,0x3b,0x0d,0x0a,0x0d,0x0a,
-0x2f,0x2a,0x20,0x43,0x53,0x53,0x20,0x72,0x65,0x73,0x65,0x74,0x20,0x2a,0x2f,0x0d,
-0x0a,0x62,0x6f,0x64,0x79,0x2c,0x64,0x69,0x76,0x2c,0x64,0x6c,0x2c,0x64,0x74,0x2c,
-0x64,0x64,0x2c,0x75,0x6c,0x2c,0x6f,0x6c,0x2c,0x6c,0x69,0x2c,0x68,0x31,0x2c,0x68,
-0x32,0x2c,0x68,0x33,0x2c,0x68,0x34,0x2c,0x68,0x35,0x2c,0x68,0x36,0x2c,0x70,0x72,
-0x65,0x2c,0x66,0x6f,0x72,0x6d,0x2c,0x66,0x69,0x65,0x6c,0x64,0x73,0x65,0x74,0x2c,
-0x69,0x6e,0x70,0x75,0x74,0x2c,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x2c,0x70,
-0x2c,0x62,0x6c,0x6f,0x63,0x6b,0x71,0x75,0x6f,0x74,0x65,0x2c,0x74,0x68,0x2c,0x74,
-0x64,0x20,0x7b,0x20,0x0d,0x0a,0x09,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x30,0x3b,
-0x0d,0x0a,0x09,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x30,0x3b,0x0d,0x0a,0x7d,
-0x0d,0x0a,0x68,0x74,0x6d,0x6c,0x2c,0x62,0x6f,0x64,0x79,0x20,0x7b,0x0d,0x0a,0x09,
-0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x30,0x3b,0x0d,0x0a,0x09,0x70,0x61,0x64,0x64,
-0x69,0x6e,0x67,0x3a,0x30,0x3b,0x0d,0x0a,0x09,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,
-0x20,0x31,0x30,0x30,0x25,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x74,0x61,0x62,0x6c,0x65,
-0x20,0x7b,0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6c,
-0x61,0x70,0x73,0x65,0x3a,0x63,0x6f,0x6c,0x6c,0x61,0x70,0x73,0x65,0x3b,0x0d,0x0a,
-0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3a,
-0x30,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x66,0x69,0x65,0x6c,0x64,0x73,0x65,0x74,0x2c,
-0x69,0x6d,0x67,0x20,0x7b,0x20,0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,
-0x30,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0x2c,0x63,
-0x61,0x70,0x74,0x69,0x6f,0x6e,0x2c,0x63,0x69,0x74,0x65,0x2c,0x63,0x6f,0x64,0x65,
-0x2c,0x64,0x66,0x6e,0x2c,0x74,0x68,0x2c,0x76,0x61,0x72,0x20,0x7b,0x0d,0x0a,0x09,
-0x66,0x6f,0x6e,0x74,0x2d,0x73,0x74,0x79,0x6c,0x65,0x3a,0x6e,0x6f,0x72,0x6d,0x61,
-0x6c,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,
-0x3a,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x6f,0x6c,0x2c,
-0x75,0x6c,0x20,0x7b,0x0d,0x0a,0x09,0x6c,0x69,0x73,0x74,0x2d,0x73,0x74,0x79,0x6c,
-0x65,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x63,0x61,0x70,0x74,
-0x69,0x6f,0x6e,0x2c,0x74,0x68,0x20,0x7b,0x0d,0x0a,0x09,0x74,0x65,0x78,0x74,0x2d,
-0x61,0x6c,0x69,0x67,0x6e,0x3a,0x6c,0x65,0x66,0x74,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,
-0x68,0x31,0x2c,0x68,0x32,0x2c,0x68,0x33,0x2c,0x68,0x34,0x2c,0x68,0x35,0x2c,0x68,
-0x36,0x20,0x7b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,
-0x31,0x30,0x30,0x25,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,
-0x67,0x68,0x74,0x3a,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,
-0x0d,0x0a,0x61,0x62,0x62,0x72,0x2c,0x61,0x63,0x72,0x6f,0x6e,0x79,0x6d,0x20,0x7b,
-0x20,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x30,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x61,
-0x72,0x74,0x69,0x63,0x6c,0x65,0x2c,0x20,0x61,0x73,0x69,0x64,0x65,0x2c,0x20,0x64,
-0x65,0x74,0x61,0x69,0x6c,0x73,0x2c,0x20,0x66,0x69,0x67,0x63,0x61,0x70,0x74,0x69,
-0x6f,0x6e,0x2c,0x20,0x66,0x69,0x67,0x75,0x72,0x65,0x2c,0x0d,0x0a,0x66,0x6f,0x6f,
-0x74,0x65,0x72,0x2c,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x2c,0x20,0x68,0x67,0x72,
-0x6f,0x75,0x70,0x2c,0x20,0x6d,0x65,0x6e,0x75,0x2c,0x20,0x6e,0x61,0x76,0x2c,0x20,
-0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x7b,0x0d,0x0a,0x09,0x64,0x69,0x73,0x70,
-0x6c,0x61,0x79,0x3a,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,
-0x2f,0x2a,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,0x6c,0x20,0x62,0x6f,0x64,0x79,0x20,
-0x53,0x74,0x79,0x6c,0x65,0x20,0x2a,0x2f,0x0d,0x0a,0x62,0x6f,0x64,0x79,0x7b,0x0d,
-0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x27,
-0x52,0x61,0x6c,0x65,0x77,0x61,0x79,0x27,0x2c,0x43,0x61,0x6d,0x62,0x72,0x69,0x61,
-0x2c,0x20,0x41,0x72,0x69,0x61,0x6c,0x2c,0x20,0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,
-0x72,0x69,0x66,0x3b,0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
-0x64,0x3a,0x20,0x23,0x33,0x37,0x33,0x61,0x34,0x37,0x3b,0x0d,0x0a,0x09,0x66,0x6f,
-0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x34,0x30,0x30,0x3b,0x0d,
-0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x35,0x70,
-0x78,0x3b,0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x31,0x64,0x33,
-0x63,0x34,0x31,0x3b,0x0d,0x0a,0x09,0x6f,0x76,0x65,0x72,0x66,0x6c,0x6f,0x77,0x2d,
-0x79,0x3a,0x20,0x73,0x63,0x72,0x6f,0x6c,0x6c,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x61,
-0x20,0x7b,0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x34,0x65,0x34,
-0x61,0x34,0x36,0x3b,0x0d,0x0a,0x09,0x74,0x65,0x78,0x74,0x2d,0x64,0x65,0x63,0x6f,
-0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x0d,0x0a,0x09,
-0x6f,0x75,0x74,0x6c,0x69,0x6e,0x65,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x0d,0x0a,
-0x7d,0x0d,0x0a,0x61,0x3a,0x68,0x6f,0x76,0x65,0x72,0x2c,0x20,0x61,0x3a,0x66,0x6f,
-0x63,0x75,0x73,0x20,0x7b,0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,
-0x63,0x39,0x34,0x65,0x35,0x30,0x3b,0x0d,0x0a,0x09,0x6f,0x75,0x74,0x6c,0x69,0x6e,
-0x65,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x62,0x75,0x74,
-0x74,0x6f,0x6e,0x3a,0x66,0x6f,0x63,0x75,0x73,0x20,0x7b,0x0d,0x0a,0x09,0x6f,0x75,
-0x74,0x6c,0x69,0x6e,0x65,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x0d,0x0a,0x7d,0x0d,
-0x0a,0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x7b,0x0d,0x0a,0x09,0x70,0x61,0x64,
-0x64,0x69,0x6e,0x67,0x3a,0x20,0x31,0x65,0x6d,0x3b,0x0d,0x0a,0x09,0x74,0x65,0x78,
-0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,
-0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x7b,
-0x0d,0x0a,0x09,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,0x0d,
-0x0a,0x09,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,0x0d,
-0x0a,0x09,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x62,0x73,0x6f,0x6c,
-0x75,0x74,0x65,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x63,0x6c,0x72,0x7b,0x0d,0x0a,
-0x09,0x63,0x6c,0x65,0x61,0x72,0x3a,0x20,0x62,0x6f,0x74,0x68,0x3b,0x0d,0x0a,0x7d,
-0x0d,0x0a,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x20,0x3e,0x20,0x68,
-0x65,0x61,0x64,0x65,0x72,0x7b,0x0d,0x0a,0x09,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,
-0x3a,0x20,0x32,0x30,0x70,0x78,0x20,0x30,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x20,
-0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x20,0x30,
-0x70,0x78,0x20,0x30,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x20,0x30,0x70,0x78,0x3b,
-0x0d,0x0a,0x09,0x74,0x65,0x78,0x74,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,
-0x31,0x70,0x78,0x20,0x31,0x70,0x78,0x20,0x31,0x70,0x78,0x20,0x72,0x67,0x62,0x61,
-0x28,0x30,0x2c,0x30,0x2c,0x30,0x2c,0x30,0x2e,0x32,0x29,0x3b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x63,0x65,
-0x6e,0x74,0x65,0x72,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x63,0x6f,0x6e,0x74,0x61,
-0x69,0x6e,0x65,0x72,0x20,0x3e,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x20,0x68,0x31,
-0x7b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x33,
-0x2e,0x37,0x35,0x65,0x6d,0x3b,0x0d,0x0a,0x09,0x6c,0x69,0x6e,0x65,0x2d,0x68,0x65,
-0x69,0x67,0x68,0x74,0x3a,0x20,0x31,0x30,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x74,
-0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,
-0x72,0x3b,0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x72,0x67,0x62,0x61,
-0x28,0x32,0x35,0x35,0x2c,0x32,0x35,0x35,0x2c,0x32,0x35,0x35,0x2c,0x30,0x2e,0x39,
-0x29,0x3b,0x0d,0x0a,0x09,0x74,0x65,0x78,0x74,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,
-0x3a,0x20,0x31,0x70,0x78,0x20,0x31,0x70,0x78,0x20,0x31,0x70,0x78,0x20,0x72,0x67,
-0x62,0x61,0x28,0x30,0x2c,0x30,0x2c,0x30,0x2c,0x30,0x2e,0x31,0x29,0x3b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x30,0x70,0x78,
-0x20,0x30,0x70,0x78,0x20,0x35,0x70,0x78,0x20,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x69,0x6d,
-0x61,0x67,0x65,0x3a,0x20,0x75,0x72,0x6c,0x28,0x2e,0x2e,0x2f,0x69,0x6d,0x61,0x67,
-0x65,0x73,0x2f,0x61,0x63,0x65,0x69,0x6e,0x6e,0x61,0x2e,0x70,0x6e,0x67,0x29,0x3b,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,
-0x2d,0x72,0x65,0x70,0x65,0x61,0x74,0x3a,0x20,0x6e,0x6f,0x2d,0x72,0x65,0x70,0x65,
-0x61,0x74,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,
-0x75,0x6e,0x64,0x2d,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x6c,0x65,
-0x66,0x74,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x73,0x69,0x7a,0x65,0x3a,
-0x20,0x31,0x38,0x30,0x70,0x78,0x20,0x31,0x30,0x35,0x70,0x78,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x69,0x6e,0x6c,0x69,0x6e,
-0x65,0x2d,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,
-0x64,0x64,0x69,0x6e,0x67,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x32,0x30,0x30,0x70,0x78,
-0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,
-0x20,0x3e,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x20,0x68,0x31,0x20,0x73,0x70,0x61,
-0x6e,0x7b,0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x37,0x63,0x62,
-0x63,0x64,0x36,0x3b,0x0d,0x0a,0x09,0x74,0x65,0x78,0x74,0x2d,0x73,0x68,0x61,0x64,
-0x6f,0x77,0x3a,0x20,0x30,0x70,0x78,0x20,0x31,0x70,0x78,0x20,0x31,0x70,0x78,0x20,
-0x72,0x67,0x62,0x61,0x28,0x32,0x35,0x35,0x2c,0x32,0x35,0x35,0x2c,0x32,0x35,0x35,
-0x2c,0x30,0x2e,0x38,0x29,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2f,0x2a,0x20,0x48,0x65,
-0x61,0x64,0x65,0x72,0x20,0x53,0x74,0x79,0x6c,0x65,0x20,0x2a,0x2f,0x0d,0x0a,0x2e,
-0x63,0x6f,0x64,0x72,0x6f,0x70,0x73,0x2d,0x74,0x6f,0x70,0x7b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x43,
-0x61,0x6d,0x62,0x72,0x69,0x61,0x3b,0x0d,0x0a,0x09,0x6c,0x69,0x6e,0x65,0x2d,0x68,
-0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x32,0x34,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x66,
-0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x31,0x70,0x78,0x3b,0x0d,
-0x0a,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x72,0x67,
-0x62,0x61,0x28,0x32,0x35,0x35,0x2c,0x20,0x32,0x35,0x35,0x2c,0x20,0x32,0x35,0x35,
-0x2c,0x20,0x30,0x2e,0x35,0x29,0x3b,0x0d,0x0a,0x09,0x74,0x65,0x78,0x74,0x2d,0x74,
-0x72,0x61,0x6e,0x73,0x66,0x6f,0x72,0x6d,0x3a,0x20,0x75,0x70,0x70,0x65,0x72,0x63,
-0x61,0x73,0x65,0x3b,0x0d,0x0a,0x09,0x7a,0x2d,0x69,0x6e,0x64,0x65,0x78,0x3a,0x20,
-0x39,0x39,0x39,0x39,0x3b,0x0d,0x0a,0x09,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-0x3a,0x20,0x72,0x65,0x6c,0x61,0x74,0x69,0x76,0x65,0x3b,0x0d,0x0a,0x09,0x62,0x6f,
-0x78,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,0x31,0x70,0x78,0x20,0x30,0x70,
-0x78,0x20,0x32,0x70,0x78,0x20,0x72,0x67,0x62,0x61,0x28,0x30,0x2c,0x30,0x2c,0x30,
-0x2c,0x30,0x2e,0x32,0x29,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x63,0x6f,0x64,0x72,
-0x6f,0x70,0x73,0x2d,0x74,0x6f,0x70,0x20,0x61,0x7b,0x0d,0x0a,0x09,0x70,0x61,0x64,
-0x64,0x69,0x6e,0x67,0x3a,0x20,0x30,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x3b,0x0d,
-0x0a,0x09,0x6c,0x65,0x74,0x74,0x65,0x72,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,
-0x3a,0x20,0x31,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,
-0x72,0x3a,0x20,0x72,0x67,0x62,0x28,0x32,0x35,0x35,0x2c,0x20,0x32,0x35,0x35,0x2c,
-0x20,0x32,0x35,0x35,0x29,0x3b,0x0d,0x0a,0x09,0x74,0x65,0x78,0x74,0x2d,0x73,0x68,
-0x61,0x64,0x6f,0x77,0x3a,0x20,0x30,0x70,0x78,0x20,0x31,0x70,0x78,0x20,0x31,0x70,
-0x78,0x20,0x23,0x43,0x43,0x43,0x43,0x43,0x43,0x3b,0x0d,0x0a,0x09,0x64,0x69,0x73,
-0x70,0x6c,0x61,0x79,0x3a,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x0d,0x0a,0x09,0x66,
-0x6c,0x6f,0x61,0x74,0x3a,0x20,0x6c,0x65,0x66,0x74,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,
-0x2e,0x63,0x6f,0x64,0x72,0x6f,0x70,0x73,0x2d,0x74,0x6f,0x70,0x20,0x61,0x3a,0x68,
-0x6f,0x76,0x65,0x72,0x7b,0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,
-0x6e,0x64,0x3a,0x20,0x72,0x67,0x62,0x28,0x32,0x35,0x35,0x2c,0x20,0x32,0x35,0x35,
-0x2c,0x20,0x32,0x35,0x35,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,
-0x6f,0x72,0x3a,0x20,0x72,0x67,0x62,0x28,0x30,0x2c,0x20,0x30,0x2c,0x20,0x30,0x29,
-0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x63,0x6f,0x64,0x72,0x6f,0x70,0x73,0x2d,0x74,
-0x6f,0x70,0x20,0x73,0x70,0x61,0x6e,0x2e,0x72,0x69,0x67,0x68,0x74,0x7b,0x0d,0x0a,
-0x09,0x66,0x6c,0x6f,0x61,0x74,0x3a,0x20,0x72,0x69,0x67,0x68,0x74,0x3b,0x0d,0x0a,
-0x7d,0x0d,0x0a,0x2e,0x63,0x6f,0x64,0x72,0x6f,0x70,0x73,0x2d,0x74,0x6f,0x70,0x20,
-0x73,0x70,0x61,0x6e,0x2e,0x72,0x69,0x67,0x68,0x74,0x20,0x61,0x7b,0x0d,0x0a,0x09,
-0x66,0x6c,0x6f,0x61,0x74,0x3a,0x20,0x6c,0x65,0x66,0x74,0x3b,0x0d,0x0a,0x09,0x64,
-0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x0d,0x0a,
-0x7d,0x0d,0x0a,0x0d,0x0a,0x2f,0x2a,0x20,0x48,0x65,0x61,0x64,0x65,0x72,0x20,0x2a,
-0x2f,0x0d,0x0a,0x2e,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x77,0x72,0x61,0x70,
-0x20,0x7b,0x0d,0x0a,0x09,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x6c,0x65,0x66,
-0x74,0x3a,0x20,0x32,0x30,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x63,
-0x6f,0x64,0x72,0x6f,0x70,0x73,0x2d,0x68,0x65,0x61,0x64,0x65,0x72,0x20,0x7b,0x0d,
-0x0a,0x09,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x33,0x65,0x6d,0x20,0x32,
-0x65,0x6d,0x3b,0x0d,0x0a,0x09,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,0x6e,
-0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x63,
-0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x66,0x66,0x63,0x65,0x31,0x3b,0x0d,0x0a,
-0x7d,0x0d,0x0a,0x0d,0x0a,0x2e,0x63,0x6f,0x64,0x72,0x6f,0x70,0x73,0x2d,0x68,0x65,
-0x61,0x64,0x65,0x72,0x20,0x68,0x31,0x20,0x7b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,
-0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x38,0x30,0x30,0x3b,0x0d,0x0a,0x09,
-0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x33,0x2e,0x37,0x35,0x65,
-0x6d,0x3b,0x0d,0x0a,0x09,0x6c,0x69,0x6e,0x65,0x2d,0x68,0x65,0x69,0x67,0x68,0x74,
-0x3a,0x20,0x31,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x0d,0x0a,0x2e,0x63,0x6f,0x64,0x72,
-0x6f,0x70,0x73,0x2d,0x68,0x65,0x61,0x64,0x65,0x72,0x20,0x68,0x31,0x20,0x73,0x70,
-0x61,0x6e,0x20,0x7b,0x0d,0x0a,0x09,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,
-0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,
-0x7a,0x65,0x3a,0x20,0x35,0x30,0x25,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,
-0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x34,0x30,0x30,0x3b,0x0d,0x0a,0x09,0x70,
-0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x74,0x6f,0x70,0x3a,0x20,0x30,0x2e,0x33,0x32,
-0x35,0x65,0x6d,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x0d,0x0a,0x2e,0x63,0x6f,0x64,0x72,
-0x6f,0x70,0x73,0x2d,0x63,0x66,0x67,0x20,0x7b,0x0d,0x0a,0x09,0x70,0x61,0x64,0x64,
-0x69,0x6e,0x67,0x3a,0x20,0x30,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x20,0x30,0x70,
-0x78,0x20,0x31,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,
-0x69,0x7a,0x65,0x3a,0x20,0x31,0x65,0x6d,0x3b,0x0d,0x0a,0x09,0x74,0x65,0x78,0x74,
-0x2d,0x61,0x6c,0x69,0x67,0x6e,0x3a,0x20,0x6c,0x65,0x66,0x74,0x3b,0x0d,0x0a,0x09,
-0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x35,0x30,0x25,0x3b,0x20,0x0d,0x0a,0x09,0x6d,
-0x61,0x72,0x67,0x69,0x6e,0x3a,0x30,0x20,0x61,0x75,0x74,0x6f,0x3b,0x0d,0x0a,0x09,
-0x6d,0x69,0x6e,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x37,0x30,0x30,0x70,0x78,
-0x3b,0x0d,0x0a,0x09,0x6d,0x61,0x78,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x37,
-0x30,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x63,0x66,0x67,0x74,0x69,
-0x74,0x6c,0x65,0x20,0x7b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,
-0x69,0x6c,0x79,0x3a,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x0d,0x0a,0x09,0x63,
-0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x3b,0x0d,0x0a,
-0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x32,0x32,0x70,0x78,
-0x3b,0x0d,0x0a,0x09,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x62,0x6f,0x74,0x74,
-0x6f,0x6d,0x3a,0x20,0x31,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x63,
-0x66,0x67,0x63,0x62,0x20,0x7b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,
-0x6d,0x69,0x6c,0x79,0x3a,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x0d,0x0a,0x09,
-0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x66,0x66,0x66,0x66,0x66,0x3b,0x0d,
-0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x36,0x70,
-0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x73,0x6e,0x20,0x7b,0x0d,0x0a,0x09,0x20,
-0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x56,0x65,0x72,0x64,
-0x61,0x6e,0x61,0x3b,0x0d,0x0a,0x09,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,
-0x45,0x45,0x45,0x45,0x45,0x45,0x3b,0x0d,0x0a,0x09,0x20,0x66,0x6f,0x6e,0x74,0x2d,
-0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x38,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,
-0x3a,0x32,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x6c,0x61,0x62,0x65,
-0x6c,0x5f,0x77,0x68,0x65,0x65,0x6c,0x74,0x69,0x63,0x6b,0x20,0x7b,0x0d,0x0a,0x09,
-0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,
-0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x0d,0x0a,0x09,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,
-0x31,0x33,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,
-0x23,0x45,0x45,0x45,0x45,0x45,0x45,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,
-0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x38,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x35,0x70,0x78,0x20,0x30,0x20,
-0x30,0x20,0x30,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x6c,0x61,0x62,0x65,0x6c,0x5f,
-0x65,0x74,0x68,0x20,0x7b,0x0d,0x0a,0x09,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,
-0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x0d,0x0a,
-0x09,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x37,0x30,0x70,0x78,0x3b,0x0d,0x0a,
-0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x45,0x45,0x45,0x45,0x45,0x45,0x3b,
-0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x38,
-0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,
-0x3a,0x20,0x35,0x70,0x78,0x20,0x30,0x20,0x30,0x20,0x30,0x3b,0x0d,0x0a,0x7d,0x0d,
-0x0a,0x2e,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x6e,0x74,0x72,0x69,0x70,0x20,0x7b,0x0d,
-0x0a,0x09,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x69,0x6e,0x6c,0x69,0x6e,
-0x65,0x2d,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x0d,0x0a,0x09,0x77,0x69,0x64,0x74,0x68,
-0x3a,0x20,0x31,0x35,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,
-0x3a,0x20,0x23,0x45,0x45,0x45,0x45,0x45,0x45,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,
-0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x38,0x70,0x78,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x35,0x70,0x78,0x20,
-0x30,0x20,0x30,0x20,0x30,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x6c,0x61,0x62,0x65,
-0x6c,0x5f,0x75,0x73,0x65,0x72,0x20,0x7b,0x0d,0x0a,0x09,0x64,0x69,0x73,0x70,0x6c,
-0x61,0x79,0x3a,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x62,0x6c,0x6f,0x63,0x6b,
-0x3b,0x0d,0x0a,0x09,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x32,0x30,0x30,0x70,0x78,
-0x3b,0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x45,0x45,0x45,0x45,
-0x45,0x45,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,
-0x20,0x31,0x38,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x64,0x64,
-0x69,0x6e,0x67,0x3a,0x20,0x35,0x70,0x78,0x20,0x30,0x20,0x30,0x20,0x30,0x3b,0x0d,
-0x0a,0x7d,0x0d,0x0a,0x2e,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x64,0x65,0x76,0x69,0x63,
-0x65,0x20,0x7b,0x0d,0x0a,0x09,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x69,
-0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x0d,0x0a,0x09,0x77,
-0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x38,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x63,
-0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x45,0x45,0x45,0x45,0x45,0x45,0x3b,0x0d,0x0a,
-0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x38,0x70,0x78,
-0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,
-0x35,0x70,0x78,0x20,0x30,0x20,0x30,0x20,0x30,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,
-0x6d,0x65,0x6e,0x75,0x0d,0x0a,0x7b,0x0d,0x0a,0x09,0x77,0x69,0x64,0x74,0x68,0x3a,
-0x20,0x32,0x30,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x68,0x65,0x69,0x67,0x68,0x74,
-0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,
-0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x66,0x66,0x66,0x3b,0x0d,0x0a,0x09,0x62,0x6f,
-0x78,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,0x30,0x20,0x31,0x70,0x78,0x20,
-0x34,0x70,0x78,0x20,0x72,0x67,0x62,0x61,0x28,0x30,0x2c,0x20,0x30,0x2c,0x20,0x30,
-0x2c,0x20,0x30,0x2e,0x33,0x29,0x3b,0x0d,0x0a,0x09,0x70,0x6f,0x73,0x69,0x74,0x69,
-0x6f,0x6e,0x3a,0x66,0x69,0x78,0x65,0x64,0x3b,0x0d,0x0a,0x09,0x66,0x6c,0x6f,0x61,
-0x74,0x3a,0x20,0x6c,0x65,0x66,0x74,0x3b,0x0d,0x0a,0x7d,0x20,0x20,0x20,0x0d,0x0a,
-0x2e,0x6d,0x65,0x6e,0x75,0x5f,0x68,0x65,0x61,0x64,0x65,0x72,0x20,0x20,0x20,0x0d,
-0x0a,0x7b,0x20,0x20,0x20,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,
-0x65,0x3a,0x20,0x32,0x36,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,0x67,
-0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x34,0x42,0x34,0x46,0x35,0x35,0x3b,0x20,
-0x20,0x20,0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x74,0x74,
-0x6f,0x6d,0x3a,0x20,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x33,
-0x35,0x33,0x41,0x34,0x30,0x3b,0x0d,0x0a,0x7d,0x20,0x20,0x20,0x0d,0x0a,0x2e,0x6d,
-0x65,0x6e,0x75,0x5f,0x68,0x65,0x61,0x64,0x65,0x72,0x5f,0x74,0x69,0x74,0x6c,0x65,
-0x20,0x20,0x20,0x0d,0x0a,0x7b,0x20,0x20,0x20,0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,
-0x72,0x3a,0x20,0x23,0x66,0x66,0x66,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x09,0x70,0x61,
-0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x31,0x35,0x70,0x78,0x3b,0x20,0x20,0x20,0x0d,
-0x0a,0x09,0x74,0x65,0x78,0x74,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,0x30,
-0x20,0x31,0x70,0x78,0x20,0x30,0x20,0x72,0x67,0x62,0x61,0x28,0x30,0x2c,0x20,0x30,
-0x2c,0x20,0x30,0x2c,0x20,0x30,0x2e,0x34,0x29,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x7d,
-0x20,0x20,0x20,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0d,0x0a,0x2e,0x6d,
-0x65,0x6e,0x75,0x5f,0x62,0x6f,0x64,0x79,0x0d,0x0a,0x7b,0x0d,0x0a,0x09,0x6c,0x69,
-0x73,0x74,0x2d,0x73,0x74,0x79,0x6c,0x65,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x20,
-0x20,0x20,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,
-0x6d,0x20,0x20,0x20,0x0d,0x0a,0x7b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,
-0x69,0x7a,0x65,0x3a,0x20,0x31,0x36,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x70,0x6f,0x73,
-0x69,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x72,0x65,0x6c,0x61,0x74,0x69,0x76,0x65,0x3b,
-0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,
-0x6c,0x69,0x6e,0x6b,0x20,0x20,0x20,0x0d,0x0a,0x7b,0x20,0x20,0x20,0x0d,0x0a,0x09,
-0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x31,0x30,0x70,0x78,0x20,0x31,0x35,
-0x70,0x78,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x09,0x74,0x65,0x78,0x74,0x2d,0x64,0x65,
-0x63,0x6f,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x20,
-0x20,0x20,0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x36,0x42,0x36,
-0x46,0x37,0x30,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x09,0x64,0x69,0x73,0x70,0x6c,0x61,
-0x79,0x3a,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x09,0x62,
-0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x20,0x31,0x70,
-0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x46,0x30,0x46,0x30,0x46,0x30,0x3b,
-0x20,0x20,0x20,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,
-0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x3a,0x68,0x6f,0x76,0x65,0x72,0x0d,0x0a,0x7b,
-0x20,0x20,0x20,0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,
-0x3a,0x20,0x23,0x66,0x30,0x66,0x30,0x66,0x30,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x7d,
-0x20,0x20,0x20,0x0d,0x0a,0x2e,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,
-0x6c,0x69,0x6e,0x6b,0x2e,0x69,0x73,0x2d,0x61,0x63,0x74,0x69,0x76,0x65,0x20,0x20,
-0x20,0x0d,0x0a,0x7b,0x20,0x20,0x20,0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,
-0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x36,0x45,0x37,0x35,0x37,0x46,0x3b,0x20,0x20,
-0x20,0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x66,0x66,0x3b,
-0x20,0x20,0x20,0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x74,
-0x74,0x6f,0x6d,0x2d,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x34,0x42,0x34,0x46,
-0x35,0x35,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x09,0x62,0x6f,0x78,0x2d,0x73,0x68,0x61,
-0x64,0x6f,0x77,0x3a,0x20,0x30,0x20,0x31,0x70,0x78,0x20,0x30,0x20,0x23,0x37,0x41,
-0x38,0x32,0x38,0x44,0x20,0x69,0x6e,0x73,0x65,0x74,0x3b,0x20,0x20,0x20,0x0d,0x0a,
-0x7d,0x20,0x20,0x20,0x0d,0x0a,0x2e,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,
-0x5f,0x6c,0x69,0x6e,0x6b,0x2e,0x69,0x73,0x2d,0x61,0x63,0x74,0x69,0x76,0x65,0x3a,
-0x61,0x66,0x74,0x65,0x72,0x20,0x20,0x20,0x0d,0x0a,0x7b,0x20,0x20,0x20,0x0d,0x0a,
-0x09,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x3b,
-0x20,0x20,0x20,0x0d,0x0a,0x09,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x20,
-0x61,0x62,0x73,0x6f,0x6c,0x75,0x74,0x65,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x09,0x74,
-0x6f,0x70,0x3a,0x20,0x35,0x30,0x25,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x09,0x6d,0x61,
-0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x3a,0x20,0x2d,0x36,0x70,0x78,0x3b,0x20,
-0x20,0x20,0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x74,0x6f,0x70,0x3a,
-0x20,0x36,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x74,0x72,0x61,0x6e,0x73,
-0x70,0x61,0x72,0x65,0x6e,0x74,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x09,0x62,0x6f,0x72,
-0x64,0x65,0x72,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x20,0x36,0x70,0x78,0x20,
-0x73,0x6f,0x6c,0x69,0x64,0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,
-0x74,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x6c,
-0x65,0x66,0x74,0x3a,0x20,0x36,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,
-0x36,0x45,0x37,0x35,0x37,0x46,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x7d,0x20,0x20,0x20,
-0x0d,0x0a,0x2e,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x3a,0x6c,0x61,0x73,
-0x74,0x2d,0x63,0x68,0x69,0x6c,0x64,0x20,0x2e,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,
-0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x0d,0x0a,0x7b,0x20,0x20,0x20,0x0d,0x0a,0x09,
-0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x20,0x6e,
-0x6f,0x6e,0x65,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x7d,0x0d,0x0a,0x0d,0x0a,0x23,0x73,
-0x61,0x76,0x65,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x7b,0x20,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x3a,0x33,0x32,0x70,
-0x78,0x3b,0x20,0x0d,0x0a,0x20,0x20,0x20,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,
-0x34,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x23,0x73,0x61,0x76,0x65,0x5f,
-0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x2e,0x62,0x75,0x74,0x74,0x6f,0x6e,0x0d,0x0a,
-0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x74,0x2d,0x64,0x65,0x63,0x6f,
-0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x0d,0x0a,0x09,0x62,
-0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x23,0x32,0x66,0x34,0x33,0x35,
-0x65,0x3b,0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x32,0x66,0x32,
-0x66,0x32,0x3b,0x0d,0x0a,0x09,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x31,
-0x30,0x70,0x78,0x20,0x30,0x70,0x78,0x20,0x31,0x30,0x70,0x78,0x20,0x30,0x70,0x78,
-0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x30,
-0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,
-0x3a,0x31,0x36,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,
-0x6d,0x69,0x6c,0x79,0x3a,0x20,0x27,0x52,0x61,0x6c,0x65,0x77,0x61,0x79,0x27,0x2c,
-0x43,0x61,0x6d,0x62,0x72,0x69,0x61,0x2c,0x20,0x41,0x72,0x69,0x61,0x6c,0x2c,0x20,
-0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,0x66,0x3b,0x0d,0x0a,0x09,0x66,0x6f,
-0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x62,0x6f,0x6c,0x64,0x3b,0x0d,
-0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,
-0x33,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x6e,
-0x6f,0x6e,0x65,0x3b,0x0d,0x0a,0x09,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,0x74,
-0x72,0x61,0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x6c,0x6c,0x20,0x6c,0x69,
-0x6e,0x65,0x61,0x72,0x20,0x30,0x2e,0x33,0x30,0x73,0x3b,0x0d,0x0a,0x09,0x2d,0x6d,
-0x6f,0x7a,0x2d,0x74,0x72,0x61,0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x6c,
-0x6c,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x20,0x30,0x2e,0x33,0x30,0x73,0x3b,0x0d,
-0x0a,0x09,0x74,0x72,0x61,0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x6c,0x6c,
-0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x20,0x30,0x2e,0x33,0x30,0x73,0x3b,0x0d,0x0a,
-0x7d,0x0d,0x0a,0x23,0x73,0x61,0x76,0x65,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,
-0x2e,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3a,0x68,0x6f,0x76,0x65,0x72,0x20,0x7b,0x0d,
-0x0a,0x20,0x20,0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x23,
-0x33,0x38,0x35,0x66,0x39,0x65,0x3b,0x20,0x0d,0x0a,0x7d,0x0d,0x0a,0x23,0x73,0x61,
-0x76,0x65,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x2e,0x62,0x75,0x74,0x74,0x6f,
-0x6e,0x5f,0x72,0x69,0x67,0x68,0x74,0x0d,0x0a,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x74,0x65,0x78,0x74,0x2d,0x64,0x65,0x63,0x6f,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,
-0x6e,0x6f,0x6e,0x65,0x3b,0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,
-0x6e,0x64,0x3a,0x23,0x32,0x66,0x34,0x33,0x35,0x65,0x3b,0x0d,0x0a,0x09,0x63,0x6f,
-0x6c,0x6f,0x72,0x3a,0x23,0x66,0x32,0x66,0x32,0x66,0x32,0x3b,0x0d,0x0a,0x09,0x70,
-0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x31,0x30,0x70,0x78,0x20,0x30,0x70,0x78,
-0x20,0x31,0x30,0x70,0x78,0x20,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x30,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,
-0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x36,0x70,0x78,0x3b,0x0d,
-0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x27,
-0x52,0x61,0x6c,0x65,0x77,0x61,0x79,0x27,0x2c,0x43,0x61,0x6d,0x62,0x72,0x69,0x61,
-0x2c,0x20,0x41,0x72,0x69,0x61,0x6c,0x2c,0x20,0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,
-0x72,0x69,0x66,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,
-0x68,0x74,0x3a,0x62,0x6f,0x6c,0x64,0x3b,0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,
-0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x33,0x70,0x78,0x3b,0x0d,0x0a,0x09,
-0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x20,
-0x38,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,
-0x74,0x72,0x61,0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x6c,0x6c,0x20,0x6c,
-0x69,0x6e,0x65,0x61,0x72,0x20,0x30,0x2e,0x33,0x30,0x73,0x3b,0x0d,0x0a,0x09,0x2d,
-0x6d,0x6f,0x7a,0x2d,0x74,0x72,0x61,0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,
-0x6c,0x6c,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x20,0x30,0x2e,0x33,0x30,0x73,0x3b,
-0x0d,0x0a,0x09,0x74,0x72,0x61,0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x6c,
-0x6c,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x20,0x30,0x2e,0x33,0x30,0x73,0x3b,0x0d,
-0x0a,0x7d,0x0d,0x0a,0x23,0x73,0x61,0x76,0x65,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,
-0x20,0x2e,0x62,0x75,0x74,0x74,0x6f,0x6e,0x5f,0x72,0x69,0x67,0x68,0x74,0x3a,0x68,
-0x6f,0x76,0x65,0x72,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x62,0x61,0x63,0x6b,0x67,
-0x72,0x6f,0x75,0x6e,0x64,0x3a,0x23,0x33,0x38,0x35,0x66,0x39,0x65,0x3b,0x20,0x0d,
-0x0a,0x7d,0x0d,0x0a,0x0d,0x0a,0x40,0x6d,0x65,0x64,0x69,0x61,0x20,0x73,0x63,0x72,
-0x65,0x65,0x6e,0x20,0x61,0x6e,0x64,0x20,0x28,0x6d,0x61,0x78,0x2d,0x77,0x69,0x64,
-0x74,0x68,0x3a,0x20,0x35,0x30,0x65,0x6d,0x29,0x20,0x7b,0x0d,0x0a,0x09,0x62,0x6f,
-0x64,0x79,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,
-0x65,0x3a,0x20,0x35,0x35,0x25,0x3b,0x0d,0x0a,0x09,0x7d,0x0d,0x0a,0x09,0x2e,0x63,
-0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x20,0x3e,0x20,0x68,0x65,0x61,0x64,0x65,
-0x72,0x20,0x68,0x31,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x73,0x69,0x7a,0x65,0x3a,
-0x20,0x31,0x36,0x35,0x70,0x78,0x20,0x31,0x30,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x6c,
-0x65,0x66,0x74,0x3a,0x20,0x31,0x38,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x7d,0x0d,
-0x0a,0x09,0x2e,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x77,0x72,0x61,0x70,0x20,
-0x7b,0x0d,0x0a,0x09,0x09,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x6c,0x65,0x66,
-0x74,0x3a,0x20,0x31,0x34,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x7d,0x0d,0x0a,0x09,
-0x2e,0x6d,0x65,0x6e,0x75,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x77,0x69,0x64,0x74,0x68,
-0x3a,0x20,0x31,0x34,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x7d,0x0d,0x0a,0x09,0x2e,
-0x6d,0x65,0x6e,0x75,0x5f,0x68,0x65,0x61,0x64,0x65,0x72,0x20,0x7b,0x0d,0x0a,0x09,
-0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x32,0x32,0x70,0x78,
-0x3b,0x0d,0x0a,0x09,0x7d,0x0d,0x0a,0x09,0x2e,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,
-0x65,0x6d,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,
-0x65,0x3a,0x20,0x31,0x34,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x7d,0x0d,0x0a,0x09,0x2e,
-0x6c,0x61,0x62,0x65,0x6c,0x5f,0x77,0x68,0x65,0x65,0x6c,0x74,0x69,0x63,0x6b,0x20,
-0x7b,0x0d,0x0a,0x09,0x09,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x33,0x30,0x70,
-0x78,0x3b,0x0d,0x0a,0x09,0x7d,0x0d,0x0a,0x09,0x2e,0x6c,0x61,0x62,0x65,0x6c,0x5f,
-0x65,0x74,0x68,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,
-0x31,0x36,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x7d,0x0d,0x0a,0x09,0x2e,0x6c,0x61,
-0x62,0x65,0x6c,0x5f,0x6e,0x74,0x72,0x69,0x70,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x77,
-0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x33,0x35,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x7d,
-0x0d,0x0a,0x09,0x2e,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x75,0x73,0x65,0x72,0x20,0x7b,
-0x0d,0x0a,0x09,0x09,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x39,0x30,0x70,0x78,
-0x3b,0x0d,0x0a,0x09,0x7d,0x0d,0x0a,0x7d,};
+0x78,0x74,0x2f,0x63,0x73,0x73,0x0d,0x0a,
+/* "Cache-Control: max-age=86400
+" (30 bytes) */
+0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x3a,0x20,0x6d,
+0x61,0x78,0x2d,0x61,0x67,0x65,0x3d,0x38,0x36,0x34,0x30,0x30,0x0d,0x0a,
+/* "ETag: "20c26e4e"
+" (18 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x32,0x30,0x63,0x32,0x36,0x65,0x34,0x65,0x22,
+0x0d,0x0a,
+/* "Content-Encoding: gzip
+" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x45,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,
+0x3a,0x20,0x67,0x7a,0x69,0x70,0x0d,0x0a,
+/* "Vary: Accept-Encoding
+" (23 bytes) */
+0x56,0x61,0x72,0x79,0x3a,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2d,0x45,0x6e,0x63,
+0x6f,0x64,0x69,0x6e,0x67,0x0d,0x0a,
+/* "Content-Length: 1884
+
+" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x31,0x38,0x38,0x34,0x0d,0x0a,0x0d,0x0a,
+/* gzip file data (1884 bytes) */
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xe5,0x18,0x5b,0x6f,0xa3,0xb8,
+0xfa,0xb9,0x95,0xfa,0x1f,0x2c,0x55,0xab,0x9d,0xae,0x9c,0x94,0x24,0x90,0xb4,0x44,
+0x7b,0x99,0x99,0xdd,0x9e,0xf3,0x7c,0x46,0x3a,0xaf,0x95,0x83,0x4d,0xb0,0x6a,0x30,
+0x0b,0x4e,0x2f,0x13,0xcd,0x7f,0x5f,0xdf,0x30,0x36,0x90,0xb6,0x5a,0x8d,0xb4,0x0f,
+0x0b,0x25,0x4d,0xcc,0xe7,0xef,0x7e,0xf5,0x6f,0xb4,0xac,0x79,0x23,0xc0,0xa1,0x61,
+0x1f,0x0a,0x21,0xea,0xf4,0xfa,0x3a,0xe7,0x95,0x68,0xe7,0x7b,0xce,0xf7,0x8c,0xa0,
+0x9a,0xb6,0xf3,0x8c,0x97,0xd7,0x59,0xdb,0xfe,0x9a,0xa3,0x92,0xb2,0x97,0x9f,0xff,
+0x87,0x18,0x79,0x42,0x2f,0xe9,0x32,0x8a,0x60,0x2c,0x9f,0x8d,0x7c,0x6e,0xa2,0xe8,
+0x6a,0x7b,0x71,0x7e,0x71,0x7e,0xfd,0x13,0xf8,0xfc,0xe5,0x0b,0x68,0x48,0x4b,0x04,
+0xf8,0xe9,0xfa,0xe2,0x7c,0xc7,0xf1,0x0b,0xc4,0xf4,0x11,0x62,0x06,0xb1,0x80,0x18,
+0xc3,0x03,0x83,0x9c,0x41,0x46,0x61,0xb1,0x80,0xc5,0x12,0x16,0x2b,0x58,0xc4,0xb0,
+0x48,0x60,0xb1,0x86,0x75,0x43,0x60,0xce,0x9b,0x12,0xe6,0x94,0x30,0x2c,0x51,0x40,
+0x5a,0xd5,0x07,0x01,0x05,0x79,0x16,0xa8,0x21,0x08,0xd6,0x70,0xc7,0x78,0xf6,0xf0,
+0xe7,0x81,0x0b,0x02,0x45,0x01,0x05,0x06,0x47,0x70,0x71,0x7e,0x56,0xa2,0x66,0x4f,
+0xab,0x34,0x92,0x3c,0x9c,0xd5,0x08,0x63,0x5a,0xed,0xf5,0x8f,0x6f,0x17,0xe7,0x85,
+0x28,0x19,0x54,0x5c,0x80,0xe3,0x2b,0x80,0x67,0x05,0xa1,0xfb,0x42,0xa4,0x60,0x11,
+0x45,0x3f,0x98,0x8d,0x02,0xed,0x18,0xd1,0x9b,0x76,0xbc,0xc1,0xa4,0x99,0x65,0x9c,
+0x31,0x54,0xb7,0x24,0xed,0xbe,0x6c,0xfb,0x77,0x6d,0x8d,0x32,0x8f,0x68,0xcf,0x7f,
+0xb9,0x37,0x1c,0x1a,0xb8,0xee,0xbd,0xa4,0x2c,0x55,0xd4,0xc2,0x0c,0xd5,0x82,0xf2,
+0x0a,0x66,0x54,0xca,0x93,0x71,0x4c,0x20,0xce,0x2b,0x25,0xd8,0x23,0x6a,0x34,0x69,
+0x65,0x8c,0x59,0x2b,0x5e,0x18,0x49,0x2b,0xa9,0x18,0xc4,0xb6,0xdd,0xe2,0x93,0x61,
+0xd8,0xad,0x4a,0xac,0x52,0xad,0x07,0xa6,0xb7,0x31,0xda,0xf6,0xdb,0x2a,0x62,0x5e,
+0x77,0xc4,0x44,0xa1,0x61,0x94,0x52,0x67,0x88,0xd1,0x7d,0x95,0x32,0x92,0x0b,0xab,
+0xad,0xa1,0x4d,0x3c,0x2e,0xe8,0x57,0x92,0x5a,0xf5,0x9c,0x64,0x41,0x8a,0xb6,0xdb,
+0x35,0x10,0x65,0x0d,0xaf,0x5e,0x4a,0x29,0xfa,0x40,0xee,0x46,0xd0,0x8c,0x11,0x08,
+0x50,0x4b,0xa5,0xb0,0x00,0x13,0x81,0x28,0x6b,0x21,0xc8,0xe9,0xbe,0x63,0x4f,0x7d,
+0x3f,0x48,0x47,0x90,0x5a,0xe4,0xd2,0xcc,0x0d,0x04,0x05,0x41,0x58,0xff,0xdf,0x37,
+0xfc,0x50,0x43,0x50,0x92,0xea,0x00,0x41,0x85,0x1e,0x21,0x68,0x49,0xa6,0x36,0x69,
+0x2e,0x31,0x6d,0x6b,0x26,0x1d,0x13,0x68,0x1f,0x31,0x04,0xa5,0x3f,0xfe,0x87,0x54,
+0xa4,0x41,0x0c,0x68,0x1f,0xf8,0xa2,0x74,0xe2,0x1c,0xd3,0xc9,0x66,0x5c,0x3b,0x05,
+0x3f,0x5a,0xe7,0xfe,0x11,0x7e,0x46,0xe5,0xae,0xa1,0x08,0x82,0x8f,0xf2,0x93,0x49,
+0x42,0xa8,0x6a,0x67,0x2d,0x69,0x68,0xae,0xad,0x8e,0xb2,0x07,0xc5,0x4c,0x85,0x53,
+0x70,0xb9,0xda,0xac,0x50,0xbc,0x19,0x6a,0x05,0xc8,0xd8,0xd8,0x06,0xba,0x03,0x8b,
+0xa4,0x7e,0x56,0x4b,0xd2,0x7f,0x78,0x23,0x37,0x2e,0xf0,0x2a,0x8b,0x17,0x6a,0x85,
+0x3f,0x92,0x26,0x67,0xfc,0x69,0x26,0x79,0x68,0xa5,0xee,0x98,0x55,0x27,0xd2,0x82,
+0x75,0xf0,0x31,0x89,0x51,0xbc,0xde,0x76,0xb6,0xc3,0x24,0xe3,0x0d,0x52,0xe2,0xa7,
+0xc0,0x5a,0xf9,0x8c,0x1f,0x04,0xa3,0x15,0x71,0x0b,0x0a,0x47,0x5a,0x28,0xf4,0x52,
+0xe7,0x69,0xce,0xb3,0x43,0x1b,0xa0,0xcc,0x6e,0x63,0x92,0x44,0x27,0x76,0xee,0x0e,
+0x42,0x48,0xe4,0xfd,0xae,0x09,0x18,0xdf,0x00,0x5d,0x40,0x81,0x05,0x29,0xb7,0xa1,
+0x87,0x81,0x8c,0x54,0xd2,0x96,0x66,0x8f,0xcc,0x28,0x95,0xb4,0xbb,0x34,0x8b,0xda,
+0xf5,0x44,0xb1,0x28,0x5c,0xe0,0x0d,0x03,0xf1,0xac,0xe6,0x2d,0xd5,0x32,0xa2,0x5d,
+0xcb,0xd9,0x41,0x90,0x0e,0x07,0xd3,0xbb,0xa5,0x37,0x21,0x29,0xc8,0x8e,0x8b,0x62,
+0x88,0x1c,0xfc,0x62,0x3d,0x27,0xe0,0x6d,0x19,0xd5,0xcf,0x40,0x3d,0x0b,0xfb,0x65,
+0xdb,0xa7,0x05,0x30,0xf5,0x4e,0x4b,0xd1,0x16,0x08,0xf3,0x27,0xc9,0x95,0x7a,0x69,
+0x9f,0x66,0xbf,0x43,0x1f,0x22,0xa8,0xef,0xf9,0x52,0xe5,0x3f,0x20,0xaf,0xb7,0x85,
+0x76,0x7c,0x81,0x62,0x11,0x46,0x17,0x58,0xcd,0x37,0x89,0xd1,0x9d,0xd2,0xf3,0xcc,
+0xd3,0x85,0xc7,0xcb,0x10,0x79,0x67,0x4c,0xcd,0xcf,0x32,0x49,0x60,0xf7,0x44,0xf3,
+0xdb,0xab,0xf7,0x4b,0xb0,0xe8,0x24,0x70,0xaa,0xea,0xb4,0x91,0x38,0x65,0xa8,0xd7,
+0xbd,0xef,0xcf,0x68,0x89,0xf6,0x92,0x6b,0x55,0x3c,0xe6,0xf3,0x6b,0xfd,0xab,0xbd,
+0x46,0x19,0xa1,0x55,0x85,0xe6,0x75,0xb5,0xbf,0x1a,0x6f,0x69,0x48,0x4d,0x90,0x50,
+0x1e,0x64,0xbf,0x8e,0x41,0x9c,0xc5,0x81,0xca,0x4b,0xbd,0x9c,0x03,0x30,0x1b,0x53,
+0x37,0xc6,0x5e,0x89,0xe3,0xaf,0x4b,0x03,0xb4,0xd2,0x3a,0xec,0x92,0x81,0x27,0xd9,
+0x4c,0xe1,0x55,0xf5,0x4b,0xef,0x39,0x69,0x1b,0x20,0x93,0x7a,0xe5,0x07,0xcb,0x26,
+0xdb,0x65,0x78,0x3d,0xd2,0x68,0x34,0xd4,0x68,0x68,0x83,0x9b,0x2b,0x97,0x8a,0xfe,
+0x6b,0x50,0xf7,0x49,0x48,0x12,0xc6,0x0d,0xaf,0xdb,0x99,0xe0,0xf5,0xd1,0xf0,0x18,
+0xe4,0x23,0x9b,0x85,0x46,0x0e,0xb1,0x8c,0x8d,0x3f,0xf8,0xc9,0x65,0x61,0x96,0xfc,
+0xd4,0xe4,0xb8,0x01,0xfd,0x47,0x34,0x4f,0x7a,0xa7,0x10,0x8d,0x4c,0x6b,0xaa,0xe2,
+0x4a,0x23,0xd6,0x35,0x69,0x32,0x64,0xaa,0xda,0xd7,0x19,0xad,0x30,0x79,0x4e,0xc1,
+0xad,0xbc,0x82,0x28,0x94,0xa5,0x9d,0xc9,0x9c,0xf3,0x68,0x8b,0xdf,0x73,0xe0,0x57,
+0x4a,0x13,0xcb,0xc9,0xc8,0xf8,0x16,0xca,0x0a,0x50,0x10,0x93,0x5d,0xc8,0x69,0x39,
+0x89,0x10,0x5e,0x41,0x05,0x0b,0x67,0xd8,0xde,0xcd,0x43,0x99,0xae,0x5e,0xb5,0xc8,
+0xe5,0x67,0x7d,0x6d,0xa7,0x0a,0xc4,0x99,0xcc,0xb9,0xca,0x19,0xfb,0xfa,0x17,0x32,
+0x69,0x32,0xe7,0x71,0xac,0xd5,0x31,0x03,0x03,0x06,0x23,0xa9,0x68,0xf9,0x37,0x25,
+0xba,0xf2,0xaa,0x79,0xa3,0xec,0x78,0xec,0x39,0xd0,0xbf,0x5f,0x05,0x36,0x2a,0x0b,
+0x19,0x9e,0x2c,0x79,0xbe,0xa7,0x59,0x1f,0x93,0x01,0xa4,0x0a,0x53,0x83,0x6a,0x3f,
+0x4f,0x9b,0x30,0x00,0x61,0x1c,0x18,0xd2,0x36,0x06,0x02,0x23,0xad,0x48,0x09,0x96,
+0xaf,0x24,0x76,0x4f,0x03,0x97,0x79,0x9e,0x67,0x64,0xd1,0xf1,0x33,0x44,0x2b,0x43,
+0xeb,0x38,0xac,0x96,0x37,0xa3,0x6a,0x79,0x2a,0x17,0xbe,0x82,0x55,0x69,0x6b,0xba,
+0x15,0xf0,0x11,0x27,0xe3,0x16,0xa6,0x2b,0xd6,0x9d,0x66,0xa4,0xea,0xa5,0x17,0xcd,
+0x57,0x4b,0xc3,0x41,0x48,0x2f,0xcb,0xf7,0x60,0xd2,0x7d,0x03,0x3f,0xf6,0x43,0x73,
+0xac,0xb5,0xce,0x80,0xb6,0xf8,0x29,0x96,0xfc,0x3e,0x16,0xa0,0x83,0xe0,0xba,0x30,
+0xd1,0x6a,0x66,0x61,0x36,0x91,0x2b,0x56,0xcf,0xc3,0x35,0x6d,0xbb,0x7c,0x2f,0xa8,
+0xb0,0x2d,0xab,0x9f,0x45,0xfe,0x4f,0x1a,0x8c,0x2a,0xe4,0x77,0x1e,0x77,0xfa,0x1a,
+0xb0,0xb9,0x5c,0x1a,0xfc,0x9d,0x12,0x64,0x4d,0x15,0xbc,0x4c,0x3b,0x89,0x2c,0x8d,
+0x6c,0xf7,0x1e,0x02,0xb9,0xbe,0x86,0x7a,0x58,0x3b,0x44,0xad,0xb1,0x13,0x38,0x81,
+0xc6,0x39,0xd2,0x1f,0xfa,0xda,0x3a,0xd0,0x2e,0xe9,0xbb,0xa4,0x00,0x06,0xdc,0x2e,
+0x7b,0x66,0x19,0xda,0x11,0x76,0xff,0x54,0x10,0xc2,0x64,0xd7,0xf9,0x10,0x3a,0xc6,
+0xa0,0x3a,0xb8,0x2e,0x64,0x15,0x85,0x3d,0x5a,0xcf,0xc0,0x34,0x7d,0xe7,0x04,0xba,
+0x48,0xaa,0x3b,0xa0,0x4e,0x6c,0xb3,0xfd,0x26,0xdd,0xcd,0xf7,0xa5,0x5b,0x89,0x86,
+0xd6,0xef,0xa3,0x9c,0x7c,0x5f,0xca,0x87,0xd6,0x26,0x8e,0xb7,0x08,0x77,0x79,0xe7,
+0x7b,0x11,0xc6,0xe4,0x91,0x66,0xe4,0x7d,0x32,0xdf,0x7c,0x2f,0xd2,0x6a,0x14,0xb9,
+0x38,0x3f,0x4e,0x48,0x35,0xec,0x63,0x83,0x91,0xc1,0xc6,0x86,0x5f,0x3f,0x23,0x5d,
+0xad,0xe2,0xbe,0x7a,0x02,0xfb,0x37,0x5f,0x5d,0x05,0x15,0x38,0xa7,0xcf,0x04,0x4f,
+0x14,0x2f,0xc9,0xa6,0x65,0xe8,0xde,0x66,0x44,0xb5,0x70,0xd4,0x9f,0x41,0x98,0xaf,
+0xc7,0x8d,0xc2,0x65,0xfc,0x29,0xbe,0x4b,0x92,0xad,0x01,0xb6,0x33,0xad,0x8b,0x7f,
+0xc9,0x93,0x6c,0xbd,0x29,0x96,0xa3,0x4e,0xb2,0xfa,0x18,0x47,0x93,0xd4,0xee,0x4d,
+0xf2,0xf1,0x68,0x7a,0xb9,0xc0,0x22,0xee,0x07,0x04,0xd5,0xae,0x99,0xb5,0xb0,0x70,
+0x9b,0x36,0x62,0xa4,0x82,0xf8,0xca,0x40,0x1b,0xb2,0xc0,0x5c,0x1d,0x7d,0x35,0xc9,
+0x19,0x1b,0x78,0x63,0xaf,0x19,0x51,0xcc,0xa6,0x0e,0x50,0x0e,0xd9,0xa5,0x61,0x70,
+0x32,0x2f,0x4d,0x37,0x39,0xc1,0xee,0x7b,0xe9,0x4e,0x0f,0xbe,0x8c,0xbd,0x44,0x3a,
+0xf7,0x0f,0xc4,0x1a,0x4d,0x68,0xa1,0x62,0xd6,0x9f,0xd6,0x77,0x9b,0xc8,0x2e,0x0e,
+0x4a,0xd6,0x5b,0x96,0xb8,0x8b,0xd4,0x3d,0x21,0xa0,0x66,0xd1,0x34,0x2e,0x8e,0xcb,
+0xd0,0xf7,0x22,0x75,0xfb,0xfa,0x1c,0x6c,0x9e,0xd3,0x76,0x86,0x32,0x25,0xbe,0x2f,
+0x69,0x80,0x63,0xfd,0xc7,0x26,0xd9,0xdc,0x6d,0x4f,0xd9,0x39,0x60,0x7b,0xe6,0xc6,
+0xd7,0xd0,0xc7,0x9e,0x47,0x56,0xbf,0xdc,0x7c,0xbc,0x59,0xde,0xfc,0x2e,0xa3,0xb6,
+0x25,0xe2,0x5d,0x0c,0xa6,0x28,0x17,0xa1,0xa3,0x4f,0xaa,0xb1,0x37,0xac,0x1b,0x22,
+0xad,0x95,0x54,0x9d,0xd7,0xc5,0x17,0xf4,0xe5,0xd7,0x54,0xff,0xd9,0xda,0xd9,0xd2,
+0x8a,0xa3,0x97,0xd7,0xce,0x04,0xba,0x77,0xae,0x51,0x23,0xfb,0x9f,0x69,0x6b,0xbd,
+0x03,0xd4,0x74,0x60,0x3d,0x60,0xa0,0xd8,0xa1,0xec,0x29,0x43,0xd2,0xbd,0xb3,0x82,
+0x32,0x0c,0x06,0x1a,0xe9,0xad,0x14,0xb2,0x10,0x04,0xc1,0xc5,0xf9,0x65,0x8b,0x1e,
+0xc9,0xbd,0x19,0xeb,0x8f,0x36,0x90,0x3c,0x99,0x57,0xaa,0x01,0xb0,0xcb,0x36,0x7d,
+0xc5,0xae,0x9c,0xfa,0x7b,0xc1,0xdc,0xfc,0xd7,0x91,0xe4,0x86,0x5e,0xcf,0xdb,0xbb,
+0xe3,0x08,0xcf,0x69,0x2e,0x97,0x79,0xbc,0x4a,0x48,0x9f,0x75,0x2f,0xf3,0xa5,0xba,
+0xb7,0xa3,0x28,0x1a,0x0c,0xe0,0x0a,0x7f,0x7f,0x46,0x30,0x6c,0xae,0xba,0xd8,0xfd,
+0x5b,0xc7,0x38,0x7e,0x0b,0xb8,0xe3,0x0c,0x7b,0x07,0x7a,0x0d,0xc2,0xf4,0xd0,0xa6,
+0x2b,0x9b,0x2b,0xcd,0x29,0x96,0x3b,0x66,0x91,0x9b,0x76,0x0f,0xd4,0xce,0x4f,0xf6,
+0x78,0x82,0x31,0xa0,0x8a,0x0d,0x6a,0x54,0xca,0x8e,0x5a,0x0d,0x56,0xf2,0xaf,0x6f,
+0xc1,0xbc,0xfe,0xfa,0x84,0xe2,0x4d,0x7c,0x03,0xa3,0x7d,0x5f,0xc9,0xab,0x9b,0x24,
+0xbf,0x25,0x5b,0x70,0x72,0xe7,0xbd,0x1e,0x26,0xfe,0xad,0x86,0xf3,0x1c,0xde,0x84,
+0x5e,0xd7,0x08,0xfc,0xd3,0x06,0x35,0x66,0x79,0x9f,0x59,0x2f,0xce,0x7f,0x2b,0x09,
+0xa6,0x48,0x9d,0x14,0x12,0x52,0x01,0x54,0x61,0xf0,0xc1,0x1b,0x0a,0x92,0x88,0x94,
+0x57,0xf6,0xe0,0xda,0x1e,0x7b,0x07,0xe3,0x4f,0xa2,0xfb,0x11,0x89,0xe8,0xec,0xc4,
+0xb9,0xc7,0xd1,0x95,0xd8,0x89,0xf3,0x96,0x75,0xa2,0xad,0xdc,0x9b,0x78,0x74,0xb0,
+0xd2,0xb7,0x57,0x8e,0x46,0x30,0x7e,0x0e,0xe6,0xcf,0x45,0xec,0x43,0xab,0xbc,0x66,
+0xa0,0x3a,0xd7,0x19,0xbd,0xbe,0xf7,0xa6,0xd3,0xa9,0xf9,0xa5,0x07,0xd4,0x05,0x7f,
+0x08,0xb6,0x88,0x3d,0xb0,0xa9,0x19,0x61,0x34,0x0b,0x78,0x90,0x5d,0x3f,0xef,0x60,
+0xd6,0x63,0x98,0xbe,0xf7,0xee,0x31,0x25,0x23,0x28,0xd7,0x27,0x3b,0xa0,0xdb,0x1e,
+0xd5,0xb7,0xbf,0x00,0xff,0xad,0xd3,0xc7,0x98,0x19,0x00,0x00,};
 
 static const unsigned int dummy_align__images_aceinna_png = 1;
 static const unsigned char data__images_aceinna_png[] = {
@@ -451,21 +181,33 @@ static const unsigned char data__images_aceinna_png[] = {
 0x70,0x6e,0x67,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
+/* "HTTP/1.0 200 OK
 " (17 bytes) */
 0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
-/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
+/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
 " (63 bytes) */
 0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
 0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
 0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
 0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-/* "Content-type: image/png
-
-" (27 bytes) */
+/* "Content-type: image/png
+" (25 bytes) */
 0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x69,0x6d,
-0x61,0x67,0x65,0x2f,0x70,0x6e,0x67,0x0d,0x0a,0x0d,0x0a,
+0x61,0x67,0x65,0x2f,0x70,0x6e,0x67,0x0d,0x0a,
+/* "Cache-Control: max-age=86400
+" (30 bytes) */
+0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x3a,0x20,0x6d,
+0x61,0x78,0x2d,0x61,0x67,0x65,0x3d,0x38,0x36,0x34,0x30,0x30,0x0d,0x0a,
+/* "ETag: "1e1b29f8"
+" (18 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x31,0x65,0x31,0x62,0x32,0x39,0x66,0x38,0x22,
+0x0d,0x0a,
+/* "Content-Length: 11657
+
+" (25 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x31,0x31,0x36,0x35,0x37,0x0d,0x0a,0x0d,0x0a,
 /* raw file data (11657 bytes) */
 0x89,0x50,0x4e,0x47,0x0d,0x0a,0x1a,0x0a,0x00,0x00,0x00,0x0d,0x49,0x48,0x44,0x52,
 0x00,0x00,0x01,0x4a,0x00,0x00,0x00,0xc8,0x08,0x06,0x00,0x00,0x00,0x8e,0x26,0xa8,
@@ -1204,28 +946,31 @@ static const unsigned char data__DeviceInfo_shtml[] = {
 0x6c,0x00,0x00,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
+/* "HTTP/1.0 200 OK
 " (17 bytes) */
 0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
-/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
+/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
 " (63 bytes) */
 0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
 0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
 0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
 0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-/* "Content-type: text/html
-Expires: Fri, 10 Apr 2008 14:00:00 GMT
-Pragma: no-cache
-
-" (85 bytes) */
+/* "Content-type: text/html
+" (25 bytes) */
 0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
-0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,0x45,0x78,0x70,0x69,0x72,0x65,0x73,
-0x3a,0x20,0x46,0x72,0x69,0x2c,0x20,0x31,0x30,0x20,0x41,0x70,0x72,0x20,0x32,0x30,
-0x30,0x38,0x20,0x31,0x34,0x3a,0x30,0x30,0x3a,0x30,0x30,0x20,0x47,0x4d,0x54,0x0d,
-0x0a,0x50,0x72,0x61,0x67,0x6d,0x61,0x3a,0x20,0x6e,0x6f,0x2d,0x63,0x61,0x63,0x68,
-0x65,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (1918 bytes) */
+0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,
+/* "Expires: Fri, 10 Apr 2008 14:00:00 GMT
+" (40 bytes) */
+0x45,0x78,0x70,0x69,0x72,0x65,0x73,0x3a,0x20,0x46,0x72,0x69,0x2c,0x20,0x31,0x30,
+0x20,0x41,0x70,0x72,0x20,0x32,0x30,0x30,0x38,0x20,0x31,0x34,0x3a,0x30,0x30,0x3a,
+0x30,0x30,0x20,0x47,0x4d,0x54,0x0d,0x0a,
+/* "Pragma: no-cache
+
+" (20 bytes) */
+0x50,0x72,0x61,0x67,0x6d,0x61,0x3a,0x20,0x6e,0x6f,0x2d,0x63,0x61,0x63,0x68,0x65,
+0x0d,0x0a,0x0d,0x0a,
+/* raw file data (3257 bytes) */
 0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0a,
 0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0a,0x09,0x3c,0x68,0x65,0x61,0x64,0x3e,0x0a,0x09,
 0x09,0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3d,0x22,
@@ -1235,117 +980,201 @@ Pragma: no-cache
 0x73,0x74,0x79,0x6c,0x65,0x73,0x68,0x65,0x65,0x74,0x22,0x20,0x74,0x79,0x70,0x65,
 0x3d,0x22,0x74,0x65,0x78,0x74,0x2f,0x63,0x73,0x73,0x22,0x20,0x68,0x72,0x65,0x66,
 0x3d,0x22,0x63,0x73,0x73,0x2f,0x73,0x74,0x79,0x6c,0x65,0x2e,0x63,0x73,0x73,0x22,
-0x20,0x2f,0x3e,0x0a,0x09,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x0a,0x09,0x3c,0x62,
-0x6f,0x64,0x79,0x3e,0x0a,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x22,0x3e,0x0a,0x09,
-0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,
-0x6e,0x75,0x22,0x3e,0x20,0x20,0x0a,0x09,0x09,0x09,0x09,0x3c,0x68,0x65,0x61,0x64,
-0x65,0x72,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x68,
-0x65,0x61,0x64,0x65,0x72,0x22,0x3e,0x20,0x20,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,
-0x68,0x31,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x68,
-0x65,0x61,0x64,0x65,0x72,0x5f,0x74,0x69,0x74,0x6c,0x65,0x22,0x3e,0x4d,0x45,0x4e,
-0x55,0x3c,0x2f,0x68,0x31,0x3e,0x20,0x20,0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,0x68,
-0x65,0x61,0x64,0x65,0x72,0x3e,0x0a,0x09,0x09,0x09,0x09,0x3c,0x75,0x6c,0x20,0x63,
-0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x62,0x6f,0x64,0x79,0x22,
-0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,
-0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,
-0x68,0x72,0x65,0x66,0x3d,0x22,0x4e,0x74,0x72,0x69,0x70,0x43,0x66,0x67,0x2e,0x73,
-0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,
-0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0a,0x09,0x09,
-0x09,0x09,0x09,0x09,0x4e,0x54,0x52,0x49,0x50,0x20,0x53,0x65,0x74,0x74,0x69,0x6e,
-0x67,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,
-0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,
-0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x55,
-0x73,0x65,0x72,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,
-0x69,0x6e,0x6b,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x55,0x73,0x65,0x72,
-0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,
-0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,
-0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x4f,0x64,0x6f,0x43,
-0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,
-0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x4f,0x64,0x6f,0x20,0x43,0x6f,0x6e,0x66,
-0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,
-0x69,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,
-0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x45,0x74,0x68,0x43,0x66,0x67,0x2e,0x73,0x68,
-0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,
-0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0a,0x09,0x09,0x09,
-0x09,0x09,0x09,0x45,0x74,0x68,0x65,0x72,0x6e,0x65,0x74,0x20,0x53,0x65,0x74,0x74,
+0x20,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0a,0x09,
+0x09,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x24,0x28,0x69,0x64,0x29,0x20,
+0x7b,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
+0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,
+0x28,0x69,0x64,0x29,0x3b,0x20,0x7d,0x3b,0x0a,0x09,0x09,0x66,0x75,0x6e,0x63,0x74,
+0x69,0x6f,0x6e,0x20,0x4e,0x65,0x74,0x53,0x74,0x61,0x74,0x73,0x43,0x61,0x6c,0x6c,
+0x62,0x61,0x63,0x6b,0x28,0x6f,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x76,0x61,0x72,
+0x20,0x74,0x20,0x3d,0x20,0x27,0x27,0x3b,0x0a,0x09,0x09,0x09,0x66,0x6f,0x72,0x20,
+0x28,0x76,0x61,0x72,0x20,0x69,0x20,0x3d,0x20,0x30,0x3b,0x20,0x69,0x20,0x3c,0x20,
+0x6f,0x2e,0x70,0x6f,0x6f,0x6c,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x20,
+0x69,0x2b,0x2b,0x29,0x20,0x7b,0x0a,0x09,0x09,0x09,0x09,0x76,0x61,0x72,0x20,0x70,
+0x20,0x3d,0x20,0x6f,0x2e,0x70,0x6f,0x6f,0x6c,0x73,0x5b,0x69,0x5d,0x3b,0x0a,0x09,
+0x09,0x09,0x09,0x74,0x20,0x2b,0x3d,0x20,0x27,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,
+0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,
+0x64,0x65,0x76,0x69,0x63,0x65,0x22,0x3e,0x27,0x20,0x2b,0x20,0x70,0x5b,0x30,0x5d,
+0x20,0x2b,0x20,0x27,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,
+0x78,0x74,0x3e,0x27,0x20,0x2b,0x0a,0x09,0x09,0x09,0x09,0x09,0x70,0x5b,0x31,0x5d,
+0x20,0x2b,0x20,0x27,0x20,0x75,0x73,0x65,0x64,0x2c,0x20,0x27,0x20,0x2b,0x20,0x70,
+0x5b,0x32,0x5d,0x20,0x2b,0x20,0x27,0x20,0x6d,0x61,0x78,0x20,0x6f,0x66,0x20,0x27,
+0x20,0x2b,0x20,0x70,0x5b,0x33,0x5d,0x20,0x2b,0x20,0x27,0x2c,0x20,0x27,0x20,0x2b,
+0x20,0x70,0x5b,0x34,0x5d,0x20,0x2b,0x20,0x27,0x20,0x66,0x61,0x69,0x6c,0x65,0x64,
+0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x27,0x3b,0x0a,0x09,0x09,
+0x09,0x7d,0x0a,0x09,0x09,0x09,0x74,0x20,0x2b,0x3d,0x20,0x27,0x3c,0x70,0x3e,0x3c,
+0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,
+0x65,0x6c,0x5f,0x64,0x65,0x76,0x69,0x63,0x65,0x22,0x3e,0x48,0x45,0x41,0x50,0x3a,
+0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x3e,0x27,0x20,
+0x2b,0x0a,0x09,0x09,0x09,0x09,0x6f,0x2e,0x68,0x65,0x61,0x70,0x5b,0x30,0x5d,0x20,
+0x2b,0x20,0x27,0x20,0x75,0x73,0x65,0x64,0x2c,0x20,0x27,0x20,0x2b,0x20,0x6f,0x2e,
+0x68,0x65,0x61,0x70,0x5b,0x31,0x5d,0x20,0x2b,0x20,0x27,0x20,0x6d,0x61,0x78,0x20,
+0x6f,0x66,0x20,0x27,0x20,0x2b,0x20,0x6f,0x2e,0x68,0x65,0x61,0x70,0x5b,0x32,0x5d,
+0x20,0x2b,0x20,0x27,0x20,0x62,0x79,0x74,0x65,0x73,0x2c,0x20,0x27,0x20,0x2b,0x20,
+0x6f,0x2e,0x68,0x65,0x61,0x70,0x5b,0x33,0x5d,0x20,0x2b,0x20,0x27,0x20,0x66,0x61,
+0x69,0x6c,0x65,0x64,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x27,
+0x3b,0x0a,0x09,0x09,0x09,0x74,0x20,0x2b,0x3d,0x20,0x27,0x3c,0x70,0x3e,0x3c,0x6c,
+0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,
+0x6c,0x5f,0x64,0x65,0x76,0x69,0x63,0x65,0x22,0x3e,0x4d,0x42,0x4f,0x58,0x3a,0x3c,
+0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x3e,0x27,0x20,0x2b,
+0x0a,0x09,0x09,0x09,0x09,0x6f,0x2e,0x6d,0x62,0x6f,0x78,0x4d,0x61,0x78,0x20,0x2b,
+0x20,0x27,0x20,0x6d,0x61,0x78,0x20,0x77,0x61,0x69,0x74,0x69,0x6e,0x67,0x2c,0x20,
+0x27,0x20,0x2b,0x20,0x6f,0x2e,0x6d,0x62,0x6f,0x78,0x46,0x75,0x6c,0x6c,0x20,0x2b,
+0x20,0x27,0x20,0x66,0x75,0x6c,0x6c,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,
+0x70,0x3e,0x27,0x3b,0x0a,0x09,0x09,0x09,0x74,0x20,0x2b,0x3d,0x20,0x27,0x3c,0x70,
+0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,
+0x61,0x62,0x65,0x6c,0x5f,0x64,0x65,0x76,0x69,0x63,0x65,0x22,0x3e,0x54,0x43,0x50,
+0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x3e,0x27,
+0x20,0x2b,0x20,0x6f,0x2e,0x74,0x63,0x70,0x52,0x65,0x78,0x6d,0x69,0x74,0x20,0x2b,
+0x20,0x27,0x20,0x72,0x65,0x74,0x72,0x61,0x6e,0x73,0x6d,0x69,0x74,0x73,0x3c,0x2f,
+0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x27,0x3b,0x0a,0x09,0x09,0x09,0x69,
+0x66,0x20,0x28,0x24,0x28,0x27,0x6e,0x65,0x74,0x53,0x74,0x61,0x74,0x73,0x27,0x29,
+0x29,0x20,0x24,0x28,0x27,0x6e,0x65,0x74,0x53,0x74,0x61,0x74,0x73,0x27,0x29,0x2e,
+0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x74,0x3b,0x0a,0x09,
+0x09,0x7d,0x3b,0x0a,0x09,0x09,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x72,
+0x65,0x66,0x4e,0x65,0x77,0x28,0x29,0x7b,0x0a,0x09,0x09,0x09,0x76,0x61,0x72,0x20,
+0x78,0x68,0x72,0x3b,0x0a,0x09,0x09,0x09,0x69,0x66,0x28,0x77,0x69,0x6e,0x64,0x6f,
+0x77,0x2e,0x58,0x4d,0x4c,0x48,0x74,0x74,0x70,0x52,0x65,0x71,0x75,0x65,0x73,0x74,
+0x29,0x7b,0x0a,0x09,0x09,0x09,0x09,0x78,0x68,0x72,0x20,0x3d,0x20,0x6e,0x65,0x77,
+0x20,0x58,0x4d,0x4c,0x48,0x74,0x74,0x70,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x28,
+0x29,0x3b,0x0a,0x09,0x09,0x09,0x7d,0x65,0x6c,0x73,0x65,0x7b,0x0a,0x09,0x09,0x09,
+0x09,0x78,0x68,0x72,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x41,0x63,0x74,0x69,0x76,
+0x65,0x58,0x4f,0x62,0x6a,0x65,0x63,0x74,0x28,0x27,0x4d,0x69,0x63,0x72,0x6f,0x73,
+0x6f,0x66,0x74,0x2e,0x58,0x4d,0x4c,0x48,0x54,0x54,0x50,0x27,0x29,0x3b,0x0a,0x09,
+0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,0x78,0x68,0x72,0x2e,0x6f,0x6e,0x72,0x65,0x61,
+0x64,0x79,0x73,0x74,0x61,0x74,0x65,0x63,0x68,0x61,0x6e,0x67,0x65,0x20,0x3d,0x20,
+0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x0a,0x09,0x09,0x09,0x09,
+0x69,0x66,0x28,0x78,0x68,0x72,0x2e,0x72,0x65,0x61,0x64,0x79,0x53,0x74,0x61,0x74,
+0x65,0x20,0x3d,0x3d,0x3d,0x20,0x34,0x29,0x7b,0x0a,0x09,0x09,0x09,0x09,0x09,0x69,
+0x66,0x28,0x78,0x68,0x72,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x20,0x3d,0x3d,0x20,
+0x32,0x30,0x30,0x29,0x7b,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x65,0x76,0x61,0x6c,
+0x28,0x78,0x68,0x72,0x2e,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x54,0x65,0x78,
+0x74,0x29,0x3b,0x0a,0x09,0x09,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,0x09,0x7d,
+0x0a,0x09,0x09,0x09,0x7d,0x0a,0x09,0x09,0x09,0x78,0x68,0x72,0x2e,0x6f,0x70,0x65,
+0x6e,0x28,0x27,0x67,0x65,0x74,0x27,0x2c,0x27,0x4e,0x65,0x74,0x53,0x74,0x61,0x74,
+0x73,0x2e,0x6a,0x73,0x27,0x2c,0x74,0x72,0x75,0x65,0x29,0x3b,0x0a,0x09,0x09,0x09,
+0x78,0x68,0x72,0x2e,0x73,0x65,0x6e,0x64,0x28,0x29,0x3b,0x0a,0x09,0x09,0x7d,0x0a,
+0x09,0x09,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0a,0x09,0x3c,0x2f,0x68,
+0x65,0x61,0x64,0x3e,0x0a,0x09,0x3c,0x62,0x6f,0x64,0x79,0x20,0x6f,0x6e,0x6c,0x6f,
+0x61,0x64,0x3d,0x22,0x6a,0x61,0x76,0x61,0x73,0x63,0x72,0x69,0x70,0x74,0x3a,0x72,
+0x65,0x66,0x4e,0x65,0x77,0x28,0x29,0x3b,0x73,0x65,0x74,0x49,0x6e,0x74,0x65,0x72,
+0x76,0x61,0x6c,0x28,0x27,0x72,0x65,0x66,0x4e,0x65,0x77,0x28,0x29,0x27,0x2c,0x32,
+0x30,0x30,0x30,0x29,0x22,0x3e,0x0a,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,
+0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x22,0x3e,
+0x0a,0x09,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
+0x6d,0x65,0x6e,0x75,0x22,0x3e,0x20,0x20,0x0a,0x09,0x09,0x09,0x09,0x3c,0x68,0x65,
+0x61,0x64,0x65,0x72,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,
+0x5f,0x68,0x65,0x61,0x64,0x65,0x72,0x22,0x3e,0x20,0x20,0x0a,0x09,0x09,0x09,0x09,
+0x09,0x3c,0x68,0x31,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,
+0x5f,0x68,0x65,0x61,0x64,0x65,0x72,0x5f,0x74,0x69,0x74,0x6c,0x65,0x22,0x3e,0x4d,
+0x45,0x4e,0x55,0x3c,0x2f,0x68,0x31,0x3e,0x20,0x20,0x0a,0x09,0x09,0x09,0x09,0x3c,
+0x2f,0x68,0x65,0x61,0x64,0x65,0x72,0x3e,0x0a,0x09,0x09,0x09,0x09,0x3c,0x75,0x6c,
+0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x62,0x6f,0x64,
+0x79,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,
+0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,
+0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x4e,0x74,0x72,0x69,0x70,0x43,0x66,0x67,
+0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,
+0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0a,
+0x09,0x09,0x09,0x09,0x09,0x09,0x4e,0x54,0x52,0x49,0x50,0x20,0x53,0x65,0x74,0x74,
 0x69,0x6e,0x67,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,0x09,0x09,0x09,
 0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,
 0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,
-0x22,0x44,0x65,0x76,0x69,0x63,0x65,0x49,0x6e,0x66,0x6f,0x2e,0x73,0x68,0x74,0x6d,
-0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,
-0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x20,0x69,0x73,0x2d,0x61,0x63,0x74,0x69,
-0x76,0x65,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x44,0x65,0x76,0x69,0x63,
-0x65,0x20,0x49,0x6e,0x66,0x6f,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,
-0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,
-0x65,0x66,0x3d,0x22,0x68,0x74,0x74,0x70,0x73,0x3a,0x2f,0x2f,0x6f,0x70,0x65,0x6e,
-0x72,0x74,0x6b,0x2e,0x72,0x65,0x61,0x64,0x74,0x68,0x65,0x64,0x6f,0x63,0x73,0x2e,
-0x69,0x6f,0x2f,0x65,0x6e,0x2f,0x6c,0x61,0x74,0x65,0x73,0x74,0x2f,0x22,0x20,0x63,
-0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,
-0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x4f,0x70,0x65,
-0x6e,0x52,0x54,0x4b,0x33,0x33,0x30,0x20,0x4d,0x61,0x6e,0x75,0x61,0x6c,0x3c,0x2f,
-0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,0x75,0x6c,
-0x3e,0x0a,0x09,0x09,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x09,0x09,0x09,0x3c,
-0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x74,0x65,
-0x6e,0x74,0x2d,0x77,0x72,0x61,0x70,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,0x3c,0x68,
-0x65,0x61,0x64,0x65,0x72,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x64,
-0x72,0x6f,0x70,0x73,0x2d,0x68,0x65,0x61,0x64,0x65,0x72,0x22,0x3e,0x0a,0x09,0x09,
-0x09,0x09,0x09,0x3c,0x68,0x31,0x3e,0x41,0x63,0x65,0x69,0x6e,0x6e,0x61,0x20,0x4f,
-0x70,0x65,0x6e,0x52,0x54,0x4b,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x45,0x6d,0x62,
-0x65,0x64,0x64,0x65,0x64,0x20,0x77,0x65,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x3c,
-0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x68,0x31,0x3e,0x0a,0x09,0x09,0x09,0x09,
-0x3c,0x2f,0x68,0x65,0x61,0x64,0x65,0x72,0x3e,0x0a,0x0a,0x09,0x09,0x09,0x09,0x3c,
-0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x64,0x72,0x6f,
-0x70,0x73,0x2d,0x63,0x66,0x67,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x64,
-0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x66,0x67,0x74,0x69,0x74,
-0x6c,0x65,0x22,0x3e,0x44,0x65,0x76,0x69,0x63,0x65,0x20,0x49,0x6e,0x66,0x6f,0x3c,
-0x2f,0x64,0x69,0x76,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,
-0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x73,0x6e,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,
-0x09,0x09,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x64,0x65,0x76,0x69,0x63,0x65,0x22,
-0x3e,0x50,0x72,0x6f,0x64,0x75,0x63,0x74,0x20,0x4e,0x61,0x6d,0x65,0x3a,0x3c,0x2f,
-0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x3e,0x3c,0x21,0x2d,0x2d,
-0x23,0x70,0x72,0x6f,0x64,0x75,0x63,0x74,0x4e,0x61,0x6d,0x65,0x2d,0x2d,0x3e,0x3c,
+0x22,0x55,0x73,0x65,0x72,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,
+0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,
+0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x55,0x73,
+0x65,0x72,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,
+0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,
+0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,
+0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x4f,0x64,
+0x6f,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,
+0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,
+0x6b,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x4f,0x64,0x6f,0x20,0x43,0x6f,
+0x6e,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x61,0x3e,0x3c,
+0x2f,0x6c,0x69,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,
+0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,
+0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x45,0x74,0x68,0x43,0x66,0x67,0x2e,
+0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,
+0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0a,0x09,
+0x09,0x09,0x09,0x09,0x09,0x45,0x74,0x68,0x65,0x72,0x6e,0x65,0x74,0x20,0x53,0x65,
+0x74,0x74,0x69,0x6e,0x67,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,0x09,
+0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,
+0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,
+0x66,0x3d,0x22,0x44,0x65,0x76,0x69,0x63,0x65,0x49,0x6e,0x66,0x6f,0x2e,0x73,0x68,
+0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,
+0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x20,0x69,0x73,0x2d,0x61,0x63,
+0x74,0x69,0x76,0x65,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x44,0x65,0x76,
+0x69,0x63,0x65,0x20,0x49,0x6e,0x66,0x6f,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,
+0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,
+0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,
+0x68,0x72,0x65,0x66,0x3d,0x22,0x68,0x74,0x74,0x70,0x73,0x3a,0x2f,0x2f,0x6f,0x70,
+0x65,0x6e,0x72,0x74,0x6b,0x2e,0x72,0x65,0x61,0x64,0x74,0x68,0x65,0x64,0x6f,0x63,
+0x73,0x2e,0x69,0x6f,0x2f,0x65,0x6e,0x2f,0x6c,0x61,0x74,0x65,0x73,0x74,0x2f,0x22,
+0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,
+0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x4f,
+0x70,0x65,0x6e,0x52,0x54,0x4b,0x33,0x33,0x30,0x20,0x4d,0x61,0x6e,0x75,0x61,0x6c,
+0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,
+0x75,0x6c,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x09,0x09,
+0x09,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,
+0x74,0x65,0x6e,0x74,0x2d,0x77,0x72,0x61,0x70,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,
+0x3c,0x68,0x65,0x61,0x64,0x65,0x72,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,
+0x6f,0x64,0x72,0x6f,0x70,0x73,0x2d,0x68,0x65,0x61,0x64,0x65,0x72,0x22,0x3e,0x0a,
+0x09,0x09,0x09,0x09,0x09,0x3c,0x68,0x31,0x3e,0x41,0x63,0x65,0x69,0x6e,0x6e,0x61,
+0x20,0x4f,0x70,0x65,0x6e,0x52,0x54,0x4b,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x45,
+0x6d,0x62,0x65,0x64,0x64,0x65,0x64,0x20,0x77,0x65,0x62,0x73,0x65,0x72,0x76,0x65,
+0x72,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x68,0x31,0x3e,0x0a,0x09,0x09,
+0x09,0x09,0x3c,0x2f,0x68,0x65,0x61,0x64,0x65,0x72,0x3e,0x0a,0x0a,0x09,0x09,0x09,
+0x09,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x64,
+0x72,0x6f,0x70,0x73,0x2d,0x63,0x66,0x67,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,
+0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x66,0x67,0x74,
+0x69,0x74,0x6c,0x65,0x22,0x3e,0x44,0x65,0x76,0x69,0x63,0x65,0x20,0x49,0x6e,0x66,
+0x6f,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x64,0x69,
+0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x73,0x6e,0x22,0x3e,0x0a,0x09,0x09,
+0x09,0x09,0x09,0x09,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,
+0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x64,0x65,0x76,0x69,0x63,
+0x65,0x22,0x3e,0x50,0x72,0x6f,0x64,0x75,0x63,0x74,0x20,0x4e,0x61,0x6d,0x65,0x3a,
+0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x3e,0x3c,0x21,
+0x2d,0x2d,0x23,0x70,0x72,0x6f,0x64,0x75,0x63,0x74,0x4e,0x61,0x6d,0x65,0x2d,0x2d,
+0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x09,0x09,0x09,
+0x09,0x09,0x09,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,
+0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x64,0x65,0x76,0x69,0x63,0x65,
+0x22,0x3e,0x49,0x4d,0x55,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,
+0x65,0x78,0x74,0x3e,0x3c,0x21,0x2d,0x2d,0x23,0x69,0x6d,0x75,0x2d,0x2d,0x3e,0x3c,
 0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,
 0x09,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,
 0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x64,0x65,0x76,0x69,0x63,0x65,0x22,0x3e,
-0x49,0x4d,0x55,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,
-0x74,0x3e,0x3c,0x21,0x2d,0x2d,0x23,0x69,0x6d,0x75,0x2d,0x2d,0x3e,0x3c,0x2f,0x74,
-0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x3c,
-0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x6c,0x61,0x62,0x65,0x6c,0x5f,0x64,0x65,0x76,0x69,0x63,0x65,0x22,0x3e,0x50,0x4e,
+0x50,0x4e,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,
+0x3e,0x3c,0x21,0x2d,0x2d,0x23,0x70,0x6e,0x2d,0x2d,0x3e,0x3c,0x2f,0x74,0x65,0x78,
+0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x3c,0x70,0x3e,
+0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,
+0x62,0x65,0x6c,0x5f,0x64,0x65,0x76,0x69,0x63,0x65,0x22,0x3e,0x46,0x69,0x72,0x6d,
+0x77,0x61,0x72,0x65,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3a,0x3c,0x2f,0x6c,
+0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x3e,0x3c,0x21,0x2d,0x2d,0x23,
+0x66,0x69,0x72,0x6d,0x77,0x61,0x72,0x65,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x2d,
+0x2d,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x09,0x09,
+0x09,0x09,0x09,0x09,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,
+0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x64,0x65,0x76,0x69,0x63,
+0x65,0x22,0x3e,0x53,0x65,0x72,0x69,0x61,0x6c,0x20,0x4e,0x75,0x6d,0x62,0x65,0x72,
 0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x3e,0x3c,
-0x21,0x2d,0x2d,0x23,0x70,0x6e,0x2d,0x2d,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,
-0x3c,0x2f,0x70,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x3c,0x70,0x3e,0x3c,0x6c,
-0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,
-0x6c,0x5f,0x64,0x65,0x76,0x69,0x63,0x65,0x22,0x3e,0x46,0x69,0x72,0x6d,0x77,0x61,
-0x72,0x65,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3a,0x3c,0x2f,0x6c,0x61,0x62,
-0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x3e,0x3c,0x21,0x2d,0x2d,0x23,0x66,0x69,
-0x72,0x6d,0x77,0x61,0x72,0x65,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x2d,0x2d,0x3e,
+0x21,0x2d,0x2d,0x23,0x73,0x65,0x72,0x69,0x61,0x6c,0x4e,0x75,0x6d,0x77,0x65,0x72,
+0x2d,0x2d,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x09,
+0x09,0x09,0x09,0x09,0x09,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,
+0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x64,0x65,0x76,0x69,
+0x63,0x65,0x22,0x3e,0x41,0x70,0x70,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3a,
+0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x3e,0x3c,0x21,
+0x2d,0x2d,0x23,0x61,0x70,0x70,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x2d,0x2d,0x3e,
 0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x09,0x09,0x09,0x09,
-0x09,0x09,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x64,0x65,0x76,0x69,0x63,0x65,0x22,
-0x3e,0x53,0x65,0x72,0x69,0x61,0x6c,0x20,0x4e,0x75,0x6d,0x62,0x65,0x72,0x3a,0x3c,
-0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x3e,0x3c,0x21,0x2d,
-0x2d,0x23,0x73,0x65,0x72,0x69,0x61,0x6c,0x4e,0x75,0x6d,0x77,0x65,0x72,0x2d,0x2d,
-0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x09,0x09,0x09,
-0x09,0x09,0x09,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x64,0x65,0x76,0x69,0x63,0x65,
-0x22,0x3e,0x41,0x70,0x70,0x20,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x3a,0x3c,0x2f,
-0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x3e,0x3c,0x21,0x2d,0x2d,
-0x23,0x61,0x70,0x70,0x56,0x65,0x72,0x73,0x69,0x6f,0x6e,0x2d,0x2d,0x3e,0x3c,0x2f,
-0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,
-0x2f,0x64,0x69,0x76,0x3e,0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,
-0x0a,0x0a,0x09,0x09,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x21,0x2d,0x2d,0x20,
-0x2f,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x77,0x72,0x61,0x70,0x20,0x2d,0x2d,
-0x3e,0x0a,0x09,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x21,0x2d,0x2d,0x20,0x2f,
-0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x20,0x2d,0x2d,0x3e,0x0a,0x09,0x3c,
-0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,};
+0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x64,0x69,
+0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x66,0x67,0x74,0x69,0x74,0x6c,
+0x65,0x22,0x3e,0x4e,0x65,0x74,0x77,0x6f,0x72,0x6b,0x20,0x53,0x74,0x61,0x63,0x6b,
+0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x64,0x69,0x76,
+0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x73,0x6e,0x22,0x20,0x69,0x64,0x3d,0x22,
+0x6e,0x65,0x74,0x53,0x74,0x61,0x74,0x73,0x22,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,
+0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x0a,0x09,0x09,0x09,
+0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x21,0x2d,0x2d,0x20,0x2f,0x63,0x6f,0x6e,0x74,
+0x65,0x6e,0x74,0x2d,0x77,0x72,0x61,0x70,0x20,0x2d,0x2d,0x3e,0x0a,0x09,0x09,0x3c,
+0x2f,0x64,0x69,0x76,0x3e,0x3c,0x21,0x2d,0x2d,0x20,0x2f,0x63,0x6f,0x6e,0x74,0x61,
+0x69,0x6e,0x65,0x72,0x20,0x2d,0x2d,0x3e,0x0a,0x09,0x3c,0x2f,0x62,0x6f,0x64,0x79,
+0x3e,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,};
 
 static const unsigned int dummy_align__EthCfg_shtml = 3;
 static const unsigned char data__EthCfg_shtml[] = {
@@ -1353,255 +1182,138 @@ static const unsigned char data__EthCfg_shtml[] = {
 0x2f,0x45,0x74,0x68,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x00,0x00,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
+/* "HTTP/1.0 200 OK
 " (17 bytes) */
 0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
-/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
+/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
 " (63 bytes) */
 0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
 0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
 0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
 0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-/* "Content-type: text/html
-Expires: Fri, 10 Apr 2008 14:00:00 GMT
-Pragma: no-cache
-
-" (85 bytes) */
+/* "Content-type: text/html
+" (25 bytes) */
 0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
-0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,0x45,0x78,0x70,0x69,0x72,0x65,0x73,
-0x3a,0x20,0x46,0x72,0x69,0x2c,0x20,0x31,0x30,0x20,0x41,0x70,0x72,0x20,0x32,0x30,
-0x30,0x38,0x20,0x31,0x34,0x3a,0x30,0x30,0x3a,0x30,0x30,0x20,0x47,0x4d,0x54,0x0d,
-0x0a,0x50,0x72,0x61,0x67,0x6d,0x61,0x3a,0x20,0x6e,0x6f,0x2d,0x63,0x61,0x63,0x68,
-0x65,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (3163 bytes) */
-0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0a,
-0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0a,0x09,0x3c,0x68,0x65,0x61,0x64,0x3e,0x0a,0x09,
-0x09,0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3d,0x22,
-0x55,0x54,0x46,0x2d,0x38,0x22,0x20,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x74,0x69,0x74,
-0x6c,0x65,0x3e,0x4f,0x70,0x65,0x6e,0x52,0x54,0x4b,0x3c,0x2f,0x74,0x69,0x74,0x6c,
-0x65,0x3e,0x0a,0x09,0x09,0x3c,0x6c,0x69,0x6e,0x6b,0x20,0x72,0x65,0x6c,0x3d,0x22,
-0x73,0x74,0x79,0x6c,0x65,0x73,0x68,0x65,0x65,0x74,0x22,0x20,0x74,0x79,0x70,0x65,
-0x3d,0x22,0x74,0x65,0x78,0x74,0x2f,0x63,0x73,0x73,0x22,0x20,0x68,0x72,0x65,0x66,
-0x3d,0x22,0x63,0x73,0x73,0x2f,0x73,0x74,0x79,0x6c,0x65,0x2e,0x63,0x73,0x73,0x22,
-0x20,0x2f,0x3e,0x0a,0x09,0x09,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0a,0x09,
-0x09,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x24,0x28,0x69,0x64,0x29,0x20,
-0x7b,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,
-0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,
-0x28,0x69,0x64,0x29,0x3b,0x20,0x7d,0x3b,0x0a,0x09,0x09,0x66,0x75,0x6e,0x63,0x74,
-0x69,0x6f,0x6e,0x20,0x45,0x74,0x68,0x6e,0x65,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,
-0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x28,0x6f,0x29,0x20,0x7b,0x0a,0x09,0x09,
-0x69,0x66,0x20,0x28,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,
-0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x6f,0x2e,0x65,0x74,
-0x68,0x4d,0x6f,0x64,0x65,0x29,0x29,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,
-0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,
-0x6f,0x2e,0x65,0x74,0x68,0x4d,0x6f,0x64,0x65,0x29,0x2e,0x63,0x68,0x65,0x63,0x6b,
-0x65,0x64,0x20,0x3d,0x20,0x27,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x27,0x3b,0x0a,
-0x09,0x09,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x4d,0x61,0x63,0x27,
-0x29,0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x4d,0x61,0x63,0x27,0x29,0x2e,0x76,
-0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x6d,0x61,0x63,0x3b,0x0a,0x09,0x09,
-0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x44,0x65,0x66,0x61,0x75,0x6c,
-0x74,0x49,0x70,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x44,0x65,0x66,
-0x61,0x75,0x6c,0x74,0x49,0x70,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,
-0x20,0x6f,0x2e,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x49,0x70,0x3b,0x0a,0x09,0x09,
-0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x44,0x65,0x66,0x61,0x75,0x6c,
-0x74,0x4e,0x65,0x74,0x6d,0x61,0x73,0x6b,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x74,
-0x78,0x74,0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x4e,0x65,0x74,0x6d,0x61,0x73,0x6b,
-0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x64,0x65,0x66,
-0x61,0x75,0x6c,0x74,0x4e,0x65,0x74,0x6d,0x61,0x73,0x6b,0x3b,0x0a,0x09,0x09,0x69,
-0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x44,0x65,0x66,0x61,0x75,0x6c,0x74,
-0x47,0x61,0x74,0x65,0x77,0x61,0x79,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x74,0x78,
-0x74,0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x47,0x61,0x74,0x65,0x77,0x61,0x79,0x27,
-0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x64,0x65,0x66,0x61,
-0x75,0x6c,0x74,0x47,0x61,0x74,0x65,0x77,0x61,0x79,0x3b,0x0a,0x09,0x09,0x7d,0x3b,
-0x0a,0x09,0x09,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0a,0x09,0x3c,0x2f,
-0x68,0x65,0x61,0x64,0x3e,0x0a,0x09,0x3c,0x62,0x6f,0x64,0x79,0x3e,0x0a,0x09,0x09,
-0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x74,
-0x61,0x69,0x6e,0x65,0x72,0x22,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,
-0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x22,0x3e,0x20,0x20,0x0a,
-0x09,0x09,0x09,0x09,0x3c,0x68,0x65,0x61,0x64,0x65,0x72,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x68,0x65,0x61,0x64,0x65,0x72,0x22,0x3e,
-0x20,0x20,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x68,0x31,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x68,0x65,0x61,0x64,0x65,0x72,0x5f,0x74,
-0x69,0x74,0x6c,0x65,0x22,0x3e,0x4d,0x45,0x4e,0x55,0x3c,0x2f,0x68,0x31,0x3e,0x20,
-0x20,0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,0x68,0x65,0x61,0x64,0x65,0x72,0x3e,0x0a,
-0x09,0x09,0x09,0x09,0x3c,0x75,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,
-0x65,0x6e,0x75,0x5f,0x62,0x6f,0x64,0x79,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,
-0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,
-0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x4e,
-0x74,0x72,0x69,0x70,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,
-0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,
-0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x4e,0x54,0x52,
-0x49,0x50,0x20,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,
-0x6c,0x69,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,
-0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x55,0x73,0x65,0x72,0x43,0x66,0x67,0x2e,
-0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,
-0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0a,0x09,
-0x09,0x09,0x09,0x09,0x09,0x55,0x73,0x65,0x72,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,
-0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,
-0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,
-0x72,0x65,0x66,0x3d,0x22,0x4f,0x64,0x6f,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,
-0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,
-0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,
-0x09,0x4f,0x64,0x6f,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,
-0x6f,0x6e,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,0x09,0x09,0x09,0x09,
-0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,
-0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,
-0x45,0x74,0x68,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,
-0x69,0x6e,0x6b,0x20,0x69,0x73,0x2d,0x61,0x63,0x74,0x69,0x76,0x65,0x22,0x3e,0x0a,
-0x09,0x09,0x09,0x09,0x09,0x09,0x45,0x74,0x68,0x65,0x72,0x6e,0x65,0x74,0x20,0x53,
-0x65,0x74,0x74,0x69,0x6e,0x67,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,
-0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,
-0x65,0x66,0x3d,0x22,0x44,0x65,0x76,0x69,0x63,0x65,0x49,0x6e,0x66,0x6f,0x2e,0x73,
-0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,
-0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0a,0x09,0x09,
-0x09,0x09,0x09,0x09,0x44,0x65,0x76,0x69,0x63,0x65,0x20,0x49,0x6e,0x66,0x6f,0x3c,
-0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,
-0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,
-0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x68,0x74,0x74,
-0x70,0x73,0x3a,0x2f,0x2f,0x6f,0x70,0x65,0x6e,0x72,0x74,0x6b,0x2e,0x72,0x65,0x61,
-0x64,0x74,0x68,0x65,0x64,0x6f,0x63,0x73,0x2e,0x69,0x6f,0x2f,0x65,0x6e,0x2f,0x6c,
-0x61,0x74,0x65,0x73,0x74,0x2f,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,
-0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0a,
-0x09,0x09,0x09,0x09,0x09,0x09,0x4f,0x70,0x65,0x6e,0x52,0x54,0x4b,0x33,0x33,0x30,
-0x20,0x4d,0x61,0x6e,0x75,0x61,0x6c,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,
-0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,0x75,0x6c,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x2f,
-0x64,0x69,0x76,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x77,0x72,0x61,0x70,
-0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,0x3c,0x68,0x65,0x61,0x64,0x65,0x72,0x20,0x63,
-0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x64,0x72,0x6f,0x70,0x73,0x2d,0x68,0x65,
-0x61,0x64,0x65,0x72,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x68,0x31,0x3e,
-0x41,0x63,0x65,0x69,0x6e,0x6e,0x61,0x20,0x4f,0x70,0x65,0x6e,0x52,0x54,0x4b,0x20,
-0x3c,0x73,0x70,0x61,0x6e,0x3e,0x45,0x6d,0x62,0x65,0x64,0x64,0x65,0x64,0x20,0x77,
-0x65,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x3c,0x2f,0x73,0x70,0x61,0x6e,0x3e,0x3c,
-0x2f,0x68,0x31,0x3e,0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,0x68,0x65,0x61,0x64,0x65,
-0x72,0x3e,0x0a,0x0a,0x09,0x09,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x63,0x6f,0x64,0x72,0x6f,0x70,0x73,0x2d,0x63,0x66,0x67,0x22,
-0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x63,0x66,0x67,0x74,0x69,0x74,0x6c,0x65,0x22,0x3e,0x45,0x74,0x68,
-0x6e,0x65,0x74,0x20,0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x3c,0x2f,0x64,0x69,0x76,
-0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x66,0x6f,0x72,0x6d,0x20,0x69,0x64,0x3d,
-0x27,0x45,0x74,0x68,0x6e,0x65,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x27,0x20,0x6d,
-0x65,0x74,0x68,0x6f,0x64,0x3d,0x27,0x50,0x4f,0x53,0x54,0x27,0x20,0x61,0x63,0x74,
-0x69,0x6f,0x6e,0x3d,0x27,0x45,0x74,0x68,0x6e,0x65,0x74,0x43,0x6f,0x6e,0x66,0x69,
-0x67,0x2e,0x63,0x67,0x69,0x27,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x3c,0x70,
-0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,
-0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,
-0x6c,0x5f,0x65,0x74,0x68,0x22,0x3e,0x4d,0x4f,0x44,0x45,0x3a,0x3c,0x2f,0x6c,0x61,
-0x62,0x65,0x6c,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x72,0x61,
-0x64,0x69,0x6f,0x27,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,0x6d,0x61,0x72,0x67,
-0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x30,0x70,0x78,0x27,0x20,0x69,0x64,0x3d,
-0x27,0x72,0x61,0x64,0x69,0x6f,0x44,0x68,0x63,0x70,0x27,0x20,0x6e,0x61,0x6d,0x65,
-0x3d,0x22,0x65,0x74,0x68,0x4d,0x6f,0x64,0x65,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,
-0x3d,0x22,0x64,0x68,0x63,0x70,0x22,0x20,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x65,0x78,0x74,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x63,0x66,0x67,0x63,0x62,0x22,0x3e,0x44,0x48,0x43,0x50,0x3c,
-0x2f,0x74,0x65,0x78,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,
-0x72,0x61,0x64,0x69,0x6f,0x27,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,0x6d,0x61,
-0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x33,0x70,0x78,0x27,0x20,0x69,
-0x64,0x3d,0x27,0x72,0x61,0x64,0x69,0x6f,0x53,0x74,0x61,0x74,0x69,0x63,0x27,0x20,
-0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x74,0x68,0x4d,0x6f,0x64,0x65,0x22,0x20,0x76,
-0x61,0x6c,0x75,0x65,0x3d,0x22,0x73,0x74,0x61,0x74,0x69,0x63,0x22,0x20,0x2f,0x3e,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x65,
-0x78,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x66,0x67,0x63,0x62,0x22,
-0x3e,0x53,0x54,0x41,0x54,0x49,0x43,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x3e,0x0a,0x09,0x09,0x09,0x09,
-0x09,0x09,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x65,0x74,0x68,0x22,0x20,0x66,0x6f,
-0x72,0x3d,0x27,0x74,0x78,0x74,0x4d,0x61,0x63,0x27,0x3e,0x4d,0x41,0x43,0x3a,0x3c,
-0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,
-0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x74,0x78,
-0x74,0x4d,0x61,0x63,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x6d,0x61,0x63,0x27,
-0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,0x27,0x20,0x64,0x69,0x73,0x61,0x62,
-0x6c,0x65,0x64,0x3d,0x27,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x27,0x20,0x2f,
-0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x3c,0x70,0x3e,0x3c,
-0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,
-0x65,0x6c,0x5f,0x65,0x74,0x68,0x22,0x20,0x66,0x6f,0x72,0x3d,0x27,0x74,0x78,0x74,
-0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x49,0x70,0x27,0x3e,0x53,0x54,0x41,0x54,0x49,
-0x43,0x20,0x49,0x50,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,
-0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,
-0x69,0x64,0x3d,0x27,0x74,0x78,0x74,0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x49,0x70,
-0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x49,
-0x70,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,0x27,0x20,0x2f,0x3e,0x3c,
-0x2f,0x70,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x3c,0x70,0x3e,0x3c,0x6c,0x61,
-0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,
-0x5f,0x65,0x74,0x68,0x22,0x20,0x66,0x6f,0x72,0x3d,0x27,0x74,0x78,0x74,0x44,0x65,
-0x66,0x61,0x75,0x6c,0x74,0x4e,0x65,0x74,0x6d,0x61,0x73,0x6b,0x27,0x3e,0x53,0x54,
-0x41,0x54,0x49,0x43,0x20,0x4e,0x45,0x54,0x4d,0x41,0x53,0x4b,0x3a,0x3c,0x2f,0x6c,
-0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,
-0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x74,0x78,0x74,0x44,
-0x65,0x66,0x61,0x75,0x6c,0x74,0x4e,0x65,0x74,0x6d,0x61,0x73,0x6b,0x27,0x20,0x6e,
-0x61,0x6d,0x65,0x3d,0x27,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x4e,0x65,0x74,0x6d,
-0x61,0x73,0x6b,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,0x27,0x20,0x2f,
-0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x3c,0x70,0x3e,0x3c,
-0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,
-0x65,0x6c,0x5f,0x65,0x74,0x68,0x22,0x20,0x66,0x6f,0x72,0x3d,0x27,0x74,0x78,0x74,
-0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x47,0x61,0x74,0x65,0x77,0x61,0x79,0x27,0x3e,
-0x53,0x54,0x41,0x54,0x49,0x43,0x20,0x47,0x41,0x54,0x45,0x57,0x41,0x59,0x3a,0x3c,
-0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,
-0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x74,0x78,
-0x74,0x44,0x65,0x66,0x61,0x75,0x6c,0x74,0x47,0x61,0x74,0x65,0x77,0x61,0x79,0x27,
-0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x64,0x65,0x66,0x61,0x75,0x6c,0x74,0x47,0x61,
-0x74,0x65,0x77,0x61,0x79,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,0x27,
-0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x3c,0x64,
-0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x73,0x61,0x76,0x65,0x5f,0x62,0x75,0x74,0x74,
-0x6f,0x6e,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x09,0x3c,0x70,0x3e,0x3c,
-0x69,0x6e,0x70,0x75,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x75,0x74,
-0x74,0x6f,0x6e,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x73,0x75,0x62,0x6d,0x69,
-0x74,0x27,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x27,0x53,0x41,0x56,0x45,0x27,0x20,
-0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x3c,0x2f,0x64,
-0x69,0x76,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x2f,0x66,0x6f,0x72,0x6d,0x3e,
-0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x0a,0x09,0x09,0x09,
-0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x21,0x2d,0x2d,0x20,0x2f,0x63,0x6f,0x6e,0x74,
-0x65,0x6e,0x74,0x2d,0x77,0x72,0x61,0x70,0x20,0x2d,0x2d,0x3e,0x0a,0x09,0x09,0x3c,
-0x2f,0x64,0x69,0x76,0x3e,0x3c,0x21,0x2d,0x2d,0x20,0x2f,0x63,0x6f,0x6e,0x74,0x61,
-0x69,0x6e,0x65,0x72,0x20,0x2d,0x2d,0x3e,0x0a,0x0a,0x09,0x09,0x3c,0x73,0x63,0x72,
-0x69,0x70,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x2f,0x6a,
-0x61,0x76,0x61,0x73,0x63,0x72,0x69,0x70,0x74,0x27,0x20,0x73,0x72,0x63,0x3d,0x27,
-0x45,0x74,0x68,0x6e,0x65,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x6a,0x73,0x27,
-0x3e,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0a,0x09,0x3c,0x2f,0x62,0x6f,
-0x64,0x79,0x3e,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,};
+0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,
+/* "Cache-Control: no-cache
+" (25 bytes) */
+0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x3a,0x20,0x6e,
+0x6f,0x2d,0x63,0x61,0x63,0x68,0x65,0x0d,0x0a,
+/* "ETag: "d749f091"
+" (18 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x64,0x37,0x34,0x39,0x66,0x30,0x39,0x31,0x22,
+0x0d,0x0a,
+/* "Content-Encoding: gzip
+" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x45,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,
+0x3a,0x20,0x67,0x7a,0x69,0x70,0x0d,0x0a,
+/* "Vary: Accept-Encoding
+" (23 bytes) */
+0x56,0x61,0x72,0x79,0x3a,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2d,0x45,0x6e,0x63,
+0x6f,0x64,0x69,0x6e,0x67,0x0d,0x0a,
+/* "Content-Length: 1031
+
+" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x31,0x30,0x33,0x31,0x0d,0x0a,0x0d,0x0a,
+/* gzip file data (1031 bytes) */
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xad,0x57,0x4d,0x6f,0xdb,0x38,
+0x10,0x3d,0xa7,0xbf,0x82,0x15,0x0a,0x28,0x39,0xd8,0x6a,0x90,0x4b,0x91,0xc8,0x02,
+0xbc,0xb6,0xb7,0x6b,0x14,0xfe,0x40,0xed,0xb4,0xe8,0x29,0xa0,0xa5,0x91,0xc5,0x5a,
+0xa2,0x04,0x91,0x72,0xe2,0x5d,0xec,0x7f,0xdf,0x21,0x29,0xc9,0x92,0x9d,0xd4,0x4e,
+0xba,0xbe,0x88,0x9c,0x19,0xce,0xbc,0x21,0xf9,0x66,0x68,0xf7,0xfd,0x70,0x36,0x58,
+0xfe,0x98,0x8f,0x48,0x24,0x93,0xd8,0x7b,0xe7,0x9a,0xcf,0x85,0x1b,0x01,0x0d,0xf0,
+0x7b,0xe1,0x26,0x20,0x29,0xf1,0x23,0x9a,0x0b,0x90,0x3d,0xeb,0x7e,0xf9,0x67,0xe7,
+0x93,0x45,0x1c,0xad,0x92,0x4c,0xc6,0xe0,0xcd,0x32,0xe0,0x5f,0x97,0x5f,0x5c,0xc7,
+0x4c,0x95,0x22,0x66,0x7c,0x43,0x72,0x88,0x7b,0x96,0x90,0xbb,0x18,0x44,0x04,0x20,
+0x2d,0x22,0x77,0x19,0xf4,0x2c,0x09,0x4f,0xd2,0xf1,0x85,0xb0,0x48,0x94,0x43,0xd8,
+0xb3,0x70,0xe8,0x68,0xab,0xae,0x16,0x1a,0xcf,0xc2,0xcf,0x59,0x26,0xd5,0x30,0x2c,
+0xb8,0x2f,0x59,0xca,0xc9,0x87,0x4b,0x16,0x5c,0x91,0x7f,0xd0,0xad,0x2c,0x72,0x4e,
+0x82,0xd4,0x2f,0x12,0xe0,0xb2,0xbb,0x06,0x39,0x8a,0x41,0x0d,0xff,0xd8,0x8d,0x03,
+0x65,0x74,0x47,0xfe,0xbd,0x6b,0xae,0x1c,0xc9,0x88,0x83,0x1c,0xa4,0x3c,0x64,0xeb,
+0x01,0x8d,0xe3,0x15,0xf5,0x37,0x97,0x29,0xfa,0x42,0x23,0x16,0x92,0xcb,0x97,0x5c,
+0xa5,0x5d,0x90,0xd1,0x24,0x0d,0xe0,0xea,0x8a,0x9c,0xb6,0xe9,0xfa,0x11,0xf8,0x1b,
+0x08,0x48,0x8f,0xd8,0xe5,0xd0,0xbe,0x2b,0x23,0x7c,0xb8,0xb4,0xe5,0x93,0x9c,0x50,
+0xdf,0x46,0x57,0x8d,0x49,0x77,0x4b,0xe3,0x02,0x70,0x45,0xda,0x4d,0xa8,0xdf,0xb6,
+0x1e,0x42,0x48,0x8b,0x58,0x8e,0xb3,0xfd,0x9a,0x86,0xa8,0xb1,0x32,0xa8,0xa4,0xcf,
+0xae,0x9f,0x82,0x4c,0xa8,0xd8,0x1c,0x39,0xa9,0xe5,0xc7,0x9e,0x4a,0xd5,0xb3,0xee,
+0x3e,0x53,0x09,0x8f,0x74,0x77,0xe4,0xae,0x96,0x1f,0xbb,0x2b,0x55,0xca,0x9d,0x3e,
+0x17,0xd7,0xa9,0x4f,0xd7,0x75,0xca,0x6b,0xe6,0xae,0xd2,0x60,0xa7,0x4f,0x3e,0x60,
+0x5b,0xe2,0xc7,0x54,0x08,0xbc,0x19,0x29,0x97,0x94,0x71,0xc8,0x2d,0xa5,0x69,0xa9,
+0x70,0xff,0x0b,0xcb,0x23,0x44,0xc9,0xcd,0x5d,0x85,0xbc,0xa9,0x7b,0x30,0xa2,0xda,
+0x04,0x6d,0xae,0x9f,0xd1,0x3f,0xe8,0x2b,0x6b,0x79,0x93,0xd1,0xf4,0x1e,0xb1,0x5c,
+0xd7,0x1e,0x1d,0xa3,0xf7,0xcc,0xac,0x88,0x5b,0x6b,0x15,0x56,0x03,0x49,0x5f,0xf5,
+0x96,0x8e,0x49,0x48,0x2c,0xcf,0xa5,0xe5,0xe5,0x9e,0x4a,0xcc,0x74,0x10,0xae,0xbb,
+0x42,0xf1,0xca,0x3a,0x32,0x7d,0x50,0x4c,0xa9,0x7c,0x5d,0x4c,0x97,0x5f,0xc7,0x73,
+0xb2,0x00,0x29,0x19,0x5f,0xbb,0x0e,0xf5,0x5c,0x27,0x66,0xe7,0x05,0xba,0x17,0x90,
+0x9f,0x1d,0x47,0x19,0x13,0xc3,0x87,0x22,0xa7,0x8a,0x23,0xaf,0x0b,0x36,0x0b,0xd2,
+0xb3,0x63,0xa1,0xed,0xef,0x84,0x42,0xee,0x9e,0x0a,0x45,0x98,0xe8,0x50,0x64,0xfa,
+0x16,0xea,0xa0,0xb8,0x0a,0x72,0xe4,0xfc,0xdb,0xf6,0x72,0x08,0x5b,0xe6,0xc3,0x98,
+0x87,0xe9,0x79,0x29,0x1a,0x7b,0xa2,0x16,0xbc,0x2e,0x50,0x24,0x65,0x26,0x6e,0x1d,
+0x27,0xc5,0x0a,0x9a,0xcb,0x4d,0x37,0xc7,0x4b,0x87,0xc8,0xb1,0xd6,0x88,0x2e,0x4b,
+0x1d,0xe0,0x4e,0x8c,0xdc,0x11,0xd2,0x39,0xb9,0xc9,0xa6,0x04,0xdf,0xdc,0x7c,0x24,
+0x13,0xca,0x0b,0x1a,0xb7,0x71,0xb8,0x4e,0x11,0x1b,0x0a,0x39,0xc8,0xa1,0x23,0x32,
+0x29,0x9e,0x61,0x3d,0xeb,0x3c,0xe6,0x34,0x2b,0x5d,0x1e,0x50,0xca,0x4f,0x83,0x3c,
+0xcd,0x44,0xa7,0x62,0x55,0xcd,0x29,0xaf,0xef,0x03,0xe3,0x9c,0x92,0x12,0x01,0x71,
+0x45,0x46,0xb9,0x37,0x4a,0x56,0x10,0x04,0x58,0x0b,0x1f,0x61,0x85,0x77,0x6d,0x0b,
+0x39,0x92,0x5e,0x29,0x34,0xc9,0x0e,0x28,0x66,0xa6,0x2d,0x3c,0x26,0x9a,0x1f,0xae,
+0xeb,0x50,0x4d,0x75,0xb8,0x2e,0x69,0x6b,0x0a,0xfb,0xfe,0x90,0xab,0xe4,0xd0,0x3e,
+0x4c,0xf3,0x84,0xb0,0xa0,0x67,0x37,0x8b,0xbf,0x4d,0xb0,0x99,0x45,0x29,0x4a,0xe7,
+0xb3,0xc5,0xd2,0x26,0x54,0xf7,0x87,0xb6,0x4d,0xd7,0x5f,0x33,0xbb,0xda,0x57,0x37,
+0xf3,0xde,0x91,0x5f,0xfc,0xdc,0x98,0xae,0xa0,0x2e,0x0e,0x7a,0xf2,0x80,0x11,0xb0,
+0xa0,0xcc,0x86,0xa3,0x5b,0x3c,0x00,0x25,0x39,0xe1,0x82,0xf1,0xac,0x90,0xa6,0x37,
+0xda,0x39,0x0d,0x58,0x6a,0x13,0xdd,0x0e,0x7b,0x76,0x42,0xf3,0x35,0xe3,0x9d,0x18,
+0x42,0x79,0xfb,0x31,0x7b,0xb2,0x75,0x3e,0xda,0x64,0x18,0xf9,0x99,0x4d,0x38,0x4d,
+0xb0,0x9f,0x96,0xfd,0xc7,0x22,0xba,0xf0,0xf6,0xac,0x00,0x75,0xba,0x8d,0xfe,0x32,
+0xaa,0xea,0xc2,0x8d,0x0d,0xf5,0x57,0x96,0x37,0xfc,0x6b,0x30,0xc7,0x26,0x8e,0x8a,
+0xff,0x05,0xf1,0x4d,0x0b,0xf1,0x42,0x22,0xf9,0xfd,0x97,0x30,0x0b,0xad,0x7d,0x13,
+0xea,0xc5,0xb2,0xbf,0x1c,0x0f,0x4e,0xe1,0x76,0x9d,0xac,0x71,0xa6,0x2f,0x1d,0x1b,
+0xc1,0x5b,0xd3,0xab,0x9a,0xb3,0x37,0xe9,0x0f,0xea,0x23,0x6c,0xe5,0xac,0x42,0x99,
+0xd4,0x4a,0x53,0x93,0x15,0x66,0x8f,0x43,0xc1,0xfe,0xc6,0xe1,0xf5,0x27,0x9b,0x04,
+0x4c,0xd0,0x55,0x0c,0x68,0x56,0x8d,0x6c,0x4c,0xf0,0x95,0x48,0xf6,0x2d,0xbf,0xcc,
+0x94,0x8c,0xe7,0x67,0xa0,0xda,0x2f,0x2b,0xb1,0x05,0x7b,0xc1,0x1e,0xe1,0x5b,0xd1,
+0x54,0x6f,0x87,0x0a,0xd2,0x74,0xb4,0x9c,0xf4,0x17,0x5f,0xce,0xc7,0x55,0x39,0x68,
+0x83,0xab,0xa5,0xbf,0x8f,0xb0,0x7a,0x8e,0x54,0x08,0x3f,0xf7,0x97,0xa3,0xef,0xfd,
+0x1f,0xe7,0x23,0xac,0x1c,0xb4,0x11,0xd6,0xd2,0x97,0x10,0xaa,0x32,0x85,0x8e,0x2c,
+0x41,0xb7,0xf0,0xb0,0x2a,0xa4,0x4c,0x79,0x5d,0xa4,0x35,0x7e,0x13,0xb7,0xc4,0x5f,
+0x1a,0x94,0x30,0x44,0xb1,0x4a,0x18,0x02,0x31,0x9c,0xb0,0x17,0xfd,0x6f,0xa3,0x43,
+0xf7,0xcd,0x0a,0xe7,0xa8,0x12,0x57,0xd5,0x52,0x2d,0xdf,0x57,0x78,0xf7,0x7d,0xa7,
+0x43,0x9c,0x66,0x5d,0x27,0x9d,0x8e,0x7e,0x5e,0x1d,0xa8,0xf5,0xf3,0x4a,0xeb,0xf6,
+0xaf,0xee,0xc6,0xae,0x38,0x3f,0xe9,0x96,0x1a,0x29,0xe6,0x9c,0xfb,0x07,0xa5,0xf2,
+0xa7,0xb0,0xbd,0xd6,0x6b,0xce,0xbc,0xe2,0xb0,0xb4,0xab,0x3f,0x11,0xff,0x01,0x11,
+0xa7,0xf8,0x6e,0x5b,0x0c,0x00,0x00,};
 
 static const unsigned int dummy_align__NtripCfg_shtml = 4;
 static const unsigned char data__NtripCfg_shtml[] = {
 /* /NtripCfg.shtml (16 chars) */
 0x2f,0x4e,0x74,0x72,0x69,0x70,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x00,
 
-
 /* HTTP header */
-/* "HTTP/1.0 200 OK
+/* "HTTP/1.0 200 OK
 " (17 bytes) */
 0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
-/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
+/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
 " (63 bytes) */
 0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
 0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
 0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
 0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-/* "Content-type: text/html
-Expires: Fri, 10 Apr 2008 14:00:00 GMT
-Pragma: no-cache
-
-" (85 bytes) */
+/* "Content-type: text/html
+" (25 bytes) */
 0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
-0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,0x45,0x78,0x70,0x69,0x72,0x65,0x73,
-0x3a,0x20,0x46,0x72,0x69,0x2c,0x20,0x31,0x30,0x20,0x41,0x70,0x72,0x20,0x32,0x30,
-0x30,0x38,0x20,0x31,0x34,0x3a,0x30,0x30,0x3a,0x30,0x30,0x20,0x47,0x4d,0x54,0x0d,
-0x0a,0x50,0x72,0x61,0x67,0x6d,0x61,0x3a,0x20,0x6e,0x6f,0x2d,0x63,0x61,0x63,0x68,
-0x65,0x0d,0x0a,0x0d,0x0a,
+0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,
+/* "Expires: Fri, 10 Apr 2008 14:00:00 GMT
+" (40 bytes) */
+0x45,0x78,0x70,0x69,0x72,0x65,0x73,0x3a,0x20,0x46,0x72,0x69,0x2c,0x20,0x31,0x30,
+0x20,0x41,0x70,0x72,0x20,0x32,0x30,0x30,0x38,0x20,0x31,0x34,0x3a,0x30,0x30,0x3a,
+0x30,0x30,0x20,0x47,0x4d,0x54,0x0d,0x0a,
+/* "Pragma: no-cache
+
+" (20 bytes) */
+0x50,0x72,0x61,0x67,0x6d,0x61,0x3a,0x20,0x6e,0x6f,0x2d,0x63,0x61,0x63,0x68,0x65,
+0x0d,0x0a,0x0d,0x0a,
 /* raw file data (3763 bytes) */
 0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0d,
 0x0a,0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a,0x09,0x3c,0x68,0x65,0x61,0x64,0x3e,
@@ -1846,622 +1558,169 @@ static const unsigned char data__OdoCfg_shtml[] = {
 0x2f,0x4f,0x64,0x6f,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x00,0x00,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
+/* "HTTP/1.0 200 OK
 " (17 bytes) */
 0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
-/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
+/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
 " (63 bytes) */
 0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
 0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
 0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
 0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-/* "Content-type: text/html
-Expires: Fri, 10 Apr 2008 14:00:00 GMT
-Pragma: no-cache
-
-" (85 bytes) */
+/* "Content-type: text/html
+" (25 bytes) */
 0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
-0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,0x45,0x78,0x70,0x69,0x72,0x65,0x73,
-0x3a,0x20,0x46,0x72,0x69,0x2c,0x20,0x31,0x30,0x20,0x41,0x70,0x72,0x20,0x32,0x30,
-0x30,0x38,0x20,0x31,0x34,0x3a,0x30,0x30,0x3a,0x30,0x30,0x20,0x47,0x4d,0x54,0x0d,
-0x0a,0x50,0x72,0x61,0x67,0x6d,0x61,0x3a,0x20,0x6e,0x6f,0x2d,0x63,0x61,0x63,0x68,
-0x65,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (9490 bytes) */
-0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0d,
-0x0a,0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a,0x09,0x3c,0x68,0x65,0x61,0x64,0x3e,
-0x0d,0x0a,0x09,0x09,0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,
-0x74,0x3d,0x22,0x55,0x54,0x46,0x2d,0x38,0x22,0x20,0x2f,0x3e,0x0d,0x0a,0x09,0x09,
-0x3c,0x74,0x69,0x74,0x6c,0x65,0x3e,0x4f,0x70,0x65,0x6e,0x52,0x54,0x4b,0x3c,0x2f,
-0x74,0x69,0x74,0x6c,0x65,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x6c,0x69,0x6e,0x6b,0x20,
-0x72,0x65,0x6c,0x3d,0x22,0x73,0x74,0x79,0x6c,0x65,0x73,0x68,0x65,0x65,0x74,0x22,
-0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x2f,0x63,0x73,0x73,0x22,
-0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x63,0x73,0x73,0x2f,0x73,0x74,0x79,0x6c,0x65,
-0x2e,0x63,0x73,0x73,0x22,0x20,0x2f,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x73,0x63,0x72,
-0x69,0x70,0x74,0x3e,0x0d,0x0a,0x09,0x09,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-0x20,0x24,0x28,0x69,0x64,0x29,0x20,0x7b,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
-0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,
-0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x69,0x64,0x29,0x3b,0x20,0x7d,0x3b,0x0d,
-0x0a,0x09,0x09,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x4f,0x64,0x6f,0x43,
-0x6f,0x6e,0x66,0x69,0x67,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x28,0x6f,0x29,
-0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x69,0x66,0x20,0x28,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,
-0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x6f,0x2e,0x77,0x6c,
-0x6d,0x6f,0x64,0x65,0x29,0x29,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,
-0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x6f,
-0x2e,0x77,0x6c,0x6d,0x6f,0x64,0x65,0x29,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,
-0x20,0x3d,0x20,0x27,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x27,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x64,
-0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,
-0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x6f,0x2e,0x63,0x61,0x6e,0x6d,0x6f,0x64,0x65,
-0x29,0x29,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,
-0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x6f,0x2e,0x63,0x61,0x6e,
-0x6d,0x6f,0x64,0x65,0x29,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x20,0x3d,0x20,
-0x27,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x27,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x6a,0x73,0x6c,0x65,0x6e,0x67,
-0x74,0x68,0x3d,0x30,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x76,0x61,0x72,0x20,0x6a,0x73,0x32,0x20,
-0x69,0x6e,0x20,0x6f,0x2e,0x63,0x61,0x6e,0x4d,0x65,0x73,0x67,0x29,0x7b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x6a,0x73,0x6c,0x65,0x6e,0x67,0x74,0x68,0x2b,0x2b,0x3b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x6f,0x54,0x61,0x62,
-0x6c,0x65,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,
-0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x6f,0x54,
-0x61,0x62,0x6c,0x65,0x22,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x74,0x62,0x6f,0x64,0x79,0x20,0x3d,
-0x20,0x6f,0x54,0x61,0x62,0x6c,0x65,0x2e,0x74,0x42,0x6f,0x64,0x69,0x65,0x73,0x5b,
-0x30,0x5d,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x77,0x68,0x69,0x6c,0x65,0x20,0x28,0x6a,0x73,0x6c,0x65,0x6e,0x67,0x74,0x68,
-0x20,0x21,0x3d,0x20,0x74,0x62,0x6f,0x64,0x79,0x2e,0x72,0x6f,0x77,0x73,0x2e,0x6c,
-0x65,0x6e,0x67,0x74,0x68,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6a,0x73,
-0x6c,0x65,0x6e,0x67,0x74,0x68,0x20,0x3e,0x20,0x74,0x62,0x6f,0x64,0x79,0x2e,0x72,
-0x6f,0x77,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,0x20,0x7b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x61,0x64,0x64,0x52,0x6f,0x77,0x28,0x29,0x3b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,
-0x65,0x6c,0x73,0x65,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x65,0x6c,0x65,
-0x74,0x65,0x52,0x6f,0x77,0x28,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,0x0a,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x61,0x20,
-0x3d,0x20,0x30,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x76,0x61,0x72,0x20,0x62,0x20,0x3d,0x20,0x30,0x3b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x6c,
-0x65,0x74,0x20,0x6a,0x20,0x69,0x6e,0x20,0x6f,0x2e,0x63,0x61,0x6e,0x4d,0x65,0x73,
-0x67,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x6b,0x20,0x69,0x6e,0x20,
-0x6f,0x2e,0x63,0x61,0x6e,0x4d,0x65,0x73,0x67,0x5b,0x6a,0x5d,0x29,0x20,0x7b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x74,0x62,0x6f,0x64,0x79,0x2e,0x72,0x6f,0x77,0x73,0x5b,
-0x61,0x5d,0x2e,0x63,0x65,0x6c,0x6c,0x73,0x5b,0x62,0x5d,0x2e,0x69,0x6e,0x6e,0x65,
-0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6f,
-0x6e,0x74,0x65,0x6e,0x74,0x65,0x64,0x69,0x74,0x61,0x62,0x6c,0x65,0x3d,0x27,0x74,
-0x72,0x75,0x65,0x27,0x3e,0x22,0x20,0x2b,0x20,0x6f,0x2e,0x63,0x61,0x6e,0x4d,0x65,
-0x73,0x67,0x5b,0x6a,0x5d,0x5b,0x6b,0x5d,0x20,0x2b,0x20,0x22,0x3c,0x2f,0x64,0x69,
-0x76,0x3e,0x22,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x62,0x20,0x3d,0x20,0x62,0x20,
-0x2b,0x20,0x31,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x20,0x3d,0x20,0x61,0x20,0x2b,
-0x20,0x31,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x62,0x20,0x3d,0x20,0x30,0x3b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,0x0a,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x67,0x54,
-0x61,0x62,0x6c,0x65,0x20,0x3d,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,
-0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,
-0x67,0x54,0x61,0x62,0x6c,0x65,0x22,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x67,0x62,0x6f,0x64,0x79,
-0x20,0x3d,0x20,0x67,0x54,0x61,0x62,0x6c,0x65,0x2e,0x74,0x42,0x6f,0x64,0x69,0x65,
-0x73,0x5b,0x30,0x5d,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x61,0x20,0x3d,0x20,0x30,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x6a,0x20,0x69,0x6e,
-0x20,0x6f,0x2e,0x67,0x65,0x61,0x72,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x67,0x62,0x6f,0x64,
-0x79,0x2e,0x72,0x6f,0x77,0x73,0x5b,0x61,0x5d,0x2e,0x63,0x65,0x6c,0x6c,0x73,0x5b,
-0x31,0x5d,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x22,
-0x3c,0x64,0x69,0x76,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x65,0x64,0x69,0x74,
-0x61,0x62,0x6c,0x65,0x3d,0x27,0x74,0x72,0x75,0x65,0x27,0x3e,0x22,0x20,0x2b,0x20,
-0x6f,0x2e,0x67,0x65,0x61,0x72,0x5b,0x6a,0x5d,0x20,0x2b,0x20,0x22,0x3c,0x2f,0x64,
-0x69,0x76,0x3e,0x22,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x20,0x3d,0x20,0x61,0x20,0x2b,0x20,0x31,
-0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
-0x0d,0x0a,0x09,0x09,0x7d,0x3b,0x0d,0x0a,0x09,0x09,0x66,0x75,0x6e,0x63,0x74,0x69,
-0x6f,0x6e,0x20,0x61,0x64,0x64,0x52,0x6f,0x77,0x28,0x29,0x7b,0x0d,0x0a,0x09,0x09,
-0x09,0x76,0x61,0x72,0x20,0x6f,0x54,0x61,0x62,0x6c,0x65,0x20,0x3d,0x20,0x64,0x6f,
-0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,
-0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x6f,0x54,0x61,0x62,0x6c,0x65,0x22,0x29,0x3b,
-0x0d,0x0a,0x09,0x09,0x09,0x76,0x61,0x72,0x20,0x74,0x62,0x6f,0x64,0x79,0x20,0x3d,
-0x20,0x6f,0x54,0x61,0x62,0x6c,0x65,0x2e,0x74,0x42,0x6f,0x64,0x69,0x65,0x73,0x5b,
-0x30,0x5d,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x69,0x66,0x20,0x28,0x74,0x62,0x6f,0x64,0x79,0x2e,0x72,0x6f,0x77,0x73,0x2e,
-0x6c,0x65,0x6e,0x67,0x74,0x68,0x20,0x3c,0x20,0x33,0x29,0x20,0x7b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,
-0x61,0x72,0x20,0x74,0x72,0x20,0x3d,0x20,0x74,0x62,0x6f,0x64,0x79,0x2e,0x69,0x6e,
-0x73,0x65,0x72,0x74,0x52,0x6f,0x77,0x28,0x74,0x62,0x6f,0x64,0x79,0x2e,0x72,0x6f,
-0x77,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,
-0x20,0x74,0x64,0x5f,0x30,0x20,0x3d,0x20,0x74,0x72,0x2e,0x69,0x6e,0x73,0x65,0x72,
-0x74,0x43,0x65,0x6c,0x6c,0x28,0x30,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x64,0x5f,0x30,0x2e,
-0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x22,0x3c,0x64,0x69,
-0x76,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x65,0x64,0x69,0x74,0x61,0x62,0x6c,
-0x65,0x3d,0x27,0x74,0x72,0x75,0x65,0x27,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,
-0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x74,0x64,0x5f,0x31,0x20,0x3d,0x20,0x74,0x72,
-0x2e,0x69,0x6e,0x73,0x65,0x72,0x74,0x43,0x65,0x6c,0x6c,0x28,0x31,0x29,0x3b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x74,0x64,0x5f,0x31,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,
-0x3d,0x20,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x65,
-0x64,0x69,0x74,0x61,0x62,0x6c,0x65,0x3d,0x27,0x74,0x72,0x75,0x65,0x27,0x3e,0x3c,
-0x2f,0x64,0x69,0x76,0x3e,0x22,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x74,0x64,0x5f,
-0x32,0x20,0x3d,0x20,0x74,0x72,0x2e,0x69,0x6e,0x73,0x65,0x72,0x74,0x43,0x65,0x6c,
-0x6c,0x28,0x32,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x64,0x5f,0x32,0x2e,0x69,0x6e,0x6e,0x65,
-0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6f,
-0x6e,0x74,0x65,0x6e,0x74,0x65,0x64,0x69,0x74,0x61,0x62,0x6c,0x65,0x3d,0x27,0x74,
-0x72,0x75,0x65,0x27,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,
-0x61,0x72,0x20,0x74,0x64,0x5f,0x33,0x20,0x3d,0x20,0x74,0x72,0x2e,0x69,0x6e,0x73,
-0x65,0x72,0x74,0x43,0x65,0x6c,0x6c,0x28,0x33,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x64,0x5f,
-0x33,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x22,0x3c,
-0x64,0x69,0x76,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x65,0x64,0x69,0x74,0x61,
-0x62,0x6c,0x65,0x3d,0x27,0x74,0x72,0x75,0x65,0x27,0x3e,0x3c,0x2f,0x64,0x69,0x76,
-0x3e,0x22,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x74,0x64,0x5f,0x34,0x20,0x3d,0x20,
-0x74,0x72,0x2e,0x69,0x6e,0x73,0x65,0x72,0x74,0x43,0x65,0x6c,0x6c,0x28,0x34,0x29,
-0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x74,0x64,0x5f,0x34,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,
-0x4c,0x20,0x3d,0x20,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,
-0x74,0x65,0x64,0x69,0x74,0x61,0x62,0x6c,0x65,0x3d,0x27,0x74,0x72,0x75,0x65,0x27,
-0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x74,
-0x64,0x5f,0x35,0x20,0x3d,0x20,0x74,0x72,0x2e,0x69,0x6e,0x73,0x65,0x72,0x74,0x43,
-0x65,0x6c,0x6c,0x28,0x35,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x64,0x5f,0x35,0x2e,0x69,0x6e,
-0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x22,0x3c,0x64,0x69,0x76,0x20,
-0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x65,0x64,0x69,0x74,0x61,0x62,0x6c,0x65,0x3d,
-0x27,0x74,0x72,0x75,0x65,0x27,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x3b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x76,0x61,0x72,0x20,0x74,0x64,0x5f,0x36,0x20,0x3d,0x20,0x74,0x72,0x2e,0x69,
-0x6e,0x73,0x65,0x72,0x74,0x43,0x65,0x6c,0x6c,0x28,0x36,0x29,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,
-0x64,0x5f,0x36,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,
-0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x65,0x64,0x69,
-0x74,0x61,0x62,0x6c,0x65,0x3d,0x27,0x74,0x72,0x75,0x65,0x27,0x3e,0x3c,0x2f,0x64,
-0x69,0x76,0x3e,0x22,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x74,0x64,0x5f,0x37,0x20,
-0x3d,0x20,0x74,0x72,0x2e,0x69,0x6e,0x73,0x65,0x72,0x74,0x43,0x65,0x6c,0x6c,0x28,
-0x37,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x74,0x64,0x5f,0x37,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x48,
-0x54,0x4d,0x4c,0x20,0x3d,0x20,0x22,0x3c,0x64,0x69,0x76,0x20,0x63,0x6f,0x6e,0x74,
-0x65,0x6e,0x74,0x65,0x64,0x69,0x74,0x61,0x62,0x6c,0x65,0x3d,0x27,0x74,0x72,0x75,
-0x65,0x27,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,0x3b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,
-0x20,0x74,0x64,0x5f,0x38,0x20,0x3d,0x20,0x74,0x72,0x2e,0x69,0x6e,0x73,0x65,0x72,
-0x74,0x43,0x65,0x6c,0x6c,0x28,0x38,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x64,0x5f,0x38,0x2e,
-0x69,0x6e,0x6e,0x65,0x72,0x48,0x54,0x4d,0x4c,0x20,0x3d,0x20,0x22,0x3c,0x64,0x69,
-0x76,0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x65,0x64,0x69,0x74,0x61,0x62,0x6c,
-0x65,0x3d,0x27,0x74,0x72,0x75,0x65,0x27,0x3e,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x22,
-0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
-0x0d,0x0a,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
-0x6e,0x20,0x64,0x65,0x6c,0x65,0x74,0x65,0x52,0x6f,0x77,0x28,0x29,0x7b,0x0d,0x0a,
-0x09,0x09,0x09,0x76,0x61,0x72,0x20,0x6f,0x54,0x61,0x62,0x6c,0x65,0x20,0x3d,0x20,
-0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,
-0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x6f,0x54,0x61,0x62,0x6c,0x65,0x22,
-0x29,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x76,0x61,0x72,0x20,0x74,0x62,0x6f,0x64,0x79,
-0x20,0x3d,0x20,0x6f,0x54,0x61,0x62,0x6c,0x65,0x2e,0x74,0x42,0x6f,0x64,0x69,0x65,
-0x73,0x5b,0x30,0x5d,0x3b,0x0d,0x0a,0x09,0x09,0x09,0x74,0x62,0x6f,0x64,0x79,0x2e,
-0x64,0x65,0x6c,0x65,0x74,0x65,0x52,0x6f,0x77,0x28,0x74,0x62,0x6f,0x64,0x79,0x2e,
-0x72,0x6f,0x77,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x2d,0x31,0x29,0x3b,0x0d,
-0x0a,0x09,0x09,0x7d,0x0d,0x0a,0x09,0x09,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,
-0x3e,0x0d,0x0a,0x09,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x0d,0x0a,0x09,0x3c,0x62,
-0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x22,0x3e,0x0d,
-0x0a,0x09,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x6d,0x65,0x6e,0x75,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x68,0x65,0x61,
-0x64,0x65,0x72,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,
-0x68,0x65,0x61,0x64,0x65,0x72,0x22,0x3e,0x20,0x20,0x0d,0x0a,0x09,0x09,0x09,0x09,
-0x09,0x3c,0x68,0x31,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,
-0x5f,0x68,0x65,0x61,0x64,0x65,0x72,0x5f,0x74,0x69,0x74,0x6c,0x65,0x22,0x3e,0x4d,
-0x45,0x4e,0x55,0x3c,0x2f,0x68,0x31,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,
-0x68,0x65,0x61,0x64,0x65,0x72,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x75,0x6c,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x62,0x6f,0x64,
-0x79,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,
-0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x4e,0x74,0x72,0x69,0x70,0x43,0x66,
-0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,
-0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x4e,0x54,0x52,0x49,0x50,0x20,0x53,0x65,
-0x74,0x74,0x69,0x6e,0x67,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,
-0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,
-0x65,0x66,0x3d,0x22,0x55,0x73,0x65,0x72,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,
-0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,
-0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,
-0x09,0x09,0x55,0x73,0x65,0x72,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,
-0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x09,
-0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,
-0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,
-0x66,0x3d,0x22,0x4f,0x64,0x6f,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,
-0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x20,0x69,0x73,0x2d,0x61,0x63,0x74,0x69,0x76,0x65,
-0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x4f,0x64,0x6f,0x20,0x43,0x6f,
-0x6e,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x61,0x3e,0x3c,
-0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,
-0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,
-0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x45,0x74,0x68,0x43,0x66,0x67,
-0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,
-0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0d,
-0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x45,0x74,0x68,0x65,0x72,0x6e,0x65,0x74,0x20,
-0x53,0x65,0x74,0x74,0x69,0x6e,0x67,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,
-0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,
-0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,
-0x68,0x72,0x65,0x66,0x3d,0x22,0x44,0x65,0x76,0x69,0x63,0x65,0x49,0x6e,0x66,0x6f,
-0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,
-0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0d,
-0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x44,0x65,0x76,0x69,0x63,0x65,0x20,0x49,0x6e,
-0x66,0x6f,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x09,0x09,0x09,
-0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,
-0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,
-0x22,0x68,0x74,0x74,0x70,0x73,0x3a,0x2f,0x2f,0x6f,0x70,0x65,0x6e,0x72,0x74,0x6b,
-0x2e,0x72,0x65,0x61,0x64,0x74,0x68,0x65,0x64,0x6f,0x63,0x73,0x2e,0x69,0x6f,0x2f,
-0x65,0x6e,0x2f,0x6c,0x61,0x74,0x65,0x73,0x74,0x2f,0x22,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,
-0x6b,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x4f,0x70,0x65,0x6e,0x52,
-0x54,0x4b,0x33,0x33,0x30,0x20,0x4d,0x61,0x6e,0x75,0x61,0x6c,0x3c,0x2f,0x61,0x3e,
-0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,0x75,0x6c,0x3e,
-0x0d,0x0a,0x09,0x09,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x09,0x09,0x09,
-0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x74,
-0x65,0x6e,0x74,0x2d,0x77,0x72,0x61,0x70,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x65,0x61,
-0x64,0x65,0x72,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x64,0x72,0x6f,
-0x70,0x73,0x2d,0x68,0x65,0x61,0x64,0x65,0x72,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x68,0x31,0x3e,0x41,0x63,0x65,0x69,0x6e,0x6e,0x61,0x20,0x4f,0x70,0x65,
-0x6e,0x52,0x54,0x4b,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x45,0x6d,0x62,0x65,0x64,
-0x64,0x65,0x64,0x20,0x77,0x65,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x3c,0x2f,0x73,
-0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x68,0x31,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x68,0x65,0x61,
-0x64,0x65,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6e,0x61,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,
-0x3d,0x22,0x63,0x6f,0x64,0x72,0x6f,0x70,0x73,0x2d,0x63,0x66,0x67,0x22,0x3e,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-0x22,0x63,0x66,0x67,0x74,0x69,0x74,0x6c,0x65,0x22,0x3e,0x43,0x41,0x4e,0x20,0x4d,
-0x65,0x73,0x73,0x61,0x67,0x65,0x20,0x4d,0x6f,0x64,0x65,0x3c,0x2f,0x64,0x69,0x76,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x69,0x64,
-0x3d,0x22,0x6f,0x54,0x61,0x62,0x6c,0x65,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
-0x22,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,
-0x72,0x3a,0x23,0x65,0x65,0x65,0x65,0x65,0x65,0x3b,0x22,0x20,0x62,0x6f,0x72,0x64,
-0x65,0x72,0x63,0x6f,0x6c,0x6f,0x72,0x3d,0x22,0x23,0x61,0x61,0x61,0x61,0x61,0x61,
-0x22,0x20,0x62,0x6f,0x72,0x64,0x65,0x72,0x3d,0x22,0x31,0x22,0x20,0x63,0x65,0x6c,
-0x6c,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3d,0x22,0x30,0x22,0x20,0x77,0x69,0x64,
-0x74,0x68,0x3d,0x22,0x37,0x30,0x30,0x70,0x78,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x65,0x61,0x64,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x20,0x77,0x69,0x64,0x74,
-0x68,0x3d,0x22,0x31,0x30,0x30,0x70,0x78,0x22,0x3e,0x4d,0x65,0x73,0x67,0x49,0x44,
-0x3c,0x2f,0x74,0x68,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x74,0x68,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x37,0x35,
-0x70,0x78,0x22,0x3e,0x53,0x74,0x61,0x72,0x74,0x62,0x69,0x74,0x3c,0x2f,0x74,0x68,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x74,0x68,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x37,0x35,0x70,0x78,0x22,0x3e,
-0x4c,0x65,0x6e,0x67,0x74,0x68,0x3c,0x2f,0x74,0x68,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x20,0x77,0x69,0x64,
-0x74,0x68,0x3d,0x22,0x37,0x35,0x70,0x78,0x22,0x3e,0x45,0x6e,0x64,0x69,0x61,0x6e,
-0x3c,0x2f,0x74,0x68,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x74,0x68,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x37,0x35,
-0x70,0x78,0x22,0x3e,0x53,0x69,0x67,0x6e,0x3c,0x2f,0x74,0x68,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x20,0x77,
-0x69,0x64,0x74,0x68,0x3d,0x22,0x37,0x35,0x70,0x78,0x22,0x3e,0x46,0x61,0x63,0x74,
-0x6f,0x72,0x3c,0x2f,0x74,0x68,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,
-0x37,0x35,0x70,0x78,0x22,0x3e,0x4f,0x66,0x66,0x73,0x65,0x74,0x3c,0x2f,0x74,0x68,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x74,0x68,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x37,0x35,0x70,0x78,0x22,0x3e,
-0x55,0x6e,0x69,0x74,0x3c,0x2f,0x74,0x68,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x20,0x77,0x69,0x64,0x74,0x68,
-0x3d,0x22,0x37,0x35,0x70,0x78,0x22,0x3e,0x53,0x6f,0x75,0x72,0x63,0x65,0x3c,0x2f,
-0x74,0x68,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,
-0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x68,
-0x65,0x61,0x64,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,
-0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x2f,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,
-0x61,0x62,0x6c,0x65,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,
-0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,
-0x6f,0x6e,0x43,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x61,0x64,0x64,0x52,0x6f,0x77,0x28,
-0x29,0x3b,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,
-0x3a,0x32,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,
-0x31,0x36,0x70,0x78,0x3b,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x2b,0x22,
-0x2f,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,
-0x79,0x70,0x65,0x3d,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x6f,0x6e,0x43,
-0x6c,0x69,0x63,0x6b,0x3d,0x22,0x64,0x65,0x6c,0x65,0x74,0x65,0x52,0x6f,0x77,0x28,
-0x29,0x3b,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,
-0x3a,0x32,0x30,0x70,0x78,0x3b,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,
-0x31,0x36,0x70,0x78,0x3b,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x2d,0x22,
-0x2f,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x72,0x3e,0x3c,0x62,0x72,0x3e,
-0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x61,0x62,0x6c,0x65,0x20,0x69,
-0x64,0x3d,0x22,0x67,0x54,0x61,0x62,0x6c,0x65,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,
-0x3d,0x22,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,
-0x6f,0x72,0x3a,0x23,0x65,0x65,0x65,0x65,0x65,0x65,0x3b,0x22,0x20,0x62,0x6f,0x72,
-0x64,0x65,0x72,0x63,0x6f,0x6c,0x6f,0x72,0x3d,0x22,0x23,0x61,0x61,0x61,0x61,0x61,
-0x61,0x22,0x20,0x62,0x6f,0x72,0x64,0x65,0x72,0x3d,0x22,0x31,0x22,0x20,0x63,0x65,
-0x6c,0x6c,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3d,0x22,0x32,0x22,0x20,0x77,0x69,
-0x64,0x74,0x68,0x3d,0x22,0x31,0x35,0x30,0x70,0x78,0x22,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x65,0x61,0x64,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x68,0x20,0x77,0x69,0x64,
-0x74,0x68,0x3d,0x22,0x37,0x35,0x70,0x78,0x22,0x3e,0x47,0x65,0x61,0x72,0x3c,0x2f,
-0x74,0x68,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x74,0x68,0x20,0x77,0x69,0x64,0x74,0x68,0x3d,0x22,0x37,0x35,0x70,0x78,
-0x22,0x3e,0x56,0x61,0x6c,0x75,0x65,0x3c,0x2f,0x74,0x68,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x68,0x65,0x61,0x64,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x72,0x3e,
-0x3c,0x74,0x64,0x3e,0x50,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x74,0x64,0x20,0x63,0x6f,
-0x6e,0x74,0x65,0x6e,0x74,0x65,0x64,0x69,0x74,0x61,0x62,0x6c,0x65,0x3d,0x27,0x74,
-0x72,0x75,0x65,0x27,0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,0x3e,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x72,
-0x3e,0x3c,0x74,0x64,0x3e,0x52,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x74,0x64,0x20,0x63,
-0x6f,0x6e,0x74,0x65,0x6e,0x74,0x65,0x64,0x69,0x74,0x61,0x62,0x6c,0x65,0x3d,0x27,
-0x74,0x72,0x75,0x65,0x27,0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,
-0x72,0x3e,0x3c,0x74,0x64,0x3e,0x4e,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x74,0x64,0x20,
-0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x65,0x64,0x69,0x74,0x61,0x62,0x6c,0x65,0x3d,
-0x27,0x74,0x72,0x75,0x65,0x27,0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,0x72,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x74,0x72,0x3e,0x3c,0x74,0x64,0x3e,0x44,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x74,0x64,
-0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x65,0x64,0x69,0x74,0x61,0x62,0x6c,0x65,
-0x3d,0x27,0x74,0x72,0x75,0x65,0x27,0x3e,0x3c,0x2f,0x74,0x64,0x3e,0x3c,0x2f,0x74,
-0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x62,
-0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x74,0x61,0x62,0x6c,
-0x65,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x72,0x3e,0x3c,0x62,0x72,0x3e,
-0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x63,0x66,0x67,0x74,0x69,0x74,0x6c,0x65,0x22,0x3e,0x48,0x61,
-0x72,0x64,0x77,0x61,0x72,0x65,0x20,0x4d,0x6f,0x64,0x65,0x3c,0x2f,0x64,0x69,0x76,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x66,0x6f,0x72,0x6d,0x20,0x69,0x64,0x3d,
-0x27,0x4f,0x64,0x6f,0x43,0x6f,0x6e,0x66,0x69,0x67,0x27,0x20,0x6d,0x65,0x74,0x68,
-0x6f,0x64,0x3d,0x27,0x50,0x4f,0x53,0x54,0x27,0x20,0x61,0x63,0x74,0x69,0x6f,0x6e,
-0x3d,0x27,0x4f,0x64,0x6f,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x63,0x67,0x69,0x27,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x61,0x62,
-0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,
-0x77,0x68,0x65,0x65,0x6c,0x74,0x69,0x63,0x6b,0x22,0x3e,0x50,0x49,0x4e,0x20,0x4d,
-0x6f,0x64,0x65,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,
-0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x72,0x61,0x64,0x69,0x6f,0x27,0x20,0x73,0x74,
-0x79,0x6c,0x65,0x3d,0x27,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,
-0x3a,0x30,0x70,0x78,0x27,0x20,0x69,0x64,0x3d,0x27,0x72,0x61,0x64,0x69,0x6f,0x57,
-0x68,0x65,0x65,0x6c,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x6c,0x6d,0x6f,
-0x64,0x65,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x57,0x48,0x45,0x45,0x4c,
-0x54,0x49,0x43,0x4b,0x22,0x20,0x2f,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x65,0x78,0x74,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x63,0x66,0x67,0x63,0x62,0x22,0x3e,0x57,0x48,0x45,0x45,0x4c,0x54,
-0x49,0x43,0x4b,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,
-0x79,0x70,0x65,0x3d,0x27,0x72,0x61,0x64,0x69,0x6f,0x27,0x20,0x73,0x74,0x79,0x6c,
-0x65,0x3d,0x27,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x33,
-0x70,0x78,0x27,0x20,0x69,0x64,0x3d,0x27,0x72,0x61,0x64,0x69,0x6f,0x53,0x50,0x49,
-0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x77,0x6c,0x6d,0x6f,0x64,0x65,0x22,0x20,
-0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x53,0x50,0x49,0x5f,0x4e,0x53,0x53,0x22,0x20,
-0x2f,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x74,0x65,0x78,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x66,0x67,
-0x63,0x62,0x22,0x3e,0x53,0x50,0x49,0x5f,0x4e,0x53,0x53,0x3c,0x2f,0x74,0x65,0x78,
-0x74,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x61,0x62,0x65,
-0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x77,
-0x68,0x65,0x65,0x6c,0x74,0x69,0x63,0x6b,0x22,0x3e,0x43,0x41,0x4e,0x20,0x4d,0x6f,
-0x64,0x65,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,
-0x74,0x79,0x70,0x65,0x3d,0x27,0x72,0x61,0x64,0x69,0x6f,0x27,0x20,0x73,0x74,0x79,
-0x6c,0x65,0x3d,0x27,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,
-0x30,0x70,0x78,0x27,0x20,0x69,0x64,0x3d,0x27,0x72,0x61,0x64,0x69,0x6f,0x43,0x41,
-0x52,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x6d,0x6f,0x64,0x65,
-0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x43,0x41,0x52,0x22,0x20,0x2f,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,
-0x65,0x78,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x66,0x67,0x63,0x62,
-0x22,0x3e,0x43,0x41,0x52,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,
-0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x72,0x61,0x64,0x69,0x6f,0x27,0x20,0x73,0x74,
-0x79,0x6c,0x65,0x3d,0x27,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,
-0x3a,0x33,0x70,0x78,0x27,0x20,0x69,0x64,0x3d,0x27,0x72,0x61,0x64,0x69,0x6f,0x4a,
-0x31,0x39,0x33,0x39,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x63,0x61,0x6e,0x6d,
-0x6f,0x64,0x65,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x4a,0x31,0x39,0x33,
-0x39,0x22,0x20,0x2f,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x74,0x65,0x78,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x63,0x66,0x67,0x63,0x62,0x22,0x3e,0x4a,0x31,0x39,0x33,0x39,0x3c,0x2f,0x74,0x65,
-0x78,0x74,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,
-0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x22,0x20,0x69,0x64,
-0x3d,0x22,0x63,0x61,0x6e,0x4d,0x65,0x73,0x67,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-0x22,0x63,0x61,0x6e,0x4d,0x65,0x73,0x67,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
-0x22,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x2f,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,
-0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x22,0x20,0x69,0x64,0x3d,
-0x22,0x67,0x65,0x61,0x72,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x67,0x65,0x61,
-0x72,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x64,0x69,0x73,0x70,0x6c,0x61,
-0x79,0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x2f,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x2f,0x66,0x6f,0x72,0x6d,0x3e,0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,
-0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x73,0x61,0x76,0x65,0x5f,0x62,0x75,0x74,0x74,
-0x6f,0x6e,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,
-0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x62,0x75,0x74,
-0x74,0x6f,0x6e,0x27,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x27,0x53,0x41,0x56,0x45,
-0x27,0x20,0x69,0x64,0x3d,0x22,0x73,0x61,0x76,0x65,0x22,0x2f,0x3e,0x3c,0x2f,0x70,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x2f,0x6e,0x61,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x3c,0x21,0x2d,0x2d,0x20,0x2f,0x63,
-0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x20,0x2d,0x2d,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,
-0x78,0x74,0x2f,0x6a,0x61,0x76,0x61,0x73,0x63,0x72,0x69,0x70,0x74,0x22,0x3e,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x61,0x76,
-0x65,0x2e,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x20,0x3d,0x20,0x66,0x75,0x6e,0x63,
-0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x74,0x72,0x3b,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x76,0x61,0x72,0x20,0x61,0x72,0x72,0x61,0x79,0x4c,0x69,0x73,0x74,0x20,
-0x3d,0x20,0x5b,0x5d,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x76,0x61,0x72,0x20,
-0x69,0x3d,0x31,0x3b,0x20,0x69,0x3c,0x6f,0x54,0x61,0x62,0x6c,0x65,0x2e,0x72,0x6f,
-0x77,0x73,0x2e,0x6c,0x65,0x6e,0x67,0x74,0x68,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x7b,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x64,0x61,0x74,0x65,0x20,0x3d,
-0x20,0x7b,0x7d,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x74,0x72,0x20,0x3d,0x20,0x6f,
-0x54,0x61,0x62,0x6c,0x65,0x2e,0x72,0x6f,0x77,0x73,0x5b,0x69,0x5d,0x3b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x64,0x61,0x74,0x65,0x2e,0x4d,0x65,0x73,0x67,0x49,0x44,0x20,
-0x3d,0x20,0x74,0x72,0x2e,0x63,0x68,0x69,0x6c,0x64,0x4e,0x6f,0x64,0x65,0x73,0x5b,
-0x30,0x5d,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x64,0x61,0x74,0x65,0x2e,0x53,0x74,0x61,0x72,0x74,0x42,0x69,0x74,
-0x20,0x3d,0x20,0x74,0x72,0x2e,0x63,0x68,0x69,0x6c,0x64,0x4e,0x6f,0x64,0x65,0x73,
-0x5b,0x31,0x5d,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x3b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x64,0x61,0x74,0x65,0x2e,0x4c,0x65,0x6e,0x67,0x74,0x68,0x20,
-0x3d,0x20,0x74,0x72,0x2e,0x63,0x68,0x69,0x6c,0x64,0x4e,0x6f,0x64,0x65,0x73,0x5b,
-0x32,0x5d,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x64,0x61,0x74,0x65,0x2e,0x45,0x6e,0x64,0x69,0x61,0x6e,0x20,0x3d,
-0x20,0x74,0x72,0x2e,0x63,0x68,0x69,0x6c,0x64,0x4e,0x6f,0x64,0x65,0x73,0x5b,0x33,
-0x5d,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x3b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x64,0x61,0x74,0x65,0x2e,0x53,0x69,0x67,0x6e,0x20,0x3d,0x20,0x74,0x72,
-0x2e,0x63,0x68,0x69,0x6c,0x64,0x4e,0x6f,0x64,0x65,0x73,0x5b,0x34,0x5d,0x2e,0x69,
-0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
-0x61,0x74,0x65,0x2e,0x46,0x61,0x63,0x74,0x6f,0x72,0x20,0x3d,0x20,0x74,0x72,0x2e,
-0x63,0x68,0x69,0x6c,0x64,0x4e,0x6f,0x64,0x65,0x73,0x5b,0x35,0x5d,0x2e,0x69,0x6e,
-0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x61,
-0x74,0x65,0x2e,0x4f,0x66,0x66,0x73,0x65,0x74,0x20,0x3d,0x20,0x74,0x72,0x2e,0x63,
-0x68,0x69,0x6c,0x64,0x4e,0x6f,0x64,0x65,0x73,0x5b,0x36,0x5d,0x2e,0x69,0x6e,0x6e,
-0x65,0x72,0x54,0x65,0x78,0x74,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x61,0x74,
-0x65,0x2e,0x55,0x6e,0x69,0x74,0x20,0x3d,0x20,0x74,0x72,0x2e,0x63,0x68,0x69,0x6c,
-0x64,0x4e,0x6f,0x64,0x65,0x73,0x5b,0x37,0x5d,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,
-0x65,0x78,0x74,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x61,0x74,0x65,0x2e,0x53,
-0x6f,0x75,0x72,0x63,0x65,0x20,0x3d,0x20,0x74,0x72,0x2e,0x63,0x68,0x69,0x6c,0x64,
-0x4e,0x6f,0x64,0x65,0x73,0x5b,0x38,0x5d,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,
-0x78,0x74,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x61,0x72,0x72,0x61,0x79,0x4c,0x69,
-0x73,0x74,0x2e,0x70,0x75,0x73,0x68,0x28,0x64,0x61,0x74,0x65,0x29,0x3b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x7d,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x6a,0x73,0x6f,0x6e,0x53,0x74,0x72,0x69,0x6e,
-0x67,0x20,0x3d,0x20,0x4a,0x53,0x4f,0x4e,0x2e,0x73,0x74,0x72,0x69,0x6e,0x67,0x69,
-0x66,0x79,0x28,0x61,0x72,0x72,0x61,0x79,0x4c,0x69,0x73,0x74,0x29,0x3b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,
-0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x63,0x61,0x6e,0x4d,0x65,0x73,0x67,
-0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6a,0x73,0x6f,0x6e,0x53,
-0x74,0x72,0x69,0x6e,0x67,0x3b,0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x64,0x61,
-0x74,0x65,0x20,0x3d,0x20,0x7b,0x7d,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x61,0x74,0x65,0x2e,0x50,
-0x20,0x3d,0x20,0x67,0x54,0x61,0x62,0x6c,0x65,0x2e,0x72,0x6f,0x77,0x73,0x5b,0x31,
-0x5d,0x2e,0x63,0x68,0x69,0x6c,0x64,0x4e,0x6f,0x64,0x65,0x73,0x5b,0x31,0x5d,0x2e,
-0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x61,0x74,0x65,
-0x2e,0x52,0x20,0x3d,0x20,0x67,0x54,0x61,0x62,0x6c,0x65,0x2e,0x72,0x6f,0x77,0x73,
-0x5b,0x32,0x5d,0x2e,0x63,0x68,0x69,0x6c,0x64,0x4e,0x6f,0x64,0x65,0x73,0x5b,0x31,
-0x5d,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x3b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x61,
-0x74,0x65,0x2e,0x4e,0x20,0x3d,0x20,0x67,0x54,0x61,0x62,0x6c,0x65,0x2e,0x72,0x6f,
-0x77,0x73,0x5b,0x33,0x5d,0x2e,0x63,0x68,0x69,0x6c,0x64,0x4e,0x6f,0x64,0x65,0x73,
-0x5b,0x31,0x5d,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x3b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x64,0x61,0x74,0x65,0x2e,0x44,0x20,0x3d,0x20,0x67,0x54,0x61,0x62,0x6c,0x65,0x2e,
-0x72,0x6f,0x77,0x73,0x5b,0x34,0x5d,0x2e,0x63,0x68,0x69,0x6c,0x64,0x4e,0x6f,0x64,
-0x65,0x73,0x5b,0x31,0x5d,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x3b,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x6a,0x73,0x6f,0x6e,0x53,0x74,0x72,0x69,0x6e,0x67,0x20,0x3d,0x20,0x4a,
-0x53,0x4f,0x4e,0x2e,0x73,0x74,0x72,0x69,0x6e,0x67,0x69,0x66,0x79,0x28,0x64,0x61,
-0x74,0x65,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,
-0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x27,0x67,
-0x65,0x61,0x72,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6a,0x73,
-0x6f,0x6e,0x53,0x74,0x72,0x69,0x6e,0x67,0x3b,0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x4f,0x64,0x6f,
-0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x73,0x75,0x62,0x6d,0x69,0x74,0x28,0x29,0x3b,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,
-0x0a,0x09,0x09,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x09,0x09,
-0x0d,0x0a,0x09,0x09,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x20,0x74,0x79,0x70,0x65,
-0x3d,0x27,0x74,0x65,0x78,0x74,0x2f,0x6a,0x61,0x76,0x61,0x73,0x63,0x72,0x69,0x70,
-0x74,0x27,0x20,0x73,0x72,0x63,0x3d,0x27,0x4f,0x64,0x6f,0x43,0x6f,0x6e,0x66,0x69,
-0x67,0x2e,0x6a,0x73,0x27,0x3e,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,
-0x0a,0x09,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x2f,0x68,0x74,0x6d,
-0x6c,0x3e,};
+0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,
+/* "Cache-Control: no-cache
+" (25 bytes) */
+0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x3a,0x20,0x6e,
+0x6f,0x2d,0x63,0x61,0x63,0x68,0x65,0x0d,0x0a,
+/* "ETag: "18f6a6ac"
+" (18 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x31,0x38,0x66,0x36,0x61,0x36,0x61,0x63,0x22,
+0x0d,0x0a,
+/* "Content-Encoding: gzip
+" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x45,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,
+0x3a,0x20,0x67,0x7a,0x69,0x70,0x0d,0x0a,
+/* "Vary: Accept-Encoding
+" (23 bytes) */
+0x56,0x61,0x72,0x79,0x3a,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2d,0x45,0x6e,0x63,
+0x6f,0x64,0x69,0x6e,0x67,0x0d,0x0a,
+/* "Content-Length: 2018
+
+" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x32,0x30,0x31,0x38,0x0d,0x0a,0x0d,0x0a,
+/* gzip file data (2018 bytes) */
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xc5,0x5a,0x6d,0x6f,0xe2,0x38,
+0x10,0xfe,0xdc,0x93,0xee,0x3f,0x78,0x73,0x27,0x01,0xaa,0x48,0xa0,0xf4,0xed,0x4a,
+0x40,0xda,0xa5,0xdc,0x6d,0xef,0xb6,0xb4,0x2a,0xec,0x9d,0x4e,0x55,0x55,0x99,0xc4,
+0x04,0xb7,0x21,0x41,0x8e,0x29,0xdb,0x5b,0xed,0x7f,0xbf,0xb1,0x9d,0xf0,0x92,0x60,
+0x08,0x2c,0xbd,0x8b,0x54,0x35,0xb1,0x67,0xe6,0x19,0xcf,0x78,0xc6,0x1e,0x1b,0xfb,
+0xdd,0xe5,0x4d,0xab,0xf7,0xf7,0x6d,0x1b,0x0d,0xf9,0xc8,0x6f,0xfe,0xf8,0x83,0x1d,
+0xff,0x3f,0xb0,0x87,0x04,0xbb,0xe2,0xe5,0xc0,0x1e,0x11,0x8e,0x91,0x33,0xc4,0x2c,
+0x22,0xbc,0x61,0x7c,0xee,0xfd,0x5a,0x3e,0x37,0x90,0xa5,0xfa,0x38,0xe5,0x3e,0x69,
+0xde,0x8c,0x49,0x70,0xd7,0xfb,0xc3,0xb6,0xd4,0xa7,0xec,0xf1,0x69,0xf0,0x8c,0x18,
+0xf1,0x1b,0x46,0xc4,0x5f,0x7d,0x12,0x0d,0x09,0xe1,0x06,0xe2,0xaf,0x63,0xd2,0x30,
+0x38,0xf9,0xc2,0x2d,0x27,0x8a,0x0c,0x34,0x64,0x64,0xd0,0x30,0xe0,0xd5,0x92,0x54,
+0xa6,0x6c,0x8c,0x65,0x47,0x0e,0xa3,0x63,0x2e,0xdf,0x07,0x93,0xc0,0xe1,0x34,0x0c,
+0xd0,0xcf,0x45,0xea,0x96,0xd0,0x57,0x10,0xcc,0x27,0x2c,0x40,0x6e,0xe8,0x4c,0x46,
+0x24,0xe0,0xa6,0x47,0x78,0xdb,0x27,0xe2,0xf5,0xc3,0xeb,0x95,0x2b,0x88,0xea,0xe8,
+0x5b,0x7d,0x89,0xf5,0xc6,0x0d,0x5b,0x61,0x30,0xa0,0x5e,0x0b,0xfb,0x7e,0x1f,0x3b,
+0xcf,0xc5,0x10,0x24,0xfd,0xf8,0x03,0x5a,0x78,0xe8,0x00,0x15,0x75,0x32,0x43,0x73,
+0xea,0x8f,0x42,0x97,0x94,0x4a,0x68,0x23,0x89,0xe9,0x0c,0x89,0xf3,0x4c,0x5c,0xd4,
+0x40,0x85,0xf8,0xb5,0x50,0xdf,0x06,0xca,0xc1,0xc1,0x46,0xac,0x84,0x26,0x07,0xd8,
+0xf2,0xd7,0x0b,0x66,0xe8,0x29,0xf2,0x49,0xe0,0xf1,0x61,0xa3,0x92,0x22,0x1d,0x84,
+0x0c,0x15,0x15,0xc5,0x11,0xa2,0x01,0x92,0x38,0xd7,0x24,0xf2,0x4a,0x29,0x5b,0x89,
+0x27,0x91,0x72,0x78,0x98,0x92,0xf2,0x2d,0x8b,0x18,0xf6,0x70,0xdf,0x27,0xa0,0xa4,
+0x6e,0x44,0x86,0xa2,0x30,0x4a,0xf5,0x2c,0x33,0xef,0x87,0xee,0x2b,0xf0,0x2a,0x12,
+0x93,0x7f,0x08,0x5d,0x4a,0xa2,0xfb,0xca,0x43,0x8a,0x76,0x3a,0xa4,0x80,0x51,0x4c,
+0xf4,0x42,0xef,0x1a,0x8a,0xd5,0x64,0xe1,0x34,0x32,0x55,0x63,0xc6,0xeb,0x89,0x3b,
+0x66,0x5c,0xcd,0x9c,0x4c,0xe2,0xc1,0xae,0x7b,0x17,0x4e,0x8b,0x69,0xa5,0xa5,0x11,
+0x10,0xf1,0x23,0xa2,0x63,0x74,0x89,0x4f,0x38,0xd1,0xf2,0x66,0xec,0x99,0x35,0x0a,
+0x06,0x83,0x54,0x56,0x18,0xab,0xbf,0xa2,0x5d,0xba,0x15,0x00,0xd1,0xd3,0xb2,0x53,
+0x57,0x69,0x27,0x69,0x9f,0x97,0xe8,0xee,0x9f,0x1e,0xb4,0x16,0x98,0xdb,0xea,0x1e,
+0x3f,0x98,0x0e,0xf1,0xfd,0xe8,0xbe,0xff,0x60,0xd2,0x20,0x20,0xec,0x63,0xef,0xfa,
+0x13,0x68,0x63,0xd8,0x2e,0x7d,0x41,0x4e,0x18,0x70,0x70,0x36,0x71,0x29,0x17,0x5e,
+0x6c,0x14,0x38,0x9b,0x90,0x42,0xd3,0x40,0x87,0x4b,0x40,0xf7,0xcf,0x0f,0xd0,0x62,
+0xd8,0x16,0xf0,0x34,0x8d,0xfa,0x6a,0x50,0x31,0xc6,0x3e,0x90,0x55,0x37,0xdb,0x4e,
+0x7a,0x09,0xc8,0xb1,0x86,0x7c,0x95,0xb9,0x56,0xda,0xdb,0xdb,0x38,0x83,0x3d,0xfd,
+0x0c,0xf6,0xe2,0x19,0xec,0x6d,0x98,0xc1,0x58,0xe7,0xbc,0xd8,0x71,0x1e,0xc1,0x6c,
+0xa5,0x2b,0xbc,0x15,0x6e,0xa8,0x6e,0xed,0x06,0x21,0x1e,0x7c,0xb0,0xde,0x01,0x3a,
+0x6b,0x7e,0x13,0x09,0x37,0x95,0x76,0x93,0xf8,0xf8,0x2a,0x5a,0x0f,0xb6,0x4e,0x04,
+0x31,0x4f,0xde,0xf8,0x17,0x61,0x9c,0x89,0x5d,0x64,0xa3,0xda,0x4a,0x93,0x49,0xc9,
+0x0c,0x25,0x39,0x82,0x06,0x11,0x61,0x5c,0x68,0x9b,0x0d,0xff,0xba,0x86,0xdb,0x7d,
+0xac,0x08,0x7e,0x16,0x33,0xb7,0xc0,0xec,0xc5,0xca,0x2a,0x6a,0x41,0x99,0xdf,0x19,
+0x7a,0xdb,0xc7,0xa8,0xd5,0x0c,0x6a,0x55,0x83,0x5a,0xdd,0x23,0xea,0x51,0x06,0xf5,
+0x48,0x83,0x7a,0xb4,0x47,0xd4,0x5a,0x06,0xb5,0xa6,0x41,0xad,0xed,0x11,0xf5,0x38,
+0x83,0x7a,0xac,0x41,0x3d,0xde,0x23,0xea,0x49,0x06,0xf5,0x44,0x83,0x7a,0xb2,0x47,
+0xd4,0xd3,0x0c,0xea,0xa9,0x06,0xf5,0x74,0x8f,0xa8,0x67,0x19,0xd4,0x33,0x0d,0xea,
+0xd9,0x1e,0x51,0xcf,0x33,0xa8,0xe7,0x1a,0xd4,0xf3,0xef,0x45,0x55,0xf9,0x70,0x29,
+0x1d,0x2e,0xac,0xfa,0x6f,0x97,0x11,0x81,0x44,0x65,0xb0,0x39,0x5a,0x26,0xa3,0x95,
+0xab,0x4a,0x98,0x54,0xcf,0xb6,0xe6,0x9b,0x6d,0xdb,0x4a,0xb6,0xfe,0xb6,0xe0,0x51,
+0x7b,0x71,0x39,0x74,0x1f,0x47,0x11,0x6c,0xd6,0xc1,0x02,0x98,0x82,0x5d,0x0c,0xd9,
+0xb5,0xd4,0x07,0x0a,0x4f,0xe2,0x66,0x55,0x41,0x10,0xb6,0xd8,0xf5,0xa8,0x9a,0x8c,
+0xa6,0xd8,0x91,0x1e,0x28,0xa2,0xea,0x0a,0x82,0x47,0x59,0x47,0x18,0xcd,0xeb,0x76,
+0xe7,0x33,0xa8,0x53,0x4d,0x24,0x5a,0xaa,0x3b,0xf9,0x9c,0xf8,0x4b,0xbc,0x42,0xdb,
+0x04,0x5c,0xd4,0x1f,0x4b,0x9d,0x94,0x93,0x91,0xd1,0xb4,0x71,0x5c,0x71,0x74,0x38,
+0x0c,0xb7,0x35,0xf0,0xcc,0x48,0x14,0x3c,0x46,0x86,0xf4,0x51,0x94,0x2f,0x33,0x61,
+0x07,0x9d,0xde,0xdd,0xd5,0x2d,0xea,0x12,0xce,0x69,0xe0,0xd9,0x16,0x06,0x7f,0xfb,
+0x34,0x27,0xd4,0x67,0x98,0x67,0xf9,0x91,0x04,0x35,0x52,0x75,0xca,0x84,0x61,0x31,
+0x65,0xb6,0x84,0x13,0x65,0xce,0x06,0x34,0x44,0xa3,0x32,0x86,0xe9,0xf8,0x42,0xe6,
+0xb8,0xc0,0xf6,0x5d,0xb0,0x6d,0x3e,0xcc,0x3f,0x48,0x20,0x26,0x2c,0x80,0xcd,0xe8,
+0x6e,0x16,0xbd,0x24,0x2f,0xd4,0x21,0x57,0xc1,0x20,0xcc,0x89,0xa7,0x18,0x90,0xe0,
+0xd8,0x12,0x6a,0xc8,0xf9,0x38,0xba,0xb0,0xac,0x10,0x2a,0x5c,0xc6,0x9f,0x4d,0x06,
+0x13,0x10,0x94,0x87,0x38,0x8d,0x4c,0x1a,0x5a,0x24,0xb0,0x7c,0xcc,0x49,0xc4,0xad,
+0x8d,0x3a,0xc4,0x35,0x72,0xad,0x56,0x41,0xd7,0x38,0x98,0x60,0x3f,0xa5,0x89,0x6d,
+0x4d,0xfc,0x38,0xa0,0x64,0x2e,0xc9,0xc4,0x56,0x9c,0x79,0xca,0x53,0x86,0xc7,0x42,
+0x6c,0x3a,0x61,0xa5,0xe2,0xcd,0x09,0x5d,0x16,0x8e,0xa3,0x72,0x12,0x72,0xab,0xb7,
+0xd1,0x10,0x7f,0xcd,0xf7,0x0e,0x81,0x3c,0x87,0x51,0xac,0x21,0xb2,0xa3,0x31,0x0e,
+0x9a,0xed,0x51,0x9f,0xb8,0x2e,0x54,0x95,0x53,0xd2,0x87,0x39,0xf9,0x42,0x18,0x24,
+0x09,0xd1,0x11,0x07,0x64,0x46,0xd2,0x3c,0x38,0x33,0x5d,0x01,0x7e,0x49,0xab,0xe5,
+0x0c,0x3c,0xad,0x4e,0x8b,0x83,0x1e,0x78,0x71,0x2e,0x68,0xbd,0xef,0x20,0x28,0x10,
+0x22,0xec,0x11,0x74,0x0d,0x65,0x6f,0x62,0xa5,0x95,0x12,0x64,0x6e,0x46,0xd4,0x6d,
+0x24,0x89,0x13,0xc9,0xe3,0x85,0x86,0x21,0xea,0x7e,0x8f,0x85,0x93,0xc0,0x2d,0x3b,
+0xa1,0x1f,0xb2,0x8b,0x9f,0x88,0x7c,0xea,0x06,0xea,0x87,0x0c,0xd4,0x97,0xad,0x0d,
+0xe3,0x27,0x2c,0x9f,0xa4,0xb5,0x61,0x54,0xc1,0xc1,0xb0,0x56,0x8c,0x61,0x3b,0x0b,
+0x13,0xb6,0x61,0x54,0x0c,0x34,0xa5,0x30,0x15,0x1a,0xc6,0x59,0xa5,0x32,0xfe,0xa2,
+0x1b,0x8b,0xd2,0x26,0x4e,0xa8,0x7a,0x02,0xb6,0xa6,0x37,0x16,0x91,0xc0,0x55,0x15,
+0x9c,0xa8,0x95,0xae,0x2e,0x6d,0x8b,0x0f,0xf3,0xb3,0x9e,0x9d,0x08,0xce,0x2e,0xc7,
+0x8c,0xf7,0x29,0xdf,0x85,0xf7,0x93,0x5c,0x3a,0x76,0xe1,0x6c,0x07,0x2e,0xc5,0xc1,
+0x4e,0xfa,0x52,0x6f,0x27,0xbe,0x5f,0x21,0xc5,0x85,0x6c,0x17,0xce,0x9b,0xc1,0x20,
+0x22,0x3b,0xd9,0xe7,0x73,0xb0,0x9b,0x5d,0xbb,0xe1,0x84,0x39,0x64,0x03,0x27,0x74,
+0xb3,0xf5,0xdd,0x1b,0xe7,0x59,0xbc,0xa0,0xaf,0x11,0xb1,0x86,0x02,0x7a,0x45,0x2c,
+0xe9,0x7a,0x69,0x30,0x9e,0xf0,0xf8,0x80,0xaf,0x3f,0xe1,0x3c,0x0c,0x0c,0x14,0x06,
+0x2d,0x9f,0x3a,0xcf,0x0d,0x63,0x76,0x4a,0x32,0x8b,0x44,0x39,0xfe,0x8b,0x23,0x98,
+0xcc,0xf5,0x01,0x64,0xb6,0x72,0x44,0xff,0x21,0x17,0xd5,0x53,0xf8,0x34,0x60,0xa7,
+0xe6,0x4f,0x80,0xe4,0xd0,0xb0,0x76,0x02,0x5b,0x3c,0x59,0xd9,0x06,0xaf,0xac,0xc7,
+0xeb,0xb3,0xa6,0xf8,0x4b,0x9f,0x0a,0xac,0x48,0x38,0xde,0x1b,0x25,0x9c,0xa3,0x59,
+0xc2,0xa9,0x9e,0xfc,0xa7,0x09,0x47,0xcd,0xd0,0xdf,0x08,0xde,0x29,0x96,0xfe,0x14,
+0xa6,0xfd,0xdf,0x27,0x76,0x32,0x68,0x9b,0xbb,0xcd,0x5b,0x90,0xe7,0x8a,0x37,0xfd,
+0x5e,0x5e,0xf4,0x5b,0x39,0x6c,0xa4,0x04,0xde,0xed,0x5b,0x60,0x67,0xdf,0x02,0x2f,
+0xf7,0x21,0xf0,0xbb,0x92,0xc3,0xa6,0xf8,0x59,0xb9,0xe4,0x7f,0xc4,0xcc,0x9d,0x62,
+0x96,0x63,0xbd,0x1f,0x84,0x6c,0x24,0xa2,0xaf,0x30,0x3b,0xe4,0x2f,0xa0,0x11,0xe1,
+0xc3,0x10,0x9a,0x6e,0x6f,0xba,0xbd,0x02,0xc2,0xb2,0xfc,0x5a,0x20,0x30,0x1d,0x8f,
+0x16,0xd6,0x0d,0x77,0xbc,0xc9,0xb8,0x3e,0xee,0x93,0x59,0x05,0x22,0x3f,0x1e,0xa7,
+0x43,0x42,0x7c,0x0e,0x49,0xc8,0x68,0xde,0x5e,0x75,0xa4,0xde,0x17,0xb0,0xc7,0x13,
+0x7d,0x9b,0xa4,0x2d,0x64,0xb4,0x02,0xc3,0x2e,0x0d,0x0b,0x71,0x0a,0x29,0x8c,0x30,
+0xf3,0x68,0x50,0xf6,0xc9,0x80,0x5f,0x40,0xe4,0x17,0xe4,0x40,0x25,0xc9,0x5f,0x02,
+0xae,0x80,0x02,0x3c,0x12,0x09,0x4e,0x5e,0x3d,0xcc,0x92,0xd9,0x5f,0x1f,0xdb,0xed,
+0x4f,0xbd,0xab,0xd6,0x1f,0xea,0x3e,0x65,0xfd,0x34,0x21,0x5f,0xf8,0x82,0xf9,0x9d,
+0xbe,0xd1,0x9c,0xb1,0x83,0x63,0xa1,0x77,0x3f,0xda,0xd7,0x96,0xb4,0xef,0xde,0x5e,
+0x69,0x74,0x87,0x9e,0xc7,0x4e,0xb7,0xbb,0x9b,0xe6,0x31,0xf3,0x46,0xbd,0x6d,0x6b,
+0xfc,0x86,0xee,0x97,0xdb,0xd5,0x37,0x76,0x7f,0xeb,0xfd,0x5d,0x62,0xc0,0xf8,0x2e,
+0x68,0x66,0x41,0xe8,0xda,0xcd,0x7a,0xc0,0xf8,0x76,0x1e,0xff,0xbd,0xfa,0x4b,0xed,
+0x17,0x9d,0xca,0xb2,0x73,0x37,0xa5,0x25,0xeb,0xf7,0x3a,0x7c,0x71,0x4b,0x21,0x24,
+0x19,0x72,0x39,0x8f,0xaf,0x25,0x8c,0xb9,0xd2,0xea,0x33,0x5e,0xde,0x5d,0x1a,0x8d,
+0x7d,0xfc,0x7a,0x11,0x84,0x01,0x31,0xac,0xed,0xc5,0x8b,0xe3,0xf6,0x44,0xb6,0x7a,
+0xdf,0x46,0xb0,0x6d,0x89,0xc4,0xb7,0x3e,0xab,0x0a,0x94,0x08,0xbf,0x90,0xc7,0x78,
+0x9b,0xb4,0x7e,0xce,0xc7,0x6a,0xc6,0xe6,0x4d,0x76,0x56,0xca,0xcb,0xea,0xab,0x10,
+0xfb,0xab,0xd0,0x7d,0xff,0x67,0xbb,0x30,0x13,0x0f,0x3a,0xea,0xed,0xab,0xcb,0xdd,
+0xb6,0x05,0x95,0x61,0xaa,0x3d,0x4d,0xab,0xbe,0xed,0x77,0xe5,0x32,0xb2,0x66,0x47,
+0x4f,0xa8,0x5c,0x5e,0x20,0x59,0x20,0x56,0xc7,0x58,0x8b,0xd7,0xcc,0x4f,0xf8,0x05,
+0xab,0xd6,0xf4,0xd0,0x85,0xda,0x66,0x18,0x38,0x62,0xd3,0x88,0x1a,0x28,0x39,0xa2,
+0x2b,0x96,0xb4,0x37,0x05,0x9a,0x43,0x45,0xcc,0x18,0x7e,0xfd,0x44,0x23,0x0e,0x52,
+0xee,0x1f,0xea,0x9a,0x0b,0x35,0x41,0x49,0x1b,0xd5,0x3a,0xa2,0x76,0x7c,0x66,0xb7,
+0x70,0x1a,0x07,0xad,0x87,0x87,0x25,0xcd,0x05,0x9b,0xe0,0x74,0x31,0x17,0x07,0x84,
+0x5f,0xbf,0x69,0xee,0xc3,0xe4,0x35,0xc6,0x82,0xdc,0x7b,0xfa,0xa0,0xa1,0x14,0x92,
+0x4c,0x55,0x3e,0xaa,0x93,0x50,0x67,0x48,0x7d,0xb7,0x03,0xa1,0x28,0x4e,0x0f,0xd5,
+0x91,0x67,0x0f,0x2c,0xb7,0x8e,0x5d,0xd6,0x90,0x1f,0x28,0xcf,0x08,0xa8,0xe6,0x14,
+0xa0,0x0a,0xc9,0x0c,0xfb,0x51,0x4e,0x76,0x55,0x4d,0x66,0xd8,0x6b,0x79,0xd5,0x87,
+0x92,0x32,0xc3,0x7c,0x9c,0x93,0x59,0xd5,0x95,0x19,0xf6,0x93,0x9c,0xec,0xaa,0xb8,
+0xcc,0xb0,0x9f,0xe6,0x64,0x17,0x15,0x66,0x86,0xf9,0x2c,0xef,0xb8,0x65,0x99,0x99,
+0x61,0x3f,0xdf,0xcc,0x3e,0x9b,0xe2,0xe6,0x78,0x12,0x0d,0x8b,0x42,0x5a,0x29,0xdf,
+0xcd,0xab,0xfa,0x29,0x41,0x18,0x74,0x39,0x83,0x3a,0x06,0xb0,0x7f,0xef,0xde,0x74,
+0xcc,0x48,0x7e,0xd1,0xc1,0x6b,0x71,0x26,0x79,0x95,0x3c,0xdd,0x79,0x78,0x21,0xce,
+0xc3,0x85,0x92,0x29,0xb3,0x11,0x88,0x9d,0x63,0xd4,0x57,0xe5,0xc3,0x4d,0x31,0x24,
+0xed,0x73,0x3b,0xbf,0x9f,0x95,0x31,0x04,0xb3,0x39,0xff,0xdc,0x96,0x12,0xee,0x52,
+0x12,0x8e,0xb6,0x96,0xd0,0x49,0x49,0xa8,0x6d,0x2d,0xe1,0x32,0x25,0xe1,0x78,0x1b,
+0x09,0xeb,0x5c,0xa5,0xf3,0xba,0xd6,0x4b,0x62,0x45,0xcb,0xef,0xa2,0xf9,0xd6,0x3c,
+0x9a,0xf4,0x47,0x94,0x67,0x7e,0x17,0x91,0xb9,0xaa,0x38,0x58,0xf8,0x9d,0x50,0xbc,
+0x48,0xa5,0x72,0x3e,0x6c,0x4a,0x98,0xb3,0xb8,0xeb,0x7f,0x8a,0x44,0xb5,0xb3,0x78,
+0xdb,0x11,0x17,0x35,0xb6,0x25,0x7f,0xfa,0xf4,0x2f,0x45,0xb6,0x90,0xf2,0x12,0x25,
+0x00,0x00,};
 
 static const unsigned int dummy_align__UserCfg_shtml = 6;
 static const unsigned char data__UserCfg_shtml[] = {
@@ -2469,325 +1728,111 @@ static const unsigned char data__UserCfg_shtml[] = {
 0x2f,0x55,0x73,0x65,0x72,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x00,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
+/* "HTTP/1.0 200 OK
 " (17 bytes) */
 0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
-/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
+/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
 " (63 bytes) */
 0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
 0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
 0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
 0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-/* "Content-type: text/html
-Expires: Fri, 10 Apr 2008 14:00:00 GMT
-Pragma: no-cache
-
-" (85 bytes) */
+/* "Content-type: text/html
+" (25 bytes) */
 0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
-0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,0x45,0x78,0x70,0x69,0x72,0x65,0x73,
-0x3a,0x20,0x46,0x72,0x69,0x2c,0x20,0x31,0x30,0x20,0x41,0x70,0x72,0x20,0x32,0x30,
-0x30,0x38,0x20,0x31,0x34,0x3a,0x30,0x30,0x3a,0x30,0x30,0x20,0x47,0x4d,0x54,0x0d,
-0x0a,0x50,0x72,0x61,0x67,0x6d,0x61,0x3a,0x20,0x6e,0x6f,0x2d,0x63,0x61,0x63,0x68,
-0x65,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (4749 bytes) */
-0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0d,
-0x0a,0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a,0x09,0x3c,0x68,0x65,0x61,0x64,0x3e,
-0x0d,0x0a,0x09,0x09,0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,
-0x74,0x3d,0x22,0x55,0x54,0x46,0x2d,0x38,0x22,0x20,0x2f,0x3e,0x0d,0x0a,0x09,0x09,
-0x3c,0x74,0x69,0x74,0x6c,0x65,0x3e,0x4f,0x70,0x65,0x6e,0x52,0x54,0x4b,0x3c,0x2f,
-0x74,0x69,0x74,0x6c,0x65,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x6c,0x69,0x6e,0x6b,0x20,
-0x72,0x65,0x6c,0x3d,0x22,0x73,0x74,0x79,0x6c,0x65,0x73,0x68,0x65,0x65,0x74,0x22,
-0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x2f,0x63,0x73,0x73,0x22,
-0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x63,0x73,0x73,0x2f,0x73,0x74,0x79,0x6c,0x65,
-0x2e,0x63,0x73,0x73,0x22,0x20,0x2f,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x73,0x63,0x72,
-0x69,0x70,0x74,0x3e,0x0d,0x0a,0x09,0x09,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-0x20,0x24,0x28,0x69,0x64,0x29,0x20,0x7b,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,
-0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,
-0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x69,0x64,0x29,0x3b,0x20,0x7d,0x3b,0x0d,
-0x0a,0x09,0x09,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x55,0x73,0x65,0x72,
-0x43,0x6f,0x6e,0x66,0x69,0x67,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x28,0x6f,
-0x29,0x20,0x7b,0x0d,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,
-0x74,0x55,0x73,0x65,0x72,0x50,0x61,0x63,0x6b,0x65,0x74,0x54,0x79,0x70,0x65,0x27,
-0x29,0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x55,0x73,0x65,0x72,0x50,0x61,0x63,
-0x6b,0x65,0x74,0x54,0x79,0x70,0x65,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,
-0x3d,0x20,0x6f,0x2e,0x75,0x73,0x65,0x72,0x50,0x61,0x63,0x6b,0x65,0x74,0x54,0x79,
-0x70,0x65,0x3b,0x0d,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,
-0x74,0x55,0x73,0x65,0x72,0x50,0x61,0x63,0x6b,0x65,0x74,0x52,0x61,0x74,0x65,0x27,
-0x29,0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x55,0x73,0x65,0x72,0x50,0x61,0x63,
-0x6b,0x65,0x74,0x52,0x61,0x74,0x65,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,
-0x3d,0x20,0x6f,0x2e,0x75,0x73,0x65,0x72,0x50,0x61,0x63,0x6b,0x65,0x74,0x52,0x61,
-0x74,0x65,0x3b,0x0d,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,
-0x74,0x4c,0x65,0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x78,0x27,0x29,0x29,0x20,0x24,
-0x28,0x27,0x74,0x78,0x74,0x4c,0x65,0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x78,0x27,
-0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x6c,0x65,0x76,0x65,
-0x72,0x41,0x72,0x6d,0x42,0x78,0x3b,0x0d,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x24,
-0x28,0x27,0x74,0x78,0x74,0x4c,0x65,0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x79,0x27,
-0x29,0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x4c,0x65,0x76,0x65,0x72,0x41,0x72,
-0x6d,0x42,0x79,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,
-0x6c,0x65,0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x79,0x3b,0x0d,0x0a,0x09,0x09,0x69,
-0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x4c,0x65,0x76,0x65,0x72,0x41,0x72,
-0x6d,0x42,0x7a,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x4c,0x65,0x76,
-0x65,0x72,0x41,0x72,0x6d,0x42,0x7a,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,
-0x3d,0x20,0x6f,0x2e,0x6c,0x65,0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x7a,0x3b,0x0d,
-0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x50,0x6f,0x69,
-0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x78,0x27,0x29,
-0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,
-0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x78,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,
-0x65,0x20,0x3d,0x20,0x6f,0x2e,0x70,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,
-0x65,0x72,0x65,0x73,0x74,0x42,0x78,0x3b,0x0d,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,
-0x24,0x28,0x27,0x74,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,
-0x65,0x72,0x65,0x73,0x74,0x42,0x79,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x74,0x78,
-0x74,0x50,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,
-0x42,0x79,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x70,
-0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x79,
-0x3b,0x0d,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x50,
-0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x7a,
-0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x4f,
-0x66,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x7a,0x27,0x29,0x2e,0x76,0x61,
-0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x70,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,
-0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x7a,0x3b,0x0d,0x0a,0x09,0x09,0x69,0x66,
-0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,
-0x52,0x62,0x76,0x78,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x52,0x6f,
-0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,0x62,0x76,0x78,0x27,0x29,0x2e,0x76,0x61,0x6c,
-0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,
-0x62,0x76,0x78,0x3b,0x0d,0x0a,0x09,0x09,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,
-0x78,0x74,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,0x62,0x76,0x79,0x27,0x29,
-0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,
-0x52,0x62,0x76,0x79,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,
-0x2e,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,0x62,0x76,0x79,0x3b,0x0d,0x0a,
-0x09,0x09,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x52,0x6f,0x74,0x61,
-0x74,0x69,0x6f,0x6e,0x52,0x62,0x76,0x7a,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x74,
-0x78,0x74,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,0x62,0x76,0x7a,0x27,0x29,
-0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x72,0x6f,0x74,0x61,0x74,
-0x69,0x6f,0x6e,0x52,0x62,0x76,0x7a,0x3b,0x0d,0x0a,0x09,0x09,0x7d,0x3b,0x0d,0x0a,
-0x09,0x09,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x09,0x3c,0x2f,
-0x68,0x65,0x61,0x64,0x3e,0x0d,0x0a,0x09,0x3c,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,
-0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,
-0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x64,
-0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x22,0x3e,
-0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x68,0x65,0x61,0x64,0x65,0x72,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x68,0x65,0x61,0x64,0x65,0x72,
-0x22,0x3e,0x20,0x20,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x68,0x31,0x20,0x63,
-0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x68,0x65,0x61,0x64,0x65,
-0x72,0x5f,0x74,0x69,0x74,0x6c,0x65,0x22,0x3e,0x4d,0x45,0x4e,0x55,0x3c,0x2f,0x68,
-0x31,0x3e,0x20,0x20,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,0x68,0x65,0x61,0x64,
-0x65,0x72,0x3e,0x20,0x20,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x75,0x6c,0x20,0x63,
-0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x62,0x6f,0x64,0x79,0x22,
-0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,
-0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x4e,0x74,0x72,0x69,0x70,0x43,0x66,0x67,0x2e,
-0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,
-0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0d,0x0a,
-0x09,0x09,0x09,0x09,0x09,0x09,0x4e,0x54,0x52,0x49,0x50,0x20,0x53,0x65,0x74,0x74,
-0x69,0x6e,0x67,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x09,0x09,
-0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,
-0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,
-0x3d,0x22,0x55,0x73,0x65,0x72,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,
-0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x20,0x69,0x73,0x2d,0x61,0x63,0x74,0x69,0x76,0x65,
-0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x55,0x73,0x65,0x72,0x20,0x43,
-0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x61,0x3e,
-0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,
-0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,
-0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x4f,0x64,0x6f,0x43,0x66,
-0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,
-0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x4f,0x64,0x6f,0x20,0x43,0x6f,0x6e,0x66,
-0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,
-0x69,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,
-0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x45,0x74,0x68,0x43,0x66,0x67,0x2e,0x73,
-0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,
-0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0d,0x0a,0x09,
-0x09,0x09,0x09,0x09,0x09,0x45,0x74,0x68,0x65,0x72,0x6e,0x65,0x74,0x20,0x53,0x65,
-0x74,0x74,0x69,0x6e,0x67,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,
-0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,
-0x65,0x66,0x3d,0x22,0x44,0x65,0x76,0x69,0x63,0x65,0x49,0x6e,0x66,0x6f,0x2e,0x73,
-0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,
-0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0d,0x0a,0x09,
-0x09,0x09,0x09,0x09,0x09,0x44,0x65,0x76,0x69,0x63,0x65,0x20,0x49,0x6e,0x66,0x6f,
-0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,
-0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,
-0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x68,
-0x74,0x74,0x70,0x73,0x3a,0x2f,0x2f,0x6f,0x70,0x65,0x6e,0x72,0x74,0x6b,0x2e,0x72,
-0x65,0x61,0x64,0x74,0x68,0x65,0x64,0x6f,0x63,0x73,0x2e,0x69,0x6f,0x2f,0x65,0x6e,
-0x2f,0x6c,0x61,0x74,0x65,0x73,0x74,0x2f,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,
-0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x4f,0x70,0x65,0x6e,0x52,0x54,0x4b,
-0x33,0x33,0x30,0x20,0x4d,0x61,0x6e,0x75,0x61,0x6c,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,
-0x6c,0x69,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,0x75,0x6c,0x3e,0x0d,0x0a,
-0x09,0x09,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x64,
-0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x74,0x65,0x6e,
-0x74,0x2d,0x77,0x72,0x61,0x70,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x64,
-0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x74,0x65,0x6e,
-0x74,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x68,0x65,0x61,0x64,0x65,
-0x72,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x64,0x72,0x6f,0x70,0x73,
-0x2d,0x68,0x65,0x61,0x64,0x65,0x72,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,
-0x09,0x3c,0x68,0x31,0x3e,0x41,0x63,0x65,0x69,0x6e,0x6e,0x61,0x20,0x4f,0x70,0x65,
-0x6e,0x52,0x54,0x4b,0x20,0x3c,0x73,0x70,0x61,0x6e,0x3e,0x45,0x6d,0x62,0x65,0x64,
-0x64,0x65,0x64,0x20,0x77,0x65,0x62,0x73,0x65,0x72,0x76,0x65,0x72,0x3c,0x2f,0x73,
-0x70,0x61,0x6e,0x3e,0x3c,0x2f,0x68,0x31,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,
-0x3c,0x2f,0x68,0x65,0x61,0x64,0x65,0x72,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,
-0x3c,0x6e,0x61,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x64,0x72,
-0x6f,0x70,0x73,0x2d,0x63,0x66,0x67,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,
-0x66,0x67,0x74,0x69,0x74,0x6c,0x65,0x22,0x3e,0x55,0x73,0x65,0x72,0x20,0x50,0x61,
-0x72,0x61,0x6d,0x65,0x74,0x65,0x72,0x73,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x66,0x6f,0x72,0x6d,0x20,0x69,0x64,
-0x3d,0x27,0x55,0x73,0x65,0x72,0x43,0x6f,0x6e,0x66,0x69,0x67,0x27,0x20,0x6d,0x65,
-0x74,0x68,0x6f,0x64,0x3d,0x27,0x50,0x4f,0x53,0x54,0x27,0x20,0x61,0x63,0x74,0x69,
-0x6f,0x6e,0x3d,0x27,0x55,0x73,0x65,0x72,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x63,
-0x67,0x69,0x27,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x09,0x3c,0x70,0x3e,0x3c,
-0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,
-0x65,0x6c,0x5f,0x75,0x73,0x65,0x72,0x22,0x20,0x66,0x6f,0x72,0x3d,0x27,0x74,0x78,
-0x74,0x55,0x73,0x65,0x72,0x50,0x61,0x63,0x6b,0x65,0x74,0x54,0x79,0x70,0x65,0x27,
-0x3e,0x55,0x73,0x65,0x72,0x5f,0x50,0x61,0x63,0x6b,0x65,0x74,0x5f,0x54,0x79,0x70,
-0x65,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,
-0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,
-0x27,0x74,0x78,0x74,0x55,0x73,0x65,0x72,0x50,0x61,0x63,0x6b,0x65,0x74,0x54,0x79,
-0x70,0x65,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x75,0x73,0x65,0x72,0x50,0x61,
-0x63,0x6b,0x65,0x74,0x54,0x79,0x70,0x65,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,
-0x31,0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x75,0x73,0x65,0x72,0x22,
-0x20,0x66,0x6f,0x72,0x3d,0x27,0x74,0x78,0x74,0x55,0x73,0x65,0x72,0x50,0x61,0x63,
-0x6b,0x65,0x74,0x52,0x61,0x74,0x65,0x27,0x3e,0x55,0x73,0x65,0x72,0x5f,0x50,0x61,
-0x63,0x6b,0x65,0x74,0x5f,0x52,0x61,0x74,0x65,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,
-0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,
-0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x74,0x78,0x74,0x55,0x73,0x65,0x72,
-0x50,0x61,0x63,0x6b,0x65,0x74,0x52,0x61,0x74,0x65,0x27,0x20,0x6e,0x61,0x6d,0x65,
-0x3d,0x27,0x75,0x73,0x65,0x72,0x50,0x61,0x63,0x6b,0x65,0x74,0x52,0x61,0x74,0x65,
-0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,
-0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,
-0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,
-0x65,0x6c,0x5f,0x75,0x73,0x65,0x72,0x22,0x20,0x66,0x6f,0x72,0x3d,0x27,0x74,0x78,
-0x74,0x4c,0x65,0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x78,0x27,0x3e,0x4c,0x65,0x76,
-0x65,0x6c,0x5f,0x41,0x72,0x6d,0x5f,0x42,0x78,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,
-0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,
-0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x74,0x78,0x74,0x4c,0x65,0x76,0x65,
-0x72,0x41,0x72,0x6d,0x42,0x78,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x6c,0x65,
-0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x78,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,
-0x31,0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x75,0x73,0x65,0x72,0x22,
-0x20,0x66,0x6f,0x72,0x3d,0x27,0x74,0x78,0x74,0x4c,0x65,0x76,0x65,0x72,0x41,0x72,
-0x6d,0x42,0x79,0x27,0x3e,0x4c,0x65,0x76,0x65,0x6c,0x5f,0x41,0x72,0x6d,0x5f,0x42,
-0x79,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,
-0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,
-0x27,0x74,0x78,0x74,0x4c,0x65,0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x79,0x27,0x20,
-0x6e,0x61,0x6d,0x65,0x3d,0x27,0x6c,0x65,0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x79,
-0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,
-0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,
-0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,
-0x65,0x6c,0x5f,0x75,0x73,0x65,0x72,0x22,0x20,0x66,0x6f,0x72,0x3d,0x27,0x74,0x78,
-0x74,0x4c,0x65,0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x7a,0x27,0x3e,0x4c,0x65,0x76,
-0x65,0x6c,0x5f,0x41,0x72,0x6d,0x5f,0x42,0x7a,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,
-0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,
-0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x74,0x78,0x74,0x4c,0x65,0x76,0x65,
-0x72,0x41,0x72,0x6d,0x42,0x7a,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x6c,0x65,
-0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x7a,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,
-0x31,0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x75,0x73,0x65,0x72,0x22,
-0x20,0x66,0x6f,0x72,0x3d,0x27,0x74,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x4f,0x66,
-0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x78,0x27,0x3e,0x50,0x6f,0x69,0x6e,
-0x74,0x5f,0x4f,0x66,0x5f,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x5f,0x42,0x78,
-0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,
-0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,
-0x74,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,
-0x73,0x74,0x42,0x78,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x70,0x6f,0x69,0x6e,
-0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x78,0x27,0x20,0x73,
-0x69,0x7a,0x65,0x3d,0x27,0x31,0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,
-0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,
-0x75,0x73,0x65,0x72,0x22,0x20,0x66,0x6f,0x72,0x3d,0x27,0x74,0x78,0x74,0x50,0x6f,
-0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x79,0x27,
-0x3e,0x50,0x6f,0x69,0x6e,0x74,0x5f,0x4f,0x66,0x5f,0x49,0x6e,0x74,0x65,0x72,0x65,
-0x73,0x74,0x5f,0x42,0x79,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,
-0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,
-0x20,0x69,0x64,0x3d,0x27,0x74,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,
-0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x79,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-0x27,0x70,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,
-0x42,0x79,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x36,0x27,0x20,0x2f,0x3e,
-0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,
-0x61,0x62,0x65,0x6c,0x5f,0x75,0x73,0x65,0x72,0x22,0x20,0x66,0x6f,0x72,0x3d,0x27,
-0x74,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,
-0x73,0x74,0x42,0x7a,0x27,0x3e,0x50,0x6f,0x69,0x6e,0x74,0x5f,0x4f,0x66,0x5f,0x49,
-0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x5f,0x42,0x7a,0x3a,0x3c,0x2f,0x6c,0x61,0x62,
-0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,
-0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x74,0x78,0x74,0x50,0x6f,0x69,
-0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x7a,0x27,0x20,
-0x6e,0x61,0x6d,0x65,0x3d,0x27,0x70,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,
-0x65,0x72,0x65,0x73,0x74,0x42,0x7a,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,
-0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x75,0x73,0x65,0x72,0x22,0x20,
-0x66,0x6f,0x72,0x3d,0x27,0x74,0x78,0x74,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,
-0x52,0x62,0x76,0x78,0x27,0x3e,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x52,
-0x62,0x76,0x78,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,
-0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,
-0x64,0x3d,0x27,0x74,0x78,0x74,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,0x62,
-0x76,0x78,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x72,0x6f,0x74,0x61,0x74,0x69,
-0x6f,0x6e,0x52,0x62,0x76,0x78,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x36,
-0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x75,0x73,0x65,0x72,0x22,0x20,0x66,
-0x6f,0x72,0x3d,0x27,0x74,0x78,0x74,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,
-0x62,0x76,0x79,0x27,0x3e,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x52,0x62,
-0x76,0x79,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,
-0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,
-0x3d,0x27,0x74,0x78,0x74,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,0x62,0x76,
-0x79,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,
-0x6e,0x52,0x62,0x76,0x79,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x36,0x27,
-0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,
-0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x75,0x73,0x65,0x72,0x22,0x20,0x66,0x6f,
-0x72,0x3d,0x27,0x74,0x78,0x74,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,0x62,
-0x76,0x7a,0x27,0x3e,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x52,0x62,0x76,
-0x7a,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,
-0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,
-0x27,0x74,0x78,0x74,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,0x62,0x76,0x7a,
-0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,
-0x52,0x62,0x76,0x7a,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x36,0x27,0x20,
-0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x73,0x61,0x76,0x65,0x5f,0x62,0x75,
-0x74,0x74,0x6f,0x6e,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x74,0x79,0x70,
-0x65,0x3d,0x27,0x73,0x75,0x62,0x6d,0x69,0x74,0x27,0x20,0x76,0x61,0x6c,0x75,0x65,
-0x3d,0x27,0x53,0x41,0x56,0x45,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x66,0x6f,0x72,0x6d,0x3e,0x0d,
-0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x2f,0x6e,0x61,0x76,0x3e,0x0d,0x0a,0x09,0x09,
-0x09,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x2f,0x64,
-0x69,0x76,0x3e,0x3c,0x21,0x2d,0x2d,0x20,0x2f,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,
-0x2d,0x77,0x72,0x61,0x70,0x20,0x2d,0x2d,0x3e,0x0d,0x0a,0x09,0x09,0x3c,0x2f,0x64,
-0x69,0x76,0x3e,0x3c,0x21,0x2d,0x2d,0x20,0x2f,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,
-0x65,0x72,0x20,0x2d,0x2d,0x3e,0x0d,0x0a,0x09,0x09,0x0d,0x0a,0x09,0x09,0x3c,0x73,
-0x63,0x72,0x69,0x70,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,
-0x2f,0x6a,0x61,0x76,0x61,0x73,0x63,0x72,0x69,0x70,0x74,0x27,0x20,0x73,0x72,0x63,
-0x3d,0x27,0x55,0x73,0x65,0x72,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x6a,0x73,0x27,
-0x3e,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x09,0x3c,0x2f,0x62,
-0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,};
+0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,
+/* "Cache-Control: no-cache
+" (25 bytes) */
+0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x3a,0x20,0x6e,
+0x6f,0x2d,0x63,0x61,0x63,0x68,0x65,0x0d,0x0a,
+/* "ETag: "8ffd7c03"
+" (18 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x38,0x66,0x66,0x64,0x37,0x63,0x30,0x33,0x22,
+0x0d,0x0a,
+/* "Content-Encoding: gzip
+" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x45,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,
+0x3a,0x20,0x67,0x7a,0x69,0x70,0x0d,0x0a,
+/* "Vary: Accept-Encoding
+" (23 bytes) */
+0x56,0x61,0x72,0x79,0x3a,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2d,0x45,0x6e,0x63,
+0x6f,0x64,0x69,0x6e,0x67,0x0d,0x0a,
+/* "Content-Length: 1102
+
+" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x31,0x31,0x30,0x32,0x0d,0x0a,0x0d,0x0a,
+/* gzip file data (1102 bytes) */
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xb5,0x58,0x51,0x6f,0xe2,0x38,
+0x10,0x7e,0xee,0x49,0xf7,0x1f,0xbc,0xd1,0x4a,0x69,0x1f,0x20,0x57,0xad,0xb4,0x5a,
+0x6d,0x43,0xa4,0xb6,0xcb,0x49,0xd5,0xdd,0x16,0x44,0xe9,0x49,0xf7,0x14,0x99,0x64,
+0x02,0xde,0x06,0x27,0xb2,0x1d,0xb6,0xce,0xe9,0xfe,0xfb,0xd9,0x4e,0x02,0x09,0x49,
+0x5a,0xe8,0x15,0x5e,0xb0,0x67,0xc6,0xdf,0x7c,0x63,0x3c,0xe3,0x31,0xee,0x87,0x6f,
+0x93,0xdb,0xf9,0xdf,0xd3,0x31,0x5a,0x89,0x75,0xec,0xfd,0xfa,0x8b,0x5b,0x7e,0x9f,
+0xb9,0x2b,0xc0,0xa1,0x1e,0x9c,0xb9,0x6b,0x10,0x18,0x05,0x2b,0xcc,0x38,0x88,0x91,
+0xf5,0x38,0xff,0x7d,0xf0,0xc5,0x42,0x4e,0xa1,0x13,0x44,0xc4,0xe0,0x4d,0x52,0xa0,
+0xb3,0xf9,0x1f,0xae,0x53,0x4c,0x8d,0x26,0x26,0xf4,0x09,0x31,0x88,0x47,0x16,0x17,
+0x32,0x06,0xbe,0x02,0x10,0x16,0x12,0x32,0x85,0x91,0x25,0xe0,0x59,0x38,0x01,0xe7,
+0x16,0x5a,0x31,0x88,0x46,0x96,0x1a,0x3a,0xc6,0x6a,0x68,0x84,0x25,0x36,0x0f,0x18,
+0x49,0x85,0x19,0x47,0x19,0x0d,0x04,0x49,0x28,0xfa,0x78,0x4e,0xc2,0x0b,0xf4,0x8f,
+0x02,0x16,0x19,0xa3,0x28,0x4c,0x82,0x6c,0x0d,0x54,0x0c,0x97,0x20,0xc6,0x31,0xe8,
+0xe1,0x8d,0xbc,0x0b,0xb5,0xd1,0x15,0xfa,0xf7,0xaa,0xb1,0xf4,0x91,0x03,0xbb,0x4d,
+0x68,0x44,0x96,0xb7,0x38,0x8e,0x17,0x38,0x78,0x3a,0x4f,0x14,0x94,0xb6,0x21,0x11,
+0x3a,0xff,0x78,0x6e,0x8b,0x67,0xa1,0x8d,0xa6,0x4a,0x05,0x62,0xae,0x98,0xda,0x17,
+0x17,0xa8,0x5b,0x3e,0xdc,0xe0,0x38,0x03,0x34,0x42,0xc9,0x30,0x6b,0xa8,0xae,0xfa,
+0xf0,0x66,0x58,0x74,0xe2,0x15,0xf2,0x4e,0x3c,0xad,0xda,0xc3,0xfb,0x13,0x36,0xc0,
+0xae,0xd9,0xfa,0xe6,0x79,0x87,0x55,0x97,0xd5,0x70,0xe2,0xad,0xb8,0x0f,0x43,0x76,
+0x60,0xc8,0x6e,0x0c,0xd9,0x87,0x91,0x77,0x60,0xe4,0xdd,0x18,0xf9,0x1e,0xc6,0x34,
+0x21,0x54,0x4c,0xa2,0x3b,0x2a,0x80,0x01,0x17,0xf5,0x90,0x3a,0x54,0x35,0xc4,0x74,
+0x5f,0xfb,0x0a,0xb0,0xec,0x07,0x96,0x2f,0x02,0xcb,0x57,0x80,0xf3,0x7e,0xe0,0xfc,
+0x45,0xe0,0xfd,0xad,0x98,0x25,0x02,0xeb,0x43,0x3a,0x5b,0x6c,0x6a,0xbb,0xd0,0x94,
+0xd6,0xe0,0x58,0x4d,0xd1,0x8f,0x24,0x3b,0x91,0x64,0x1f,0x92,0xec,0x47,0xca,0x3b,
+0x91,0xf2,0x3e,0xa4,0x22,0xba,0x22,0xfd,0x5c,0x67,0x97,0xc6,0xae,0x53,0x15,0x15,
+0x77,0x91,0x84,0xb2,0xc8,0xf2,0x90,0x6c,0x50,0x10,0x63,0xce,0x55,0x19,0x48,0xa8,
+0xc0,0x84,0x02,0xb3,0x8c,0xaa,0xa1,0x53,0xa9,0x9d,0x95,0xe2,0xa2,0x36,0x01,0xab,
+0xab,0xfc,0x42,0x64,0x79,0x08,0x15,0x36,0xca,0xe8,0xb2,0xc3,0xc0,0x37,0x15,0xca,
+0xf2,0xbe,0x8f,0xef,0x1f,0x15,0x9d,0xcb,0xad,0x7d,0xc1,0x0d,0xd8,0x4e,0x90,0xc5,
+0x8d,0xf5,0x9a,0x71,0x45,0x40,0x57,0xb7,0x86,0x92,0x08,0x58,0x5b,0x9e,0x8b,0xcb,
+0x7a,0x76,0x2f,0x54,0xc8,0xb7,0xd1,0x72,0xc8,0x75,0x39,0xb5,0x5a,0xa6,0xbe,0x2e,
+0x8e,0x5b,0xb0,0xb3,0xfb,0xf9,0xec,0x6e,0x8a,0x1e,0x40,0x08,0x42,0x97,0xae,0x83,
+0x3d,0xd7,0x89,0xc9,0x81,0xae,0x4c,0x55,0x7b,0xc5,0x13,0x22,0x7c,0x80,0x55,0x11,
+0xdc,0xc0,0xce,0xa7,0x5e,0x87,0x8a,0x72,0x98,0x31,0xf3,0xc3,0x1d,0xe9,0x78,0x12,
+0x26,0x87,0x47,0xa8,0x8c,0xff,0x97,0xb3,0xb1,0x58,0x1d,0xee,0x4c,0x19,0x03,0xa3,
+0x20,0xde,0xb8,0xa3,0xdf,0x60,0x43,0x02,0xb8,0xa3,0x51,0x72,0xa0,0xbf,0x62,0x01,
+0xd2,0x2b,0x8e,0x74,0xb5,0x12,0x22,0xe5,0x5f,0x1d,0x27,0x51,0xf7,0x27,0x13,0x4f,
+0x43,0xa6,0x8e,0xa0,0x22,0xaf,0x6e,0x35,0x3e,0x24,0x89,0x03,0xd4,0x89,0xd5,0x15,
+0xc0,0x85,0xf3,0xfa,0x06,0x17,0x37,0xf0,0xa7,0x4f,0xbf,0xa1,0xef,0x98,0x66,0x38,
+0xde,0x63,0xe2,0x3a,0x59,0x5c,0x26,0x95,0xa3,0xb2,0xaa,0x9d,0x5f,0x3a,0xf7,0xd4,
+0xed,0x39,0xf8,0xc9,0x70,0xba,0xcd,0xb3,0xb6,0x7e,0x97,0x01,0xcd,0x1c,0x0c,0x92,
+0x90,0x25,0x29,0x1f,0x54,0x69,0x58,0xf1,0x52,0x59,0xe8,0x5d,0x07,0x40,0x28,0xc5,
+0xa8,0xe4,0x88,0x5c,0x9e,0x62,0xea,0x8d,0xd7,0x0b,0x08,0x43,0x08,0xd1,0x4f,0x58,
+0xa8,0xb3,0xa8,0xee,0x08,0x55,0x2a,0xb4,0xc2,0xa4,0x65,0xe5,0xa5,0xca,0xca,0x6a,
+0x4e,0xf1,0x66,0xdf,0x65,0x10,0x2d,0xb5,0x3f,0xd4,0xf3,0x69,0x04,0x11,0x2d,0xcb,
+0xfc,0x37,0xc7,0x7f,0x8a,0x19,0x56,0xcd,0x0d,0x30,0x5e,0x6d,0x4a,0x2f,0x48,0x94,
+0xb0,0x35,0x22,0xe1,0xc8,0xde,0x75,0x11,0x36,0x52,0x6b,0x57,0x89,0x92,0x4d,0x27,
+0x0f,0x73,0x1b,0x61,0xd3,0x66,0xd4,0x2d,0x86,0xc1,0x92,0xd8,0xbb,0xad,0x48,0x3d,
+0x37,0xc6,0x0b,0xd8,0x96,0x15,0x33,0xf1,0xf5,0x75,0x6f,0x21,0x85,0x3f,0xea,0xe8,
+0x33,0x0c,0x4f,0xbf,0x10,0xf8,0x5a,0xf2,0x55,0xfd,0xa6,0x7a,0x99,0xe7,0x12,0x9a,
+0x66,0xa2,0xe8,0xa7,0x6c,0xdd,0x4f,0xd9,0x86,0x5e,0x1b,0x02,0x51,0x15,0xe3,0xc8,
+0xce,0xf6,0xa4,0x9c,0xe4,0x4a,0x7a,0xf9,0xd9,0x56,0xdd,0x96,0xeb,0xa4,0x2f,0xc5,
+0x7e,0x1c,0x6f,0xd3,0xcf,0x34,0x78,0x6b,0xc9,0x51,0xbc,0x0d,0x44,0x8b,0x77,0x21,
+0x7d,0x67,0xde,0xb5,0xde,0xc9,0xd3,0xe3,0xd8,0x57,0x13,0xff,0xe6,0xf9,0x00,0xbe,
+0xb5,0xa5,0x25,0xd7,0xb8,0x26,0x39,0x15,0x4f,0xd9,0xe0,0x29,0x8f,0xe1,0x29,0x5b,
+0x3c,0xe5,0xe9,0x78,0xe6,0x0d,0x9e,0xf9,0x31,0x3c,0xf3,0x16,0xcf,0xfc,0xdd,0x79,
+0xb6,0x1b,0x4c,0xcf,0x88,0xfc,0x49,0xe4,0x57,0xc2,0xc3,0x8e,0x41,0x1b,0xa9,0x64,
+0x9f,0xb6,0x15,0x27,0x0e,0x42,0x76,0x06,0x21,0xdf,0x10,0x84,0xec,0x0b,0x42,0x9e,
+0x3c,0x88,0xbc,0x33,0x88,0xfc,0x0d,0x41,0xe4,0x7d,0x41,0xbc,0xff,0x71,0x6a,0x74,
+0xea,0x5e,0x35,0xf3,0xf5,0xf4,0x00,0xe2,0x8d,0xd5,0x25,0x67,0xd6,0x90,0x9d,0x8e,
+0xae,0x6c,0xd2,0x95,0xc7,0xd1,0x95,0x1d,0x74,0xe5,0x29,0xe9,0xe6,0x4d,0xba,0xf9,
+0x71,0x74,0xf3,0x0e,0xba,0xc7,0x1d,0x06,0xdd,0x4c,0x28,0x5c,0x8b,0xe3,0x0d,0xf8,
+0x8b,0x4c,0x88,0x84,0xbe,0xd4,0x7c,0x54,0x21,0x16,0xe4,0xca,0x10,0xcb,0x65,0x25,
+0x57,0x9e,0x2d,0xd6,0x44,0xb1,0x35,0x2f,0xa9,0x91,0xfd,0x70,0xfd,0xd7,0xf8,0x00,
+0x1e,0xaf,0xf5,0x2b,0x8e,0x6e,0x58,0x76,0x5d,0x94,0x6a,0x9b,0xb6,0x8d,0xe0,0xae,
+0xfd,0x33,0x43,0xf7,0xc3,0x60,0x80,0x9c,0x7a,0xfb,0x87,0x06,0x83,0xe2,0x69,0xb6,
+0xa7,0x37,0x4f,0xb3,0x4a,0x59,0xfb,0x87,0xa6,0xb6,0xe9,0xce,0x0f,0xbc,0xc1,0x85,
+0x54,0x6d,0x2b,0x0b,0x1a,0xdd,0xd0,0x0f,0x6e,0x7b,0xcd,0xe7,0x60,0xf9,0x0a,0x54,
+0x5d,0x9e,0xfe,0xd7,0xe9,0x3f,0x23,0xa1,0x94,0xff,0x8d,0x12,0x00,0x00,};
 
 
 
@@ -2797,6 +1842,10 @@ data__css_style_css,
 data__css_style_css + 16,
 sizeof(data__css_style_css) - 16,
 1,
+0x03,
+0x3c22f032UL,
+"\"20c26e4e\"",
+file_NULL,
 }};
 
 const struct fsdata_file file__images_aceinna_png[] = { {
@@ -2805,6 +1854,10 @@ data__images_aceinna_png,
 data__images_aceinna_png + 20,
 sizeof(data__images_aceinna_png) - 20,
 1,
+0x02,
+0xece0eb8fUL,
+"\"1e1b29f8\"",
+file_NULL,
 }};
 
 const struct fsdata_file file__DeviceInfo_shtml[] = { {
@@ -2813,6 +1866,10 @@ data__DeviceInfo_shtml,
 data__DeviceInfo_shtml + 20,
 sizeof(data__DeviceInfo_shtml) - 20,
 1,
+0x00,
+0xa361bb62UL,
+NULL,
+file_NULL,
 }};
 
 const struct fsdata_file file__EthCfg_shtml[] = { {
@@ -2821,6 +1878,10 @@ data__EthCfg_shtml,
 data__EthCfg_shtml + 16,
 sizeof(data__EthCfg_shtml) - 16,
 1,
+0x03,
+0xbca52457UL,
+"\"d749f091\"",
+file_NULL,
 }};
 
 const struct fsdata_file file__NtripCfg_shtml[] = { {
@@ -2829,6 +1890,10 @@ data__NtripCfg_shtml,
 data__NtripCfg_shtml + 16,
 sizeof(data__NtripCfg_shtml) - 16,
 1,
+0x00,
+0x025faeedUL,
+NULL,
+file_NULL,
 }};
 
 const struct fsdata_file file__OdoCfg_shtml[] = { {
@@ -2837,6 +1902,10 @@ data__OdoCfg_shtml,
 data__OdoCfg_shtml + 16,
 sizeof(data__OdoCfg_shtml) - 16,
 1,
+0x03,
+0x6a1ed1c2UL,
+"\"18f6a6ac\"",
+file_NULL,
 }};
 
 const struct fsdata_file file__UserCfg_shtml[] = { {
@@ -2845,11 +1914,34 @@ data__UserCfg_shtml,
 data__UserCfg_shtml + 16,
 sizeof(data__UserCfg_shtml) - 16,
 1,
+0x03,
+0x14f41febUL,
+"\"8ffd7c03\"",
+file_NULL,
 }};
 
 #define FS_ROOT file__UserCfg_shtml
 #define FS_NUMFILES 7
 
+#define FS_INDEX_SIZE 16
+static const struct fsdata_file * const FS_INDEX[FS_INDEX_SIZE] = {
+file_NULL,
+file_NULL,
+file__css_style_css,
+file__DeviceInfo_shtml,
+file__OdoCfg_shtml,
+file_NULL,
+file_NULL,
+file__EthCfg_shtml,
+file_NULL,
+file_NULL,
+file_NULL,
+file__UserCfg_shtml,
+file_NULL,
+file__NtripCfg_shtml,
+file_NULL,
+file__images_aceinna_png,
+};
 
 
 #else   // BASE_STATION
@@ -2869,453 +1961,160 @@ static const unsigned char data__css_style_css[] = {
 0x2f,0x63,0x73,0x73,0x2f,0x73,0x74,0x79,0x6c,0x65,0x2e,0x63,0x73,0x73,0x00,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
+/* "HTTP/1.0 200 OK
 " (17 bytes) */
 0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
-/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
+/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
 " (63 bytes) */
 0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
 0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
 0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
 0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-/* "Content-type: text/css
-
-" (26 bytes) */
+/* "Content-type: text/css
+" (24 bytes) */
 0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
-0x78,0x74,0x2f,0x63,0x73,0x73,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (6882 bytes) */
-0x40,0x69,0x6d,0x70,0x6f,0x72,0x74,0x20,0x75,0x72,0x6c,0x28,0x68,0x74,0x74,0x70,
-0x3a,0x2f,0x2f,0x66,0x6f,0x6e,0x74,0x73,0x2e,0x67,0x6f,0x6f,0x67,0x6c,0x65,0x61,
-0x70,0x69,0x73,0x2e,0x63,0x6f,0x6d,0x2f,0x63,0x73,0x73,0x3f,0x66,0x61,0x6d,0x69,
-0x6c,0x79,0x3d,0x52,0x61,0x6c,0x65,0x77,0x61,0x79,0x3a,0x32,0x30,0x30,0x2c,0x34,
-0x30,0x30,0x2c,0x37,0x30,0x30,0x2c,0x38,0x30,0x30,0x29,0x3b,0x0d,0x0a,0x0d,0x0a,
-0x2f,0x2a,0x20,0x43,0x53,0x53,0x20,0x72,0x65,0x73,0x65,0x74,0x20,0x2a,0x2f,0x0d,
-0x0a,0x62,0x6f,0x64,0x79,0x2c,0x64,0x69,0x76,0x2c,0x64,0x6c,0x2c,0x64,0x74,0x2c,
-0x64,0x64,0x2c,0x75,0x6c,0x2c,0x6f,0x6c,0x2c,0x6c,0x69,0x2c,0x68,0x31,0x2c,0x68,
-0x32,0x2c,0x68,0x33,0x2c,0x68,0x34,0x2c,0x68,0x35,0x2c,0x68,0x36,0x2c,0x70,0x72,
-0x65,0x2c,0x66,0x6f,0x72,0x6d,0x2c,0x66,0x69,0x65,0x6c,0x64,0x73,0x65,0x74,0x2c,
-0x69,0x6e,0x70,0x75,0x74,0x2c,0x74,0x65,0x78,0x74,0x61,0x72,0x65,0x61,0x2c,0x70,
-0x2c,0x62,0x6c,0x6f,0x63,0x6b,0x71,0x75,0x6f,0x74,0x65,0x2c,0x74,0x68,0x2c,0x74,
-0x64,0x20,0x7b,0x20,0x0d,0x0a,0x09,0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x30,0x3b,
-0x0d,0x0a,0x09,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x30,0x3b,0x0d,0x0a,0x7d,
-0x0d,0x0a,0x68,0x74,0x6d,0x6c,0x2c,0x62,0x6f,0x64,0x79,0x20,0x7b,0x0d,0x0a,0x09,
-0x6d,0x61,0x72,0x67,0x69,0x6e,0x3a,0x30,0x3b,0x0d,0x0a,0x09,0x70,0x61,0x64,0x64,
-0x69,0x6e,0x67,0x3a,0x30,0x3b,0x0d,0x0a,0x09,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,
-0x20,0x31,0x30,0x30,0x25,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x74,0x61,0x62,0x6c,0x65,
-0x20,0x7b,0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x63,0x6f,0x6c,0x6c,
-0x61,0x70,0x73,0x65,0x3a,0x63,0x6f,0x6c,0x6c,0x61,0x70,0x73,0x65,0x3b,0x0d,0x0a,
-0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,0x67,0x3a,
-0x30,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x66,0x69,0x65,0x6c,0x64,0x73,0x65,0x74,0x2c,
-0x69,0x6d,0x67,0x20,0x7b,0x20,0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,
-0x30,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x61,0x64,0x64,0x72,0x65,0x73,0x73,0x2c,0x63,
-0x61,0x70,0x74,0x69,0x6f,0x6e,0x2c,0x63,0x69,0x74,0x65,0x2c,0x63,0x6f,0x64,0x65,
-0x2c,0x64,0x66,0x6e,0x2c,0x74,0x68,0x2c,0x76,0x61,0x72,0x20,0x7b,0x0d,0x0a,0x09,
-0x66,0x6f,0x6e,0x74,0x2d,0x73,0x74,0x79,0x6c,0x65,0x3a,0x6e,0x6f,0x72,0x6d,0x61,
-0x6c,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,
-0x3a,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x6f,0x6c,0x2c,
-0x75,0x6c,0x20,0x7b,0x0d,0x0a,0x09,0x6c,0x69,0x73,0x74,0x2d,0x73,0x74,0x79,0x6c,
-0x65,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x63,0x61,0x70,0x74,
-0x69,0x6f,0x6e,0x2c,0x74,0x68,0x20,0x7b,0x0d,0x0a,0x09,0x74,0x65,0x78,0x74,0x2d,
-0x61,0x6c,0x69,0x67,0x6e,0x3a,0x6c,0x65,0x66,0x74,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,
-0x68,0x31,0x2c,0x68,0x32,0x2c,0x68,0x33,0x2c,0x68,0x34,0x2c,0x68,0x35,0x2c,0x68,
-0x36,0x20,0x7b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,
-0x31,0x30,0x30,0x25,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,
-0x67,0x68,0x74,0x3a,0x6e,0x6f,0x72,0x6d,0x61,0x6c,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,
-0x0d,0x0a,0x61,0x62,0x62,0x72,0x2c,0x61,0x63,0x72,0x6f,0x6e,0x79,0x6d,0x20,0x7b,
-0x20,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x30,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x61,
-0x72,0x74,0x69,0x63,0x6c,0x65,0x2c,0x20,0x61,0x73,0x69,0x64,0x65,0x2c,0x20,0x64,
-0x65,0x74,0x61,0x69,0x6c,0x73,0x2c,0x20,0x66,0x69,0x67,0x63,0x61,0x70,0x74,0x69,
-0x6f,0x6e,0x2c,0x20,0x66,0x69,0x67,0x75,0x72,0x65,0x2c,0x0d,0x0a,0x66,0x6f,0x6f,
-0x74,0x65,0x72,0x2c,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x2c,0x20,0x68,0x67,0x72,
-0x6f,0x75,0x70,0x2c,0x20,0x6d,0x65,0x6e,0x75,0x2c,0x20,0x6e,0x61,0x76,0x2c,0x20,
-0x73,0x65,0x63,0x74,0x69,0x6f,0x6e,0x20,0x7b,0x0d,0x0a,0x09,0x64,0x69,0x73,0x70,
-0x6c,0x61,0x79,0x3a,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,
-0x2f,0x2a,0x20,0x47,0x65,0x6e,0x65,0x72,0x61,0x6c,0x20,0x62,0x6f,0x64,0x79,0x20,
-0x53,0x74,0x79,0x6c,0x65,0x20,0x2a,0x2f,0x0d,0x0a,0x62,0x6f,0x64,0x79,0x7b,0x0d,
-0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x41,
-0x72,0x69,0x61,0x6c,0x2c,0x20,0x27,0x52,0x61,0x6c,0x65,0x77,0x61,0x79,0x27,0x2c,
-0x43,0x61,0x6d,0x62,0x72,0x69,0x61,0x2c,0x20,0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,
-0x72,0x69,0x66,0x3b,0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,
-0x64,0x3a,0x20,0x23,0x32,0x35,0x32,0x35,0x32,0x35,0x3b,0x0d,0x0a,0x09,0x66,0x6f,
-0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x34,0x30,0x30,0x3b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,
-0x31,0x36,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,
-0x3a,0x20,0x23,0x46,0x46,0x46,0x46,0x46,0x46,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x72,0x65,0x6c,0x61,0x74,0x69,
-0x76,0x65,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,
-0x20,0x31,0x30,0x30,0x25,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x63,0x6c,0x72,0x7b,
-0x0d,0x0a,0x09,0x63,0x6c,0x65,0x61,0x72,0x3a,0x20,0x62,0x6f,0x74,0x68,0x3b,0x0d,
-0x0a,0x7d,0x0d,0x0a,0x2f,0x2a,0x20,0x74,0x6f,0x70,0x20,0x48,0x65,0x61,0x64,0x65,
-0x72,0x20,0x53,0x74,0x79,0x6c,0x65,0x20,0x2a,0x2f,0x0d,0x0a,0x2e,0x63,0x6f,0x64,
-0x72,0x6f,0x70,0x73,0x2d,0x74,0x6f,0x70,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x66,
-0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x43,0x61,0x6d,0x62,
-0x72,0x69,0x61,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,
-0x3a,0x20,0x33,0x35,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x7a,0x2d,0x69,0x6e,0x64,0x65,
-0x78,0x3a,0x20,0x39,0x39,0x39,0x39,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x62,0x6f,
-0x78,0x2d,0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,0x31,0x70,0x78,0x20,0x30,0x70,
-0x78,0x20,0x32,0x70,0x78,0x20,0x72,0x67,0x62,0x61,0x28,0x30,0x2c,0x30,0x2c,0x30,
-0x2c,0x30,0x2e,0x32,0x29,0x3b,0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,
-0x75,0x6e,0x64,0x3a,0x20,0x72,0x67,0x62,0x61,0x28,0x32,0x35,0x35,0x2c,0x20,0x32,
-0x35,0x35,0x2c,0x20,0x32,0x35,0x35,0x2c,0x20,0x30,0x29,0x3b,0x0d,0x0a,0x7d,0x0d,
-0x0a,0x2e,0x63,0x6f,0x64,0x72,0x6f,0x70,0x73,0x2d,0x74,0x6f,0x70,0x20,0x61,0x7b,
-0x0d,0x0a,0x09,0x6c,0x65,0x74,0x74,0x65,0x72,0x2d,0x73,0x70,0x61,0x63,0x69,0x6e,
-0x67,0x3a,0x20,0x31,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,
-0x6f,0x72,0x3a,0x20,0x72,0x67,0x62,0x28,0x32,0x35,0x35,0x2c,0x20,0x32,0x35,0x35,
-0x2c,0x20,0x32,0x35,0x35,0x29,0x3b,0x0d,0x0a,0x09,0x74,0x65,0x78,0x74,0x2d,0x73,
-0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,0x30,0x70,0x78,0x20,0x31,0x70,0x78,0x20,0x31,
-0x70,0x78,0x20,0x23,0x43,0x43,0x43,0x43,0x43,0x43,0x3b,0x0d,0x0a,0x09,0x64,0x69,
-0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3a,0x20,0x6c,0x65,0x66,0x74,0x3b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x6c,0x65,0x66,
-0x74,0x3a,0x20,0x31,0x32,0x70,0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x63,0x6f,
-0x64,0x72,0x6f,0x70,0x73,0x2d,0x74,0x6f,0x70,0x20,0x73,0x70,0x61,0x6e,0x2e,0x72,
-0x69,0x67,0x68,0x74,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6c,0x6f,0x61,0x74,
-0x3a,0x20,0x72,0x69,0x67,0x68,0x74,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,
-0x6c,0x6f,0x72,0x3a,0x20,0x72,0x67,0x62,0x28,0x32,0x35,0x35,0x2c,0x20,0x32,0x35,
-0x35,0x2c,0x20,0x32,0x35,0x35,0x29,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x63,0x6f,
-0x64,0x72,0x6f,0x70,0x73,0x2d,0x74,0x6f,0x70,0x20,0x73,0x70,0x61,0x6e,0x2e,0x72,
-0x69,0x67,0x68,0x74,0x20,0x61,0x7b,0x0d,0x0a,0x09,0x66,0x6c,0x6f,0x61,0x74,0x3a,
-0x20,0x6c,0x65,0x66,0x74,0x3b,0x0d,0x0a,0x09,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,
-0x3a,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x63,0x6f,
-0x64,0x72,0x6f,0x70,0x73,0x2d,0x74,0x6f,0x70,0x20,0x73,0x70,0x61,0x6e,0x2e,0x72,
-0x69,0x67,0x68,0x74,0x20,0x61,0x3a,0x68,0x6f,0x76,0x65,0x72,0x7b,0x0d,0x0a,0x09,
-0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x72,0x67,0x62,0x28,
-0x32,0x35,0x35,0x2c,0x20,0x32,0x35,0x35,0x2c,0x20,0x32,0x35,0x35,0x29,0x3b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x72,0x67,0x62,0x28,
-0x30,0x2c,0x20,0x30,0x2c,0x20,0x30,0x29,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2f,0x2a,
-0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,0x2a,0x2f,0x0d,0x0a,0x2e,0x63,0x6f,
-0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x7b,0x0d,0x0a,0x09,0x77,0x69,0x64,0x74,0x68,
-0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x70,0x6f,0x73,
-0x69,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x66,0x69,0x78,0x65,0x64,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x74,0x6f,0x70,0x3a,0x20,0x34,0x35,0x70,0x78,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,
-0x0d,0x0a,0x7d,0x0d,0x0a,0x2f,0x2a,0x20,0x6d,0x65,0x6e,0x75,0x20,0x2a,0x2f,0x0d,
-0x0a,0x2e,0x6d,0x65,0x6e,0x75,0x0d,0x0a,0x7b,0x0d,0x0a,0x09,0x77,0x69,0x64,0x74,
-0x68,0x3a,0x20,0x32,0x30,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x68,0x65,0x69,0x67,
-0x68,0x74,0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,
-0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x72,0x67,0x62,0x28,0x34,0x35,0x2c,0x20,
-0x34,0x35,0x2c,0x20,0x34,0x35,0x29,0x3b,0x0d,0x0a,0x09,0x70,0x6f,0x73,0x69,0x74,
-0x69,0x6f,0x6e,0x3a,0x66,0x69,0x78,0x65,0x64,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x66,0x6c,0x6f,0x61,0x74,0x3a,0x20,0x6c,0x65,0x66,0x74,0x3b,0x0d,0x0a,0x7d,0x20,
-0x20,0x20,0x0d,0x0a,0x2e,0x6d,0x65,0x6e,0x75,0x5f,0x68,0x65,0x61,0x64,0x65,0x72,
-0x20,0x20,0x20,0x0d,0x0a,0x7b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,
-0x7a,0x65,0x3a,0x20,0x32,0x36,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,
-0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x33,0x42,0x33,0x46,0x34,0x35,0x3b,
-0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,
-0x3a,0x20,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x66,0x66,0x66,
-0x66,0x66,0x66,0x3b,0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x74,0x6f,
-0x70,0x3a,0x20,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x66,0x66,
-0x66,0x66,0x66,0x66,0x3b,0x0d,0x0a,0x7d,0x20,0x20,0x20,0x0d,0x0a,0x2e,0x6d,0x65,
-0x6e,0x75,0x5f,0x68,0x65,0x61,0x64,0x65,0x72,0x5f,0x74,0x69,0x74,0x6c,0x65,0x0d,
-0x0a,0x7b,0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x66,0x66,
-0x66,0x66,0x66,0x3b,0x0d,0x0a,0x09,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,
-0x31,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x74,0x2d,
-0x73,0x68,0x61,0x64,0x6f,0x77,0x3a,0x20,0x30,0x20,0x31,0x70,0x78,0x20,0x30,0x20,
-0x72,0x67,0x62,0x61,0x28,0x30,0x2c,0x20,0x30,0x2c,0x20,0x30,0x2c,0x20,0x30,0x2e,
-0x34,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,
-0x69,0x67,0x6e,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x0d,0x0a,0x7d,0x0d,
-0x0a,0x0d,0x0a,0x2e,0x6d,0x65,0x6e,0x75,0x5f,0x62,0x6f,0x64,0x79,0x0d,0x0a,0x7b,
-0x0d,0x0a,0x09,0x6c,0x69,0x73,0x74,0x2d,0x73,0x74,0x79,0x6c,0x65,0x3a,0x20,0x6e,
-0x6f,0x6e,0x65,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x6d,0x65,0x6e,
-0x75,0x5f,0x69,0x74,0x65,0x6d,0x20,0x20,0x20,0x0d,0x0a,0x7b,0x0d,0x0a,0x09,0x66,
-0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x36,0x70,0x78,0x3b,0x0d,
-0x0a,0x09,0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x72,0x65,0x6c,0x61,
-0x74,0x69,0x76,0x65,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x6d,0x65,0x6e,0x75,0x5f,
-0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x20,0x20,0x20,0x0d,0x0a,0x7b,0x20,
-0x20,0x20,0x0d,0x0a,0x09,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x31,0x30,
-0x70,0x78,0x3b,0x20,0x0d,0x0a,0x09,0x74,0x65,0x78,0x74,0x2d,0x64,0x65,0x63,0x6f,
-0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x0d,0x0a,0x09,
-0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x64,0x64,0x64,0x64,0x64,0x64,0x3b,0x20,
-0x20,0x20,0x0d,0x0a,0x09,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x62,0x6c,
-0x6f,0x63,0x6b,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,
-0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x20,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,
-0x69,0x64,0x20,0x23,0x46,0x65,0x46,0x65,0x46,0x65,0x3b,0x20,0x20,0x20,0x0d,0x0a,
-0x7d,0x0d,0x0a,0x2e,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,
-0x6e,0x6b,0x3a,0x68,0x6f,0x76,0x65,0x72,0x0d,0x0a,0x7b,0x20,0x20,0x20,0x0d,0x0a,
-0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x66,0x30,
-0x66,0x30,0x66,0x30,0x3b,0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,
-0x30,0x30,0x30,0x30,0x30,0x30,0x3b,0x0d,0x0a,0x7d,0x20,0x20,0x20,0x0d,0x0a,0x2e,
-0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x2e,0x69,
-0x73,0x2d,0x61,0x63,0x74,0x69,0x76,0x65,0x20,0x20,0x20,0x0d,0x0a,0x7b,0x20,0x20,
-0x20,0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,
-0x72,0x67,0x62,0x28,0x32,0x35,0x32,0x2c,0x20,0x32,0x34,0x38,0x2c,0x20,0x32,0x34,
-0x38,0x29,0x3b,0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x30,0x30,
-0x30,0x30,0x30,0x30,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x7d,0x20,0x20,0x20,0x0d,0x0a,
-0x2e,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x2e,
-0x69,0x73,0x2d,0x61,0x63,0x74,0x69,0x76,0x65,0x3a,0x61,0x66,0x74,0x65,0x72,0x20,
-0x20,0x20,0x0d,0x0a,0x7b,0x20,0x20,0x20,0x0d,0x0a,0x09,0x64,0x69,0x73,0x70,0x6c,
-0x61,0x79,0x3a,0x20,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x09,
-0x70,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x61,0x62,0x73,0x6f,0x6c,0x75,
-0x74,0x65,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x09,0x74,0x6f,0x70,0x3a,0x20,0x35,0x30,
-0x25,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x09,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,
-0x6f,0x70,0x3a,0x20,0x2d,0x36,0x70,0x78,0x3b,0x20,0x20,0x20,0x0d,0x0a,0x09,0x62,
-0x6f,0x72,0x64,0x65,0x72,0x2d,0x74,0x6f,0x70,0x3a,0x20,0x36,0x70,0x78,0x20,0x73,
-0x6f,0x6c,0x69,0x64,0x20,0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,0x74,
-0x3b,0x20,0x20,0x20,0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,
-0x74,0x74,0x6f,0x6d,0x3a,0x20,0x36,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,
-0x74,0x72,0x61,0x6e,0x73,0x70,0x61,0x72,0x65,0x6e,0x74,0x3b,0x20,0x20,0x20,0x0d,
-0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x20,0x36,
-0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x36,0x45,0x37,0x35,0x37,0x46,
-0x3b,0x20,0x20,0x20,0x0d,0x0a,0x7d,0x20,0x20,0x20,0x0d,0x0a,0x0d,0x0a,0x2f,0x2a,
-0x20,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x20,0x77,0x72,0x61,0x70,0x20,0x2a,0x2f,
-0x0d,0x0a,0x2e,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x77,0x72,0x61,0x70,0x20,
-0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,
-0x66,0x74,0x3a,0x20,0x32,0x30,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x2d,0x63,0x6f,0x6c,0x6f,0x72,
-0x3a,0x20,0x72,0x67,0x62,0x28,0x32,0x35,0x32,0x2c,0x20,0x32,0x34,0x38,0x2c,0x20,
-0x32,0x34,0x38,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x68,0x65,0x69,0x67,0x68,
-0x74,0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,
-0x6c,0x6f,0x72,0x3a,0x20,0x23,0x30,0x30,0x30,0x30,0x30,0x30,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x31,0x30,0x70,0x78,
-0x20,0x32,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x6e,0x74,
-0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x41,0x72,0x69,0x61,0x6c,0x2c,0x20,
-0x27,0x54,0x69,0x6d,0x65,0x73,0x20,0x4e,0x65,0x77,0x20,0x52,0x6f,0x6d,0x61,0x6e,
-0x27,0x2c,0x20,0x27,0x52,0x61,0x6c,0x65,0x77,0x61,0x79,0x27,0x2c,0x20,0x73,0x61,
-0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,0x66,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x6f,
-0x76,0x65,0x72,0x66,0x6c,0x6f,0x77,0x3a,0x20,0x61,0x75,0x74,0x6f,0x3b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,
-0x37,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x6d,0x69,0x6e,0x2d,0x77,0x69,
-0x64,0x74,0x68,0x3a,0x20,0x36,0x30,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,
-0x0d,0x0a,0x2e,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x77,0x72,0x61,0x70,0x20,
-0x3e,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x70,
-0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x20,0x32,
-0x70,0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,
-0x2d,0x77,0x72,0x61,0x70,0x20,0x3e,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x20,0x68,
-0x31,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,
-0x65,0x3a,0x20,0x32,0x35,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,
-0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x62,0x6f,0x6c,0x64,0x3b,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x62,0x6f,
-0x74,0x74,0x6f,0x6d,0x3a,0x20,0x35,0x70,0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,
-0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x77,0x72,0x61,0x70,0x20,0x3e,0x20,0x68,
-0x65,0x61,0x64,0x65,0x72,0x20,0x68,0x32,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x66,
-0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x32,0x30,0x70,0x78,0x3b,0x0d,
-0x0a,0x7d,0x0d,0x0a,0x2e,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x77,0x72,0x61,
-0x70,0x20,0x3e,0x20,0x73,0x75,0x62,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,
-0x64,0x64,0x69,0x6e,0x67,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x20,0x35,0x70,0x78,0x3b,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x62,0x6f,
-0x74,0x74,0x6f,0x6d,0x3a,0x20,0x32,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x30,0x30,0x30,0x30,0x30,0x30,0x3b,0x0d,
-0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x38,0x70,
-0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,
-0x77,0x72,0x61,0x70,0x20,0x3e,0x20,0x73,0x75,0x62,0x20,0x68,0x31,0x7b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x32,
-0x30,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x77,
-0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x35,0x32,0x30,0x3b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,
-0x20,0x35,0x70,0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x63,0x6f,0x6e,0x74,0x65,
-0x6e,0x74,0x2d,0x77,0x72,0x61,0x70,0x20,0x3e,0x20,0x73,0x75,0x62,0x20,0x68,0x32,
-0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,
-0x3a,0x20,0x31,0x38,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x64,
-0x64,0x69,0x6e,0x67,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x20,0x32,0x70,0x78,
-0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x38,
-0x30,0x70,0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x0d,0x0a,0x2e,0x6c,0x61,0x62,0x65,
-0x6c,0x5f,0x78,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x64,0x69,0x73,0x70,0x6c,0x61,
-0x79,0x3a,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x62,0x6c,0x6f,0x63,0x6b,0x3b,
-0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x30,0x30,0x30,0x30,0x30,
-0x30,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,
-0x65,0x3a,0x20,0x31,0x38,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,
-0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x3a,0x20,0x35,0x70,0x78,0x3b,0x0d,0x0a,
-0x7d,0x0d,0x0a,0x2e,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x6d,0x7b,0x0d,0x0a,0x09,0x64,
-0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x62,
-0x6c,0x6f,0x63,0x6b,0x3b,0x0d,0x0a,0x09,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x36,
-0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x30,
-0x30,0x30,0x30,0x30,0x30,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,
-0x7a,0x65,0x3a,0x20,0x31,0x37,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x70,
-0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x30,0x70,0x78,0x20,0x35,0x70,0x78,0x20,
-0x33,0x70,0x78,0x20,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x6c,0x61,
-0x62,0x65,0x6c,0x5f,0x31,0x7b,0x0d,0x0a,0x09,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,
-0x3a,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x0d,
-0x0a,0x09,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x37,0x30,0x70,0x78,0x3b,0x0d,
-0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x30,0x30,0x30,0x30,0x30,0x30,
-0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,
-0x37,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x64,0x64,0x69,0x6e,
-0x67,0x3a,0x20,0x30,0x70,0x78,0x20,0x35,0x70,0x78,0x20,0x33,0x70,0x78,0x20,0x30,
-0x70,0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x32,
-0x7b,0x0d,0x0a,0x09,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x69,0x6e,0x6c,
-0x69,0x6e,0x65,0x2d,0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x0d,0x0a,0x09,0x77,0x69,0x64,
-0x74,0x68,0x3a,0x20,0x32,0x31,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x63,0x6f,0x6c,
-0x6f,0x72,0x3a,0x20,0x23,0x30,0x30,0x30,0x30,0x30,0x30,0x3b,0x0d,0x0a,0x09,0x66,
-0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x37,0x70,0x78,0x3b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x30,0x70,
-0x78,0x20,0x35,0x70,0x78,0x20,0x33,0x70,0x78,0x20,0x30,0x70,0x78,0x3b,0x0d,0x0a,
-0x7d,0x0d,0x0a,0x2e,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x33,0x7b,0x0d,0x0a,0x09,0x64,
-0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x20,0x69,0x6e,0x6c,0x69,0x6e,0x65,0x2d,0x62,
-0x6c,0x6f,0x63,0x6b,0x3b,0x0d,0x0a,0x09,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x32,
-0x32,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,
-0x30,0x30,0x30,0x30,0x30,0x30,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,
-0x69,0x7a,0x65,0x3a,0x20,0x31,0x37,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x30,0x70,0x78,0x20,0x35,0x70,0x78,
-0x20,0x33,0x70,0x78,0x20,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x63,
-0x66,0x67,0x63,0x62,0x20,0x7b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,
-0x6d,0x69,0x6c,0x79,0x3a,0x56,0x65,0x72,0x64,0x61,0x6e,0x61,0x3b,0x0d,0x0a,0x09,
-0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x30,0x30,0x30,0x30,0x30,0x30,0x3b,0x0d,
-0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x36,0x70,
-0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2d,0x73,
-0x65,0x74,0x74,0x69,0x6e,0x67,0x2d,0x62,0x6b,0x7b,0x0d,0x0a,0x09,0x70,0x6f,0x73,
-0x69,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x66,0x69,0x78,0x65,0x64,0x3b,0x0d,0x0a,0x09,
-0x6c,0x65,0x66,0x74,0x3a,0x20,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x74,0x6f,0x70,
-0x3a,0x20,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,
-0x75,0x6e,0x64,0x3a,0x20,0x23,0x30,0x30,0x30,0x3b,0x0d,0x0a,0x09,0x77,0x69,0x64,
-0x74,0x68,0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,0x0d,0x0a,0x09,0x68,0x65,0x69,0x67,
-0x68,0x74,0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,
-0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x72,0x67,0x62,0x61,0x28,0x30,0x2c,0x30,
-0x2c,0x30,0x2c,0x30,0x2e,0x35,0x29,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x77,0x69,0x6e,
-0x64,0x6f,0x77,0x2d,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,0x7b,0x0d,0x0a,0x09,0x70,
-0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x72,0x65,0x6c,0x61,0x74,0x69,0x76,
-0x65,0x3b,0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,
-0x20,0x23,0x66,0x66,0x66,0x3b,0x0d,0x0a,0x09,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,
-0x35,0x30,0x25,0x3b,0x0d,0x0a,0x09,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x38,
-0x30,0x25,0x3b,0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,
-0x69,0x75,0x73,0x3a,0x20,0x35,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x6d,0x61,0x72,0x67,
-0x69,0x6e,0x3a,0x20,0x35,0x25,0x20,0x61,0x75,0x74,0x6f,0x3b,0x0d,0x0a,0x7d,0x0d,
-0x0a,0x2e,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2d,0x73,0x65,0x74,0x74,0x69,0x6e,0x67,
-0x20,0x3e,0x20,0x68,0x65,0x61,0x64,0x65,0x72,0x7b,0x0d,0x0a,0x09,0x68,0x65,0x69,
-0x67,0x68,0x74,0x3a,0x20,0x34,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x70,0x6f,0x73,
-0x69,0x74,0x69,0x6f,0x6e,0x3a,0x20,0x61,0x62,0x73,0x6f,0x6c,0x75,0x74,0x65,0x3b,
-0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x38,
-0x70,0x78,0x3b,0x0d,0x0a,0x09,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x32,0x35,0x70,
-0x78,0x3b,0x0d,0x0a,0x09,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x32,0x35,0x70,
-0x78,0x3b,0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x72,0x61,0x64,0x69,
-0x75,0x73,0x3a,0x20,0x35,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,0x67,
-0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x72,0x65,0x64,0x3b,0x0d,0x0a,0x09,0x63,0x6f,
-0x6c,0x6f,0x72,0x3a,0x20,0x23,0x66,0x66,0x66,0x3b,0x0d,0x0a,0x09,0x72,0x69,0x67,
-0x68,0x74,0x3a,0x20,0x35,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x74,0x6f,0x70,0x3a,0x20,
-0x35,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x74,0x65,0x78,0x74,0x2d,0x61,0x6c,0x69,0x67,
-0x6e,0x3a,0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x0d,
-0x0a,0x23,0x73,0x75,0x62,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x7b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x20,
-0x35,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x70,0x61,0x64,0x64,0x69,0x6e,
-0x67,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x20,0x32,0x70,0x78,0x3b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,0x30,0x30,0x30,0x30,
-0x30,0x30,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,
-0x7a,0x65,0x3a,0x20,0x31,0x38,0x70,0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x73,
-0x75,0x62,0x62,0x6c,0x6f,0x63,0x6b,0x20,0x3e,0x20,0x68,0x31,0x7b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x38,
-0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,
-0x69,0x67,0x68,0x74,0x3a,0x20,0x62,0x6f,0x6c,0x64,0x3b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,
-0x20,0x35,0x70,0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x0d,0x0a,0x23,0x73,0x61,0x76,
-0x65,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x7b,0x20,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x74,0x6f,0x70,0x3a,0x31,0x70,0x78,0x3b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x62,0x6f,0x74,0x74,
-0x6f,0x6d,0x3a,0x35,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x68,0x65,0x69,
-0x67,0x68,0x74,0x3a,0x34,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x23,0x73,
-0x61,0x76,0x65,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x2e,0x62,0x75,0x74,0x74,
-0x6f,0x6e,0x0d,0x0a,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x74,0x65,0x78,0x74,0x2d,
-0x64,0x65,0x63,0x6f,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,
-0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x23,0x32,
-0x66,0x34,0x33,0x35,0x65,0x3b,0x0d,0x0a,0x09,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,
-0x66,0x32,0x66,0x32,0x66,0x32,0x3b,0x0d,0x0a,0x09,0x70,0x61,0x64,0x64,0x69,0x6e,
-0x67,0x3a,0x20,0x31,0x30,0x70,0x78,0x20,0x30,0x70,0x78,0x20,0x31,0x30,0x70,0x78,
-0x20,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x77,0x69,0x64,0x74,0x68,
-0x3a,0x20,0x31,0x30,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,
-0x73,0x69,0x7a,0x65,0x3a,0x31,0x36,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,
-0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x27,0x52,0x61,0x6c,0x65,0x77,
-0x61,0x79,0x27,0x2c,0x43,0x61,0x6d,0x62,0x72,0x69,0x61,0x2c,0x20,0x41,0x72,0x69,
-0x61,0x6c,0x2c,0x20,0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,0x72,0x69,0x66,0x3b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,
-0x3a,0x62,0x6f,0x6c,0x64,0x3b,0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,
-0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x33,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x62,0x6f,
-0x72,0x64,0x65,0x72,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x0d,0x0a,0x09,0x2d,0x77,
-0x65,0x62,0x6b,0x69,0x74,0x2d,0x74,0x72,0x61,0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,
-0x3a,0x61,0x6c,0x6c,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x20,0x30,0x2e,0x33,0x30,
-0x73,0x3b,0x0d,0x0a,0x09,0x2d,0x6d,0x6f,0x7a,0x2d,0x74,0x72,0x61,0x6e,0x73,0x69,
-0x74,0x69,0x6f,0x6e,0x3a,0x61,0x6c,0x6c,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x20,
-0x30,0x2e,0x33,0x30,0x73,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x74,0x72,0x61,0x6e,
-0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x6c,0x6c,0x20,0x6c,0x69,0x6e,0x65,0x61,
-0x72,0x20,0x30,0x2e,0x33,0x30,0x73,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x63,0x75,
-0x72,0x73,0x6f,0x72,0x3a,0x20,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x3b,0x0d,0x0a,
-0x7d,0x0d,0x0a,0x23,0x73,0x61,0x76,0x65,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,
-0x2e,0x62,0x75,0x74,0x74,0x6f,0x6e,0x3a,0x68,0x6f,0x76,0x65,0x72,0x20,0x7b,0x0d,
-0x0a,0x20,0x20,0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x23,
-0x33,0x38,0x35,0x66,0x39,0x65,0x3b,0x20,0x0d,0x0a,0x7d,0x0d,0x0a,0x23,0x73,0x61,
-0x76,0x65,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x20,0x2e,0x62,0x75,0x74,0x74,0x6f,
-0x6e,0x5f,0x72,0x69,0x67,0x68,0x74,0x0d,0x0a,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x74,0x65,0x78,0x74,0x2d,0x64,0x65,0x63,0x6f,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3a,
-0x6e,0x6f,0x6e,0x65,0x3b,0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,
-0x6e,0x64,0x3a,0x23,0x32,0x66,0x34,0x33,0x35,0x65,0x3b,0x0d,0x0a,0x09,0x63,0x6f,
-0x6c,0x6f,0x72,0x3a,0x23,0x66,0x32,0x66,0x32,0x66,0x32,0x3b,0x0d,0x0a,0x09,0x70,
-0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x31,0x30,0x70,0x78,0x20,0x30,0x70,0x78,
-0x20,0x31,0x30,0x70,0x78,0x20,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x30,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,
-0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x31,0x36,0x70,0x78,0x3b,0x0d,
-0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x66,0x61,0x6d,0x69,0x6c,0x79,0x3a,0x20,0x27,
-0x52,0x61,0x6c,0x65,0x77,0x61,0x79,0x27,0x2c,0x43,0x61,0x6d,0x62,0x72,0x69,0x61,
-0x2c,0x20,0x41,0x72,0x69,0x61,0x6c,0x2c,0x20,0x73,0x61,0x6e,0x73,0x2d,0x73,0x65,
-0x72,0x69,0x66,0x3b,0x0d,0x0a,0x09,0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,
-0x68,0x74,0x3a,0x62,0x6f,0x6c,0x64,0x3b,0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,
-0x72,0x2d,0x72,0x61,0x64,0x69,0x75,0x73,0x3a,0x33,0x70,0x78,0x3b,0x0d,0x0a,0x09,
-0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x20,0x6e,0x6f,0x6e,0x65,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x20,
-0x38,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x2d,0x77,0x65,0x62,0x6b,0x69,0x74,0x2d,
-0x74,0x72,0x61,0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x6c,0x6c,0x20,0x6c,
-0x69,0x6e,0x65,0x61,0x72,0x20,0x30,0x2e,0x33,0x30,0x73,0x3b,0x0d,0x0a,0x09,0x2d,
-0x6d,0x6f,0x7a,0x2d,0x74,0x72,0x61,0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,
-0x6c,0x6c,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x20,0x30,0x2e,0x33,0x30,0x73,0x3b,
-0x0d,0x0a,0x09,0x74,0x72,0x61,0x6e,0x73,0x69,0x74,0x69,0x6f,0x6e,0x3a,0x61,0x6c,
-0x6c,0x20,0x6c,0x69,0x6e,0x65,0x61,0x72,0x20,0x30,0x2e,0x33,0x30,0x73,0x3b,0x0d,
-0x0a,0x7d,0x0d,0x0a,0x23,0x73,0x61,0x76,0x65,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,
-0x20,0x2e,0x62,0x75,0x74,0x74,0x6f,0x6e,0x5f,0x72,0x69,0x67,0x68,0x74,0x3a,0x68,
-0x6f,0x76,0x65,0x72,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x62,0x61,0x63,0x6b,0x67,
-0x72,0x6f,0x75,0x6e,0x64,0x3a,0x23,0x33,0x38,0x35,0x66,0x39,0x65,0x3b,0x20,0x0d,
-0x0a,0x7d,0x0d,0x0a,0x0d,0x0a,0x0d,0x0a,0x23,0x54,0x61,0x62,0x20,0x7b,0x0d,0x0a,
-0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x3a,0x32,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,
-0x64,0x20,0x23,0x61,0x30,0x61,0x30,0x61,0x30,0x3b,0x0d,0x0a,0x09,0x70,0x61,0x64,
-0x64,0x69,0x6e,0x67,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,0x3a,0x20,0x35,0x30,0x70,
-0x78,0x3b,0x0d,0x0a,0x09,0x6d,0x69,0x6e,0x2d,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,
-0x35,0x30,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x6d,0x69,0x6e,0x2d,0x68,0x65,0x69,
-0x67,0x68,0x74,0x3a,0x20,0x34,0x30,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,
-0x2e,0x4d,0x65,0x6e,0x75,0x62,0x6f,0x78,0x20,0x7b,0x0d,0x0a,0x09,0x68,0x65,0x69,
-0x67,0x68,0x74,0x3a,0x35,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x62,0x61,0x63,0x6b,
-0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x20,0x23,0x65,0x36,0x65,0x36,0x65,0x36,0x3b,
-0x0d,0x0a,0x09,0x62,0x6f,0x72,0x64,0x65,0x72,0x2d,0x62,0x6f,0x74,0x74,0x6f,0x6d,
-0x3a,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,0x61,0x30,0x61,0x30,
-0x61,0x30,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x4d,0x65,0x6e,0x75,0x62,0x6f,0x78,
-0x20,0x75,0x6c,0x20,0x7b,0x0d,0x0a,0x09,0x6c,0x69,0x73,0x74,0x2d,0x73,0x74,0x79,
-0x6c,0x65,0x3a,0x6e,0x6f,0x6e,0x65,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x4d,0x65,
-0x6e,0x75,0x62,0x6f,0x78,0x20,0x75,0x6c,0x20,0x6c,0x69,0x20,0x7b,0x0d,0x0a,0x09,
-0x66,0x6c,0x6f,0x61,0x74,0x3a,0x6c,0x65,0x66,0x74,0x3b,0x0d,0x0a,0x09,0x62,0x61,
-0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x23,0x62,0x30,0x62,0x30,0x62,0x30,
-0x3b,0x0d,0x0a,0x09,0x6c,0x69,0x6e,0x65,0x2d,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,
-0x35,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,
-0x62,0x6c,0x6f,0x63,0x6b,0x3b,0x0d,0x0a,0x09,0x63,0x75,0x72,0x73,0x6f,0x72,0x3a,
-0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x3b,0x0d,0x0a,0x09,0x77,0x69,0x64,0x74,0x68,
-0x3a,0x31,0x35,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x74,0x65,0x78,0x74,0x2d,0x61,
-0x6c,0x69,0x67,0x6e,0x3a,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x0d,0x0a,0x09,0x63,
-0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x66,0x66,0x66,0x66,0x66,0x66,0x3b,0x0d,0x0a,0x09,
-0x66,0x6f,0x6e,0x74,0x2d,0x77,0x65,0x69,0x67,0x68,0x74,0x3a,0x62,0x6f,0x6c,0x64,
-0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x4d,0x65,0x6e,0x75,0x62,0x6f,0x78,0x20,0x75,
-0x6c,0x20,0x6c,0x69,0x2e,0x68,0x6f,0x76,0x65,0x72,0x20,0x7b,0x0d,0x0a,0x09,0x62,
-0x61,0x63,0x6b,0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x72,0x67,0x62,0x28,0x32,0x35,
-0x32,0x2c,0x20,0x32,0x34,0x38,0x2c,0x20,0x32,0x34,0x38,0x29,0x3b,0x0d,0x0a,0x09,
-0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x23,0x30,0x30,0x30,0x30,0x30,0x30,0x3b,0x0d,0x0a,
-0x7d,0x0d,0x0a,0x2e,0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x62,0x6f,0x78,0x20,0x7b,
-0x0d,0x0a,0x09,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x32,0x30,0x70,0x78,
-0x20,0x31,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x09,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,
-0x31,0x30,0x30,0x25,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x0d,0x0a,0x2e,0x72,0x6f,0x77,
-0x4d,0x65,0x6e,0x75,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x62,0x61,0x63,0x6b,
-0x67,0x72,0x6f,0x75,0x6e,0x64,0x3a,0x72,0x67,0x62,0x28,0x32,0x35,0x32,0x2c,0x20,
-0x32,0x34,0x38,0x2c,0x20,0x32,0x34,0x38,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x66,0x6f,0x6e,0x74,0x2d,0x73,0x69,0x7a,0x65,0x3a,0x20,0x31,0x36,0x70,0x78,0x3b,
-0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x72,0x6f,0x77,0x4d,0x65,0x6e,0x75,0x20,0x75,0x6c,
-0x20,0x7b,0x0d,0x0a,0x09,0x6c,0x69,0x73,0x74,0x2d,0x73,0x74,0x79,0x6c,0x65,0x3a,
-0x6e,0x6f,0x6e,0x65,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x72,0x6f,0x77,0x4d,0x65,
-0x6e,0x75,0x20,0x75,0x6c,0x20,0x6c,0x69,0x20,0x20,0x7b,0x0d,0x0a,0x09,0x62,0x6f,
-0x72,0x64,0x65,0x72,0x3a,0x31,0x70,0x78,0x20,0x73,0x6f,0x6c,0x69,0x64,0x20,0x23,
-0x30,0x30,0x30,0x30,0x30,0x30,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x77,0x69,0x64,
-0x74,0x68,0x3a,0x20,0x31,0x36,0x30,0x70,0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x20,0x31,0x33,0x30,0x70,0x78,0x3b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x70,0x61,0x64,0x64,0x69,0x6e,0x67,0x3a,0x20,0x31,0x30,0x70,
-0x78,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x23,
-0x30,0x30,0x30,0x30,0x30,0x30,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x63,0x75,0x72,
-0x73,0x6f,0x72,0x3a,0x70,0x6f,0x69,0x6e,0x74,0x65,0x72,0x3b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x61,0x6c,0x69,0x67,0x6e,0x2d,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x3a,
-0x20,0x63,0x65,0x6e,0x74,0x65,0x72,0x3b,0x0d,0x0a,0x7d,0x0d,0x0a,0x2e,0x72,0x6f,
-0x77,0x4d,0x65,0x6e,0x75,0x20,0x75,0x6c,0x20,0x6c,0x69,0x2e,0x68,0x6f,0x76,0x65,
-0x72,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x62,0x61,0x63,0x6b,0x67,0x72,0x6f,
-0x75,0x6e,0x64,0x3a,0x20,0x23,0x66,0x30,0x65,0x30,0x65,0x30,0x3b,0x0d,0x0a,0x7d,
-0x0d,0x0a,};
+0x78,0x74,0x2f,0x63,0x73,0x73,0x0d,0x0a,
+/* "Cache-Control: max-age=86400
+" (30 bytes) */
+0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x3a,0x20,0x6d,
+0x61,0x78,0x2d,0x61,0x67,0x65,0x3d,0x38,0x36,0x34,0x30,0x30,0x0d,0x0a,
+/* "ETag: "c1f841f2"
+" (18 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x63,0x31,0x66,0x38,0x34,0x31,0x66,0x32,0x22,
+0x0d,0x0a,
+/* "Content-Encoding: gzip
+" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x45,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,
+0x3a,0x20,0x67,0x7a,0x69,0x70,0x0d,0x0a,
+/* "Vary: Accept-Encoding
+" (23 bytes) */
+0x56,0x61,0x72,0x79,0x3a,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2d,0x45,0x6e,0x63,
+0x6f,0x64,0x69,0x6e,0x67,0x0d,0x0a,
+/* "Content-Length: 1884
+
+" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x31,0x38,0x38,0x34,0x0d,0x0a,0x0d,0x0a,
+/* gzip file data (1884 bytes) */
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xd5,0x58,0x4b,0x6f,0xe3,0x36,
+0x10,0x3e,0x3b,0x40,0xfe,0x03,0x81,0xa0,0xd8,0xa6,0xa0,0x1d,0x59,0xb6,0x9c,0xd4,
+0x41,0x9f,0x8b,0x6e,0x7b,0x69,0x0f,0xdd,0xa2,0xd7,0x80,0x92,0x68,0x8b,0x08,0x2d,
+0xaa,0x12,0x1d,0x27,0x6b,0xe4,0xbf,0x77,0xf8,0x92,0x28,0x89,0x71,0xd2,0x62,0x7b,
+0xa8,0x14,0x39,0x36,0x45,0xce,0x7c,0xf3,0x1e,0xf2,0x7b,0xb6,0xab,0x44,0x2d,0xd1,
+0xbe,0xe6,0x5f,0x16,0x52,0x56,0xeb,0xab,0xab,0x8d,0x28,0x65,0x33,0xdb,0x0a,0xb1,
+0xe5,0x94,0x54,0xac,0x99,0x65,0x62,0x77,0x95,0x35,0xcd,0x77,0x1b,0xb2,0x63,0xfc,
+0xe9,0x9b,0xdf,0x09,0xa7,0x07,0xf2,0xb4,0x8e,0xa3,0x08,0x2f,0xe1,0xb9,0x86,0xe7,
+0x26,0x8a,0x2e,0x6f,0xcf,0xcf,0xce,0xcf,0xae,0xbe,0x42,0xef,0x3f,0x7e,0x44,0x35,
+0x6d,0xa8,0x44,0x5f,0x5d,0x9d,0x9f,0xa5,0x22,0x7f,0xc2,0x39,0x7b,0xc0,0x39,0xc7,
+0xb9,0xc4,0x79,0x8e,0xf7,0x1c,0x0b,0x8e,0x39,0xc3,0xc5,0x1c,0x17,0x31,0x2e,0x16,
+0xb8,0x58,0xe2,0x22,0xc1,0xc5,0x0a,0x57,0x35,0xc5,0x1b,0x51,0xef,0xf0,0x86,0x51,
+0x9e,0x03,0x09,0xcc,0xca,0x6a,0x2f,0xb1,0xa4,0x8f,0x92,0xd4,0x94,0xe0,0x0a,0xa7,
+0x5c,0x64,0xf7,0x7f,0xed,0x85,0xa4,0x58,0x16,0x58,0xe6,0xe8,0x88,0xce,0xcf,0x26,
+0x3b,0x52,0x6f,0x59,0xb9,0x8e,0x00,0xc3,0xa4,0x22,0x79,0xce,0xca,0xad,0xfe,0xf1,
+0x7c,0x7e,0x56,0xc8,0x1d,0xc7,0x0a,0x05,0x3a,0x9e,0x98,0x38,0x29,0x28,0xdb,0x16,
+0x72,0x8d,0xe6,0x51,0xf4,0x85,0x59,0x28,0x49,0xca,0xa9,0x5e,0x94,0x8a,0x3a,0xa7,
+0xf5,0x34,0x13,0x9c,0x93,0xaa,0xa1,0x6b,0xf7,0xe5,0xb6,0x7b,0xd7,0x54,0x24,0xf3,
+0x98,0x76,0xf8,0x77,0x5b,0x83,0xd0,0xcc,0x73,0xef,0x81,0x33,0xa8,0xa8,0xc1,0x19,
+0xa9,0x24,0x13,0x25,0xce,0x18,0xc8,0x93,0x89,0x9c,0xe2,0x7c,0x53,0x2a,0xc1,0x1e,
+0x48,0xad,0x59,0x2b,0x63,0x4c,0x1b,0xf9,0xc4,0xe9,0xba,0x04,0xc5,0x10,0x7e,0xeb,
+0x06,0x0f,0x06,0x70,0x3b,0x0a,0x54,0x41,0xad,0x7b,0xae,0x97,0x71,0xd6,0x74,0xcb,
+0x4a,0x6a,0x5e,0x3b,0x66,0xb2,0xd0,0x73,0x94,0x52,0xa7,0x84,0xb3,0x6d,0xb9,0xe6,
+0x74,0x23,0xad,0xb6,0x86,0x36,0xf1,0x50,0xb0,0x4f,0x74,0x6d,0xd5,0xf3,0x22,0x04,
+0x10,0x2d,0x4d,0x6b,0x4c,0xb2,0x5a,0x94,0x4f,0x3b,0x10,0x7d,0x20,0x77,0x2d,0x59,
+0xc6,0x29,0x46,0xa4,0x61,0x20,0x2c,0xca,0xa9,0x24,0x8c,0x37,0x18,0x6d,0xd8,0xd6,
+0xc1,0x53,0xdf,0xf7,0xe0,0x08,0xa0,0x45,0x01,0x66,0xae,0x31,0x2a,0x28,0xc9,0xf5,
+0xff,0x6d,0x2d,0xf6,0x15,0x46,0x3b,0x5a,0xee,0x31,0x2a,0xc9,0x03,0x46,0x0d,0xcd,
+0xd4,0x22,0x8d,0x32,0x67,0x4d,0xc5,0xc1,0x31,0x91,0xf6,0x11,0xc3,0x10,0xfc,0xf1,
+0x67,0x5a,0xd2,0x9a,0x70,0xa4,0x7d,0xe0,0xa3,0xd2,0x49,0xeb,0x98,0xad,0x6c,0xc6,
+0xb5,0xd7,0xe8,0x87,0x9a,0x11,0x8e,0xd1,0x3b,0xeb,0xe3,0xef,0xf0,0x7b,0xb2,0x4b,
+0x61,0x0c,0x18,0x91,0xb2,0x99,0x36,0xb4,0x66,0x1b,0x6d,0x75,0x92,0xdd,0x2b,0x30,
+0x65,0xbe,0x46,0x17,0x71,0xa2,0xee,0xa1,0x56,0x10,0xc4,0x06,0x8c,0x21,0xb8,0x3a,
+0xf5,0xa1,0xf9,0xaa,0x7a,0xb4,0xa3,0xe0,0x45,0xa2,0x86,0xe5,0x1f,0xf4,0x65,0x07,
+0x2b,0xd1,0x30,0x25,0xd0,0x1a,0x42,0x88,0x13,0xc9,0x1e,0xa8,0x7d,0x31,0xf6,0xcf,
+0x59,0xc6,0x6b,0x25,0x00,0xe8,0x93,0x00,0x9d,0x54,0xc8,0xa2,0x95,0x59,0x8a,0x0a,
+0xfd,0xa2,0xb5,0xe6,0x49,0x0c,0x81,0x9c,0xd7,0xa2,0x6a,0xa6,0xf0,0xf6,0xe8,0x21,
+0x73,0xc2,0x5b,0x59,0x6f,0x7b,0x06,0x47,0x8b,0x44,0x23,0x9e,0x7c,0x9a,0xb2,0x32,
+0xa7,0x8f,0x6b,0xf4,0x35,0x5c,0x16,0x54,0x2a,0x1e,0xa7,0x4d,0x41,0x72,0x71,0x00,
+0x60,0xd5,0x23,0x8a,0xe0,0x89,0xe1,0xa9,0xb7,0x29,0xf9,0x32,0xc2,0xfa,0x9e,0xc5,
+0x97,0x43,0x8d,0xe9,0xd7,0x71,0x92,0x60,0xd4,0x7d,0xe8,0xfc,0xf1,0xdc,0x07,0x89,
+0x88,0xf6,0x65,0x2a,0xa5,0x17,0x61,0x8a,0x51,0x5f,0x83,0x40,0xae,0x4f,0x4d,0x33,
+0xd4,0xee,0xed,0xc0,0x29,0x60,0x73,0xfb,0x5c,0xbc,0xd7,0xd7,0x6d,0xc8,0x63,0xb4,
+0x4e,0xb8,0x20,0xa0,0x68,0x1b,0x13,0xda,0x28,0x26,0x51,0x4c,0xd5,0x10,0xf0,0x8f,
+0x35,0x80,0x21,0x56,0xc0,0x57,0xce,0x6a,0x65,0xa4,0x63,0x8f,0x8e,0x1e,0x7a,0x03,
+0xe0,0x97,0xe9,0x19,0x35,0xf4,0x61,0x05,0x9d,0xfd,0xc5,0xf5,0xeb,0x42,0x3c,0x50,
+0xed,0x2c,0x03,0x33,0x8c,0x61,0x0c,0x60,0x46,0x60,0x99,0xce,0x38,0xe0,0x59,0x19,
+0x78,0x06,0x2d,0xa5,0x73,0xa8,0x12,0xe2,0xb7,0x34,0xa4,0x0f,0x2c,0x97,0x45,0xeb,
+0xa0,0x7d,0x67,0xde,0xb0,0x47,0x9a,0xdb,0x51,0x00,0x07,0xc1,0x91,0xb4,0x56,0x1c,
+0x7b,0x36,0xb0,0x51,0x21,0x6e,0x78,0xa8,0x6f,0xe7,0x67,0x1e,0x03,0xa8,0x3b,0xc6,
+0x23,0x07,0x0b,0x47,0xb2,0x2d,0x41,0x2a,0xf3,0x68,0x87,0x68,0xd1,0xf8,0x60,0xfa,
+0x5a,0x7d,0x86,0x11,0xcb,0xf2,0xce,0x24,0x1d,0x3d,0xd0,0x4f,0x81,0x28,0x36,0x31,
+0xdc,0x4f,0x02,0x8b,0x1f,0x17,0x1f,0x96,0x89,0x57,0x11,0x20,0x1e,0xa5,0xd8,0x99,
+0xb8,0x68,0x04,0x67,0x39,0xba,0xd8,0xe8,0xcb,0x9b,0xa3,0x55,0x11,0x9a,0x30,0x06,
+0x72,0x27,0x99,0xe4,0xd4,0x60,0x71,0x99,0xa3,0xa3,0xe7,0x4a,0x19,0xe8,0xa2,0xd5,
+0x6b,0x3f,0x00,0x4c,0x7c,0xba,0xc8,0x44,0xf6,0x6f,0xb6,0xbc,0xf4,0x67,0x9b,0x6a,
+0x80,0x32,0x30,0x30,0xad,0x5d,0x42,0x37,0x28,0x54,0xba,0x34,0xdc,0xbd,0xda,0x82,
+0x74,0x71,0xd1,0x58,0x9f,0xdd,0x44,0xa8,0x64,0xbb,0x90,0xd6,0x6c,0xe6,0x9b,0x04,
+0x33,0x5c,0x6f,0xf5,0x1d,0x67,0xe5,0xbd,0x21,0xa1,0x3f,0x07,0xd2,0x21,0x17,0xdc,
+0x39,0xcd,0x44,0x4d,0x0c,0x2d,0x5b,0xe5,0x5a,0xd5,0xe4,0xfa,0x32,0xd0,0x86,0xb1,
+0x62,0x06,0x5f,0x36,0xd3,0x07,0xaa,0xee,0x80,0x58,0x1a,0x98,0x89,0xa5,0x16,0x5b,
+0xcf,0x09,0x36,0x91,0xba,0x7d,0x1c,0x91,0xbe,0x06,0x16,0x6d,0x69,0xcd,0x58,0x33,
+0x25,0x99,0xd2,0x81,0x2f,0xee,0x38,0x46,0x63,0x08,0xcf,0xe5,0x8d,0xfe,0xb8,0x0c,
+0x50,0x37,0x48,0x4f,0x33,0x58,0x93,0x8d,0x74,0xee,0x7c,0x42,0x2b,0x9d,0x75,0x48,
+0x0a,0xea,0xd8,0x4b,0xab,0x87,0x89,0x76,0xd5,0x04,0x02,0xcd,0xfc,0x34,0x7d,0x94,
+0x71,0xe0,0xa9,0xb2,0x6c,0x4f,0xa9,0x7a,0x78,0xd5,0x6a,0x54,0xd6,0x50,0x3c,0x2b,
+0x68,0xe0,0x4a,0x19,0x56,0xfe,0x1b,0xa6,0x9a,0xdc,0xdb,0x4d,0xbc,0x58,0xfd,0x74,
+0x9d,0x5c,0x7f,0xf0,0x65,0xef,0xe5,0xa7,0x43,0x4d,0xaa,0x2e,0x49,0x51,0x55,0x97,
+0xd5,0x88,0xcd,0xcd,0x16,0xbe,0x21,0xea,0x12,0x8a,0xae,0x68,0xad,0xee,0xa7,0xbd,
+0x64,0x3d,0xb0,0x40,0x20,0x6f,0xf9,0x25,0xbd,0xb5,0xba,0x57,0x3d,0x8c,0xf7,0x02,
+0xb3,0x96,0x57,0xb0,0xf3,0xf8,0x83,0xed,0x68,0x83,0x7e,0xa3,0x07,0xf4,0xbb,0xd8,
+0x91,0xf2,0x9d,0xdf,0x8c,0xf4,0x9b,0x10,0x45,0x42,0xb9,0x22,0xa4,0x30,0x08,0x70,
+0xb2,0x97,0x22,0xd0,0x6e,0x5c,0xb7,0xdc,0x76,0x20,0xaf,0xcd,0xa0,0x2b,0x2b,0xb0,
+0x09,0xef,0x9e,0x7e,0xbe,0xb5,0xcd,0xd6,0xb1,0x5f,0xf9,0x9c,0xa1,0xfc,0xd2,0x17,
+0x58,0x85,0x8a,0xf9,0x71,0x84,0x21,0x4e,0xfa,0x12,0xbb,0xfe,0x28,0x15,0x3c,0xbf,
+0x0d,0xb3,0x49,0x5e,0x63,0x13,0x07,0xd8,0x44,0x2f,0x2d,0x6a,0xf6,0xe9,0x31,0x54,
+0xc8,0x3b,0x5c,0x61,0x31,0x83,0x16,0xed,0xa5,0xb4,0x9b,0x13,0x2c,0xc3,0xba,0x88,
+0xc2,0xba,0x48,0xe2,0xe8,0x9f,0xaa,0x42,0xb3,0x08,0xe8,0xc1,0x82,0x3a,0x2d,0x96,
+0xab,0xd5,0x37,0xbe,0x23,0x70,0x92,0x52,0x7e,0xf7,0x68,0x49,0xb6,0xe9,0x81,0x95,
+0x90,0x49,0xe8,0xd4,0xf5,0x19,0x93,0xa0,0x93,0x87,0x01,0xf8,0x59,0xa2,0x13,0xc4,
+0xf0,0xd9,0xf5,0x5a,0xf6,0x21,0x93,0xd6,0x53,0x4d,0xd1,0x38,0x6d,0x86,0xeb,0xa1,
+0xc4,0xa6,0xe1,0x03,0x8e,0x68,0x61,0xba,0xd2,0x1e,0xe7,0xf9,0x5b,0x38,0xcf,0xaf,
+0xff,0x0b,0xd6,0xf1,0x5b,0x58,0xc7,0xf3,0xff,0x82,0xf5,0xe2,0x4d,0xac,0xe3,0xcf,
+0xcb,0x3a,0xdb,0x6c,0xb3,0x14,0x0d,0xb7,0x59,0x7f,0xd2,0x3a,0x27,0x25,0x79,0x9d,
+0xcf,0xaa,0x25,0x74,0x80,0xcd,0x87,0x38,0x40,0xee,0x93,0x52,0x7b,0xf4,0xfd,0xb1,
+0x57,0xac,0x5c,0x4b,0x37,0x31,0x91,0x6d,0x85,0xd0,0x7e,0x17,0x05,0x9a,0x35,0xcb,
+0xaa,0xdf,0xb1,0xbe,0xd6,0x4f,0x76,0x3b,0x9a,0xe4,0x32,0x04,0xea,0xf8,0x52,0x73,
+0x33,0xe8,0x11,0x4c,0xc7,0x66,0x79,0x27,0x7d,0xd6,0x37,0x96,0xb3,0xa9,0x79,0x35,
+0xc9,0xd9,0xbe,0x71,0xa1,0xe3,0xce,0x2e,0x50,0xf2,0x85,0xcb,0xf6,0x63,0x10,0x7e,
+0x02,0x6f,0xa9,0x2e,0xa3,0x61,0xeb,0xd5,0x16,0xf7,0x60,0x42,0x6b,0xbd,0x21,0xe9,
+0x37,0xda,0xee,0x77,0x18,0x5e,0x4f,0x5d,0xc6,0x1a,0x5e,0xa3,0xaa,0x7e,0xd6,0x36,
+0xd9,0x79,0xd6,0x71,0xdf,0x5f,0xec,0x3e,0x2f,0x20,0xcf,0x69,0x2f,0x45,0x9f,0x2f,
+0x87,0x87,0x13,0x96,0x52,0x66,0xcb,0xec,0xdb,0x60,0xfa,0xf6,0x52,0xdb,0x3f,0x2e,
+0x65,0x4a,0x14,0xf2,0x40,0xef,0xd2,0x3d,0xbc,0x28,0xd5,0x99,0xd0,0x20,0x43,0xce,
+0x87,0x69,0xd3,0x92,0x18,0xed,0x94,0x96,0x6d,0x7c,0xf9,0x14,0xd1,0xcc,0xfc,0xd7,
+0x8d,0x77,0xdb,0xd1,0x7b,0x3d,0xb2,0x6b,0x91,0x3d,0x3b,0x5d,0xc4,0x9b,0xe5,0x22,
+0xf1,0x1a,0xe7,0x8b,0x4d,0xac,0xee,0xd1,0x96,0xc2,0x6c,0xa0,0xa3,0x36,0xb6,0xfd,
+0x1a,0xe2,0xb6,0x63,0xde,0x21,0xd1,0xca,0x1b,0x71,0x0d,0x4e,0xe0,0x4c,0xc5,0xf6,
+0x3c,0xa3,0xae,0xc6,0xd7,0xad,0x55,0xed,0xc0,0xe7,0x16,0xbe,0x23,0x76,0xdd,0x3f,
+0x2c,0x4a,0xef,0x99,0x9c,0xea,0x2e,0xd2,0xb8,0x3a,0xe1,0x1c,0xa9,0x54,0x47,0x6a,
+0xd8,0xed,0x2c,0xa2,0x46,0x4f,0xdb,0x89,0x4f,0xaf,0xcc,0xd1,0x0a,0x7c,0x75,0x46,
+0xb6,0xaf,0x1b,0xe5,0x5a,0x95,0x60,0x9d,0xcf,0x86,0x8c,0x62,0x36,0x0d,0xd6,0x85,
+0x7d,0x03,0x2c,0x6e,0x92,0xcd,0xd7,0xf4,0x16,0xbd,0xb8,0xf2,0x4e,0x07,0xcd,0xff,
+0xdc,0xa8,0x93,0x7f,0x6b,0xd1,0x51,0xaf,0x6e,0x1b,0x96,0xcf,0x68,0xe9,0xc9,0xe9,
+0xd7,0x27,0xcd,0xf2,0x36,0xb3,0xea,0xd8,0xff,0x83,0xa4,0xde,0x59,0xf2,0x3a,0xee,
+0x36,0x32,0x24,0x52,0xb7,0x67,0x9d,0x2e,0x77,0x58,0x61,0xbd,0xd6,0x3d,0x89,0xbc,
+0xb1,0x2e,0xbf,0x77,0x15,0xf7,0x57,0xd8,0xff,0xa5,0xe2,0x11,0x79,0xf9,0x3f,0x09,
+0x95,0x40,0xba,0x52,0xf7,0xf8,0xbc,0x62,0x1e,0x00,0xe6,0xd3,0x3d,0x75,0xc0,0xec,
+0x4f,0xe2,0x0c,0x75,0xa7,0x56,0xee,0xd0,0xca,0x57,0x51,0x1a,0xa9,0x5b,0xd7,0x6c,
+0xd5,0x89,0x0c,0xb0,0xba,0x46,0xa5,0xeb,0x3a,0x4d,0xa8,0x75,0x91,0x66,0x8b,0xd4,
+0xdc,0xad,0xf0,0x4a,0x48,0x5b,0x41,0xda,0x00,0x68,0x0f,0x4a,0x02,0x8e,0x38,0x02,
+0x3e,0x6b,0xad,0xea,0x03,0x3e,0xb5,0x13,0xf7,0xb6,0xf9,0x40,0xec,0xbd,0x69,0xd4,
+0x9d,0x15,0xda,0x98,0x8b,0x5d,0xbc,0x79,0x35,0xb5,0x3b,0xf4,0x82,0x85,0xb5,0x38,
+0x28,0x20,0xae,0xd2,0xbd,0xc6,0x3c,0x7c,0xb4,0xfc,0xec,0x11,0x3a,0x69,0x2c,0x6f,
+0x12,0x18,0xcb,0x77,0x4e,0xcf,0x07,0x7a,0x35,0xd3,0x25,0x87,0x55,0x34,0x3e,0xbc,
+0x5b,0x44,0xe3,0x9e,0xd0,0x3b,0x8c,0x0a,0xd6,0xe0,0x91,0x4d,0xd5,0xa0,0x36,0xe1,
+0xd4,0x6e,0x76,0xfa,0xdd,0x40,0x1f,0xf2,0xcc,0x0f,0x3e,0x34,0x38,0x87,0xa1,0x70,
+0x9b,0x45,0x7f,0x03,0xa4,0x54,0xfb,0x9c,0xe2,0x1a,0x00,0x00,};
 
 static const unsigned int dummy_align__deviceInfo_shtml = 1;
 static const unsigned char data__deviceInfo_shtml[] = {
@@ -3324,27 +2123,30 @@ static const unsigned char data__deviceInfo_shtml[] = {
 0x6c,0x00,0x00,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
+/* "HTTP/1.0 200 OK
 " (17 bytes) */
 0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
-/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
+/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
 " (63 bytes) */
 0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
 0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
 0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
 0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-/* "Content-type: text/html
-Expires: Fri, 10 Apr 2008 14:00:00 GMT
-Pragma: no-cache
-
-" (85 bytes) */
+/* "Content-type: text/html
+" (25 bytes) */
 0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
-0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,0x45,0x78,0x70,0x69,0x72,0x65,0x73,
-0x3a,0x20,0x46,0x72,0x69,0x2c,0x20,0x31,0x30,0x20,0x41,0x70,0x72,0x20,0x32,0x30,
-0x30,0x38,0x20,0x31,0x34,0x3a,0x30,0x30,0x3a,0x30,0x30,0x20,0x47,0x4d,0x54,0x0d,
-0x0a,0x50,0x72,0x61,0x67,0x6d,0x61,0x3a,0x20,0x6e,0x6f,0x2d,0x63,0x61,0x63,0x68,
-0x65,0x0d,0x0a,0x0d,0x0a,
+0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,
+/* "Expires: Fri, 10 Apr 2008 14:00:00 GMT
+" (40 bytes) */
+0x45,0x78,0x70,0x69,0x72,0x65,0x73,0x3a,0x20,0x46,0x72,0x69,0x2c,0x20,0x31,0x30,
+0x20,0x41,0x70,0x72,0x20,0x32,0x30,0x30,0x38,0x20,0x31,0x34,0x3a,0x30,0x30,0x3a,
+0x30,0x30,0x20,0x47,0x4d,0x54,0x0d,0x0a,
+/* "Pragma: no-cache
+
+" (20 bytes) */
+0x50,0x72,0x61,0x67,0x6d,0x61,0x3a,0x20,0x6e,0x6f,0x2d,0x63,0x61,0x63,0x68,0x65,
+0x0d,0x0a,0x0d,0x0a,
 /* raw file data (2036 bytes) */
 0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0a,
 0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0a,0x09,0x3c,0x68,0x65,0x61,0x64,0x3e,0x0a,0x09,
@@ -3481,426 +2283,134 @@ static const unsigned char data__ethCfg_shtml[] = {
 0x2f,0x65,0x74,0x68,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x00,0x00,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
+/* "HTTP/1.0 200 OK
 " (17 bytes) */
 0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
-/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
+/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
 " (63 bytes) */
 0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
 0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
 0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
 0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-/* "Content-type: text/html
-Expires: Fri, 10 Apr 2008 14:00:00 GMT
-Pragma: no-cache
-
-" (85 bytes) */
+/* "Content-type: text/html
+" (25 bytes) */
 0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
-0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,0x45,0x78,0x70,0x69,0x72,0x65,0x73,
-0x3a,0x20,0x46,0x72,0x69,0x2c,0x20,0x31,0x30,0x20,0x41,0x70,0x72,0x20,0x32,0x30,
-0x30,0x38,0x20,0x31,0x34,0x3a,0x30,0x30,0x3a,0x30,0x30,0x20,0x47,0x4d,0x54,0x0d,
-0x0a,0x50,0x72,0x61,0x67,0x6d,0x61,0x3a,0x20,0x6e,0x6f,0x2d,0x63,0x61,0x63,0x68,
-0x65,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (6364 bytes) */
-0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0a,
-0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0a,0x09,0x3c,0x68,0x65,0x61,0x64,0x3e,0x0a,0x09,
-0x09,0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,0x74,0x3d,0x22,
-0x55,0x54,0x46,0x2d,0x38,0x22,0x20,0x2f,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x3c,0x74,0x69,0x74,0x6c,0x65,0x3e,0x4f,0x70,0x65,0x6e,0x52,0x54,0x4b,
-0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x6c,0x69,0x6e,0x6b,0x20,0x72,0x65,0x6c,0x3d,0x22,0x73,0x74,0x79,0x6c,
-0x65,0x73,0x68,0x65,0x65,0x74,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,
-0x78,0x74,0x2f,0x63,0x73,0x73,0x22,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x63,0x73,
-0x73,0x2f,0x73,0x74,0x79,0x6c,0x65,0x2e,0x63,0x73,0x73,0x22,0x20,0x2f,0x3e,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x75,0x6e,
-0x63,0x74,0x69,0x6f,0x6e,0x20,0x24,0x28,0x69,0x64,0x29,0x20,0x7b,0x20,0x72,0x65,
-0x74,0x75,0x72,0x6e,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,
-0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x69,0x64,0x29,
-0x3b,0x20,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x65,0x74,0x68,0x43,0x6f,0x6e,
-0x66,0x69,0x67,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x28,0x6f,0x29,0x20,0x7b,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x64,0x68,0x63,0x70,0x20,0x3d,0x3d,0x20,0x30,
-0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x64,0x68,0x63,0x70,0x27,
-0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x4f,
-0x4e,0x27,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x24,0x28,0x27,0x64,0x68,0x63,0x70,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,
-0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x4f,0x46,0x46,0x27,0x3b,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x69,0x70,0x27,0x29,0x29,0x20,0x24,0x28,0x27,
-0x69,0x70,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,
-0x20,0x6f,0x2e,0x69,0x70,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x6e,0x65,
-0x74,0x6d,0x61,0x73,0x6b,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x6e,0x65,0x74,0x6d,
-0x61,0x73,0x6b,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,
-0x3d,0x20,0x6f,0x2e,0x6e,0x65,0x74,0x6d,0x61,0x73,0x6b,0x3b,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
-0x28,0x24,0x28,0x27,0x67,0x61,0x74,0x65,0x77,0x61,0x79,0x27,0x29,0x29,0x20,0x24,
-0x28,0x27,0x67,0x61,0x74,0x65,0x77,0x61,0x79,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,
-0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x6f,0x2e,0x67,0x61,0x74,0x65,0x77,0x61,
-0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x6d,0x61,0x63,0x27,0x29,0x29,
-0x20,0x24,0x28,0x27,0x6d,0x61,0x63,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,
-0x65,0x78,0x74,0x20,0x3d,0x20,0x6f,0x2e,0x6d,0x61,0x63,0x3b,0x0a,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
-0x20,0x28,0x24,0x28,0x27,0x73,0x74,0x61,0x74,0x69,0x63,0x49,0x70,0x27,0x29,0x29,
-0x20,0x24,0x28,0x27,0x73,0x74,0x61,0x74,0x69,0x63,0x49,0x70,0x27,0x29,0x2e,0x76,
-0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x73,0x49,0x70,0x3b,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
-0x20,0x28,0x24,0x28,0x27,0x73,0x74,0x61,0x74,0x69,0x63,0x4e,0x65,0x74,0x6d,0x61,
-0x73,0x6b,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x73,0x74,0x61,0x74,0x69,0x63,0x4e,
-0x65,0x74,0x6d,0x61,0x73,0x6b,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,
-0x20,0x6f,0x2e,0x73,0x4e,0x65,0x74,0x6d,0x61,0x73,0x6b,0x3b,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
-0x28,0x24,0x28,0x27,0x73,0x74,0x61,0x74,0x69,0x63,0x47,0x61,0x74,0x65,0x77,0x61,
-0x79,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x73,0x74,0x61,0x74,0x69,0x63,0x47,0x61,
-0x74,0x65,0x77,0x61,0x79,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,
-0x6f,0x2e,0x73,0x47,0x61,0x74,0x65,0x77,0x61,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
-0x6f,0x2e,0x64,0x68,0x63,0x70,0x20,0x3d,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x24,0x28,0x27,0x65,0x74,0x68,0x6d,0x6f,0x64,0x65,0x27,0x29,0x2e,
-0x6f,0x70,0x74,0x69,0x6f,0x6e,0x73,0x5b,0x30,0x5d,0x2e,0x73,0x65,0x6c,0x65,0x63,
-0x74,0x65,0x64,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x24,0x28,0x22,0x73,0x74,0x61,0x74,0x69,0x63,0x49,0x70,0x22,0x29,0x2e,0x64,0x69,
-0x73,0x61,0x62,0x6c,0x65,0x64,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x24,0x28,0x22,0x73,0x74,0x61,0x74,0x69,0x63,0x4e,0x65,0x74,0x6d,
-0x61,0x73,0x6b,0x22,0x29,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x20,0x3d,
-0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x22,0x73,0x74,
-0x61,0x74,0x69,0x63,0x47,0x61,0x74,0x65,0x77,0x61,0x79,0x22,0x29,0x2e,0x64,0x69,
-0x73,0x61,0x62,0x6c,0x65,0x64,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
-0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x65,
-0x74,0x68,0x6d,0x6f,0x64,0x65,0x27,0x29,0x2e,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x73,
-0x5b,0x31,0x5d,0x2e,0x73,0x65,0x6c,0x65,0x63,0x74,0x65,0x64,0x20,0x3d,0x20,0x74,
-0x72,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x22,0x73,0x74,0x61,0x74,
-0x69,0x63,0x49,0x70,0x22,0x29,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x20,
-0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x22,
-0x73,0x74,0x61,0x74,0x69,0x63,0x4e,0x65,0x74,0x6d,0x61,0x73,0x6b,0x22,0x29,0x2e,
-0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,
-0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x22,0x73,0x74,0x61,0x74,0x69,0x63,0x47,
-0x61,0x74,0x65,0x77,0x61,0x79,0x22,0x29,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,
-0x64,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x3b,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,
-0x20,0x65,0x74,0x68,0x53,0x75,0x6d,0x6d,0x61,0x72,0x79,0x43,0x61,0x6c,0x6c,0x62,
-0x61,0x63,0x6b,0x28,0x6f,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x64,
-0x68,0x63,0x70,0x20,0x3d,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x24,0x28,0x27,0x64,0x68,0x63,0x70,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,
-0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x4f,0x4e,0x27,0x3b,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,
-0x73,0x65,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x64,0x68,0x63,0x70,
-0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,
-0x4f,0x46,0x46,0x27,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x69,
-0x70,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x69,0x70,0x27,0x29,0x2e,0x69,0x6e,0x6e,
-0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x6f,0x2e,0x69,0x70,0x3b,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
-0x66,0x20,0x28,0x24,0x28,0x27,0x6e,0x65,0x74,0x6d,0x61,0x73,0x6b,0x27,0x29,0x29,
-0x20,0x24,0x28,0x27,0x6e,0x65,0x74,0x6d,0x61,0x73,0x6b,0x27,0x29,0x2e,0x69,0x6e,
-0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x6f,0x2e,0x6e,0x65,0x74,0x6d,
-0x61,0x73,0x6b,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x67,0x61,0x74,0x65,
-0x77,0x61,0x79,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x67,0x61,0x74,0x65,0x77,0x61,
-0x79,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,
-0x6f,0x2e,0x67,0x61,0x74,0x65,0x77,0x61,0x79,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x72,0x65,
-0x66,0x4e,0x65,0x77,0x28,0x29,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x78,0x68,0x72,0x3b,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x69,0x66,0x28,0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x58,0x4d,0x4c,0x48,0x74,
-0x74,0x70,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x29,0x7b,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x78,0x68,0x72,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x58,0x4d,0x4c,0x48,0x74,0x74,
-0x70,0x52,0x65,0x71,0x75,0x65,0x73,0x74,0x28,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x65,0x6c,0x73,
-0x65,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x78,0x68,0x72,0x20,0x3d,0x20,0x6e,0x65,0x77,
-0x20,0x41,0x63,0x74,0x69,0x76,0x65,0x58,0x4f,0x62,0x6a,0x65,0x63,0x74,0x28,0x27,
-0x4d,0x69,0x63,0x72,0x6f,0x73,0x6f,0x66,0x74,0x2e,0x58,0x4d,0x4c,0x48,0x54,0x54,
-0x50,0x27,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x78,0x68,0x72,0x2e,0x6f,0x6e,0x72,0x65,0x61,
-0x64,0x79,0x73,0x74,0x61,0x74,0x65,0x63,0x68,0x61,0x6e,0x67,0x65,0x20,0x3d,0x20,
-0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x69,0x66,0x28,0x78,0x68,0x72,0x2e,0x72,0x65,0x61,0x64,0x79,0x53,0x74,0x61,0x74,
-0x65,0x20,0x3d,0x3d,0x3d,0x20,0x34,0x29,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x69,0x66,0x28,0x78,0x68,0x72,0x2e,0x73,0x74,0x61,0x74,0x75,0x73,0x20,
-0x3d,0x3d,0x20,0x32,0x30,0x30,0x29,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x65,0x76,0x61,0x6c,0x28,0x78,0x68,0x72,0x2e,0x72,0x65,
-0x73,0x70,0x6f,0x6e,0x73,0x65,0x54,0x65,0x78,0x74,0x29,0x3b,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x78,
-0x68,0x72,0x2e,0x6f,0x70,0x65,0x6e,0x28,0x27,0x67,0x65,0x74,0x27,0x2c,0x20,0x27,
-0x65,0x74,0x68,0x53,0x75,0x6d,0x6d,0x61,0x72,0x79,0x2e,0x6a,0x73,0x27,0x2c,0x20,
-0x74,0x72,0x75,0x65,0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x78,0x68,0x72,0x2e,0x73,0x65,0x6e,0x64,0x28,
-0x29,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,
-0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,0x3c,0x2f,0x68,0x65,0x61,0x64,0x3e,0x0a,0x20,
-0x20,0x20,0x20,0x0a,0x20,0x20,0x20,0x20,0x3c,0x62,0x6f,0x64,0x79,0x20,0x6f,0x6e,
-0x6c,0x6f,0x61,0x64,0x3d,0x22,0x6a,0x61,0x76,0x61,0x73,0x63,0x72,0x69,0x70,0x74,
-0x3a,0x73,0x65,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,0x27,0x72,0x65,
-0x66,0x4e,0x65,0x77,0x28,0x29,0x27,0x2c,0x20,0x31,0x30,0x30,0x30,0x30,0x29,0x22,
-0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x65,0x61,0x64,0x65,
-0x72,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x64,0x72,0x6f,0x70,0x73,
-0x2d,0x74,0x6f,0x70,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x61,0x3e,0x41,0x63,0x65,0x69,0x6e,0x6e,0x61,0x20,0x4f,0x70,
-0x65,0x6e,0x52,0x54,0x4b,0x3c,0x2f,0x61,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x3c,0x2f,0x68,0x65,0x61,0x64,0x65,0x72,0x3e,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,
-0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x74,0x61,0x69,0x6e,
-0x65,0x72,0x22,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x22,0x3e,0x20,0x20,0x0a,0x09,0x09,0x09,
-0x09,0x3c,0x68,0x65,0x61,0x64,0x65,0x72,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x6d,0x65,0x6e,0x75,0x5f,0x68,0x65,0x61,0x64,0x65,0x72,0x22,0x3e,0x20,0x20,0x0a,
-0x09,0x09,0x09,0x09,0x09,0x3c,0x68,0x31,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x6d,0x65,0x6e,0x75,0x5f,0x68,0x65,0x61,0x64,0x65,0x72,0x5f,0x74,0x69,0x74,0x6c,
-0x65,0x22,0x3e,0x4d,0x45,0x4e,0x55,0x3c,0x2f,0x68,0x31,0x3e,0x0a,0x09,0x09,0x09,
-0x09,0x3c,0x2f,0x68,0x65,0x61,0x64,0x65,0x72,0x3e,0x0a,0x09,0x09,0x09,0x09,0x3c,
-0x75,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x62,
-0x6f,0x64,0x79,0x22,0x3e,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,
-0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,
-0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x72,0x75,0x6e,0x53,0x74,0x61,
-0x74,0x75,0x73,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,
-0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,
-0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x52,0x75,0x6e,0x6e,0x69,
-0x6e,0x67,0x20,0x53,0x74,0x61,0x74,0x75,0x73,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,
-0x69,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,
-0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,
-0x68,0x72,0x65,0x66,0x3d,0x22,0x77,0x6f,0x72,0x6b,0x43,0x66,0x67,0x2e,0x73,0x68,
-0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,
-0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x57,0x6f,0x72,0x6b,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,
-0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,
-0x65,0x66,0x3d,0x22,0x75,0x73,0x65,0x72,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,
-0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,
-0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,
-0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,
-0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,
-0x3d,0x22,0x65,0x74,0x68,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,
-0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,
-0x5f,0x6c,0x69,0x6e,0x6b,0x20,0x69,0x73,0x2d,0x61,0x63,0x74,0x69,0x76,0x65,0x22,
-0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x45,0x74,0x68,0x65,0x72,0x6e,
-0x65,0x74,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,
-0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,
-0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,
-0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x64,0x65,0x76,
-0x69,0x63,0x65,0x49,0x6e,0x66,0x6f,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,
-0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,
-0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x44,
-0x65,0x76,0x69,0x63,0x65,0x20,0x49,0x6e,0x66,0x6f,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,
-0x6c,0x69,0x3e,0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,0x75,0x6c,0x3e,0x0a,0x09,0x09,
-0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-0x22,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x77,0x72,0x61,0x70,0x22,0x3e,0x0a,
-0x09,0x09,0x09,0x09,0x3c,0x68,0x65,0x61,0x64,0x65,0x72,0x3e,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x68,0x31,0x3e,0x45,0x74,0x68,0x65,0x72,0x6e,0x65,0x74,0x3c,0x2f,0x68,
-0x31,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x2f,0x68,0x65,0x61,0x64,0x65,0x72,0x3e,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x72,
-0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,
-0x64,0x74,0x68,0x3a,0x35,0x30,0x30,0x70,0x78,0x3b,0x20,0x66,0x6c,0x6f,0x61,0x74,
-0x3a,0x6c,0x65,0x66,0x74,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x73,0x75,0x62,0x62,0x6c,0x6f,0x63,0x6b,
-0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x31,0x3e,0x53,
-0x75,0x6d,0x6d,0x61,0x72,0x79,0x3c,0x2f,0x68,0x31,0x3e,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,
-0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,
-0x6c,0x5f,0x31,0x22,0x3e,0x44,0x48,0x43,0x50,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,
-0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x64,0x68,0x63,0x70,
-0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x49,0x50,0x20,0x41,
-0x64,0x64,0x72,0x65,0x73,0x73,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,
-0x74,0x65,0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x69,0x70,0x22,0x3e,0x3c,0x2f,0x74,
-0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,
-0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,
-0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x4e,0x65,0x74,0x6d,0x61,0x73,0x6b,0x3a,0x3c,
-0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x20,0x69,0x64,0x3d,
-0x22,0x6e,0x65,0x74,0x6d,0x61,0x73,0x6b,0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,
-0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,
-0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,
-0x5f,0x31,0x22,0x3e,0x47,0x61,0x74,0x65,0x77,0x61,0x79,0x3a,0x3c,0x2f,0x6c,0x61,
-0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x67,0x61,
-0x74,0x65,0x77,0x61,0x79,0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,
-0x70,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,
-0x3e,0x4d,0x41,0x43,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,
-0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x6d,0x61,0x63,0x22,0x3e,0x3c,0x2f,0x74,0x65,
-0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x72,0x3e,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-0x22,0x73,0x75,0x62,0x62,0x6c,0x6f,0x63,0x6b,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x68,0x31,0x3e,0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,
-0x65,0x3c,0x2f,0x68,0x31,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,
-0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x66,0x6f,0x72,0x6d,0x20,0x69,0x64,0x3d,0x27,
-0x45,0x74,0x68,0x6e,0x65,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x27,0x20,0x6d,0x65,
-0x74,0x68,0x6f,0x64,0x3d,0x27,0x50,0x4f,0x53,0x54,0x27,0x20,0x61,0x63,0x74,0x69,
-0x6f,0x6e,0x3d,0x27,0x65,0x74,0x68,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x63,0x67,
-0x69,0x27,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,
-0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,
-0x65,0x6c,0x5f,0x31,0x22,0x3e,0x4d,0x4f,0x44,0x45,0x3a,0x3c,0x2f,0x6c,0x61,0x62,
-0x65,0x6c,0x3e,0x3c,0x73,0x65,0x6c,0x65,0x63,0x74,0x20,0x69,0x64,0x3d,0x22,0x65,
-0x74,0x68,0x6d,0x6f,0x64,0x65,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x65,0x74,
-0x68,0x6d,0x6f,0x64,0x65,0x22,0x20,0x6f,0x6e,0x63,0x68,0x61,0x6e,0x67,0x65,0x3d,
-0x22,0x63,0x68,0x61,0x6e,0x67,0x65,0x5f,0x65,0x74,0x68,0x6d,0x6f,0x64,0x65,0x28,
-0x29,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x22,
-0x30,0x22,0x3e,0x44,0x48,0x43,0x50,0x3c,0x2f,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x3e,
-0x3c,0x6f,0x70,0x74,0x69,0x6f,0x6e,0x20,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x22,
-0x31,0x22,0x3e,0x53,0x54,0x41,0x54,0x49,0x43,0x3c,0x2f,0x6f,0x70,0x74,0x69,0x6f,
-0x6e,0x3e,0x3c,0x2f,0x73,0x65,0x6c,0x65,0x63,0x74,0x3e,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x2f,0x70,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,
-0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x53,0x54,0x41,0x54,0x49,
-0x43,0x20,0x49,0x50,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,
-0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,
-0x69,0x64,0x3d,0x27,0x73,0x74,0x61,0x74,0x69,0x63,0x49,0x70,0x27,0x20,0x6e,0x61,
-0x6d,0x65,0x3d,0x27,0x73,0x74,0x61,0x74,0x69,0x63,0x49,0x70,0x27,0x20,0x73,0x69,
-0x7a,0x65,0x3d,0x27,0x31,0x38,0x27,0x20,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,
-0x3d,0x74,0x72,0x75,0x65,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x53,0x54,
-0x41,0x54,0x49,0x43,0x20,0x4e,0x45,0x54,0x4d,0x41,0x53,0x4b,0x3a,0x3c,0x2f,0x6c,
-0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,
-0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x73,0x74,0x61,0x74,
-0x69,0x63,0x4e,0x65,0x74,0x6d,0x61,0x73,0x6b,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-0x27,0x73,0x74,0x61,0x74,0x69,0x63,0x4e,0x65,0x74,0x6d,0x61,0x73,0x6b,0x27,0x20,
-0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,0x27,0x20,0x64,0x69,0x73,0x61,0x62,0x6c,
-0x65,0x64,0x3d,0x74,0x72,0x75,0x65,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,
-0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,
-0x53,0x54,0x41,0x54,0x49,0x43,0x20,0x47,0x41,0x54,0x45,0x57,0x41,0x59,0x3a,0x3c,
-0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,
-0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x73,0x74,
-0x61,0x74,0x69,0x63,0x47,0x61,0x74,0x65,0x77,0x61,0x79,0x27,0x20,0x6e,0x61,0x6d,
-0x65,0x3d,0x27,0x73,0x74,0x61,0x74,0x69,0x63,0x47,0x61,0x74,0x65,0x77,0x61,0x79,
-0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,0x27,0x20,0x64,0x69,0x73,0x61,
-0x62,0x6c,0x65,0x64,0x3d,0x74,0x72,0x75,0x65,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x72,0x3e,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x73,0x61,
-0x76,0x65,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x69,0x6e,0x70,0x75,
-0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,
-0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x73,0x75,0x62,0x6d,0x69,0x74,0x27,0x20,0x76,
-0x61,0x6c,0x75,0x65,0x3d,0x27,0x53,0x41,0x56,0x45,0x27,0x2f,0x3e,0x3c,0x2f,0x70,
-0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x66,0x6f,0x72,0x6d,0x3e,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,
-0x69,0x76,0x3e,0x0a,0x09,0x09,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x0a,0x09,0x09,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x20,
-0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x2f,0x6a,0x61,0x76,0x61,0x73,
-0x63,0x72,0x69,0x70,0x74,0x22,0x3e,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x63,0x68,0x61,
-0x6e,0x67,0x65,0x5f,0x65,0x74,0x68,0x6d,0x6f,0x64,0x65,0x28,0x29,0x7b,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
-0x66,0x20,0x28,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,
-0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x65,0x74,0x68,0x6d,
-0x6f,0x64,0x65,0x22,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x3d,0x20,0x30,
-0x29,0x20,0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,
-0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,
-0x22,0x73,0x74,0x61,0x74,0x69,0x63,0x49,0x70,0x22,0x29,0x2e,0x64,0x69,0x73,0x61,
-0x62,0x6c,0x65,0x64,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,
-0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x73,0x74,0x61,0x74,0x69,0x63,
-0x4e,0x65,0x74,0x6d,0x61,0x73,0x6b,0x22,0x29,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,
-0x65,0x64,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
-0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,
-0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x73,0x74,0x61,0x74,0x69,0x63,0x47,0x61,
-0x74,0x65,0x77,0x61,0x79,0x22,0x29,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,
-0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,
-0x7b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,
-0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x73,
-0x74,0x61,0x74,0x69,0x63,0x49,0x70,0x22,0x29,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,
-0x65,0x64,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,
-0x65,0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x73,0x74,0x61,0x74,0x69,0x63,0x4e,
-0x65,0x74,0x6d,0x61,0x73,0x6b,0x22,0x29,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,
-0x64,0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
-0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,
-0x6e,0x74,0x42,0x79,0x49,0x64,0x28,0x22,0x73,0x74,0x61,0x74,0x69,0x63,0x47,0x61,
-0x74,0x65,0x77,0x61,0x79,0x22,0x29,0x2e,0x64,0x69,0x73,0x61,0x62,0x6c,0x65,0x64,
-0x20,0x3d,0x20,0x66,0x61,0x6c,0x73,0x65,0x3b,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0a,0x09,0x09,0x3c,0x2f,0x73,0x63,
-0x72,0x69,0x70,0x74,0x3e,0x0a,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x73,0x63,0x72,0x69,0x70,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,
-0x74,0x2f,0x6a,0x61,0x76,0x61,0x73,0x63,0x72,0x69,0x70,0x74,0x27,0x20,0x73,0x72,
-0x63,0x3d,0x27,0x65,0x74,0x68,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x6a,0x73,0x27,
-0x3e,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0a,0x09,0x3c,0x2f,0x62,0x6f,
-0x64,0x79,0x3e,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,0x0a,};
+0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,
+/* "Cache-Control: no-cache
+" (25 bytes) */
+0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x3a,0x20,0x6e,
+0x6f,0x2d,0x63,0x61,0x63,0x68,0x65,0x0d,0x0a,
+/* "ETag: "8576c7de"
+" (18 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x38,0x35,0x37,0x36,0x63,0x37,0x64,0x65,0x22,
+0x0d,0x0a,
+/* "Content-Encoding: gzip
+" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x45,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,
+0x3a,0x20,0x67,0x7a,0x69,0x70,0x0d,0x0a,
+/* "Vary: Accept-Encoding
+" (23 bytes) */
+0x56,0x61,0x72,0x79,0x3a,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2d,0x45,0x6e,0x63,
+0x6f,0x64,0x69,0x6e,0x67,0x0d,0x0a,
+/* "Content-Length: 1463
+
+" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x31,0x34,0x36,0x33,0x0d,0x0a,0x0d,0x0a,
+/* gzip file data (1463 bytes) */
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xed,0x59,0x6d,0x6f,0xe2,0x46,
+0x10,0xfe,0x9c,0xfc,0x8a,0xad,0x75,0x92,0x41,0x6a,0x6c,0x52,0xb5,0xd2,0x29,0x18,
+0x4b,0x94,0x90,0x1c,0xba,0xe6,0x45,0x81,0xf4,0xee,0x54,0x55,0xd1,0x62,0x2f,0xb0,
+0x89,0xbd,0xf6,0x79,0xd7,0x10,0x5a,0xe5,0xbf,0x77,0xd6,0x6b,0xfc,0x42,0x6c,0x20,
+0x90,0x4a,0xfd,0x50,0x7f,0xc1,0x3b,0xbb,0xf3,0xf8,0xd9,0xf1,0xcc,0x78,0x76,0xb0,
+0x7e,0x38,0xbf,0xe9,0x8d,0xbe,0xdd,0xf6,0xd1,0x4c,0xf8,0x9e,0x7d,0x6c,0xa9,0x9f,
+0x23,0x6b,0x46,0xb0,0x0b,0xbf,0x47,0x96,0x4f,0x04,0x46,0xce,0x0c,0x47,0x9c,0x88,
+0x8e,0x76,0x3f,0xba,0x38,0xf9,0xa8,0x21,0xd3,0x3e,0x46,0xe9,0x65,0x09,0x2a,0x3c,
+0x62,0xdf,0x84,0x84,0xdd,0x8d,0x3e,0x5b,0xa6,0x1a,0xe6,0xd3,0x1e,0x65,0x4f,0x28,
+0x22,0x5e,0x47,0xe3,0x62,0xe9,0x11,0x3e,0x23,0x44,0x68,0x48,0x2c,0x43,0xd2,0xd1,
+0x04,0x79,0x16,0xa6,0xc3,0xb9,0x86,0x66,0x11,0x99,0x74,0x34,0xb8,0x35,0x93,0x55,
+0x46,0x22,0x2c,0x3e,0x85,0x3b,0x11,0x0d,0x45,0x2e,0x90,0xd7,0x24,0x66,0x8e,0xa0,
+0x01,0x43,0x1f,0x1a,0xd4,0x6d,0xa2,0xbf,0xe1,0x31,0x22,0x8e,0x18,0x72,0x03,0x27,
+0xf6,0x09,0x13,0xc6,0x94,0x88,0xbe,0x47,0xe4,0xed,0xaf,0xcb,0x81,0x2b,0x17,0xb5,
+0xd1,0x4b,0xbb,0x1a,0x83,0x88,0x59,0x2f,0x60,0x13,0x3a,0xed,0x61,0xcf,0x1b,0x63,
+0xe7,0xa9,0x11,0x00,0x64,0x69,0xad,0xbc,0xe8,0x04,0x35,0x02,0xc3,0x9d,0x39,0x21,
+0xea,0x74,0x50,0xab,0x6a,0x89,0xbc,0x3e,0x34,0x74,0xb9,0x46,0x6f,0x1a,0x94,0x31,
+0x12,0x8d,0x60,0xa3,0xa8,0x83,0xf4,0x9b,0x6b,0xbd,0xfd,0x6a,0xfd,0x0b,0x22,0x1e,
+0x27,0x6f,0x04,0xba,0xb8,0xa8,0x42,0xaa,0xa4,0x0b,0x10,0x14,0x00,0x9a,0x28,0xbd,
+0x29,0x21,0x05,0x06,0x0d,0xdb,0x75,0x6a,0x8c,0x08,0x1f,0xf3,0xa7,0x54,0x37,0x1b,
+0xad,0x01,0xa4,0xf2,0x5a,0x94,0x29,0x16,0x64,0x81,0x97,0x29,0x4a,0x36,0x5a,0x43,
+0x49,0xe5,0xb5,0x28,0x3e,0x76,0x52,0x84,0xe4,0x6e,0x4d,0x1b,0x64,0xed,0xe3,0x3a,
+0x55,0x2e,0xb0,0xa0,0xce,0x60,0x65,0x83,0x7c,0x68,0xcc,0xb1,0x17,0x93,0x04,0x80,
+0x0f,0xea,0xcd,0xa0,0x14,0xae,0x4b,0xc6,0x58,0x93,0x15,0x91,0xae,0xb7,0xd8,0x43,
+0xa9,0x5e,0x96,0xac,0xb2,0x26,0x2b,0xc2,0x5d,0x6e,0x32,0xcc,0x6e,0xae,0x08,0xbe,
+0xed,0x07,0x2e,0x01,0xdc,0x20,0x94,0xce,0xce,0xff,0x68,0xfd,0x69,0x70,0xe2,0x11,
+0x47,0x10,0x17,0x9e,0x22,0xa2,0x98,0xb4,0x6b,0x94,0xb5,0x95,0xb9,0xb4,0xa6,0xe1,
+0x52,0x8e,0xc7,0xde,0xae,0x2a,0xa9,0x1d,0xde,0xac,0x97,0x6e,0x78,0x17,0xbd,0x6d,
+0xa1,0xf3,0x7a,0xe3,0xa7,0x87,0x6e,0x7c,0x82,0xe1,0x89,0xfb,0xec,0x7c,0x17,0xc5,
+0xca,0xad,0xd7,0x28,0x96,0x83,0x7d,0x43,0x5a,0x1b,0xc6,0xbe,0x8f,0xa3,0xe5,0xff,
+0x79,0xed,0xbf,0x93,0xd7,0x5e,0xaa,0x5f,0x16,0x7c,0x04,0xaf,0xc9,0xa2,0xd1,0x7c,
+0x6d,0xb2,0x39,0x8e,0xd0,0xf3,0x2c,0xaa,0xe2,0xd2,0x58,0x50,0xe6,0x06,0x0b,0xe3,
+0xeb,0xd5,0x6f,0x9f,0x84,0x08,0xef,0xc8,0xf7,0x98,0x70,0xd1,0xac,0x36,0x3b,0x60,
+0x00,0x2b,0x46,0x16,0xa8,0xbc,0xbc,0xd1,0xac,0xb0,0xba,0x7c,0x7d,0xdb,0x60,0xba,
+0xc0,0x7c,0x4e,0xbe,0xde,0x8c,0x1f,0x21,0xa6,0x1a,0xfa,0x15,0x75,0xa2,0x80,0x07,
+0x13,0x91,0xd0,0x19,0x8d,0x6e,0xf5,0xe6,0x2e,0xaf,0x13,0xf0,0x8c,0x80,0x45,0x50,
+0x73,0x2c,0x65,0x20,0x10,0xa8,0x37,0xd8,0x54,0xe6,0xbf,0x95,0x69,0x1a,0x35,0xfb,
+0x81,0xed,0x4b,0xdd,0x44,0x73,0x28,0x35,0xc1,0x7b,0x3b,0xe8,0xe7,0x9a,0xd5,0x05,
+0x0d,0xf9,0x98,0x98,0x4b,0x5f,0xff,0xa9,0xd5,0xda,0xb0,0x5c,0x5e,0x04,0xb2,0x71,
+0xfa,0x18,0x1e,0x42,0x12,0x21,0xf2,0xe5,0x36,0xdb,0xb5,0x3a,0x2f,0xc7,0xbb,0x49,
+0x6b,0xec,0x00,0x95,0x14,0xb8,0x13,0x11,0xfa,0x8f,0x48,0xcf,0xc3,0xd7,0x78,0xe4,
+0x20,0x90,0x09,0xab,0xe2,0xc9,0xc9,0x8e,0x08,0x73,0xd7,0x5f,0x63,0xfe,0x04,0xcb,
+0x2c,0x56,0x50,0x96,0xa9,0xea,0x3b,0x79,0xaf,0x04,0xe3,0xc0,0x5d,0xa2,0x80,0x79,
+0x01,0x76,0x3b,0xda,0x23,0x9e,0x63,0xb5,0xfc,0x0c,0xaa,0xbe,0x01,0x13,0x24,0x92,
+0x26,0xd0,0x57,0xfe,0x09,0x44,0x4e,0x5b,0x70,0x35,0xb5,0x42,0x85,0x26,0x11,0x49,
+0x84,0x1c,0x0f,0x73,0x0e,0xa5,0x5c,0xe0,0x46,0x41,0xc8,0x4f,0x44,0x10,0x6a,0xe5,
+0xaa,0xcd,0xc2,0x76,0xd7,0x21,0x10,0x24,0x18,0x65,0x45,0x23,0x2e,0xe0,0x98,0x0a,
+0x28,0x97,0xe4,0x53,0x2e,0x9d,0xe7,0xf8,0x4c,0x60,0x0a,0x81,0xa6,0xc9,0x2a,0xf5,
+0xa8,0x38,0x05,0xf5,0x5e,0xac,0xd9,0xa0,0x77,0x24,0x27,0xca,0xb4,0xe4,0xdc,0x83,
+0x12,0x65,0x4b,0x60,0xcd,0x69,0xc5,0xfc,0x43,0x52,0xc9,0x6a,0xf6,0x55,0xff,0xfa,
+0x1e,0x48,0x9d,0xda,0x0a,0x2f,0xa3,0x97,0x8c,0x62,0xaf,0xa4,0x29,0xad,0xa8,0x08,
+0xc1,0x9c,0x47,0x4b,0x73,0x54,0x10,0x5f,0xb3,0x2d,0x9c,0xd6,0xba,0x51,0xcc,0x86,
+0x89,0x0f,0x1a,0x5c,0xd6,0xdc,0xda,0xab,0xb5,0x0f,0xb2,0x72,0x5e,0xb3,0x5d,0xf1,
+0xba,0x8b,0x19,0xa3,0x6c,0x8a,0x14,0x8a,0xb4,0xa1,0x65,0x7a,0xb4,0x7a,0xfd,0x16,
+0x2e,0x8b,0x20,0x7a,0xea,0x4d,0xa6,0xfb,0x32,0xf9,0x02,0xea,0x48,0x15,0xcf,0x71,
+0x84,0x65,0xb8,0x1e,0xc4,0x26,0xe6,0x24,0x3a,0x80,0xcd,0x3d,0xa8,0xbf,0x23,0x1b,
+0x79,0x2e,0xd8,0x42,0x06,0x51,0x7e,0x82,0x93,0x3c,0xb8,0x81,0x56,0x5f,0xcc,0x48,
+0x04,0x9f,0x94,0x77,0xa4,0xe6,0x92,0x39,0x75,0xc8,0x80,0x4d,0x82,0x7d,0x6d,0x75,
+0x9e,0x20,0x20,0x09,0x91,0x33,0x51,0x6e,0x1e,0x7b,0x2a,0xb0,0x4c,0x88,0x2c,0xbb,
+0x5c,0x5a,0xaf,0xc7,0x21,0x9c,0xaf,0x4e,0x16,0x11,0x0e,0x53,0xcf,0xb7,0xd6,0x03,
+0xb8,0xa4,0x0b,0x81,0xb4,0x32,0x85,0x8a,0xaa,0x57,0x2b,0xcc,0x3a,0x7d,0x6b,0x5c,
+0x25,0x94,0x64,0x92,0x43,0x23,0xf8,0x31,0x75,0xc5,0xec,0xec,0x97,0x56,0x2b,0x7c,
+0x6e,0xa3,0x09,0xe4,0x32,0x71,0xe6,0x91,0x89,0xa8,0x31,0x40,0x71,0x1b,0x3c,0x1e,
+0x8f,0xbd,0xc0,0xd9,0x64,0x2b,0xc9,0x3c,0xcd,0xc5,0xd5,0xc4,0x15,0xf9,0xc4,0x5c,
+0x95,0x53,0xa1,0x6d,0x79,0x78,0x4c,0xb2,0x8c,0x91,0x0c,0x1e,0x4e,0x35,0xfb,0xfc,
+0x53,0xef,0xf6,0x0c,0x6c,0x2f,0xc7,0xb6,0x25,0x0f,0xc5,0x88,0x42,0x16,0x96,0xf5,
+0x11,0xbc,0x6d,0x53,0x0a,0xe0,0x27,0x7c,0x2b,0xec,0xe0,0x16,0x75,0x5d,0x17,0xbe,
+0x59,0xbc,0x02,0x9c,0x1e,0x04,0x9d,0x16,0xb8,0x15,0xb8,0x69,0xd1,0x74,0x08,0x78,
+0x5a,0x04,0x57,0x80,0xa7,0xb5,0xd4,0x21,0xe0,0x57,0xdd,0x5e,0x05,0x30,0x1c,0x1f,
+0x77,0x00,0x1d,0x47,0xef,0xe6,0x48,0xab,0x24,0x40,0xf6,0x73,0xa5,0x49,0x10,0xf9,
+0x92,0xb8,0x0e,0xa1,0x04,0x16,0x57,0x68,0x3a,0xf2,0x21,0x59,0x05,0x20,0xbd,0xbd,
+0x19,0x8e,0x74,0x84,0x93,0xca,0xa9,0xa3,0x67,0x9d,0x0d,0xc3,0x99,0x52,0x7d,0x03,
+0xaf,0x7a,0xa3,0xdd,0x9c,0xf7,0x73,0xab,0xa9,0xf3,0x53,0x62,0xb7,0xf4,0x7c,0xa5,
+0x21,0x86,0x7d,0x52,0x18,0x06,0x4c,0x55,0x70,0x90,0x1f,0x92,0xdf,0x87,0x74,0xa6,
+0xd1,0xdc,0x60,0x97,0x84,0x83,0x3a,0xa7,0xa1,0xf4,0xfc,0xab,0xb5,0x54,0x74,0x58,
+0xa6,0x92,0xdb,0xeb,0xf3,0x40,0x6e,0x38,0xea,0x8e,0x06,0xbd,0x7c,0x85,0xa9,0xf8,
+0x6d,0xd8,0x67,0xdd,0x0b,0xde,0x6c,0x04,0xf5,0x1c,0x34,0x28,0x84,0x2a,0x65,0x61,
+0x2c,0x54,0x2f,0x4b,0x97,0xbe,0xa3,0x27,0xef,0x24,0xeb,0x2f,0x28,0xab,0x14,0xc6,
+0x9c,0xfe,0x05,0xe3,0xd3,0x8f,0x3a,0x5a,0x1d,0xef,0x3a,0xb2,0xa0,0x33,0xed,0xc3,
+0x28,0x5d,0xf7,0x47,0x57,0xdd,0xe1,0xe7,0xdd,0x78,0xad,0x5a,0x16,0x25,0x72,0x99,
+0xf0,0x5f,0x62,0x78,0xd9,0x1d,0xf5,0xbf,0x74,0xbf,0xed,0xc6,0x70,0xd5,0x05,0x29,
+0x31,0xcc,0x84,0x7b,0x32,0xac,0x8b,0xdd,0x2c,0x7e,0xa5,0x3b,0x73,0x3c,0x27,0x0f,
+0xe3,0x58,0x88,0x80,0x6d,0xf3,0xd3,0x70,0xb5,0x87,0x74,0xc7,0xa9,0x56,0xba,0x25,
+0xc8,0x02,0x3e,0x85,0x4d,0x25,0x6e,0xda,0xd1,0x87,0xdd,0xdf,0xfb,0xfa,0x36,0x86,
+0x1b,0xc2,0xdd,0x94,0xf1,0x5e,0xf5,0xa5,0x4c,0x54,0xf2,0xaf,0x74,0x0d,0x96,0x6c,
+0xe3,0xaa,0x72,0xbe,0xd8,0x77,0xcd,0x8b,0x7c,0xad,0xa6,0xad,0xba,0x1e,0xbb,0xd5,
+0x5d,0x83,0xba,0x6e,0x6b,0x96,0x0d,0xb2,0x6e,0xd6,0x86,0xbe,0x42,0x2d,0xc8,0x5b,
+0xbb,0x4f,0x5b,0x80,0xde,0xd8,0x93,0xda,0x82,0xf6,0x5e,0x9d,0xaa,0x37,0xee,0x7e,
+0x43,0x27,0x69,0x9f,0xed,0xef,0x0f,0x77,0x40,0xbb,0x4a,0xfa,0x64,0x76,0x24,0x5d,
+0x6f,0xf3,0x17,0x12,0x43,0xc1,0x4d,0x21,0xf6,0x23,0xa7,0xf8,0x39,0x83,0x13,0xb1,
+0x9d,0x83,0x00,0x9e,0x3c,0x7e,0xd9,0xc7,0xf0,0x49,0x4d,0xfe,0xc4,0xf8,0x07,0x97,
+0x2b,0xfb,0x6b,0xdc,0x18,0x00,0x00,};
 
 static const unsigned int dummy_align__runStatus_shtml = 3;
 static const unsigned char data__runStatus_shtml[] = {
@@ -3909,865 +2419,176 @@ static const unsigned char data__runStatus_shtml[] = {
 0x00,0x00,0x00,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
+/* "HTTP/1.0 200 OK
 " (17 bytes) */
 0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
-/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
+/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
 " (63 bytes) */
 0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
 0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
 0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
 0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-/* "Content-type: text/html
-Expires: Fri, 10 Apr 2008 14:00:00 GMT
-Pragma: no-cache
-
-" (85 bytes) */
+/* "Content-type: text/html
+" (25 bytes) */
 0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
-0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,0x45,0x78,0x70,0x69,0x72,0x65,0x73,
-0x3a,0x20,0x46,0x72,0x69,0x2c,0x20,0x31,0x30,0x20,0x41,0x70,0x72,0x20,0x32,0x30,
-0x30,0x38,0x20,0x31,0x34,0x3a,0x30,0x30,0x3a,0x30,0x30,0x20,0x47,0x4d,0x54,0x0d,
-0x0a,0x50,0x72,0x61,0x67,0x6d,0x61,0x3a,0x20,0x6e,0x6f,0x2d,0x63,0x61,0x63,0x68,
-0x65,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (13382 bytes) */
-0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0d,
-0x0a,0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a,0x09,0x3c,0x68,0x65,0x61,0x64,0x3e,
-0x0d,0x0a,0x09,0x09,0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,
-0x74,0x3d,0x22,0x55,0x54,0x46,0x2d,0x38,0x22,0x20,0x2f,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x69,0x74,0x6c,0x65,0x3e,0x4f,0x70,0x65,
-0x6e,0x52,0x54,0x4b,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x69,0x6e,0x6b,0x20,0x72,0x65,0x6c,0x3d,
-0x22,0x73,0x74,0x79,0x6c,0x65,0x73,0x68,0x65,0x65,0x74,0x22,0x20,0x74,0x79,0x70,
-0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x2f,0x63,0x73,0x73,0x22,0x20,0x68,0x72,0x65,
-0x66,0x3d,0x22,0x63,0x73,0x73,0x2f,0x73,0x74,0x79,0x6c,0x65,0x2e,0x63,0x73,0x73,
-0x22,0x20,0x2f,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,
-0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x24,0x28,0x69,
-0x64,0x29,0x20,0x7b,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x6f,0x63,0x75,
-0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,
-0x79,0x49,0x64,0x28,0x69,0x64,0x29,0x3b,0x20,0x7d,0x3b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
-0x6e,0x20,0x70,0x6f,0x73,0x43,0x61,0x6c,0x6c,0x62,0x61,0x63,0x6b,0x28,0x6f,0x29,
-0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x73,0x74,0x61,0x4d,0x20,0x3d,
-0x3d,0x20,0x30,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x73,
-0x74,0x61,0x4d,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,
-0x3d,0x20,0x27,0x4e,0x54,0x52,0x49,0x50,0x2d,0x43,0x4c,0x49,0x45,0x4e,0x54,0x27,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x73,
-0x74,0x61,0x4d,0x20,0x3d,0x3d,0x20,0x31,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x24,0x28,0x27,0x73,0x74,0x61,0x4d,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,
-0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x4f,0x50,0x45,0x4e,0x41,0x52,0x4b,0x2d,
-0x43,0x4c,0x49,0x45,0x4e,0x54,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,
-0x69,0x66,0x20,0x28,0x6f,0x2e,0x73,0x74,0x61,0x4d,0x20,0x3d,0x3d,0x20,0x32,0x29,
-0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x73,0x74,0x61,0x4d,0x27,
-0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x4e,
-0x54,0x52,0x49,0x50,0x2d,0x53,0x45,0x52,0x56,0x45,0x52,0x27,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,
-0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x73,0x74,0x61,0x53,0x20,0x3d,0x3d,
-0x20,0x30,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x73,0x74,
-0x61,0x53,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,
-0x20,0x27,0x4e,0x54,0x52,0x49,0x50,0x2d,0x43,0x4c,0x49,0x45,0x4e,0x54,0x20,0x26,
-0x20,0x44,0x49,0x53,0x43,0x4f,0x4e,0x4e,0x45,0x43,0x54,0x45,0x44,0x27,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x73,0x74,0x61,
-0x53,0x20,0x3d,0x3d,0x20,0x31,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,
-0x28,0x27,0x73,0x74,0x61,0x53,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,
-0x78,0x74,0x20,0x3d,0x20,0x27,0x4e,0x54,0x52,0x49,0x50,0x2d,0x43,0x4c,0x49,0x45,
-0x4e,0x54,0x20,0x26,0x20,0x43,0x4f,0x4e,0x4e,0x45,0x43,0x54,0x45,0x44,0x27,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x73,0x74,
-0x61,0x53,0x20,0x3d,0x3d,0x20,0x32,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x24,0x28,0x27,0x73,0x74,0x61,0x53,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,
-0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x4e,0x54,0x52,0x49,0x50,0x2d,0x43,0x4c,0x49,
-0x45,0x4e,0x54,0x20,0x26,0x20,0x52,0x54,0x43,0x4d,0x20,0x41,0x56,0x41,0x49,0x4c,
-0x41,0x42,0x4c,0x45,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,
-0x20,0x28,0x6f,0x2e,0x73,0x74,0x61,0x53,0x20,0x3d,0x3d,0x20,0x33,0x29,0x20,0x7b,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x73,0x74,0x61,0x53,0x27,0x29,0x2e,
-0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x4f,0x50,0x45,
-0x4e,0x41,0x52,0x43,0x2d,0x43,0x4c,0x49,0x45,0x4e,0x54,0x20,0x26,0x20,0x47,0x45,
-0x54,0x20,0x53,0x45,0x53,0x53,0x49,0x4f,0x4e,0x2e,0x2e,0x2e,0x27,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
-0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x73,0x74,0x61,0x53,
-0x20,0x3d,0x3d,0x20,0x34,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,
-0x27,0x73,0x74,0x61,0x53,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,
-0x74,0x20,0x3d,0x20,0x27,0x4f,0x50,0x45,0x4e,0x41,0x52,0x43,0x2d,0x43,0x4c,0x49,
-0x45,0x4e,0x54,0x20,0x26,0x20,0x44,0x49,0x53,0x43,0x4f,0x4e,0x4e,0x45,0x43,0x54,
-0x45,0x44,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,
-0x6f,0x2e,0x73,0x74,0x61,0x53,0x20,0x3d,0x3d,0x20,0x35,0x29,0x20,0x7b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x73,0x74,0x61,0x53,0x27,0x29,0x2e,0x69,0x6e,
-0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x4f,0x50,0x45,0x4e,0x41,
-0x52,0x43,0x2d,0x43,0x4c,0x49,0x45,0x4e,0x54,0x20,0x26,0x20,0x43,0x4f,0x4e,0x4e,
-0x45,0x43,0x54,0x45,0x44,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,
-0x66,0x20,0x28,0x6f,0x2e,0x73,0x74,0x61,0x53,0x20,0x3d,0x3d,0x20,0x36,0x29,0x20,
-0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x73,0x74,0x61,0x53,0x27,0x29,
-0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x4f,0x50,
-0x45,0x4e,0x41,0x52,0x43,0x2d,0x43,0x4c,0x49,0x45,0x4e,0x54,0x20,0x26,0x20,0x52,
-0x54,0x43,0x4d,0x20,0x41,0x56,0x41,0x49,0x4c,0x41,0x42,0x4c,0x45,0x27,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x73,0x74,0x61,
-0x53,0x20,0x3d,0x3d,0x20,0x37,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,
-0x28,0x27,0x73,0x74,0x61,0x53,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,
-0x78,0x74,0x20,0x3d,0x20,0x27,0x4e,0x54,0x52,0x49,0x50,0x2d,0x53,0x45,0x52,0x56,
-0x45,0x52,0x20,0x26,0x20,0x44,0x49,0x53,0x43,0x4f,0x4e,0x4e,0x45,0x43,0x54,0x45,
-0x44,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,
-0x2e,0x73,0x74,0x61,0x53,0x20,0x3d,0x3d,0x20,0x38,0x29,0x20,0x7b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x24,0x28,0x27,0x73,0x74,0x61,0x53,0x27,0x29,0x2e,0x69,0x6e,0x6e,
-0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x4e,0x54,0x52,0x49,0x50,0x2d,
-0x53,0x45,0x52,0x56,0x45,0x52,0x20,0x26,0x20,0x43,0x4f,0x4e,0x4e,0x45,0x43,0x54,
-0x45,0x44,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,
-0x6f,0x2e,0x73,0x74,0x61,0x53,0x20,0x3d,0x3d,0x20,0x39,0x29,0x20,0x7b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x73,0x74,0x61,0x53,0x27,0x29,0x2e,0x69,0x6e,
-0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x4e,0x54,0x52,0x49,0x50,
-0x2d,0x53,0x45,0x52,0x56,0x45,0x52,0x20,0x26,0x20,0x52,0x54,0x43,0x4d,0x20,0x4f,
-0x55,0x54,0x50,0x55,0x54,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
-0x28,0x24,0x28,0x27,0x67,0x70,0x73,0x57,0x65,0x65,0x6b,0x27,0x29,0x29,0x20,0x24,
-0x28,0x27,0x67,0x70,0x73,0x57,0x65,0x65,0x6b,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,
-0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x6f,0x2e,0x77,0x65,0x65,0x6b,0x3b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x69,0x6d,0x65,0x4f,0x66,0x57,0x65,
-0x65,0x6b,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x74,0x69,0x6d,0x65,0x4f,0x66,0x57,
-0x65,0x65,0x6b,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,
-0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x74,
-0x6f,0x77,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x32,0x29,0x3b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x73,0x74,0x61,0x4d,0x20,0x21,0x3d,
-0x20,0x32,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6f,
-0x2e,0x72,0x74,0x6b,0x6d,0x20,0x3d,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x72,0x74,0x6b,0x6d,0x6f,0x64,
-0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,
-0x27,0x49,0x4e,0x56,0x41,0x4c,0x49,0x44,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
-0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x72,0x74,0x6b,0x6d,
-0x20,0x3d,0x3d,0x20,0x31,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x24,0x28,0x27,0x72,0x74,0x6b,0x6d,0x6f,0x64,0x65,0x27,0x29,0x2e,0x69,
-0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x53,0x50,0x50,0x27,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,
-0x28,0x6f,0x2e,0x72,0x74,0x6b,0x6d,0x20,0x3d,0x3d,0x20,0x34,0x29,0x20,0x7b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x72,0x74,0x6b,0x6d,
-0x6f,0x64,0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,
-0x3d,0x20,0x27,0x52,0x54,0x4b,0x5f,0x46,0x49,0x58,0x45,0x44,0x27,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,
-0x72,0x74,0x6b,0x6d,0x20,0x3d,0x3d,0x20,0x35,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x72,0x74,0x6b,0x6d,0x6f,0x64,0x65,
-0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,
-0x52,0x54,0x4b,0x5f,0x46,0x4c,0x4f,0x41,0x54,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x24,0x28,0x27,0x72,0x74,0x6b,0x6d,0x6f,0x64,0x65,0x27,0x29,0x2e,0x69,
-0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x6f,0x2e,0x72,0x74,0x6b,
-0x6d,0x20,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x6c,0x61,0x74,0x69,0x74,0x75,0x64,0x65,
-0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x6c,0x61,0x74,0x69,0x74,0x75,0x64,0x65,0x27,
-0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x70,0x61,
-0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x6c,0x61,0x74,0x29,0x2e,
-0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x38,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x6c,0x6f,0x6e,0x67,0x69,0x74,0x75,0x64,
-0x65,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x6c,0x6f,0x6e,0x67,0x69,0x74,0x75,0x64,
-0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,
-0x70,0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x6c,0x6f,0x6e,
-0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x38,0x29,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x68,0x65,0x69,0x67,0x68,0x74,
-0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x68,0x65,0x69,0x67,0x68,0x74,0x27,0x29,0x2e,
-0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x70,0x61,0x72,0x73,
-0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x61,0x6c,0x74,0x29,0x2e,0x74,0x6f,
-0x46,0x69,0x78,0x65,0x64,0x28,0x33,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
-0x66,0x20,0x28,0x24,0x28,0x27,0x73,0x76,0x73,0x27,0x29,0x29,0x20,0x24,0x28,0x27,
-0x73,0x76,0x73,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,
-0x3d,0x20,0x6f,0x2e,0x73,0x76,0x73,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
-0x20,0x28,0x24,0x28,0x27,0x68,0x64,0x6f,0x70,0x27,0x29,0x29,0x20,0x24,0x28,0x27,
-0x68,0x64,0x6f,0x70,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,
-0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,
-0x68,0x64,0x6f,0x70,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x31,0x29,
-0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x61,0x67,
-0x65,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x61,0x67,0x65,0x27,0x29,0x2e,0x69,0x6e,
-0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x46,
-0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x61,0x67,0x65,0x29,0x2e,0x74,0x6f,0x46,0x69,
-0x78,0x65,0x64,0x28,0x31,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x69,0x73,0x20,0x3d,0x3d,0x20,0x30,
-0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,
-0x69,0x6e,0x73,0x53,0x74,0x61,0x74,0x75,0x73,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,
-0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x49,0x4e,0x53,0x5f,0x49,0x4e,0x41,
-0x43,0x54,0x49,0x56,0x45,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,
-0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x69,0x73,0x20,0x3d,0x3d,0x20,0x32,
-0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,
-0x69,0x6e,0x73,0x53,0x74,0x61,0x74,0x75,0x73,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,
-0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x49,0x4e,0x53,0x5f,0x49,0x4e,0x41,
-0x43,0x54,0x49,0x56,0x45,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,
-0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x69,0x73,0x20,0x3d,0x3d,0x20,0x33,
-0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,
-0x69,0x6e,0x73,0x53,0x74,0x61,0x74,0x75,0x73,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,
-0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x49,0x4e,0x53,0x5f,0x53,0x4f,0x4c,
-0x55,0x54,0x49,0x4f,0x4e,0x5f,0x47,0x4f,0x4f,0x44,0x27,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x69,0x73,
-0x20,0x3d,0x3d,0x20,0x34,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x24,0x28,0x27,0x69,0x6e,0x73,0x53,0x74,0x61,0x74,0x75,0x73,0x27,0x29,
-0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x49,0x4e,
-0x53,0x5f,0x53,0x4f,0x4c,0x55,0x54,0x49,0x4f,0x4e,0x5f,0x46,0x52,0x45,0x45,0x27,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,
-0x28,0x6f,0x2e,0x69,0x73,0x20,0x3d,0x3d,0x20,0x35,0x29,0x20,0x7b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x69,0x6e,0x73,0x53,0x74,0x61,
-0x74,0x75,0x73,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,
-0x3d,0x20,0x27,0x49,0x4e,0x53,0x5f,0x41,0x4c,0x49,0x47,0x4e,0x4d,0x45,0x4e,0x54,
-0x5f,0x43,0x4f,0x4d,0x50,0x4c,0x45,0x54,0x45,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x24,0x28,0x27,0x69,0x6e,0x73,0x53,0x74,0x61,0x74,0x75,0x73,0x27,0x29,
-0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x49,0x4e,
-0x53,0x5f,0x49,0x4e,0x41,0x43,0x54,0x49,0x56,0x45,0x27,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x7d,0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,
-0x69,0x70,0x74,0x20,0x3d,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x69,0x6e,0x73,0x50,0x6f,0x73,0x69,0x74,
-0x69,0x6f,0x6e,0x54,0x79,0x70,0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,
-0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x49,0x4e,0x53,0x5f,0x49,0x4e,0x56,0x41,0x4c,
-0x49,0x44,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,
-0x69,0x66,0x20,0x28,0x6f,0x2e,0x69,0x70,0x74,0x20,0x3d,0x3d,0x20,0x31,0x29,0x20,
-0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x69,0x6e,
-0x73,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x54,0x79,0x70,0x65,0x27,0x29,0x2e,
-0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x49,0x4e,0x53,
-0x5f,0x53,0x50,0x50,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,
-0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x69,0x70,0x74,0x20,0x3d,0x3d,0x20,0x32,
-0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,
-0x69,0x6e,0x73,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x54,0x79,0x70,0x65,0x27,
-0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x49,
-0x4e,0x53,0x5f,0x49,0x4e,0x56,0x41,0x4c,0x49,0x44,0x27,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x69,0x70,
-0x74,0x20,0x3d,0x3d,0x20,0x34,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x24,0x28,0x27,0x69,0x6e,0x73,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-0x6e,0x54,0x79,0x70,0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,
-0x74,0x20,0x3d,0x20,0x27,0x49,0x4e,0x53,0x5f,0x52,0x54,0x4b,0x46,0x49,0x58,0x45,
-0x44,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,
-0x66,0x20,0x28,0x6f,0x2e,0x69,0x70,0x74,0x20,0x3d,0x3d,0x20,0x35,0x29,0x20,0x7b,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x69,0x6e,0x73,
-0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x54,0x79,0x70,0x65,0x27,0x29,0x2e,0x69,
-0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x49,0x4e,0x53,0x5f,
-0x52,0x54,0x4b,0x46,0x4c,0x4f,0x41,0x54,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
-0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x24,0x28,0x27,0x69,0x6e,0x73,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,0x54,
-0x79,0x70,0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,
-0x3d,0x20,0x6f,0x2e,0x69,0x70,0x74,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,0x0a,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x76,0x6d,0x20,0x3d,
-0x3d,0x20,0x30,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x24,0x28,0x27,0x76,0x65,0x6c,0x4d,0x6f,0x64,0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,
-0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x49,0x4e,0x56,0x41,0x4c,0x49,
-0x44,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,
-0x66,0x20,0x28,0x6f,0x2e,0x76,0x6d,0x20,0x3d,0x3d,0x20,0x31,0x29,0x20,0x7b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x76,0x65,0x6c,0x4d,
-0x6f,0x64,0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,
-0x3d,0x20,0x27,0x44,0x4f,0x50,0x50,0x4c,0x45,0x52,0x27,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x76,0x6d,
-0x20,0x3d,0x3d,0x20,0x32,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x24,0x28,0x27,0x76,0x65,0x6c,0x4d,0x6f,0x64,0x65,0x27,0x29,0x2e,0x69,
-0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x49,0x4e,0x53,0x5f,
-0x46,0x52,0x45,0x45,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,
-0x65,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,
-0x76,0x65,0x6c,0x4d,0x6f,0x64,0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,
-0x65,0x78,0x74,0x20,0x3d,0x20,0x6f,0x2e,0x76,0x6d,0x3b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x7d,0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,
-0x27,0x6e,0x6f,0x72,0x74,0x68,0x56,0x65,0x6c,0x27,0x29,0x29,0x20,0x24,0x28,0x27,
-0x6e,0x6f,0x72,0x74,0x68,0x56,0x65,0x6c,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,
-0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,
-0x74,0x28,0x6f,0x2e,0x6e,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x33,
-0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x65,
-0x61,0x73,0x74,0x56,0x65,0x6c,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x65,0x61,0x73,
-0x74,0x56,0x65,0x6c,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,
-0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,
-0x65,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x33,0x29,0x3b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x75,0x70,0x56,0x65,0x6c,
-0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x75,0x70,0x56,0x65,0x6c,0x27,0x29,0x2e,0x69,
-0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,
-0x46,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x75,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,
-0x65,0x64,0x28,0x33,0x29,0x3b,0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
-0x20,0x28,0x24,0x28,0x27,0x72,0x6f,0x6c,0x6c,0x27,0x29,0x29,0x20,0x24,0x28,0x27,
-0x72,0x6f,0x6c,0x6c,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,
-0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,
-0x72,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x33,0x29,0x3b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x70,0x69,0x74,0x63,0x68,
-0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x70,0x69,0x74,0x63,0x68,0x27,0x29,0x2e,0x69,
-0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,
-0x46,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x70,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,
-0x65,0x64,0x28,0x33,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
-0x24,0x28,0x27,0x68,0x65,0x61,0x64,0x69,0x6e,0x67,0x27,0x29,0x29,0x20,0x24,0x28,
-0x27,0x68,0x65,0x61,0x64,0x69,0x6e,0x67,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,
-0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,
-0x74,0x28,0x6f,0x2e,0x68,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x33,
-0x29,0x3b,0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x72,0x74,0x6b,0x6d,0x20,0x3d,
-0x3d,0x20,0x30,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x24,0x28,0x27,0x72,0x74,0x6b,0x6d,0x6f,0x64,0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,
-0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x52,0x45,0x46,0x27,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,
-0x2e,0x72,0x74,0x6b,0x6d,0x20,0x3d,0x3d,0x20,0x31,0x29,0x20,0x7b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x72,0x74,0x6b,0x6d,0x6f,0x64,
-0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,
-0x27,0x53,0x50,0x50,0x20,0x26,0x20,0x57,0x41,0x49,0x54,0x49,0x4e,0x47,0x27,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,
-0x6f,0x2e,0x72,0x74,0x6b,0x6d,0x20,0x3d,0x3d,0x20,0x32,0x29,0x20,0x7b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x72,0x74,0x6b,0x6d,0x6f,
-0x64,0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,
-0x20,0x27,0x53,0x50,0x50,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,
-0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x72,0x74,0x6b,0x6d,0x20,0x3d,0x3d,
-0x20,0x33,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,
-0x28,0x27,0x72,0x74,0x6b,0x6d,0x6f,0x64,0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,
-0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x52,0x54,0x4b,0x20,0x26,0x20,0x57,
-0x41,0x49,0x54,0x49,0x4e,0x47,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,
-0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x72,0x74,0x6b,0x6d,0x20,0x3d,
-0x3d,0x20,0x34,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x24,0x28,0x27,0x72,0x74,0x6b,0x6d,0x6f,0x64,0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,
-0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x52,0x54,0x4b,0x27,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,
-0x2e,0x72,0x74,0x6b,0x6d,0x20,0x3d,0x3d,0x20,0x35,0x29,0x20,0x7b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x72,0x74,0x6b,0x6d,0x6f,0x64,
-0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,
-0x27,0x41,0x55,0x54,0x4f,0x20,0x26,0x20,0x57,0x41,0x49,0x54,0x49,0x4e,0x47,0x27,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,
-0x28,0x6f,0x2e,0x72,0x74,0x6b,0x6d,0x20,0x3d,0x3d,0x20,0x36,0x29,0x20,0x7b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x72,0x74,0x6b,0x6d,
-0x6f,0x64,0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,
-0x3d,0x20,0x27,0x41,0x55,0x54,0x4f,0x27,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,
-0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x6c,0x61,0x74,0x69,0x74,0x75,
-0x64,0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,
-0x20,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x6c,0x61,
-0x74,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x38,0x29,0x3b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x6c,0x6f,0x6e,0x67,0x69,0x74,0x75,0x64,0x65,
-0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x70,
-0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x6c,0x6f,0x6e,0x29,
-0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x38,0x29,0x3b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x24,0x28,0x27,0x68,0x65,0x69,0x67,0x68,0x74,0x27,0x29,0x2e,0x69,0x6e,
-0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x46,
-0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x61,0x6c,0x74,0x29,0x2e,0x74,0x6f,0x46,0x69,
-0x78,0x65,0x64,0x28,0x33,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,
-0x73,0x76,0x73,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,
-0x3d,0x20,0x27,0x4e,0x2f,0x41,0x27,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,
-0x27,0x68,0x64,0x6f,0x70,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,
-0x74,0x20,0x3d,0x20,0x27,0x4e,0x2f,0x41,0x27,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x24,0x28,0x27,0x61,0x67,0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,
-0x78,0x74,0x20,0x3d,0x20,0x27,0x4e,0x2f,0x41,0x27,0x3b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x24,0x28,0x27,0x69,0x6e,0x73,0x53,0x74,0x61,0x74,0x75,0x73,0x27,0x29,0x2e,
-0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x4e,0x2f,0x41,
-0x27,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x69,0x6e,0x73,0x50,0x6f,
-0x73,0x69,0x74,0x69,0x6f,0x6e,0x54,0x79,0x70,0x65,0x27,0x29,0x2e,0x69,0x6e,0x6e,
-0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x4e,0x2f,0x41,0x27,0x3b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x76,0x65,0x6c,0x4d,0x6f,0x64,0x65,0x27,
-0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x4e,
-0x2f,0x41,0x27,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x6e,0x6f,0x72,
-0x74,0x68,0x56,0x65,0x6c,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,
-0x74,0x20,0x3d,0x20,0x27,0x4e,0x2f,0x41,0x27,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x24,0x28,0x27,0x65,0x61,0x73,0x74,0x56,0x65,0x6c,0x27,0x29,0x2e,0x69,0x6e,0x6e,
-0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x4e,0x2f,0x41,0x27,0x3b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x75,0x70,0x56,0x65,0x6c,0x27,0x29,0x2e,
-0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x4e,0x2f,0x41,
-0x27,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x72,0x6f,0x6c,0x6c,0x27,
-0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x4e,
-0x2f,0x41,0x27,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x70,0x69,0x74,
-0x63,0x68,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,
-0x20,0x27,0x4e,0x2f,0x41,0x27,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,
-0x68,0x65,0x61,0x64,0x69,0x6e,0x67,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,
-0x65,0x78,0x74,0x20,0x3d,0x20,0x27,0x4e,0x2f,0x41,0x27,0x3b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,
-0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x62,0x64,0x73,0x27,0x29,0x29,
-0x20,0x24,0x28,0x27,0x62,0x64,0x73,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,
-0x65,0x78,0x74,0x20,0x3d,0x20,0x6f,0x2e,0x62,0x64,0x73,0x3b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
-0x20,0x28,0x24,0x28,0x27,0x67,0x70,0x73,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x67,
-0x70,0x73,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,
-0x20,0x6f,0x2e,0x67,0x70,0x73,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,
-0x67,0x6c,0x6f,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x67,0x6c,0x6f,0x27,0x29,0x2e,
-0x69,0x6e,0x6e,0x65,0x72,0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x6f,0x2e,0x67,0x6c,
-0x6f,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x67,0x61,0x6c,0x27,0x29,
-0x29,0x20,0x24,0x28,0x27,0x67,0x61,0x6c,0x27,0x29,0x2e,0x69,0x6e,0x6e,0x65,0x72,
-0x54,0x65,0x78,0x74,0x20,0x3d,0x20,0x6f,0x2e,0x67,0x61,0x6c,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,
-0x69,0x6f,0x6e,0x20,0x67,0x65,0x74,0x49,0x6e,0x66,0x6f,0x28,0x75,0x72,0x6c,0x29,
-0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x78,0x68,0x72,0x3b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x28,
-0x77,0x69,0x6e,0x64,0x6f,0x77,0x2e,0x58,0x4d,0x4c,0x48,0x74,0x74,0x70,0x52,0x65,
-0x71,0x75,0x65,0x73,0x74,0x29,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x78,0x68,0x72,
-0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,0x58,0x4d,0x4c,0x48,0x74,0x74,0x70,0x52,0x65,
-0x71,0x75,0x65,0x73,0x74,0x28,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x65,0x6c,0x73,0x65,0x7b,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x78,0x68,0x72,0x20,0x3d,0x20,0x6e,0x65,0x77,0x20,
-0x41,0x63,0x74,0x69,0x76,0x65,0x58,0x4f,0x62,0x6a,0x65,0x63,0x74,0x28,0x27,0x4d,
-0x69,0x63,0x72,0x6f,0x73,0x6f,0x66,0x74,0x2e,0x58,0x4d,0x4c,0x48,0x54,0x54,0x50,
-0x27,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x78,0x68,0x72,0x2e,0x6f,0x6e,0x72,0x65,
-0x61,0x64,0x79,0x73,0x74,0x61,0x74,0x65,0x63,0x68,0x61,0x6e,0x67,0x65,0x20,0x3d,
-0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x28,0x29,0x7b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x69,0x66,0x28,0x78,0x68,0x72,0x2e,0x72,0x65,0x61,0x64,0x79,0x53,0x74,
-0x61,0x74,0x65,0x20,0x3d,0x3d,0x3d,0x20,0x34,0x29,0x7b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x28,0x78,0x68,0x72,0x2e,0x73,0x74,0x61,0x74,
-0x75,0x73,0x20,0x3d,0x3d,0x20,0x32,0x30,0x30,0x29,0x7b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x65,0x76,0x61,0x6c,0x28,0x78,0x68,
-0x72,0x2e,0x72,0x65,0x73,0x70,0x6f,0x6e,0x73,0x65,0x54,0x65,0x78,0x74,0x29,0x3b,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x7d,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x7d,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x78,0x68,0x72,0x2e,0x6f,0x70,0x65,0x6e,0x28,
-0x27,0x67,0x65,0x74,0x27,0x2c,0x20,0x75,0x72,0x6c,0x2c,0x20,0x74,0x72,0x75,0x65,
-0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x78,0x68,0x72,0x2e,0x73,0x65,0x6e,0x64,0x28,0x29,0x3b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x3b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x75,0x6e,
-0x63,0x74,0x69,0x6f,0x6e,0x20,0x72,0x65,0x66,0x4e,0x65,0x77,0x28,0x29,0x7b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x67,0x65,0x74,0x49,0x6e,0x66,0x6f,0x28,0x27,0x70,0x6f,0x73,0x69,0x74,0x69,
-0x6f,0x6e,0x2e,0x6a,0x73,0x27,0x29,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x3c,
-0x2f,0x68,0x65,0x61,0x64,0x3e,0x0d,0x0a,0x0d,0x0a,0x09,0x3c,0x62,0x6f,0x64,0x79,
-0x20,0x6f,0x6e,0x6c,0x6f,0x61,0x64,0x3d,0x22,0x6a,0x61,0x76,0x61,0x73,0x63,0x72,
-0x69,0x70,0x74,0x3a,0x73,0x65,0x74,0x49,0x6e,0x74,0x65,0x72,0x76,0x61,0x6c,0x28,
-0x27,0x72,0x65,0x66,0x4e,0x65,0x77,0x28,0x29,0x27,0x2c,0x31,0x30,0x30,0x30,0x29,
-0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x65,0x61,
-0x64,0x65,0x72,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x64,0x72,0x6f,
-0x70,0x73,0x2d,0x74,0x6f,0x70,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x3e,0x41,0x63,0x65,0x69,0x6e,0x6e,0x61,
-0x20,0x4f,0x70,0x65,0x6e,0x52,0x54,0x4b,0x3c,0x2f,0x61,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x68,0x65,0x61,0x64,0x65,0x72,0x3e,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,
-0x6f,0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,
-0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x22,
-0x3e,0x20,0x20,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x68,0x65,0x61,0x64,0x65,0x72,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x68,0x65,0x61,
-0x64,0x65,0x72,0x22,0x3e,0x20,0x20,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x68,
-0x31,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x68,0x65,
-0x61,0x64,0x65,0x72,0x5f,0x74,0x69,0x74,0x6c,0x65,0x22,0x3e,0x4d,0x45,0x4e,0x55,
-0x3c,0x2f,0x68,0x31,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,0x68,0x65,0x61,
-0x64,0x65,0x72,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x75,0x6c,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x62,0x6f,0x64,0x79,0x22,0x3e,
-0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,
-0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,
-0x68,0x72,0x65,0x66,0x3d,0x22,0x72,0x75,0x6e,0x53,0x74,0x61,0x74,0x75,0x73,0x2e,
-0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,
-0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x20,0x69,0x73,0x2d,
-0x61,0x63,0x74,0x69,0x76,0x65,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x52,0x75,0x6e,0x6e,0x69,0x6e,0x67,0x20,0x53,0x74,0x61,0x74,0x75,0x73,
-0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,
-0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x77,0x6f,
-0x72,0x6b,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,
-0x6e,0x6b,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x57,0x6f,
-0x72,0x6b,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,
-0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,
-0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x75,0x73,
-0x65,0x72,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,
-0x6e,0x6b,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x55,0x73,
-0x65,0x72,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,
-0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,
-0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x65,0x74,
-0x68,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,
-0x6b,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x45,0x74,0x68,
-0x65,0x72,0x6e,0x65,0x74,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,0x74,
-0x69,0x6f,0x6e,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,
-0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,
-0x22,0x64,0x65,0x76,0x69,0x63,0x65,0x49,0x6e,0x66,0x6f,0x2e,0x73,0x68,0x74,0x6d,
-0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,
-0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x44,0x65,0x76,0x69,0x63,0x65,0x20,0x49,0x6e,0x66,0x6f,0x3c,
-0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,
-0x75,0x6c,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,
-0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x74,0x65,0x6e,
-0x74,0x2d,0x77,0x72,0x61,0x70,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x68,
-0x65,0x61,0x64,0x65,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x31,0x3e,
-0x52,0x75,0x6e,0x6e,0x69,0x6e,0x67,0x20,0x53,0x74,0x61,0x74,0x75,0x73,0x3c,0x2f,
-0x68,0x31,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x68,0x65,0x61,0x64,0x65,0x72,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x73,0x74,0x79,0x6c,0x65,
-0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x3a,0x20,0x31,0x31,0x31,0x30,0x70,0x78,0x3b,
-0x20,0x68,0x65,0x69,0x67,0x68,0x74,0x3a,0x33,0x32,0x30,0x70,0x78,0x3b,0x22,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x73,0x74,0x79,0x6c,0x65,
-0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x3a,0x33,0x37,0x30,0x70,0x78,0x3b,0x20,0x66,
-0x6c,0x6f,0x61,0x74,0x3a,0x6c,0x65,0x66,0x74,0x3b,0x22,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,
-0x3d,0x22,0x73,0x75,0x62,0x62,0x6c,0x6f,0x63,0x6b,0x22,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x31,0x3e,0x47,0x45,
-0x4e,0x45,0x52,0x41,0x4c,0x3a,0x3c,0x2f,0x68,0x31,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,
-0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x53,
-0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x4d,0x6f,0x64,0x65,0x3a,0x3c,0x2f,0x6c,0x61,
-0x62,0x65,0x6c,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x3c,0x70,0x3e,0x3c,0x74,0x65,0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x73,
-0x74,0x61,0x4d,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x63,0x6f,0x6c,0x6f,
-0x72,0x3a,0x63,0x6f,0x72,0x6e,0x66,0x6c,0x6f,0x77,0x65,0x72,0x62,0x6c,0x75,0x65,
-0x3b,0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,
-0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,
-0x22,0x3e,0x53,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x53,0x74,0x61,0x74,0x75,0x73,
-0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x74,0x65,0x78,0x74,0x20,
-0x69,0x64,0x3d,0x22,0x73,0x74,0x61,0x53,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,
-0x22,0x63,0x6f,0x6c,0x6f,0x72,0x3a,0x20,0x63,0x6f,0x72,0x6e,0x66,0x6c,0x6f,0x77,
-0x65,0x72,0x62,0x6c,0x75,0x65,0x3b,0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,
-0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,
-0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
-0x77,0x69,0x64,0x74,0x68,0x3a,0x33,0x37,0x30,0x70,0x78,0x3b,0x20,0x66,0x6c,0x6f,
-0x61,0x74,0x3a,0x6c,0x65,0x66,0x74,0x3b,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x73,0x75,0x62,0x62,0x6c,0x6f,0x63,0x6b,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x31,0x3e,0x47,0x50,0x53,0x20,
-0x54,0x69,0x6d,0x65,0x3c,0x2f,0x68,0x31,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x47,0x50,0x53,
-0x20,0x57,0x65,0x65,0x6b,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,
-0x65,0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x67,0x70,0x73,0x57,0x65,0x65,0x6b,0x22,
-0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,
-0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,
-0x54,0x69,0x6d,0x65,0x20,0x6f,0x66,0x20,0x57,0x65,0x65,0x6b,0x28,0x73,0x29,0x3a,
-0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x20,0x69,0x64,
-0x3d,0x22,0x74,0x69,0x6d,0x65,0x4f,0x66,0x57,0x65,0x65,0x6b,0x22,0x3e,0x3c,0x2f,
-0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x73,0x75,0x62,
-0x62,0x6c,0x6f,0x63,0x6b,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x31,0x3e,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,
-0x6e,0x3c,0x2f,0x68,0x31,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x4d,0x6f,0x64,0x65,0x3a,0x3c,
-0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x20,0x69,0x64,0x3d,
-0x22,0x72,0x74,0x6b,0x6d,0x6f,0x64,0x65,0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,
-0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x4c,0x61,0x74,0x69,0x74,0x75,0x64,
-0x65,0x28,0xc2,0xb0,0x29,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,
-0x65,0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x6c,0x61,0x74,0x69,0x74,0x75,0x64,0x65,
-0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,
-0x3e,0x4c,0x6f,0x6e,0x67,0x69,0x74,0x75,0x64,0x65,0x28,0xc2,0xb0,0x29,0x3a,0x3c,
-0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x20,0x69,0x64,0x3d,
-0x22,0x6c,0x6f,0x6e,0x67,0x69,0x74,0x75,0x64,0x65,0x22,0x3e,0x3c,0x2f,0x74,0x65,
-0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,
-0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x48,0x65,0x69,0x67,0x68,
-0x74,0x28,0x6d,0x29,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,
-0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x68,0x65,0x69,0x67,0x68,0x74,0x22,0x3e,0x3c,
-0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x4e,0x75,
-0x6d,0x62,0x65,0x72,0x20,0x6f,0x66,0x20,0x53,0x56,0x73,0x3a,0x3c,0x2f,0x6c,0x61,
-0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x73,0x76,
-0x73,0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,
-0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,
-0x22,0x3e,0x48,0x44,0x4f,0x50,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,
-0x74,0x65,0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x68,0x64,0x6f,0x70,0x22,0x3e,0x3c,
-0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x41,0x47,
-0x45,0x28,0x73,0x29,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,
-0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x61,0x67,0x65,0x22,0x3e,0x3c,0x2f,0x74,0x65,
-0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,
-0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x73,0x74,
-0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x3a,0x33,0x37,0x30,0x70,0x78,
-0x3b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3a,0x6c,0x65,0x66,0x74,0x3b,0x22,0x3e,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x73,0x75,0x62,0x62,0x6c,0x6f,0x63,0x6b,0x22,0x3e,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x31,
-0x3e,0x49,0x4e,0x53,0x3c,0x2f,0x68,0x31,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x49,0x4e,0x53,
-0x20,0x53,0x74,0x61,0x74,0x75,0x73,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,
-0x3c,0x74,0x65,0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x69,0x6e,0x73,0x53,0x74,0x61,
-0x74,0x75,0x73,0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,
-0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,
-0x5f,0x31,0x22,0x3e,0x49,0x4e,0x53,0x20,0x50,0x6f,0x73,0x69,0x74,0x69,0x6f,0x6e,
-0x20,0x54,0x79,0x70,0x65,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,
-0x65,0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x69,0x6e,0x73,0x50,0x6f,0x73,0x69,0x74,
-0x69,0x6f,0x6e,0x54,0x79,0x70,0x65,0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,
-0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,
-0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x73,0x75,0x62,0x62,0x6c,0x6f,0x63,0x6b,
-0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x68,0x31,0x3e,0x56,0x65,0x6c,0x6f,0x63,0x69,0x74,0x79,0x3c,0x2f,0x68,0x31,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,
-0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,
-0x6c,0x5f,0x31,0x22,0x3e,0x56,0x65,0x6c,0x20,0x4d,0x6f,0x64,0x65,0x3a,0x3c,0x2f,
-0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x20,0x69,0x64,0x3d,0x22,
-0x76,0x65,0x6c,0x4d,0x6f,0x64,0x65,0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,
-0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,
-0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x4e,0x6f,0x72,0x74,0x68,0x28,0x6d,0x2f,
-0x73,0x29,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,
-0x20,0x69,0x64,0x3d,0x22,0x6e,0x6f,0x72,0x74,0x68,0x56,0x65,0x6c,0x22,0x3e,0x3c,
-0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x45,0x61,
-0x73,0x74,0x28,0x6d,0x2f,0x73,0x29,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,
-0x3c,0x74,0x65,0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x65,0x61,0x73,0x74,0x56,0x65,
-0x6c,0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,
-0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,
-0x22,0x3e,0x55,0x70,0x28,0x6d,0x2f,0x73,0x29,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,
-0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x75,0x70,0x56,0x65,
-0x6c,0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,
-0x3d,0x22,0x73,0x75,0x62,0x62,0x6c,0x6f,0x63,0x6b,0x22,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x31,0x3e,0x41,0x74,
-0x74,0x69,0x74,0x75,0x64,0x65,0x3c,0x2f,0x68,0x31,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,
-0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x52,
-0x6f,0x6c,0x6c,0x28,0xc2,0xb0,0x29,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,
-0x3c,0x74,0x65,0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x72,0x6f,0x6c,0x6c,0x22,0x3e,
-0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,
-0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x50,
-0x69,0x74,0x63,0x68,0x28,0xc2,0xb0,0x29,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,
-0x3e,0x3c,0x74,0x65,0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x70,0x69,0x74,0x63,0x68,
-0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,
-0x3e,0x48,0x65,0x61,0x64,0x69,0x6e,0x67,0x28,0xc2,0xb0,0x29,0x3a,0x3c,0x2f,0x6c,
-0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x68,
-0x65,0x61,0x64,0x69,0x6e,0x67,0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,
-0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x64,0x69,0x76,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,
-0x3a,0x20,0x31,0x30,0x30,0x25,0x3b,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x73,0x75,0x62,0x62,0x6c,
-0x6f,0x63,0x6b,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x68,0x31,0x3e,0x53,0x61,0x74,0x65,0x6c,0x6c,0x69,0x74,0x65,0x73,0x3c,0x2f,0x68,
-0x31,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x78,0x22,0x3e,0x42,0x44,
-0x53,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x20,0x69,
-0x64,0x3d,0x22,0x62,0x64,0x73,0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,
-0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,
-0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,
-0x78,0x22,0x3e,0x47,0x50,0x53,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,
-0x65,0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x67,0x70,0x73,0x22,0x3e,0x3c,0x2f,0x74,
-0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,
-0x61,0x62,0x65,0x6c,0x5f,0x78,0x22,0x3e,0x47,0x4c,0x4f,0x3c,0x2f,0x6c,0x61,0x62,
-0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x20,0x69,0x64,0x3d,0x22,0x67,0x6c,0x6f,
-0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x78,0x22,0x3e,0x47,0x41,0x4c,
-0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x74,0x65,0x78,0x74,0x20,0x69,0x64,
-0x3d,0x22,0x67,0x61,0x6c,0x22,0x3e,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x3c,0x2f,
-0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,
-0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,
-0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x2f,0x6a,0x61,0x76,0x61,
-0x73,0x63,0x72,0x69,0x70,0x74,0x27,0x20,0x73,0x72,0x63,0x3d,0x27,0x70,0x6f,0x73,
-0x69,0x74,0x69,0x6f,0x6e,0x2e,0x6a,0x73,0x27,0x3e,0x3c,0x2f,0x73,0x63,0x72,0x69,
-0x70,0x74,0x3e,0x0d,0x0a,0x09,0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,
-0x2f,0x68,0x74,0x6d,0x6c,0x3e,};
+0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,
+/* "Cache-Control: no-cache
+" (25 bytes) */
+0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x3a,0x20,0x6e,
+0x6f,0x2d,0x63,0x61,0x63,0x68,0x65,0x0d,0x0a,
+/* "ETag: "46ff0f56"
+" (18 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x34,0x36,0x66,0x66,0x30,0x66,0x35,0x36,0x22,
+0x0d,0x0a,
+/* "Content-Encoding: gzip
+" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x45,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,
+0x3a,0x20,0x67,0x7a,0x69,0x70,0x0d,0x0a,
+/* "Vary: Accept-Encoding
+" (23 bytes) */
+0x56,0x61,0x72,0x79,0x3a,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2d,0x45,0x6e,0x63,
+0x6f,0x64,0x69,0x6e,0x67,0x0d,0x0a,
+/* "Content-Length: 2140
+
+" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x32,0x31,0x34,0x30,0x0d,0x0a,0x0d,0x0a,
+/* gzip file data (2140 bytes) */
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xcd,0x5b,0xef,0x72,0xe2,0x36,
+0x10,0xff,0x7c,0x9d,0xe9,0x3b,0xe8,0x3c,0x6d,0x81,0x99,0x0b,0x84,0xe4,0xae,0xbd,
+0x26,0xc0,0x0c,0x47,0x9c,0x94,0x39,0xfe,0x0d,0x76,0x72,0xd7,0x4f,0x19,0x63,0x0b,
+0xf0,0x45,0x58,0xae,0x25,0x43,0x32,0x9d,0x7b,0xa7,0x3e,0x43,0x9f,0xac,0x92,0xff,
+0x04,0x03,0x96,0x31,0x16,0xb9,0xab,0x3f,0x24,0xb2,0xac,0xdd,0xdf,0x6a,0xb5,0xda,
+0x5d,0xad,0x4d,0xe3,0xf5,0xd5,0xb0,0xa3,0xff,0x39,0x52,0xc1,0x9c,0x2e,0x50,0xeb,
+0xc7,0x1f,0x1a,0xd1,0xff,0x57,0x8d,0x39,0x34,0x2c,0xde,0x78,0xd5,0x58,0x40,0x6a,
+0x00,0x73,0x6e,0x78,0x04,0xd2,0xa6,0x72,0xab,0x5f,0x9f,0xbc,0x57,0x40,0x8d,0x3d,
+0x03,0xd1,0xd5,0xa0,0x36,0x45,0xb0,0x35,0x74,0xa1,0x33,0xd6,0x3f,0x36,0x6a,0xe1,
+0x6d,0xe2,0x39,0xb2,0x9d,0x07,0xe0,0x41,0xd4,0x54,0x08,0x7d,0x42,0x90,0xcc,0x21,
+0xa4,0x0a,0xa0,0x4f,0x2e,0x6c,0x2a,0x14,0x3e,0xd2,0x9a,0x49,0x88,0x02,0xe6,0x1e,
+0x9c,0x36,0x15,0xd6,0xac,0x05,0xa3,0xaa,0x41,0xe7,0x06,0x0e,0x31,0x3d,0xdb,0xa5,
+0x89,0x1e,0x7e,0x4d,0x7d,0xc7,0xa4,0x36,0x76,0xc0,0x4f,0x65,0xdb,0xaa,0x80,0xbf,
+0x19,0x10,0xf5,0x3d,0x07,0x58,0xd8,0xf4,0x17,0xd0,0xa1,0xd5,0x19,0xa4,0x2a,0x82,
+0xbc,0xf9,0xe1,0xa9,0x6b,0xf1,0x41,0x97,0xe0,0xeb,0xa5,0x80,0x89,0x8b,0x49,0xc7,
+0x40,0x68,0x62,0x98,0x0f,0x65,0xcc,0xb8,0x6d,0x0e,0xe3,0x97,0x3d,0x05,0x65,0x5c,
+0x25,0xd4,0xe8,0x83,0x66,0x13,0x9c,0xa6,0x8e,0xe1,0xd7,0x4f,0xe5,0x12,0x1f,0x54,
+0xaa,0x54,0x6d,0xc7,0x81,0x9e,0xce,0xe6,0x09,0x9a,0xa0,0x34,0xd0,0xc7,0xdd,0xd1,
+0x49,0xa7,0xd7,0x55,0x07,0x7a,0x69,0x97,0xf2,0x2b,0x80,0x88,0xc0,0x2d,0x90,0xfa,
+0xa1,0x20,0xc3,0x91,0x3a,0x68,0x8f,0x3f,0x1e,0x08,0x73,0x56,0x6c,0x2e,0x9a,0x3a,
+0xbe,0x53,0xc7,0x69,0x20,0x3f,0xfe,0x90,0xa1,0x3e,0x2d,0x8f,0xfa,0xb4,0x2c,0xf5,
+0x81,0x5f,0xc0,0x55,0x57,0xeb,0x0c,0x07,0x03,0xb5,0xa3,0xab,0x57,0x39,0xa6,0xa9,
+0xe5,0xd1,0xe6,0x3e,0xcc,0x83,0x01,0xcf,0x24,0x01,0xc7,0x7a,0xa7,0x0f,0xda,0x77,
+0xed,0x6e,0xaf,0xfd,0xa1,0xa7,0xe6,0x45,0x3d,0x3f,0x14,0x35,0x34,0x9a,0xce,0x1a,
+0xf7,0x46,0xd5,0x81,0xa6,0x6a,0x5a,0x77,0x38,0xa8,0x56,0xab,0x79,0x71,0xdf,0x4a,
+0xe3,0x16,0x59,0xd4,0x77,0xd2,0xa8,0x07,0x43,0xfe,0x2a,0x0d,0x59,0x6c,0x61,0x7f,
+0x2b,0x66,0x4e,0xe1,0x36,0x2d,0xa8,0xde,0xf7,0x92,0x98,0x07,0x03,0xfe,0x2e,0x09,
+0x18,0xa8,0x76,0x78,0xab,0x8f,0x6e,0xf5,0x43,0x3c,0x13,0x63,0x3e,0x73,0xc9,0x27,
+0x08,0x1f,0x4a,0x95,0x0a,0x48,0xde,0x6d,0xa0,0xe1,0xea,0x8a,0x75,0x5e,0x0a,0x79,
+0x50,0x7b,0x01,0x87,0xd3,0x04,0x9b,0x64,0xc7,0x06,0x27,0x97,0x87,0xd5,0x6b,0x84,
+0x0d,0xca,0x26,0x4f,0xf1,0xaa,0xc2,0xfe,0x5c,0xdb,0x8f,0xd0,0x2a,0x9f,0x55,0x52,
+0xf8,0x67,0x86,0xa3,0xd7,0x59,0xae,0x26,0x1c,0xe7,0xd1,0x87,0x45,0xb6,0xdf,0x8d,
+0x54,0xcc,0x07,0x62,0x0b,0x6e,0x6b,0xb9,0x3b,0xb8,0x6b,0xf7,0xba,0x69,0xab,0xb8,
+0xb3,0x92,0x31,0x54,0xbd,0x20,0x94,0x36,0x1a,0x1d,0x02,0xf3,0xb6,0x20,0x0c,0xcb,
+0x58,0xee,0xaf,0xbb,0x9f,0xd5,0x83,0xe6,0xf4,0x4e,0x06,0xac,0x37,0x6c,0xeb,0xd9,
+0x60,0x45,0x78,0x47,0xc2,0x09,0xf8,0xa6,0xd9,0x7b,0xc2,0x5e,0x91,0xc1,0x72,0x36,
+0x9f,0xf3,0x0c,0xac,0x75,0x7d,0x2b,0xb6,0x55,0x36,0x66,0x6d,0xab,0xef,0xd3,0x6c,
+0x35,0xc9,0x1f,0x3b,0xb3,0x0d,0x80,0xf5,0x7d,0x06,0x02,0x76,0xf2,0x23,0xcc,0xa1,
+0x3d,0x9b,0xd3,0x88,0x7d,0x7c,0x23,0xe6,0x6d,0xa0,0x84,0xf4,0xe7,0x7b,0x78,0x93,
+0x25,0x89,0x18,0x07,0xad,0x2d,0xb5,0xb3,0xbe,0x3d,0xa2,0x59,0xd8,0x8d,0x05,0x0b,
+0x9a,0x62,0xb1,0xf8,0xf3,0xb5,0x5c,0xf5,0x3d,0x72,0x19,0xb3,0x58,0x9f,0x41,0x2b,
+0x63,0xb6,0x33,0x98,0x83,0x6b,0x96,0xdf,0xb0,0x49,0x2e,0xaf,0x61,0x3b,0x44,0xa3,
+0x06,0xf5,0xc9,0xae,0xdf,0xd0,0xee,0xbb,0x83,0x76,0x47,0xef,0xde,0xa9,0x79,0x36,
+0x5a,0x88,0x77,0xf6,0x8d,0xf1,0xce,0xa5,0xf0,0xb4,0x61,0xef,0x56,0x67,0xb9,0xd2,
+0xfd,0xcd,0x70,0x78,0x95,0x1f,0xf4,0xed,0x71,0x40,0xaf,0xc7,0xea,0x01,0x33,0x7d,
+0x27,0x05,0xca,0x42,0xc0,0xcd,0xa0,0xcf,0x72,0x98,0xfb,0xce,0xb0,0x3f,0xea,0xa9,
+0xba,0x2a,0xe3,0xcf,0xa4,0x16,0x31,0xcb,0xb1,0xb1,0xc9,0xba,0x34,0xaf,0xdd,0x8e,
+0x30,0xb1,0xf9,0x09,0x50,0x67,0xa7,0xd2,0x74,0x41,0x72,0x47,0xbe,0x08,0xb5,0x7e,
+0x04,0xd4,0x9c,0x41,0x30,0x42,0x3c,0xfb,0x2e,0xf3,0x7c,0x7b,0x04,0x54,0x16,0x18,
+0x73,0x07,0xe1,0x08,0xf6,0xdd,0x91,0x60,0x65,0xc3,0x71,0x36,0x4c,0x20,0x6e,0x21,
+0xdb,0x5d,0xe6,0x4b,0xd4,0x96,0x10,0xf5,0xe5,0x12,0xb5,0x65,0xbe,0x34,0x4d,0x00,
+0x74,0x35,0x1c,0x31,0x0f,0x30,0xce,0x0f,0x74,0x56,0x78,0x46,0x5a,0x0e,0x27,0x57,
+0x84,0x35,0x97,0xec,0xb2,0x58,0xe2,0xe4,0x60,0x8f,0xce,0xef,0x20,0x8a,0xe2,0xf0,
+0xfa,0x56,0x1c,0x8c,0x9d,0xfc,0x89,0x07,0x34,0x08,0x5d,0x33,0x7f,0xbe,0x13,0xf3,
+0x86,0xf9,0x79,0xfb,0xee,0x9a,0x73,0xd4,0x16,0xf3,0xf5,0xb7,0xf8,0x66,0x72,0xf6,
+0x30,0x8a,0x19,0x87,0x4d,0x31,0x5f,0x2f,0xbf,0xbc,0xae,0x4d,0xcd,0x79,0xc4,0x36,
+0x6a,0x8b,0xf9,0xba,0xf9,0xf9,0xf2,0x3a,0xa7,0xed,0xcc,0x9e,0x33,0xc7,0xe8,0x2e,
+0x23,0x47,0xdb,0xab,0x8b,0x6c,0x53,0x3c,0xce,0x41,0x6c,0xac,0x5e,0x7f,0xa3,0x43,
+0x18,0x3b,0x4c,0x7f,0x6a,0x77,0xf5,0xee,0xe0,0xe6,0x10,0xc0,0xb3,0x6f,0x73,0xea,
+0x3b,0x2f,0x7e,0x10,0x2b,0x36,0x2f,0x89,0x63,0xe6,0xb7,0x38,0x60,0xb6,0x6f,0xf5,
+0x61,0xb1,0x89,0xfd,0x2a,0x81,0x78,0x68,0x72,0x76,0xd4,0x23,0xe6,0x71,0x8f,0x93,
+0x47,0x3c,0x3d,0xa6,0x9e,0x17,0x4b,0x83,0x5a,0xbb,0x94,0x81,0xbd,0x7b,0x40,0xdc,
+0x43,0xb1,0x7b,0xf4,0xdb,0x43,0x20,0x4c,0xb7,0xf7,0x92,0x65,0x65,0x53,0xd9,0xc4,
+0x82,0x90,0x9e,0x4d,0x24,0x08,0xa6,0x7b,0xa8,0xd2,0xa3,0xe4,0x1e,0xa2,0xb4,0x00,
+0xb8,0x87,0x24,0x25,0xb4,0xed,0xa1,0x48,0x8b,0x5a,0xfb,0xcc,0x21,0x35,0x1c,0x89,
+0x88,0xb2,0xaa,0x9a,0x13,0x2b,0xae,0x61,0x04,0xad,0xad,0xfc,0x87,0xf5,0x5d,0x66,
+0x15,0x44,0xd7,0xc5,0xd0,0x1d,0x52,0xd6,0x97,0x41,0x8a,0x70,0x4c,0xca,0x5b,0xdb,
+0xa4,0x08,0x67,0x90,0x1a,0x71,0x12,0x11,0xb4,0xb6,0x49,0x0d,0xb4,0x45,0x2a,0x7c,
+0xa3,0x37,0x83,0xb4,0xeb,0x4c,0x71,0xd9,0xf7,0x50,0x25,0xc5,0xc3,0x2d,0x0d,0x0f,
+0x3c,0xce,0xbd,0x54,0x41,0xca,0x2b,0xdb,0xb1,0xf0,0xaa,0xfa,0xb9,0xdf,0xfb,0x83,
+0x52,0x77,0x0c,0xff,0xf2,0x21,0xa1,0x15,0x81,0x9f,0x64,0x5c,0x98,0x6c,0x0e,0x5c,
+0x81,0xcd,0xf1,0xe5,0x34,0x07,0xf1,0x95,0xbb,0xe0,0xbd,0x8c,0xda,0x6c,0x0a,0x4b,
+0xf8,0x79,0x38,0xf9,0x02,0x4d,0x5a,0x2e,0xf5,0x6d,0xd3,0xc3,0x04,0x4f,0x69,0x20,
+0x91,0xae,0x8f,0x4a,0x95,0x74,0x33,0x48,0xe1,0x58,0xc5,0x8e,0xc7,0xac,0xe9,0x89,
+0xb0,0xbd,0x0f,0xcd,0xb9,0xe1,0xcc,0x20,0x03,0x89,0xb5,0x54,0xae,0x08,0xb3,0x95,
+0x32,0x27,0x0e,0x48,0xb9,0xdb,0x60,0x44,0x41,0x14,0xcc,0x88,0x15,0x11,0x09,0x09,
+0x9c,0x4c,0x90,0x0b,0x9c,0x9e,0x66,0x8d,0xe7,0x17,0x5c,0x1a,0x28,0x02,0x22,0x2e,
+0x76,0x08,0xe4,0x2b,0x2d,0x72,0xac,0x82,0x49,0x0a,0xba,0x45,0xea,0x70,0xa1,0xc3,
+0x6c,0x0b,0xd2,0xd2,0x1b,0xc0,0x4c,0xe3,0x0d,0xa0,0x9e,0x0f,0xd3,0x10,0x83,0xb9,
+0x40,0xc7,0xda,0x59,0x46,0xa1,0xc5,0x79,0x70,0x3a,0x80,0xab,0x54,0x95,0xc6,0xc6,
+0x58,0x72,0x23,0x5f,0x5a,0xfd,0xc2,0xb6,0xd4,0x16,0xdf,0xc4,0x1b,0xef,0xda,0xc6,
+0x2b,0xef,0x46,0x2d,0x7a,0x2b,0xcf,0x5f,0xd0,0x4f,0xb0,0xf5,0x04,0xb0,0xc3,0x42,
+0x92,0xd5,0x54,0xbe,0x18,0x4b,0x23,0x1c,0x7a,0x41,0x38,0x04,0x85,0x1e,0xd7,0x68,
+0x29,0x16,0xa5,0xf4,0xa6,0x7e,0xca,0x56,0x41,0x49,0xbe,0x4d,0xe7,0xbc,0xa0,0x07,
+0x4c,0x64,0x10,0xd2,0x54,0x4c,0x6c,0x79,0xd8,0x25,0x27,0x14,0xbb,0xca,0xd6,0x1b,
+0xf6,0x86,0xd1,0x6a,0x9b,0x90,0x6d,0x40,0x03,0x3c,0xbf,0xe3,0x37,0x92,0x9c,0x6a,
+0x21,0xab,0x44,0x57,0xe2,0xa1,0x65,0x2f,0xd7,0x18,0x0e,0x35,0x6c,0xb6,0x8f,0x95,
+0xe0,0xcb,0x82,0x57,0xc9,0x67,0x0b,0xe8,0xf8,0x4a,0x8b,0x53,0xbe,0xe2,0x4f,0x36,
+0x85,0xe3,0x0f,0xef,0xc3,0xae,0xf5,0x18,0x36,0xa8,0x9e,0x32,0xe0,0x3e,0xf8,0xfc,
+0x40,0x69,0xf5,0xd5,0xc1,0x2d,0x93,0xac,0xde,0x8a,0x38,0xae,0x85,0x0c,0x6e,0x7d,
+0xb4,0x41,0xcb,0xb5,0x19,0x49,0xc5,0x1e,0x22,0x7b,0xe3,0xa1,0x4d,0xe1,0x42,0x69,
+0x35,0x8c,0xe8,0x13,0x05,0xcf,0x77,0xc2,0x08,0x5a,0x25,0xfc,0x73,0x09,0x65,0x67,
+0xec,0x7d,0xf0,0xc1,0x83,0x4d,0x4e,0x8c,0x60,0xff,0x6e,0xeb,0x33,0x79,0x8d,0x7d,
+0xc7,0x61,0x1e,0x1e,0x84,0x0c,0xb9,0x5e,0x1b,0x35,0x64,0x0b,0x08,0xf6,0xc8,0xb5,
+0xc2,0xde,0x43,0x67,0x3a,0xcb,0x94,0x2a,0x4b,0x96,0x4f,0x8c,0x1e,0x74,0xb0,0x33,
+0xb5,0x67,0xbe,0x67,0x70,0xeb,0x94,0x93,0xc7,0x27,0xd0,0x93,0x91,0xe7,0x96,0xd1,
+0x1f,0x53,0x1e,0x48,0xe7,0x32,0xe2,0xa8,0x74,0x0e,0x3d,0x07,0xd2,0x63,0x8a,0x64,
+0xc1,0xa5,0x6d,0x42,0xee,0x12,0x0a,0x8b,0x75,0x15,0xb0,0x00,0x9c,0x47,0x42,0x96,
+0xd0,0xe4,0x7d,0x14,0x6d,0xb4,0x1a,0xdb,0x69,0xad,0xed,0xf4,0x60,0x7b,0x6b,0x42,
+0x87,0x9e,0xac,0x3c,0xc3,0x8d,0xf7,0x41,0x63,0x67,0x5b,0x6f,0x50,0xb3,0xad,0xb5,
+0x6d,0xbd,0xc1,0x6e,0xdb,0x19,0x58,0x13,0xf2,0x69,0x4c,0x52,0x7b,0xb9,0x5c,0xc1,
+0x37,0x40,0xcc,0xa6,0x6d,0x8b,0xce,0x2f,0x40,0xbd,0x5e,0x3f,0x75,0x1f,0x2f,0x41,
+0x98,0x9b,0x5f,0x9c,0x9f,0xf1,0x3b,0x91,0x56,0x76,0xe9,0xcf,0x7f,0x0b,0xa8,0xa7,
+0x3c,0x7f,0xbf,0x40,0x70,0x4a,0x2f,0xb3,0x34,0x9a,0xd4,0x0b,0xf1,0x27,0x13,0x84,
+0xcd,0xcc,0x15,0x88,0xb5,0x71,0xa3,0x0e,0xd4,0x71,0xbb,0x77,0x21,0xd0,0xc3,0x5a,
+0x1f,0xe1,0x62,0x08,0x9f,0xbb,0xad,0x06,0x32,0x26,0xf0,0xd9,0x41,0x05,0x37,0xf7,
+0x75,0xa5,0xc5,0xd5,0xcc,0x03,0x0c,0xcf,0xa5,0x19,0x4a,0xd0,0xcf,0x16,0xdc,0xdd,
+0xc3,0x8c,0x7f,0x62,0x05,0x6c,0x8b,0x7f,0x7d,0x65,0xf4,0x95,0x58,0x33,0x26,0x46,
+0xd8,0xbb,0x30,0xb1,0xe7,0x30,0xb5,0xac,0xa0,0x37,0x41,0x3e,0x64,0x6a,0x69,0xd4,
+0xf8,0xf0,0x1c,0x5c,0xb3,0x45,0x0c,0x2d,0xa2,0xa0,0x90,0xda,0x96,0x90,0xa0,0xa0,
+0x94,0x13,0xa1,0xed,0x66,0x2c,0xc1,0x77,0xb3,0x9e,0x91,0x06,0x74,0x7b,0x01,0x5f,
+0xcc,0x7a,0x38,0x00,0xff,0x02,0x61,0xbd,0x28,0xcf,0x3a,0x8f,0xbe,0x72,0x90,0x5e,
+0x7d,0x2e,0x3f,0xc0,0xd3,0x00,0xa6,0x4c,0x2a,0x29,0x48,0xeb,0x0f,0x21,0xa4,0x17,
+0x51,0x46,0xd9,0xf1,0x51,0xf6,0xc5,0x94,0xbd,0xb9,0x45,0x9f,0xa7,0x1f,0x15,0x51,
+0xa4,0x15,0xdd,0x8b,0xca,0x27,0xe5,0x7f,0xff,0x49,0xd3,0x72,0x5c,0x5d,0x91,0xc7,
+0x89,0x2b,0x2b,0x22,0xa0,0xf8,0xb9,0x34,0xd2,0x1f,0x81,0x67,0x2f,0x2f,0xd2,0x50,
+0x42,0xaf,0x2f,0x0d,0x31,0xf0,0x17,0x13,0x96,0x51,0x30,0xfb,0xd4,0xee,0x48,0x0a,
+0x0c,0x59,0x12,0xf9,0x69,0x5c,0x0d,0x47,0x69,0x33,0xb0,0x78,0x5a,0x2d,0xc9,0xbb,
+0x7d,0xa3,0xa6,0x6f,0x2a,0x63,0x96,0x47,0xff,0xff,0x47,0xa7,0xd7,0x1d,0x68,0x2f,
+0xb6,0x05,0x19,0xef,0x9d,0x30,0xf4,0xac,0xb2,0xe7,0x2a,0x98,0xf4,0xaa,0x70,0x98,
+0xd8,0x9d,0x00,0x5e,0x1a,0x4b,0x47,0x4b,0x16,0xcf,0xbe,0xab,0xeb,0xbb,0x83,0x6c,
+0xa4,0x4d,0x9f,0x5e,0x4c,0xef,0x0c,0x00,0x08,0xdc,0x5f,0x54,0x07,0x94,0xdf,0xc9,
+0xbc,0x34,0x58,0x5e,0xd4,0x52,0x77,0x43,0x5c,0x37,0x94,0x46,0x51,0x0d,0x42,0x45,
+0x20,0x51,0x99,0x51,0x1a,0xe3,0xd6,0x15,0x21,0x04,0x35,0xc9,0xef,0x6a,0x29,0x6d,
+0x1a,0x46,0x91,0x17,0xb3,0x94,0x31,0x46,0x48,0x10,0x58,0x78,0x79,0x55,0x5a,0xb9,
+0x23,0x5e,0x71,0x15,0x00,0x04,0xd5,0xd8,0x23,0x44,0xad,0xa0,0x40,0x2b,0xc0,0x88,
+0xca,0xb7,0x12,0xbe,0x59,0xd8,0x9f,0xfb,0xe0,0x74,0x7a,0xfa,0x73,0xf6,0x41,0xe9,
+0x00,0xc3,0xe0,0x46,0xa1,0x19,0x14,0x22,0xc4,0x4e,0xa6,0x24,0xc3,0x2c,0x32,0x43,
+0x4d,0xba,0x32,0x1f,0x95,0xd6,0x87,0x2b,0x6d,0x57,0x87,0x13,0x2b,0x8f,0x8b,0x16,
+0x33,0x65,0x59,0x6f,0x6a,0xbe,0x2b,0xc7,0xb4,0x37,0x4c,0x61,0x8a,0xb0,0x1c,0xd3,
+0x76,0x2f,0x85,0xa9,0xb1,0x6f,0x1b,0xc4,0xba,0x4e,0x1c,0xf3,0x45,0xcb,0xb0,0xf3,
+0x53,0x9a,0xf0,0x37,0x38,0xa5,0xe0,0x37,0x38,0xeb,0x12,0x62,0x09,0x10,0xcf,0x6c,
+0x6e,0x94,0x28,0x5b,0x89,0x4a,0x24,0x83,0xe1,0xd5,0x32,0xfe,0x6b,0xa1,0x5a,0xf0,
+0x73,0xa1,0xff,0x00,0xbe,0x96,0xcf,0x54,0x46,0x34,0x00,0x00,};
 
 static const unsigned int dummy_align__userCfg_shtml = 4;
 static const unsigned char data__userCfg_shtml[] = {
@@ -4775,1319 +2596,304 @@ static const unsigned char data__userCfg_shtml[] = {
 0x2f,0x75,0x73,0x65,0x72,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x00,0x00,
 
 /* HTTP header */
-/* "HTTP/1.0 200 OK
+/* "HTTP/1.0 200 OK
 " (17 bytes) */
 0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
 0x0a,
-/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
+/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
 " (63 bytes) */
 0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
 0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
 0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
 0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-/* "Content-type: text/html
-Expires: Fri, 10 Apr 2008 14:00:00 GMT
-Pragma: no-cache
+/* "Content-type: text/html
+" (25 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
+0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,
+/* "Cache-Control: no-cache
+" (25 bytes) */
+0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x3a,0x20,0x6e,
+0x6f,0x2d,0x63,0x61,0x63,0x68,0x65,0x0d,0x0a,
+/* "ETag: "865a6338"
+" (18 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x38,0x36,0x35,0x61,0x36,0x33,0x33,0x38,0x22,
+0x0d,0x0a,
+/* "Content-Encoding: gzip
+" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x45,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,
+0x3a,0x20,0x67,0x7a,0x69,0x70,0x0d,0x0a,
+/* "Vary: Accept-Encoding
+" (23 bytes) */
+0x56,0x61,0x72,0x79,0x3a,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2d,0x45,0x6e,0x63,
+0x6f,0x64,0x69,0x6e,0x67,0x0d,0x0a,
+/* "Content-Length: 1308
+
+" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x31,0x33,0x30,0x38,0x0d,0x0a,0x0d,0x0a,
+/* gzip file data (1308 bytes) */
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xc5,0x59,0x51,0x6f,0xe2,0x46,
+0x10,0x7e,0x4e,0xa5,0xfe,0x87,0xad,0x75,0x92,0xe1,0x21,0xf8,0x52,0x9d,0xaa,0x2a,
+0x18,0x4b,0x09,0xe1,0xa4,0xe8,0x7a,0x21,0x22,0xa4,0x55,0x9f,0xac,0xc5,0x5e,0xc3,
+0x5e,0xcc,0xda,0x5a,0xaf,0x39,0xec,0xaa,0xff,0xa9,0xbf,0xa1,0xbf,0xac,0xbb,0xb6,
+0x81,0x5d,0x6c,0x83,0x21,0x46,0xe5,0x25,0x30,0x33,0x3b,0xf3,0xf9,0x9b,0x5d,0xcf,
+0xcc,0xc6,0xfc,0xe9,0x61,0x3c,0x9c,0xfe,0xf9,0x3c,0x02,0x0b,0xb6,0xf4,0xad,0x1f,
+0x7f,0x30,0x8b,0xbf,0x57,0xe6,0x02,0x41,0x57,0x7c,0xb9,0x32,0x97,0x88,0x41,0xe0,
+0x2c,0x20,0x8d,0x10,0x1b,0x68,0xaf,0xd3,0xcf,0xd7,0xbf,0x6a,0xc0,0xe0,0x3a,0x50,
+0x7c,0x4c,0x86,0x99,0x8f,0xac,0x71,0x88,0xc8,0x64,0xfa,0xc5,0x34,0xf2,0x9f,0x92,
+0xde,0xc7,0xe4,0x0d,0x50,0xe4,0x0f,0xb4,0x88,0x25,0x3e,0x8a,0x16,0x08,0x31,0x0d,
+0xb0,0x24,0x44,0x03,0x8d,0xa1,0x35,0x33,0x9c,0x28,0xd2,0xc0,0x82,0x22,0x6f,0xa0,
+0xf1,0xaf,0x46,0x66,0xd5,0xcb,0x84,0x4a,0x9c,0xc8,0xa1,0x38,0x64,0x92,0x44,0x7c,
+0xbc,0x98,0x38,0x0c,0x07,0x04,0x7c,0xe8,0x60,0xb7,0x0b,0xfe,0xe2,0x81,0x58,0x4c,
+0x09,0x70,0x03,0x27,0x5e,0x22,0xc2,0x7a,0x73,0xc4,0x46,0x3e,0x12,0x5f,0xef,0x93,
+0x47,0x57,0x18,0xf5,0xc1,0xdf,0xfd,0x1a,0x27,0x71,0x84,0xe8,0x30,0x20,0x1e,0x9e,
+0x0f,0xa1,0xef,0xcf,0xa0,0xf3,0xd6,0x09,0xb8,0x53,0xd5,0x1a,0x7b,0xa0,0xf3,0xa1,
+0xa3,0xb3,0x35,0x7b,0xe5,0xe6,0xcf,0xdc,0x08,0xb1,0x29,0x7f,0x1a,0xbd,0xdb,0x05,
+0xd5,0xf2,0xde,0x0a,0xfa,0x31,0x02,0x03,0x10,0xf4,0x62,0x45,0xd5,0x3f,0xee,0x79,
+0x02,0x59,0xa5,0xe7,0x5c,0x5e,0xe9,0x59,0xa8,0xb8,0xe7,0x3a,0xdf,0x43,0x48,0x46,
+0x4e,0x7c,0xe7,0xba,0x14,0x45,0xd1,0xce,0xf5,0x9e,0x58,0xf2,0xec,0xc8,0x9a,0xfe,
+0x01,0xb7,0xf7,0x30,0x76,0xa9,0x82,0x57,0x11,0xaa,0x2e,0x37,0xf2,0x43,0x0e,0xab,
+0xc8,0xdd,0x13,0xab,0x4e,0x1b,0x50,0xbb,0x5d,0x3f,0xd9,0x47,0x5a,0x43,0xac,0x23,
+0x6b,0x0e,0xb9,0x9d,0x22,0xba,0xe4,0x14,0xe1,0x88,0x05,0x54,0x71,0xac,0x2a,0x54,
+0xd7,0xb2,0xae,0x09,0xb7,0x0f,0x88,0x21,0x87,0x55,0x32,0xbc,0x51,0x55,0xf3,0x9c,
+0x6b,0x0f,0xec,0x8b,0xdf,0xd0,0x0a,0xd1,0x3b,0xba,0xbc,0x5f,0xef,0xbc,0xcb,0xb2,
+0xad,0xdb,0x50,0xbc,0x0c,0x3e,0xfb,0x01,0x64,0x9d,0xa0,0xe7,0x6f,0x2d,0xba,0x3d,
+0x16,0x7c,0xc6,0x6b,0xe4,0x76,0x3e,0x75,0xfb,0x47,0x83,0x24,0x15,0x41,0x92,0xa3,
+0x41,0x92,0xd3,0x82,0xa4,0x15,0x41,0xd2,0xa3,0x41,0xd2,0x46,0x41,0x9e,0x03,0x4c,
+0xd8,0xd8,0x7b,0x24,0x0c,0xf1,0xfc,0x31,0x99,0xb5,0x0a,0x55,0x75,0xc8,0x70,0xdf,
+0xf0,0xac,0xc8,0x49,0x7d,0xe4,0xa4,0x69,0xe4,0xe4,0xac,0xc8,0x69,0x7d,0xe4,0xb4,
+0x69,0xe4,0x66,0x6c,0x4f,0x02,0x06,0xc5,0x2b,0x7a,0x32,0x5b,0x49,0x44,0xab,0xd2,
+0xea,0x78,0x54,0xb2,0x39,0x35,0x54,0x52,0x19,0x2a,0x69,0x10,0x2a,0x39,0x35,0x54,
+0x5a,0x19,0x2a,0x6d,0x10,0xea,0x10,0x81,0x72,0xa5,0x33,0x0d,0xa5,0x82,0x9a,0x46,
+0x51,0xe4,0x45,0xbd,0x9f,0x05,0x6e,0x22,0xd7,0x5a,0xa1,0x42,0x14,0x38,0x3e,0x8c,
+0x22,0x5e,0x95,0x03,0x97,0x06,0x61,0x74,0xcd,0x82,0x50,0xdb,0xab,0xbf,0x26,0xb4,
+0xee,0x1c,0x84,0x09,0x81,0x60,0xdb,0x01,0x40,0xd9,0x93,0x91,0xbb,0x92,0x44,0x92,
+0xd2,0xc5,0xab,0x5d,0x0c,0xc2,0x20,0x26,0x88,0x6a,0x59,0xdf,0x71,0x25,0xeb,0x78,
+0xf5,0x8e,0x35,0x4b,0xac,0xbc,0x12,0x1a,0x15,0x9c,0x50,0xda,0xb9,0x68,0x67,0xc3,
+0x8d,0x6e,0x2a,0x0c,0xec,0xac,0x39,0xd1,0xac,0xaf,0xa3,0xa7,0x57,0x8e,0xec,0xc6,
+0x2a,0x3c,0xee,0x40,0x66,0x3f,0x63,0x5f,0x59,0x2b,0xc8,0x29,0x50,0x71,0xa5,0x8f,
+0x15,0x25,0x66,0x68,0xa9,0x59,0x26,0x2c,0x1a,0x18,0x1a,0x93,0x17,0x9e,0x99,0x38,
+0xea,0x45,0xa2,0x99,0xd2,0x4a,0xb6,0xb6,0x68,0x87,0xf6,0x59,0x94,0x3f,0x93,0x98,
+0x10,0x4c,0xe6,0x20,0x77,0x23,0xd8,0x34,0x0d,0x1f,0xd7,0x2c,0x38,0x82,0xe6,0x7b,
+0x40,0xdf,0x86,0xde,0xfc,0x6c,0x2c,0x7f,0xf0,0xf5,0x20,0x6f,0x88,0x62,0x9a,0xed,
+0xb7,0xf7,0xe1,0xc9,0xfa,0xab,0x23,0x78,0x00,0x8e,0xae,0x21,0x6f,0xc7,0x56,0xe8,
+0x10,0x32,0xd1,0x08,0xb5,0x89,0x0c,0xb1,0xc5,0x7b,0x88,0x1a,0xb1,0x05,0xa2,0x04,
+0xb1,0x36,0x21,0xb9,0x68,0x85,0x1d,0xf4,0x48,0xbc,0xe0,0x6c,0x58,0x0f,0x99,0x0b,
+0x20,0x7c,0x48,0x58,0xf2,0x2d,0x1f,0xfb,0xc5,0x41,0x33,0xf8,0x49,0xb3,0xf6,0xdb,
+0x82,0xfd,0xa3,0xc9,0xfb,0xe7,0xeb,0xef,0x14,0x86,0x9b,0x73,0x60,0x96,0x8e,0xb5,
+0xb2,0x9a,0x1f,0xad,0x2c,0x43,0xcf,0x90,0x42,0x3e,0x41,0x20,0x1a,0x15,0xc7,0xad,
+0x64,0x69,0xd4,0x3a,0x32,0x67,0x95,0x52,0x2f,0xa0,0x4b,0x80,0xdd,0x81,0xfe,0xba,
+0x6d,0xd6,0x75,0xc0,0x63,0x2c,0x02,0x2e,0x7b,0x1e,0xbf,0x4c,0x75,0x00,0xb3,0x6e,
+0x7e,0xa0,0xef,0xda,0xf9,0x9e,0x33,0xc7,0x7a,0x1d,0x58,0xf1,0xa8,0xd9,0xd0,0xc1,
+0x0f,0x0c,0x76,0xd9,0xe2,0xf6,0xd3,0xc7,0x8f,0xe1,0xba,0x0f,0x3c,0xf1,0xae,0xbd,
+0xf5,0x91,0xc7,0xfa,0x87,0x48,0x96,0xa9,0x8a,0xe2,0xd9,0xcc,0x0f,0x9c,0x83,0x49,
+0xd9,0x12,0xf4,0x32,0x9a,0x80,0xe1,0xf8,0x6b,0x0d,0x33,0x3b,0x86,0xf2,0xfc,0xd4,
+0xea,0x43,0xcb,0xf4,0xe1,0x0c,0x6d,0xdf,0x59,0xd9,0x0f,0xfb,0x46,0xb3,0xf2,0xae,
+0xd5,0x16,0xdd,0xf0,0x2d,0x4f,0xbd,0x10,0x5b,0x26,0x26,0x61,0xcc,0xf2,0xe9,0x4b,
+0x17,0xd3,0x97,0x9e,0x71,0x59,0x1e,0x5a,0x00,0xe1,0x89,0xcb,0x29,0x94,0xa5,0x11,
+0x4e,0xb9,0xf4,0xe6,0x17,0x9d,0xcf,0x66,0xa6,0x11,0xbe,0x07,0x97,0x68,0xa7,0x4f,
+0xc2,0x95,0x75,0xe6,0x25,0x5c,0xb9,0xf4,0x04,0x5c,0x33,0x7a,0x81,0x64,0x0e,0xef,
+0x9e,0x2e,0x96,0x47,0x3e,0x7c,0xd9,0xc5,0xf4,0xd5,0x80,0x2f,0x75,0x8e,0x2b,0xe8,
+0x72,0x54,0x61,0x1b,0x59,0xdc,0xcc,0x15,0xcd,0x20,0x6d,0xa7,0xc0,0x1d,0xa0,0x9d,
+0xa8,0xc5,0x4d,0xd5,0x70,0xb3,0xab,0x43,0xe4,0x0e,0xd3,0xff,0xbb,0xd5,0xd5,0x19,
+0x74,0x1f,0xd5,0xa4,0x35,0xae,0xe4,0x99,0xb3,0x19,0x2c,0x65,0x82,0xdd,0x01,0x53,
+0xc5,0x6d,0xee,0x2a,0x3b,0x1f,0x57,0x4f,0xdb,0x5c,0xc5,0x00,0x5c,0xde,0x62,0x1b,
+0x45,0x1b,0x6f,0x89,0x43,0xe7,0xb8,0xb6,0x94,0x2c,0x21,0x9d,0x63,0x72,0x2d,0x6a,
+0xc9,0x2d,0xc8,0x65,0x97,0x28,0x29,0x8f,0x4f,0x2f,0x97,0x79,0x0b,0xfd,0xac,0x59,
+0x62,0x80,0xf6,0x6d,0x3e,0x1f,0xdb,0xf7,0xeb,0xce,0xb2,0xdb,0x20,0x33,0xd2,0xe5,
+0x41,0x91,0x12,0x5f,0x92,0xbc,0x7b,0xb7,0xa8,0x98,0x92,0x13,0x31,0x25,0x25,0x4c,
+0x49,0xeb,0x98,0xd2,0x13,0x31,0xa5,0x25,0x4c,0x69,0x3b,0x98,0xb2,0xe1,0xdc,0x1e,
+0x7b,0xf6,0x66,0xea,0x6e,0x9c,0xc3,0xf2,0x55,0x46,0x01,0x31,0x2c,0x2b,0x2e,0x84,
+0x34,0x39,0x0f,0x69,0x52,0x87,0x34,0xb9,0x18,0xd2,0xf4,0x3c,0xa4,0x69,0x1d,0xd2,
+0x96,0xb2,0xbf,0xb9,0x4f,0xb0,0xc5,0x15,0x48,0xe7,0xdf,0x7f,0x9a,0x60,0x54,0x6e,
+0x56,0x0a,0x78,0x54,0x91,0xb5,0x8d,0x2c,0x39,0x1d,0x59,0x52,0x81,0x2c,0x69,0x1f,
+0x59,0x7a,0x3a,0xb2,0xb4,0x02,0x59,0xe3,0x6c,0x1e,0xac,0x30,0xf5,0x75,0xe9,0x1c,
+0x8d,0xa8,0x33,0x1c,0xbd,0x16,0xc1,0x15,0xb2,0x67,0x31,0x63,0x01,0xd1,0x8e,0xf0,
+0x95,0x3f,0x7e,0xc1,0x57,0xb1,0xa4,0x60,0x83,0x97,0xaa,0x25,0xe6,0x7c,0x64,0x37,
+0x56,0x03,0xfd,0xe5,0xee,0xf7,0xd1,0x79,0x4f,0x6a,0x1a,0x62,0xca,0x53,0xe7,0xd3,
+0xba,0x35,0xa5,0xff,0x10,0x49,0xa9,0x31,0xbe,0xc1,0x15,0xcc,0xa5,0x9c,0x7c,0xea,
+0x28,0x23,0xe1,0xb7,0x48,0xb7,0xa4,0x3b,0x31,0x1e,0xa8,0xb8,0x05,0xe3,0x25,0x54,
+0xfc,0x1f,0xec,0x3f,0xa4,0x4b,0xe8,0xfa,0x1f,0x1b,0x00,0x00,};
+
+static const unsigned int dummy_align__workCfg_shtml = 5;
+static const unsigned char data__workCfg_shtml[] = {
+/* /workCfg.shtml (15 chars) */
+0x2f,0x77,0x6f,0x72,0x6b,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x00,0x00,
 
-" (85 bytes) */
+/* HTTP header */
+/* "HTTP/1.0 200 OK
+" (17 bytes) */
+0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
+0x0a,
+/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
+" (63 bytes) */
+0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
+0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
+0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
+0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
+/* "Content-type: text/html
+" (25 bytes) */
 0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
-0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,0x45,0x78,0x70,0x69,0x72,0x65,0x73,
-0x3a,0x20,0x46,0x72,0x69,0x2c,0x20,0x31,0x30,0x20,0x41,0x70,0x72,0x20,0x32,0x30,
-0x30,0x38,0x20,0x31,0x34,0x3a,0x30,0x30,0x3a,0x30,0x30,0x20,0x47,0x4d,0x54,0x0d,
-0x0a,0x50,0x72,0x61,0x67,0x6d,0x61,0x3a,0x20,0x6e,0x6f,0x2d,0x63,0x61,0x63,0x68,
-0x65,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (6943 bytes) */
-0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0d,
-0x0a,0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a,0x09,0x3c,0x68,0x65,0x61,0x64,0x3e,
-0x0d,0x0a,0x09,0x09,0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,
-0x74,0x3d,0x22,0x55,0x54,0x46,0x2d,0x38,0x22,0x20,0x2f,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x69,0x74,0x6c,0x65,0x3e,0x4f,0x70,0x65,
-0x6e,0x52,0x54,0x4b,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x69,0x6e,0x6b,0x20,0x72,0x65,0x6c,0x3d,
-0x22,0x73,0x74,0x79,0x6c,0x65,0x73,0x68,0x65,0x65,0x74,0x22,0x20,0x74,0x79,0x70,
-0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x2f,0x63,0x73,0x73,0x22,0x20,0x68,0x72,0x65,
-0x66,0x3d,0x22,0x63,0x73,0x73,0x2f,0x73,0x74,0x79,0x6c,0x65,0x2e,0x63,0x73,0x73,
-0x22,0x20,0x2f,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,
-0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x24,0x28,0x69,
-0x64,0x29,0x20,0x7b,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x6f,0x63,0x75,
-0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,
-0x79,0x49,0x64,0x28,0x69,0x64,0x29,0x3b,0x20,0x7d,0x3b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
-0x6e,0x20,0x75,0x73,0x65,0x72,0x43,0x6f,0x6e,0x66,0x69,0x67,0x43,0x61,0x6c,0x6c,
-0x62,0x61,0x63,0x6b,0x28,0x6f,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,
-0x74,0x55,0x73,0x65,0x72,0x50,0x61,0x63,0x6b,0x65,0x74,0x54,0x79,0x70,0x65,0x27,
-0x29,0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x55,0x73,0x65,0x72,0x50,0x61,0x63,
-0x6b,0x65,0x74,0x54,0x79,0x70,0x65,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,
-0x3d,0x20,0x6f,0x2e,0x75,0x73,0x65,0x72,0x50,0x61,0x63,0x6b,0x65,0x74,0x54,0x79,
-0x70,0x65,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x55,0x73,0x65,0x72,0x50,
-0x61,0x63,0x6b,0x65,0x74,0x52,0x61,0x74,0x65,0x27,0x29,0x29,0x20,0x24,0x28,0x27,
-0x74,0x78,0x74,0x55,0x73,0x65,0x72,0x50,0x61,0x63,0x6b,0x65,0x74,0x52,0x61,0x74,
-0x65,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x75,0x73,
-0x65,0x72,0x50,0x61,0x63,0x6b,0x65,0x74,0x52,0x61,0x74,0x65,0x3b,0x0d,0x0a,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
-0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x43,0x61,0x6e,0x45,0x63,0x75,0x41,0x64,0x64,
-0x72,0x65,0x73,0x73,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x43,0x61,
-0x6e,0x45,0x63,0x75,0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x27,0x29,0x2e,0x76,0x61,
-0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x63,0x61,0x6e,0x45,0x63,0x75,0x41,0x64,
-0x64,0x72,0x65,0x73,0x73,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x43,0x61,
-0x6e,0x42,0x61,0x75,0x64,0x72,0x61,0x74,0x65,0x27,0x29,0x29,0x20,0x24,0x28,0x27,
-0x74,0x78,0x74,0x43,0x61,0x6e,0x42,0x61,0x75,0x64,0x72,0x61,0x74,0x65,0x27,0x29,
-0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x63,0x61,0x6e,0x42,0x61,
-0x75,0x64,0x72,0x61,0x74,0x65,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x43,
-0x61,0x6e,0x50,0x61,0x63,0x6b,0x65,0x74,0x54,0x79,0x70,0x65,0x27,0x29,0x29,0x20,
-0x24,0x28,0x27,0x74,0x78,0x74,0x43,0x61,0x6e,0x50,0x61,0x63,0x6b,0x65,0x74,0x54,
-0x79,0x70,0x65,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,
-0x63,0x61,0x6e,0x50,0x61,0x63,0x6b,0x65,0x74,0x54,0x79,0x70,0x65,0x3b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
-0x24,0x28,0x27,0x74,0x78,0x74,0x43,0x61,0x6e,0x50,0x61,0x63,0x6b,0x65,0x74,0x52,
-0x61,0x74,0x65,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x43,0x61,0x6e,
-0x50,0x61,0x63,0x6b,0x65,0x74,0x52,0x61,0x74,0x65,0x27,0x29,0x2e,0x76,0x61,0x6c,
-0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x63,0x61,0x6e,0x50,0x61,0x63,0x6b,0x65,0x74,
-0x52,0x61,0x74,0x65,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x43,0x61,0x6e,
-0x54,0x65,0x72,0x6d,0x72,0x65,0x73,0x69,0x73,0x74,0x6f,0x72,0x27,0x29,0x29,0x20,
-0x24,0x28,0x27,0x74,0x78,0x74,0x43,0x61,0x6e,0x54,0x65,0x72,0x6d,0x72,0x65,0x73,
-0x69,0x73,0x74,0x6f,0x72,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,
-0x6f,0x2e,0x63,0x61,0x6e,0x54,0x65,0x72,0x6d,0x72,0x65,0x73,0x69,0x73,0x74,0x6f,
-0x72,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x43,0x61,0x6e,0x42,0x61,0x75,
-0x64,0x72,0x61,0x74,0x65,0x44,0x65,0x74,0x65,0x63,0x74,0x27,0x29,0x29,0x20,0x24,
-0x28,0x27,0x74,0x78,0x74,0x43,0x61,0x6e,0x42,0x61,0x75,0x64,0x72,0x61,0x74,0x65,
-0x44,0x65,0x74,0x65,0x63,0x74,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,
-0x20,0x6f,0x2e,0x63,0x61,0x6e,0x42,0x61,0x75,0x64,0x72,0x61,0x74,0x65,0x44,0x65,
-0x74,0x65,0x63,0x74,0x3b,0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x4c,
-0x65,0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x78,0x27,0x29,0x29,0x20,0x24,0x28,0x27,
-0x74,0x78,0x74,0x4c,0x65,0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x78,0x27,0x29,0x2e,
-0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,
-0x61,0x74,0x28,0x6f,0x2e,0x6c,0x65,0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x78,0x29,
-0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x34,0x29,0x3b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,
-0x27,0x74,0x78,0x74,0x4c,0x65,0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x79,0x27,0x29,
-0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x4c,0x65,0x76,0x65,0x72,0x41,0x72,0x6d,
-0x42,0x79,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x70,0x61,0x72,
-0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x6c,0x65,0x76,0x65,0x72,0x41,
-0x72,0x6d,0x42,0x79,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x34,0x29,
-0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,
-0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x4c,0x65,0x76,0x65,0x72,0x41,0x72,
-0x6d,0x42,0x7a,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x4c,0x65,0x76,
-0x65,0x72,0x41,0x72,0x6d,0x42,0x7a,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,
-0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x6c,
-0x65,0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x7a,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,
-0x65,0x64,0x28,0x34,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x50,0x6f,
-0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x78,0x27,
-0x29,0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x4f,0x66,
-0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x78,0x27,0x29,0x2e,0x76,0x61,0x6c,
-0x75,0x65,0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,
-0x6f,0x2e,0x70,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,
-0x74,0x42,0x78,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x34,0x29,0x3b,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
-0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,
-0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x79,0x27,0x29,0x29,0x20,0x24,0x28,0x27,
-0x74,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,
-0x73,0x74,0x42,0x79,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x70,
-0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x70,0x6f,0x69,0x6e,
-0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x79,0x29,0x2e,0x74,
-0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x34,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,
-0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,
-0x74,0x42,0x7a,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x50,0x6f,0x69,
-0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x7a,0x27,0x29,
-0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,
-0x6f,0x61,0x74,0x28,0x6f,0x2e,0x70,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,
-0x65,0x72,0x65,0x73,0x74,0x42,0x7a,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,
-0x28,0x34,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x52,0x6f,0x74,0x61,
-0x74,0x69,0x6f,0x6e,0x52,0x62,0x76,0x78,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x74,
-0x78,0x74,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,0x62,0x76,0x78,0x27,0x29,
-0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,
-0x6f,0x61,0x74,0x28,0x6f,0x2e,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,0x62,
-0x76,0x78,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x34,0x29,0x3b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,
-0x28,0x24,0x28,0x27,0x74,0x78,0x74,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,
-0x62,0x76,0x79,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x52,0x6f,0x74,
-0x61,0x74,0x69,0x6f,0x6e,0x52,0x62,0x76,0x79,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,
-0x65,0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x6f,
-0x2e,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,0x62,0x76,0x79,0x29,0x2e,0x74,
-0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x34,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x74,
-0x78,0x74,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,0x62,0x76,0x7a,0x27,0x29,
-0x29,0x20,0x24,0x28,0x27,0x74,0x78,0x74,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,
-0x52,0x62,0x76,0x7a,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x70,
-0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x72,0x6f,0x74,0x61,
-0x74,0x69,0x6f,0x6e,0x52,0x62,0x76,0x7a,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,
-0x64,0x28,0x34,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x7d,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x3c,0x2f,
-0x68,0x65,0x61,0x64,0x3e,0x0d,0x0a,0x0d,0x0a,0x09,0x3c,0x62,0x6f,0x64,0x79,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x65,0x61,0x64,0x65,
-0x72,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x64,0x72,0x6f,0x70,0x73,
-0x2d,0x74,0x6f,0x70,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x61,0x3e,0x41,0x63,0x65,0x69,0x6e,0x6e,0x61,0x20,0x4f,
-0x70,0x65,0x6e,0x52,0x54,0x4b,0x3c,0x2f,0x61,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x2f,0x68,0x65,0x61,0x64,0x65,0x72,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,
-0x74,0x61,0x69,0x6e,0x65,0x72,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x64,0x69,
-0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x22,0x3e,0x20,
-0x20,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x68,0x65,0x61,0x64,0x65,0x72,0x20,0x63,
-0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x68,0x65,0x61,0x64,0x65,
-0x72,0x22,0x3e,0x20,0x20,0x0d,0x0a,0x09,0x09,0x09,0x09,0x09,0x3c,0x68,0x31,0x20,
-0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x68,0x65,0x61,0x64,
-0x65,0x72,0x5f,0x74,0x69,0x74,0x6c,0x65,0x22,0x3e,0x4d,0x45,0x4e,0x55,0x3c,0x2f,
-0x68,0x31,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,0x68,0x65,0x61,0x64,0x65,
-0x72,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x75,0x6c,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x62,0x6f,0x64,0x79,0x22,0x3e,0x0d,0x0a,
-0x09,0x09,0x09,0x09,0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,
-0x65,0x66,0x3d,0x22,0x72,0x75,0x6e,0x53,0x74,0x61,0x74,0x75,0x73,0x2e,0x73,0x68,
-0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,
-0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x52,0x75,0x6e,0x6e,0x69,0x6e,0x67,0x20,0x53,0x74,
-0x61,0x74,0x75,0x73,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,
-0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,
-0x3d,0x22,0x77,0x6f,0x72,0x6b,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,
-0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x57,0x6f,0x72,0x6b,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,
-0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,
-0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,
-0x3d,0x22,0x75,0x73,0x65,0x72,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,
-0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x20,0x69,0x73,0x2d,0x61,0x63,0x74,0x69,0x76,0x65,
-0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x55,0x73,0x65,0x72,
-0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,
-0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x69,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,
-0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x65,0x74,0x68,0x43,
-0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x45,0x74,0x68,0x65,0x72,
-0x6e,0x65,0x74,0x20,0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6f,
-0x6e,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,
-0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x64,
-0x65,0x76,0x69,0x63,0x65,0x49,0x6e,0x66,0x6f,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,
-0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x44,0x65,0x76,0x69,0x63,0x65,0x20,0x49,0x6e,0x66,0x6f,0x3c,0x2f,0x61,
-0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,0x75,0x6c,
-0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,
-0x77,0x72,0x61,0x70,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x68,0x65,0x61,
-0x64,0x65,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x31,0x3e,0x55,0x73,
-0x65,0x72,0x20,0x50,0x61,0x72,0x61,0x6d,0x65,0x74,0x65,0x72,0x73,0x3c,0x2f,0x68,
-0x31,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x2f,0x68,0x65,0x61,0x64,0x65,0x72,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x62,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x66,0x6f,0x72,0x6d,0x20,0x69,0x64,0x3d,0x27,0x55,
-0x73,0x65,0x72,0x43,0x6f,0x6e,0x66,0x69,0x67,0x27,0x20,0x6d,0x65,0x74,0x68,0x6f,
-0x64,0x3d,0x27,0x50,0x4f,0x53,0x54,0x27,0x20,0x61,0x63,0x74,0x69,0x6f,0x6e,0x3d,
-0x27,0x75,0x73,0x65,0x72,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x63,0x67,0x69,0x27,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x73,0x74,0x79,0x6c,
-0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x3a,0x34,0x30,0x30,0x70,0x78,0x3b,0x20,
-0x66,0x6c,0x6f,0x61,0x74,0x3a,0x6c,0x65,0x66,0x74,0x3b,0x22,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x73,0x75,0x62,0x62,0x6c,0x6f,0x63,0x6b,0x22,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x31,0x3e,0x55,
-0x53,0x45,0x52,0x20,0x43,0x4f,0x4d,0x3c,0x2f,0x68,0x31,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,
-0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,
-0x50,0x61,0x63,0x6b,0x65,0x74,0x5f,0x54,0x79,0x70,0x65,0x3a,0x3c,0x2f,0x6c,0x61,
-0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,
-0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x74,0x78,0x74,0x55,0x73,
-0x65,0x72,0x50,0x61,0x63,0x6b,0x65,0x74,0x54,0x79,0x70,0x65,0x27,0x20,0x6e,0x61,
-0x6d,0x65,0x3d,0x27,0x75,0x73,0x65,0x72,0x50,0x61,0x63,0x6b,0x65,0x74,0x54,0x79,
-0x70,0x65,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x36,0x27,0x20,0x2f,0x3e,
-0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,
-0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x50,0x61,0x63,0x6b,0x65,0x74,0x5f,0x52,
-0x61,0x74,0x65,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,
-0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,
-0x64,0x3d,0x27,0x74,0x78,0x74,0x55,0x73,0x65,0x72,0x50,0x61,0x63,0x6b,0x65,0x74,
-0x52,0x61,0x74,0x65,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x75,0x73,0x65,0x72,
-0x50,0x61,0x63,0x6b,0x65,0x74,0x52,0x61,0x74,0x65,0x27,0x20,0x73,0x69,0x7a,0x65,
-0x3d,0x27,0x31,0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x73,0x75,0x62,0x62,0x6c,0x6f,0x63,0x6b,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x31,0x3e,0x43,0x41,0x4e,0x3c,
-0x2f,0x68,0x31,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,
-0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x45,0x63,0x75,0x5f,0x41,0x64,0x64,0x72,
-0x65,0x73,0x73,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,
-0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,
-0x64,0x3d,0x27,0x74,0x78,0x74,0x43,0x61,0x6e,0x45,0x63,0x75,0x41,0x64,0x64,0x72,
-0x65,0x73,0x73,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x63,0x61,0x6e,0x45,0x63,
-0x75,0x41,0x64,0x64,0x72,0x65,0x73,0x73,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,
-0x31,0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x42,0x61,
-0x75,0x64,0x72,0x61,0x74,0x65,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,
-0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,
-0x27,0x20,0x69,0x64,0x3d,0x27,0x74,0x78,0x74,0x43,0x61,0x6e,0x42,0x61,0x75,0x64,
-0x72,0x61,0x74,0x65,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x63,0x61,0x6e,0x42,
-0x61,0x75,0x64,0x72,0x61,0x74,0x65,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,
-0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x50,0x61,0x63,
-0x6b,0x65,0x74,0x5f,0x54,0x79,0x70,0x65,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,
-0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,
-0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x74,0x78,0x74,0x43,0x61,0x6e,0x50,0x61,
-0x63,0x6b,0x65,0x74,0x54,0x79,0x70,0x65,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,
-0x63,0x61,0x6e,0x50,0x61,0x63,0x6b,0x65,0x74,0x54,0x79,0x70,0x65,0x27,0x20,0x73,
-0x69,0x7a,0x65,0x3d,0x27,0x31,0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,
-0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,
-0x31,0x22,0x3e,0x50,0x61,0x63,0x6b,0x65,0x74,0x5f,0x52,0x61,0x74,0x65,0x3a,0x3c,
-0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,
-0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x74,0x78,
-0x74,0x43,0x61,0x6e,0x50,0x61,0x63,0x6b,0x65,0x74,0x52,0x61,0x74,0x65,0x27,0x20,
-0x6e,0x61,0x6d,0x65,0x3d,0x27,0x63,0x61,0x6e,0x50,0x61,0x63,0x6b,0x65,0x74,0x52,
-0x61,0x74,0x65,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x36,0x27,0x20,0x2f,
-0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x54,0x65,0x72,0x6d,0x72,0x65,0x73,
-0x69,0x73,0x74,0x6f,0x72,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,
-0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,
-0x20,0x69,0x64,0x3d,0x27,0x74,0x78,0x74,0x43,0x61,0x6e,0x54,0x65,0x72,0x6d,0x72,
-0x65,0x73,0x69,0x73,0x74,0x6f,0x72,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x63,
-0x61,0x6e,0x54,0x65,0x72,0x6d,0x72,0x65,0x73,0x69,0x73,0x74,0x6f,0x72,0x27,0x20,
-0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,
-0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,
-0x5f,0x31,0x22,0x3e,0x42,0x61,0x75,0x64,0x72,0x61,0x74,0x65,0x5f,0x44,0x65,0x74,
-0x65,0x63,0x74,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,
-0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,
-0x64,0x3d,0x27,0x74,0x78,0x74,0x43,0x61,0x6e,0x42,0x61,0x75,0x64,0x72,0x61,0x74,
-0x65,0x44,0x65,0x74,0x65,0x63,0x74,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x63,
-0x61,0x6e,0x42,0x61,0x75,0x64,0x72,0x61,0x74,0x65,0x44,0x65,0x74,0x65,0x63,0x74,
-0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,
-0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x72,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,
-0x64,0x74,0x68,0x3a,0x34,0x30,0x30,0x70,0x78,0x3b,0x20,0x6d,0x61,0x72,0x67,0x69,
-0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x20,0x34,0x30,0x30,0x70,0x78,0x3b,0x22,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,
-0x6c,0x61,0x73,0x73,0x3d,0x22,0x73,0x75,0x62,0x62,0x6c,0x6f,0x63,0x6b,0x22,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,
-0x31,0x3e,0x49,0x4e,0x53,0x3c,0x2f,0x68,0x31,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x32,0x22,0x3e,0x4c,0x65,
-0x76,0x65,0x6c,0x5f,0x41,0x72,0x6d,0x5f,0x42,0x78,0x28,0x6d,0x29,0x3a,0x3c,0x2f,
-0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,
-0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x74,0x78,0x74,
-0x4c,0x65,0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x78,0x27,0x20,0x6e,0x61,0x6d,0x65,
-0x3d,0x27,0x6c,0x65,0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x78,0x27,0x20,0x73,0x69,
-0x7a,0x65,0x3d,0x27,0x31,0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,
-0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x32,
-0x22,0x3e,0x4c,0x65,0x76,0x65,0x6c,0x5f,0x41,0x72,0x6d,0x5f,0x42,0x79,0x28,0x6d,
-0x29,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,
-0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,
-0x27,0x74,0x78,0x74,0x4c,0x65,0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x79,0x27,0x20,
-0x6e,0x61,0x6d,0x65,0x3d,0x27,0x6c,0x65,0x76,0x65,0x72,0x41,0x72,0x6d,0x42,0x79,
-0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,
-0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,
-0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,
-0x65,0x6c,0x5f,0x32,0x22,0x3e,0x4c,0x65,0x76,0x65,0x6c,0x5f,0x41,0x72,0x6d,0x5f,
-0x42,0x7a,0x28,0x6d,0x29,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,
-0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,
-0x20,0x69,0x64,0x3d,0x27,0x74,0x78,0x74,0x4c,0x65,0x76,0x65,0x72,0x41,0x72,0x6d,
-0x42,0x7a,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x6c,0x65,0x76,0x65,0x72,0x41,
-0x72,0x6d,0x42,0x7a,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x36,0x27,0x20,
-0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x32,0x22,0x3e,0x50,0x6f,0x69,0x6e,0x74,0x5f,
-0x4f,0x66,0x5f,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x5f,0x42,0x78,0x28,0x6d,
-0x29,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,
-0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,
-0x27,0x74,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,
-0x65,0x73,0x74,0x42,0x78,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x70,0x6f,0x69,
-0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x78,0x27,0x20,
-0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,
-0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,
-0x5f,0x32,0x22,0x3e,0x50,0x6f,0x69,0x6e,0x74,0x5f,0x4f,0x66,0x5f,0x49,0x6e,0x74,
-0x65,0x72,0x65,0x73,0x74,0x5f,0x42,0x79,0x28,0x6d,0x29,0x3a,0x3c,0x2f,0x6c,0x61,
-0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,
-0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x74,0x78,0x74,0x50,0x6f,
-0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x79,0x27,
-0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x70,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,
-0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x79,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,
-0x31,0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x32,0x22,0x3e,0x50,0x6f,
-0x69,0x6e,0x74,0x5f,0x4f,0x66,0x5f,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x5f,
-0x42,0x7a,0x28,0x6d,0x29,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,
-0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,
-0x20,0x69,0x64,0x3d,0x27,0x74,0x78,0x74,0x50,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,
-0x6e,0x74,0x65,0x72,0x65,0x73,0x74,0x42,0x7a,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-0x27,0x70,0x6f,0x69,0x6e,0x74,0x4f,0x66,0x49,0x6e,0x74,0x65,0x72,0x65,0x73,0x74,
-0x42,0x7a,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x36,0x27,0x20,0x2f,0x3e,
-0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,
-0x61,0x62,0x65,0x6c,0x5f,0x32,0x22,0x3e,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,
-0x5f,0x52,0x62,0x76,0x78,0x28,0xc2,0xb0,0x29,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,
-0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,
-0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x74,0x78,0x74,0x52,0x6f,0x74,0x61,
-0x74,0x69,0x6f,0x6e,0x52,0x62,0x76,0x78,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,
-0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,0x62,0x76,0x78,0x27,0x20,0x73,0x69,
-0x7a,0x65,0x3d,0x27,0x31,0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,
-0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x32,
-0x22,0x3e,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x5f,0x52,0x62,0x76,0x79,0x28,
-0xc2,0xb0,0x29,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,
-0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,
-0x64,0x3d,0x27,0x74,0x78,0x74,0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,0x62,
-0x76,0x79,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x72,0x6f,0x74,0x61,0x74,0x69,
-0x6f,0x6e,0x52,0x62,0x76,0x79,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x36,
-0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x32,0x22,0x3e,0x52,0x6f,0x74,0x61,
-0x74,0x69,0x6f,0x6e,0x5f,0x52,0x62,0x76,0x7a,0x28,0xc2,0xb0,0x29,0x3a,0x3c,0x2f,
-0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,
-0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x74,0x78,0x74,
-0x52,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,0x62,0x76,0x7a,0x27,0x20,0x6e,0x61,
-0x6d,0x65,0x3d,0x27,0x72,0x6f,0x74,0x61,0x74,0x69,0x6f,0x6e,0x52,0x62,0x76,0x7a,
-0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x36,0x27,0x20,0x2f,0x3e,0x3c,0x2f,
-0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,
-0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x73,0x61,0x76,0x65,0x5f,
-0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x3c,0x70,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,
-0x27,0x73,0x75,0x62,0x6d,0x69,0x74,0x27,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x27,
-0x53,0x41,0x56,0x45,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x66,0x6f,0x72,0x6d,
-0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,
-0x78,0x74,0x2f,0x6a,0x61,0x76,0x61,0x73,0x63,0x72,0x69,0x70,0x74,0x27,0x20,0x73,
-0x72,0x63,0x3d,0x27,0x75,0x73,0x65,0x72,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x6a,
-0x73,0x27,0x3e,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x09,0x3c,
-0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,};
-
-static const unsigned int dummy_align__workCfg_shtml = 5;
-static const unsigned char data__workCfg_shtml[] = {
-/* /workCfg.shtml (15 chars) */
-0x2f,0x77,0x6f,0x72,0x6b,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x00,0x00,
-
-/* HTTP header */
-/* "HTTP/1.0 200 OK
-" (17 bytes) */
-0x48,0x54,0x54,0x50,0x2f,0x31,0x2e,0x30,0x20,0x32,0x30,0x30,0x20,0x4f,0x4b,0x0d,
-0x0a,
-/* "Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)
-" (63 bytes) */
-0x53,0x65,0x72,0x76,0x65,0x72,0x3a,0x20,0x6c,0x77,0x49,0x50,0x2f,0x31,0x2e,0x33,
-0x2e,0x31,0x20,0x28,0x68,0x74,0x74,0x70,0x3a,0x2f,0x2f,0x73,0x61,0x76,0x61,0x6e,
-0x6e,0x61,0x68,0x2e,0x6e,0x6f,0x6e,0x67,0x6e,0x75,0x2e,0x6f,0x72,0x67,0x2f,0x70,
-0x72,0x6f,0x6a,0x65,0x63,0x74,0x73,0x2f,0x6c,0x77,0x69,0x70,0x29,0x0d,0x0a,
-/* "Content-type: text/html
-Expires: Fri, 10 Apr 2008 14:00:00 GMT
-Pragma: no-cache
-
-" (85 bytes) */
-0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x74,0x79,0x70,0x65,0x3a,0x20,0x74,0x65,
-0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,0x45,0x78,0x70,0x69,0x72,0x65,0x73,
-0x3a,0x20,0x46,0x72,0x69,0x2c,0x20,0x31,0x30,0x20,0x41,0x70,0x72,0x20,0x32,0x30,
-0x30,0x38,0x20,0x31,0x34,0x3a,0x30,0x30,0x3a,0x30,0x30,0x20,0x47,0x4d,0x54,0x0d,
-0x0a,0x50,0x72,0x61,0x67,0x6d,0x61,0x3a,0x20,0x6e,0x6f,0x2d,0x63,0x61,0x63,0x68,
-0x65,0x0d,0x0a,0x0d,0x0a,
-/* raw file data (13236 bytes) */
-0x3c,0x21,0x44,0x4f,0x43,0x54,0x59,0x50,0x45,0x20,0x68,0x74,0x6d,0x6c,0x3e,0x0d,
-0x0a,0x3c,0x68,0x74,0x6d,0x6c,0x3e,0x0d,0x0a,0x09,0x3c,0x68,0x65,0x61,0x64,0x3e,
-0x0d,0x0a,0x09,0x09,0x3c,0x6d,0x65,0x74,0x61,0x20,0x63,0x68,0x61,0x72,0x73,0x65,
-0x74,0x3d,0x22,0x55,0x54,0x46,0x2d,0x38,0x22,0x20,0x2f,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x69,0x74,0x6c,0x65,0x3e,0x4f,0x70,0x65,
-0x6e,0x52,0x54,0x4b,0x3c,0x2f,0x74,0x69,0x74,0x6c,0x65,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x69,0x6e,0x6b,0x20,0x72,0x65,0x6c,0x3d,
-0x22,0x73,0x74,0x79,0x6c,0x65,0x73,0x68,0x65,0x65,0x74,0x22,0x20,0x74,0x79,0x70,
-0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x2f,0x63,0x73,0x73,0x22,0x20,0x68,0x72,0x65,
-0x66,0x3d,0x22,0x63,0x73,0x73,0x2f,0x73,0x74,0x79,0x6c,0x65,0x2e,0x63,0x73,0x73,
-0x22,0x20,0x2f,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x73,
-0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x24,0x28,0x69,
-0x64,0x29,0x20,0x7b,0x20,0x72,0x65,0x74,0x75,0x72,0x6e,0x20,0x64,0x6f,0x63,0x75,
-0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,
-0x79,0x49,0x64,0x28,0x69,0x64,0x29,0x3b,0x20,0x7d,0x3b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,
-0x6e,0x20,0x77,0x6f,0x72,0x6b,0x43,0x6f,0x6e,0x66,0x69,0x67,0x43,0x61,0x6c,0x6c,
-0x62,0x61,0x63,0x6b,0x28,0x6f,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6f,
-0x2e,0x64,0x69,0x73,0x70,0x20,0x3d,0x3d,0x20,0x30,0x29,0x20,0x7b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x73,0x65,0x74,0x54,0x61,0x62,0x28,0x27,0x62,0x6f,0x78,0x27,0x2c,
-0x31,0x2c,0x32,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x74,0x54,0x61,
-0x62,0x28,0x27,0x6d,0x65,0x6e,0x75,0x27,0x2c,0x31,0x2c,0x32,0x29,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,
-0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x64,0x69,0x73,0x70,
-0x20,0x3d,0x3d,0x20,0x31,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,
-0x74,0x54,0x61,0x62,0x28,0x27,0x62,0x6f,0x78,0x27,0x2c,0x31,0x2c,0x32,0x29,0x3b,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x74,0x54,0x61,0x62,0x28,0x27,0x6d,0x65,
-0x6e,0x75,0x27,0x2c,0x32,0x2c,0x32,0x29,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,
-0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x64,0x69,0x73,0x70,0x20,0x3d,0x3d,0x20,0x32,
-0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x74,0x54,0x61,0x62,0x28,
-0x27,0x62,0x6f,0x78,0x27,0x2c,0x32,0x2c,0x32,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,
-0x6c,0x73,0x65,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x73,0x65,0x74,0x54,0x61,
-0x62,0x28,0x27,0x62,0x6f,0x78,0x27,0x2c,0x31,0x2c,0x32,0x29,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x73,0x65,0x74,0x54,0x61,0x62,0x28,0x27,0x6d,0x65,0x6e,0x75,0x27,
-0x2c,0x31,0x2c,0x32,0x29,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,
-0x24,0x28,0x27,0x63,0x49,0x70,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x63,0x49,0x70,
-0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x63,0x49,0x70,
-0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x63,0x50,0x6f,0x72,0x74,0x27,
-0x29,0x29,0x20,0x24,0x28,0x27,0x63,0x50,0x6f,0x72,0x74,0x27,0x29,0x2e,0x76,0x61,
-0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x63,0x50,0x6f,0x72,0x74,0x3b,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x63,0x4d,0x6f,0x50,0x27,0x29,0x29,0x20,0x24,
-0x28,0x27,0x63,0x4d,0x6f,0x50,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,
-0x20,0x6f,0x2e,0x63,0x4d,0x6f,0x50,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,
-0x27,0x63,0x55,0x73,0x65,0x72,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x63,0x55,0x73,
-0x65,0x72,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x63,
-0x55,0x73,0x65,0x72,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x63,0x50,
-0x77,0x64,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x63,0x50,0x77,0x64,0x27,0x29,0x2e,
-0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x63,0x50,0x77,0x64,0x3b,0x0d,
-0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x61,0x49,0x70,0x27,0x29,0x29,
-0x20,0x24,0x28,0x27,0x61,0x49,0x70,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,
-0x3d,0x20,0x6f,0x2e,0x61,0x49,0x70,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,
-0x27,0x61,0x50,0x6f,0x72,0x74,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x61,0x50,0x6f,
-0x72,0x74,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x61,
-0x50,0x6f,0x72,0x74,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x61,0x4d,
-0x6f,0x50,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x61,0x4d,0x6f,0x50,0x27,0x29,0x2e,
-0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x61,0x4d,0x6f,0x50,0x3b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x61,0x55,0x73,0x65,0x72,0x27,0x29,0x29,
-0x20,0x24,0x28,0x27,0x61,0x55,0x73,0x65,0x72,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,
-0x65,0x20,0x3d,0x20,0x6f,0x2e,0x61,0x55,0x73,0x65,0x72,0x3b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
-0x20,0x28,0x24,0x28,0x27,0x61,0x50,0x77,0x64,0x27,0x29,0x29,0x20,0x24,0x28,0x27,
-0x61,0x50,0x77,0x64,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,
-0x2e,0x61,0x50,0x77,0x64,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,
-0x27,0x73,0x49,0x70,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x73,0x49,0x70,0x27,0x29,
-0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x73,0x49,0x70,0x3b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x73,0x50,0x6f,0x72,0x74,0x27,0x29,0x29,
-0x20,0x24,0x28,0x27,0x73,0x50,0x6f,0x72,0x74,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,
-0x65,0x20,0x3d,0x20,0x6f,0x2e,0x73,0x50,0x6f,0x72,0x74,0x3b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,
-0x20,0x28,0x24,0x28,0x27,0x73,0x4d,0x6f,0x50,0x27,0x29,0x29,0x20,0x24,0x28,0x27,
-0x73,0x4d,0x6f,0x50,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,
-0x2e,0x73,0x4d,0x6f,0x50,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x73,
-0x50,0x77,0x64,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x73,0x50,0x77,0x64,0x27,0x29,
-0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x73,0x50,0x77,0x64,0x3b,
-0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x62,0x70,0x74,0x20,0x3d,0x3d,
-0x20,0x30,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x72,0x61,
-0x64,0x69,0x6f,0x52,0x65,0x66,0x27,0x29,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,
-0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,
-0x20,0x69,0x66,0x20,0x28,0x6f,0x2e,0x62,0x70,0x74,0x20,0x3d,0x3d,0x20,0x31,0x29,
-0x20,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x72,0x61,0x64,0x69,0x6f,
-0x53,0x50,0x50,0x27,0x29,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x20,0x3d,0x20,
-0x74,0x72,0x75,0x65,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x69,0x66,
-0x20,0x28,0x6f,0x2e,0x62,0x70,0x74,0x20,0x3d,0x3d,0x20,0x32,0x29,0x20,0x7b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x27,0x72,0x61,0x64,0x69,0x6f,0x52,0x54,0x4b,
-0x27,0x29,0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x20,0x3d,0x20,0x74,0x72,0x75,
-0x65,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x7d,0x20,0x65,0x6c,0x73,0x65,0x20,0x7b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x24,0x28,0x27,0x72,0x61,0x64,0x69,0x6f,0x41,0x55,0x54,0x4f,0x27,0x29,
-0x2e,0x63,0x68,0x65,0x63,0x6b,0x65,0x64,0x20,0x3d,0x20,0x74,0x72,0x75,0x65,0x3b,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x7d,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x73,0x74,0x61,0x49,
-0x44,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x73,0x74,0x61,0x49,0x44,0x27,0x29,0x2e,
-0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x6f,0x2e,0x73,0x74,0x61,0x49,0x44,0x3b,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x61,0x6e,0x74,0x68,0x27,0x29,0x29,
-0x20,0x24,0x28,0x27,0x61,0x6e,0x74,0x68,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,
-0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,
-0x61,0x6e,0x74,0x68,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x34,0x29,
-0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x72,0x65,0x66,0x4c,0x61,0x74,
-0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x72,0x65,0x66,0x4c,0x61,0x74,0x27,0x29,0x2e,
-0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,
-0x61,0x74,0x28,0x6f,0x2e,0x72,0x65,0x66,0x4c,0x61,0x74,0x29,0x2e,0x74,0x6f,0x46,
-0x69,0x78,0x65,0x64,0x28,0x38,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x69,0x66,0x20,0x28,0x24,0x28,
-0x27,0x72,0x65,0x66,0x4c,0x6f,0x6e,0x27,0x29,0x29,0x20,0x24,0x28,0x27,0x72,0x65,
-0x66,0x4c,0x6f,0x6e,0x27,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x70,
-0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,0x28,0x6f,0x2e,0x72,0x65,0x66,0x4c,
-0x6f,0x6e,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,0x65,0x64,0x28,0x38,0x29,0x3b,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x69,0x66,0x20,0x28,0x24,0x28,0x27,0x72,0x65,0x66,0x48,0x65,0x69,0x27,0x29,
-0x29,0x20,0x24,0x28,0x27,0x72,0x65,0x66,0x48,0x65,0x69,0x27,0x29,0x2e,0x76,0x61,
-0x6c,0x75,0x65,0x20,0x3d,0x20,0x70,0x61,0x72,0x73,0x65,0x46,0x6c,0x6f,0x61,0x74,
-0x28,0x6f,0x2e,0x72,0x65,0x66,0x48,0x65,0x69,0x29,0x2e,0x74,0x6f,0x46,0x69,0x78,
-0x65,0x64,0x28,0x33,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x7d,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x3c,
-0x2f,0x68,0x65,0x61,0x64,0x3e,0x0d,0x0a,0x0d,0x0a,0x09,0x3c,0x62,0x6f,0x64,0x79,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x65,0x61,0x64,
-0x65,0x72,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,0x64,0x72,0x6f,0x70,
-0x73,0x2d,0x74,0x6f,0x70,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x61,0x3e,0x41,0x63,0x65,0x69,0x6e,0x6e,0x61,0x20,
-0x4f,0x70,0x65,0x6e,0x52,0x54,0x4b,0x3c,0x2f,0x61,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x68,0x65,0x61,0x64,0x65,0x72,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x6f,
-0x6e,0x74,0x61,0x69,0x6e,0x65,0x72,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x3c,0x64,
-0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x22,0x3e,
-0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x68,0x65,0x61,0x64,0x65,0x72,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x68,0x65,0x61,0x64,0x65,0x72,
-0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x31,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x68,0x65,0x61,0x64,0x65,0x72,0x5f,0x74,
-0x69,0x74,0x6c,0x65,0x22,0x3e,0x4d,0x45,0x4e,0x55,0x3c,0x2f,0x68,0x31,0x3e,0x0d,
-0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,0x68,0x65,0x61,0x64,0x65,0x72,0x3e,0x0d,0x0a,
-0x09,0x09,0x09,0x09,0x3c,0x75,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,
-0x65,0x6e,0x75,0x5f,0x62,0x6f,0x64,0x79,0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,
-0x09,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,
-0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,
-0x72,0x75,0x6e,0x53,0x74,0x61,0x74,0x75,0x73,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,
-0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x52,0x75,0x6e,0x6e,0x69,0x6e,0x67,0x20,0x53,0x74,0x61,0x74,0x75,0x73,
-0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x6c,0x69,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,
-0x74,0x65,0x6d,0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x77,0x6f,
-0x72,0x6b,0x43,0x66,0x67,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,
-0x6e,0x6b,0x20,0x69,0x73,0x2d,0x61,0x63,0x74,0x69,0x76,0x65,0x22,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x57,0x6f,0x72,0x6b,0x20,0x43,0x6f,0x6e,
-0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,
-0x6c,0x69,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,
-0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x75,0x73,0x65,0x72,0x43,0x66,0x67,0x2e,
-0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,
-0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x55,0x73,0x65,0x72,0x20,0x43,0x6f,0x6e,
-0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,
-0x6c,0x69,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x69,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x22,0x3e,0x3c,
-0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x65,0x74,0x68,0x43,0x66,0x67,0x2e,0x73,
-0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,
-0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,0x6e,0x6b,0x22,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x45,0x74,0x68,0x65,0x72,0x6e,0x65,0x74,0x20,
-0x43,0x6f,0x6e,0x66,0x69,0x67,0x75,0x72,0x61,0x74,0x69,0x6f,0x6e,0x3c,0x2f,0x61,
-0x3e,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x69,0x20,
-0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,
-0x22,0x3e,0x3c,0x61,0x20,0x68,0x72,0x65,0x66,0x3d,0x22,0x64,0x65,0x76,0x69,0x63,
-0x65,0x49,0x6e,0x66,0x6f,0x2e,0x73,0x68,0x74,0x6d,0x6c,0x22,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x6d,0x65,0x6e,0x75,0x5f,0x69,0x74,0x65,0x6d,0x5f,0x6c,0x69,
-0x6e,0x6b,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x44,0x65,
-0x76,0x69,0x63,0x65,0x20,0x49,0x6e,0x66,0x6f,0x3c,0x2f,0x61,0x3e,0x3c,0x2f,0x6c,
-0x69,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x2f,0x75,0x6c,0x3e,0x0d,0x0a,0x09,
-0x09,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x63,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x77,0x72,0x61,0x70,
-0x22,0x3e,0x0d,0x0a,0x09,0x09,0x09,0x09,0x3c,0x68,0x65,0x61,0x64,0x65,0x72,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x68,0x31,0x3e,0x57,0x6f,0x72,0x6b,0x20,0x43,
-0x6f,0x6e,0x66,0x69,0x67,0x3c,0x2f,0x68,0x31,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x68,0x65,
-0x61,0x64,0x65,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,
-0x76,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x77,0x69,0x64,0x74,0x68,0x3a,0x32,
-0x30,0x30,0x70,0x78,0x3b,0x20,0x66,0x6c,0x6f,0x61,0x74,0x3a,0x6c,0x65,0x66,0x74,
-0x3b,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x72,0x6f,0x77,0x4d,0x65,0x6e,0x75,0x22,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x6c,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x69,0x20,0x69,0x64,
-0x3d,0x22,0x62,0x6f,0x78,0x31,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,
-0x22,0x73,0x65,0x74,0x54,0x61,0x62,0x28,0x27,0x62,0x6f,0x78,0x27,0x2c,0x31,0x2c,
-0x32,0x29,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x68,0x6f,0x76,0x65,0x72,
-0x22,0x3e,0x52,0x4f,0x56,0x45,0x52,0x3a,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x57,0x6f,
-0x72,0x6b,0x20,0x61,0x73,0x20,0x72,0x6f,0x76,0x65,0x72,0x20,0x73,0x74,0x61,0x74,
-0x69,0x6f,0x6e,0x2e,0x20,0x55,0x73,0x65,0x72,0x20,0x63,0x61,0x6e,0x20,0x63,0x68,
-0x6f,0x6f,0x73,0x65,0x20,0x4e,0x54,0x52,0x49,0x50,0x20,0x43,0x4c,0x49,0x45,0x4e,
-0x54,0x20,0x6f,0x72,0x20,0x50,0x4f,0x49,0x4e,0x54,0x20,0x4f,0x4e,0x45,0x20,0x6d,
-0x6f,0x64,0x65,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x69,0x20,0x69,0x64,0x3d,0x22,
-0x62,0x6f,0x78,0x32,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x73,
-0x65,0x74,0x54,0x61,0x62,0x28,0x27,0x62,0x6f,0x78,0x27,0x2c,0x32,0x2c,0x32,0x29,
-0x22,0x3e,0x42,0x41,0x53,0x45,0x3a,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x57,0x6f,0x72,
-0x6b,0x20,0x61,0x73,0x20,0x62,0x61,0x73,0x65,0x20,0x73,0x74,0x61,0x74,0x69,0x6f,
-0x6e,0x20,0x77,0x69,0x74,0x68,0x20,0x4e,0x54,0x52,0x49,0x50,0x20,0x53,0x45,0x52,
-0x56,0x45,0x52,0x20,0x6d,0x6f,0x64,0x65,0x2e,0x20,0x50,0x6f,0x73,0x69,0x74,0x69,
-0x6f,0x6e,0x20,0x63,0x61,0x6e,0x20,0x62,0x65,0x20,0x72,0x65,0x66,0x65,0x72,0x65,
-0x6e,0x63,0x65,0x20,0x70,0x6f,0x73,0x20,0x73,0x65,0x74,0x20,0x62,0x79,0x20,0x75,
-0x73,0x65,0x72,0x20,0x6f,0x72,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x53,0x50,0x50,0x2f,0x52,0x54,0x4b,0x20,
-0x61,0x76,0x65,0x72,0x61,0x67,0x65,0x20,0x72,0x65,0x73,0x75,0x6c,0x74,0x2e,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x6c,
-0x69,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x75,0x6c,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x73,0x74,0x79,0x6c,
-0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x20,
-0x32,0x30,0x30,0x70,0x78,0x3b,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,
-0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x63,0x6f,0x6e,0x5f,0x62,0x6f,0x78,0x5f,0x31,
-0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x68,0x6f,0x76,0x65,0x72,0x22,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x69,
-0x64,0x3d,0x22,0x54,0x61,0x62,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,
-0x3d,0x22,0x4d,0x65,0x6e,0x75,0x62,0x6f,0x78,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,0x6c,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x69,0x20,0x69,0x64,0x3d,0x22,0x6d,
-0x65,0x6e,0x75,0x31,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x73,
-0x65,0x74,0x54,0x61,0x62,0x28,0x27,0x6d,0x65,0x6e,0x75,0x27,0x2c,0x31,0x2c,0x32,
-0x29,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x68,0x6f,0x76,0x65,0x72,0x22,
-0x3e,0x4e,0x54,0x52,0x49,0x50,0x20,0x43,0x4c,0x49,0x45,0x4e,0x54,0x3c,0x2f,0x6c,
-0x69,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x69,0x20,0x69,0x64,0x3d,0x22,
-0x6d,0x65,0x6e,0x75,0x32,0x22,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,
-0x73,0x65,0x74,0x54,0x61,0x62,0x28,0x27,0x6d,0x65,0x6e,0x75,0x27,0x2c,0x32,0x2c,
-0x32,0x29,0x22,0x20,0x3e,0x41,0x63,0x65,0x69,0x6e,0x6e,0x61,0x20,0x43,0x4c,0x49,
-0x45,0x4e,0x54,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x75,0x6c,0x3e,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,
-0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x43,0x6f,0x6e,
-0x74,0x65,0x6e,0x74,0x62,0x6f,0x78,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,
-0x69,0x64,0x3d,0x22,0x63,0x6f,0x6e,0x5f,0x6d,0x65,0x6e,0x75,0x5f,0x31,0x22,0x20,
-0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x68,0x6f,0x76,0x65,0x72,0x22,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x66,0x6f,0x72,0x6d,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,
-0x4e,0x74,0x72,0x69,0x70,0x43,0x6c,0x69,0x65,0x6e,0x74,0x43,0x6f,0x6e,0x66,0x69,
-0x67,0x27,0x20,0x6d,0x65,0x74,0x68,0x6f,0x64,0x3d,0x27,0x50,0x4f,0x53,0x54,0x27,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,
-0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x22,0x20,0x69,0x64,
-0x3d,0x22,0x6e,0x63,0x45,0x6e,0x22,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x6e,0x63,
-0x45,0x6e,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x64,0x69,0x73,0x70,0x6c,
-0x61,0x79,0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x49,0x50,0x3a,
-0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,
-0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x63,
-0x49,0x70,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x63,0x49,0x70,0x27,0x20,0x73,
-0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,
-0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,
-0x31,0x22,0x3e,0x50,0x4f,0x52,0x54,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,
-0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,
-0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x63,0x50,0x6f,0x72,0x74,0x27,0x20,0x6e,0x61,
-0x6d,0x65,0x3d,0x27,0x63,0x50,0x6f,0x72,0x74,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,
-0x27,0x31,0x38,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,
-0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x4d,
-0x4f,0x55,0x4e,0x54,0x20,0x50,0x4f,0x49,0x4e,0x54,0x3a,0x3c,0x2f,0x6c,0x61,0x62,
-0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,
-0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x63,0x4d,0x6f,0x50,0x27,0x20,
-0x6e,0x61,0x6d,0x65,0x3d,0x27,0x63,0x4d,0x6f,0x50,0x27,0x20,0x73,0x69,0x7a,0x65,
-0x3d,0x27,0x31,0x38,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,
-0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,
-0x55,0x53,0x45,0x52,0x20,0x4e,0x41,0x4d,0x45,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,
-0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,
-0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x63,0x55,0x73,0x65,0x72,0x27,0x20,
-0x6e,0x61,0x6d,0x65,0x3d,0x27,0x63,0x55,0x73,0x65,0x72,0x27,0x20,0x73,0x69,0x7a,
-0x65,0x3d,0x27,0x31,0x38,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,
-0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,
-0x3e,0x50,0x41,0x53,0x53,0x57,0x4f,0x52,0x44,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,
-0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,
-0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x63,0x50,0x77,0x64,0x27,0x20,0x6e,
-0x61,0x6d,0x65,0x3d,0x27,0x63,0x50,0x77,0x64,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,
-0x27,0x31,0x38,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x73,0x61,0x76,0x65,
-0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x74,0x79,0x70,
-0x65,0x3d,0x27,0x62,0x75,0x74,0x74,0x6f,0x6e,0x27,0x20,0x76,0x61,0x6c,0x75,0x65,
-0x3d,0x27,0x53,0x41,0x56,0x45,0x27,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,
-0x22,0x6e,0x63,0x5f,0x65,0x6e,0x61,0x62,0x6c,0x65,0x28,0x30,0x29,0x22,0x2f,0x3e,
-0x20,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x69,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x6d,0x61,0x72,
-0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x20,0x31,0x30,0x30,0x70,0x78,0x3b,
-0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,
-0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x62,0x75,0x74,0x74,0x6f,0x6e,0x27,0x20,0x76,
-0x61,0x6c,0x75,0x65,0x3d,0x27,0x45,0x4e,0x41,0x42,0x4c,0x45,0x27,0x20,0x6f,0x6e,
-0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x6e,0x63,0x5f,0x65,0x6e,0x61,0x62,0x6c,0x65,
-0x28,0x31,0x29,0x22,0x2f,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x66,0x6f,
-0x72,0x6d,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,
-0x76,0x20,0x69,0x64,0x3d,0x22,0x63,0x6f,0x6e,0x5f,0x6d,0x65,0x6e,0x75,0x5f,0x32,
-0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,
-0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x66,0x6f,
-0x72,0x6d,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x41,0x63,0x65,0x69,0x6e,0x6e,0x61,
-0x43,0x6f,0x6e,0x66,0x69,0x67,0x27,0x20,0x6d,0x65,0x74,0x68,0x6f,0x64,0x3d,0x27,
-0x50,0x4f,0x53,0x54,0x27,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,
-0x74,0x22,0x20,0x69,0x64,0x3d,0x22,0x61,0x63,0x45,0x6e,0x22,0x20,0x6e,0x61,0x6d,
-0x65,0x3d,0x22,0x61,0x63,0x45,0x6e,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
-0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,
-0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,
-0x22,0x3e,0x49,0x50,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,
-0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,
-0x69,0x64,0x3d,0x27,0x61,0x49,0x70,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x61,
-0x49,0x70,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,0x27,0x20,0x2f,0x3e,
-0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,
-0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,
-0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x50,0x4f,0x52,0x54,0x3a,0x3c,0x2f,0x6c,
-0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,
-0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x61,0x50,0x6f,0x72,
-0x74,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x61,0x50,0x6f,0x72,0x74,0x27,0x20,
-0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,
-0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,
-0x5f,0x31,0x22,0x3e,0x4d,0x4f,0x55,0x4e,0x54,0x20,0x50,0x4f,0x49,0x4e,0x54,0x3a,
-0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,
-0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x61,
-0x4d,0x6f,0x50,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x61,0x4d,0x6f,0x50,0x27,
-0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,
-0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,
-0x6c,0x5f,0x31,0x22,0x3e,0x55,0x53,0x45,0x52,0x20,0x4e,0x41,0x4d,0x45,0x3a,0x3c,
-0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,
-0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x61,0x55,
-0x73,0x65,0x72,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x61,0x55,0x73,0x65,0x72,
-0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,0x27,0x20,0x2f,0x3e,0x3c,0x2f,
-0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,
-0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,
-0x65,0x6c,0x5f,0x31,0x22,0x3e,0x50,0x41,0x53,0x53,0x57,0x4f,0x52,0x44,0x3a,0x3c,
-0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,
-0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x61,0x50,
-0x77,0x64,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x61,0x50,0x77,0x64,0x27,0x20,
-0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x62,0x72,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,
-0x22,0x73,0x61,0x76,0x65,0x5f,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,
-0x75,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,
-0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x62,0x75,0x74,0x74,0x6f,0x6e,0x27,0x20,
-0x76,0x61,0x6c,0x75,0x65,0x3d,0x27,0x53,0x41,0x56,0x45,0x27,0x20,0x6f,0x6e,0x63,
-0x6c,0x69,0x63,0x6b,0x3d,0x22,0x61,0x63,0x5f,0x65,0x6e,0x61,0x62,0x6c,0x65,0x28,
-0x30,0x29,0x22,0x2f,0x3e,0x20,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x73,0x74,0x79,0x6c,0x65,
-0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x20,0x31,
-0x30,0x30,0x70,0x78,0x3b,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x62,0x75,
-0x74,0x74,0x6f,0x6e,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x62,0x75,0x74,0x74,
-0x6f,0x6e,0x27,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x27,0x45,0x4e,0x41,0x42,0x4c,
-0x45,0x27,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x61,0x63,0x5f,0x65,
-0x6e,0x61,0x62,0x6c,0x65,0x28,0x31,0x29,0x22,0x2f,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x2f,0x66,0x6f,0x72,0x6d,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,
-0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,
-0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x69,0x64,0x3d,
-0x22,0x63,0x6f,0x6e,0x5f,0x62,0x6f,0x78,0x5f,0x32,0x22,0x20,0x73,0x74,0x79,0x6c,
-0x65,0x3d,0x22,0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x6e,0x6f,0x6e,0x65,0x22,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,
-0x69,0x64,0x3d,0x22,0x54,0x61,0x62,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x4d,0x65,0x6e,0x75,0x62,0x6f,0x78,0x22,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x75,
-0x6c,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x6c,0x69,0x20,0x69,0x64,0x3d,0x22,
-0x62,0x61,0x6d,0x65,0x6e,0x75,0x31,0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x68,0x6f,0x76,0x65,0x72,0x22,0x3e,0x4e,0x54,0x52,0x49,0x50,0x20,0x53,0x45,0x52,
-0x56,0x45,0x52,0x3c,0x2f,0x6c,0x69,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x75,0x6c,0x3e,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,
-0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x64,0x69,0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x43,0x6f,0x6e,
-0x74,0x65,0x6e,0x74,0x62,0x6f,0x78,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,0x76,0x20,
-0x69,0x64,0x3d,0x22,0x63,0x6f,0x6e,0x5f,0x62,0x61,0x6d,0x65,0x6e,0x75,0x5f,0x31,
-0x22,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x68,0x6f,0x76,0x65,0x72,0x22,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x66,0x6f,0x72,0x6d,0x20,0x6e,0x61,0x6d,0x65,
-0x3d,0x27,0x4e,0x74,0x72,0x69,0x70,0x53,0x65,0x72,0x76,0x65,0x72,0x43,0x6f,0x6e,
-0x66,0x69,0x67,0x27,0x20,0x6d,0x65,0x74,0x68,0x6f,0x64,0x3d,0x27,0x50,0x4f,0x53,
-0x54,0x27,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,
-0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x73,0x75,0x62,0x62,0x6c,0x6f,0x63,
-0x6b,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x68,0x31,0x3e,0x42,0x61,0x73,0x65,0x20,0x53,0x74,0x61,0x74,0x69,0x6f,
-0x6e,0x3c,0x2f,0x68,0x31,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,
-0x74,0x22,0x20,0x69,0x64,0x3d,0x22,0x6e,0x73,0x45,0x6e,0x22,0x20,0x6e,0x61,0x6d,
-0x65,0x3d,0x22,0x6e,0x73,0x45,0x6e,0x22,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,
-0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3a,0x6e,0x6f,0x6e,0x65,0x22,0x3e,0x0d,0x0a,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,
-0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x33,
-0x22,0x3e,0x53,0x74,0x61,0x74,0x69,0x6f,0x6e,0x20,0x49,0x44,0x3a,0x3c,0x2f,0x6c,
-0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,
-0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x73,0x74,0x61,0x49,
-0x44,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x73,0x74,0x61,0x49,0x44,0x27,0x20,
-0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,
-0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,
-0x5f,0x33,0x22,0x3e,0x41,0x6e,0x74,0x65,0x6e,0x6e,0x61,0x20,0x48,0x65,0x69,0x67,
-0x68,0x74,0x28,0x6d,0x29,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,
-0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,
-0x20,0x69,0x64,0x3d,0x27,0x61,0x6e,0x74,0x68,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-0x27,0x61,0x6e,0x74,0x68,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,0x27,
-0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,
-0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x33,0x22,0x3e,0x52,0x65,0x66,0x65,0x72,
-0x65,0x6e,0x63,0x65,0x20,0x4c,0x61,0x74,0x69,0x74,0x75,0x64,0x65,0x28,0xc2,0xb0,
-0x29,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,
-0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,
-0x27,0x72,0x65,0x66,0x4c,0x61,0x74,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x72,
-0x65,0x66,0x4c,0x61,0x74,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,0x27,
-0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,
-0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x33,0x22,0x3e,0x52,0x65,0x66,0x65,0x72,
-0x65,0x6e,0x63,0x65,0x20,0x4c,0x6f,0x6e,0x67,0x69,0x74,0x75,0x64,0x65,0x28,0xc2,
-0xb0,0x29,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,
-0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,
-0x3d,0x27,0x72,0x65,0x66,0x4c,0x6f,0x6e,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,
-0x72,0x65,0x66,0x4c,0x6f,0x6e,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,
-0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x33,0x22,0x3e,0x52,0x65,0x66,0x65,
-0x72,0x65,0x6e,0x63,0x65,0x20,0x48,0x65,0x69,0x67,0x68,0x74,0x28,0x6d,0x29,0x3a,
-0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,
-0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x72,
-0x65,0x66,0x48,0x65,0x69,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x72,0x65,0x66,
-0x48,0x65,0x69,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,0x27,0x20,0x2f,
-0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,
-0x62,0x65,0x6c,0x5f,0x33,0x22,0x3e,0x50,0x4f,0x53,0x49,0x54,0x49,0x4f,0x4e,0x20,
-0x54,0x59,0x50,0x45,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,
-0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x72,0x61,0x64,0x69,0x6f,0x27,0x20,0x73,
-0x74,0x79,0x6c,0x65,0x3d,0x27,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,
-0x74,0x3a,0x30,0x70,0x78,0x27,0x20,0x69,0x64,0x3d,0x27,0x72,0x61,0x64,0x69,0x6f,
-0x52,0x65,0x66,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x62,0x70,0x74,0x22,0x20,
-0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x30,0x22,0x2f,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x65,0x78,0x74,0x20,0x63,
-0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x66,0x67,0x63,0x62,0x22,0x3e,0x52,0x45,0x46,
-0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,
-0x3d,0x27,0x72,0x61,0x64,0x69,0x6f,0x27,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,
-0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,0x35,0x70,0x78,0x27,
-0x20,0x69,0x64,0x3d,0x27,0x72,0x61,0x64,0x69,0x6f,0x53,0x50,0x50,0x27,0x20,0x6e,
-0x61,0x6d,0x65,0x3d,0x22,0x62,0x70,0x74,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,
-0x22,0x31,0x22,0x2f,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x74,0x65,0x78,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,
-0x63,0x66,0x67,0x63,0x62,0x22,0x3e,0x53,0x50,0x50,0x3c,0x2f,0x74,0x65,0x78,0x74,
-0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x72,0x61,0x64,0x69,
-0x6f,0x27,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x27,0x6d,0x61,0x72,0x67,0x69,0x6e,
-0x2d,0x6c,0x65,0x66,0x74,0x3a,0x35,0x70,0x78,0x27,0x20,0x69,0x64,0x3d,0x27,0x72,
-0x61,0x64,0x69,0x6f,0x52,0x54,0x4b,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x62,
-0x70,0x74,0x22,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x22,0x32,0x22,0x2f,0x3e,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x65,
-0x78,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x63,0x66,0x67,0x63,0x62,0x22,
-0x3e,0x52,0x54,0x4b,0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,
-0x74,0x79,0x70,0x65,0x3d,0x27,0x72,0x61,0x64,0x69,0x6f,0x27,0x20,0x73,0x74,0x79,
-0x6c,0x65,0x3d,0x27,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,0x6c,0x65,0x66,0x74,0x3a,
-0x35,0x70,0x78,0x27,0x20,0x69,0x64,0x3d,0x27,0x72,0x61,0x64,0x69,0x6f,0x41,0x55,
-0x54,0x4f,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,0x22,0x62,0x70,0x74,0x22,0x20,0x76,
-0x61,0x6c,0x75,0x65,0x3d,0x22,0x33,0x22,0x2f,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x74,0x65,0x78,0x74,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x63,0x66,0x67,0x63,0x62,0x22,0x3e,0x41,0x55,0x54,0x4f,
-0x3c,0x2f,0x74,0x65,0x78,0x74,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x62,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x64,0x69,
-0x76,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x73,0x75,0x62,0x62,0x6c,0x6f,0x63,
-0x6b,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x68,0x31,0x3e,0x4e,0x54,0x52,0x49,0x50,0x20,0x53,0x65,0x72,0x76,0x65,
-0x72,0x3c,0x2f,0x68,0x31,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x49,0x50,0x3a,0x3c,0x2f,0x6c,
-0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,
-0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x73,0x49,0x70,0x27,
-0x20,0x6e,0x61,0x6d,0x65,0x3d,0x27,0x73,0x49,0x70,0x27,0x20,0x73,0x69,0x7a,0x65,
-0x3d,0x27,0x31,0x38,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,
-0x63,0x6c,0x61,0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,
-0x50,0x4f,0x52,0x54,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,0x6e,
-0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,0x20,
-0x69,0x64,0x3d,0x27,0x73,0x50,0x6f,0x72,0x74,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-0x27,0x73,0x50,0x6f,0x72,0x74,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,
-0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,0x73,
-0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x4d,0x4f,0x55,0x4e,
-0x54,0x20,0x50,0x4f,0x49,0x4e,0x54,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,
-0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,
-0x74,0x27,0x20,0x69,0x64,0x3d,0x27,0x73,0x4d,0x6f,0x50,0x27,0x20,0x6e,0x61,0x6d,
-0x65,0x3d,0x27,0x73,0x4d,0x6f,0x50,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,
-0x38,0x27,0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x70,0x3e,0x3c,0x6c,0x61,0x62,0x65,0x6c,0x20,0x63,0x6c,0x61,
-0x73,0x73,0x3d,0x22,0x6c,0x61,0x62,0x65,0x6c,0x5f,0x31,0x22,0x3e,0x50,0x41,0x53,
-0x53,0x57,0x4f,0x52,0x44,0x3a,0x3c,0x2f,0x6c,0x61,0x62,0x65,0x6c,0x3e,0x3c,0x69,
-0x6e,0x70,0x75,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,0x65,0x78,0x74,0x27,
-0x20,0x69,0x64,0x3d,0x27,0x73,0x50,0x77,0x64,0x27,0x20,0x6e,0x61,0x6d,0x65,0x3d,
-0x27,0x73,0x50,0x77,0x64,0x27,0x20,0x73,0x69,0x7a,0x65,0x3d,0x27,0x31,0x38,0x27,
-0x20,0x2f,0x3e,0x3c,0x2f,0x70,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x62,0x72,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,
-0x64,0x69,0x76,0x20,0x69,0x64,0x3d,0x22,0x73,0x61,0x76,0x65,0x5f,0x62,0x75,0x74,
-0x74,0x6f,0x6e,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,0x74,0x20,0x63,0x6c,0x61,0x73,0x73,0x3d,
-0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x62,
-0x75,0x74,0x74,0x6f,0x6e,0x27,0x20,0x76,0x61,0x6c,0x75,0x65,0x3d,0x27,0x53,0x41,
-0x56,0x45,0x27,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,0x6b,0x3d,0x22,0x6e,0x73,0x5f,
-0x65,0x6e,0x61,0x62,0x6c,0x65,0x28,0x30,0x29,0x22,0x2f,0x3e,0x20,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x69,0x6e,0x70,0x75,
-0x74,0x20,0x73,0x74,0x79,0x6c,0x65,0x3d,0x22,0x6d,0x61,0x72,0x67,0x69,0x6e,0x2d,
-0x6c,0x65,0x66,0x74,0x3a,0x20,0x31,0x30,0x30,0x70,0x78,0x3b,0x22,0x20,0x63,0x6c,
-0x61,0x73,0x73,0x3d,0x22,0x62,0x75,0x74,0x74,0x6f,0x6e,0x22,0x20,0x74,0x79,0x70,
-0x65,0x3d,0x27,0x62,0x75,0x74,0x74,0x6f,0x6e,0x27,0x20,0x76,0x61,0x6c,0x75,0x65,
-0x3d,0x27,0x45,0x4e,0x41,0x42,0x4c,0x45,0x27,0x20,0x6f,0x6e,0x63,0x6c,0x69,0x63,
-0x6b,0x3d,0x22,0x6e,0x73,0x5f,0x65,0x6e,0x61,0x62,0x6c,0x65,0x28,0x31,0x29,0x22,
-0x2f,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,
-0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x66,0x6f,0x72,0x6d,0x3e,0x0d,
-0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,
-0x0a,0x09,0x09,0x09,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x3c,0x2f,0x64,0x69,0x76,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x0d,0x0a,0x09,0x09,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x20,
-0x74,0x79,0x70,0x65,0x3d,0x22,0x74,0x65,0x78,0x74,0x2f,0x6a,0x61,0x76,0x61,0x73,
-0x63,0x72,0x69,0x70,0x74,0x22,0x3e,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x73,0x65,
-0x74,0x54,0x61,0x62,0x28,0x6e,0x61,0x6d,0x65,0x2c,0x63,0x75,0x72,0x73,0x65,0x6c,
-0x2c,0x6e,0x29,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x6f,0x72,0x20,0x28,0x69,0x3d,0x31,0x3b,0x20,
-0x69,0x3c,0x3d,0x6e,0x3b,0x20,0x69,0x2b,0x2b,0x29,0x20,0x7b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x76,0x61,0x72,0x20,0x6d,0x65,0x6e,0x75,0x20,0x3d,0x20,0x64,0x6f,0x63,
-0x75,0x6d,0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,
-0x42,0x79,0x49,0x64,0x28,0x6e,0x61,0x6d,0x65,0x2b,0x69,0x29,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x76,0x61,0x72,0x20,0x63,0x6f,0x6e,0x3d,0x64,0x6f,0x63,0x75,0x6d,
-0x65,0x6e,0x74,0x2e,0x67,0x65,0x74,0x45,0x6c,0x65,0x6d,0x65,0x6e,0x74,0x42,0x79,
-0x49,0x64,0x28,0x22,0x63,0x6f,0x6e,0x5f,0x22,0x2b,0x6e,0x61,0x6d,0x65,0x2b,0x22,
-0x5f,0x22,0x2b,0x69,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x6d,0x65,0x6e,0x75,
-0x2e,0x63,0x6c,0x61,0x73,0x73,0x4e,0x61,0x6d,0x65,0x3d,0x69,0x3d,0x3d,0x63,0x75,
-0x72,0x73,0x65,0x6c,0x3f,0x22,0x68,0x6f,0x76,0x65,0x72,0x22,0x3a,0x22,0x22,0x3b,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x63,0x6f,0x6e,0x2e,0x73,0x74,0x79,0x6c,0x65,0x2e,
-0x64,0x69,0x73,0x70,0x6c,0x61,0x79,0x3d,0x69,0x3d,0x3d,0x63,0x75,0x72,0x73,0x65,
-0x6c,0x3f,0x22,0x62,0x6c,0x6f,0x63,0x6b,0x22,0x3a,0x22,0x6e,0x6f,0x6e,0x65,0x22,
-0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x7d,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x7d,0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x6e,0x63,0x5f,0x65,
-0x6e,0x61,0x62,0x6c,0x65,0x28,0x65,0x6e,0x29,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x22,0x6e,
-0x63,0x45,0x6e,0x22,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x65,0x6e,
-0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x4e,0x74,0x72,0x69,
-0x70,0x43,0x6c,0x69,0x65,0x6e,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x61,0x63,
-0x74,0x69,0x6f,0x6e,0x3d,0x22,0x6e,0x74,0x72,0x69,0x70,0x43,0x6c,0x69,0x65,0x6e,
-0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x63,0x67,0x69,0x22,0x3b,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,
-0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x4e,0x74,0x72,0x69,0x70,0x43,0x6c,0x69,
-0x65,0x6e,0x74,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x73,0x75,0x62,0x6d,0x69,0x74,
-0x28,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x7d,0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x66,0x75,0x6e,0x63,0x74,0x69,0x6f,0x6e,0x20,0x61,0x63,0x5f,0x65,0x6e,
-0x61,0x62,0x6c,0x65,0x28,0x65,0x6e,0x29,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x24,0x28,0x22,0x61,0x63,
-0x45,0x6e,0x22,0x29,0x2e,0x76,0x61,0x6c,0x75,0x65,0x20,0x3d,0x20,0x65,0x6e,0x3b,
-0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,0x41,0x63,0x65,0x69,0x6e,
-0x6e,0x61,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,0x61,0x63,0x74,0x69,0x6f,0x6e,0x3d,
-0x22,0x61,0x63,0x65,0x69,0x6e,0x6e,0x61,0x43,0x6c,0x69,0x65,0x6e,0x74,0x43,0x6f,
-0x6e,0x66,0x69,0x67,0x2e,0x63,0x67,0x69,0x22,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x6f,0x63,0x75,
-0x6d,0x65,0x6e,0x74,0x2e,0x41,0x63,0x65,0x69,0x6e,0x6e,0x61,0x43,0x6f,0x6e,0x66,
-0x69,0x67,0x2e,0x73,0x75,0x62,0x6d,0x69,0x74,0x28,0x29,0x3b,0x0d,0x0a,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,0x0a,0x0d,0x0a,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x66,0x75,0x6e,0x63,0x74,
-0x69,0x6f,0x6e,0x20,0x6e,0x73,0x5f,0x65,0x6e,0x61,0x62,0x6c,0x65,0x28,0x65,0x6e,
-0x29,0x7b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x24,0x28,0x22,0x6e,0x73,0x45,0x6e,0x22,0x29,0x2e,0x76,0x61,
-0x6c,0x75,0x65,0x20,0x3d,0x20,0x65,0x6e,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x6f,0x63,0x75,0x6d,
-0x65,0x6e,0x74,0x2e,0x4e,0x74,0x72,0x69,0x70,0x53,0x65,0x72,0x76,0x65,0x72,0x43,
-0x6f,0x6e,0x66,0x69,0x67,0x2e,0x61,0x63,0x74,0x69,0x6f,0x6e,0x3d,0x22,0x6e,0x74,
-0x72,0x69,0x70,0x53,0x65,0x72,0x76,0x65,0x72,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,
-0x63,0x67,0x69,0x22,0x3b,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x64,0x6f,0x63,0x75,0x6d,0x65,0x6e,0x74,0x2e,
-0x4e,0x74,0x72,0x69,0x70,0x53,0x65,0x72,0x76,0x65,0x72,0x43,0x6f,0x6e,0x66,0x69,
-0x67,0x2e,0x73,0x75,0x62,0x6d,0x69,0x74,0x28,0x29,0x3b,0x0d,0x0a,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x7d,0x0d,0x0a,0x20,0x20,0x20,0x20,
-0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x0d,0x0a,0x09,0x09,0x3c,0x2f,0x73,0x63,
-0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x0d,0x0a,0x20,0x20,0x20,0x20,0x20,0x20,0x20,
-0x20,0x3c,0x73,0x63,0x72,0x69,0x70,0x74,0x20,0x74,0x79,0x70,0x65,0x3d,0x27,0x74,
-0x65,0x78,0x74,0x2f,0x6a,0x61,0x76,0x61,0x73,0x63,0x72,0x69,0x70,0x74,0x27,0x20,
-0x73,0x72,0x63,0x3d,0x27,0x77,0x6f,0x72,0x6b,0x43,0x6f,0x6e,0x66,0x69,0x67,0x2e,
-0x6a,0x73,0x27,0x3e,0x3c,0x2f,0x73,0x63,0x72,0x69,0x70,0x74,0x3e,0x0d,0x0a,0x09,
-0x3c,0x2f,0x62,0x6f,0x64,0x79,0x3e,0x0d,0x0a,0x3c,0x2f,0x68,0x74,0x6d,0x6c,0x3e,
-0x0d,0x0a,0x0d,0x0a,};
+0x78,0x74,0x2f,0x68,0x74,0x6d,0x6c,0x0d,0x0a,
+/* "Cache-Control: no-cache
+" (25 bytes) */
+0x43,0x61,0x63,0x68,0x65,0x2d,0x43,0x6f,0x6e,0x74,0x72,0x6f,0x6c,0x3a,0x20,0x6e,
+0x6f,0x2d,0x63,0x61,0x63,0x68,0x65,0x0d,0x0a,
+/* "ETag: "4087916b"
+" (18 bytes) */
+0x45,0x54,0x61,0x67,0x3a,0x20,0x22,0x34,0x30,0x38,0x37,0x39,0x31,0x36,0x62,0x22,
+0x0d,0x0a,
+/* "Content-Encoding: gzip
+" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x45,0x6e,0x63,0x6f,0x64,0x69,0x6e,0x67,
+0x3a,0x20,0x67,0x7a,0x69,0x70,0x0d,0x0a,
+/* "Vary: Accept-Encoding
+" (23 bytes) */
+0x56,0x61,0x72,0x79,0x3a,0x20,0x41,0x63,0x63,0x65,0x70,0x74,0x2d,0x45,0x6e,0x63,
+0x6f,0x64,0x69,0x6e,0x67,0x0d,0x0a,
+/* "Content-Length: 2179
+
+" (24 bytes) */
+0x43,0x6f,0x6e,0x74,0x65,0x6e,0x74,0x2d,0x4c,0x65,0x6e,0x67,0x74,0x68,0x3a,0x20,
+0x32,0x31,0x37,0x39,0x0d,0x0a,0x0d,0x0a,
+/* gzip file data (2179 bytes) */
+0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xe5,0x5b,0x6d,0x6f,0x1a,0xb9,
+0x16,0xfe,0x9c,0x4a,0xfd,0x0f,0xbe,0xa3,0x4a,0x03,0x6a,0x03,0x81,0xee,0x95,0xaa,
+0xc0,0x70,0x95,0xa6,0x54,0x8b,0xb6,0x01,0x04,0xa4,0xd5,0xfd,0x14,0x99,0x19,0x03,
+0xde,0x0c,0x36,0x1a,0x7b,0xf2,0x72,0xaf,0xf6,0x3f,0xed,0x6f,0xd8,0x5f,0xb6,0xb6,
+0xc7,0x30,0x66,0x98,0x17,0xa6,0x81,0x26,0xab,0xf2,0xa1,0xf5,0xeb,0xf1,0x73,0x8e,
+0x8f,0xcf,0x8b,0xc7,0x69,0xff,0xeb,0xd3,0xe0,0x72,0xf2,0xdf,0x61,0x17,0x2c,0xf8,
+0xd2,0xef,0xbc,0x7e,0xd5,0xd6,0xff,0x9f,0xb4,0x17,0x08,0x7a,0xb2,0x70,0xd2,0x5e,
+0x22,0x0e,0x81,0xbb,0x80,0x01,0x43,0xdc,0xb1,0xae,0x27,0x9f,0x4f,0x3f,0x58,0xa0,
+0x2e,0xfa,0x80,0xfe,0xb5,0x39,0xe6,0x3e,0xea,0x0c,0x56,0x88,0x8c,0x26,0xbf,0xb5,
+0xeb,0x51,0xd5,0xe8,0xf7,0x31,0xb9,0x05,0x01,0xf2,0x1d,0x8b,0xf1,0x47,0x1f,0xb1,
+0x05,0x42,0xdc,0x02,0xfc,0x71,0x85,0x1c,0x8b,0xa3,0x07,0x5e,0x77,0x19,0xb3,0xc0,
+0x22,0x40,0x33,0xc7,0x12,0xc5,0xba,0x1a,0x55,0x53,0x8d,0x5b,0xeb,0x30,0x37,0xc0,
+0x2b,0x6e,0xb4,0xc8,0xdf,0x2c,0x24,0x2e,0xc7,0x94,0x80,0x37,0x15,0xec,0x55,0xc1,
+0xff,0xc5,0x42,0x3c,0x0c,0x08,0xf0,0xa8,0x1b,0x2e,0x11,0xe1,0xb5,0x39,0xe2,0x5d,
+0x1f,0xc9,0xe2,0xc7,0xc7,0x9e,0x27,0x07,0xb5,0xc0,0x1f,0xad,0x0c,0x22,0xf7,0x34,
+0xb8,0xbd,0xa4,0x64,0x86,0xe7,0x97,0xd0,0xf7,0xa7,0xd0,0xbd,0xad,0x50,0x41,0x74,
+0x7b,0xb4,0xfc,0xe1,0x19,0xa8,0xd0,0x9a,0x87,0xd9,0x0a,0x38,0x0e,0x38,0x4b,0x1d,
+0x23,0x7f,0x42,0x68,0x13,0x38,0xad,0xd8,0x53,0xfa,0x60,0xbf,0x6b,0xbc,0x6b,0x56,
+0x5b,0xf9,0xe3,0x04,0xce,0x30,0x1a,0xb8,0x3b,0xee,0x0f,0x80,0x7c,0x86,0x12,0x4b,
+0x37,0x0e,0xbc,0x74,0x73,0xff,0xa5,0x9b,0xfb,0x2d,0xdd,0x4c,0x5f,0x5a,0x93,0xfc,
+0x11,0x72,0x7b,0xfd,0x2a,0x7d,0x03,0xdf,0x54,0x6c,0xb7,0xb7,0xb2,0xab,0x55,0xb0,
+0x2e,0xd5,0xee,0xa0,0x1f,0x22,0xe0,0x00,0x5a,0x13,0xf5,0x56,0xf6,0xb4,0x21,0x0d,
+0xf8,0x7a,0x62,0x54,0x36,0xa7,0xca,0x96,0x9c,0xc9,0x57,0x74,0xb8,0x9e,0xab,0x8a,
+0xe6,0x54,0xd1,0x90,0x33,0xf3,0x9a,0xa1,0x60,0x3d,0x35,0x2a,0x9b,0x73,0x65,0x4b,
+0x1e,0xe6,0x7b,0x6f,0x03,0x59,0x16,0xb7,0x10,0xdf,0x7b,0xad,0x1c,0x31,0xc1,0x8d,
+0x98,0x60,0x42,0x4c,0x30,0x4f,0x4c,0xd0,0x10,0x13,0xdc,0x11,0x13,0xcc,0x17,0x13,
+0x8c,0xc5,0x04,0x93,0x62,0x82,0xb9,0x62,0x82,0x86,0x98,0xe0,0x8e,0x98,0x60,0xbe,
+0x98,0x60,0x2c,0x26,0x98,0x14,0x13,0x8c,0xc4,0x94,0x9c,0x99,0x49,0x8b,0x6d,0xc4,
+0xc6,0x12,0x62,0x63,0x79,0x62,0x63,0x86,0xd8,0xd8,0x8e,0xd8,0x58,0xbe,0xd8,0x58,
+0x2c,0x36,0x96,0x14,0x1b,0xcb,0x15,0x1b,0x8b,0x39,0x67,0x49,0xce,0x59,0x9e,0x82,
+0xd0,0xda,0x74,0xc5,0xf3,0xed,0xa0,0xa0,0x19,0x40,0x0f,0xd3,0x11,0x9a,0x09,0xba,
+0xee,0x02,0xb9,0xb7,0xc8,0x13,0x94,0x79,0x10,0xa2,0x56,0x81,0xbd,0xd1,0xc4,0x1b,
+0x85,0xc4,0xc7,0xc3,0xe1,0xf7,0x12,0x6f,0x16,0x23,0x9f,0xfc,0x56,0x82,0x78,0x01,
+0xb1,0x8b,0xeb,0xc9,0x60,0x2f,0x6a,0xd9,0x9b,0xc5,0x61,0xef,0xd3,0x7a,0xb7,0xa2,
+0xb2,0xb9,0x5d,0xb2,0x25,0x47,0xc7,0x09,0x5f,0xac,0x75,0x5c,0x15,0x37,0x53,0x57,
+0xd2,0xcf,0x7f,0xf6,0x29,0xe4,0x42,0x36,0xb2,0xaf,0x5a,0xe3,0xf4,0x33,0x7e,0x40,
+0x5e,0xe5,0x97,0x6a,0x36,0x41,0xe1,0xbb,0xbf,0xc0,0xb5,0xca,0xae,0x2b,0xe9,0x44,
+0xa3,0xde,0x98,0xec,0x87,0x02,0xb2,0x94,0x18,0x64,0x65,0x25,0x9b,0x2c,0x25,0x7b,
+0x93,0xfd,0x15,0xe1,0x98,0xac,0xaa,0x64,0x92,0x15,0xbd,0x31,0xd9,0xf7,0x49,0xb2,
+0x66,0x28,0xd1,0xae,0x6f,0x85,0x28,0xed,0xba,0x8e,0xa2,0x64,0x40,0x35,0xa5,0xde,
+0xa3,0x19,0xcc,0xc8,0x2e,0x14,0x00,0xd7,0x87,0x8c,0x89,0xb0,0x87,0x7a,0x01,0x5d,
+0xb1,0x53,0x4e,0x57,0x56,0x22,0xc0,0x69,0xc3,0xce,0x85,0x8b,0x30,0x21,0x10,0x6c,
+0x42,0x2c,0x68,0x52,0xaa,0x47,0xa4,0x8c,0x26,0xa3,0xd3,0xc3,0x77,0xf1,0x1a,0x84,
+0x43,0x4c,0x50,0x60,0xa9,0xc0,0xee,0xc4,0xec,0x93,0xee,0x53,0x37,0x9f,0x24,0xa0,
+0xc9,0xae,0x9b,0xa8,0x29,0x09,0x2d,0x66,0xa6,0x91,0x32,0xfa,0x46,0x05,0x82,0x56,
+0xe7,0xaa,0xdb,0xbf,0x16,0x20,0x1b,0x6b,0xf2,0x31,0x5e,0x55,0x0d,0xfd,0xad,0xb9,
+0x52,0x4e,0x6b,0x24,0x27,0x22,0x74,0xdc,0xea,0xc4,0x1c,0x2d,0xad,0x4e,0x1b,0xea,
+0x60,0x31,0x08,0xc9,0x98,0x43,0x1e,0xb2,0x1a,0x93,0x81,0xab,0xb5,0x33,0xf6,0x46,
+0x86,0x9e,0x59,0xa8,0xe5,0x6f,0x14,0x12,0x82,0xc9,0x1c,0x44,0x64,0xa4,0x60,0xdb,
+0x75,0x1f,0x67,0xb1,0x99,0x8f,0x46,0xc5,0x8e,0xb3,0x79,0x2e,0x16,0x80,0xd9,0x29,
+0x14,0xa1,0xe6,0x1d,0xca,0x43,0xf5,0x4d,0x50,0x02,0x51,0x18,0x1a,0x06,0x50,0x06,
+0xa6,0x4f,0x43,0x16,0x0a,0x87,0x57,0x84,0x2c,0x0f,0x8f,0x74,0x98,0x87,0xc4,0x83,
+0xf8,0xe2,0x29,0x70,0xba,0x7c,0x81,0x02,0x82,0xf8,0x21,0x21,0x79,0xe8,0x0e,0xbb,
+0xa8,0x47,0x66,0xf4,0xbb,0x61,0x7d,0x52,0x24,0x80,0xa4,0x61,0x60,0x89,0x54,0x3e,
+0xf4,0xf5,0x99,0xab,0x8b,0x43,0xd7,0x49,0xfa,0xd1,0xe4,0x29,0x15,0xb9,0xca,0xe9,
+0x7d,0x00,0x57,0x89,0x13,0x99,0x7d,0xfa,0x3a,0x86,0xc6,0xe8,0xa3,0xb6,0x33,0xaa,
+0x9e,0x49,0xa4,0x3d,0x4d,0x6d,0x95,0xa0,0x54,0x2a,0x26,0x54,0x1b,0x7b,0x7c,0x71,
+0xde,0x3c,0x3b,0x5b,0x3d,0xb4,0xc0,0x4c,0x9a,0xc6,0x73,0x1f,0xcd,0x78,0x2b,0xd3,
+0x20,0x18,0x0c,0x05,0xf4,0xfe,0x4a,0x5b,0x97,0x2c,0xc9,0xb5,0x95,0x78,0x40,0xce,
+0x4f,0xee,0x1e,0xf6,0x1c,0x4b,0xa4,0x03,0x0d,0x0b,0x50,0xe2,0xfa,0xd8,0xbd,0x15,
+0xf9,0x64,0x32,0x4b,0xd8,0x6c,0xdb,0x82,0xde,0x49,0x7b,0x35,0x1a,0x7c,0xed,0x8e,
+0xce,0xd3,0x19,0x4c,0x3d,0x75,0x90,0x81,0x40,0x4e,0x15,0x9c,0x2b,0xad,0xaa,0x45,
+0xca,0xef,0x42,0x22,0x72,0x60,0x4a,0x85,0x67,0xef,0x4f,0x46,0xbd,0x21,0xb8,0xfc,
+0xd2,0xeb,0xf6,0x27,0x80,0x06,0x60,0x38,0xe8,0x89,0xc2,0xa0,0xdf,0x05,0x4b,0xea,
+0xa1,0x1c,0x0d,0xcc,0x17,0x77,0x06,0xb7,0xcd,0x2c,0x6e,0x65,0x56,0x65,0x75,0x3e,
+0x5e,0x8c,0xbb,0x25,0xd9,0x9b,0x42,0xc1,0x84,0xe6,0x0e,0xdc,0x63,0xbe,0xd0,0x1c,
+0x8d,0xbb,0x23,0x21,0x2b,0xc5,0x44,0x0d,0x0c,0x29,0xc3,0x6a,0x80,0x64,0x7c,0x8a,
+0x44,0x52,0x3d,0x43,0x01,0x22,0x42,0xbd,0x57,0x94,0xc9,0xa4,0x0b,0x4c,0x1f,0x81,
+0x34,0x2b,0x42,0x02,0xc5,0x4b,0x8b,0xb8,0xac,0x2e,0xfc,0x16,0x80,0x42,0xb0,0x70,
+0x2e,0xa9,0xb1,0xd0,0xe7,0xb5,0x02,0x21,0xe4,0x4b,0x52,0x9f,0xa9,0xf4,0xae,0xe8,
+0x90,0xed,0xdd,0x6e,0x68,0xfa,0x12,0x06,0x73,0x4c,0x4e,0xa5,0x76,0x9f,0x83,0x48,
+0xe1,0x73,0x95,0x5c,0x6e,0x93,0x38,0xb2,0xc2,0x6d,0x3d,0xdc,0x34,0x92,0xda,0x97,
+0x83,0x7e,0x3d,0x57,0x6c,0xa8,0x55,0xa4,0x0d,0xc6,0x61,0x92,0x27,0x49,0x2c,0x65,
+0xed,0xb1,0xdf,0xc5,0x87,0x2a,0xa9,0x6e,0xd2,0xd4,0xa5,0x9d,0xae,0x38,0xb7,0x4e,
+0x32,0x68,0x9e,0x85,0x3d,0x34,0x3f,0x6d,0xc1,0x66,0xe6,0x82,0x4a,0xc3,0xc1,0x26,
+0xf8,0x29,0xb5,0x4a,0x8e,0x76,0x14,0x69,0x43,0x96,0xe8,0x2f,0x23,0xc3,0xbc,0xaf,
+0xf4,0x4d,0xe5,0x50,0x3e,0xa4,0x84,0x76,0x6c,0x11,0x9a,0xd1,0x60,0x09,0x08,0x5c,
+0x22,0xc7,0xee,0x73,0x11,0x5d,0x5e,0xfa,0x58,0xc0,0x88,0x6c,0xbd,0x0d,0x96,0xc2,
+0x97,0x52,0xcf,0xb1,0x87,0x83,0xf1,0xc4,0xde,0x93,0xa4,0x22,0x8b,0xc9,0x2a,0xe4,
+0xc6,0x25,0x9c,0xa5,0xd0,0x12,0xb7,0x4b,0xac,0x68,0x35,0x5d,0xd6,0xe7,0x42,0xde,
+0xf9,0xf8,0xf0,0xf1,0x9c,0x50,0x82,0xac,0x32,0xeb,0xac,0x3a,0x6d,0x1f,0x4e,0xd1,
+0x26,0xc8,0x53,0x15,0x21,0x8c,0x4e,0x6f,0x78,0x2e,0x36,0x53,0xd6,0x3a,0x26,0x18,
+0x5b,0x82,0xb1,0x25,0x18,0x75,0x23,0xa3,0x39,0x57,0x45,0x86,0xff,0x27,0x8a,0x8d,
+0x0f,0x36,0xa8,0x0b,0xef,0xba,0x3a,0x08,0x8a,0xe1,0x60,0x34,0x29,0xc4,0xa1,0x52,
+0xf0,0x35,0x92,0xa8,0x72,0x0c,0x2c,0x57,0x83,0x6b,0xe1,0x49,0x94,0x3f,0x29,0x84,
+0x24,0x33,0xfb,0x35,0x22,0x55,0x3e,0x06,0xa0,0x6b,0xe1,0x13,0x40,0xff,0xe2,0xaa,
+0x5b,0x08,0x47,0x5d,0xb2,0xac,0xf1,0x44,0x95,0xa3,0xec,0xd6,0xc5,0x78,0xfc,0x6d,
+0x30,0xfa,0x54,0xbc,0x63,0xf7,0x5e,0xbc,0x61,0xb2,0xfc,0x04,0x34,0x7b,0x79,0xd7,
+0x9d,0x73,0xcf,0x84,0xb3,0xbb,0x99,0x86,0x9c,0x53,0x52,0xe6,0xbc,0x18,0x67,0x53,
+0x33,0xaf,0x69,0x68,0x1e,0xa3,0x9a,0x0d,0x54,0xb2,0xea,0xd8,0xe3,0x8b,0xaf,0x5d,
+0x3b,0x36,0xa0,0xc4,0xbd,0x41,0x04,0x4e,0x7d,0x54,0x39,0xab,0x5a,0xf5,0x0e,0xf8,
+0xae,0x75,0xd3,0x3c,0x61,0x23,0xf2,0x84,0x7b,0x61,0xea,0xf6,0x2f,0x3e,0x7e,0x49,
+0x47,0xd5,0x90,0xa8,0x4a,0x08,0x73,0x0f,0x13,0x1d,0x8f,0x95,0x86,0x72,0x2f,0xd7,
+0xb0,0x1f,0xd1,0x5d,0x0b,0xde,0x7c,0x92,0x35,0x34,0x0d,0xb9,0xf6,0x69,0x47,0x32,
+0xe2,0xd0,0x30,0xe2,0xf0,0xb9,0x8d,0x38,0x8c,0x8d,0x38,0x7c,0x4e,0x23,0x0e,0x4d,
+0x23,0x0e,0x5f,0x84,0x11,0x87,0x86,0x11,0x87,0xcf,0x6f,0xc4,0xa1,0x69,0xc4,0xe1,
+0xf3,0x1b,0x71,0x68,0x18,0x71,0xf8,0x13,0x19,0x71,0xf8,0x22,0x8d,0x38,0xfc,0xc7,
+0x19,0xf1,0xa2,0x31,0x79,0xfd,0xe9,0xf7,0x34,0x99,0x99,0x5f,0x79,0xcf,0xf0,0x22,
+0x13,0xc0,0x29,0xd4,0x29,0x60,0x5a,0x96,0x17,0xdd,0x0f,0xfc,0x23,0xf3,0xaf,0x88,
+0xaf,0x83,0x65,0x60,0x63,0x14,0x88,0xe9,0x4f,0x76,0xde,0x06,0x6f,0x2c,0x9c,0x4e,
+0x7d,0xea,0xde,0x96,0x36,0x32,0x8b,0x46,0xe7,0xa3,0xbc,0xcf,0x19,0x73,0x7d,0x07,
+0x9a,0x7a,0xf7,0x77,0x88,0xa3,0x99,0x97,0x34,0x32,0x23,0x69,0x64,0xc7,0x8b,0x37,
+0xde,0x5b,0x1d,0xcd,0x27,0xe8,0x15,0x7a,0x8f,0xe8,0x9b,0x98,0xde,0x36,0x5d,0x39,
+0xb8,0x37,0x13,0x88,0x2e,0xa4,0x56,0x12,0x08,0x7e,0x45,0x78,0xbe,0xe0,0x95,0x65,
+0xb5,0xd0,0xad,0xc9,0x0f,0x6e,0x6b,0xb7,0xa6,0xca,0xc7,0x80,0x35,0xda,0x5c,0xd8,
+0x7d,0x11,0x12,0xe3,0xa1,0x87,0x2a,0x7f,0xfd,0x59,0x88,0x4d,0x7f,0xb9,0xd3,0xe8,
+0xd6,0xb5,0x23,0xe3,0xa3,0x64,0x5e,0x0a,0xa0,0xf4,0x52,0x31,0x40,0x59,0x3b,0x2e,
+0xc0,0xbd,0x77,0x56,0x7f,0x49,0x8c,0xc1,0xa9,0xda,0x93,0xc0,0x95,0x34,0x07,0xe9,
+0xac,0x08,0xcb,0xd4,0x9b,0xf4,0x06,0x7d,0x20,0x9f,0x7a,0x6d,0x98,0xf8,0xae,0xb0,
+0x22,0x62,0x59,0x7d,0xc2,0xb6,0xf5,0x29,0xb7,0xcd,0x18,0x43,0x04,0x18,0x5a,0x16,
+0xeb,0x8f,0xfd,0xda,0x2e,0x4c,0x57,0xc2,0x58,0x44,0xb1,0x85,0x75,0x56,0x2a,0x7e,
+0x88,0x9e,0x98,0x09,0x21,0x6f,0xbe,0x90,0xcc,0xe6,0xae,0xf0,0x99,0xa3,0xee,0xe7,
+0x76,0x5d,0xb6,0x1f,0x87,0x93,0x7f,0x6f,0x71,0x22,0x5f,0x16,0xa4,0x70,0xd2,0x38,
+0x08,0x27,0x82,0xf8,0x8f,0xe3,0x44,0x3e,0x63,0x48,0xe1,0xa4,0x79,0x98,0x3d,0x51,
+0xef,0xff,0x7e,0x10,0x27,0xea,0x0d,0x45,0x0a,0x2b,0xef,0x0f,0xc2,0x8a,0xa4,0x5e,
+0x9a,0x97,0xa3,0x27,0x25,0x07,0x88,0x17,0x74,0x34,0xa7,0x62,0x98,0x63,0xc7,0x0b,
+0x4f,0xb8,0x37,0x60,0xf1,0xbd,0x01,0x7b,0xce,0x7b,0x03,0x66,0xde,0x1b,0xb0,0x17,
+0x71,0x6f,0xc0,0x8c,0x7b,0x03,0x76,0xb4,0x7b,0x83,0x7d,0xd3,0x74,0x66,0xa4,0xe9,
+0xec,0x67,0xba,0x6b,0x65,0x2f,0xf2,0xae,0x95,0xfd,0x8c,0x69,0x7a,0x56,0xbb,0xf1,
+0xe2,0x22,0x6b,0x8a,0x7a,0xe3,0x1e,0x3d,0xdb,0x32,0x9f,0xa4,0xff,0x0e,0xef,0x60,
+0xd4,0x6a,0x65,0x3d,0x38,0xd7,0x5f,0x2b,0xa5,0xe6,0xbf,0x73,0xc3,0x80,0x21,0xff,
+0x1d,0xa9,0xa6,0xbc,0xfb,0x13,0xb2,0x02,0x15,0xec,0x34,0x5a,0x00,0xb7,0x1d,0x22,
+0xfe,0x7d,0xfb,0x36,0xf3,0xb1,0xe1,0x1d,0x0c,0x80,0xcc,0x55,0x81,0x93,0xf9,0x80,
+0x5d,0xae,0xf7,0x16,0x67,0xbd,0x87,0x96,0x04,0x44,0xca,0xeb,0x64,0xcd,0x56,0xf9,
+0xb0,0xf5,0x56,0x11,0xb1,0x44,0x21,0x93,0x90,0x44,0x51,0x53,0x2a,0xd8,0x97,0x47,
+0x1b,0x3b,0x4e,0xc4,0xe3,0x7f,0x74,0xf2,0x7c,0x6e,0x59,0x19,0x33,0xc5,0x0a,0xb5,
+0xe8,0x09,0xbf,0xce,0xff,0xcc,0xc9,0x91,0xdb,0x3a,0xb7,0x54,0x4a,0x58,0xfc,0xe0,
+0x71,0xe7,0xe9,0xf6,0x46,0xfa,0xf1,0x47,0x05,0x94,0x2a,0xf5,0x37,0x95,0xe8,0x03,
+0x66,0xfc,0xae,0x0f,0x91,0x94,0xf5,0x36,0x72,0xda,0xf9,0xb6,0x5a,0x83,0x6a,0x21,
+0x71,0xa4,0x76,0x7a,0xdc,0x39,0xb6,0xca,0xd1,0x12,0x0e,0x7b,0x89,0x79,0x65,0xe7,
+0xf1,0x60,0x26,0x7b,0xb0,0x98,0x3d,0x58,0x86,0xbd,0xad,0x2f,0x0e,0x1b,0xd6,0xa0,
+0x6e,0x2d,0xc3,0xdc,0x36,0xa5,0xd2,0x8c,0xc5,0x06,0x2a,0x7b,0xdf,0x58,0xd9,0x7d,
+0x33,0x6f,0x64,0xb6,0xf7,0x6d,0xab,0x67,0xaf,0x7d,0xdb,0x9a,0x91,0xcd,0x9e,0x59,
+0x55,0x36,0x24,0x7e,0xfb,0xb9,0xf3,0x27,0x2b,0x86,0xcf,0x34,0x0c,0x8b,0x70,0x94,
+0x81,0xeb,0xd8,0xf1,0x9f,0x9c,0xd4,0x7e,0x67,0x76,0xc7,0xa0,0x23,0x68,0xea,0x57,
+0xa3,0x22,0x4e,0x8b,0xfe,0x30,0xe7,0xf5,0xab,0xbf,0x01,0xf5,0xf4,0x7e,0x50,0xb4,
+0x33,0x00,0x00,};
 
 
 
@@ -6097,6 +2903,10 @@ data__css_style_css,
 data__css_style_css + 16,
 sizeof(data__css_style_css) - 16,
 1,
+0x03,
+0x3c22f032UL,
+"\"c1f841f2\"",
+file_NULL,
 }};
 
 const struct fsdata_file file__deviceInfo_shtml[] = { {
@@ -6105,6 +2915,10 @@ data__deviceInfo_shtml,
 data__deviceInfo_shtml + 20,
 sizeof(data__deviceInfo_shtml) - 20,
 1,
+0x00,
+0x946f9582UL,
+NULL,
+file_NULL,
 }};
 
 const struct fsdata_file file__ethCfg_shtml[] = { {
@@ -6113,6 +2927,10 @@ data__ethCfg_shtml,
 data__ethCfg_shtml + 16,
 sizeof(data__ethCfg_shtml) - 16,
 1,
+0x03,
+0x9b7758f7UL,
+"\"8576c7de\"",
+file_NULL,
 }};
 
 const struct fsdata_file file__runStatus_shtml[] = { {
@@ -6121,6 +2939,10 @@ data__runStatus_shtml,
 data__runStatus_shtml + 20,
 sizeof(data__runStatus_shtml) - 20,
 1,
+0x03,
+0xeb27d437UL,
+"\"46ff0f56\"",
+file_NULL,
 }};
 
 const struct fsdata_file file__userCfg_shtml[] = { {
@@ -6129,6 +2951,10 @@ data__userCfg_shtml,
 data__userCfg_shtml + 16,
 sizeof(data__userCfg_shtml) - 16,
 1,
+0x03,
+0xb8920f0bUL,
+"\"865a6338\"",
+file_NULL,
 }};
 
 const struct fsdata_file file__workCfg_shtml[] = { {
@@ -6137,11 +2963,34 @@ data__workCfg_shtml,
 data__workCfg_shtml + 16,
 sizeof(data__workCfg_shtml) - 16,
 1,
+0x03,
+0x563473e5UL,
+"\"4087916b\"",
+file_NULL,
 }};
 
 #define FS_ROOT file__workCfg_shtml
 #define FS_NUMFILES 6
 
+#define FS_INDEX_SIZE 16
+static const struct fsdata_file * const FS_INDEX[FS_INDEX_SIZE] = {
+file_NULL,
+file_NULL,
+file__css_style_css,
+file__deviceInfo_shtml,
+file_NULL,
+file__workCfg_shtml,
+file_NULL,
+file__ethCfg_shtml,
+file__runStatus_shtml,
+file_NULL,
+file_NULL,
+file__userCfg_shtml,
+file_NULL,
+file_NULL,
+file_NULL,
+file_NULL,
+};
 
 
 #endif
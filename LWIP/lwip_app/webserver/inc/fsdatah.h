@@ -10,6 +10,10 @@ struct fsdata_file {
   const unsigned char *data;
   int len;
   u8_t http_header_included;
+  u8_t flags;             /* FS_FILE_FLAGS_xxx */
+  u32_t hash;             /* fs_name_hash() of name, for FS_INDEX */
+  const char *etag;       /* quoted entity tag, NULL if the file is not cached */
+  const struct fsdata_file *identity; /* plain copy of a FS_FILE_FLAGS_GZIP file, makefsdata.py --identity */
 #if HTTPD_PRECALCULATED_CHECKSUM
   u16_t chksum_count;
   const struct fsdata_chksum *chksum;
@@ -0,0 +1,264 @@
+#!/usr/bin/env python3
+"""
+Generate inc/fsdata.h for the web server from the pages under fs/.
+
+    python3 makefsdata.py [--identity] [-o inc/fsdata.h] [fs/rover] [fs/base]
+
+The first directory is built for the rover, the second one under
+BASE_STATION. Like lwIP's makefsdata every file is stored with its HTTP
+header in front of it, on top of that:
+
+ - files without SSI tags are stored gzip compressed (when that pays off)
+   and sent with Content-Encoding: gzip to the clients that accept it, or
+   send no Accept-Encoding. Those that refuse gzip get 406 Not Acceptable;
+   with --identity the plain file is kept next to it (not in the file list)
+   for them and for the ones that do not say, at the cost of its size
+ - files without SSI tags get an ETag, so a reload is answered with
+   304 Not Modified. Pages are revalidated on every load, everything else
+   is cached for CACHE_MAX_AGE seconds
+ - pages that contain SSI tags are stored and sent as before, their size
+   is only known once the tags are replaced
+ - the files are also put in a hash table (FS_INDEX) that fs_open() probes
+   instead of comparing every name
+
+Keep fs_hash() in sync with fs_name_hash() in src/fs.c.
+"""
+
+import argparse
+import gzip
+import os
+import zlib
+
+SERVER = b"Server: lwIP/1.3.1 (http://savannah.nongnu.org/projects/lwip)\r\n"
+SSI_EXTENSIONS = (".shtml", ".shtm", ".ssi", ".xml")
+SSI_TAG = b"<!--#"
+PAGE_EXTENSIONS = (".shtml", ".shtm", ".ssi", ".html", ".htm")
+CONTENT_TYPES = {
+    ".html": "text/html", ".htm": "text/html", ".shtml": "text/html",
+    ".shtm": "text/html", ".ssi": "text/html", ".xml": "text/xml",
+    ".css": "text/css", ".js": "application/javascript",
+    ".json": "application/json", ".txt": "text/plain",
+    ".png": "image/png", ".gif": "image/gif", ".jpg": "image/jpeg",
+    ".ico": "image/x-icon", ".svg": "image/svg+xml",
+}
+CACHE_MAX_AGE = 86400
+GZIP_MIN_SAVING = 0.1           # keep the plain file below 10% saving
+
+FS_FILE_FLAGS_GZIP = 0x01
+FS_FILE_FLAGS_NO_SSI = 0x02
+
+
+def fs_hash(name):
+    """FNV-1a, 32 bit"""
+    h = 2166136261
+    for c in name:
+        h = ((h ^ c) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def walk(root):
+    """Sub directories first, then the files, both sorted."""
+    names = sorted(os.listdir(root))
+    for n in names:
+        p = os.path.join(root, n)
+        if os.path.isdir(p):
+            for sub in walk(p):
+                yield sub
+    for n in names:
+        p = os.path.join(root, n)
+        if os.path.isfile(p):
+            yield p
+
+
+def build_header(ext, body, ssi, flags, vary):
+    hdr = [b"HTTP/1.0 200 OK\r\n", SERVER,
+           ("Content-type: %s\r\n" % CONTENT_TYPES.get(ext, "text/plain")).encode()]
+    etag = None
+    if ssi:
+        hdr.append(b"Expires: Fri, 10 Apr 2008 14:00:00 GMT\r\n")
+        hdr.append(b"Pragma: no-cache\r\n")
+    else:
+        etag = '"%08x"' % zlib.crc32(body)
+        if ext in PAGE_EXTENSIONS:
+            hdr.append(b"Cache-Control: no-cache\r\n")
+        else:
+            hdr.append(("Cache-Control: max-age=%d\r\n" % CACHE_MAX_AGE).encode())
+        hdr.append(("ETag: %s\r\n" % etag).encode())
+        if flags & FS_FILE_FLAGS_GZIP:
+            hdr.append(b"Content-Encoding: gzip\r\n")
+        if vary:
+            hdr.append(b"Vary: Accept-Encoding\r\n")
+        hdr.append(("Content-Length: %d\r\n" % len(body)).encode())
+    hdr[-1] += b"\r\n"
+    return hdr, etag
+
+
+def build_file(root, path, keep_identity):
+    name = "/" + os.path.relpath(path, root).replace(os.sep, "/")
+    ext = os.path.splitext(name)[1].lower()
+    with open(path, "rb") as f:
+        body = f.read()
+
+    ssi = ext in SSI_EXTENSIONS and SSI_TAG in body
+    flags = 0 if ssi else FS_FILE_FLAGS_NO_SSI
+    identity = None
+    if not ssi:
+        packed = gzip.compress(body, 9, mtime=0)
+        if len(packed) <= len(body) * (1 - GZIP_MIN_SAVING):
+            if keep_identity:
+                hdr, etag = build_header(ext, body, ssi, flags, True)
+                identity = {"hdr": hdr, "body": body, "etag": etag}
+            body = packed
+            flags |= FS_FILE_FLAGS_GZIP
+
+    hdr, etag = build_header(ext, body, ssi, flags, flags & FS_FILE_FLAGS_GZIP)
+    return {"name": name, "var": name.replace("/", "_").replace(".", "_"),
+            "hdr": hdr, "body": body, "flags": flags, "etag": etag,
+            "identity": identity, "hash": fs_hash(name.encode())}
+
+
+def hex_header(out, hdr):
+    out.append("/* HTTP header */")
+    for h in hdr:
+        out.append("/* \"%s\" (%d bytes) */" % (h.decode(), len(h)))
+        out.append(hex_lines(h))
+
+
+def c_etag(etag):
+    return "\"%s\"" % etag.replace('"', '\\"') if etag else "NULL"
+
+
+def hex_lines(data):
+    out = []
+    for i in range(0, len(data), 16):
+        out.append("".join("0x%02x," % b for b in data[i:i + 16]))
+    return "\n".join(out)
+
+
+def emit_variant(root, keep_identity):
+    files = [build_file(root, p, keep_identity) for p in walk(root)]
+    out = ["", "#include \"fs.h\"", "#include \"lwip/def.h\"",
+           "#include \"fsdatah.h\"", "", "",
+           "#define file_NULL (struct fsdata_file *) NULL", "", ""]
+
+    for i, f in enumerate(files):
+        name = f["name"].encode() + b"\0"
+        name += b"\0" * (-len(name) % 4)
+        f["name_len"] = len(name)
+        out.append("static const unsigned int dummy_align_%s = %d;" % (f["var"], i))
+        out.append("static const unsigned char data_%s[] = {" % f["var"])
+        out.append("/* %s (%d chars) */" % (f["name"], len(f["name"]) + 1))
+        out.append(hex_lines(name))
+        out.append("")
+        hex_header(out, f["hdr"])
+        out.append("/* %s file data (%d bytes) */"
+                   % ("gzip" if f["flags"] & FS_FILE_FLAGS_GZIP else "raw", len(f["body"])))
+        out.append(hex_lines(f["body"]) + "};")
+        out.append("")
+        if f["identity"]:
+            out.append("static const unsigned char data_%s_identity[] = {" % f["var"])
+            hex_header(out, f["identity"]["hdr"])
+            out.append("/* raw file data (%d bytes) */" % len(f["identity"]["body"]))
+            out.append(hex_lines(f["identity"]["body"]) + "};")
+            out.append("")
+
+    out.append("")
+    out.append("")
+    prev = "file_NULL"
+    for f in files:
+        identity = "file_NULL"
+        if f["identity"]:
+            # the plain copy of the file, only reached through it
+            identity = "file_%s_identity" % f["var"]
+            out.append("static const struct fsdata_file %s[] = { {" % identity)
+            out.append("file_NULL,")
+            out.append("data_%s," % f["var"])
+            out.append("data_%s_identity," % f["var"])
+            out.append("sizeof(data_%s_identity)," % f["var"])
+            out.append("1,")
+            out.append("0x%02x," % (f["flags"] & ~FS_FILE_FLAGS_GZIP))
+            out.append("0x%08xUL," % f["hash"])
+            out.append("%s," % c_etag(f["identity"]["etag"]))
+            out.append("file_NULL,")
+            out.append("}};")
+            out.append("")
+        out.append("const struct fsdata_file file_%s[] = { {" % f["var"])
+        out.append("%s," % prev)
+        out.append("data_%s," % f["var"])
+        out.append("data_%s + %d," % (f["var"], f["name_len"]))
+        out.append("sizeof(data_%s) - %d," % (f["var"], f["name_len"]))
+        out.append("1,")
+        out.append("0x%02x," % f["flags"])
+        out.append("0x%08xUL," % f["hash"])
+        out.append("%s," % c_etag(f["etag"]))
+        out.append("%s," % identity)
+        out.append("}};")
+        out.append("")
+        prev = "file_%s" % f["var"]
+
+    out.append("#define FS_ROOT %s" % prev)
+    out.append("#define FS_NUMFILES %d" % len(files))
+    out.append("")
+
+    # open addressing, linear probing, at most half full
+    size = 4
+    while size < 2 * len(files):
+        size *= 2
+    index = [None] * size
+    for f in files:
+        i = f["hash"] & (size - 1)
+        while index[i] is not None:
+            i = (i + 1) & (size - 1)
+        index[i] = f
+    out.append("#define FS_INDEX_SIZE %d" % size)
+    out.append("static const struct fsdata_file * const FS_INDEX[FS_INDEX_SIZE] = {")
+    for f in index:
+        out.append("%s," % ("file_%s" % f["var"] if f else "file_NULL"))
+    out.append("};")
+    out.append("")
+    return files, "\n".join(out)
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    ap = argparse.ArgumentParser()
+    ap.add_argument("--identity", action="store_true",
+                    help="keep the plain copy of each compressed file")
+    ap.add_argument("-o", "--output", default=os.path.join(here, "inc", "fsdata.h"))
+    ap.add_argument("rover", nargs="?", default=os.path.join(here, "fs", "rover"))
+    ap.add_argument("base", nargs="?", default=os.path.join(here, "fs", "base"))
+    args = ap.parse_args()
+
+    rover_files, rover = emit_variant(args.rover, args.identity)
+    base_files, base = emit_variant(args.base, args.identity)
+    text = "\n".join([
+        "#ifndef __FSDATA_H__",
+        "#define __FSDATA_H__",
+        "",
+        "/* generated by makefsdata.py, edit the files under fs/ instead */",
+        "",
+        "#ifndef BASE_STATION",
+        rover,
+        "",
+        "#else   // BASE_STATION",
+        "",
+        base,
+        "",
+        "#endif",
+        "",
+        "#endif",
+        ""])
+    with open(args.output, "w", newline="\n") as f:
+        f.write(text)
+
+    for label, files in (("rover", rover_files), ("base", base_files)):
+        total = 0
+        for f in files:
+            total += len(f["body"]) + (len(f["identity"]["body"]) if f["identity"] else 0)
+            print("%-6s %-22s %6d bytes%s" % (label, f["name"], len(f["body"]),
+                  " gzip, %d plain" % len(f["identity"]["body"]) if f["identity"] else ""))
+        print("%-6s %-22s %6d bytes" % (label, "total", total))
+
+
+if __name__ == "__main__":
+    main()
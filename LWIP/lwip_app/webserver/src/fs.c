@@ -57,6 +57,11 @@ struct fs_table
 
 struct fs_table fs_memory[LWIP_MAX_OPEN_FILES];
 
+/* slots closed and ready for reuse, plus the count of slots never used */
+static u8_t fs_free_slot[LWIP_MAX_OPEN_FILES];
+static u8_t fs_free_count = 0;
+static u8_t fs_fresh_count = 0;
+
 #if LWIP_HTTPD_CUSTOM_FILES
 int fs_open_custom(struct fs_file *file, const char *name);
 void fs_close_custom(struct fs_file *file);
@@ -65,31 +70,75 @@ void fs_close_custom(struct fs_file *file);
 static struct fs_file *
 fs_malloc(void)
 {
-  int i;
-  for (i = 0; i < LWIP_MAX_OPEN_FILES; i++)
+  u8_t i;
+  if (fs_free_count > 0)
   {
-    if (fs_memory[i].inuse == 0)
-    {
-      fs_memory[i].inuse = 1;
-      return (&fs_memory[i].file);
-    }
+    i = fs_free_slot[--fs_free_count];
+  }
+  else if (fs_fresh_count < LWIP_MAX_OPEN_FILES)
+  {
+    i = fs_fresh_count++;
   }
-  return (NULL);
+  else
+  {
+    return (NULL);
+  }
+  fs_memory[i].inuse = 1;
+  return (&fs_memory[i].file);
 }
 
 static void
 fs_free(struct fs_file *file)
 {
-  int i;
-  for (i = 0; i < LWIP_MAX_OPEN_FILES; i++)
+  /* file is the first member of its fs_table slot */
+  struct fs_table *slot = (struct fs_table *)file;
+  if (slot->inuse)
+  {
+    slot->inuse = 0;
+    fs_free_slot[fs_free_count++] = (u8_t)(slot - fs_memory);
+  }
+  return;
+}
+
+/* FNV-1a, the same as fs_hash() in makefsdata.py */
+static u32_t
+fs_name_hash(const char *name)
+{
+  u32_t hash = 2166136261UL;
+  while (*name)
+  {
+    hash ^= (u8_t)*name++;
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
+static const struct fsdata_file *
+fs_find(const char *name)
+{
+  const struct fsdata_file *f;
+#ifdef FS_INDEX_SIZE
+  u32_t hash = fs_name_hash(name);
+  u32_t i;
+
+  /* the index is at most half full, so the probe always ends on a hole */
+  for (i = hash; (f = FS_INDEX[i & (FS_INDEX_SIZE - 1)]) != NULL; i++)
   {
-    if (&fs_memory[i].file == file)
+    if ((f->hash == hash) && !strcmp(name, (const char *)f->name))
     {
-      fs_memory[i].inuse = 0;
-      break;
+      return f;
     }
   }
-  return;
+#else /* FS_INDEX_SIZE */
+  for (f = FS_ROOT; f != NULL; f = f->next)
+  {
+    if (!strcmp(name, (const char *)f->name))
+    {
+      return f;
+    }
+  }
+#endif /* FS_INDEX_SIZE */
+  return NULL;
 }
 
 
@@ -105,6 +154,10 @@ fs_open(const char *name)
     return NULL;
   }
 
+  file->flags = 0;
+  file->etag = NULL;
+  file->identity = NULL;
+
 #if LWIP_HTTPD_CUSTOM_FILES
   if (fs_open_custom(file, name))
   {
@@ -114,24 +167,25 @@ fs_open(const char *name)
   file->is_custom_file = 0;
 #endif /* LWIP_HTTPD_CUSTOM_FILES */
 
-  for (f = FS_ROOT; f != NULL; f = f->next)
+  f = fs_find(name);
+  if (f != NULL)
   {
-    if (!strcmp(name, (char *)f->name))
-    {
-      file->data = (const char *)f->data;
-      file->len = f->len;
-      file->index = f->len;
-      file->pextension = NULL;
-      file->http_header_included = f->http_header_included;
+    file->data = (const char *)f->data;
+    file->len = f->len;
+    file->index = f->len;
+    file->pextension = NULL;
+    file->http_header_included = f->http_header_included;
+    file->flags = f->flags;
+    file->etag = f->etag;
+    file->identity = f->identity;
 #if HTTPD_PRECALCULATED_CHECKSUM
-      file->chksum_count = f->chksum_count;
-      file->chksum = f->chksum;
+    file->chksum_count = f->chksum_count;
+    file->chksum = f->chksum;
 #endif                    /* HTTPD_PRECALCULATED_CHECKSUM */
 #if LWIP_HTTPD_FILE_STATE
-      file->state = fs_state_init(file, name);
+    file->state = fs_state_init(file, name);
 #endif /* #if LWIP_HTTPD_FILE_STATE */
-      return file;
-    }
+    return file;
   }
   fs_free(file);
   return NULL;
@@ -176,3 +230,22 @@ int fs_bytes_left(struct fs_file *file)
 {
   return file->len - file->index;
 }
+
+/* switch a FS_FILE_FLAGS_GZIP file to its plain copy, for a client that does
+   not accept gzip; 0 if makefsdata.py was run without --identity */
+int fs_use_identity(struct fs_file *file)
+{
+  const struct fsdata_file *f = file->identity;
+
+  if (f == NULL)
+  {
+    return 0;
+  }
+  file->data = (const char *)f->data;
+  file->len = f->len;
+  file->index = f->len;
+  file->flags = f->flags;
+  file->etag = f->etag;
+  file->identity = NULL;
+  return 1;
+}
@@ -261,6 +261,28 @@ const default_filename g_psDefaultFilenames[] = {
 static char httpd_req_buf[LWIP_HTTPD_MAX_REQ_LENGTH+1];
 #endif /* LWIP_HTTPD_SUPPORT_REQUESTLIST */
 
+/** If-None-Match value of the GET request being parsed, only valid while
+ * http_parse_request() runs */
+static const char *http_req_etag;
+static u16_t http_req_etag_len;
+
+/** What a request's Accept-Encoding says about gzip */
+#define HTTP_GZIP_NO    0 /* refused, or HTTP/0.9 which has no Content-Encoding */
+#define HTTP_GZIP_YES   1 /* asked for */
+#define HTTP_GZIP_ANY   2 /* no Accept-Encoding header, any coding will do */
+
+/** Sent instead of a file whose ETag the client already has */
+static const char http_not_modified[] =
+  "HTTP/1.0 304 Not Modified" CRLF
+  "Server: " HTTPD_SERVER_AGENT CRLF CRLF;
+
+/** A gzip file to a client that takes no gzip, the plain copy not kept */
+static const char http_not_acceptable[] =
+  "HTTP/1.0 406 Not Acceptable" CRLF
+  "Server: " HTTPD_SERVER_AGENT CRLF
+  "Vary: Accept-Encoding" CRLF
+  "Content-Length: 0" CRLF CRLF;
+
 #if LWIP_HTTPD_SUPPORT_POST
 /** Filename for response file to send when POST is finished */
 static char http_post_response_filename[LWIP_HTTPD_POST_MAX_RESPONSE_URI_LEN+1];
@@ -306,6 +328,7 @@ struct http_state {
 #endif /* LWIP_HTTPD_SSI || LWIP_HTTPD_DYNAMIC_HEADERS */
   u32_t left;       /* Number of unsent bytes in buf. */
   u8_t retries;
+  u8_t accept_gzip; /* HTTP_GZIP_xx of the request's Accept-Encoding */
 #if LWIP_HTTPD_SSI
   const char *parsed;     /* Pointer to the first unparsed byte in buf. */
 #if !LWIP_HTTPD_SSI_INCLUDE_TAG
@@ -411,6 +434,66 @@ static char* strnstrd(const char* buffer, const char* token, size_t n)
 } 
 #endif /* LWIP_HTTPD_STRNSTR_PRIVATE */
 
+/** Find a request header, the name compared case-insensitively.
+ * @param hdrs the request from the CRLF before the first header on
+ * @param name the lower case header name with its colon, e.g. "accept-encoding:"
+ * @return the first byte of the value, NULL if there is no such header */
+static const char* http_find_header(const char *hdrs, u16_t hdrs_len, const char *name)
+{
+  const char *p = hdrs, *end = hdrs + hdrs_len;
+  size_t i, n = strlen(name);
+
+  while ((p < end) && ((p = strnstrd(p, CRLF, end - p)) != NULL)) {
+    p += 2;
+    if (p + n > end) {
+      return NULL;
+    }
+    for (i = 0; i < n; i++) {
+      char c = p[i];
+      if ((c >= 'A') && (c <= 'Z')) {
+        c += 'a' - 'A';
+      }
+      if (c != name[i]) {
+        break;
+      }
+    }
+    if (i == n) {
+      return p + n;
+    }
+  }
+  return NULL;
+}
+
+/** Does the Accept-Encoding header in the request headers take gzip?
+ * "gzip;q=0" refuses it. Without the header any coding will do (RFC 7231
+ * 5.3.4), the plain copy is still the one sent if makefsdata kept it. */
+static u8_t http_accepts_gzip(const char *hdrs, u16_t hdrs_len)
+{
+  const char *ae, *ae_end, *gz;
+
+  ae = http_find_header(hdrs, hdrs_len, "accept-encoding:");
+  if (ae == NULL) {
+    return HTTP_GZIP_ANY;
+  }
+  ae_end = strnstrd(ae, CRLF, hdrs_len - (ae - hdrs));
+  if (ae_end == NULL) {
+    return HTTP_GZIP_NO;
+  }
+  gz = strnstrd(ae, "gzip", ae_end - ae);
+  if (gz == NULL) {
+    return HTTP_GZIP_NO;
+  }
+  for (gz += 4; (gz < ae_end) && (*gz == ' '); gz++);
+  if ((gz < ae_end) && (*gz == ';')) {
+    const char *q = strnstrd(gz, "q=", ae_end - gz);
+    if (q != NULL) {
+      for (q += 2; (q < ae_end) && ((*q == '0') || (*q == '.')); q++);
+      return ((q < ae_end) && (*q >= '1') && (*q <= '9')) ? HTTP_GZIP_YES : HTTP_GZIP_NO;
+    }
+  }
+  return HTTP_GZIP_YES;
+}
+
 /** Allocate a struct http_state. */
 static struct http_state* http_state_alloc(void)
 {
@@ -1276,7 +1359,7 @@ static u8_t http_send_data(struct tcp_pcb *pcb, struct http_state *hs)
   }
 #endif /* LWIP_HTTPD_SSI */
 
-  if((hs->left == 0) && (fs_bytes_left(hs->handle) <= 0)) {
+  if((hs->left == 0) && ((hs->handle == NULL) || (fs_bytes_left(hs->handle) <= 0))) {
     /* We reached the end of the file so this request is done.
      * This adds the FIN flag right into the last data segment.
      * @todo: don't close here for HTTP/1.1? */
@@ -1674,6 +1757,8 @@ static err_t http_parse_request(struct pbuf **inp, struct http_state *hs, struct
         uri[uri_len] = 0;
         LWIP_DEBUGF(HTTPD_DEBUG, ("Received \"%s\" request for URI: \"%s\"\n",
                     data, uri));
+        hs->accept_gzip = is_09 ? HTTP_GZIP_NO :
+                          http_accepts_gzip(sp2 + 1, data_len - (sp2 + 1 - data));
 #if LWIP_HTTPD_SUPPORT_POST
         if (is_post) {
 #if LWIP_HTTPD_SUPPORT_REQUESTLIST
@@ -1695,7 +1780,20 @@ static err_t http_parse_request(struct pbuf **inp, struct http_state *hs, struct
         } else
 #endif /* LWIP_HTTPD_SUPPORT_POST */
         {
-          return http_find_file(hs, uri, is_09);
+          err_t find_err;
+          const char *inm = http_find_header(sp2 + 1, data_len - (sp2 + 1 - data), "if-none-match:");
+          if (inm != NULL) {
+            const char *inm_end;
+            inm_end = strnstrd(inm, CRLF, data_len - (inm - data));
+            if (inm_end != NULL) {
+              http_req_etag = inm;
+              http_req_etag_len = (u16_t)(inm_end - inm);
+            }
+          }
+          find_err = http_find_file(hs, uri, is_09);
+          http_req_etag = NULL;
+          http_req_etag_len = 0;
+          return find_err;
         }
       } else {
         LWIP_DEBUGF(HTTPD_DEBUG, ("invalid URI\n"));
@@ -1879,9 +1977,41 @@ static err_t http_find_file(struct http_state *hs, const char *uri, int is_09)
  */
 static err_t http_init_file(struct http_state *hs, struct fs_file *file, int is_09, const char *uri)
 {
+  if ((file != NULL) && (file->flags & FS_FILE_FLAGS_GZIP) && (hs->accept_gzip != HTTP_GZIP_YES)) {
+    /* the client did not ask for gzip, send the plain copy if makefsdata kept
+       one, else gzip anyway unless the client refused it */
+    if (!fs_use_identity(file) && (hs->accept_gzip == HTTP_GZIP_NO)) {
+      fs_close(file);
+#if LWIP_HTTPD_SSI
+      hs->tag_check = false;
+#endif /* LWIP_HTTPD_SSI */
+      hs->handle = NULL;
+      hs->file = (char*)http_not_acceptable;
+      hs->left = sizeof(http_not_acceptable) - 1;
+      hs->retries = 0;
+      return ERR_OK;
+    }
+  }
+  if ((file != NULL) && (file->etag != NULL) && (http_req_etag != NULL) &&
+      (strnstrd(http_req_etag, file->etag, http_req_etag_len) != NULL)) {
+    /* the client has this version cached, answer with the header only */
+    fs_close(file);
+#if LWIP_HTTPD_SSI
+    hs->tag_check = false;
+#endif /* LWIP_HTTPD_SSI */
+    hs->handle = NULL;
+    hs->file = (char*)http_not_modified;
+    hs->left = sizeof(http_not_modified) - 1;
+    hs->retries = 0;
+    return ERR_OK;
+  }
   if (file != NULL) {
     /* file opened, initialise struct http_state */
 #if LWIP_HTTPD_SSI
+    if (file->flags & FS_FILE_FLAGS_NO_SSI) {
+      /* makefsdata found no tags, the data may even be compressed */
+      hs->tag_check = false;
+    }
     hs->tag_index = 0;
     hs->tag_state = TAG_NONE;
     hs->parsed = file->data;
@@ -2106,6 +2236,13 @@ err_t httpd_post_begin(void *connection, const char *uri, const char *http_reque
                        u16_t http_request_len, int content_len, char *response_uri,
                        u16_t response_uri_len, u8_t *post_auto_wnd)
 {
+  LWIP_UNUSED_ARG(http_request);
+  LWIP_UNUSED_ARG(http_request_len);
+  LWIP_UNUSED_ARG(content_len);
+  LWIP_UNUSED_ARG(response_uri);
+  LWIP_UNUSED_ARG(response_uri_len);
+  LWIP_UNUSED_ARG(post_auto_wnd);
+
   if (!uri || uri[0] == '\0')
     return ERR_ARG;
   
@@ -14,6 +14,7 @@
 #include "user_config.h"
 #include "cJSON.h"
 #include "car_data.h"
+#include "lwip_stat.h"
 
 const char radioEthMode[2][15] = {
 	"radioDhcp",
@@ -32,7 +33,7 @@ const char radioCanMode[2][15] = {
 
 #define NUM_CONFIG_SSI_TAGS 8
 #define NUM_CONFIG_CGI_URIS 4
-#define NUM_CONFIG_JS_URIS 5
+#define NUM_CONFIG_JS_URIS 6
 
 const char *ntrip_config_cgi_handler(int iIndex, int iNumParams, char *pcParam[], char *pcValue[]);
 const char *user_config_cgi_handler(int iIndex, int iNumParams, char *pcParam[], char *pcValue[]);
@@ -44,6 +45,7 @@ const char *ntrip_state_js_handler(int iIndex, int iNumParams, char *pcParam[],
 const char *user_config_js_handler(int iIndex, int iNumParams, char *pcParam[], char *pcValue[]);
 const char *ethnet_config_js_handler(int iIndex, int iNumParams, char *pcParam[], char *pcValue[]);
 const char *odo_config_js_handler(int iIndex, int iNumParams, char *pcParam[], char *pcValue[]);
+const char *net_stats_js_handler(int iIndex, int iNumParams, char *pcParam[], char *pcValue[]);
 
 static const char *ssiTAGs[] =
 	{
@@ -72,6 +74,7 @@ static const tJS jsURIs[] =
 		{"/UserConfig.js", user_config_js_handler},
         {"/EthnetConfig.js", ethnet_config_js_handler},
         {"/OdoConfig.js", odo_config_js_handler},
+        {"/NetStats.js", net_stats_js_handler},
 };
 
 // SSI Handler
@@ -583,6 +586,35 @@ const char *ntrip_state_js_handler(int iIndex, int iNumParams, char *pcParam[],
 	return (char *)http_response;
 }
 
+// pools as [name, used, max, avail, err], heap in bytes
+const char *net_stats_js_handler(int iIndex, int iNumParams, char *pcParam[], char *pcValue[])
+{
+    lwip_stat_t stat;
+    int len;
+    uint8_t i;
+
+    lwip_stat_get(&stat);
+
+    memset(http_response, 0, HTTP_JS_RESPONSE_SIZE);
+	memset(http_response_body, 0, HTTP_JS_RESPONSE_SIZE);
+
+    len = sprintf((char *)http_response_body, "NetStatsCallback({\"pools\":[");
+    for (i = 0; i < LWIP_STAT_POOLS; i++)
+    {
+        len += sprintf((char *)http_response_body + len, "%s[\"%s\",%u,%u,%u,%lu]",
+            (i != 0)? ",":"",
+            lwip_stat_pool_name(i),
+            stat.pool[i].used, stat.pool[i].max, stat.pool[i].avail, (unsigned long)stat.pool[i].err);
+    }
+    sprintf((char *)http_response_body + len, "],\"heap\":[%u,%u,%u,%lu],\"mboxFull\":%lu,\"mboxMax\":%u,\"tcpRexmit\":%lu})",
+        stat.heap.used, stat.heap.max, stat.heap.avail, (unsigned long)stat.heap.err,
+        (unsigned long)stat.mbox_full, stat.mbox_max, (unsigned long)stat.tcp_rexmit);
+
+	sprintf((char *)http_response, "HTTP/1.1 200 OK\r\nContent-Type: text/html\r\nContent-Length:%d\r\n\r\n%s", strlen((const char*)http_response_body), http_response_body);
+
+	return (char *)http_response;
+}
+
 void httpd_ssi_init(void)
 {
 	http_set_ssi_handler(ssi_handler, ssiTAGs, NUM_CONFIG_SSI_TAGS);
@@ -6,7 +6,7 @@
 #include "platformAPI.h"
 #include "user_config.h"
 #include "uart.h"
-#include "cJSON.h"
+#include "json_stream.h"
 
 char esp_bt_cmd[BT_CMD_MAX][CMD_MAX_LEN] = 
 {
@@ -56,93 +56,152 @@ static int get_bt_cmd_index(void* cmd)
     return -1;
 }
 
+#define RTK_JSON_BUF_SIZE   640     /* about 450 bytes of formatted text */
+
+/* keys bt_app_json_parse needs, all of them at the top level */
+enum {
+    BT_JSON_PACKET_TYPE = 0,
+    BT_JSON_PACKET_RATE,
+    BT_JSON_INS_PARA,               /* nine ins parameters from here on */
+    BT_JSON_KEYS = BT_JSON_INS_PARA + 9
+};
+
+static const char *bt_json_keys[BT_JSON_KEYS] = {
+    "userPacketType", "userPacketRate",
+    "leverArmBx", "leverArmBy", "leverArmBz",
+    "pointOfInterestBx", "pointOfInterestBy", "pointOfInterestBz",
+    "rotationRbvx", "rotationRbvy", "rotationRbvz"
+};
+
+typedef struct {
+    uint16_t found;                 /* bit per key, first occurrence wins */
+    uint16_t valid;                 /* bit per key with a value of the right type */
+    char packet_type[16];
+    int packet_rate;
+    double ins_para[9];
+} bt_app_json_t;
+
 static void send_rtk_json_to_esp32(void)
 {
-    cJSON *root, *fmt;
-    char *out;
-    char compile_time[50] = __DATE__;
-    
-    root = cJSON_CreateObject();
-    cJSON_AddItemToObject(root, "openrtk config", fmt = cJSON_CreateObject());
-    cJSON_AddItemToObject(fmt, "Product Name", cJSON_CreateString(PRODUCT_NAME_STRING));
-    cJSON_AddItemToObject(fmt, "Product PN", cJSON_CreateString((const char *)platformBuildInfo()));
-    cJSON_AddItemToObject(fmt, "Product SN", cJSON_CreateNumber(GetUnitSerialNum()));
-    cJSON_AddItemToObject(fmt, "Version", cJSON_CreateString(APP_VERSION_STRING));
-    cJSON_AddItemToObject(fmt, "Compile Time", cJSON_CreateString(compile_time));
+    /* static: the bt uart dma is still reading it when this returns */
+    static char out[RTK_JSON_BUF_SIZE];
+    json_writer_t w;
+    int len, i;
+
+    json_writer_init(&w, out, sizeof(out), NULL, NULL, 1);
+    json_object_begin(&w, NULL);
+    json_object_begin(&w, "openrtk config");
+    json_add_string(&w, "Product Name", PRODUCT_NAME_STRING);
+    json_add_string(&w, "Product PN", (const char *)platformBuildInfo());
+    json_add_number(&w, "Product SN", GetUnitSerialNum());
+    json_add_string(&w, "Version", APP_VERSION_STRING);
+    json_add_string(&w, "Compile Time", __DATE__);
 
     uint8_t *user_packet_type = get_user_packet_type();
     char packet_type_str[5] = {0};
     packet_type_str[0] = user_packet_type[0];
     packet_type_str[1] = user_packet_type[1];
 
-    uint16_t user_packet_rate = get_user_packet_rate();
-
-    cJSON_AddItemToObject(fmt, "userPacketType", cJSON_CreateString(packet_type_str));
-    cJSON_AddItemToObject(fmt, "userPacketRate", cJSON_CreateNumber(user_packet_rate));
+    json_add_string(&w, bt_json_keys[BT_JSON_PACKET_TYPE], packet_type_str);
+    json_add_number(&w, bt_json_keys[BT_JSON_PACKET_RATE], get_user_packet_rate());
 
     float *ins_para = get_user_ins_para();
-    cJSON_AddItemToObject(fmt, "leverArmBx", cJSON_CreateNumber(*ins_para));
-    cJSON_AddItemToObject(fmt, "leverArmBy", cJSON_CreateNumber(*(ins_para + 1)));
-    cJSON_AddItemToObject(fmt, "leverArmBz", cJSON_CreateNumber(*(ins_para + 2)));
-    cJSON_AddItemToObject(fmt, "pointOfInterestBx", cJSON_CreateNumber(*(ins_para + 3)));
-    cJSON_AddItemToObject(fmt, "pointOfInterestBy", cJSON_CreateNumber(*(ins_para + 4)));
-    cJSON_AddItemToObject(fmt, "pointOfInterestBz", cJSON_CreateNumber(*(ins_para + 5)));
-    cJSON_AddItemToObject(fmt, "rotationRbvx", cJSON_CreateNumber(*(ins_para + 6)));
-    cJSON_AddItemToObject(fmt, "rotationRbvy", cJSON_CreateNumber(*(ins_para + 7)));
-    cJSON_AddItemToObject(fmt, "rotationRbvz", cJSON_CreateNumber(*(ins_para + 8)));
-
-    out = cJSON_Print(root);
-    cJSON_Delete(root);
-
-    uart_write_bytes(UART_BT,out,strlen(out),1);
+    for (i = 0; i < 9; i++)
+    {
+        json_add_number(&w, bt_json_keys[BT_JSON_INS_PARA + i], ins_para[i]);
+    }
+    json_object_end(&w);
+    json_object_end(&w);
+
+    len = json_writer_end(&w);
+    if (len <= 0)
+    {
+        return;
+    }
+
+    uart_write_bytes(UART_BT, out, len, 1);
     OS_Delay(10);
-    uart_write_bytes(UART_BT, out, strlen(out), 1);
-    free(out);
+    uart_write_bytes(UART_BT, out, len, 1);
+}
+
+/* walk the first json value of the text and pick up the configuration keys,
+   returns 0 if the text is not json */
+static int bt_app_json_read(const char *text, bt_app_json_t *cfg)
+{
+    json_reader_t r;
+    json_token_e tok;
+    int i;
+
+    memset(cfg, 0, sizeof(bt_app_json_t));
+    json_reader_init(&r, text, (uint16_t)strlen(text));
+
+    tok = json_next(&r);
+    if (tok != JSON_OBJECT_BEGIN)
+    {
+        return json_skip(&r, tok);
+    }
+    while ((tok = json_next(&r)) != JSON_OBJECT_END)
+    {
+        for (i = 0; i < BT_JSON_KEYS; i++)
+        {
+            if (!(cfg->found & (1 << i)) && json_key_is(&r, bt_json_keys[i]))
+            {
+                cfg->found |= 1 << i;
+                if (i == BT_JSON_PACKET_TYPE)
+                {
+                    if (tok == JSON_STRING && json_string_copy(r.str, r.str_len, cfg->packet_type, sizeof(cfg->packet_type)) >= 0)
+                    {
+                        cfg->valid |= 1 << i;
+                    }
+                }
+                else if (tok == JSON_NUMBER)
+                {
+                    if (i == BT_JSON_PACKET_RATE)
+                    {
+                        cfg->packet_rate = (int)r.num;
+                    }
+                    else
+                    {
+                        cfg->ins_para[i - BT_JSON_INS_PARA] = r.num;
+                    }
+                    cfg->valid |= 1 << i;
+                }
+                break;
+            }
+        }
+        if (!json_skip(&r, tok))
+        {
+            return 0;
+        }
+    }
+    return 1;
 }
 
-static void bt_app_json_parse(cJSON* root)
+static void bt_app_json_parse(const bt_app_json_t *cfg)
 {
 	BOOL result;
-    cJSON *packetCode, *packetRate;
-    cJSON *leverArmBx, *leverArmBy, *leverArmBz;
-    cJSON *pointOfInterestBx, *pointOfInterestBy, *pointOfInterestBz;
-    cJSON *rotationRbvx, *rotationRbvy, *rotationRbvz;
-    
-    packetCode = cJSON_GetObjectItem(root,"userPacketType");
-    packetRate = cJSON_GetObjectItem(root,"userPacketRate");
-    leverArmBx = cJSON_GetObjectItem(root, "leverArmBx");
-    leverArmBy = cJSON_GetObjectItem(root, "leverArmBy");
-    leverArmBz = cJSON_GetObjectItem(root, "leverArmBz");
-    pointOfInterestBx = cJSON_GetObjectItem(root, "pointOfInterestBx");
-    pointOfInterestBy = cJSON_GetObjectItem(root, "pointOfInterestBy");
-    pointOfInterestBz = cJSON_GetObjectItem(root, "pointOfInterestBz");
-    rotationRbvx = cJSON_GetObjectItem(root, "rotationRbvx");
-    rotationRbvy = cJSON_GetObjectItem(root, "rotationRbvy");
-    rotationRbvz = cJSON_GetObjectItem(root, "rotationRbvz");
-    
-    if (packetCode != NULL && packetRate != NULL 
-        && leverArmBx != NULL && leverArmBy != NULL && leverArmBz != NULL
-        && pointOfInterestBx != NULL && pointOfInterestBy != NULL && pointOfInterestBz != NULL
-        && rotationRbvx != NULL && rotationRbvy != NULL && rotationRbvz != NULL){
-
-        result = valid_user_config_parameter(USER_USER_PACKET_TYPE, (uint8_t*)packetCode->valuestring);
+    int packet_rate = cfg->packet_rate;
+
+    if (cfg->valid == (1 << BT_JSON_KEYS) - 1){
+
+        result = valid_user_config_parameter(USER_USER_PACKET_TYPE, (uint8_t*)cfg->packet_type);
         if (result){
-            set_user_packet_type((uint8_t*)packetCode->valuestring);
+            set_user_packet_type((uint8_t*)cfg->packet_type);
         }
-        result = valid_user_config_parameter(USER_USER_PACKET_RATE, (uint8_t*)&packetRate->valueint);
+        result = valid_user_config_parameter(USER_USER_PACKET_RATE, (uint8_t*)&packet_rate);
         if (result){
-            set_user_packet_rate(packetRate->valueint);
+            set_user_packet_rate(packet_rate);
         }
 
-        set_lever_arm_bx(leverArmBx->valuedouble);
-        set_lever_arm_by(leverArmBy->valuedouble);
-        set_lever_arm_bz(leverArmBz->valuedouble);
-        set_point_of_interest_bx(pointOfInterestBx->valuedouble);
-        set_point_of_interest_by(pointOfInterestBy->valuedouble);
-        set_point_of_interest_bz(pointOfInterestBz->valuedouble);
-        set_rotation_rbvx(rotationRbvx->valuedouble);
-        set_rotation_rbvy(rotationRbvy->valuedouble);
-        set_rotation_rbvz(rotationRbvz->valuedouble);
+        set_lever_arm_bx(cfg->ins_para[0]);
+        set_lever_arm_by(cfg->ins_para[1]);
+        set_lever_arm_bz(cfg->ins_para[2]);
+        set_point_of_interest_bx(cfg->ins_para[3]);
+        set_point_of_interest_by(cfg->ins_para[4]);
+        set_point_of_interest_bz(cfg->ins_para[5]);
+        set_rotation_rbvx(cfg->ins_para[6]);
+        set_rotation_rbvy(cfg->ins_para[7]);
+        set_rotation_rbvz(cfg->ins_para[8]);
 
         ins_init();
 
@@ -163,12 +222,10 @@ int bt_uart_parse(uint8_t* bt_buff)     //TODO:
             is_first_rev_bt_mes = 1;
             return BT_CMD;
         }
-        cJSON *root;
-        root = cJSON_Parse((const char *)bt_buff);
-        if (root != NULL)
+        bt_app_json_t cfg;
+        if (bt_app_json_read((const char *)bt_buff, &cfg))
         {
-            bt_app_json_parse(root);
-            cJSON_Delete(root);
+            bt_app_json_parse(&cfg);
             return RTK_JSON;
         }
         else
@@ -11,16 +11,65 @@ typedef struct {
     uint32_t update;
     uint32_t week;
     double timestamp;
-    float speed_FR;
-    float speed_FL;
-    float speed_RR;
-    float speed_RL;
-    float speed_combined;
+    double speed_FR;
+    double speed_FL;
+    double speed_RR;
+    double speed_RL;
+    double speed_combined;
     uint8_t fwd;
 } WHEEL_SPEED_STRUCT;
 
+#define  CAR_CAN_SIGNAL_MAX         8       // extraction plans, odo_mesg[] plus car_can_add_signal()
+#define  CAR_CAN_ID_INDEX_SIZE      16      // power of 2, at least twice CAR_CAN_SIGNAL_MAX
+#define  CAR_CAN_RX_QUEUE_SIZE      32      // power of 2, frames between the ISR and the CAN task
+
+// one odometry signal, with the same meaning as an odo_mesg[] entry
+typedef struct {
+    uint32_t mesgID;
+    uint8_t startbit;
+    uint8_t length;
+    uint8_t endian;         // 0: intel, 1: motorola
+    uint8_t sign;           // 1: top bit is the sign, the rest the magnitude
+    uint8_t unit;           // 0: km/h, 1: mph, 2: m/s
+    uint8_t source;         // 0: RR, 1: RL, 2: combined speed, 3: gear
+    double factor;
+    double offset;
+} car_can_signal_t;
+
+// a signal compiled down to one shift and mask of the frame read as a 64 bit word
+typedef struct {
+    uint8_t big_endian;     // read the frame as a big endian word
+    uint8_t shift;
+    uint8_t source;
+    uint64_t mask;
+    uint64_t sign_bit;      // 0: unsigned
+    double scale;           // factor and unit conversion
+    double bias;            // offset, added before scaling so a stop reads exactly 0
+    double factor;          // gear values are compared unscaled
+    double offset;
+} car_can_plan_t;
+
+typedef struct {
+    uint32_t nplan;
+    car_can_plan_t plan[CAR_CAN_SIGNAL_MAX];
+    uint16_t id[CAR_CAN_ID_INDEX_SIZE];             // 0xFFFF: free
+    uint8_t first[CAR_CAN_ID_INDEX_SIZE];           // plans of an id are consecutive
+    uint8_t count[CAR_CAN_ID_INDEX_SIZE];
+} car_can_plans_t;
+
+typedef struct {
+    uint32_t stdId;
+    uint8_t data[8];
+    int64_t time;           // arrival, now_gps() us
+} car_can_frame_t;
+
 void car_can_initialize(void);
 void can_config_filter_car(void);
+int car_can_add_signal(const car_can_signal_t *signal);
+void car_can_compile(void);
+void car_can_rx_isr(uint32_t stdId, const uint8_t* data);
+uint32_t car_can_rx_process(void);
+void car_can_rx_stat(uint32_t *rx, uint32_t *drop);
 void car_can_data_process(uint32_t stdId, uint8_t* data);
 uint8_t car_get_wheel_speed(double *car_speed, uint8_t *fwd, uint32_t *week, double *timestamp);
 
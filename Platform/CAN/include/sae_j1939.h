@@ -69,6 +69,11 @@ typedef struct {
 #define SAE_J1939_PDU_FORMAT_ACK                     232
 #define SAE_J1939_PDU_FORMAT_REQUEST                 234
 #define SAE_J1939_PDU_FORMAT_ADDRESS_CLAIM           238
+#define SAE_J1939_PDU_FORMAT_TP_DT                   235
+#define SAE_J1939_PDU_FORMAT_TP_CM                   236
+
+// PFs from here on are PDU2, the PS is part of the PGN
+#define SAE_J1939_PDU2_FORMAT_MIN                    240
 
 
 
@@ -97,6 +102,7 @@ typedef struct {
 #define SAE_J1939_ANGULAR_PRIORITY                   3
 #define SAE_J1939_POSITION_PRIORITY                  6
 #define SAE_J1939_ATTITUDE_PRIORITY                  6
+#define SAE_J1939_TP_PRIORITY                        7
 
 
 
@@ -180,6 +186,9 @@ struct sae_j1939_tx_desc {
   DESC_STATE                  tx_pkt_ready;         // tx state
   SAE_J1939_IDENTIFIER_FIELD  tx_identifier;        // idnetifier of tx packet
   CanTxMsg                    tx_buffer;            // tx buffer
+  uint16_t                    tx_lifetime;          // ms, dropped if still queued after it, 0 never
+  uint32_t                    tx_queued;            // ms, time the packet was queued
+  uint32_t                    tx_seq;               // queue order, breaks ties in the scheduler
 
   struct sae_j1939_tx_desc *next;  
 };
@@ -188,6 +197,37 @@ struct sae_j1939_tx_desc {
 #define SAE_J1939_MAX_TX_DESC             32
 #define SAE_J1939_MAX_RX_DESC             32
 
+#define SAE_J1939_TASK_PERIOD_MS          10        // CAN task runs at 100Hz
+#define SAE_J1939_MAX_PGN_STAT            16        // PGNs with transmit statistics
+
+
+// transmit events counted per PGN
+typedef enum {
+  SAE_J1939_TX_SENT          =   0,        // put into a mailbox
+  SAE_J1939_TX_OVERFLOW      =   1,        // dropped, no free tx desc
+  SAE_J1939_TX_EXPIRED       =   2         // dropped, queued longer than its lifetime
+} SAE_J1939_TX_EVENT;
+
+// transmit statistics of one PGN
+typedef struct {
+  uint32_t pgn;                            // parameter group number
+  uint32_t sent;                           // packets sent
+  uint32_t overflow;                       // packets dropped, tx queue full
+  uint32_t expired;                        // packets dropped, stale
+  uint32_t latency_sum;                    // ms, queued to mailbox, summed over sent packets
+  uint16_t latency_max;                    // ms, worst queued to mailbox
+} SAE_J1939_PGN_STAT;
+
+
+// J1939-21 transport protocol, broadcast (BAM) only
+#define SAE_J1939_TP_CM_BAM               32        // TP.CM control byte of BAM
+#define SAE_J1939_TP_MAX_LEN              1785      // 255 TP.DT packets of 7 bytes
+#ifndef SAE_J1939_TP_BUF_LEN
+#define SAE_J1939_TP_BUF_LEN              512       // largest message we broadcast
+#endif
+#define SAE_J1939_TP_BAM_GAP              50        // ms between BAM packets, 50 to 200 in J1939-21
+#define SAE_J1939_TP_TIMEOUT              750       // ms, T1 of the receivers, the message is given up
+
 
 struct sae_j1939_rx_desc {
   uint8_t                     rx_pkt_len;         // rx packet length
@@ -390,6 +430,8 @@ extern void ecu_process(void);
 extern void ecu_transmit(void); 
 
 extern uint8_t find_tx_desc(struct sae_j1939_tx_desc **);
+extern void sae_j1939_queue_tx_desc(struct sae_j1939_tx_desc *, uint16_t lifetime);
+extern uint32_t sae_j1939_pgn(SAE_J1939_IDENTIFIER_FIELD *);
 extern ACEINNA_J1939_PACKET_TYPE is_valid_config_command(SAE_J1939_IDENTIFIER_FIELD *);
 extern ACEINNA_J1939_PACKET_TYPE is_aceinna_data_packet(SAE_J1939_IDENTIFIER_FIELD *);
 extern ACEINNA_J1939_PACKET_TYPE is_algorithm_data_packet(SAE_J1939_IDENTIFIER_FIELD *);
@@ -400,6 +442,7 @@ extern void send_address_claim(ECU_INSTANCE *);
 extern void process_request_pg(struct sae_j1939_rx_desc *);
 extern void build_request_pkt(struct sae_j1939_tx_desc *);
 extern void process_address_claim(struct sae_j1939_rx_desc *desc);
+extern void save_ecu_address(uint16_t address);
 
 extern void    aceinna_j1939_transmit_isr(void);
 extern void    aceinna_j1939_receive_isr(void);
@@ -414,6 +457,13 @@ extern uint8_t aceinna_j1939_send_packet_type(uint16_t type);
 extern uint8_t aceinna_j1939_send_GPS(GPS_DATA * data);
 extern uint8_t aceinna_j1939_send_attitude(ATTITUDE_DATA * data);
 extern uint8_t aceinna_j1939_build_msg(void *payload, msg_params_t *params);
+extern struct sae_j1939_tx_desc *aceinna_j1939_queue_msg(void *payload, msg_params_t *params, uint16_t lifetime);
+extern void    aceinna_j1939_tx_account(uint32_t pgn, SAE_J1939_TX_EVENT event, uint32_t latency);
+extern uint8_t aceinna_j1939_tx_stat(uint8_t index, SAE_J1939_PGN_STAT *stat);
+
+extern void    aceinna_j1939_tp_initialize(void);
+extern void    aceinna_j1939_tp_process(void);
+extern uint8_t aceinna_j1939_send_bam(void *payload, uint16_t len, msg_params_t *params);
 
 
 // priority 6
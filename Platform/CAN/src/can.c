@@ -19,6 +19,7 @@
 #include "user_message_can.h"
 #include "user_config.h"
 #include "car_data.h"
+#include "event_trace.h"
 
 CAN_HandleTypeDef canHandle;
 CAN_FilterTypeDef canFilter;
@@ -181,7 +182,8 @@ static void _can_start(void)
         Error_Handler();
     }
 
-    if (HAL_CAN_ActivateNotification(&canHandle, CAN_IT_RX_FIFO0_MSG_PENDING) != HAL_OK)
+    // mailbox empty interrupts let the J1939 scheduler refill the mailboxes
+    if (HAL_CAN_ActivateNotification(&canHandle, CAN_IT_RX_FIFO0_MSG_PENDING | CAN_IT_TX_MAILBOX_EMPTY) != HAL_OK)
     {
         Error_Handler();
     }
@@ -196,14 +198,18 @@ void HAL_CAN_RxFifo0MsgPendingCallback(CAN_HandleTypeDef *hcan)
         if (gOdoConfigurationStruct.can_mode == 0) {
             if (HAL_CAN_GetRxMessage(hcan, CAN_RX_FIFO0, &can_rx_msg.rx_header, can_rx_msg.data) == HAL_OK)
             {
+                EVENT_TRACE2(EVENT_CAN_RX, can_rx_msg.rx_header.IDE == CAN_ID_STD ? can_rx_msg.rx_header.StdId : can_rx_msg.rx_header.ExtId,
+                             can_rx_msg.rx_header.DLC);
                 if (can_rx_msg.rx_header.IDE == CAN_ID_STD && can_rx_msg.rx_header.DLC == 8)
                 {
-                    car_can_data_process(can_rx_msg.rx_header.StdId, can_rx_msg.data);
+                    car_can_rx_isr(can_rx_msg.rx_header.StdId, can_rx_msg.data);
                 }
             }
         } else if (gOdoConfigurationStruct.can_mode == 1) {
             if (HAL_CAN_GetRxMessage(hcan, CAN_RX_FIFO0, &gEcuInst.curr_rx_desc->rx_buffer.rx_header, gEcuInst.curr_rx_desc->rx_buffer.data) == HAL_OK)
             {
+                EVENT_TRACE2(EVENT_CAN_RX, gEcuInst.curr_rx_desc->rx_buffer.rx_header.ExtId,
+                             gEcuInst.curr_rx_desc->rx_buffer.rx_header.DLC);
                 canRxIntCounter++;
                 if (gCANTxCompleteCallback != NULL) {
                     gCANRxCompleteCallback();
@@ -220,6 +226,7 @@ void USER_CAN_RX_IRQHandler(void)
 
 void HAL_CAN_TxComplete(CAN_HandleTypeDef *hcan)
 {
+    EVENT_TRACE0(EVENT_CAN_TX_DONE);
     if (gOdoConfigurationStruct.can_mode == 1) {
         if (gCANTxCompleteCallback != NULL) {
             gCANTxCompleteCallback();
@@ -2,56 +2,265 @@
 #include "can.h"
 #include "string.h"
 #include "user_config.h"
+#include "time_service.h"
+#include "rtcm.h"
 
 WHEEL_SPEED_STRUCT wheel_speed;
 
 extern int32_t gps_start_week;
 
+// signals added on top of gOdoConfigurationStruct.odo_mesg[]
+static car_can_signal_t carCanSignal[CAR_CAN_SIGNAL_MAX];
+static uint8_t carCanSignalNum = 0;
+
+// compiled while the other set is in use, then swapped in. the generation
+// goes up before a set is overwritten, the CAN task decodes again with the
+// new set when it changed under it
+static car_can_plans_t carCanPlans[2];
+static car_can_plans_t * volatile carCanActive = &carCanPlans[0];
+static volatile uint32_t carCanGen = 0;
+
+// frames from the rx interrupt to the CAN task, single producer single consumer
+static car_can_frame_t carCanRxQueue[CAR_CAN_RX_QUEUE_SIZE];
+static volatile uint32_t carCanRxIn = 0;
+static volatile uint32_t carCanRxOut = 0;
+static volatile uint32_t carCanRxCount = 0;
+static volatile uint32_t carCanRxDrop = 0;
+
+static inline uint32_t _car_can_id_slot(uint32_t stdId)
+{
+    return (stdId ^ (stdId >> 4)) & (CAR_CAN_ID_INDEX_SIZE - 1);
+}
+
+/** ***************************************************************************
+ * @name _car_can_find() look up the plans of a CAN ID
+ * @brief the index is at most half full, a free slot ends the probe
+ * @param [in] plans compiled plans
+ *             stdId standard CAN ID
+ * @retval index slot, -1 if no signal uses the ID
+ ******************************************************************************/
+static int _car_can_find(const car_can_plans_t *plans, uint32_t stdId)
+{
+    uint32_t slot = _car_can_id_slot(stdId);
+
+    while (plans->count[slot] != 0) {
+        if (plans->id[slot] == stdId) {
+            return (int)slot;
+        }
+        slot = (slot + 1) & (CAR_CAN_ID_INDEX_SIZE - 1);
+    }
+    return -1;
+}
+
+/** ***************************************************************************
+ * @name _car_can_signal_valid() check a signal the way it was checked per frame
+ * @param [in] sig signal
+ * @retval 1 if it can be extracted from an 8 byte standard frame
+ ******************************************************************************/
+static int _car_can_signal_valid(const car_can_signal_t *sig)
+{
+    if (sig->mesgID > 0x7FF ||
+        sig->startbit >= 64 ||
+        sig->length > 64 ||
+        sig->length == 0 ||
+        sig->endian >= 2 ||
+        sig->sign >= 2 ||
+        sig->unit > 2 ||
+        sig->source > 3) {
+        return 0;
+    }
+    if (sig->endian == 0) {
+        if (sig->startbit + sig->length > 64) {
+            return 0;
+        }
+    } else {
+        if ((((sig->startbit / 8) + 1) * 8 - (sig->startbit % 8)) < sig->length) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/** ***************************************************************************
+ * @name _car_can_plan() compile one signal
+ * @brief intel signals run up from startbit through the frame read as a little
+ *        endian word. Motorola signals start at the same bit and carry on in
+ *        the byte before, which is the same run in the frame read as a big
+ *        endian word, from bit (7 - startbit / 8) * 8 + startbit % 8
+ * @param [in] sig valid signal
+ *        [out] plan
+ * @retval N/A
+ ******************************************************************************/
+static void _car_can_plan(const car_can_signal_t *sig, car_can_plan_t *plan)
+{
+    double scale = sig->factor;
+
+    plan->big_endian = sig->endian;
+    if (sig->endian == 0) {
+        plan->shift = sig->startbit;
+    } else {
+        plan->shift = (7 - sig->startbit / 8) * 8 + sig->startbit % 8;
+    }
+    plan->mask = sig->length == 64 ? ~(uint64_t)0 : ((uint64_t)1 << sig->length) - 1;
+    plan->sign_bit = sig->sign == 1 ? (uint64_t)1 << (sig->length - 1) : 0;
+    plan->source = sig->source;
+
+    if (sig->unit == 0) {
+        scale = scale / 3.6;
+    } else if (sig->unit == 1) {
+        scale = scale * 0.44704;
+    }
+    plan->scale = scale;
+    plan->bias = sig->offset;
+    plan->factor = sig->factor;
+    plan->offset = sig->offset;
+}
+
+/** ***************************************************************************
+ * @name car_can_add_signal() add an odometry signal to the ones in odo_mesg[]
+ * @brief takes effect at the next car_can_initialize()
+ * @param [in] signal
+ * @retval index of the signal, -1 if there is no room
+ ******************************************************************************/
+int car_can_add_signal(const car_can_signal_t *signal)
+{
+    if (carCanSignalNum + 3 >= CAR_CAN_SIGNAL_MAX) {
+        return -1;
+    }
+    carCanSignal[carCanSignalNum] = *signal;
+    return carCanSignalNum++;
+}
+
+/** ***************************************************************************
+ * @name car_can_compile() compile the odometry configuration into plans
+ * @brief signals are checked once here instead of on every frame, invalid
+ *        ones are left out
+ * @param N/A
+ * @retval N/A
+ ******************************************************************************/
+void car_can_compile(void)
+{
+    car_can_signal_t sig[CAR_CAN_SIGNAL_MAX];
+    car_can_plans_t *plans = (carCanActive == &carCanPlans[0]) ? &carCanPlans[1] : &carCanPlans[0];
+    uint32_t nsig = 0, i, j, slot;
+    uint8_t used[CAR_CAN_SIGNAL_MAX] = {0};
+
+    for (i = 0; i < 3; i++) {
+        if (gOdoConfigurationStruct.odo_mesg[i].usage == 0x55) {
+            sig[nsig].mesgID = gOdoConfigurationStruct.odo_mesg[i].mesgID;
+            sig[nsig].startbit = gOdoConfigurationStruct.odo_mesg[i].startbit;
+            sig[nsig].length = gOdoConfigurationStruct.odo_mesg[i].length;
+            sig[nsig].endian = gOdoConfigurationStruct.odo_mesg[i].endian;
+            sig[nsig].sign = gOdoConfigurationStruct.odo_mesg[i].sign;
+            sig[nsig].unit = gOdoConfigurationStruct.odo_mesg[i].unit;
+            sig[nsig].source = gOdoConfigurationStruct.odo_mesg[i].source;
+            sig[nsig].factor = gOdoConfigurationStruct.odo_mesg[i].factor;
+            sig[nsig].offset = gOdoConfigurationStruct.odo_mesg[i].offset;
+            nsig++;
+        }
+    }
+    for (i = 0; i < carCanSignalNum && nsig < CAR_CAN_SIGNAL_MAX; i++) {
+        sig[nsig++] = carCanSignal[i];
+    }
+
+    carCanGen++;
+    __DMB();    // the generation before the set a reader may still hold
+    memset(plans, 0, sizeof(car_can_plans_t));
+    for (i = 0; i < nsig; i++) {
+        if (used[i] || !_car_can_signal_valid(&sig[i])) {
+            continue;
+        }
+        slot = _car_can_id_slot(sig[i].mesgID);
+        while (plans->count[slot] != 0) {
+            slot = (slot + 1) & (CAR_CAN_ID_INDEX_SIZE - 1);
+        }
+        plans->id[slot] = (uint16_t)sig[i].mesgID;
+        plans->first[slot] = (uint8_t)plans->nplan;
+        // the plans of one ID in configuration order
+        for (j = i; j < nsig; j++) {
+            if (!used[j] && sig[j].mesgID == sig[i].mesgID && _car_can_signal_valid(&sig[j])) {
+                _car_can_plan(&sig[j], &plans->plan[plans->nplan++]);
+                plans->count[slot]++;
+                used[j] = 1;
+            }
+        }
+    }
+
+    __DMB();
+    carCanActive = plans;
+}
+
 void car_can_initialize(void)
 {
     memset(&wheel_speed, 0, sizeof(WHEEL_SPEED_STRUCT));
     wheel_speed.fwd = 1;
+    car_can_compile();
     can_config(0, gUserConfiguration.can_baudrate);
 }
 
 void can_config_filter_car(void)
 {
+    const car_can_plans_t *plans = carCanActive;
     uint8_t i;
 
     // can_config_filter_list_message(CAR_CAN_ID_WHEEL_SPEED, 0x00);
 
     filterNum = 0;
-    for (i = 0; i < 3; i++) {
-        if (gOdoConfigurationStruct.odo_mesg[i].usage == 0x55) {
-            can_config_filter_list_message(gOdoConfigurationStruct.odo_mesg[i].mesgID, 0x00);
+    for (i = 0; i < CAR_CAN_ID_INDEX_SIZE; i++) {
+        if (plans->count[i] != 0) {
+            can_config_filter_list_message(plans->id[i], 0x00);
         }
     }
 }
 
+/** ***************************************************************************
+ * @name car_can_rx_isr() queue an odometry frame, called from the rx interrupt
+ * @brief stamps the frame with its arrival time, the decoding is left to
+ *        car_can_rx_process() in the CAN task
+ * @param [in] stdId standard CAN ID
+ *             data 8 data bytes
+ * @retval N/A
+ ******************************************************************************/
+void car_can_rx_isr(uint32_t stdId, const uint8_t* data)
+{
+    uint32_t in = carCanRxIn;
+    car_can_frame_t *frame;
+
+    carCanRxCount++;
+    if (_car_can_find(carCanActive, stdId) < 0) {
+        return;
+    }
+    if (in - carCanRxOut >= CAR_CAN_RX_QUEUE_SIZE) {
+        carCanRxDrop++;
+        return;
+    }
+
+    frame = &carCanRxQueue[in & (CAR_CAN_RX_QUEUE_SIZE - 1)];
+    frame->stdId = stdId;
+    memcpy(frame->data, data, 8);
+    frame->time = now_gps();
+    __DMB();    // the frame before the index that publishes it
+    carCanRxIn = in + 1;
+}
+
 /*
 Now the default data is Toyota Corolla 2019.
 If it is another vehicle, modify this function to fit the communication protocol
 */
-void car_can_data_process(uint32_t stdId, uint8_t* data)
+static void _car_can_frame_process(const car_can_frame_t *frame)
 {
+    const car_can_plans_t *plans;
+    const car_can_plan_t *plan;
     gtime_t time;
-    mcu_time_base_t start_time;
     int week = 0;
     double timestamp = 0.0;
-    int64_t value = 0;
-    uint8_t endian = 0, sign = 0, unit = 0, source = 0;
-    uint8_t index_byte = 0, index_bitofbyte = 0, bitlen = 0, bitlent = 0, lastbitofbyte = 0;
-    double factor = 0.0, offset = 0.0;
-    double svalue = 0.0;
-    uint8_t i;
-
-    start_time = g_MCU_time;
-    time.time = start_time.time;
-    time.sec = (float)start_time.msec / 1000;
-    timestamp = time2gpst(time, &week);
-    if (gps_start_week == -1 || timestamp < 0.0) {
-        return;
-    }
+    uint64_t le, be, value;
+    int64_t svalue;
+    double gear;
+    double speed[3];
+    uint32_t gen;
+    int slot, fwd;
+    uint8_t i, update;
 
     // if (stdId == CAR_CAN_ID_WHEEL_SPEED) {
     //     wheel_speed.week = gps_start_week;
@@ -63,95 +272,122 @@ void car_can_data_process(uint32_t stdId, uint8_t* data)
     //     wheel_speed.update = 1;
     // }
 
-    for (i = 0; i < 3; i++) {
-        if (gOdoConfigurationStruct.odo_mesg[i].usage == 0x55) {
-            if (gOdoConfigurationStruct.odo_mesg[i].mesgID == stdId) {
-                
-                if (gOdoConfigurationStruct.odo_mesg[i].startbit >= 64 ||
-                    gOdoConfigurationStruct.odo_mesg[i].length > 64 ||
-                    gOdoConfigurationStruct.odo_mesg[i].length == 0 ||
-                    gOdoConfigurationStruct.odo_mesg[i].endian >= 2 ||
-                    gOdoConfigurationStruct.odo_mesg[i].sign >= 2 ||
-                    gOdoConfigurationStruct.odo_mesg[i].unit > 2 ||
-                    gOdoConfigurationStruct.odo_mesg[i].source > 3) {
-                    continue;
-                }
-                if (gOdoConfigurationStruct.odo_mesg[i].endian == 0) {
-                    if (gOdoConfigurationStruct.odo_mesg[i].startbit + gOdoConfigurationStruct.odo_mesg[i].length > 64) {
-                        continue;
-                    }
-                } else {
-                    if ((((gOdoConfigurationStruct.odo_mesg[i].startbit / 8) + 1) * 8 - (gOdoConfigurationStruct.odo_mesg[i].startbit % 8)) < gOdoConfigurationStruct.odo_mesg[i].length) {
-                        continue;
-                    }
-                }
+    time.time = frame->time / 1000000;
+    time.sec = (double)(frame->time % 1000000) * 1e-6;
+    timestamp = time2gpst(time, &week);
+    if (gps_start_week == -1 || timestamp < 0.0) {
+        return;
+    }
 
-                value = 0;
-                unit = gOdoConfigurationStruct.odo_mesg[i].unit;
-                source = gOdoConfigurationStruct.odo_mesg[i].source;
-                factor = gOdoConfigurationStruct.odo_mesg[i].factor;
-                offset = gOdoConfigurationStruct.odo_mesg[i].offset;
-                endian = gOdoConfigurationStruct.odo_mesg[i].endian;
-                sign = gOdoConfigurationStruct.odo_mesg[i].sign;
-                index_byte = gOdoConfigurationStruct.odo_mesg[i].startbit / 8;
-                index_bitofbyte = gOdoConfigurationStruct.odo_mesg[i].startbit % 8;
-                bitlen = gOdoConfigurationStruct.odo_mesg[i].length;
-                bitlent = bitlen;
-
-                while (bitlen > 0) {
-                    lastbitofbyte = index_bitofbyte + bitlen >= 8 ? 0 : 8 - (index_bitofbyte + bitlen);
-                    value |= ((data[index_byte] >> index_bitofbyte) & (0xff >> lastbitofbyte)) << (bitlent - bitlen);
-                    bitlen = bitlen - (8 - index_bitofbyte - lastbitofbyte);
-                    if (endian == 0) {
-                        index_byte++;
-                    } else {
-                        index_byte--;
-                    }
-                    index_bitofbyte = 0;
-                }
+    memcpy(&le, frame->data, 8);
+    be = __builtin_bswap64(le);
 
-                if (sign == 1) {
-                    if ((value & (1 << (bitlent - 1))) != 0) {
-                        value = -(value - (1 << (bitlent - 1)));
-                    }
-                }
-                svalue = (value + offset) * factor;
-
-                // printf("value = %lld, svalue = %lf\r\n", value, svalue);
-
-                if (source == 0x03) {
-                    if (svalue == gOdoConfigurationStruct.gears[0]) {
-                        wheel_speed.fwd = 1;
-                    } else if (svalue == gOdoConfigurationStruct.gears[1]) {
-                        wheel_speed.fwd = 0;
-                    } else if (svalue == gOdoConfigurationStruct.gears[2]) {
-                        wheel_speed.fwd = 1;
-                    } else if (svalue == gOdoConfigurationStruct.gears[3]) {
-                        wheel_speed.fwd = 1;
-                    }
-
-                } else {
-                    if (unit == 0) {
-                        svalue = svalue / 3.6;
-                    } else if (unit == 1) {
-                        svalue = svalue * 0.44704;
-                    }
-
-                    if (source == 0) {
-                        wheel_speed.speed_RR = svalue;
-                    } else if (source == 1) {
-                        wheel_speed.speed_RL = svalue;
-                    } else if (source == 2) {
-                        wheel_speed.speed_combined = svalue;
-                    }
-                    wheel_speed.update |= 1 << source;
-                    wheel_speed.week = week;
-                    wheel_speed.timestamp = timestamp;
-                }
+    // decoded into locals, kept only if no compile started meanwhile
+    do {
+        gen = carCanGen;
+        __DMB();
+        plans = carCanActive;
+        update = 0;
+        fwd = -1;
+
+        slot = _car_can_find(plans, frame->stdId);
+        for (i = 0; slot >= 0 && i < plans->count[slot]; i++) {
+            plan = &plans->plan[plans->first[slot] + i];
+
+            value = ((plan->big_endian ? be : le) >> plan->shift) & plan->mask;
+            svalue = (int64_t)value;
+            if (value & plan->sign_bit) {
+                svalue = -(int64_t)(value - plan->sign_bit);
             }
 
+            // printf("value = %lld\r\n", svalue);
+
+            if (plan->source == 0x03) {
+                gear = (svalue + plan->offset) * plan->factor;
+                if (gear == gOdoConfigurationStruct.gears[0]) {
+                    fwd = 1;
+                } else if (gear == gOdoConfigurationStruct.gears[1]) {
+                    fwd = 0;
+                } else if (gear == gOdoConfigurationStruct.gears[2]) {
+                    fwd = 1;
+                } else if (gear == gOdoConfigurationStruct.gears[3]) {
+                    fwd = 1;
+                }
+            } else {
+                speed[plan->source] = ((double)svalue + plan->bias) * plan->scale;
+                update |= 1 << plan->source;
+            }
         }
+        __DMB();
+    } while (gen != carCanGen);
+
+    if (fwd >= 0) {
+        wheel_speed.fwd = (uint8_t)fwd;
+    }
+    if (update & 1) {
+        wheel_speed.speed_RR = speed[0];
+    }
+    if (update & 2) {
+        wheel_speed.speed_RL = speed[1];
+    }
+    if (update & 4) {
+        wheel_speed.speed_combined = speed[2];
+    }
+    if (update) {
+        wheel_speed.update |= update;
+        wheel_speed.week = week;
+        wheel_speed.timestamp = timestamp;
+    }
+}
+
+/** ***************************************************************************
+ * @name car_can_rx_process() decode the frames queued by car_can_rx_isr()
+ * @brief called from the CAN task
+ * @param N/A
+ * @retval number of frames decoded
+ ******************************************************************************/
+uint32_t car_can_rx_process(void)
+{
+    uint32_t out = carCanRxOut;
+    uint32_t n = 0;
+
+    while (out != carCanRxIn) {
+        __DMB();
+        _car_can_frame_process(&carCanRxQueue[out & (CAR_CAN_RX_QUEUE_SIZE - 1)]);
+        out++;
+        carCanRxOut = out;
+        n++;
     }
+    return n;
+}
+
+/** ***************************************************************************
+ * @name car_can_rx_stat() odometry frame counters
+ * @param [out] rx frames received in normal mode
+ *              drop frames lost to a full queue
+ * @retval N/A
+ ******************************************************************************/
+void car_can_rx_stat(uint32_t *rx, uint32_t *drop)
+{
+    *rx = carCanRxCount;
+    *drop = carCanRxDrop;
+}
+
+/** ***************************************************************************
+ * @name car_can_data_process() decode a frame right away
+ * @brief stamps it with the current time, for callers outside the rx queue
+ * @param [in] stdId standard CAN ID
+ *             data 8 data bytes
+ * @retval N/A
+ ******************************************************************************/
+void car_can_data_process(uint32_t stdId, uint8_t* data)
+{
+    car_can_frame_t frame;
+
+    frame.stdId = stdId;
+    memcpy(frame.data, data, 8);
+    frame.time = now_gps();
+    _car_can_frame_process(&frame);
 }
 
 uint8_t car_get_wheel_speed(double *car_speed, uint8_t *fwd, uint32_t *week, double *timestamp)
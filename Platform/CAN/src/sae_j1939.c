@@ -34,6 +34,7 @@ struct sae_j1939_rx_desc ecu_rx_desc[SAE_J1939_MAX_RX_DESC];
 #define SAE_J1939_MAX_IDLE_TIME                    1000000    //ms
 
 static ACEINNA_ECU_ADDR ecu_pool[ACEINNA_ECU_ADDRESS_MAX];
+static uint32_t tx_seq = 0;
 
 
 /** ***************************************************************************
@@ -225,6 +226,7 @@ void sae_j1939_initialize(uint16_t baudRate, uint8_t address)
   gEcuInst.del_entry = del_ecu_mapping_table;
   gEcuInst.xmit = send_j1939_packet;
   
+  aceinna_j1939_tp_initialize();
 
   can_rtx_fun_config(aceinna_j1939_transmit_isr, aceinna_j1939_receive_isr);
 
@@ -269,11 +271,11 @@ void build_request_pkt(struct sae_j1939_tx_desc * req_desc)
 {
   req_desc->tx_pkt_type = SAE_J1939_REQUEST_PACKET;
   req_desc->tx_payload_len = SAE_J1939_REQUEST_LEN;
+  req_desc->tx_identifier.r = 0;
   req_desc->tx_identifier.control_bits.priority = SAE_J1939_REQUEST_PRIORITY;
   req_desc->tx_identifier.pdu_format = SAE_J1939_PDU_FORMAT_REQUEST;
   req_desc->tx_identifier.pdu_specific = SAE_J1939_PDU_FORMAT_GLOBAL;
   req_desc->tx_identifier.source = *(uint8_t *)gEcuInst.addr;
-  req_desc->tx_pkt_ready = DESC_OCCUPIED;
   
   return;
 }
@@ -308,7 +310,7 @@ void send_address_claim(ECU_INSTANCE *ecu)
     addr_claim_desc->tx_buffer.data[1] = addr_claim_pg.addr_claim_pg_pgn.pdu_format;
     addr_claim_desc->tx_buffer.data[2] = addr_claim_pg.addr_claim_pg_pgn.pdu_specific;
   } else { 
-      addr_claim_desc->tx_pkt_type = ACEINNA_J1939_ADDRESS_CLAIM;
+      addr_claim_desc->tx_pkt_type = (SAE_J1939_PACKET_TYPE)ACEINNA_J1939_ADDRESS_CLAIM;
       addr_claim_desc->tx_payload_len = SAE_J1939_PAYLOAD_MAX_LEN;
       addr_claim_desc->tx_identifier.r = 0;
       addr_claim_desc->tx_identifier.control_bits.priority = SAE_J1939_REQUEST_PRIORITY;
@@ -319,14 +321,7 @@ void send_address_claim(ECU_INSTANCE *ecu)
       memcpy((void *)addr_claim_desc->tx_buffer.data, (void *)(&(ecu->name->words)), SAE_J1939_PAYLOAD_MAX_LEN);
   }
   
-  addr_claim_desc->tx_buffer.tx_header.ExtId = ((addr_claim_desc->tx_identifier.r << 24) |
-                                      (addr_claim_desc->tx_identifier.pdu_format << 16) |
-                                      (addr_claim_desc->tx_identifier.pdu_specific << 8) |
-                                      (addr_claim_desc->tx_identifier.source));
-  addr_claim_desc->tx_buffer.tx_header.IDE = CAN_ID_EXT;
-  addr_claim_desc->tx_buffer.tx_header.RTR = CAN_RTR_DATA;
-  addr_claim_desc->tx_buffer.tx_header.DLC = addr_claim_desc->tx_payload_len;
-  addr_claim_desc->tx_pkt_ready  = DESC_OCCUPIED;
+  sae_j1939_queue_tx_desc(addr_claim_desc, 0);
   
   return;
 }
@@ -460,6 +455,55 @@ uint8_t find_tx_desc(struct sae_j1939_tx_desc **input)
 }
 
 
+/** ***************************************************************************
+ * @name sae_j1939_queue_tx_desc() hand a filled tx descriptor to the scheduler
+ * @brief builds the CAN header from the identifier and marks the descriptor
+ *        occupied, from then on the transmit interrupt may send it
+ *
+ * @param [in] desc, tx descriptor with identifier, length and payload set
+ *             lifetime, ms the packet stays useful, 0 never expires
+ * @retval N/A
+ ******************************************************************************/
+void sae_j1939_queue_tx_desc(struct sae_j1939_tx_desc *desc, uint16_t lifetime)
+{
+  desc->tx_buffer.tx_header.ExtId = ((desc->tx_identifier.r << 24) |
+                                     (desc->tx_identifier.pdu_format << 16) |
+                                     (desc->tx_identifier.pdu_specific << 8) |
+                                     (desc->tx_identifier.source));
+  desc->tx_buffer.tx_header.IDE = CAN_ID_EXT;
+  desc->tx_buffer.tx_header.RTR = CAN_RTR_DATA;
+  desc->tx_buffer.tx_header.DLC = desc->tx_payload_len;
+
+  desc->tx_lifetime = lifetime;
+  desc->tx_queued   = HAL_GetTick();
+  desc->tx_seq      = ++tx_seq;
+
+  // everything above has to land before the interrupt can see the desc
+  __DMB();
+  desc->tx_pkt_ready = DESC_OCCUPIED;
+}
+
+/** ***************************************************************************
+ * @name sae_j1939_pgn() parameter group number of an identifier
+ * @brief the PS only belongs to the PGN of PDU2 formats
+ *
+ * @param [in] ident, identifier
+ * @retval PGN
+ ******************************************************************************/
+uint32_t sae_j1939_pgn(SAE_J1939_IDENTIFIER_FIELD *ident)
+{
+  uint32_t pgn;
+
+  pgn = (ident->control_bits.ext_page << 17) |
+        (ident->control_bits.data_page << 16) |
+        (ident->pdu_format << 8);
+  if (ident->pdu_format >= SAE_J1939_PDU2_FORMAT_MIN)
+    pgn |= ident->pdu_specific;
+
+  return pgn;
+}
+
+
 /** ***************************************************************************
  * @name is_valid_pf() check pf is supported or not
  * @brief a general API of pf value checking
@@ -644,6 +688,7 @@ ACEINNA_J1939_PACKET_TYPE is_algorithm_data_packet(SAE_J1939_IDENTIFIER_FIELD *i
 //       ((ps_val == SAE_J1939_PDU_SPECIFIC_243))) {
 //        return ACEINNA_J1939_DATA;
 //   }
+  (void)ident;
 
   return ACEINNA_J1939_IGNORE;
 }
@@ -124,6 +124,8 @@ uint8_t aceinna_j1939_send_status_packet(uint8_t built_in_type, void * statusWor
 {
   	msg_params_t params;
 
+  	(void)built_in_type;
+
   	// build up the header of bit status
     params.data_page = 0;
   	params.ext_page = 0;
@@ -289,50 +291,146 @@ uint8_t aceinna_j1939_send_attitude(ATTITUDE_DATA * data)
 }
 
 /** ***************************************************************************
- * @name  aceinna_j1939_build_msg() data packet
- *        
- * @param [in] data, attitude data type
- * @retval 1 successful or 0 failure
- ******************************************************************************/    
-uint8_t aceinna_j1939_build_msg(void *payload, msg_params_t *params)
+ * @name  aceinna_j1939_queue_msg() queue a single frame packet
+ * @brief fills a free tx descriptor and hands it to the scheduler
+ *
+ * @param [in] payload, packet payload, params->len bytes
+ *             params, header of the packet
+ *             lifetime, ms the packet stays useful, 0 never expires
+ * @retval tx descriptor or NULL on failure
+ ******************************************************************************/
+struct sae_j1939_tx_desc *aceinna_j1939_queue_msg(void *payload, msg_params_t *params, uint16_t lifetime)
 {
   struct sae_j1939_tx_desc * desc;
+  SAE_J1939_IDENTIFIER_FIELD ident;
   
   // check state machine
   if (gEcu->state < _ECU_READY) 
-    return 0;
+    return NULL;
+  
+  ident.r                     = 0;
+  ident.control_bits.priority = params->priority;
+  ident.control_bits.data_page = params->data_page;
+  ident.control_bits.ext_page  = params->ext_page;
+  ident.pdu_format            = params->PF;
+  ident.pdu_specific          = params->PS;
+  ident.source                = *(uint8_t *)gEcu->addr;
   
   // get tx desc
-  if (find_tx_desc(&desc) == 0)
-    return 0;
+  if (find_tx_desc(&desc) == 0) {
+    aceinna_j1939_tx_account(sae_j1939_pgn(&ident), SAE_J1939_TX_OVERFLOW, 0);
+    return NULL;
+  }
   
-  // header of acceleration packet
-  desc->tx_pkt_type                         = params->pkt_type;
-  desc->tx_identifier.control_bits.priority = params->priority;
-  desc->tx_identifier.control_bits.data_page = params->data_page;
-  desc->tx_identifier.control_bits.ext_page  = params->ext_page;
-  desc->tx_identifier.pdu_format            = params->PF;
-  desc->tx_identifier.pdu_specific          = params->PS;
-  desc->tx_payload_len                      = params->len;
-  desc->tx_identifier.source                = *(uint8_t *)gEcu->addr;
-  
-  desc->tx_buffer.tx_header.ExtId = ((desc->tx_identifier.r << 24) |
-                                        (desc->tx_identifier.pdu_format << 16) |
-                                        (desc->tx_identifier.pdu_specific << 8) |
-                                        (desc->tx_identifier.source));
-  desc->tx_buffer.tx_header.IDE = CAN_ID_EXT;
-  desc->tx_buffer.tx_header.RTR = CAN_RTR_DATA;
-  desc->tx_buffer.tx_header.DLC = desc->tx_payload_len;
-  
-  // payload of position packet
+  desc->tx_pkt_type    = params->pkt_type;
+  desc->tx_identifier  = ident;
+  desc->tx_payload_len = params->len;
   memcpy((void *)desc->tx_buffer.data, (void *)payload, desc->tx_payload_len);
-  desc->tx_pkt_ready  = DESC_OCCUPIED;
   
-  return 1;
+  sae_j1939_queue_tx_desc(desc, lifetime);
+  
+  return desc;
 }
 
+/** ***************************************************************************
+ * @name  aceinna_j1939_build_msg() data packet
+ * @brief data packets expire once the next set is due, the others never
+ *        
+ * @param [in] data, attitude data type
+ * @retval 1 successful or 0 failure
+ ******************************************************************************/    
+uint8_t aceinna_j1939_build_msg(void *payload, msg_params_t *params)
+{
+  uint16_t lifetime = 0;
+  
+  if (params->pkt_type == SAE_J1939_DATA_PACKET) {
+    lifetime = SAE_J1939_TASK_PERIOD_MS;
+    if (gEcuConfig.packet_rate > 1)
+      lifetime *= gEcuConfig.packet_rate;
+  }
+  
+  return aceinna_j1939_queue_msg(payload, params, lifetime) != NULL;
+}
 
 
+static SAE_J1939_PGN_STAT tx_stat[SAE_J1939_MAX_PGN_STAT];
+static uint8_t tx_stat_num = 0;
+
+/** ***************************************************************************
+ * @name  aceinna_j1939_tx_account() count a transmit event of a PGN
+ * @brief called from the task and the transmit interrupt, PGNs past the
+ *        first SAE_J1939_MAX_PGN_STAT are not counted
+ *
+ * @param [in] pgn, parameter group number
+ *             event, sent, overflow or expired
+ *             latency, ms from queued to sent
+ * @retval N/A
+ ******************************************************************************/
+void aceinna_j1939_tx_account(uint32_t pgn, SAE_J1939_TX_EVENT event, uint32_t latency)
+{
+  SAE_J1939_PGN_STAT *stat = NULL;
+  uint32_t primask;
+  uint8_t i;
+  
+  primask = __get_PRIMASK();
+  __disable_irq();
+  
+  for (i = 0; i < tx_stat_num; i++) {
+    if (tx_stat[i].pgn == pgn) {
+      stat = &tx_stat[i];
+      break;
+    }
+  }
+  if ((stat == NULL) && (tx_stat_num < SAE_J1939_MAX_PGN_STAT)) {
+    stat = &tx_stat[tx_stat_num++];
+    memset(stat, 0, sizeof(SAE_J1939_PGN_STAT));
+    stat->pgn = pgn;
+  }
+  
+  if (stat != NULL) {
+    switch (event) {
+    case SAE_J1939_TX_SENT:
+      stat->sent++;
+      stat->latency_sum += latency;
+      if (latency > stat->latency_max)
+        stat->latency_max = latency > 0xffff ? 0xffff : latency;
+      break;
+    case SAE_J1939_TX_OVERFLOW:
+      stat->overflow++;
+      break;
+    default:
+      stat->expired++;
+      break;
+    }
+  }
+  
+  __set_PRIMASK(primask);
+}
+
+/** ***************************************************************************
+ * @name  aceinna_j1939_tx_stat() transmit statistics
+ * @brief PGNs are numbered in the order they were first seen
+ *
+ * @param [in] index, 0 to the number of PGNs seen
+ *             stat, copy of the statistics
+ * @retval 1 successful or 0 no such PGN
+ ******************************************************************************/
+uint8_t aceinna_j1939_tx_stat(uint8_t index, SAE_J1939_PGN_STAT *stat)
+{
+  uint32_t primask;
+  uint8_t result = 0;
+  
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (index < tx_stat_num) {
+    *stat = tx_stat[index];
+    result = 1;
+  }
+  __set_PRIMASK(primask);
+  
+  return result;
+}
+
 
 
 /** ***************************************************************************
@@ -422,31 +520,142 @@ void process_config_set(struct sae_j1939_rx_desc *desc)
   process_ecu_commands(command, ps_val, ident->source);
 }
 
-void ecu_transmit()
+/** ***************************************************************************
+ * @name  _tx_desc_before() scheduling order of two queued packets
+ * @brief higher priority first, then the earlier deadline, then queue order
+ *
+ * @param [in] a, b, occupied tx descriptors
+ * @retval 1 if a goes out before b
+ ******************************************************************************/
+static uint8_t _tx_desc_before(struct sae_j1939_tx_desc *a, struct sae_j1939_tx_desc *b)
 {
-  struct sae_j1939_tx_desc *tx_desc;
-  uint8_t result;
+  int32_t diff;
+  
+  if (a->tx_identifier.control_bits.priority != b->tx_identifier.control_bits.priority)
+    return a->tx_identifier.control_bits.priority < b->tx_identifier.control_bits.priority;
+  
+  diff = (int32_t)((a->tx_queued + a->tx_lifetime) - (b->tx_queued + b->tx_lifetime));
+  if (diff != 0)
+    return diff < 0;
+  
+  return (int32_t)(a->tx_seq - b->tx_seq) < 0;
+}
 
-  // place outgoing message into queue
-  tx_desc = gEcu->curr_tx_desc;
+/** ***************************************************************************
+ * @name  _tx_desc_claim() take a queued packet away from the other contexts
+ * @brief the expiry of the BAM transport and a reused desc are ruled out by
+ *        the state and the sequence number the scan saw
+ *
+ * @param [in] desc, tx descriptor
+ *             seq, sequence number at the scan
+ *             state, DESC_PENDING to send it, DESC_IDLE to drop it
+ * @retval 1 if the desc was still that packet and is now in state
+ ******************************************************************************/
+static uint8_t _tx_desc_claim(struct sae_j1939_tx_desc *desc, uint32_t seq, DESC_STATE state)
+{
+  uint32_t primask;
+  uint8_t result = 0;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if ((desc->tx_pkt_ready == DESC_OCCUPIED) && (desc->tx_seq == seq)) {
+    desc->tx_pkt_ready = state;
+    result = 1;
+  }
+  __set_PRIMASK(primask);
 
-  while (tx_desc->next != gEcu->curr_tx_desc) 
-  {
-    if (tx_desc->tx_pkt_ready == DESC_IDLE) {
-      tx_desc = tx_desc->next;
-      continue;
-    }
-    result = gEcu->xmit(tx_desc);
-    if (result != FALSE) {
-      tx_desc->tx_pkt_ready = DESC_IDLE;
+  return result;
+}
+
+/** ***************************************************************************
+ * @name  _ecu_transmit_run() one pass of the tx scheduler
+ * @brief the scan, the mailbox writes and the accounting run with the
+ *        interrupts on, only the claim of a desc masks them
+ *
+ * @param [in]
+ * @retval N/A
+ ******************************************************************************/
+static void _ecu_transmit_run(void)
+{
+  struct sae_j1939_tx_desc *tx_desc, *best;
+  uint32_t now, seq;
+
+  now = HAL_GetTick();
+
+  for (;;) {
+    best = NULL;
+    tx_desc = gEcu->curr_tx_desc;
+    do {
+      if (tx_desc->tx_pkt_ready == DESC_OCCUPIED) {
+        if (tx_desc->tx_lifetime && ((now - tx_desc->tx_queued) > tx_desc->tx_lifetime)) {
+          if (_tx_desc_claim(tx_desc, tx_desc->tx_seq, DESC_IDLE))
+            aceinna_j1939_tx_account(sae_j1939_pgn(&tx_desc->tx_identifier), SAE_J1939_TX_EXPIRED, 0);
+        } else if ((best == NULL) || _tx_desc_before(tx_desc, best)) {
+          best = tx_desc;
+        }
+      }
       tx_desc = tx_desc->next;
+    } while (tx_desc != gEcu->curr_tx_desc);
+
+    if (best == NULL)
+      break;
+    seq = best->tx_seq;
+    if (!_tx_desc_claim(best, seq, DESC_PENDING))
       continue;
+
+    // all mailboxes busy, the mailbox complete interrupt comes back here
+    if (gEcu->xmit(best) == FALSE) {
+      best->tx_pkt_ready = DESC_OCCUPIED;
+      break;
     }
-    // always end up on busy unsent descriptor
-    gEcu->curr_tx_desc = tx_desc; 
-    return;
+
+    aceinna_j1939_tx_account(sae_j1939_pgn(&best->tx_identifier), SAE_J1939_TX_SENT, now - best->tx_queued);
+    best->tx_pkt_ready = DESC_IDLE;
   }
+}
+
+static volatile uint8_t tx_running = 0;   // a context is in _ecu_transmit_run()
+static volatile uint8_t tx_again   = 0;   // a mailbox freed up meanwhile
 
+/** ***************************************************************************
+ * @name  ecu_transmit() tx scheduler
+ * @brief fills every free mailbox with the most urgent queued packet and
+ *        drops the stale ones. Runs in the CAN task and from the mailbox
+ *        complete interrupt, so the mailboxes are refilled as soon as one
+ *        frees up instead of once per task period. One context schedules at
+ *        a time: an interrupt that finds the task scheduling leaves it
+ *        another pass instead of writing the mailboxes under it
+ *
+ * @param [in]
+ * @retval N/A
+ ******************************************************************************/
+void ecu_transmit(void)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (tx_running) {
+    tx_again = 1;
+    __set_PRIMASK(primask);
+    return;
+  }
+  tx_running = 1;
+  __set_PRIMASK(primask);
+
+  for (;;) {
+    tx_again = 0;
+    _ecu_transmit_run();
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    if (!tx_again) {
+      tx_running = 0;
+      __set_PRIMASK(primask);
+      break;
+    }
+    __set_PRIMASK(primask);
+  }
 }
 
 /** ***************************************************************************
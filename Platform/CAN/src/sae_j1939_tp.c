@@ -0,0 +1,205 @@
+/** ***************************************************************************
+ * @file sae_j1939_tp.c J1939-21 transport protocol, broadcast (BAM) sender
+ * @Author
+ * @date   Oct 2026
+ * @brief  Copyright (c) 2026 All Rights Reserved.
+ *
+ * THIS CODE AND INFORMATION ARE PROVIDED "AS IS" WITHOUT WARRANTY OF ANY
+ * KIND, EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A
+ * PARTICULAR PURPOSE.
+ *
+ *****************************************************************************/
+#include <string.h>
+#include "can.h"
+#include "sae_j1939.h"
+
+// one BAM session at a time, as J1939-21 allows per source address
+static struct {
+  uint8_t  active;
+  uint8_t  packets;                         // TP.DT packets of the message
+  uint8_t  next;                            // sequence number of the next TP.DT
+  uint8_t  priority;
+  uint16_t len;
+  uint32_t pgn;                             // PGN of the message carried
+  uint32_t start;                           // ms, message handed over
+  uint32_t last;                            // ms, last frame queued or sent
+  uint32_t seq;                             // tx_seq of the frame in flight
+  struct sae_j1939_tx_desc *desc;           // frame in flight, NULL none
+  uint8_t  data[SAE_J1939_TP_BUF_LEN];
+} tp_bam;
+
+
+/** ***************************************************************************
+ * @name  _tp_queue() queue one TP.CM or TP.DT frame
+ * @brief TP frames never expire in the scheduler, the session times them out
+ *
+ * @param [in] pf, SAE_J1939_PDU_FORMAT_TP_CM or SAE_J1939_PDU_FORMAT_TP_DT
+ *             frame, 8 bytes
+ * @retval 1 successful or 0 failure
+ ******************************************************************************/
+static uint8_t _tp_queue(uint8_t pf, uint8_t *frame)
+{
+  msg_params_t params;
+  struct sae_j1939_tx_desc *desc;
+
+  params.data_page = 0;
+  params.ext_page  = 0;
+  params.pkt_type  = SAE_J1939_DATA_PACKET;
+  params.priority  = tp_bam.priority;
+  params.PF        = pf;
+  params.PS        = SAE_J1939_PDU_FORMAT_GLOBAL;
+  params.len       = SAE_J1939_PAYLOAD_LEN_8_BYTES;
+
+  desc = aceinna_j1939_queue_msg((void *)frame, &params, 0);
+  if (desc == NULL)
+    return 0;
+
+  tp_bam.desc = desc;
+  tp_bam.seq  = desc->tx_seq;
+  tp_bam.last = HAL_GetTick();
+
+  return 1;
+}
+
+/** ***************************************************************************
+ * @name  aceinna_j1939_tp_initialize() drop any BAM session
+ * @brief called when the tx descriptors are reset
+ *
+ * @param [in]
+ * @retval N/A
+ ******************************************************************************/
+void aceinna_j1939_tp_initialize(void)
+{
+  memset(&tp_bam, 0, sizeof(tp_bam));
+}
+
+/** ***************************************************************************
+ * @name  aceinna_j1939_send_bam() broadcast a packet of any length
+ * @brief packets up to 8 bytes go out as they are, longer ones are announced
+ *        with TP.CM BAM and sent in TP.DT packets by aceinna_j1939_tp_process()
+ *
+ * @param [in] payload, len bytes
+ *             len, up to SAE_J1939_TP_BUF_LEN
+ *             params, header of the packet, len is not used
+ * @retval 1 successful or 0 failure, a BAM is still in progress
+ ******************************************************************************/
+uint8_t aceinna_j1939_send_bam(void *payload, uint16_t len, msg_params_t *params)
+{
+  SAE_J1939_IDENTIFIER_FIELD ident;
+  uint8_t frame[8];
+  uint32_t pgn;
+
+  if (len <= SAE_J1939_PAYLOAD_MAX_LEN) {
+    params->len = len;
+    return aceinna_j1939_build_msg(payload, params);
+  }
+
+  ident.r                      = 0;
+  ident.control_bits.data_page = params->data_page;
+  ident.control_bits.ext_page  = params->ext_page;
+  ident.pdu_format             = params->PF;
+  ident.pdu_specific           = params->PS;
+  pgn = sae_j1939_pgn(&ident);
+
+  if ((len > SAE_J1939_TP_BUF_LEN) || (len > SAE_J1939_TP_MAX_LEN))
+    return 0;
+
+  if (tp_bam.active) {
+    aceinna_j1939_tx_account(pgn, SAE_J1939_TX_OVERFLOW, 0);
+    return 0;
+  }
+
+  memcpy(tp_bam.data, payload, len);
+  tp_bam.len      = len;
+  tp_bam.packets  = (len + 6) / 7;
+  tp_bam.next     = 1;
+  tp_bam.pgn      = pgn;
+  tp_bam.priority = SAE_J1939_TP_PRIORITY;
+
+  frame[0] = SAE_J1939_TP_CM_BAM;
+  frame[1] = len & 0xff;
+  frame[2] = (len >> 8) & 0xff;
+  frame[3] = tp_bam.packets;
+  frame[4] = 0xff;
+  frame[5] = pgn & 0xff;
+  frame[6] = (pgn >> 8) & 0xff;
+  frame[7] = (pgn >> 16) & 0xff;
+
+  if (!_tp_queue(SAE_J1939_PDU_FORMAT_TP_CM, frame)) {
+    aceinna_j1939_tx_account(pgn, SAE_J1939_TX_OVERFLOW, 0);
+    return 0;
+  }
+
+  tp_bam.start  = tp_bam.last;
+  tp_bam.active = 1;
+
+  return 1;
+}
+
+/** ***************************************************************************
+ * @name  aceinna_j1939_tp_process() paces the TP.DT packets of a BAM
+ * @brief called every task period, queues the next packet once the last one
+ *        is out and SAE_J1939_TP_BAM_GAP has passed. The whole message is
+ *        counted as one packet of its own PGN, latency up to the last TP.DT
+ *
+ * @param [in]
+ * @retval N/A
+ ******************************************************************************/
+void aceinna_j1939_tp_process(void)
+{
+  uint8_t frame[8];
+  uint16_t offset, n;
+  uint32_t now, primask;
+
+  if (!tp_bam.active)
+    return;
+
+  now = HAL_GetTick();
+
+  if (tp_bam.desc != NULL) {
+    // a reused desc has a newer seq, so the frame is gone either way
+    if ((tp_bam.desc->tx_seq == tp_bam.seq) && (tp_bam.desc->tx_pkt_ready != DESC_IDLE)) {
+      if ((now - tp_bam.last) <= SAE_J1939_TP_TIMEOUT)
+        return;
+
+      // receivers have given up on the message by now, so do we
+      primask = __get_PRIMASK();
+      __disable_irq();
+      if ((tp_bam.desc->tx_seq == tp_bam.seq) && (tp_bam.desc->tx_pkt_ready == DESC_OCCUPIED))
+        tp_bam.desc->tx_pkt_ready = DESC_IDLE;
+      __set_PRIMASK(primask);
+
+      aceinna_j1939_tx_account(tp_bam.pgn, SAE_J1939_TX_EXPIRED, 0);
+      tp_bam.active = 0;
+      tp_bam.desc   = NULL;
+      return;
+    }
+
+    tp_bam.desc = NULL;
+    tp_bam.last = now;
+
+    if (tp_bam.next > tp_bam.packets) {
+      aceinna_j1939_tx_account(tp_bam.pgn, SAE_J1939_TX_SENT, now - tp_bam.start);
+      tp_bam.active = 0;
+      return;
+    }
+  }
+
+  if ((now - tp_bam.last) < SAE_J1939_TP_BAM_GAP)
+    return;
+
+  // sequence number, 7 bytes of data, the last packet padded with 0xff
+  offset = (tp_bam.next - 1) * 7;
+  n = tp_bam.len - offset;
+  if (n > 7)
+    n = 7;
+
+  frame[0] = tp_bam.next;
+  memcpy(&frame[1], &tp_bam.data[offset], n);
+  memset(&frame[1 + n], 0xff, 7 - n);
+
+  // no free desc, try again next period
+  if (_tp_queue(SAE_J1939_PDU_FORMAT_TP_DT, frame))
+    tp_bam.next++;
+}
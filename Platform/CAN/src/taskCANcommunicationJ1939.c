@@ -24,6 +24,7 @@
 #include "user_config.h"
 
 #include "car_data.h"
+#include "task_prof.h"
    
 #define ADDRESS_CLAIM_RETRY                 5
 
@@ -52,7 +53,11 @@ void TaskCANCommunicationJ1939(void const *argument)
 
             while (1)
             {
-                OS_Delay(1000);
+                // odometry frames are queued by the rx interrupt and
+                // decoded here, semaphore given at 100Hz
+                osSemaphoreWait(g_sem_can_data, 1000);
+                car_can_rx_process();
+                TASK_PROF_DONE(TASK_PROF_CAN);
                 if (gOdoConfigurationStruct.can_mode != 0) {
                     break;
                 }
@@ -115,7 +120,11 @@ void TaskCANCommunicationJ1939(void const *argument)
                     enqeue_periodic_packets();
                 }
                 
+                // pace multi-packet broadcasts, then fill the mailboxes,
+                // the mailbox complete interrupt keeps them filled
+                aceinna_j1939_tp_process();
                 ecu_transmit(); 
+                TASK_PROF_DONE(TASK_PROF_CAN);
                 
                 if (gOdoConfigurationStruct.can_mode != 1) {
                     break;
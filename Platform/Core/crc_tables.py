@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""
+Generate src/crc_tables.h, the const lookup tables of src/crc.c.
+
+    python3 crc_tables.py [-o src/crc_tables.h] [--check]
+
+Every crc gets T0..T7, 256 entries each. T0 is the byte-wise table, T1..T7
+the slice-by-N tables, T(k)[i] = (T(k-1)[i] << 8) ^ T0[T(k-1)[i] >> (width - 8)].
+The header only compiles the tables CRC_SLICE_BY asks for, so the image
+carries 1, 4 or 8 KB per crc and nothing is built in RAM at run time.
+
+The crcs are MSB first without reflection or final xor, see CrcUpdate().
+
+--check compares with the output file instead of writing it, the host build
+runs it as a test so a table edit without a new header fails.
+"""
+
+import argparse
+import os
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+# C name, width, polynomial (MSB first, implicit top bit)
+CRCS = (
+    ("crcCcittTable", 16, 0x1021),
+    ("crc32Table", 32, 0xEDB88320),
+    ("crc24qTable", 24, 0x864CFB),
+)
+SLICES = 8
+
+
+def byte_table(width, poly):
+    mask = (1 << width) - 1
+    top = 1 << (width - 1)
+    table = []
+    for i in range(256):
+        crc = i << (width - 8)
+        for _ in range(8):
+            crc = ((crc << 1) ^ poly) if crc & top else (crc << 1)
+        table.append(crc & mask)
+    return table
+
+
+def slice_tables(width, poly):
+    mask = (1 << width) - 1
+    tables = [byte_table(width, poly)]
+    for _ in range(1, SLICES):
+        prev = tables[-1]
+        tables.append([((v << 8) & mask) ^ tables[0][v >> (width - 8)] for v in prev])
+    return tables
+
+
+def emit_table(rows, digits):
+    lines = []
+    for i in range(0, 256, 8):
+        lines.append("\t\t" + ", ".join("0x%0*X" % (digits, v) for v in rows[i:i + 8]) + ",")
+    return lines
+
+
+def emit_crc(name, width, poly):
+    digits = width // 4
+    tables = slice_tables(width, poly)
+    out = ["/// %d bit, poly 0x%0*X" % (width, digits, poly),
+           "static const uint32_t %s[CRC_SLICE_BY][256] = {" % name]
+    for k, rows in enumerate(tables):
+        if k == 1:
+            out.append("#if CRC_SLICE_BY > 1")
+        elif k == 4:
+            out.append("#endif")
+            out.append("#if CRC_SLICE_BY > 4")
+        out.append("\t{")
+        out += emit_table(rows, digits)
+        out.append("\t},")
+    out.append("#endif")
+    out.append("};")
+    return out
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("-o", "--output", default=os.path.join(HERE, "src/crc_tables.h"))
+    ap.add_argument("--check", action="store_true", help="compare with the output, do not write")
+    args = ap.parse_args()
+
+    text = ["#ifndef CRC_TABLES_H",
+            "#define CRC_TABLES_H",
+            "",
+            "/* generated by crc_tables.py, edit the script instead */",
+            "",
+            "#include <stdint.h>",
+            "#include \"crc.h\"",
+            "",
+            "#if CRC_SLICE_BY != 1 && CRC_SLICE_BY != 4 && CRC_SLICE_BY != 8",
+            "#error CRC_SLICE_BY must be 1, 4 or 8",
+            "#endif",
+            ""]
+    for crc in CRCS:
+        text += emit_crc(*crc)
+        text.append("")
+    text += ["#endif", ""]
+    text = "\n".join(text)
+
+    if args.check:
+        with open(args.output) as f:
+            if f.read() != text:
+                sys.exit("%s is out of date, run crc_tables.py" % args.output)
+        return
+    with open(args.output, "w", newline="\n") as f:
+        f.write(text)
+
+
+if __name__ == "__main__":
+    main()
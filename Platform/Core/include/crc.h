@@ -12,12 +12,20 @@
 
 typedef uint16_t CrcCcittType;
 typedef uint32_t Crc32Type;
+typedef uint32_t Crc24qType;
+
+/// table variant: 1 = byte-wise table, 4/8 = slice-by-4/8 (N KB of const
+/// tables per crc type, generated by crc_tables.py)
+#ifndef CRC_SLICE_BY
+#define CRC_SLICE_BY            4
+#endif
  
 #define CRC_CCITT_LENGTH	2
 #define CRC_32_LENGTH       4
  
 #define CRC_CCITT_INITIAL_SEED	0x1d0f
 #define CRC_32_INITIAL_SEED		0xffffffff 
+#define CRC_24Q_INITIAL_SEED	0x000000
 
 extern CrcCcittType CrcCcitt			(const uint8_t data [], uint16_t length, const CrcCcittType seed);
 extern Crc32Type    Crc32				(const uint8_t data [], uint16_t length, const Crc32Type seed); 
@@ -27,5 +35,11 @@ extern void         Crc32TypeToBytes    (Crc32Type type, uint8_t bytes []);
 extern Crc32Type    BytesToCrc32Type    (const uint8_t bytes []);
 uint16_t            initCRC_16bit       (uint16_t  v, uint16_t seed);
 
+/// streaming update: pass the initial seed for the first chunk and the
+/// previous result for each following chunk
+extern CrcCcittType CrcCcittUpdate      (CrcCcittType crc, const uint8_t data [], uint32_t length);
+extern Crc32Type    Crc32Update         (Crc32Type crc, const uint8_t data [], uint32_t length);
+extern Crc24qType   Crc24qUpdate        (Crc24qType crc, const uint8_t data [], uint32_t length);
+
 #endif
 
@@ -32,6 +32,8 @@ limitations under the License.
 #include "constants.h"
 #include "ucb_packet.h"
 
+#define UCB_PORT_FRAME  0xFF    ///< HandleUcbTx() builds the packet and sends it nowhere
+
 extern BOOL     HandleUcbRx (UcbPacketStruct *ptrUcbPacket);
 extern void     HandleUcbTx (int port, UcbPacketStruct *ptrUcbPacket);
 
@@ -17,6 +17,7 @@
 #ifndef UCB_PACKET_H
 #define UCB_PACKET_H
 
+#include <stdint.h>
 #include "stdio.h"
 #include "constants.h"
 
@@ -31,6 +32,8 @@
 
 
 #define UCB_MAX_PAYLOAD_LENGTH		255
+#define UCB_MAX_PACKET_LENGTH       (UCB_SYNC_LENGTH + UCB_PACKET_TYPE_LENGTH + UCB_PAYLOAD_LENGTH_LENGTH + \
+                                     UCB_MAX_PAYLOAD_LENGTH + UCB_CRC_LENGTH)
 #define UCB_USER_IN                 200         
 #define UCB_USER_OUT                201      
 #define UCB_ERROR_INVALID_TYPE      202     
@@ -46,6 +49,21 @@ typedef struct {
     uint8_t         packetCode[2];
 }usr_packet_t;
 
+#define UCB_CODE_INDEX_BITS         6
+#define UCB_CODE_INDEX_SIZE         (1 << UCB_CODE_INDEX_BITS)
+
+typedef struct {
+    uint16_t        code;           // 0: empty slot
+    uint8_t         type;
+}ucb_code_slot_t;
+
+/// packet code -> type perfect hash of a packet code table, generated by
+/// Core/ucb_code_tables.py into src/ucb_code_tables.h
+typedef struct {
+    uint16_t        mult;           // hash multiplier, every code has a slot of its own
+    ucb_code_slot_t slot[UCB_CODE_INDEX_SIZE];
+}ucb_code_index_t;
+
 
 typedef struct {
      uint8_t       packetType;      // 0
@@ -93,6 +111,7 @@ typedef enum
     UCB_FACTORY_1,          // 25 F1 0x4631
     UCB_FACTORY_2,          // 26 F2 0x4632
     UCB_FACTORY_M,          // 27 F3 0x464D
+    UCB_NET_STATS,          // 28 NS 0x4E53
 //**************************************************
     UCB_PKT_NONE,           // 27   marker after last valid packet 
     UCB_NAK,                // 28
@@ -109,12 +128,14 @@ typedef enum
 #define UCB_FACTORY_1_LENGTH 54
 #define UCB_FACTORY_2_LENGTH 66
 #define UCB_FACTORY_M_LENGTH 85
+#define UCB_NET_STATS_LENGTH 110
 
 
 /// UCB packet-specific utility functions ucb_packet.c
 extern UcbPacketType     UcbPacketBytesToPacketType    (const uint8_t bytes []);
 extern BOOL              UcbPacketPacketTypeToBytes    (UcbPacketType type, uint8_t bytes []);
 extern BOOL UcbPacketIsAnInputPacket(UcbPacketType type);
+extern int  UcbCodeIndexFind(const ucb_code_index_t *index, uint16_t code);
 extern BOOL UcbPacketIsAnOutputPacket(UcbPacketType type);
 
 // send_packet.c
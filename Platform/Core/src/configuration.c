@@ -331,14 +331,18 @@ uint32_t GetFilterCounts(uint32_t type)
     switch(type){
         case IIR_02HZ_LPF:
             return 26785;
+        case FIR_05HZ_LPF:  // the iir of the same cutoff
         case IIR_05HZ_LPF:
             return 10713;
+        case FIR_10HZ_LPF:
         case IIR_10HZ_LPF:
             return 5356;
+        case FIR_20HZ_LPF:
         case IIR_20HZ_LPF:
             return 2678;
         case IIR_25HZ_LPF:
             return 2142;
+        case FIR_40HZ_LPF:
         case IIR_40HZ_LPF:
             return 1338;
         case UNFILTERED:
@@ -369,6 +373,18 @@ BOOL configSelectUserLPFilter(int sensor, int cutoffFreq, BOOL fApply)
     int  type;
 
     switch(cutoffFreq){
+        case USER_LPF_FIR | 5:
+            type = FIR_05HZ_LPF;
+            break;
+        case USER_LPF_FIR | 10:
+            type = FIR_10HZ_LPF;
+            break;
+        case USER_LPF_FIR | 20:
+            type = FIR_20HZ_LPF;
+            break;
+        case USER_LPF_FIR | 40:
+            type = FIR_40HZ_LPF;
+            break;
         case 0:
             type = UNFILTERED;
             break;
@@ -403,6 +419,15 @@ BOOL configSelectUserLPFilter(int sensor, int cutoffFreq, BOOL fApply)
     }
 
     gConfiguration.analogFilterClocks[sensor] = GetFilterCounts(type);
+
+    // libSensors' CalibrateFilter runs the Bartlett fir instead of the
+    // Butterworth iir when this type is a fir one. It is one type for all the
+    // sensors, the last selection sets it.
+    if (type >= FIR_40HZ_LPF && type <= FIR_05HZ_LPF) {
+        spiFilterType = type;
+    } else if (spiFilterType >= FIR_40HZ_LPF && spiFilterType <= FIR_05HZ_LPF) {
+        spiFilterType = UNFILTERED;
+    }
    
     return TRUE;
 }
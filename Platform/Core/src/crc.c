@@ -11,6 +11,7 @@
  *
  *****************************************************************************/
 #include "crc.h"
+#include "crc_tables.h"
 
 #define BITS_PER_BYTE	8
 
@@ -23,75 +24,109 @@
 #define BYTE_2	0x00ff0000
 #define BYTE_3	0xff000000
 
-#define	MSB		0x80
+#define CRC_CCITT_WIDTH	16
+#define CRC_32_WIDTH	32
+#define CRC_24Q_WIDTH	24
 
-static const uint8_t CRC_CCITT_POLY [] = { 0x10, 0x21 };
-static const uint8_t CRC_32_POLY []    = { 0xed, 0xb8, 0x83, 0x20 };
+/// big-endian 32 bit load, no alignment requirement
+#define LOAD_BE32(p)	(((uint32_t)(p)[0] << THREE_BYTES) | ((uint32_t)(p)[1] << TWO_BYTES) | \
+						 ((uint32_t)(p)[2] << ONE_BYTE)    |  (uint32_t)(p)[3])
 
 /** ****************************************************************************
- * @name Crc perform crc calculation on the input data
- * @brief
-*
-* Input parameters:
-*
-* @param [out] crc - the calulated value
-* @retval N/A
-********************************************************************************/
-static void Crc (const uint8_t poly [],
-                 uint8_t       polyLength,
-                 const uint8_t seed [],
-                 const uint8_t data [],
-                 uint16_t      dataLength,
-                 uint8_t       crc [])
+ * @name CrcUpdate perform table-driven crc calculation on the input data
+ * @brief MSB-first (non-reflected) crc without final xor, so a running crc
+ *        is continued by passing the previous result back in as crc.
+ * @param [in] table - T0 byte-wise table, T1..T(N-1) slice-by-N tables
+ * @param [in] width - crc width in bits (8..32)
+ * @param [in] crc - seed or running crc
+ * @param [in] data - pointer to the input data
+ * @param [in] length - of the input data
+ * @retval updated crc
+ ******************************************************************************/
+static uint32_t CrcUpdate (const uint32_t table [][256],
+                           uint8_t        width,
+                           uint32_t       crc,
+                           const uint8_t  data [],
+                           uint32_t       length)
 {
-	uint16_t dataIndex;
-	uint8_t  crcIndex;
-	uint8_t  bitCount;
-
-	/// load seed
-	for (crcIndex = 0; crcIndex < polyLength; ++crcIndex) {
-		crc[crcIndex] = seed[crcIndex];
+	uint32_t mask = (width == 32) ? 0xffffffff : ((1u << width) - 1);
+	uint8_t  top  = width - BITS_PER_BYTE;
+
+#if CRC_SLICE_BY > 1
+	uint32_t x;
+#if CRC_SLICE_BY == 8
+	uint32_t y;
+#endif
+
+	/// the crc register is aligned to the first data byte of the block
+	while (length >= CRC_SLICE_BY) {
+		x = (crc << (32 - width)) ^ LOAD_BE32(data);
+#if CRC_SLICE_BY == 8
+		y = LOAD_BE32(data + 4);
+		crc = table[7][x >> THREE_BYTES] ^ table[6][(x >> TWO_BYTES) & BYTE_0] ^
+		      table[5][(x >> ONE_BYTE) & BYTE_0] ^ table[4][x & BYTE_0] ^
+		      table[3][y >> THREE_BYTES] ^ table[2][(y >> TWO_BYTES) & BYTE_0] ^
+		      table[1][(y >> ONE_BYTE) & BYTE_0] ^ table[0][y & BYTE_0];
+#else
+		crc = table[3][x >> THREE_BYTES] ^ table[2][(x >> TWO_BYTES) & BYTE_0] ^
+		      table[1][(x >> ONE_BYTE) & BYTE_0] ^ table[0][x & BYTE_0];
+#endif
+		data   += CRC_SLICE_BY;
+		length -= CRC_SLICE_BY;
 	}
+#endif
 
-	/// step through all bytes of data
-	for (dataIndex = 0; dataIndex < dataLength; ++dataIndex) {
-		/// next data byte is XORed into the most-significant byte of the CRC
-		crc[0] ^= data[dataIndex];
-
-		/// index through all bits of current data byte
-		for (bitCount = 0; bitCount < BITS_PER_BYTE; ++bitCount) {
-			/// top CRC bit = 1 -> apply poly to current CRC and shift CRC left
-			if ((crc[0] & MSB) != 0) {
-				/// left-shift bits in all bytes of CRC except for
-                /// least-significant byte
-				for (crcIndex = 0; crcIndex < (polyLength - 1); ++crcIndex) {
-					/// shift in MSB from next least-significant byte to LSB of
-                    /// current byte
-					crc[crcIndex] = ((uint8_t)((crc[crcIndex] << 1) & 0xff)) |
-                                    ((crc[crcIndex + 1] & MSB) >> (BITS_PER_BYTE - 1));
-
-					/// XOR poly with current CRC value
-					crc[crcIndex] ^= poly[crcIndex];
-				}
-
-				/// left-shift least-significant byte
-				crc[crcIndex] = (uint8_t)((crc[crcIndex] << 1) & 0xff);
-				crc[crcIndex] ^= poly[crcIndex]; /// poly XOR current CRC value
-			}
-			else {	/// top CRC bit = 0 -> shift CRC left only
-				/// left-shift bits in all bytes of CRC except for
-                /// least-significant byte
-				for (crcIndex = 0; crcIndex < (polyLength - 1); ++crcIndex) {
-					/// shift in MSB from next least-significant byte to LSB of
-                    /// current byte
-					crc[crcIndex] = ((uint8_t)((crc[crcIndex] << 1) & 0xff)) |
-                                    ((crc[crcIndex + 1] & MSB) >> (BITS_PER_BYTE - 1));
-				}
-				/// left-shift least-significant byte
-				crc[crcIndex] = (uint8_t)((crc[crcIndex] << 1) & 0xff);
-			}
-		}
+	/// remaining bytes one table lookup each
+	while (length--) {
+		crc = ((crc << BITS_PER_BYTE) & mask) ^ table[0][((crc >> top) ^ *data++) & BYTE_0];
 	}
+
+	return crc;
+}
+
+/** ****************************************************************************
+ * @name CrcCcittUpdate
+ * @brief continue a CRC-16-CCITT over the next chunk of data
+ * @param [in] crc - seed (CRC_CCITT_INITIAL_SEED) or result of the previous chunk
+ * @param [in] data - pointer to the input data
+ * @param [in] length - of the input data
+ * @retval updated crc
+ ******************************************************************************/
+CrcCcittType CrcCcittUpdate (CrcCcittType  crc,
+                             const uint8_t data[],
+                             uint32_t      length)
+{
+	return (CrcCcittType)CrcUpdate(crcCcittTable, CRC_CCITT_WIDTH, crc, data, length);
+}
+
+/** ****************************************************************************
+ * @name Crc32Update
+ * @brief continue a CRC-32 over the next chunk of data
+ * @param [in] crc - seed (CRC_32_INITIAL_SEED) or result of the previous chunk
+ * @param [in] data - pointer to the input data
+ * @param [in] length - of the input data
+ * @retval updated crc
+ ******************************************************************************/
+Crc32Type Crc32Update (Crc32Type     crc,
+                       const uint8_t data[],
+                       uint32_t      length)
+{
+	return CrcUpdate(crc32Table, CRC_32_WIDTH, crc, data, length);
+}
+
+/** ****************************************************************************
+ * @name Crc24qUpdate
+ * @brief continue a CRC-24Q (rtcm3/sbas parity) over the next chunk of data
+ * @param [in] crc - seed (CRC_24Q_INITIAL_SEED) or result of the previous chunk
+ * @param [in] data - pointer to the input data
+ * @param [in] length - of the input data
+ * @retval updated crc
+ ******************************************************************************/
+Crc24qType Crc24qUpdate (Crc24qType    crc,
+                         const uint8_t data[],
+                         uint32_t      length)
+{
+	return CrcUpdate(crc24qTable, CRC_24Q_WIDTH, crc, data, length);
 }
 
 /** ****************************************************************************
@@ -162,17 +197,7 @@ CrcCcittType CrcCcitt (const uint8_t      data[],
                        uint16_t           length,
                        const CrcCcittType seed)
 {
-	uint8_t crc[CRC_CCITT_LENGTH];
-
-	CrcCcittTypeToBytes(seed, crc);
-	Crc(CRC_CCITT_POLY,
-        CRC_CCITT_LENGTH,
-        crc,
-        data,
-        length,
-        crc);
-
-	return (BytesToCrcCcittType(crc));
+	return CrcCcittUpdate(seed, data, length);
 }
 
 /** ****************************************************************************
@@ -187,17 +212,7 @@ Crc32Type Crc32 (const uint8_t   data[],
                  uint16_t        length,
                  const Crc32Type seed)
 {
-	uint8_t crc[CRC_32_LENGTH];
-
-	Crc32TypeToBytes(seed, crc);
-	Crc(CRC_32_POLY,
-        CRC_32_LENGTH,
-        crc,
-        data,
-        length,
-        crc);
-
-	return (BytesToCrc32Type(crc));
+	return Crc32Update(seed, data, length);
 }
 
 /** ****************************************************************************
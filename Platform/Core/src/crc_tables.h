@@ -0,0 +1,853 @@
+#ifndef CRC_TABLES_H
+#define CRC_TABLES_H
+
+/* generated by crc_tables.py, edit the script instead */
+
+#include <stdint.h>
+#include "crc.h"
+
+#if CRC_SLICE_BY != 1 && CRC_SLICE_BY != 4 && CRC_SLICE_BY != 8
+#error CRC_SLICE_BY must be 1, 4 or 8
+#endif
+
+/// 16 bit, poly 0x1021
+static const uint32_t crcCcittTable[CRC_SLICE_BY][256] = {
+	{
+		0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+		0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+		0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+		0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+		0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+		0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+		0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+		0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+		0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+		0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+		0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+		0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+		0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+		0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+		0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+		0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+		0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+		0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+		0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+		0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+		0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+		0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+		0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+		0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+		0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+		0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+		0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+		0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+		0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+		0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+		0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+		0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0,
+	},
+#if CRC_SLICE_BY > 1
+	{
+		0x0000, 0x3331, 0x6662, 0x5553, 0xCCC4, 0xFFF5, 0xAAA6, 0x9997,
+		0x89A9, 0xBA98, 0xEFCB, 0xDCFA, 0x456D, 0x765C, 0x230F, 0x103E,
+		0x0373, 0x3042, 0x6511, 0x5620, 0xCFB7, 0xFC86, 0xA9D5, 0x9AE4,
+		0x8ADA, 0xB9EB, 0xECB8, 0xDF89, 0x461E, 0x752F, 0x207C, 0x134D,
+		0x06E6, 0x35D7, 0x6084, 0x53B5, 0xCA22, 0xF913, 0xAC40, 0x9F71,
+		0x8F4F, 0xBC7E, 0xE92D, 0xDA1C, 0x438B, 0x70BA, 0x25E9, 0x16D8,
+		0x0595, 0x36A4, 0x63F7, 0x50C6, 0xC951, 0xFA60, 0xAF33, 0x9C02,
+		0x8C3C, 0xBF0D, 0xEA5E, 0xD96F, 0x40F8, 0x73C9, 0x269A, 0x15AB,
+		0x0DCC, 0x3EFD, 0x6BAE, 0x589F, 0xC108, 0xF239, 0xA76A, 0x945B,
+		0x8465, 0xB754, 0xE207, 0xD136, 0x48A1, 0x7B90, 0x2EC3, 0x1DF2,
+		0x0EBF, 0x3D8E, 0x68DD, 0x5BEC, 0xC27B, 0xF14A, 0xA419, 0x9728,
+		0x8716, 0xB427, 0xE174, 0xD245, 0x4BD2, 0x78E3, 0x2DB0, 0x1E81,
+		0x0B2A, 0x381B, 0x6D48, 0x5E79, 0xC7EE, 0xF4DF, 0xA18C, 0x92BD,
+		0x8283, 0xB1B2, 0xE4E1, 0xD7D0, 0x4E47, 0x7D76, 0x2825, 0x1B14,
+		0x0859, 0x3B68, 0x6E3B, 0x5D0A, 0xC49D, 0xF7AC, 0xA2FF, 0x91CE,
+		0x81F0, 0xB2C1, 0xE792, 0xD4A3, 0x4D34, 0x7E05, 0x2B56, 0x1867,
+		0x1B98, 0x28A9, 0x7DFA, 0x4ECB, 0xD75C, 0xE46D, 0xB13E, 0x820F,
+		0x9231, 0xA100, 0xF453, 0xC762, 0x5EF5, 0x6DC4, 0x3897, 0x0BA6,
+		0x18EB, 0x2BDA, 0x7E89, 0x4DB8, 0xD42F, 0xE71E, 0xB24D, 0x817C,
+		0x9142, 0xA273, 0xF720, 0xC411, 0x5D86, 0x6EB7, 0x3BE4, 0x08D5,
+		0x1D7E, 0x2E4F, 0x7B1C, 0x482D, 0xD1BA, 0xE28B, 0xB7D8, 0x84E9,
+		0x94D7, 0xA7E6, 0xF2B5, 0xC184, 0x5813, 0x6B22, 0x3E71, 0x0D40,
+		0x1E0D, 0x2D3C, 0x786F, 0x4B5E, 0xD2C9, 0xE1F8, 0xB4AB, 0x879A,
+		0x97A4, 0xA495, 0xF1C6, 0xC2F7, 0x5B60, 0x6851, 0x3D02, 0x0E33,
+		0x1654, 0x2565, 0x7036, 0x4307, 0xDA90, 0xE9A1, 0xBCF2, 0x8FC3,
+		0x9FFD, 0xACCC, 0xF99F, 0xCAAE, 0x5339, 0x6008, 0x355B, 0x066A,
+		0x1527, 0x2616, 0x7345, 0x4074, 0xD9E3, 0xEAD2, 0xBF81, 0x8CB0,
+		0x9C8E, 0xAFBF, 0xFAEC, 0xC9DD, 0x504A, 0x637B, 0x3628, 0x0519,
+		0x10B2, 0x2383, 0x76D0, 0x45E1, 0xDC76, 0xEF47, 0xBA14, 0x8925,
+		0x991B, 0xAA2A, 0xFF79, 0xCC48, 0x55DF, 0x66EE, 0x33BD, 0x008C,
+		0x13C1, 0x20F0, 0x75A3, 0x4692, 0xDF05, 0xEC34, 0xB967, 0x8A56,
+		0x9A68, 0xA959, 0xFC0A, 0xCF3B, 0x56AC, 0x659D, 0x30CE, 0x03FF,
+	},
+	{
+		0x0000, 0x3730, 0x6E60, 0x5950, 0xDCC0, 0xEBF0, 0xB2A0, 0x8590,
+		0xA9A1, 0x9E91, 0xC7C1, 0xF0F1, 0x7561, 0x4251, 0x1B01, 0x2C31,
+		0x4363, 0x7453, 0x2D03, 0x1A33, 0x9FA3, 0xA893, 0xF1C3, 0xC6F3,
+		0xEAC2, 0xDDF2, 0x84A2, 0xB392, 0x3602, 0x0132, 0x5862, 0x6F52,
+		0x86C6, 0xB1F6, 0xE8A6, 0xDF96, 0x5A06, 0x6D36, 0x3466, 0x0356,
+		0x2F67, 0x1857, 0x4107, 0x7637, 0xF3A7, 0xC497, 0x9DC7, 0xAAF7,
+		0xC5A5, 0xF295, 0xABC5, 0x9CF5, 0x1965, 0x2E55, 0x7705, 0x4035,
+		0x6C04, 0x5B34, 0x0264, 0x3554, 0xB0C4, 0x87F4, 0xDEA4, 0xE994,
+		0x1DAD, 0x2A9D, 0x73CD, 0x44FD, 0xC16D, 0xF65D, 0xAF0D, 0x983D,
+		0xB40C, 0x833C, 0xDA6C, 0xED5C, 0x68CC, 0x5FFC, 0x06AC, 0x319C,
+		0x5ECE, 0x69FE, 0x30AE, 0x079E, 0x820E, 0xB53E, 0xEC6E, 0xDB5E,
+		0xF76F, 0xC05F, 0x990F, 0xAE3F, 0x2BAF, 0x1C9F, 0x45CF, 0x72FF,
+		0x9B6B, 0xAC5B, 0xF50B, 0xC23B, 0x47AB, 0x709B, 0x29CB, 0x1EFB,
+		0x32CA, 0x05FA, 0x5CAA, 0x6B9A, 0xEE0A, 0xD93A, 0x806A, 0xB75A,
+		0xD808, 0xEF38, 0xB668, 0x8158, 0x04C8, 0x33F8, 0x6AA8, 0x5D98,
+		0x71A9, 0x4699, 0x1FC9, 0x28F9, 0xAD69, 0x9A59, 0xC309, 0xF439,
+		0x3B5A, 0x0C6A, 0x553A, 0x620A, 0xE79A, 0xD0AA, 0x89FA, 0xBECA,
+		0x92FB, 0xA5CB, 0xFC9B, 0xCBAB, 0x4E3B, 0x790B, 0x205B, 0x176B,
+		0x7839, 0x4F09, 0x1659, 0x2169, 0xA4F9, 0x93C9, 0xCA99, 0xFDA9,
+		0xD198, 0xE6A8, 0xBFF8, 0x88C8, 0x0D58, 0x3A68, 0x6338, 0x5408,
+		0xBD9C, 0x8AAC, 0xD3FC, 0xE4CC, 0x615C, 0x566C, 0x0F3C, 0x380C,
+		0x143D, 0x230D, 0x7A5D, 0x4D6D, 0xC8FD, 0xFFCD, 0xA69D, 0x91AD,
+		0xFEFF, 0xC9CF, 0x909F, 0xA7AF, 0x223F, 0x150F, 0x4C5F, 0x7B6F,
+		0x575E, 0x606E, 0x393E, 0x0E0E, 0x8B9E, 0xBCAE, 0xE5FE, 0xD2CE,
+		0x26F7, 0x11C7, 0x4897, 0x7FA7, 0xFA37, 0xCD07, 0x9457, 0xA367,
+		0x8F56, 0xB866, 0xE136, 0xD606, 0x5396, 0x64A6, 0x3DF6, 0x0AC6,
+		0x6594, 0x52A4, 0x0BF4, 0x3CC4, 0xB954, 0x8E64, 0xD734, 0xE004,
+		0xCC35, 0xFB05, 0xA255, 0x9565, 0x10F5, 0x27C5, 0x7E95, 0x49A5,
+		0xA031, 0x9701, 0xCE51, 0xF961, 0x7CF1, 0x4BC1, 0x1291, 0x25A1,
+		0x0990, 0x3EA0, 0x67F0, 0x50C0, 0xD550, 0xE260, 0xBB30, 0x8C00,
+		0xE352, 0xD462, 0x8D32, 0xBA02, 0x3F92, 0x08A2, 0x51F2, 0x66C2,
+		0x4AF3, 0x7DC3, 0x2493, 0x13A3, 0x9633, 0xA103, 0xF853, 0xCF63,
+	},
+	{
+		0x0000, 0x76B4, 0xED68, 0x9BDC, 0xCAF1, 0xBC45, 0x2799, 0x512D,
+		0x85C3, 0xF377, 0x68AB, 0x1E1F, 0x4F32, 0x3986, 0xA25A, 0xD4EE,
+		0x1BA7, 0x6D13, 0xF6CF, 0x807B, 0xD156, 0xA7E2, 0x3C3E, 0x4A8A,
+		0x9E64, 0xE8D0, 0x730C, 0x05B8, 0x5495, 0x2221, 0xB9FD, 0xCF49,
+		0x374E, 0x41FA, 0xDA26, 0xAC92, 0xFDBF, 0x8B0B, 0x10D7, 0x6663,
+		0xB28D, 0xC439, 0x5FE5, 0x2951, 0x787C, 0x0EC8, 0x9514, 0xE3A0,
+		0x2CE9, 0x5A5D, 0xC181, 0xB735, 0xE618, 0x90AC, 0x0B70, 0x7DC4,
+		0xA92A, 0xDF9E, 0x4442, 0x32F6, 0x63DB, 0x156F, 0x8EB3, 0xF807,
+		0x6E9C, 0x1828, 0x83F4, 0xF540, 0xA46D, 0xD2D9, 0x4905, 0x3FB1,
+		0xEB5F, 0x9DEB, 0x0637, 0x7083, 0x21AE, 0x571A, 0xCCC6, 0xBA72,
+		0x753B, 0x038F, 0x9853, 0xEEE7, 0xBFCA, 0xC97E, 0x52A2, 0x2416,
+		0xF0F8, 0x864C, 0x1D90, 0x6B24, 0x3A09, 0x4CBD, 0xD761, 0xA1D5,
+		0x59D2, 0x2F66, 0xB4BA, 0xC20E, 0x9323, 0xE597, 0x7E4B, 0x08FF,
+		0xDC11, 0xAAA5, 0x3179, 0x47CD, 0x16E0, 0x6054, 0xFB88, 0x8D3C,
+		0x4275, 0x34C1, 0xAF1D, 0xD9A9, 0x8884, 0xFE30, 0x65EC, 0x1358,
+		0xC7B6, 0xB102, 0x2ADE, 0x5C6A, 0x0D47, 0x7BF3, 0xE02F, 0x969B,
+		0xDD38, 0xAB8C, 0x3050, 0x46E4, 0x17C9, 0x617D, 0xFAA1, 0x8C15,
+		0x58FB, 0x2E4F, 0xB593, 0xC327, 0x920A, 0xE4BE, 0x7F62, 0x09D6,
+		0xC69F, 0xB02B, 0x2BF7, 0x5D43, 0x0C6E, 0x7ADA, 0xE106, 0x97B2,
+		0x435C, 0x35E8, 0xAE34, 0xD880, 0x89AD, 0xFF19, 0x64C5, 0x1271,
+		0xEA76, 0x9CC2, 0x071E, 0x71AA, 0x2087, 0x5633, 0xCDEF, 0xBB5B,
+		0x6FB5, 0x1901, 0x82DD, 0xF469, 0xA544, 0xD3F0, 0x482C, 0x3E98,
+		0xF1D1, 0x8765, 0x1CB9, 0x6A0D, 0x3B20, 0x4D94, 0xD648, 0xA0FC,
+		0x7412, 0x02A6, 0x997A, 0xEFCE, 0xBEE3, 0xC857, 0x538B, 0x253F,
+		0xB3A4, 0xC510, 0x5ECC, 0x2878, 0x7955, 0x0FE1, 0x943D, 0xE289,
+		0x3667, 0x40D3, 0xDB0F, 0xADBB, 0xFC96, 0x8A22, 0x11FE, 0x674A,
+		0xA803, 0xDEB7, 0x456B, 0x33DF, 0x62F2, 0x1446, 0x8F9A, 0xF92E,
+		0x2DC0, 0x5B74, 0xC0A8, 0xB61C, 0xE731, 0x9185, 0x0A59, 0x7CED,
+		0x84EA, 0xF25E, 0x6982, 0x1F36, 0x4E1B, 0x38AF, 0xA373, 0xD5C7,
+		0x0129, 0x779D, 0xEC41, 0x9AF5, 0xCBD8, 0xBD6C, 0x26B0, 0x5004,
+		0x9F4D, 0xE9F9, 0x7225, 0x0491, 0x55BC, 0x2308, 0xB8D4, 0xCE60,
+		0x1A8E, 0x6C3A, 0xF7E6, 0x8152, 0xD07F, 0xA6CB, 0x3D17, 0x4BA3,
+	},
+#endif
+#if CRC_SLICE_BY > 4
+	{
+		0x0000, 0xAA51, 0x4483, 0xEED2, 0x8906, 0x2357, 0xCD85, 0x67D4,
+		0x022D, 0xA87C, 0x46AE, 0xECFF, 0x8B2B, 0x217A, 0xCFA8, 0x65F9,
+		0x045A, 0xAE0B, 0x40D9, 0xEA88, 0x8D5C, 0x270D, 0xC9DF, 0x638E,
+		0x0677, 0xAC26, 0x42F4, 0xE8A5, 0x8F71, 0x2520, 0xCBF2, 0x61A3,
+		0x08B4, 0xA2E5, 0x4C37, 0xE666, 0x81B2, 0x2BE3, 0xC531, 0x6F60,
+		0x0A99, 0xA0C8, 0x4E1A, 0xE44B, 0x839F, 0x29CE, 0xC71C, 0x6D4D,
+		0x0CEE, 0xA6BF, 0x486D, 0xE23C, 0x85E8, 0x2FB9, 0xC16B, 0x6B3A,
+		0x0EC3, 0xA492, 0x4A40, 0xE011, 0x87C5, 0x2D94, 0xC346, 0x6917,
+		0x1168, 0xBB39, 0x55EB, 0xFFBA, 0x986E, 0x323F, 0xDCED, 0x76BC,
+		0x1345, 0xB914, 0x57C6, 0xFD97, 0x9A43, 0x3012, 0xDEC0, 0x7491,
+		0x1532, 0xBF63, 0x51B1, 0xFBE0, 0x9C34, 0x3665, 0xD8B7, 0x72E6,
+		0x171F, 0xBD4E, 0x539C, 0xF9CD, 0x9E19, 0x3448, 0xDA9A, 0x70CB,
+		0x19DC, 0xB38D, 0x5D5F, 0xF70E, 0x90DA, 0x3A8B, 0xD459, 0x7E08,
+		0x1BF1, 0xB1A0, 0x5F72, 0xF523, 0x92F7, 0x38A6, 0xD674, 0x7C25,
+		0x1D86, 0xB7D7, 0x5905, 0xF354, 0x9480, 0x3ED1, 0xD003, 0x7A52,
+		0x1FAB, 0xB5FA, 0x5B28, 0xF179, 0x96AD, 0x3CFC, 0xD22E, 0x787F,
+		0x22D0, 0x8881, 0x6653, 0xCC02, 0xABD6, 0x0187, 0xEF55, 0x4504,
+		0x20FD, 0x8AAC, 0x647E, 0xCE2F, 0xA9FB, 0x03AA, 0xED78, 0x4729,
+		0x268A, 0x8CDB, 0x6209, 0xC858, 0xAF8C, 0x05DD, 0xEB0F, 0x415E,
+		0x24A7, 0x8EF6, 0x6024, 0xCA75, 0xADA1, 0x07F0, 0xE922, 0x4373,
+		0x2A64, 0x8035, 0x6EE7, 0xC4B6, 0xA362, 0x0933, 0xE7E1, 0x4DB0,
+		0x2849, 0x8218, 0x6CCA, 0xC69B, 0xA14F, 0x0B1E, 0xE5CC, 0x4F9D,
+		0x2E3E, 0x846F, 0x6ABD, 0xC0EC, 0xA738, 0x0D69, 0xE3BB, 0x49EA,
+		0x2C13, 0x8642, 0x6890, 0xC2C1, 0xA515, 0x0F44, 0xE196, 0x4BC7,
+		0x33B8, 0x99E9, 0x773B, 0xDD6A, 0xBABE, 0x10EF, 0xFE3D, 0x546C,
+		0x3195, 0x9BC4, 0x7516, 0xDF47, 0xB893, 0x12C2, 0xFC10, 0x5641,
+		0x37E2, 0x9DB3, 0x7361, 0xD930, 0xBEE4, 0x14B5, 0xFA67, 0x5036,
+		0x35CF, 0x9F9E, 0x714C, 0xDB1D, 0xBCC9, 0x1698, 0xF84A, 0x521B,
+		0x3B0C, 0x915D, 0x7F8F, 0xD5DE, 0xB20A, 0x185B, 0xF689, 0x5CD8,
+		0x3921, 0x9370, 0x7DA2, 0xD7F3, 0xB027, 0x1A76, 0xF4A4, 0x5EF5,
+		0x3F56, 0x9507, 0x7BD5, 0xD184, 0xB650, 0x1C01, 0xF2D3, 0x5882,
+		0x3D7B, 0x972A, 0x79F8, 0xD3A9, 0xB47D, 0x1E2C, 0xF0FE, 0x5AAF,
+	},
+	{
+		0x0000, 0x45A0, 0x8B40, 0xCEE0, 0x06A1, 0x4301, 0x8DE1, 0xC841,
+		0x0D42, 0x48E2, 0x8602, 0xC3A2, 0x0BE3, 0x4E43, 0x80A3, 0xC503,
+		0x1A84, 0x5F24, 0x91C4, 0xD464, 0x1C25, 0x5985, 0x9765, 0xD2C5,
+		0x17C6, 0x5266, 0x9C86, 0xD926, 0x1167, 0x54C7, 0x9A27, 0xDF87,
+		0x3508, 0x70A8, 0xBE48, 0xFBE8, 0x33A9, 0x7609, 0xB8E9, 0xFD49,
+		0x384A, 0x7DEA, 0xB30A, 0xF6AA, 0x3EEB, 0x7B4B, 0xB5AB, 0xF00B,
+		0x2F8C, 0x6A2C, 0xA4CC, 0xE16C, 0x292D, 0x6C8D, 0xA26D, 0xE7CD,
+		0x22CE, 0x676E, 0xA98E, 0xEC2E, 0x246F, 0x61CF, 0xAF2F, 0xEA8F,
+		0x6A10, 0x2FB0, 0xE150, 0xA4F0, 0x6CB1, 0x2911, 0xE7F1, 0xA251,
+		0x6752, 0x22F2, 0xEC12, 0xA9B2, 0x61F3, 0x2453, 0xEAB3, 0xAF13,
+		0x7094, 0x3534, 0xFBD4, 0xBE74, 0x7635, 0x3395, 0xFD75, 0xB8D5,
+		0x7DD6, 0x3876, 0xF696, 0xB336, 0x7B77, 0x3ED7, 0xF037, 0xB597,
+		0x5F18, 0x1AB8, 0xD458, 0x91F8, 0x59B9, 0x1C19, 0xD2F9, 0x9759,
+		0x525A, 0x17FA, 0xD91A, 0x9CBA, 0x54FB, 0x115B, 0xDFBB, 0x9A1B,
+		0x459C, 0x003C, 0xCEDC, 0x8B7C, 0x433D, 0x069D, 0xC87D, 0x8DDD,
+		0x48DE, 0x0D7E, 0xC39E, 0x863E, 0x4E7F, 0x0BDF, 0xC53F, 0x809F,
+		0xD420, 0x9180, 0x5F60, 0x1AC0, 0xD281, 0x9721, 0x59C1, 0x1C61,
+		0xD962, 0x9CC2, 0x5222, 0x1782, 0xDFC3, 0x9A63, 0x5483, 0x1123,
+		0xCEA4, 0x8B04, 0x45E4, 0x0044, 0xC805, 0x8DA5, 0x4345, 0x06E5,
+		0xC3E6, 0x8646, 0x48A6, 0x0D06, 0xC547, 0x80E7, 0x4E07, 0x0BA7,
+		0xE128, 0xA488, 0x6A68, 0x2FC8, 0xE789, 0xA229, 0x6CC9, 0x2969,
+		0xEC6A, 0xA9CA, 0x672A, 0x228A, 0xEACB, 0xAF6B, 0x618B, 0x242B,
+		0xFBAC, 0xBE0C, 0x70EC, 0x354C, 0xFD0D, 0xB8AD, 0x764D, 0x33ED,
+		0xF6EE, 0xB34E, 0x7DAE, 0x380E, 0xF04F, 0xB5EF, 0x7B0F, 0x3EAF,
+		0xBE30, 0xFB90, 0x3570, 0x70D0, 0xB891, 0xFD31, 0x33D1, 0x7671,
+		0xB372, 0xF6D2, 0x3832, 0x7D92, 0xB5D3, 0xF073, 0x3E93, 0x7B33,
+		0xA4B4, 0xE114, 0x2FF4, 0x6A54, 0xA215, 0xE7B5, 0x2955, 0x6CF5,
+		0xA9F6, 0xEC56, 0x22B6, 0x6716, 0xAF57, 0xEAF7, 0x2417, 0x61B7,
+		0x8B38, 0xCE98, 0x0078, 0x45D8, 0x8D99, 0xC839, 0x06D9, 0x4379,
+		0x867A, 0xC3DA, 0x0D3A, 0x489A, 0x80DB, 0xC57B, 0x0B9B, 0x4E3B,
+		0x91BC, 0xD41C, 0x1AFC, 0x5F5C, 0x971D, 0xD2BD, 0x1C5D, 0x59FD,
+		0x9CFE, 0xD95E, 0x17BE, 0x521E, 0x9A5F, 0xDFFF, 0x111F, 0x54BF,
+	},
+	{
+		0x0000, 0xB861, 0x60E3, 0xD882, 0xC1C6, 0x79A7, 0xA125, 0x1944,
+		0x93AD, 0x2BCC, 0xF34E, 0x4B2F, 0x526B, 0xEA0A, 0x3288, 0x8AE9,
+		0x377B, 0x8F1A, 0x5798, 0xEFF9, 0xF6BD, 0x4EDC, 0x965E, 0x2E3F,
+		0xA4D6, 0x1CB7, 0xC435, 0x7C54, 0x6510, 0xDD71, 0x05F3, 0xBD92,
+		0x6EF6, 0xD697, 0x0E15, 0xB674, 0xAF30, 0x1751, 0xCFD3, 0x77B2,
+		0xFD5B, 0x453A, 0x9DB8, 0x25D9, 0x3C9D, 0x84FC, 0x5C7E, 0xE41F,
+		0x598D, 0xE1EC, 0x396E, 0x810F, 0x984B, 0x202A, 0xF8A8, 0x40C9,
+		0xCA20, 0x7241, 0xAAC3, 0x12A2, 0x0BE6, 0xB387, 0x6B05, 0xD364,
+		0xDDEC, 0x658D, 0xBD0F, 0x056E, 0x1C2A, 0xA44B, 0x7CC9, 0xC4A8,
+		0x4E41, 0xF620, 0x2EA2, 0x96C3, 0x8F87, 0x37E6, 0xEF64, 0x5705,
+		0xEA97, 0x52F6, 0x8A74, 0x3215, 0x2B51, 0x9330, 0x4BB2, 0xF3D3,
+		0x793A, 0xC15B, 0x19D9, 0xA1B8, 0xB8FC, 0x009D, 0xD81F, 0x607E,
+		0xB31A, 0x0B7B, 0xD3F9, 0x6B98, 0x72DC, 0xCABD, 0x123F, 0xAA5E,
+		0x20B7, 0x98D6, 0x4054, 0xF835, 0xE171, 0x5910, 0x8192, 0x39F3,
+		0x8461, 0x3C00, 0xE482, 0x5CE3, 0x45A7, 0xFDC6, 0x2544, 0x9D25,
+		0x17CC, 0xAFAD, 0x772F, 0xCF4E, 0xD60A, 0x6E6B, 0xB6E9, 0x0E88,
+		0xABF9, 0x1398, 0xCB1A, 0x737B, 0x6A3F, 0xD25E, 0x0ADC, 0xB2BD,
+		0x3854, 0x8035, 0x58B7, 0xE0D6, 0xF992, 0x41F3, 0x9971, 0x2110,
+		0x9C82, 0x24E3, 0xFC61, 0x4400, 0x5D44, 0xE525, 0x3DA7, 0x85C6,
+		0x0F2F, 0xB74E, 0x6FCC, 0xD7AD, 0xCEE9, 0x7688, 0xAE0A, 0x166B,
+		0xC50F, 0x7D6E, 0xA5EC, 0x1D8D, 0x04C9, 0xBCA8, 0x642A, 0xDC4B,
+		0x56A2, 0xEEC3, 0x3641, 0x8E20, 0x9764, 0x2F05, 0xF787, 0x4FE6,
+		0xF274, 0x4A15, 0x9297, 0x2AF6, 0x33B2, 0x8BD3, 0x5351, 0xEB30,
+		0x61D9, 0xD9B8, 0x013A, 0xB95B, 0xA01F, 0x187E, 0xC0FC, 0x789D,
+		0x7615, 0xCE74, 0x16F6, 0xAE97, 0xB7D3, 0x0FB2, 0xD730, 0x6F51,
+		0xE5B8, 0x5DD9, 0x855B, 0x3D3A, 0x247E, 0x9C1F, 0x449D, 0xFCFC,
+		0x416E, 0xF90F, 0x218D, 0x99EC, 0x80A8, 0x38C9, 0xE04B, 0x582A,
+		0xD2C3, 0x6AA2, 0xB220, 0x0A41, 0x1305, 0xAB64, 0x73E6, 0xCB87,
+		0x18E3, 0xA082, 0x7800, 0xC061, 0xD925, 0x6144, 0xB9C6, 0x01A7,
+		0x8B4E, 0x332F, 0xEBAD, 0x53CC, 0x4A88, 0xF2E9, 0x2A6B, 0x920A,
+		0x2F98, 0x97F9, 0x4F7B, 0xF71A, 0xEE5E, 0x563F, 0x8EBD, 0x36DC,
+		0xBC35, 0x0454, 0xDCD6, 0x64B7, 0x7DF3, 0xC592, 0x1D10, 0xA571,
+	},
+	{
+		0x0000, 0x47D3, 0x8FA6, 0xC875, 0x0F6D, 0x48BE, 0x80CB, 0xC718,
+		0x1EDA, 0x5909, 0x917C, 0xD6AF, 0x11B7, 0x5664, 0x9E11, 0xD9C2,
+		0x3DB4, 0x7A67, 0xB212, 0xF5C1, 0x32D9, 0x750A, 0xBD7F, 0xFAAC,
+		0x236E, 0x64BD, 0xACC8, 0xEB1B, 0x2C03, 0x6BD0, 0xA3A5, 0xE476,
+		0x7B68, 0x3CBB, 0xF4CE, 0xB31D, 0x7405, 0x33D6, 0xFBA3, 0xBC70,
+		0x65B2, 0x2261, 0xEA14, 0xADC7, 0x6ADF, 0x2D0C, 0xE579, 0xA2AA,
+		0x46DC, 0x010F, 0xC97A, 0x8EA9, 0x49B1, 0x0E62, 0xC617, 0x81C4,
+		0x5806, 0x1FD5, 0xD7A0, 0x9073, 0x576B, 0x10B8, 0xD8CD, 0x9F1E,
+		0xF6D0, 0xB103, 0x7976, 0x3EA5, 0xF9BD, 0xBE6E, 0x761B, 0x31C8,
+		0xE80A, 0xAFD9, 0x67AC, 0x207F, 0xE767, 0xA0B4, 0x68C1, 0x2F12,
+		0xCB64, 0x8CB7, 0x44C2, 0x0311, 0xC409, 0x83DA, 0x4BAF, 0x0C7C,
+		0xD5BE, 0x926D, 0x5A18, 0x1DCB, 0xDAD3, 0x9D00, 0x5575, 0x12A6,
+		0x8DB8, 0xCA6B, 0x021E, 0x45CD, 0x82D5, 0xC506, 0x0D73, 0x4AA0,
+		0x9362, 0xD4B1, 0x1CC4, 0x5B17, 0x9C0F, 0xDBDC, 0x13A9, 0x547A,
+		0xB00C, 0xF7DF, 0x3FAA, 0x7879, 0xBF61, 0xF8B2, 0x30C7, 0x7714,
+		0xAED6, 0xE905, 0x2170, 0x66A3, 0xA1BB, 0xE668, 0x2E1D, 0x69CE,
+		0xFD81, 0xBA52, 0x7227, 0x35F4, 0xF2EC, 0xB53F, 0x7D4A, 0x3A99,
+		0xE35B, 0xA488, 0x6CFD, 0x2B2E, 0xEC36, 0xABE5, 0x6390, 0x2443,
+		0xC035, 0x87E6, 0x4F93, 0x0840, 0xCF58, 0x888B, 0x40FE, 0x072D,
+		0xDEEF, 0x993C, 0x5149, 0x169A, 0xD182, 0x9651, 0x5E24, 0x19F7,
+		0x86E9, 0xC13A, 0x094F, 0x4E9C, 0x8984, 0xCE57, 0x0622, 0x41F1,
+		0x9833, 0xDFE0, 0x1795, 0x5046, 0x975E, 0xD08D, 0x18F8, 0x5F2B,
+		0xBB5D, 0xFC8E, 0x34FB, 0x7328, 0xB430, 0xF3E3, 0x3B96, 0x7C45,
+		0xA587, 0xE254, 0x2A21, 0x6DF2, 0xAAEA, 0xED39, 0x254C, 0x629F,
+		0x0B51, 0x4C82, 0x84F7, 0xC324, 0x043C, 0x43EF, 0x8B9A, 0xCC49,
+		0x158B, 0x5258, 0x9A2D, 0xDDFE, 0x1AE6, 0x5D35, 0x9540, 0xD293,
+		0x36E5, 0x7136, 0xB943, 0xFE90, 0x3988, 0x7E5B, 0xB62E, 0xF1FD,
+		0x283F, 0x6FEC, 0xA799, 0xE04A, 0x2752, 0x6081, 0xA8F4, 0xEF27,
+		0x7039, 0x37EA, 0xFF9F, 0xB84C, 0x7F54, 0x3887, 0xF0F2, 0xB721,
+		0x6EE3, 0x2930, 0xE145, 0xA696, 0x618E, 0x265D, 0xEE28, 0xA9FB,
+		0x4D8D, 0x0A5E, 0xC22B, 0x85F8, 0x42E0, 0x0533, 0xCD46, 0x8A95,
+		0x5357, 0x1484, 0xDCF1, 0x9B22, 0x5C3A, 0x1BE9, 0xD39C, 0x944F,
+	},
+#endif
+};
+
+/// 32 bit, poly 0xEDB88320
+static const uint32_t crc32Table[CRC_SLICE_BY][256] = {
+	{
+		0x00000000, 0xEDB88320, 0x36C98560, 0xDB710640, 0x6D930AC0, 0x802B89E0, 0x5B5A8FA0, 0xB6E20C80,
+		0xDB261580, 0x369E96A0, 0xEDEF90E0, 0x005713C0, 0xB6B51F40, 0x5B0D9C60, 0x807C9A20, 0x6DC41900,
+		0x5BF4A820, 0xB64C2B00, 0x6D3D2D40, 0x8085AE60, 0x3667A2E0, 0xDBDF21C0, 0x00AE2780, 0xED16A4A0,
+		0x80D2BDA0, 0x6D6A3E80, 0xB61B38C0, 0x5BA3BBE0, 0xED41B760, 0x00F93440, 0xDB883200, 0x3630B120,
+		0xB7E95040, 0x5A51D360, 0x8120D520, 0x6C985600, 0xDA7A5A80, 0x37C2D9A0, 0xECB3DFE0, 0x010B5CC0,
+		0x6CCF45C0, 0x8177C6E0, 0x5A06C0A0, 0xB7BE4380, 0x015C4F00, 0xECE4CC20, 0x3795CA60, 0xDA2D4940,
+		0xEC1DF860, 0x01A57B40, 0xDAD47D00, 0x376CFE20, 0x818EF2A0, 0x6C367180, 0xB74777C0, 0x5AFFF4E0,
+		0x373BEDE0, 0xDA836EC0, 0x01F26880, 0xEC4AEBA0, 0x5AA8E720, 0xB7106400, 0x6C616240, 0x81D9E160,
+		0x826A23A0, 0x6FD2A080, 0xB4A3A6C0, 0x591B25E0, 0xEFF92960, 0x0241AA40, 0xD930AC00, 0x34882F20,
+		0x594C3620, 0xB4F4B500, 0x6F85B340, 0x823D3060, 0x34DF3CE0, 0xD967BFC0, 0x0216B980, 0xEFAE3AA0,
+		0xD99E8B80, 0x342608A0, 0xEF570EE0, 0x02EF8DC0, 0xB40D8140, 0x59B50260, 0x82C40420, 0x6F7C8700,
+		0x02B89E00, 0xEF001D20, 0x34711B60, 0xD9C99840, 0x6F2B94C0, 0x829317E0, 0x59E211A0, 0xB45A9280,
+		0x358373E0, 0xD83BF0C0, 0x034AF680, 0xEEF275A0, 0x58107920, 0xB5A8FA00, 0x6ED9FC40, 0x83617F60,
+		0xEEA56660, 0x031DE540, 0xD86CE300, 0x35D46020, 0x83366CA0, 0x6E8EEF80, 0xB5FFE9C0, 0x58476AE0,
+		0x6E77DBC0, 0x83CF58E0, 0x58BE5EA0, 0xB506DD80, 0x03E4D100, 0xEE5C5220, 0x352D5460, 0xD895D740,
+		0xB551CE40, 0x58E94D60, 0x83984B20, 0x6E20C800, 0xD8C2C480, 0x357A47A0, 0xEE0B41E0, 0x03B3C2C0,
+		0xE96CC460, 0x04D44740, 0xDFA54100, 0x321DC220, 0x84FFCEA0, 0x69474D80, 0xB2364BC0, 0x5F8EC8E0,
+		0x324AD1E0, 0xDFF252C0, 0x04835480, 0xE93BD7A0, 0x5FD9DB20, 0xB2615800, 0x69105E40, 0x84A8DD60,
+		0xB2986C40, 0x5F20EF60, 0x8451E920, 0x69E96A00, 0xDF0B6680, 0x32B3E5A0, 0xE9C2E3E0, 0x047A60C0,
+		0x69BE79C0, 0x8406FAE0, 0x5F77FCA0, 0xB2CF7F80, 0x042D7300, 0xE995F020, 0x32E4F660, 0xDF5C7540,
+		0x5E859420, 0xB33D1700, 0x684C1140, 0x85F49260, 0x33169EE0, 0xDEAE1DC0, 0x05DF1B80, 0xE86798A0,
+		0x85A381A0, 0x681B0280, 0xB36A04C0, 0x5ED287E0, 0xE8308B60, 0x05880840, 0xDEF90E00, 0x33418D20,
+		0x05713C00, 0xE8C9BF20, 0x33B8B960, 0xDE003A40, 0x68E236C0, 0x855AB5E0, 0x5E2BB3A0, 0xB3933080,
+		0xDE572980, 0x33EFAAA0, 0xE89EACE0, 0x05262FC0, 0xB3C42340, 0x5E7CA060, 0x850DA620, 0x68B52500,
+		0x6B06E7C0, 0x86BE64E0, 0x5DCF62A0, 0xB077E180, 0x0695ED00, 0xEB2D6E20, 0x305C6860, 0xDDE4EB40,
+		0xB020F240, 0x5D987160, 0x86E97720, 0x6B51F400, 0xDDB3F880, 0x300B7BA0, 0xEB7A7DE0, 0x06C2FEC0,
+		0x30F24FE0, 0xDD4ACCC0, 0x063BCA80, 0xEB8349A0, 0x5D614520, 0xB0D9C600, 0x6BA8C040, 0x86104360,
+		0xEBD45A60, 0x066CD940, 0xDD1DDF00, 0x30A55C20, 0x864750A0, 0x6BFFD380, 0xB08ED5C0, 0x5D3656E0,
+		0xDCEFB780, 0x315734A0, 0xEA2632E0, 0x079EB1C0, 0xB17CBD40, 0x5CC43E60, 0x87B53820, 0x6A0DBB00,
+		0x07C9A200, 0xEA712120, 0x31002760, 0xDCB8A440, 0x6A5AA8C0, 0x87E22BE0, 0x5C932DA0, 0xB12BAE80,
+		0x871B1FA0, 0x6AA39C80, 0xB1D29AC0, 0x5C6A19E0, 0xEA881560, 0x07309640, 0xDC419000, 0x31F91320,
+		0x5C3D0A20, 0xB1858900, 0x6AF48F40, 0x874C0C60, 0x31AE00E0, 0xDC1683C0, 0x07678580, 0xEADF06A0,
+	},
+#if CRC_SLICE_BY > 1
+	{
+		0x00000000, 0x3F610BE0, 0x7EC217C0, 0x41A31C20, 0xFD842F80, 0xC2E52460, 0x83463840, 0xBC2733A0,
+		0x16B0DC20, 0x29D1D7C0, 0x6872CBE0, 0x5713C000, 0xEB34F3A0, 0xD455F840, 0x95F6E460, 0xAA97EF80,
+		0x2D61B840, 0x1200B3A0, 0x53A3AF80, 0x6CC2A460, 0xD0E597C0, 0xEF849C20, 0xAE278000, 0x91468BE0,
+		0x3BD16460, 0x04B06F80, 0x451373A0, 0x7A727840, 0xC6554BE0, 0xF9344000, 0xB8975C20, 0x87F657C0,
+		0x5AC37080, 0x65A27B60, 0x24016740, 0x1B606CA0, 0xA7475F00, 0x982654E0, 0xD98548C0, 0xE6E44320,
+		0x4C73ACA0, 0x7312A740, 0x32B1BB60, 0x0DD0B080, 0xB1F78320, 0x8E9688C0, 0xCF3594E0, 0xF0549F00,
+		0x77A2C8C0, 0x48C3C320, 0x0960DF00, 0x3601D4E0, 0x8A26E740, 0xB547ECA0, 0xF4E4F080, 0xCB85FB60,
+		0x611214E0, 0x5E731F00, 0x1FD00320, 0x20B108C0, 0x9C963B60, 0xA3F73080, 0xE2542CA0, 0xDD352740,
+		0xB586E100, 0x8AE7EAE0, 0xCB44F6C0, 0xF425FD20, 0x4802CE80, 0x7763C560, 0x36C0D940, 0x09A1D2A0,
+		0xA3363D20, 0x9C5736C0, 0xDDF42AE0, 0xE2952100, 0x5EB212A0, 0x61D31940, 0x20700560, 0x1F110E80,
+		0x98E75940, 0xA78652A0, 0xE6254E80, 0xD9444560, 0x656376C0, 0x5A027D20, 0x1BA16100, 0x24C06AE0,
+		0x8E578560, 0xB1368E80, 0xF09592A0, 0xCFF49940, 0x73D3AAE0, 0x4CB2A100, 0x0D11BD20, 0x3270B6C0,
+		0xEF459180, 0xD0249A60, 0x91878640, 0xAEE68DA0, 0x12C1BE00, 0x2DA0B5E0, 0x6C03A9C0, 0x5362A220,
+		0xF9F54DA0, 0xC6944640, 0x87375A60, 0xB8565180, 0x04716220, 0x3B1069C0, 0x7AB375E0, 0x45D27E00,
+		0xC22429C0, 0xFD452220, 0xBCE63E00, 0x838735E0, 0x3FA00640, 0x00C10DA0, 0x41621180, 0x7E031A60,
+		0xD494F5E0, 0xEBF5FE00, 0xAA56E220, 0x9537E9C0, 0x2910DA60, 0x1671D180, 0x57D2CDA0, 0x68B3C640,
+		0x86B54120, 0xB9D44AC0, 0xF87756E0, 0xC7165D00, 0x7B316EA0, 0x44506540, 0x05F37960, 0x3A927280,
+		0x90059D00, 0xAF6496E0, 0xEEC78AC0, 0xD1A68120, 0x6D81B280, 0x52E0B960, 0x1343A540, 0x2C22AEA0,
+		0xABD4F960, 0x94B5F280, 0xD516EEA0, 0xEA77E540, 0x5650D6E0, 0x6931DD00, 0x2892C120, 0x17F3CAC0,
+		0xBD642540, 0x82052EA0, 0xC3A63280, 0xFCC73960, 0x40E00AC0, 0x7F810120, 0x3E221D00, 0x014316E0,
+		0xDC7631A0, 0xE3173A40, 0xA2B42660, 0x9DD52D80, 0x21F21E20, 0x1E9315C0, 0x5F3009E0, 0x60510200,
+		0xCAC6ED80, 0xF5A7E660, 0xB404FA40, 0x8B65F1A0, 0x3742C200, 0x0823C9E0, 0x4980D5C0, 0x76E1DE20,
+		0xF11789E0, 0xCE768200, 0x8FD59E20, 0xB0B495C0, 0x0C93A660, 0x33F2AD80, 0x7251B1A0, 0x4D30BA40,
+		0xE7A755C0, 0xD8C65E20, 0x99654200, 0xA60449E0, 0x1A237A40, 0x254271A0, 0x64E16D80, 0x5B806660,
+		0x3333A020, 0x0C52ABC0, 0x4DF1B7E0, 0x7290BC00, 0xCEB78FA0, 0xF1D68440, 0xB0759860, 0x8F149380,
+		0x25837C00, 0x1AE277E0, 0x5B416BC0, 0x64206020, 0xD8075380, 0xE7665860, 0xA6C54440, 0x99A44FA0,
+		0x1E521860, 0x21331380, 0x60900FA0, 0x5FF10440, 0xE3D637E0, 0xDCB73C00, 0x9D142020, 0xA2752BC0,
+		0x08E2C440, 0x3783CFA0, 0x7620D380, 0x4941D860, 0xF566EBC0, 0xCA07E020, 0x8BA4FC00, 0xB4C5F7E0,
+		0x69F0D0A0, 0x5691DB40, 0x1732C760, 0x2853CC80, 0x9474FF20, 0xAB15F4C0, 0xEAB6E8E0, 0xD5D7E300,
+		0x7F400C80, 0x40210760, 0x01821B40, 0x3EE310A0, 0x82C42300, 0xBDA528E0, 0xFC0634C0, 0xC3673F20,
+		0x449168E0, 0x7BF06300, 0x3A537F20, 0x053274C0, 0xB9154760, 0x86744C80, 0xC7D750A0, 0xF8B65B40,
+		0x5221B4C0, 0x6D40BF20, 0x2CE3A300, 0x1382A8E0, 0xAFA59B40, 0x90C490A0, 0xD1678C80, 0xEE068760,
+	},
+	{
+		0x00000000, 0xE0D20160, 0x2C1C81E0, 0xCCCE8080, 0x583903C0, 0xB8EB02A0, 0x74258220, 0x94F78340,
+		0xB0720780, 0x50A006E0, 0x9C6E8660, 0x7CBC8700, 0xE84B0440, 0x08990520, 0xC45785A0, 0x248584C0,
+		0x8D5C8C20, 0x6D8E8D40, 0xA1400DC0, 0x41920CA0, 0xD5658FE0, 0x35B78E80, 0xF9790E00, 0x19AB0F60,
+		0x3D2E8BA0, 0xDDFC8AC0, 0x11320A40, 0xF1E00B20, 0x65178860, 0x85C58900, 0x490B0980, 0xA9D908E0,
+		0xF7019B60, 0x17D39A00, 0xDB1D1A80, 0x3BCF1BE0, 0xAF3898A0, 0x4FEA99C0, 0x83241940, 0x63F61820,
+		0x47739CE0, 0xA7A19D80, 0x6B6F1D00, 0x8BBD1C60, 0x1F4A9F20, 0xFF989E40, 0x33561EC0, 0xD3841FA0,
+		0x7A5D1740, 0x9A8F1620, 0x564196A0, 0xB69397C0, 0x22641480, 0xC2B615E0, 0x0E789560, 0xEEAA9400,
+		0xCA2F10C0, 0x2AFD11A0, 0xE6339120, 0x06E19040, 0x92161300, 0x72C41260, 0xBE0A92E0, 0x5ED89380,
+		0x03BBB5E0, 0xE369B480, 0x2FA73400, 0xCF753560, 0x5B82B620, 0xBB50B740, 0x779E37C0, 0x974C36A0,
+		0xB3C9B260, 0x531BB300, 0x9FD53380, 0x7F0732E0, 0xEBF0B1A0, 0x0B22B0C0, 0xC7EC3040, 0x273E3120,
+		0x8EE739C0, 0x6E3538A0, 0xA2FBB820, 0x4229B940, 0xD6DE3A00, 0x360C3B60, 0xFAC2BBE0, 0x1A10BA80,
+		0x3E953E40, 0xDE473F20, 0x1289BFA0, 0xF25BBEC0, 0x66AC3D80, 0x867E3CE0, 0x4AB0BC60, 0xAA62BD00,
+		0xF4BA2E80, 0x14682FE0, 0xD8A6AF60, 0x3874AE00, 0xAC832D40, 0x4C512C20, 0x809FACA0, 0x604DADC0,
+		0x44C82900, 0xA41A2860, 0x68D4A8E0, 0x8806A980, 0x1CF12AC0, 0xFC232BA0, 0x30EDAB20, 0xD03FAA40,
+		0x79E6A2A0, 0x9934A3C0, 0x55FA2340, 0xB5282220, 0x21DFA160, 0xC10DA000, 0x0DC32080, 0xED1121E0,
+		0xC994A520, 0x2946A440, 0xE58824C0, 0x055A25A0, 0x91ADA6E0, 0x717FA780, 0xBDB12700, 0x5D632660,
+		0x07776BC0, 0xE7A56AA0, 0x2B6BEA20, 0xCBB9EB40, 0x5F4E6800, 0xBF9C6960, 0x7352E9E0, 0x9380E880,
+		0xB7056C40, 0x57D76D20, 0x9B19EDA0, 0x7BCBECC0, 0xEF3C6F80, 0x0FEE6EE0, 0xC320EE60, 0x23F2EF00,
+		0x8A2BE7E0, 0x6AF9E680, 0xA6376600, 0x46E56760, 0xD212E420, 0x32C0E540, 0xFE0E65C0, 0x1EDC64A0,
+		0x3A59E060, 0xDA8BE100, 0x16456180, 0xF69760E0, 0x6260E3A0, 0x82B2E2C0, 0x4E7C6240, 0xAEAE6320,
+		0xF076F0A0, 0x10A4F1C0, 0xDC6A7140, 0x3CB87020, 0xA84FF360, 0x489DF200, 0x84537280, 0x648173E0,
+		0x4004F720, 0xA0D6F640, 0x6C1876C0, 0x8CCA77A0, 0x183DF4E0, 0xF8EFF580, 0x34217500, 0xD4F37460,
+		0x7D2A7C80, 0x9DF87DE0, 0x5136FD60, 0xB1E4FC00, 0x25137F40, 0xC5C17E20, 0x090FFEA0, 0xE9DDFFC0,
+		0xCD587B00, 0x2D8A7A60, 0xE144FAE0, 0x0196FB80, 0x956178C0, 0x75B379A0, 0xB97DF920, 0x59AFF840,
+		0x04CCDE20, 0xE41EDF40, 0x28D05FC0, 0xC8025EA0, 0x5CF5DDE0, 0xBC27DC80, 0x70E95C00, 0x903B5D60,
+		0xB4BED9A0, 0x546CD8C0, 0x98A25840, 0x78705920, 0xEC87DA60, 0x0C55DB00, 0xC09B5B80, 0x20495AE0,
+		0x89905200, 0x69425360, 0xA58CD3E0, 0x455ED280, 0xD1A951C0, 0x317B50A0, 0xFDB5D020, 0x1D67D140,
+		0x39E25580, 0xD93054E0, 0x15FED460, 0xF52CD500, 0x61DB5640, 0x81095720, 0x4DC7D7A0, 0xAD15D6C0,
+		0xF3CD4540, 0x131F4420, 0xDFD1C4A0, 0x3F03C5C0, 0xABF44680, 0x4B2647E0, 0x87E8C760, 0x673AC600,
+		0x43BF42C0, 0xA36D43A0, 0x6FA3C320, 0x8F71C240, 0x1B864100, 0xFB544060, 0x379AC0E0, 0xD748C180,
+		0x7E91C960, 0x9E43C800, 0x528D4880, 0xB25F49E0, 0x26A8CAA0, 0xC67ACBC0, 0x0AB44B40, 0xEA664A20,
+		0xCEE3CEE0, 0x2E31CF80, 0xE2FF4F00, 0x022D4E60, 0x96DACD20, 0x7608CC40, 0xBAC64CC0, 0x5A144DA0,
+	},
+	{
+		0x00000000, 0x0EEED780, 0x1DDDAF00, 0x13337880, 0x3BBB5E00, 0x35558980, 0x2666F100, 0x28882680,
+		0x7776BC00, 0x79986B80, 0x6AAB1300, 0x6445C480, 0x4CCDE200, 0x42233580, 0x51104D00, 0x5FFE9A80,
+		0xEEED7800, 0xE003AF80, 0xF330D700, 0xFDDE0080, 0xD5562600, 0xDBB8F180, 0xC88B8900, 0xC6655E80,
+		0x999BC400, 0x97751380, 0x84466B00, 0x8AA8BC80, 0xA2209A00, 0xACCE4D80, 0xBFFD3500, 0xB113E280,
+		0x30627320, 0x3E8CA4A0, 0x2DBFDC20, 0x23510BA0, 0x0BD92D20, 0x0537FAA0, 0x16048220, 0x18EA55A0,
+		0x4714CF20, 0x49FA18A0, 0x5AC96020, 0x5427B7A0, 0x7CAF9120, 0x724146A0, 0x61723E20, 0x6F9CE9A0,
+		0xDE8F0B20, 0xD061DCA0, 0xC352A420, 0xCDBC73A0, 0xE5345520, 0xEBDA82A0, 0xF8E9FA20, 0xF6072DA0,
+		0xA9F9B720, 0xA71760A0, 0xB4241820, 0xBACACFA0, 0x9242E920, 0x9CAC3EA0, 0x8F9F4620, 0x817191A0,
+		0x60C4E640, 0x6E2A31C0, 0x7D194940, 0x73F79EC0, 0x5B7FB840, 0x55916FC0, 0x46A21740, 0x484CC0C0,
+		0x17B25A40, 0x195C8DC0, 0x0A6FF540, 0x048122C0, 0x2C090440, 0x22E7D3C0, 0x31D4AB40, 0x3F3A7CC0,
+		0x8E299E40, 0x80C749C0, 0x93F43140, 0x9D1AE6C0, 0xB592C040, 0xBB7C17C0, 0xA84F6F40, 0xA6A1B8C0,
+		0xF95F2240, 0xF7B1F5C0, 0xE4828D40, 0xEA6C5AC0, 0xC2E47C40, 0xCC0AABC0, 0xDF39D340, 0xD1D704C0,
+		0x50A69560, 0x5E4842E0, 0x4D7B3A60, 0x4395EDE0, 0x6B1DCB60, 0x65F31CE0, 0x76C06460, 0x782EB3E0,
+		0x27D02960, 0x293EFEE0, 0x3A0D8660, 0x34E351E0, 0x1C6B7760, 0x1285A0E0, 0x01B6D860, 0x0F580FE0,
+		0xBE4BED60, 0xB0A53AE0, 0xA3964260, 0xAD7895E0, 0x85F0B360, 0x8B1E64E0, 0x982D1C60, 0x96C3CBE0,
+		0xC93D5160, 0xC7D386E0, 0xD4E0FE60, 0xDA0E29E0, 0xF2860F60, 0xFC68D8E0, 0xEF5BA060, 0xE1B577E0,
+		0xC189CC80, 0xCF671B00, 0xDC546380, 0xD2BAB400, 0xFA329280, 0xF4DC4500, 0xE7EF3D80, 0xE901EA00,
+		0xB6FF7080, 0xB811A700, 0xAB22DF80, 0xA5CC0800, 0x8D442E80, 0x83AAF900, 0x90998180, 0x9E775600,
+		0x2F64B480, 0x218A6300, 0x32B91B80, 0x3C57CC00, 0x14DFEA80, 0x1A313D00, 0x09024580, 0x07EC9200,
+		0x58120880, 0x56FCDF00, 0x45CFA780, 0x4B217000, 0x63A95680, 0x6D478100, 0x7E74F980, 0x709A2E00,
+		0xF1EBBFA0, 0xFF056820, 0xEC3610A0, 0xE2D8C720, 0xCA50E1A0, 0xC4BE3620, 0xD78D4EA0, 0xD9639920,
+		0x869D03A0, 0x8873D420, 0x9B40ACA0, 0x95AE7B20, 0xBD265DA0, 0xB3C88A20, 0xA0FBF2A0, 0xAE152520,
+		0x1F06C7A0, 0x11E81020, 0x02DB68A0, 0x0C35BF20, 0x24BD99A0, 0x2A534E20, 0x396036A0, 0x378EE120,
+		0x68707BA0, 0x669EAC20, 0x75ADD4A0, 0x7B430320, 0x53CB25A0, 0x5D25F220, 0x4E168AA0, 0x40F85D20,
+		0xA14D2AC0, 0xAFA3FD40, 0xBC9085C0, 0xB27E5240, 0x9AF674C0, 0x9418A340, 0x872BDBC0, 0x89C50C40,
+		0xD63B96C0, 0xD8D54140, 0xCBE639C0, 0xC508EE40, 0xED80C8C0, 0xE36E1F40, 0xF05D67C0, 0xFEB3B040,
+		0x4FA052C0, 0x414E8540, 0x527DFDC0, 0x5C932A40, 0x741B0CC0, 0x7AF5DB40, 0x69C6A3C0, 0x67287440,
+		0x38D6EEC0, 0x36383940, 0x250B41C0, 0x2BE59640, 0x036DB0C0, 0x0D836740, 0x1EB01FC0, 0x105EC840,
+		0x912F59E0, 0x9FC18E60, 0x8CF2F6E0, 0x821C2160, 0xAA9407E0, 0xA47AD060, 0xB749A8E0, 0xB9A77F60,
+		0xE659E5E0, 0xE8B73260, 0xFB844AE0, 0xF56A9D60, 0xDDE2BBE0, 0xD30C6C60, 0xC03F14E0, 0xCED1C360,
+		0x7FC221E0, 0x712CF660, 0x621F8EE0, 0x6CF15960, 0x44797FE0, 0x4A97A860, 0x59A4D0E0, 0x574A0760,
+		0x08B49DE0, 0x065A4A60, 0x156932E0, 0x1B87E560, 0x330FC3E0, 0x3DE11460, 0x2ED26CE0, 0x203CBB60,
+	},
+#endif
+#if CRC_SLICE_BY > 4
+	{
+		0x00000000, 0x6EAB1A20, 0xDD563440, 0xB3FD2E60, 0x5714EBA0, 0x39BFF180, 0x8A42DFE0, 0xE4E9C5C0,
+		0xAE29D740, 0xC082CD60, 0x737FE300, 0x1DD4F920, 0xF93D3CE0, 0x979626C0, 0x246B08A0, 0x4AC01280,
+		0xB1EB2DA0, 0xDF403780, 0x6CBD19E0, 0x021603C0, 0xE6FFC600, 0x8854DC20, 0x3BA9F240, 0x5502E860,
+		0x1FC2FAE0, 0x7169E0C0, 0xC294CEA0, 0xAC3FD480, 0x48D61140, 0x267D0B60, 0x95802500, 0xFB2B3F20,
+		0x8E6ED860, 0xE0C5C240, 0x5338EC20, 0x3D93F600, 0xD97A33C0, 0xB7D129E0, 0x042C0780, 0x6A871DA0,
+		0x20470F20, 0x4EEC1500, 0xFD113B60, 0x93BA2140, 0x7753E480, 0x19F8FEA0, 0xAA05D0C0, 0xC4AECAE0,
+		0x3F85F5C0, 0x512EEFE0, 0xE2D3C180, 0x8C78DBA0, 0x68911E60, 0x063A0440, 0xB5C72A20, 0xDB6C3000,
+		0x91AC2280, 0xFF0738A0, 0x4CFA16C0, 0x22510CE0, 0xC6B8C920, 0xA813D300, 0x1BEEFD60, 0x7545E740,
+		0xF16533E0, 0x9FCE29C0, 0x2C3307A0, 0x42981D80, 0xA671D840, 0xC8DAC260, 0x7B27EC00, 0x158CF620,
+		0x5F4CE4A0, 0x31E7FE80, 0x821AD0E0, 0xECB1CAC0, 0x08580F00, 0x66F31520, 0xD50E3B40, 0xBBA52160,
+		0x408E1E40, 0x2E250460, 0x9DD82A00, 0xF3733020, 0x179AF5E0, 0x7931EFC0, 0xCACCC1A0, 0xA467DB80,
+		0xEEA7C900, 0x800CD320, 0x33F1FD40, 0x5D5AE760, 0xB9B322A0, 0xD7183880, 0x64E516E0, 0x0A4E0CC0,
+		0x7F0BEB80, 0x11A0F1A0, 0xA25DDFC0, 0xCCF6C5E0, 0x281F0020, 0x46B41A00, 0xF5493460, 0x9BE22E40,
+		0xD1223CC0, 0xBF8926E0, 0x0C740880, 0x62DF12A0, 0x8636D760, 0xE89DCD40, 0x5B60E320, 0x35CBF900,
+		0xCEE0C620, 0xA04BDC00, 0x13B6F260, 0x7D1DE840, 0x99F42D80, 0xF75F37A0, 0x44A219C0, 0x2A0903E0,
+		0x60C91160, 0x0E620B40, 0xBD9F2520, 0xD3343F00, 0x37DDFAC0, 0x5976E0E0, 0xEA8BCE80, 0x8420D4A0,
+		0x0F72E4E0, 0x61D9FEC0, 0xD224D0A0, 0xBC8FCA80, 0x58660F40, 0x36CD1560, 0x85303B00, 0xEB9B2120,
+		0xA15B33A0, 0xCFF02980, 0x7C0D07E0, 0x12A61DC0, 0xF64FD800, 0x98E4C220, 0x2B19EC40, 0x45B2F660,
+		0xBE99C940, 0xD032D360, 0x63CFFD00, 0x0D64E720, 0xE98D22E0, 0x872638C0, 0x34DB16A0, 0x5A700C80,
+		0x10B01E00, 0x7E1B0420, 0xCDE62A40, 0xA34D3060, 0x47A4F5A0, 0x290FEF80, 0x9AF2C1E0, 0xF459DBC0,
+		0x811C3C80, 0xEFB726A0, 0x5C4A08C0, 0x32E112E0, 0xD608D720, 0xB8A3CD00, 0x0B5EE360, 0x65F5F940,
+		0x2F35EBC0, 0x419EF1E0, 0xF263DF80, 0x9CC8C5A0, 0x78210060, 0x168A1A40, 0xA5773420, 0xCBDC2E00,
+		0x30F71120, 0x5E5C0B00, 0xEDA12560, 0x830A3F40, 0x67E3FA80, 0x0948E0A0, 0xBAB5CEC0, 0xD41ED4E0,
+		0x9EDEC660, 0xF075DC40, 0x4388F220, 0x2D23E800, 0xC9CA2DC0, 0xA76137E0, 0x149C1980, 0x7A3703A0,
+		0xFE17D700, 0x90BCCD20, 0x2341E340, 0x4DEAF960, 0xA9033CA0, 0xC7A82680, 0x745508E0, 0x1AFE12C0,
+		0x503E0040, 0x3E951A60, 0x8D683400, 0xE3C32E20, 0x072AEBE0, 0x6981F1C0, 0xDA7CDFA0, 0xB4D7C580,
+		0x4FFCFAA0, 0x2157E080, 0x92AACEE0, 0xFC01D4C0, 0x18E81100, 0x76430B20, 0xC5BE2540, 0xAB153F60,
+		0xE1D52DE0, 0x8F7E37C0, 0x3C8319A0, 0x52280380, 0xB6C1C640, 0xD86ADC60, 0x6B97F200, 0x053CE820,
+		0x70790F60, 0x1ED21540, 0xAD2F3B20, 0xC3842100, 0x276DE4C0, 0x49C6FEE0, 0xFA3BD080, 0x9490CAA0,
+		0xDE50D820, 0xB0FBC200, 0x0306EC60, 0x6DADF640, 0x89443380, 0xE7EF29A0, 0x541207C0, 0x3AB91DE0,
+		0xC19222C0, 0xAF3938E0, 0x1CC41680, 0x726F0CA0, 0x9686C960, 0xF82DD340, 0x4BD0FD20, 0x257BE700,
+		0x6FBBF580, 0x0110EFA0, 0xB2EDC1C0, 0xDC46DBE0, 0x38AF1E20, 0x56040400, 0xE5F92A60, 0x8B523040,
+	},
+	{
+		0x00000000, 0x1EE5C9C0, 0x3DCB9380, 0x232E5A40, 0x7B972700, 0x6572EEC0, 0x465CB480, 0x58B97D40,
+		0xF72E4E00, 0xE9CB87C0, 0xCAE5DD80, 0xD4001440, 0x8CB96900, 0x925CA0C0, 0xB172FA80, 0xAF973340,
+		0x03E41F20, 0x1D01D6E0, 0x3E2F8CA0, 0x20CA4560, 0x78733820, 0x6696F1E0, 0x45B8ABA0, 0x5B5D6260,
+		0xF4CA5120, 0xEA2F98E0, 0xC901C2A0, 0xD7E40B60, 0x8F5D7620, 0x91B8BFE0, 0xB296E5A0, 0xAC732C60,
+		0x07C83E40, 0x192DF780, 0x3A03ADC0, 0x24E66400, 0x7C5F1940, 0x62BAD080, 0x41948AC0, 0x5F714300,
+		0xF0E67040, 0xEE03B980, 0xCD2DE3C0, 0xD3C82A00, 0x8B715740, 0x95949E80, 0xB6BAC4C0, 0xA85F0D00,
+		0x042C2160, 0x1AC9E8A0, 0x39E7B2E0, 0x27027B20, 0x7FBB0660, 0x615ECFA0, 0x427095E0, 0x5C955C20,
+		0xF3026F60, 0xEDE7A6A0, 0xCEC9FCE0, 0xD02C3520, 0x88954860, 0x967081A0, 0xB55EDBE0, 0xABBB1220,
+		0x0F907C80, 0x1175B540, 0x325BEF00, 0x2CBE26C0, 0x74075B80, 0x6AE29240, 0x49CCC800, 0x572901C0,
+		0xF8BE3280, 0xE65BFB40, 0xC575A100, 0xDB9068C0, 0x83291580, 0x9DCCDC40, 0xBEE28600, 0xA0074FC0,
+		0x0C7463A0, 0x1291AA60, 0x31BFF020, 0x2F5A39E0, 0x77E344A0, 0x69068D60, 0x4A28D720, 0x54CD1EE0,
+		0xFB5A2DA0, 0xE5BFE460, 0xC691BE20, 0xD87477E0, 0x80CD0AA0, 0x9E28C360, 0xBD069920, 0xA3E350E0,
+		0x085842C0, 0x16BD8B00, 0x3593D140, 0x2B761880, 0x73CF65C0, 0x6D2AAC00, 0x4E04F640, 0x50E13F80,
+		0xFF760CC0, 0xE193C500, 0xC2BD9F40, 0xDC585680, 0x84E12BC0, 0x9A04E200, 0xB92AB840, 0xA7CF7180,
+		0x0BBC5DE0, 0x15599420, 0x3677CE60, 0x289207A0, 0x702B7AE0, 0x6ECEB320, 0x4DE0E960, 0x530520A0,
+		0xFC9213E0, 0xE277DA20, 0xC1598060, 0xDFBC49A0, 0x870534E0, 0x99E0FD20, 0xBACEA760, 0xA42B6EA0,
+		0x1F20F900, 0x01C530C0, 0x22EB6A80, 0x3C0EA340, 0x64B7DE00, 0x7A5217C0, 0x597C4D80, 0x47998440,
+		0xE80EB700, 0xF6EB7EC0, 0xD5C52480, 0xCB20ED40, 0x93999000, 0x8D7C59C0, 0xAE520380, 0xB0B7CA40,
+		0x1CC4E620, 0x02212FE0, 0x210F75A0, 0x3FEABC60, 0x6753C120, 0x79B608E0, 0x5A9852A0, 0x447D9B60,
+		0xEBEAA820, 0xF50F61E0, 0xD6213BA0, 0xC8C4F260, 0x907D8F20, 0x8E9846E0, 0xADB61CA0, 0xB353D560,
+		0x18E8C740, 0x060D0E80, 0x252354C0, 0x3BC69D00, 0x637FE040, 0x7D9A2980, 0x5EB473C0, 0x4051BA00,
+		0xEFC68940, 0xF1234080, 0xD20D1AC0, 0xCCE8D300, 0x9451AE40, 0x8AB46780, 0xA99A3DC0, 0xB77FF400,
+		0x1B0CD860, 0x05E911A0, 0x26C74BE0, 0x38228220, 0x609BFF60, 0x7E7E36A0, 0x5D506CE0, 0x43B5A520,
+		0xEC229660, 0xF2C75FA0, 0xD1E905E0, 0xCF0CCC20, 0x97B5B160, 0x895078A0, 0xAA7E22E0, 0xB49BEB20,
+		0x10B08580, 0x0E554C40, 0x2D7B1600, 0x339EDFC0, 0x6B27A280, 0x75C26B40, 0x56EC3100, 0x4809F8C0,
+		0xE79ECB80, 0xF97B0240, 0xDA555800, 0xC4B091C0, 0x9C09EC80, 0x82EC2540, 0xA1C27F00, 0xBF27B6C0,
+		0x13549AA0, 0x0DB15360, 0x2E9F0920, 0x307AC0E0, 0x68C3BDA0, 0x76267460, 0x55082E20, 0x4BEDE7E0,
+		0xE47AD4A0, 0xFA9F1D60, 0xD9B14720, 0xC7548EE0, 0x9FEDF3A0, 0x81083A60, 0xA2266020, 0xBCC3A9E0,
+		0x1778BBC0, 0x099D7200, 0x2AB32840, 0x3456E180, 0x6CEF9CC0, 0x720A5500, 0x51240F40, 0x4FC1C680,
+		0xE056F5C0, 0xFEB33C00, 0xDD9D6640, 0xC378AF80, 0x9BC1D2C0, 0x85241B00, 0xA60A4140, 0xB8EF8880,
+		0x149CA4E0, 0x0A796D20, 0x29573760, 0x37B2FEA0, 0x6F0B83E0, 0x71EE4A20, 0x52C01060, 0x4C25D9A0,
+		0xE3B2EAE0, 0xFD572320, 0xDE797960, 0xC09CB0A0, 0x9825CDE0, 0x86C00420, 0xA5EE5E60, 0xBB0B97A0,
+	},
+	{
+		0x00000000, 0x3E41F200, 0x7C83E400, 0x42C21600, 0xF907C800, 0xC7463A00, 0x85842C00, 0xBBC5DE00,
+		0x1FB71320, 0x21F6E120, 0x6334F720, 0x5D750520, 0xE6B0DB20, 0xD8F12920, 0x9A333F20, 0xA472CD20,
+		0x3F6E2640, 0x012FD440, 0x43EDC240, 0x7DAC3040, 0xC669EE40, 0xF8281C40, 0xBAEA0A40, 0x84ABF840,
+		0x20D93560, 0x1E98C760, 0x5C5AD160, 0x621B2360, 0xD9DEFD60, 0xE79F0F60, 0xA55D1960, 0x9B1CEB60,
+		0x7EDC4C80, 0x409DBE80, 0x025FA880, 0x3C1E5A80, 0x87DB8480, 0xB99A7680, 0xFB586080, 0xC5199280,
+		0x616B5FA0, 0x5F2AADA0, 0x1DE8BBA0, 0x23A949A0, 0x986C97A0, 0xA62D65A0, 0xE4EF73A0, 0xDAAE81A0,
+		0x41B26AC0, 0x7FF398C0, 0x3D318EC0, 0x03707CC0, 0xB8B5A2C0, 0x86F450C0, 0xC43646C0, 0xFA77B4C0,
+		0x5E0579E0, 0x60448BE0, 0x22869DE0, 0x1CC76FE0, 0xA702B1E0, 0x994343E0, 0xDB8155E0, 0xE5C0A7E0,
+		0xFDB89900, 0xC3F96B00, 0x813B7D00, 0xBF7A8F00, 0x04BF5100, 0x3AFEA300, 0x783CB500, 0x467D4700,
+		0xE20F8A20, 0xDC4E7820, 0x9E8C6E20, 0xA0CD9C20, 0x1B084220, 0x2549B020, 0x678BA620, 0x59CA5420,
+		0xC2D6BF40, 0xFC974D40, 0xBE555B40, 0x8014A940, 0x3BD17740, 0x05908540, 0x47529340, 0x79136140,
+		0xDD61AC60, 0xE3205E60, 0xA1E24860, 0x9FA3BA60, 0x24666460, 0x1A279660, 0x58E58060, 0x66A47260,
+		0x8364D580, 0xBD252780, 0xFFE73180, 0xC1A6C380, 0x7A631D80, 0x4422EF80, 0x06E0F980, 0x38A10B80,
+		0x9CD3C6A0, 0xA29234A0, 0xE05022A0, 0xDE11D0A0, 0x65D40EA0, 0x5B95FCA0, 0x1957EAA0, 0x271618A0,
+		0xBC0AF3C0, 0x824B01C0, 0xC08917C0, 0xFEC8E5C0, 0x450D3BC0, 0x7B4CC9C0, 0x398EDFC0, 0x07CF2DC0,
+		0xA3BDE0E0, 0x9DFC12E0, 0xDF3E04E0, 0xE17FF6E0, 0x5ABA28E0, 0x64FBDAE0, 0x2639CCE0, 0x18783EE0,
+		0x16C9B120, 0x28884320, 0x6A4A5520, 0x540BA720, 0xEFCE7920, 0xD18F8B20, 0x934D9D20, 0xAD0C6F20,
+		0x097EA200, 0x373F5000, 0x75FD4600, 0x4BBCB400, 0xF0796A00, 0xCE389800, 0x8CFA8E00, 0xB2BB7C00,
+		0x29A79760, 0x17E66560, 0x55247360, 0x6B658160, 0xD0A05F60, 0xEEE1AD60, 0xAC23BB60, 0x92624960,
+		0x36108440, 0x08517640, 0x4A936040, 0x74D29240, 0xCF174C40, 0xF156BE40, 0xB394A840, 0x8DD55A40,
+		0x6815FDA0, 0x56540FA0, 0x149619A0, 0x2AD7EBA0, 0x911235A0, 0xAF53C7A0, 0xED91D1A0, 0xD3D023A0,
+		0x77A2EE80, 0x49E31C80, 0x0B210A80, 0x3560F880, 0x8EA52680, 0xB0E4D480, 0xF226C280, 0xCC673080,
+		0x577BDBE0, 0x693A29E0, 0x2BF83FE0, 0x15B9CDE0, 0xAE7C13E0, 0x903DE1E0, 0xD2FFF7E0, 0xECBE05E0,
+		0x48CCC8C0, 0x768D3AC0, 0x344F2CC0, 0x0A0EDEC0, 0xB1CB00C0, 0x8F8AF2C0, 0xCD48E4C0, 0xF30916C0,
+		0xEB712820, 0xD530DA20, 0x97F2CC20, 0xA9B33E20, 0x1276E020, 0x2C371220, 0x6EF50420, 0x50B4F620,
+		0xF4C63B00, 0xCA87C900, 0x8845DF00, 0xB6042D00, 0x0DC1F300, 0x33800100, 0x71421700, 0x4F03E500,
+		0xD41F0E60, 0xEA5EFC60, 0xA89CEA60, 0x96DD1860, 0x2D18C660, 0x13593460, 0x519B2260, 0x6FDAD060,
+		0xCBA81D40, 0xF5E9EF40, 0xB72BF940, 0x896A0B40, 0x32AFD540, 0x0CEE2740, 0x4E2C3140, 0x706DC340,
+		0x95AD64A0, 0xABEC96A0, 0xE92E80A0, 0xD76F72A0, 0x6CAAACA0, 0x52EB5EA0, 0x102948A0, 0x2E68BAA0,
+		0x8A1A7780, 0xB45B8580, 0xF6999380, 0xC8D86180, 0x731DBF80, 0x4D5C4D80, 0x0F9E5B80, 0x31DFA980,
+		0xAAC342E0, 0x9482B0E0, 0xD640A6E0, 0xE80154E0, 0x53C48AE0, 0x6D8578E0, 0x2F476EE0, 0x11069CE0,
+		0xB57451C0, 0x8B35A3C0, 0xC9F7B5C0, 0xF7B647C0, 0x4C7399C0, 0x72326BC0, 0x30F07DC0, 0x0EB18FC0,
+	},
+	{
+		0x00000000, 0x2D936240, 0x5B26C480, 0x76B5A6C0, 0xB64D8900, 0x9BDEEB40, 0xED6B4D80, 0xC0F82FC0,
+		0x81239120, 0xACB0F360, 0xDA0555A0, 0xF79637E0, 0x376E1820, 0x1AFD7A60, 0x6C48DCA0, 0x41DBBEE0,
+		0xEFFFA160, 0xC26CC320, 0xB4D965E0, 0x994A07A0, 0x59B22860, 0x74214A20, 0x0294ECE0, 0x2F078EA0,
+		0x6EDC3040, 0x434F5200, 0x35FAF4C0, 0x18699680, 0xD891B940, 0xF502DB00, 0x83B77DC0, 0xAE241F80,
+		0x3247C1E0, 0x1FD4A3A0, 0x69610560, 0x44F26720, 0x840A48E0, 0xA9992AA0, 0xDF2C8C60, 0xF2BFEE20,
+		0xB36450C0, 0x9EF73280, 0xE8429440, 0xC5D1F600, 0x0529D9C0, 0x28BABB80, 0x5E0F1D40, 0x739C7F00,
+		0xDDB86080, 0xF02B02C0, 0x869EA400, 0xAB0DC640, 0x6BF5E980, 0x46668BC0, 0x30D32D00, 0x1D404F40,
+		0x5C9BF1A0, 0x710893E0, 0x07BD3520, 0x2A2E5760, 0xEAD678A0, 0xC7451AE0, 0xB1F0BC20, 0x9C63DE60,
+		0x648F83C0, 0x491CE180, 0x3FA94740, 0x123A2500, 0xD2C20AC0, 0xFF516880, 0x89E4CE40, 0xA477AC00,
+		0xE5AC12E0, 0xC83F70A0, 0xBE8AD660, 0x9319B420, 0x53E19BE0, 0x7E72F9A0, 0x08C75F60, 0x25543D20,
+		0x8B7022A0, 0xA6E340E0, 0xD056E620, 0xFDC58460, 0x3D3DABA0, 0x10AEC9E0, 0x661B6F20, 0x4B880D60,
+		0x0A53B380, 0x27C0D1C0, 0x51757700, 0x7CE61540, 0xBC1E3A80, 0x918D58C0, 0xE738FE00, 0xCAAB9C40,
+		0x56C84220, 0x7B5B2060, 0x0DEE86A0, 0x207DE4E0, 0xE085CB20, 0xCD16A960, 0xBBA30FA0, 0x96306DE0,
+		0xD7EBD300, 0xFA78B140, 0x8CCD1780, 0xA15E75C0, 0x61A65A00, 0x4C353840, 0x3A809E80, 0x1713FCC0,
+		0xB937E340, 0x94A48100, 0xE21127C0, 0xCF824580, 0x0F7A6A40, 0x22E90800, 0x545CAEC0, 0x79CFCC80,
+		0x38147260, 0x15871020, 0x6332B6E0, 0x4EA1D4A0, 0x8E59FB60, 0xA3CA9920, 0xD57F3FE0, 0xF8EC5DA0,
+		0xC91F0780, 0xE48C65C0, 0x9239C300, 0xBFAAA140, 0x7F528E80, 0x52C1ECC0, 0x24744A00, 0x09E72840,
+		0x483C96A0, 0x65AFF4E0, 0x131A5220, 0x3E893060, 0xFE711FA0, 0xD3E27DE0, 0xA557DB20, 0x88C4B960,
+		0x26E0A6E0, 0x0B73C4A0, 0x7DC66260, 0x50550020, 0x90AD2FE0, 0xBD3E4DA0, 0xCB8BEB60, 0xE6188920,
+		0xA7C337C0, 0x8A505580, 0xFCE5F340, 0xD1769100, 0x118EBEC0, 0x3C1DDC80, 0x4AA87A40, 0x673B1800,
+		0xFB58C660, 0xD6CBA420, 0xA07E02E0, 0x8DED60A0, 0x4D154F60, 0x60862D20, 0x16338BE0, 0x3BA0E9A0,
+		0x7A7B5740, 0x57E83500, 0x215D93C0, 0x0CCEF180, 0xCC36DE40, 0xE1A5BC00, 0x97101AC0, 0xBA837880,
+		0x14A76700, 0x39340540, 0x4F81A380, 0x6212C1C0, 0xA2EAEE00, 0x8F798C40, 0xF9CC2A80, 0xD45F48C0,
+		0x9584F620, 0xB8179460, 0xCEA232A0, 0xE33150E0, 0x23C97F20, 0x0E5A1D60, 0x78EFBBA0, 0x557CD9E0,
+		0xAD908440, 0x8003E600, 0xF6B640C0, 0xDB252280, 0x1BDD0D40, 0x364E6F00, 0x40FBC9C0, 0x6D68AB80,
+		0x2CB31560, 0x01207720, 0x7795D1E0, 0x5A06B3A0, 0x9AFE9C60, 0xB76DFE20, 0xC1D858E0, 0xEC4B3AA0,
+		0x426F2520, 0x6FFC4760, 0x1949E1A0, 0x34DA83E0, 0xF422AC20, 0xD9B1CE60, 0xAF0468A0, 0x82970AE0,
+		0xC34CB400, 0xEEDFD640, 0x986A7080, 0xB5F912C0, 0x75013D00, 0x58925F40, 0x2E27F980, 0x03B49BC0,
+		0x9FD745A0, 0xB24427E0, 0xC4F18120, 0xE962E360, 0x299ACCA0, 0x0409AEE0, 0x72BC0820, 0x5F2F6A60,
+		0x1EF4D480, 0x3367B6C0, 0x45D21000, 0x68417240, 0xA8B95D80, 0x852A3FC0, 0xF39F9900, 0xDE0CFB40,
+		0x7028E4C0, 0x5DBB8680, 0x2B0E2040, 0x069D4200, 0xC6656DC0, 0xEBF60F80, 0x9D43A940, 0xB0D0CB00,
+		0xF10B75E0, 0xDC9817A0, 0xAA2DB160, 0x87BED320, 0x4746FCE0, 0x6AD59EA0, 0x1C603860, 0x31F35A20,
+	},
+#endif
+};
+
+/// 24 bit, poly 0x864CFB
+static const uint32_t crc24qTable[CRC_SLICE_BY][256] = {
+	{
+		0x000000, 0x864CFB, 0x8AD50D, 0x0C99F6, 0x93E6E1, 0x15AA1A, 0x1933EC, 0x9F7F17,
+		0xA18139, 0x27CDC2, 0x2B5434, 0xAD18CF, 0x3267D8, 0xB42B23, 0xB8B2D5, 0x3EFE2E,
+		0xC54E89, 0x430272, 0x4F9B84, 0xC9D77F, 0x56A868, 0xD0E493, 0xDC7D65, 0x5A319E,
+		0x64CFB0, 0xE2834B, 0xEE1ABD, 0x685646, 0xF72951, 0x7165AA, 0x7DFC5C, 0xFBB0A7,
+		0x0CD1E9, 0x8A9D12, 0x8604E4, 0x00481F, 0x9F3708, 0x197BF3, 0x15E205, 0x93AEFE,
+		0xAD50D0, 0x2B1C2B, 0x2785DD, 0xA1C926, 0x3EB631, 0xB8FACA, 0xB4633C, 0x322FC7,
+		0xC99F60, 0x4FD39B, 0x434A6D, 0xC50696, 0x5A7981, 0xDC357A, 0xD0AC8C, 0x56E077,
+		0x681E59, 0xEE52A2, 0xE2CB54, 0x6487AF, 0xFBF8B8, 0x7DB443, 0x712DB5, 0xF7614E,
+		0x19A3D2, 0x9FEF29, 0x9376DF, 0x153A24, 0x8A4533, 0x0C09C8, 0x00903E, 0x86DCC5,
+		0xB822EB, 0x3E6E10, 0x32F7E6, 0xB4BB1D, 0x2BC40A, 0xAD88F1, 0xA11107, 0x275DFC,
+		0xDCED5B, 0x5AA1A0, 0x563856, 0xD074AD, 0x4F0BBA, 0xC94741, 0xC5DEB7, 0x43924C,
+		0x7D6C62, 0xFB2099, 0xF7B96F, 0x71F594, 0xEE8A83, 0x68C678, 0x645F8E, 0xE21375,
+		0x15723B, 0x933EC0, 0x9FA736, 0x19EBCD, 0x8694DA, 0x00D821, 0x0C41D7, 0x8A0D2C,
+		0xB4F302, 0x32BFF9, 0x3E260F, 0xB86AF4, 0x2715E3, 0xA15918, 0xADC0EE, 0x2B8C15,
+		0xD03CB2, 0x567049, 0x5AE9BF, 0xDCA544, 0x43DA53, 0xC596A8, 0xC90F5E, 0x4F43A5,
+		0x71BD8B, 0xF7F170, 0xFB6886, 0x7D247D, 0xE25B6A, 0x641791, 0x688E67, 0xEEC29C,
+		0x3347A4, 0xB50B5F, 0xB992A9, 0x3FDE52, 0xA0A145, 0x26EDBE, 0x2A7448, 0xAC38B3,
+		0x92C69D, 0x148A66, 0x181390, 0x9E5F6B, 0x01207C, 0x876C87, 0x8BF571, 0x0DB98A,
+		0xF6092D, 0x7045D6, 0x7CDC20, 0xFA90DB, 0x65EFCC, 0xE3A337, 0xEF3AC1, 0x69763A,
+		0x578814, 0xD1C4EF, 0xDD5D19, 0x5B11E2, 0xC46EF5, 0x42220E, 0x4EBBF8, 0xC8F703,
+		0x3F964D, 0xB9DAB6, 0xB54340, 0x330FBB, 0xAC70AC, 0x2A3C57, 0x26A5A1, 0xA0E95A,
+		0x9E1774, 0x185B8F, 0x14C279, 0x928E82, 0x0DF195, 0x8BBD6E, 0x872498, 0x016863,
+		0xFAD8C4, 0x7C943F, 0x700DC9, 0xF64132, 0x693E25, 0xEF72DE, 0xE3EB28, 0x65A7D3,
+		0x5B59FD, 0xDD1506, 0xD18CF0, 0x57C00B, 0xC8BF1C, 0x4EF3E7, 0x426A11, 0xC426EA,
+		0x2AE476, 0xACA88D, 0xA0317B, 0x267D80, 0xB90297, 0x3F4E6C, 0x33D79A, 0xB59B61,
+		0x8B654F, 0x0D29B4, 0x01B042, 0x87FCB9, 0x1883AE, 0x9ECF55, 0x9256A3, 0x141A58,
+		0xEFAAFF, 0x69E604, 0x657FF2, 0xE33309, 0x7C4C1E, 0xFA00E5, 0xF69913, 0x70D5E8,
+		0x4E2BC6, 0xC8673D, 0xC4FECB, 0x42B230, 0xDDCD27, 0x5B81DC, 0x57182A, 0xD154D1,
+		0x26359F, 0xA07964, 0xACE092, 0x2AAC69, 0xB5D37E, 0x339F85, 0x3F0673, 0xB94A88,
+		0x87B4A6, 0x01F85D, 0x0D61AB, 0x8B2D50, 0x145247, 0x921EBC, 0x9E874A, 0x18CBB1,
+		0xE37B16, 0x6537ED, 0x69AE1B, 0xEFE2E0, 0x709DF7, 0xF6D10C, 0xFA48FA, 0x7C0401,
+		0x42FA2F, 0xC4B6D4, 0xC82F22, 0x4E63D9, 0xD11CCE, 0x575035, 0x5BC9C3, 0xDD8538,
+	},
+#if CRC_SLICE_BY > 1
+	{
+		0x000000, 0x668F48, 0xCD1E90, 0xAB91D8, 0x1C71DB, 0x7AFE93, 0xD16F4B, 0xB7E003,
+		0x38E3B6, 0x5E6CFE, 0xF5FD26, 0x93726E, 0x24926D, 0x421D25, 0xE98CFD, 0x8F03B5,
+		0x71C76C, 0x174824, 0xBCD9FC, 0xDA56B4, 0x6DB6B7, 0x0B39FF, 0xA0A827, 0xC6276F,
+		0x4924DA, 0x2FAB92, 0x843A4A, 0xE2B502, 0x555501, 0x33DA49, 0x984B91, 0xFEC4D9,
+		0xE38ED8, 0x850190, 0x2E9048, 0x481F00, 0xFFFF03, 0x99704B, 0x32E193, 0x546EDB,
+		0xDB6D6E, 0xBDE226, 0x1673FE, 0x70FCB6, 0xC71CB5, 0xA193FD, 0x0A0225, 0x6C8D6D,
+		0x9249B4, 0xF4C6FC, 0x5F5724, 0x39D86C, 0x8E386F, 0xE8B727, 0x4326FF, 0x25A9B7,
+		0xAAAA02, 0xCC254A, 0x67B492, 0x013BDA, 0xB6DBD9, 0xD05491, 0x7BC549, 0x1D4A01,
+		0x41514B, 0x27DE03, 0x8C4FDB, 0xEAC093, 0x5D2090, 0x3BAFD8, 0x903E00, 0xF6B148,
+		0x79B2FD, 0x1F3DB5, 0xB4AC6D, 0xD22325, 0x65C326, 0x034C6E, 0xA8DDB6, 0xCE52FE,
+		0x309627, 0x56196F, 0xFD88B7, 0x9B07FF, 0x2CE7FC, 0x4A68B4, 0xE1F96C, 0x877624,
+		0x087591, 0x6EFAD9, 0xC56B01, 0xA3E449, 0x14044A, 0x728B02, 0xD91ADA, 0xBF9592,
+		0xA2DF93, 0xC450DB, 0x6FC103, 0x094E4B, 0xBEAE48, 0xD82100, 0x73B0D8, 0x153F90,
+		0x9A3C25, 0xFCB36D, 0x5722B5, 0x31ADFD, 0x864DFE, 0xE0C2B6, 0x4B536E, 0x2DDC26,
+		0xD318FF, 0xB597B7, 0x1E066F, 0x788927, 0xCF6924, 0xA9E66C, 0x0277B4, 0x64F8FC,
+		0xEBFB49, 0x8D7401, 0x26E5D9, 0x406A91, 0xF78A92, 0x9105DA, 0x3A9402, 0x5C1B4A,
+		0x82A296, 0xE42DDE, 0x4FBC06, 0x29334E, 0x9ED34D, 0xF85C05, 0x53CDDD, 0x354295,
+		0xBA4120, 0xDCCE68, 0x775FB0, 0x11D0F8, 0xA630FB, 0xC0BFB3, 0x6B2E6B, 0x0DA123,
+		0xF365FA, 0x95EAB2, 0x3E7B6A, 0x58F422, 0xEF1421, 0x899B69, 0x220AB1, 0x4485F9,
+		0xCB864C, 0xAD0904, 0x0698DC, 0x601794, 0xD7F797, 0xB178DF, 0x1AE907, 0x7C664F,
+		0x612C4E, 0x07A306, 0xAC32DE, 0xCABD96, 0x7D5D95, 0x1BD2DD, 0xB04305, 0xD6CC4D,
+		0x59CFF8, 0x3F40B0, 0x94D168, 0xF25E20, 0x45BE23, 0x23316B, 0x88A0B3, 0xEE2FFB,
+		0x10EB22, 0x76646A, 0xDDF5B2, 0xBB7AFA, 0x0C9AF9, 0x6A15B1, 0xC18469, 0xA70B21,
+		0x280894, 0x4E87DC, 0xE51604, 0x83994C, 0x34794F, 0x52F607, 0xF967DF, 0x9FE897,
+		0xC3F3DD, 0xA57C95, 0x0EED4D, 0x686205, 0xDF8206, 0xB90D4E, 0x129C96, 0x7413DE,
+		0xFB106B, 0x9D9F23, 0x360EFB, 0x5081B3, 0xE761B0, 0x81EEF8, 0x2A7F20, 0x4CF068,
+		0xB234B1, 0xD4BBF9, 0x7F2A21, 0x19A569, 0xAE456A, 0xC8CA22, 0x635BFA, 0x05D4B2,
+		0x8AD707, 0xEC584F, 0x47C997, 0x2146DF, 0x96A6DC, 0xF02994, 0x5BB84C, 0x3D3704,
+		0x207D05, 0x46F24D, 0xED6395, 0x8BECDD, 0x3C0CDE, 0x5A8396, 0xF1124E, 0x979D06,
+		0x189EB3, 0x7E11FB, 0xD58023, 0xB30F6B, 0x04EF68, 0x626020, 0xC9F1F8, 0xAF7EB0,
+		0x51BA69, 0x373521, 0x9CA4F9, 0xFA2BB1, 0x4DCBB2, 0x2B44FA, 0x80D522, 0xE65A6A,
+		0x6959DF, 0x0FD697, 0xA4474F, 0xC2C807, 0x752804, 0x13A74C, 0xB83694, 0xDEB9DC,
+	},
+	{
+		0x000000, 0x8309D7, 0x805F55, 0x035682, 0x86F251, 0x05FB86, 0x06AD04, 0x85A4D3,
+		0x8BA859, 0x08A18E, 0x0BF70C, 0x88FEDB, 0x0D5A08, 0x8E53DF, 0x8D055D, 0x0E0C8A,
+		0x911C49, 0x12159E, 0x11431C, 0x924ACB, 0x17EE18, 0x94E7CF, 0x97B14D, 0x14B89A,
+		0x1AB410, 0x99BDC7, 0x9AEB45, 0x19E292, 0x9C4641, 0x1F4F96, 0x1C1914, 0x9F10C3,
+		0xA47469, 0x277DBE, 0x242B3C, 0xA722EB, 0x228638, 0xA18FEF, 0xA2D96D, 0x21D0BA,
+		0x2FDC30, 0xACD5E7, 0xAF8365, 0x2C8AB2, 0xA92E61, 0x2A27B6, 0x297134, 0xAA78E3,
+		0x356820, 0xB661F7, 0xB53775, 0x363EA2, 0xB39A71, 0x3093A6, 0x33C524, 0xB0CCF3,
+		0xBEC079, 0x3DC9AE, 0x3E9F2C, 0xBD96FB, 0x383228, 0xBB3BFF, 0xB86D7D, 0x3B64AA,
+		0xCEA429, 0x4DADFE, 0x4EFB7C, 0xCDF2AB, 0x485678, 0xCB5FAF, 0xC8092D, 0x4B00FA,
+		0x450C70, 0xC605A7, 0xC55325, 0x465AF2, 0xC3FE21, 0x40F7F6, 0x43A174, 0xC0A8A3,
+		0x5FB860, 0xDCB1B7, 0xDFE735, 0x5CEEE2, 0xD94A31, 0x5A43E6, 0x591564, 0xDA1CB3,
+		0xD41039, 0x5719EE, 0x544F6C, 0xD746BB, 0x52E268, 0xD1EBBF, 0xD2BD3D, 0x51B4EA,
+		0x6AD040, 0xE9D997, 0xEA8F15, 0x6986C2, 0xEC2211, 0x6F2BC6, 0x6C7D44, 0xEF7493,
+		0xE17819, 0x6271CE, 0x61274C, 0xE22E9B, 0x678A48, 0xE4839F, 0xE7D51D, 0x64DCCA,
+		0xFBCC09, 0x78C5DE, 0x7B935C, 0xF89A8B, 0x7D3E58, 0xFE378F, 0xFD610D, 0x7E68DA,
+		0x706450, 0xF36D87, 0xF03B05, 0x7332D2, 0xF69601, 0x759FD6, 0x76C954, 0xF5C083,
+		0x1B04A9, 0x980D7E, 0x9B5BFC, 0x18522B, 0x9DF6F8, 0x1EFF2F, 0x1DA9AD, 0x9EA07A,
+		0x90ACF0, 0x13A527, 0x10F3A5, 0x93FA72, 0x165EA1, 0x955776, 0x9601F4, 0x150823,
+		0x8A18E0, 0x091137, 0x0A47B5, 0x894E62, 0x0CEAB1, 0x8FE366, 0x8CB5E4, 0x0FBC33,
+		0x01B0B9, 0x82B96E, 0x81EFEC, 0x02E63B, 0x8742E8, 0x044B3F, 0x071DBD, 0x84146A,
+		0xBF70C0, 0x3C7917, 0x3F2F95, 0xBC2642, 0x398291, 0xBA8B46, 0xB9DDC4, 0x3AD413,
+		0x34D899, 0xB7D14E, 0xB487CC, 0x378E1B, 0xB22AC8, 0x31231F, 0x32759D, 0xB17C4A,
+		0x2E6C89, 0xAD655E, 0xAE33DC, 0x2D3A0B, 0xA89ED8, 0x2B970F, 0x28C18D, 0xABC85A,
+		0xA5C4D0, 0x26CD07, 0x259B85, 0xA69252, 0x233681, 0xA03F56, 0xA369D4, 0x206003,
+		0xD5A080, 0x56A957, 0x55FFD5, 0xD6F602, 0x5352D1, 0xD05B06, 0xD30D84, 0x500453,
+		0x5E08D9, 0xDD010E, 0xDE578C, 0x5D5E5B, 0xD8FA88, 0x5BF35F, 0x58A5DD, 0xDBAC0A,
+		0x44BCC9, 0xC7B51E, 0xC4E39C, 0x47EA4B, 0xC24E98, 0x41474F, 0x4211CD, 0xC1181A,
+		0xCF1490, 0x4C1D47, 0x4F4BC5, 0xCC4212, 0x49E6C1, 0xCAEF16, 0xC9B994, 0x4AB043,
+		0x71D4E9, 0xF2DD3E, 0xF18BBC, 0x72826B, 0xF726B8, 0x742F6F, 0x7779ED, 0xF4703A,
+		0xFA7CB0, 0x797567, 0x7A23E5, 0xF92A32, 0x7C8EE1, 0xFF8736, 0xFCD1B4, 0x7FD863,
+		0xE0C8A0, 0x63C177, 0x6097F5, 0xE39E22, 0x663AF1, 0xE53326, 0xE665A4, 0x656C73,
+		0x6B60F9, 0xE8692E, 0xEB3FAC, 0x68367B, 0xED92A8, 0x6E9B7F, 0x6DCDFD, 0xEEC42A,
+	},
+	{
+		0x000000, 0x360952, 0x6C12A4, 0x5A1BF6, 0xD82548, 0xEE2C1A, 0xB437EC, 0x823EBE,
+		0x36066B, 0x000F39, 0x5A14CF, 0x6C1D9D, 0xEE2323, 0xD82A71, 0x823187, 0xB438D5,
+		0x6C0CD6, 0x5A0584, 0x001E72, 0x361720, 0xB4299E, 0x8220CC, 0xD83B3A, 0xEE3268,
+		0x5A0ABD, 0x6C03EF, 0x361819, 0x00114B, 0x822FF5, 0xB426A7, 0xEE3D51, 0xD83403,
+		0xD819AC, 0xEE10FE, 0xB40B08, 0x82025A, 0x003CE4, 0x3635B6, 0x6C2E40, 0x5A2712,
+		0xEE1FC7, 0xD81695, 0x820D63, 0xB40431, 0x363A8F, 0x0033DD, 0x5A282B, 0x6C2179,
+		0xB4157A, 0x821C28, 0xD807DE, 0xEE0E8C, 0x6C3032, 0x5A3960, 0x002296, 0x362BC4,
+		0x821311, 0xB41A43, 0xEE01B5, 0xD808E7, 0x5A3659, 0x6C3F0B, 0x3624FD, 0x002DAF,
+		0x367FA3, 0x0076F1, 0x5A6D07, 0x6C6455, 0xEE5AEB, 0xD853B9, 0x82484F, 0xB4411D,
+		0x0079C8, 0x36709A, 0x6C6B6C, 0x5A623E, 0xD85C80, 0xEE55D2, 0xB44E24, 0x824776,
+		0x5A7375, 0x6C7A27, 0x3661D1, 0x006883, 0x82563D, 0xB45F6F, 0xEE4499, 0xD84DCB,
+		0x6C751E, 0x5A7C4C, 0x0067BA, 0x366EE8, 0xB45056, 0x825904, 0xD842F2, 0xEE4BA0,
+		0xEE660F, 0xD86F5D, 0x8274AB, 0xB47DF9, 0x364347, 0x004A15, 0x5A51E3, 0x6C58B1,
+		0xD86064, 0xEE6936, 0xB472C0, 0x827B92, 0x00452C, 0x364C7E, 0x6C5788, 0x5A5EDA,
+		0x826AD9, 0xB4638B, 0xEE787D, 0xD8712F, 0x5A4F91, 0x6C46C3, 0x365D35, 0x005467,
+		0xB46CB2, 0x8265E0, 0xD87E16, 0xEE7744, 0x6C49FA, 0x5A40A8, 0x005B5E, 0x36520C,
+		0x6CFF46, 0x5AF614, 0x00EDE2, 0x36E4B0, 0xB4DA0E, 0x82D35C, 0xD8C8AA, 0xEEC1F8,
+		0x5AF92D, 0x6CF07F, 0x36EB89, 0x00E2DB, 0x82DC65, 0xB4D537, 0xEECEC1, 0xD8C793,
+		0x00F390, 0x36FAC2, 0x6CE134, 0x5AE866, 0xD8D6D8, 0xEEDF8A, 0xB4C47C, 0x82CD2E,
+		0x36F5FB, 0x00FCA9, 0x5AE75F, 0x6CEE0D, 0xEED0B3, 0xD8D9E1, 0x82C217, 0xB4CB45,
+		0xB4E6EA, 0x82EFB8, 0xD8F44E, 0xEEFD1C, 0x6CC3A2, 0x5ACAF0, 0x00D106, 0x36D854,
+		0x82E081, 0xB4E9D3, 0xEEF225, 0xD8FB77, 0x5AC5C9, 0x6CCC9B, 0x36D76D, 0x00DE3F,
+		0xD8EA3C, 0xEEE36E, 0xB4F898, 0x82F1CA, 0x00CF74, 0x36C626, 0x6CDDD0, 0x5AD482,
+		0xEEEC57, 0xD8E505, 0x82FEF3, 0xB4F7A1, 0x36C91F, 0x00C04D, 0x5ADBBB, 0x6CD2E9,
+		0x5A80E5, 0x6C89B7, 0x369241, 0x009B13, 0x82A5AD, 0xB4ACFF, 0xEEB709, 0xD8BE5B,
+		0x6C868E, 0x5A8FDC, 0x00942A, 0x369D78, 0xB4A3C6, 0x82AA94, 0xD8B162, 0xEEB830,
+		0x368C33, 0x008561, 0x5A9E97, 0x6C97C5, 0xEEA97B, 0xD8A029, 0x82BBDF, 0xB4B28D,
+		0x008A58, 0x36830A, 0x6C98FC, 0x5A91AE, 0xD8AF10, 0xEEA642, 0xB4BDB4, 0x82B4E6,
+		0x829949, 0xB4901B, 0xEE8BED, 0xD882BF, 0x5ABC01, 0x6CB553, 0x36AEA5, 0x00A7F7,
+		0xB49F22, 0x829670, 0xD88D86, 0xEE84D4, 0x6CBA6A, 0x5AB338, 0x00A8CE, 0x36A19C,
+		0xEE959F, 0xD89CCD, 0x82873B, 0xB48E69, 0x36B0D7, 0x00B985, 0x5AA273, 0x6CAB21,
+		0xD893F4, 0xEE9AA6, 0xB48150, 0x828802, 0x00B6BC, 0x36BFEE, 0x6CA418, 0x5AAD4A,
+	},
+#endif
+#if CRC_SLICE_BY > 4
+	{
+		0x000000, 0xD9FE8C, 0x35B1E3, 0xEC4F6F, 0x6B63C6, 0xB29D4A, 0x5ED225, 0x872CA9,
+		0xD6C78C, 0x0F3900, 0xE3766F, 0x3A88E3, 0xBDA44A, 0x645AC6, 0x8815A9, 0x51EB25,
+		0x2BC3E3, 0xF23D6F, 0x1E7200, 0xC78C8C, 0x40A025, 0x995EA9, 0x7511C6, 0xACEF4A,
+		0xFD046F, 0x24FAE3, 0xC8B58C, 0x114B00, 0x9667A9, 0x4F9925, 0xA3D64A, 0x7A28C6,
+		0x5787C6, 0x8E794A, 0x623625, 0xBBC8A9, 0x3CE400, 0xE51A8C, 0x0955E3, 0xD0AB6F,
+		0x81404A, 0x58BEC6, 0xB4F1A9, 0x6D0F25, 0xEA238C, 0x33DD00, 0xDF926F, 0x066CE3,
+		0x7C4425, 0xA5BAA9, 0x49F5C6, 0x900B4A, 0x1727E3, 0xCED96F, 0x229600, 0xFB688C,
+		0xAA83A9, 0x737D25, 0x9F324A, 0x46CCC6, 0xC1E06F, 0x181EE3, 0xF4518C, 0x2DAF00,
+		0xAF0F8C, 0x76F100, 0x9ABE6F, 0x4340E3, 0xC46C4A, 0x1D92C6, 0xF1DDA9, 0x282325,
+		0x79C800, 0xA0368C, 0x4C79E3, 0x95876F, 0x12ABC6, 0xCB554A, 0x271A25, 0xFEE4A9,
+		0x84CC6F, 0x5D32E3, 0xB17D8C, 0x688300, 0xEFAFA9, 0x365125, 0xDA1E4A, 0x03E0C6,
+		0x520BE3, 0x8BF56F, 0x67BA00, 0xBE448C, 0x396825, 0xE096A9, 0x0CD9C6, 0xD5274A,
+		0xF8884A, 0x2176C6, 0xCD39A9, 0x14C725, 0x93EB8C, 0x4A1500, 0xA65A6F, 0x7FA4E3,
+		0x2E4FC6, 0xF7B14A, 0x1BFE25, 0xC200A9, 0x452C00, 0x9CD28C, 0x709DE3, 0xA9636F,
+		0xD34BA9, 0x0AB525, 0xE6FA4A, 0x3F04C6, 0xB8286F, 0x61D6E3, 0x8D998C, 0x546700,
+		0x058C25, 0xDC72A9, 0x303DC6, 0xE9C34A, 0x6EEFE3, 0xB7116F, 0x5B5E00, 0x82A08C,
+		0xD853E3, 0x01AD6F, 0xEDE200, 0x341C8C, 0xB33025, 0x6ACEA9, 0x8681C6, 0x5F7F4A,
+		0x0E946F, 0xD76AE3, 0x3B258C, 0xE2DB00, 0x65F7A9, 0xBC0925, 0x50464A, 0x89B8C6,
+		0xF39000, 0x2A6E8C, 0xC621E3, 0x1FDF6F, 0x98F3C6, 0x410D4A, 0xAD4225, 0x74BCA9,
+		0x25578C, 0xFCA900, 0x10E66F, 0xC918E3, 0x4E344A, 0x97CAC6, 0x7B85A9, 0xA27B25,
+		0x8FD425, 0x562AA9, 0xBA65C6, 0x639B4A, 0xE4B7E3, 0x3D496F, 0xD10600, 0x08F88C,
+		0x5913A9, 0x80ED25, 0x6CA24A, 0xB55CC6, 0x32706F, 0xEB8EE3, 0x07C18C, 0xDE3F00,
+		0xA417C6, 0x7DE94A, 0x91A625, 0x4858A9, 0xCF7400, 0x168A8C, 0xFAC5E3, 0x233B6F,
+		0x72D04A, 0xAB2EC6, 0x4761A9, 0x9E9F25, 0x19B38C, 0xC04D00, 0x2C026F, 0xF5FCE3,
+		0x775C6F, 0xAEA2E3, 0x42ED8C, 0x9B1300, 0x1C3FA9, 0xC5C125, 0x298E4A, 0xF070C6,
+		0xA19BE3, 0x78656F, 0x942A00, 0x4DD48C, 0xCAF825, 0x1306A9, 0xFF49C6, 0x26B74A,
+		0x5C9F8C, 0x856100, 0x692E6F, 0xB0D0E3, 0x37FC4A, 0xEE02C6, 0x024DA9, 0xDBB325,
+		0x8A5800, 0x53A68C, 0xBFE9E3, 0x66176F, 0xE13BC6, 0x38C54A, 0xD48A25, 0x0D74A9,
+		0x20DBA9, 0xF92525, 0x156A4A, 0xCC94C6, 0x4BB86F, 0x9246E3, 0x7E098C, 0xA7F700,
+		0xF61C25, 0x2FE2A9, 0xC3ADC6, 0x1A534A, 0x9D7FE3, 0x44816F, 0xA8CE00, 0x71308C,
+		0x0B184A, 0xD2E6C6, 0x3EA9A9, 0xE75725, 0x607B8C, 0xB98500, 0x55CA6F, 0x8C34E3,
+		0xDDDFC6, 0x04214A, 0xE86E25, 0x3190A9, 0xB6BC00, 0x6F428C, 0x830DE3, 0x5AF36F,
+	},
+	{
+		0x000000, 0x36EB3D, 0x6DD67A, 0x5B3D47, 0xDBACF4, 0xED47C9, 0xB67A8E, 0x8091B3,
+		0x311513, 0x07FE2E, 0x5CC369, 0x6A2854, 0xEAB9E7, 0xDC52DA, 0x876F9D, 0xB184A0,
+		0x622A26, 0x54C11B, 0x0FFC5C, 0x391761, 0xB986D2, 0x8F6DEF, 0xD450A8, 0xE2BB95,
+		0x533F35, 0x65D408, 0x3EE94F, 0x080272, 0x8893C1, 0xBE78FC, 0xE545BB, 0xD3AE86,
+		0xC4544C, 0xF2BF71, 0xA98236, 0x9F690B, 0x1FF8B8, 0x291385, 0x722EC2, 0x44C5FF,
+		0xF5415F, 0xC3AA62, 0x989725, 0xAE7C18, 0x2EEDAB, 0x180696, 0x433BD1, 0x75D0EC,
+		0xA67E6A, 0x909557, 0xCBA810, 0xFD432D, 0x7DD29E, 0x4B39A3, 0x1004E4, 0x26EFD9,
+		0x976B79, 0xA18044, 0xFABD03, 0xCC563E, 0x4CC78D, 0x7A2CB0, 0x2111F7, 0x17FACA,
+		0x0EE463, 0x380F5E, 0x633219, 0x55D924, 0xD54897, 0xE3A3AA, 0xB89EED, 0x8E75D0,
+		0x3FF170, 0x091A4D, 0x52270A, 0x64CC37, 0xE45D84, 0xD2B6B9, 0x898BFE, 0xBF60C3,
+		0x6CCE45, 0x5A2578, 0x01183F, 0x37F302, 0xB762B1, 0x81898C, 0xDAB4CB, 0xEC5FF6,
+		0x5DDB56, 0x6B306B, 0x300D2C, 0x06E611, 0x8677A2, 0xB09C9F, 0xEBA1D8, 0xDD4AE5,
+		0xCAB02F, 0xFC5B12, 0xA76655, 0x918D68, 0x111CDB, 0x27F7E6, 0x7CCAA1, 0x4A219C,
+		0xFBA53C, 0xCD4E01, 0x967346, 0xA0987B, 0x2009C8, 0x16E2F5, 0x4DDFB2, 0x7B348F,
+		0xA89A09, 0x9E7134, 0xC54C73, 0xF3A74E, 0x7336FD, 0x45DDC0, 0x1EE087, 0x280BBA,
+		0x998F1A, 0xAF6427, 0xF45960, 0xC2B25D, 0x4223EE, 0x74C8D3, 0x2FF594, 0x191EA9,
+		0x1DC8C6, 0x2B23FB, 0x701EBC, 0x46F581, 0xC66432, 0xF08F0F, 0xABB248, 0x9D5975,
+		0x2CDDD5, 0x1A36E8, 0x410BAF, 0x77E092, 0xF77121, 0xC19A1C, 0x9AA75B, 0xAC4C66,
+		0x7FE2E0, 0x4909DD, 0x12349A, 0x24DFA7, 0xA44E14, 0x92A529, 0xC9986E, 0xFF7353,
+		0x4EF7F3, 0x781CCE, 0x232189, 0x15CAB4, 0x955B07, 0xA3B03A, 0xF88D7D, 0xCE6640,
+		0xD99C8A, 0xEF77B7, 0xB44AF0, 0x82A1CD, 0x02307E, 0x34DB43, 0x6FE604, 0x590D39,
+		0xE88999, 0xDE62A4, 0x855FE3, 0xB3B4DE, 0x33256D, 0x05CE50, 0x5EF317, 0x68182A,
+		0xBBB6AC, 0x8D5D91, 0xD660D6, 0xE08BEB, 0x601A58, 0x56F165, 0x0DCC22, 0x3B271F,
+		0x8AA3BF, 0xBC4882, 0xE775C5, 0xD19EF8, 0x510F4B, 0x67E476, 0x3CD931, 0x0A320C,
+		0x132CA5, 0x25C798, 0x7EFADF, 0x4811E2, 0xC88051, 0xFE6B6C, 0xA5562B, 0x93BD16,
+		0x2239B6, 0x14D28B, 0x4FEFCC, 0x7904F1, 0xF99542, 0xCF7E7F, 0x944338, 0xA2A805,
+		0x710683, 0x47EDBE, 0x1CD0F9, 0x2A3BC4, 0xAAAA77, 0x9C414A, 0xC77C0D, 0xF19730,
+		0x401390, 0x76F8AD, 0x2DC5EA, 0x1B2ED7, 0x9BBF64, 0xAD5459, 0xF6691E, 0xC08223,
+		0xD778E9, 0xE193D4, 0xBAAE93, 0x8C45AE, 0x0CD41D, 0x3A3F20, 0x610267, 0x57E95A,
+		0xE66DFA, 0xD086C7, 0x8BBB80, 0xBD50BD, 0x3DC10E, 0x0B2A33, 0x501774, 0x66FC49,
+		0xB552CF, 0x83B9F2, 0xD884B5, 0xEE6F88, 0x6EFE3B, 0x581506, 0x032841, 0x35C37C,
+		0x8447DC, 0xB2ACE1, 0xE991A6, 0xDF7A9B, 0x5FEB28, 0x690015, 0x323D52, 0x04D66F,
+	},
+	{
+		0x000000, 0x3B918C, 0x772318, 0x4CB294, 0xEE4630, 0xD5D7BC, 0x996528, 0xA2F4A4,
+		0x5AC09B, 0x615117, 0x2DE383, 0x16720F, 0xB486AB, 0x8F1727, 0xC3A5B3, 0xF8343F,
+		0xB58136, 0x8E10BA, 0xC2A22E, 0xF933A2, 0x5BC706, 0x60568A, 0x2CE41E, 0x177592,
+		0xEF41AD, 0xD4D021, 0x9862B5, 0xA3F339, 0x01079D, 0x3A9611, 0x762485, 0x4DB509,
+		0xED4E97, 0xD6DF1B, 0x9A6D8F, 0xA1FC03, 0x0308A7, 0x38992B, 0x742BBF, 0x4FBA33,
+		0xB78E0C, 0x8C1F80, 0xC0AD14, 0xFB3C98, 0x59C83C, 0x6259B0, 0x2EEB24, 0x157AA8,
+		0x58CFA1, 0x635E2D, 0x2FECB9, 0x147D35, 0xB68991, 0x8D181D, 0xC1AA89, 0xFA3B05,
+		0x020F3A, 0x399EB6, 0x752C22, 0x4EBDAE, 0xEC490A, 0xD7D886, 0x9B6A12, 0xA0FB9E,
+		0x5CD1D5, 0x674059, 0x2BF2CD, 0x106341, 0xB297E5, 0x890669, 0xC5B4FD, 0xFE2571,
+		0x06114E, 0x3D80C2, 0x713256, 0x4AA3DA, 0xE8577E, 0xD3C6F2, 0x9F7466, 0xA4E5EA,
+		0xE950E3, 0xD2C16F, 0x9E73FB, 0xA5E277, 0x0716D3, 0x3C875F, 0x7035CB, 0x4BA447,
+		0xB39078, 0x8801F4, 0xC4B360, 0xFF22EC, 0x5DD648, 0x6647C4, 0x2AF550, 0x1164DC,
+		0xB19F42, 0x8A0ECE, 0xC6BC5A, 0xFD2DD6, 0x5FD972, 0x6448FE, 0x28FA6A, 0x136BE6,
+		0xEB5FD9, 0xD0CE55, 0x9C7CC1, 0xA7ED4D, 0x0519E9, 0x3E8865, 0x723AF1, 0x49AB7D,
+		0x041E74, 0x3F8FF8, 0x733D6C, 0x48ACE0, 0xEA5844, 0xD1C9C8, 0x9D7B5C, 0xA6EAD0,
+		0x5EDEEF, 0x654F63, 0x29FDF7, 0x126C7B, 0xB098DF, 0x8B0953, 0xC7BBC7, 0xFC2A4B,
+		0xB9A3AA, 0x823226, 0xCE80B2, 0xF5113E, 0x57E59A, 0x6C7416, 0x20C682, 0x1B570E,
+		0xE36331, 0xD8F2BD, 0x944029, 0xAFD1A5, 0x0D2501, 0x36B48D, 0x7A0619, 0x419795,
+		0x0C229C, 0x37B310, 0x7B0184, 0x409008, 0xE264AC, 0xD9F520, 0x9547B4, 0xAED638,
+		0x56E207, 0x6D738B, 0x21C11F, 0x1A5093, 0xB8A437, 0x8335BB, 0xCF872F, 0xF416A3,
+		0x54ED3D, 0x6F7CB1, 0x23CE25, 0x185FA9, 0xBAAB0D, 0x813A81, 0xCD8815, 0xF61999,
+		0x0E2DA6, 0x35BC2A, 0x790EBE, 0x429F32, 0xE06B96, 0xDBFA1A, 0x97488E, 0xACD902,
+		0xE16C0B, 0xDAFD87, 0x964F13, 0xADDE9F, 0x0F2A3B, 0x34BBB7, 0x780923, 0x4398AF,
+		0xBBAC90, 0x803D1C, 0xCC8F88, 0xF71E04, 0x55EAA0, 0x6E7B2C, 0x22C9B8, 0x195834,
+		0xE5727F, 0xDEE3F3, 0x925167, 0xA9C0EB, 0x0B344F, 0x30A5C3, 0x7C1757, 0x4786DB,
+		0xBFB2E4, 0x842368, 0xC891FC, 0xF30070, 0x51F4D4, 0x6A6558, 0x26D7CC, 0x1D4640,
+		0x50F349, 0x6B62C5, 0x27D051, 0x1C41DD, 0xBEB579, 0x8524F5, 0xC99661, 0xF207ED,
+		0x0A33D2, 0x31A25E, 0x7D10CA, 0x468146, 0xE475E2, 0xDFE46E, 0x9356FA, 0xA8C776,
+		0x083CE8, 0x33AD64, 0x7F1FF0, 0x448E7C, 0xE67AD8, 0xDDEB54, 0x9159C0, 0xAAC84C,
+		0x52FC73, 0x696DFF, 0x25DF6B, 0x1E4EE7, 0xBCBA43, 0x872BCF, 0xCB995B, 0xF008D7,
+		0xBDBDDE, 0x862C52, 0xCA9EC6, 0xF10F4A, 0x53FBEE, 0x686A62, 0x24D8F6, 0x1F497A,
+		0xE77D45, 0xDCECC9, 0x905E5D, 0xABCFD1, 0x093B75, 0x32AAF9, 0x7E186D, 0x4589E1,
+	},
+	{
+		0x000000, 0xF50BAF, 0x6C5BA5, 0x99500A, 0xD8B74A, 0x2DBCE5, 0xB4ECEF, 0x41E740,
+		0x37226F, 0xC229C0, 0x5B79CA, 0xAE7265, 0xEF9525, 0x1A9E8A, 0x83CE80, 0x76C52F,
+		0x6E44DE, 0x9B4F71, 0x021F7B, 0xF714D4, 0xB6F394, 0x43F83B, 0xDAA831, 0x2FA39E,
+		0x5966B1, 0xAC6D1E, 0x353D14, 0xC036BB, 0x81D1FB, 0x74DA54, 0xED8A5E, 0x1881F1,
+		0xDC89BC, 0x298213, 0xB0D219, 0x45D9B6, 0x043EF6, 0xF13559, 0x686553, 0x9D6EFC,
+		0xEBABD3, 0x1EA07C, 0x87F076, 0x72FBD9, 0x331C99, 0xC61736, 0x5F473C, 0xAA4C93,
+		0xB2CD62, 0x47C6CD, 0xDE96C7, 0x2B9D68, 0x6A7A28, 0x9F7187, 0x06218D, 0xF32A22,
+		0x85EF0D, 0x70E4A2, 0xE9B4A8, 0x1CBF07, 0x5D5847, 0xA853E8, 0x3103E2, 0xC4084D,
+		0x3F5F83, 0xCA542C, 0x530426, 0xA60F89, 0xE7E8C9, 0x12E366, 0x8BB36C, 0x7EB8C3,
+		0x087DEC, 0xFD7643, 0x642649, 0x912DE6, 0xD0CAA6, 0x25C109, 0xBC9103, 0x499AAC,
+		0x511B5D, 0xA410F2, 0x3D40F8, 0xC84B57, 0x89AC17, 0x7CA7B8, 0xE5F7B2, 0x10FC1D,
+		0x663932, 0x93329D, 0x0A6297, 0xFF6938, 0xBE8E78, 0x4B85D7, 0xD2D5DD, 0x27DE72,
+		0xE3D63F, 0x16DD90, 0x8F8D9A, 0x7A8635, 0x3B6175, 0xCE6ADA, 0x573AD0, 0xA2317F,
+		0xD4F450, 0x21FFFF, 0xB8AFF5, 0x4DA45A, 0x0C431A, 0xF948B5, 0x6018BF, 0x951310,
+		0x8D92E1, 0x78994E, 0xE1C944, 0x14C2EB, 0x5525AB, 0xA02E04, 0x397E0E, 0xCC75A1,
+		0xBAB08E, 0x4FBB21, 0xD6EB2B, 0x23E084, 0x6207C4, 0x970C6B, 0x0E5C61, 0xFB57CE,
+		0x7EBF06, 0x8BB4A9, 0x12E4A3, 0xE7EF0C, 0xA6084C, 0x5303E3, 0xCA53E9, 0x3F5846,
+		0x499D69, 0xBC96C6, 0x25C6CC, 0xD0CD63, 0x912A23, 0x64218C, 0xFD7186, 0x087A29,
+		0x10FBD8, 0xE5F077, 0x7CA07D, 0x89ABD2, 0xC84C92, 0x3D473D, 0xA41737, 0x511C98,
+		0x27D9B7, 0xD2D218, 0x4B8212, 0xBE89BD, 0xFF6EFD, 0x0A6552, 0x933558, 0x663EF7,
+		0xA236BA, 0x573D15, 0xCE6D1F, 0x3B66B0, 0x7A81F0, 0x8F8A5F, 0x16DA55, 0xE3D1FA,
+		0x9514D5, 0x601F7A, 0xF94F70, 0x0C44DF, 0x4DA39F, 0xB8A830, 0x21F83A, 0xD4F395,
+		0xCC7264, 0x3979CB, 0xA029C1, 0x55226E, 0x14C52E, 0xE1CE81, 0x789E8B, 0x8D9524,
+		0xFB500B, 0x0E5BA4, 0x970BAE, 0x620001, 0x23E741, 0xD6ECEE, 0x4FBCE4, 0xBAB74B,
+		0x41E085, 0xB4EB2A, 0x2DBB20, 0xD8B08F, 0x9957CF, 0x6C5C60, 0xF50C6A, 0x0007C5,
+		0x76C2EA, 0x83C945, 0x1A994F, 0xEF92E0, 0xAE75A0, 0x5B7E0F, 0xC22E05, 0x3725AA,
+		0x2FA45B, 0xDAAFF4, 0x43FFFE, 0xB6F451, 0xF71311, 0x0218BE, 0x9B48B4, 0x6E431B,
+		0x188634, 0xED8D9B, 0x74DD91, 0x81D63E, 0xC0317E, 0x353AD1, 0xAC6ADB, 0x596174,
+		0x9D6939, 0x686296, 0xF1329C, 0x043933, 0x45DE73, 0xB0D5DC, 0x2985D6, 0xDC8E79,
+		0xAA4B56, 0x5F40F9, 0xC610F3, 0x331B5C, 0x72FC1C, 0x87F7B3, 0x1EA7B9, 0xEBAC16,
+		0xF32DE7, 0x062648, 0x9F7642, 0x6A7DED, 0x2B9AAD, 0xDE9102, 0x47C108, 0xB2CAA7,
+		0xC40F88, 0x310427, 0xA8542D, 0x5D5F82, 0x1CB8C2, 0xE9B36D, 0x70E367, 0x85E8C8,
+	},
+#endif
+};
+
+#endif
@@ -20,6 +20,7 @@
 #include "serial_port.h"
 #include "parameters.h"
 #include "eepromAPI.h"
+#include "crc.h"
 #include "crc16.h"
 #include "BITStatus.h"
 #include "calibrationAPI.h"
@@ -616,6 +617,12 @@ void _UcbWriteCal (uint16_t port,
 //    RestoreDelay_Watchdog();
 }
 
+/// running CRC-32 and length of the application image written through
+/// _UcbWriteApp, checked against flash before the jump to it
+static Crc32Type appImageCrc = CRC_32_INITIAL_SEED;
+static uint32_t  appImageLen = 0;
+static BOOL      appImageGap = FALSE;
+
 /** ****************************************************************************
  * @name _UcbWriteApp
  * @brief Write data as 16 bit cells into an unlocked EEPROM.
@@ -646,6 +653,16 @@ static void _UcbWriteApp (uint16_t port, UcbPacketStruct    *ptrUcbPacket)
 
 		//if(!EEPROM_WriteApp(startAddress,&ptrUcbPacket->payload[5],bytesToWrite)){           //TODO:
 		if(EEPROM_WriteApp(startAddress,&ptrUcbPacket->payload[5],bytesToWrite)){           //TODO:
+            if (startAddress == 0) {
+                appImageCrc = CRC_32_INITIAL_SEED;
+                appImageLen = 0;
+                appImageGap = FALSE;
+            }
+            if (startAddress != appImageLen) {
+                appImageGap = TRUE;     // out of order, the crc no longer covers the image
+            }
+            appImageCrc = Crc32Update(appImageCrc, &ptrUcbPacket->payload[5], bytesToWrite);
+            appImageLen = startAddress + bytesToWrite;
             ptrUcbPacket->payloadLength = 5;
         } else {
             _SetNak(port, ptrUcbPacket);
@@ -681,7 +698,10 @@ static void _UcbJump2BOOT (uint16_t port, UcbPacketStruct    *ptrUcbPacket)
 
 /** ****************************************************************************
  * @name _UcbJump2APP
- * @brief
+ * @brief when an image was written through _UcbWriteApp, read it back from
+ *        flash and jump only if its crc matches the one accumulated over the
+ *        written chunks. The reply carries that crc, a mismatch or a write
+ *        out of order is NAKed and stays in the bootloader.
  * Trace:
  *	[SDD_UCB_UNLOCK_EEPROM <-- SRC_UCB_UNLOCK_EEPROM]
  *
@@ -691,6 +711,16 @@ static void _UcbJump2BOOT (uint16_t port, UcbPacketStruct    *ptrUcbPacket)
  ******************************************************************************/
 static void _UcbJump2APP (uint16_t port, UcbPacketStruct    *ptrUcbPacket)
 {
+    if (appImageLen) {
+        if (appImageGap ||
+            Crc32Update(CRC_32_INITIAL_SEED, (const uint8_t *)APP_START_ADDR, appImageLen) != appImageCrc) {
+            _SetNak(port, ptrUcbPacket);
+            HandleUcbTx(port, ptrUcbPacket);
+            return;
+        }
+        Crc32TypeToBytes(appImageCrc, ptrUcbPacket->payload);
+        ptrUcbPacket->payloadLength = CRC_32_LENGTH;
+    }
     HandleUcbTx(port, ptrUcbPacket);
     DelayMs(10);
     //return;
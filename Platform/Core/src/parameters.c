@@ -149,6 +149,9 @@ BOOL CheckContPacketRate (UcbPacketType outputPacket,
             case UCB_FACTORY_M:
                 bytesPerPacket += UCB_FACTORY_M_LENGTH;
                 break;
+            case UCB_NET_STATS:
+                bytesPerPacket += UCB_NET_STATS_LENGTH;
+                break;
             
             default:
                 valid = FALSE;
@@ -38,17 +38,21 @@
 #include "serial_port.h"
 
 #include "osapi.h"
+#include "event_trace.h"
 #include "calibrationAPI.h"
 #include "sensorsAPI.h"
 #include "user_message.h"
 #include "Indices.h"
 #include "app_version.h"
-#include "cJSON.h"
+#include "json_stream.h"
+#include "commAPI.h"
 #include "user_config.h"
 #include "uart.h"
 #include "spi.h"
 #include <stdlib.h>
 #include "tcp_driver.h"
+#include "lwip_stat.h"
+#include "output_sched.h"
 
 
 #ifdef INS_APP
@@ -67,14 +71,13 @@ void _UcbFactory1(uint16_t port, UcbPacketStruct *ptrUcbPacket);
 void _UcbFactory2(uint16_t port, UcbPacketStruct *ptrUcbPacket);
 void _UcbFactory3(uint16_t port, UcbPacketStruct *ptrUcbPacket);
 
-uint8_t divideCount = 200; /// continuous packet rate divider - set initial delay
-
 static  UcbPacketStruct continuousUcbPacket; 
 
 uint8_t debug_com_log_on = 0;
 uint32_t debug_p1_log_delay = 0;
 
 extern void sendP1Packet(uint8_t gps_update);
+static void output_stat_print(void);
 
 
 /** ****************************************************************************
@@ -465,6 +468,47 @@ void _UcbFactoryM(uint16_t port, UcbPacketStruct *ptrUcbPacket)
 	HandleUcbTx(port, ptrUcbPacket); /// send Factory 2 packet
 }
 
+// one pool of the NS packet
+static uint16_t appendNetPool(uint8_t *payload, uint16_t index, const lwip_stat_pool_t *pool)
+{
+    index = uint16ToBuffer(payload, index, pool->used);
+    index = uint16ToBuffer(payload, index, pool->max);
+    index = uint16ToBuffer(payload, index, pool->avail);
+    index = uint32ToBuffer(payload, index, pool->err);
+
+    return index;
+}
+
+/** ****************************************************************************
+ * @name _UcbNetStats send NS packet, lwIP resource counters
+ * @brief per pool of lwip_stat_pool_enum_t then the heap: used, max, avail
+ *        u16 and failed allocations u32; then mbox full events u32, most
+ *        messages in a mbox u16 and tcp retransmits u32
+ * @param [in] port - number request came in on, the reply will go out this port
+ * @param [out] packetPtr - data part of packet
+ * @retval N/A
+ ******************************************************************************/
+void _UcbNetStats(uint16_t port, UcbPacketStruct *ptrUcbPacket)
+{
+    lwip_stat_t stat;
+    uint16_t packetIndex = 0;
+    uint8_t i;
+
+    lwip_stat_get(&stat);
+
+    ptrUcbPacket->payloadLength = UCB_NET_STATS_LENGTH;
+    for (i = 0; i < LWIP_STAT_POOLS; i++)
+    {
+        packetIndex = appendNetPool(ptrUcbPacket->payload, packetIndex, &stat.pool[i]);
+    }
+    packetIndex = appendNetPool(ptrUcbPacket->payload, packetIndex, &stat.heap);
+    packetIndex = uint32ToBuffer(ptrUcbPacket->payload, packetIndex, stat.mbox_full);
+    packetIndex = uint16ToBuffer(ptrUcbPacket->payload, packetIndex, stat.mbox_max);
+    packetIndex = uint32ToBuffer(ptrUcbPacket->payload, packetIndex, stat.tcp_rexmit);
+
+    HandleUcbTx(port, ptrUcbPacket); /// send NS packet
+}
+
 /** ****************************************************************************
  * @name SendUcbPacket API - taskUserCommunication.c
  * @brief top level send packet routine - calls other send routines based on
@@ -516,6 +560,9 @@ void SendUcbPacket(uint16_t port,
         case UCB_FACTORY_M: // F2 0x464D
             _UcbFactoryM(port, ptrUcbPacket);
             break;
+        case UCB_NET_STATS: // NS 0x4E53
+            _UcbNetStats(port, ptrUcbPacket);
+            break;
 
         case UCB_USER_OUT:
             result = HandleUserOutputPacket(ptrUcbPacket->payload, &ptrUcbPacket->payloadLength);
@@ -533,130 +580,83 @@ void SendUcbPacket(uint16_t port,
 }
 
 
+/** ****************************************************************************
+ * @name write_configuration_json
+ * @brief the "get configuration" reply of the debug uart and the driver data
+ *        link, the text cJSON_Print gave, written to the sink in pieces as
+ *        the buffer fills, nothing on the heap
+ * @param [in] sink - takes the text
+ * @param [in] ctx - of the sink
+ * @retval bytes written, -1 on a sink failure
+ ******************************************************************************/
+int write_configuration_json(json_sink_t sink, void *ctx)
+{
+    char buf[256];
+    json_writer_t w;
+    static const char *ins_para_keys[9] = {
+        "leverArmBx", "leverArmBy", "leverArmBz",
+        "pointOfInterestBx", "pointOfInterestBy", "pointOfInterestBz",
+        "rotationRbvx", "rotationRbvy", "rotationRbvz"
+    };
+    int i;
+
+    json_writer_init(&w, buf, sizeof(buf), sink, ctx, 1);
+    json_object_begin(&w, NULL);
+    json_object_begin(&w, "openrtk configuration");
+    json_add_string(&w, "Product Name", PRODUCT_NAME_STRING);
+    json_add_string(&w, "Product PN", (const char *)platformBuildInfo());
+    json_add_number(&w, "Product SN", GetUnitSerialNum());
+    json_add_string(&w, "Version", APP_VERSION_STRING);
+
+    uint8_t *user_packet_type = get_user_packet_type();
+    char packet_type_str[5] = {0};
+    packet_type_str[0] = user_packet_type[0];
+    packet_type_str[1] = user_packet_type[1];
+
+    json_add_string(&w, "userPacketType", packet_type_str);
+    json_add_number(&w, "userPacketRate", get_user_packet_rate());
+
+    float *ins_para = get_user_ins_para();
+    for (i = 0; i < 9; i++)
+    {
+        json_add_number(&w, ins_para_keys[i], ins_para[i]);
+    }
+    json_object_end(&w);
+    json_object_end(&w);
+
+    return json_writer_end(&w);
+}
+
+static int debug_com_json_sink(void *ctx, const char *data, uint16_t len)
+{
+    return uart_write_bytes(UART_DEBUG, data, len, 1) == RTK_OK;
+}
+
 void debug_com_rx_data_handle(void)
 {
     uint8_t dataBuffer[512];
     int bytes_in_buffer = 0;
-    cJSON *root, *fmt;
-    char *out;
 
     bytes_in_buffer = uart_read_bytes(UART_DEBUG, dataBuffer, sizeof(dataBuffer), 0);
     if (bytes_in_buffer > 0){
         if (strstr((const char*)dataBuffer, "get configuration\r\n") != NULL)
         {
-            root = cJSON_CreateObject();
-            cJSON_AddItemToObject(root, "openrtk configuration", fmt = cJSON_CreateObject());
-            cJSON_AddItemToObject(fmt, "Product Name", cJSON_CreateString(PRODUCT_NAME_STRING));
-            cJSON_AddItemToObject(fmt, "Product PN", cJSON_CreateString((const char *)platformBuildInfo()));
-            cJSON_AddItemToObject(fmt, "Product SN", cJSON_CreateNumber(GetUnitSerialNum()));
-            cJSON_AddItemToObject(fmt, "Version", cJSON_CreateString(APP_VERSION_STRING));
-
-            uint8_t *user_packet_type = get_user_packet_type();
-            char packet_type_str[5] = {0};
-            packet_type_str[0] = user_packet_type[0];
-            packet_type_str[1] = user_packet_type[1];
-
-            uint16_t user_packet_rate = get_user_packet_rate();
-
-            cJSON_AddItemToObject(fmt, "userPacketType", cJSON_CreateString(packet_type_str));
-            cJSON_AddItemToObject(fmt, "userPacketRate", cJSON_CreateNumber(user_packet_rate));
-
-            float *ins_para = get_user_ins_para();
-            cJSON_AddItemToObject(fmt, "leverArmBx", cJSON_CreateNumber(*ins_para));
-            cJSON_AddItemToObject(fmt, "leverArmBy", cJSON_CreateNumber(*(ins_para + 1)));
-            cJSON_AddItemToObject(fmt, "leverArmBz", cJSON_CreateNumber(*(ins_para + 2)));
-            cJSON_AddItemToObject(fmt, "pointOfInterestBx", cJSON_CreateNumber(*(ins_para + 3)));
-            cJSON_AddItemToObject(fmt, "pointOfInterestBy", cJSON_CreateNumber(*(ins_para + 4)));
-            cJSON_AddItemToObject(fmt, "pointOfInterestBz", cJSON_CreateNumber(*(ins_para + 5)));
-            cJSON_AddItemToObject(fmt, "rotationRbvx", cJSON_CreateNumber(*(ins_para + 6)));
-            cJSON_AddItemToObject(fmt, "rotationRbvy", cJSON_CreateNumber(*(ins_para + 7)));
-            cJSON_AddItemToObject(fmt, "rotationRbvz", cJSON_CreateNumber(*(ins_para + 8)));
-
-            out = cJSON_Print(root);
-            cJSON_Delete(root);
-
-            uart_write_bytes(UART_DEBUG, out, strlen(out), 1);
-            free(out);
+            write_configuration_json(debug_com_json_sink, NULL);
             debug_com_log_on = 0;
         }
+        if (strstr((const char*)dataBuffer, "get output stats\r\n") != NULL)
+        {
+            output_stat_print();
+        }
         if (strstr((const char*)dataBuffer, "log debug on\r\n") != NULL)
         {
             debug_com_log_on = 1;
             debug_p1_log_delay = 100;
         }
+        event_trace_command((const char*)dataBuffer, EVENT_TRACE_SINK_UART);
     }
 }
 
-void send_gnss_data(void)
-{
-    uint8_t type [UCB_PACKET_TYPE_LENGTH];
-    
-#ifdef INS_APP
-    if (checkUserOutPacketType(gConfiguration.packetCode) == UCB_USER_OUT){
-        if (get_mGnssInsSystem_mlc_STATUS() == 4 || g_gnss_sol.gnss_update == 1){
-            // pS 0x7053
-            type[0] = 0x70;
-            type[1] = 0x53;
-            continuousUcbPacket.packetType = UcbPacketBytesToPacketType(type);
-            SendUcbPacket(UART_USER, &continuousUcbPacket);
-        }
-        
-        if (g_gnss_sol.gnss_update == 1){
-            //sK 0x734B
-            type[0] = 0x73;
-            type[1] = 0x4B;
-            continuousUcbPacket.packetType = UcbPacketBytesToPacketType(type);
-
-            uint8_t snum;
-            // skyview data may more than one packet
-            snum = g_ptr_gnss_sol->rov_n / 10;
-            if (g_ptr_gnss_sol->rov_n % 10 != 0){
-                snum++;
-            }
-
-            for (uint8_t i = 0; i < snum; i++){
-                SendUcbPacket(UART_USER, &continuousUcbPacket);
-            }
-        }
-    }
-    g_gnss_sol.gnss_update = 0;
-#else
-    if (g_gnss_sol.gnss_update == 1){
-        if (checkUserOutPacketType(gConfiguration.packetCode) == UCB_USER_OUT){
-            // pS 0x7053
-            type[0] = 0x70;
-            type[1] = 0x53;
-            continuousUcbPacket.packetType = UcbPacketBytesToPacketType(type);
-            SendUcbPacket(UART_USER, &continuousUcbPacket);
-
-            //sK 0x734B
-            type[0] = 0x73;
-            type[1] = 0x4B;
-            continuousUcbPacket.packetType = UcbPacketBytesToPacketType(type);
-
-            uint8_t snum;
-            // skyview data may more than one packet
-            if (strstr(APP_VERSION_STRING, "RAWDATA")){
-                snum = g_ptr_gnss_data->rov.n / 10;
-                if (g_ptr_gnss_data->rov.n % 10 != 0){
-                    snum++;
-                }
-            } else{
-                snum = g_ptr_gnss_sol->rov_n / 10;
-                if (g_ptr_gnss_sol->rov_n % 10 != 0){
-                    snum++;
-                }
-            }
-
-            for (uint8_t i = 0; i < snum; i++){
-                SendUcbPacket(UART_USER, &continuousUcbPacket);
-            }
-        }
-        g_gnss_sol.gnss_update = 0;
-    }
-#endif
-}
-
 /** ****************************************************************************
  * @name SendContinuousPacket
  *
@@ -677,36 +677,43 @@ static void fill_imu_data()
 {
     double   accel_g[3];
     float   rate_dps[3];
-    char sum = 0;
-    uint8_t imu_data_buf[500] = {0};
+    char imu_data_buf[200];
+    sentence_t s;
+    uint16_t len;
     GetAccelData_mPerSecSq(accel_g);
     GetRateData_degPerSec(rate_dps);
     double gga_time = get_gnss_time();
-	int data_len = sprintf((char*)imu_data_buf,"$GPIMU,%6.2f,%14.4f,%14.4f,%14.4f,%14.4f,%14.4f,%14.4f,",    \
-		gga_time,accel_g[0], accel_g[1],accel_g[2], \
-		rate_dps[0],rate_dps[1],rate_dps[2]);
-    for(int i = 0;i < data_len;i++)
+
+    /* "$GPIMU,%6.2f,%14.4f x 6,<xor of all before>\r\n" */
+    sentence_begin(&s, imu_data_buf, sizeof(imu_data_buf));
+    sentence_str(&s, "$GPIMU,");
+    sentence_fixed(&s, gga_time, 6, 2);
+    for (int i = 0; i < 3; i++)
+    {
+        sentence_str(&s, ",");
+        sentence_fixed(&s, accel_g[i], 14, 4);
+    }
+    for (int i = 0; i < 3; i++)
     {
-        sum ^= imu_data_buf[i];
+        sentence_str(&s, ",");
+        sentence_fixed(&s, rate_dps[i], 14, 4);
     }
-    int end_len = sprintf((char*)imu_data_buf + strlen((char*)imu_data_buf),"%02x\r\n",sum);
+    sentence_str(&s, ",");
+    len = sentence_end(&s, "");
+
     if (debug_com_log_on) {
-        uart_write_bytes(UART_DEBUG,(const char*)imu_data_buf,data_len + end_len,1);
+        uart_write_bytes(UART_DEBUG,(const char*)imu_data_buf,len,1);
     }
     if(get_tcp_data_driver_state() == CLIENT_STATE_INTERACTIVE)
     {
-        //driver_data_push((const char*)imu_data_buf,data_len + end_len);
-        client_write_data(&driver_data_client,(const char*)imu_data_buf,data_len + end_len,0x01);
+        //driver_data_push((const char*)imu_data_buf,len);
+        client_write_data(&driver_data_client,(const char*)imu_data_buf,len,0x01);
     }
 }
 
 
 #ifdef INCEPTIO
 static  UcbPacketStruct inceptioUcbPacket;
-uint8_t rawimuPacketDivide = 0;
-uint8_t inspvaPacketDivide = 0;
-uint8_t insstdPacketDivide = 0;
-uint8_t bestgnssPacketDivide = 0;
 uint8_t rawimuPacketRate = 0;
 uint8_t inspvaPacketRate = 0;
 uint8_t insstdPacketRate = 0;
@@ -715,211 +722,528 @@ uint8_t bestgnssPacketRate = 0;
 #endif
 uint8_t spi_buff[SPI_BUF_SIZE];
 
-void SendContinuousPacket(void)
+/* sinks of the output scheduler */
+enum {
+    OUTPUT_SINK_UART = 0,   // UART_USER
+    OUTPUT_SINK_TCP,        // driver_client
+    OUTPUT_SINK_SPI         // spi_buff, INCEPTIO
+};
+
+#define OUTPUT_UCB_SINKS    (OUTPUT_SINK(OUTPUT_SINK_UART) | OUTPUT_SINK(OUTPUT_SINK_TCP))
+
+extern client_s driver_client;
+static output_sched_t output_sched;
+
+/** ****************************************************************************
+ * @name build_ucb
+ * @brief build a UCB packet, from sync_MSB on, in its packet struct
+ * @param [in] ptrUcbPacket - packet to build it in
+ * @param [in] code - packet code, e.g. 0x7331 for s1
+ * @retval packet length, 0 for a type with no packet
+ ******************************************************************************/
+static uint16_t build_ucb(UcbPacketStruct *ptrUcbPacket, uint16_t code)
 {
     uint8_t type[UCB_PACKET_TYPE_LENGTH];
 
-#ifdef INCEPTIO
-    // come here 100Hz
-    static char s1_buff[50] = {0};
-    static char iN_buff[50] = {0};
-    static char d1_buff[50] = {0};
-    static char gN_buff[50] = {0};
-    static char sT_buff[20] = {0};
-    static char s1_len = 43,iN_len = 45,d1_len = 37,gN_len = 45,sT_len = 19;
-
-    // RAWIMU s1
-    if (rawimuPacketRate != PACKET_RATE_QUIET && mGnssInsSystem.mlc_STATUS == INS_FUSING) {
-        if (rawimuPacketDivide >= rawimuPacketRate) {
-            gConfiguration.packetCode = 0x7331;
-            type[0] = 0x73;
-            type[1] = 0x31;
-            inceptioUcbPacket.packetType = UcbPacketBytesToPacketType(type);
-            SendUcbPacket(UART_USER, &inceptioUcbPacket);
-            rawimuPacketDivide = 1;
-
-            memset(s1_buff,0,50);
-            memcpy((char *)s1_buff,(const char *)&inceptioUcbPacket.sync_MSB, inceptioUcbPacket.payloadLength + 7);
-            s1_len = inceptioUcbPacket.payloadLength + 7;
-        } else {
-            rawimuPacketDivide++;
-        }
+    type[0] = (uint8_t)((code >> 8) & 0xff);
+    type[1] = (uint8_t)(code & 0xff);
+    ptrUcbPacket->packetType = UcbPacketBytesToPacketType(type);
+    ptrUcbPacket->sync_MSB = 0; // set by HandleUcbTx() if the type has a packet
+    SendUcbPacket(UCB_PORT_FRAME, ptrUcbPacket);
+    if (ptrUcbPacket->sync_MSB != 0x55) {
+        return 0;
     }
-    
-    // INSPVA iN
-    if (inspvaPacketRate != PACKET_RATE_QUIET) {
-        if (inspvaPacketDivide >= inspvaPacketRate) {
-            gConfiguration.packetCode = 0x694E;
-            type[0] = 0x69;
-            type[1] = 0x4E;
-            inceptioUcbPacket.packetType = UcbPacketBytesToPacketType(type);
-            SendUcbPacket(UART_USER, &inceptioUcbPacket);
-            inspvaPacketDivide = 1;
-
-            memset(iN_buff,0,50);
-            memcpy((char *)iN_buff,(const char *)&inceptioUcbPacket.sync_MSB, inceptioUcbPacket.payloadLength + 7);
-            iN_len = inceptioUcbPacket.payloadLength + 7;
-        } else {
-            inspvaPacketDivide++;
+    return ptrUcbPacket->payloadLength + 7;
+}
+
+/** ****************************************************************************
+ * @name fill_ucb
+ * @brief build a UCB packet into the frame of the output scheduler
+ * @param [in] ptrUcbPacket - packet to build it in
+ * @param [in] code - packet code, e.g. 0x7331 for s1
+ * @param [out] buf - frame
+ * @param [in] size - room in the frame
+ * @retval packet length, 0 for a type with no packet, OUTPUT_FILL_LATER if it
+ *         does not fit
+ ******************************************************************************/
+static int fill_ucb(UcbPacketStruct *ptrUcbPacket, uint16_t code, uint8_t *buf, uint16_t size)
+{
+    uint16_t len = build_ucb(ptrUcbPacket, code);
+
+    if (len > size) {
+        return OUTPUT_FILL_LATER;
+    }
+    memcpy(buf, &ptrUcbPacket->sync_MSB, len);
+    return len;
+}
+
+static uint32_t uart_sink_send(output_sink_t *sink, const output_frame_t *frame)
+{
+    const uint8_t *data;
+    uint32_t dropped = 0;
+    uint16_t len;
+    uint8_t i = 0;
+
+    /* the scheduler paces the port, a span that does not fit is counted
+       rather than waited for, so the tick is not held up */
+    while ((len = output_frame_run(frame, sink->id, &i, &data)) != 0) {
+        if (uart_write_bytes(UART_USER, (const char *)data, len, 0) != RTK_OK) {
+            dropped += len;
         }
     }
+    return dropped;
+}
+
+static uint32_t uart_sink_backlog(output_sink_t *sink)
+{
+    uint32_t backlog = 0;
 
-    // INSSTD d1
-    if (insstdPacketRate != PACKET_RATE_QUIET) {
-        if (insstdPacketDivide >= insstdPacketRate) {
-            gConfiguration.packetCode = 0x6431;
-            type[0] = 0x64;
-            type[1] = 0x31;
-            inceptioUcbPacket.packetType = UcbPacketBytesToPacketType(type);
-            SendUcbPacket(UART_USER, &inceptioUcbPacket);
-            insstdPacketDivide = 1;
-
-            memset(d1_buff,0,50);  
-            memcpy((char *)d1_buff,(const char *)&inceptioUcbPacket.sync_MSB, inceptioUcbPacket.payloadLength + 7);
-            d1_len = inceptioUcbPacket.payloadLength + 7;   
-        } else {
-            insstdPacketDivide++;
+    uart_tx_stat(UART_USER, &backlog, NULL, NULL);
+    return backlog;
+}
+
+/* nothing is sent, and nothing counted as dropped, while no driver is connected */
+static uint32_t tcp_sink_send(output_sink_t *sink, const output_frame_t *frame)
+{
+    const uint8_t *data;
+    uint32_t dropped = 0;
+    uint16_t len;
+    uint8_t i = 0;
+
+    if (get_tcp_driver_state() != CLIENT_STATE_INTERACTIVE) {
+        return 0;
+    }
+    while ((len = output_frame_run(frame, sink->id, &i, &data)) != 0) {
+        if (client_write_data(&driver_client, (uint8_t *)data, len, 0x01) != ERR_OK) {
+            dropped += len;
         }
     }
+    return dropped;
+}
+
+static output_sink_t uart_sink = {
+    .send = uart_sink_send,
+    .backlog = uart_sink_backlog,
+    .id = OUTPUT_SINK_UART,
+};
+
+static output_sink_t tcp_sink = {
+    .send = tcp_sink_send,
+    .id = OUTPUT_SINK_TCP,
+};
+
+#ifdef INCEPTIO
+/* the spi frame has a fixed layout, a slot per packet holding its last copy:
+   s1 iN d1 gN sT */
+typedef struct {
+    uint16_t code;
+    uint8_t  size;
+    uint8_t  len;
+    uint8_t  slot[50];
+} inceptio_out_t;
+
+enum { INCEPTIO_S1, INCEPTIO_IN, INCEPTIO_D1, INCEPTIO_GN, INCEPTIO_ST, INCEPTIO_OUT_NUM };
+
+static inceptio_out_t inceptio_out[INCEPTIO_OUT_NUM] = {
+    [INCEPTIO_S1] = {0x7331, 50, 43},   // RAWIMU
+    [INCEPTIO_IN] = {0x694E, 50, 45},   // INSPVA
+    [INCEPTIO_D1] = {0x6431, 50, 37},   // INSSTD
+    [INCEPTIO_GN] = {0x674E, 50, 45},   // BESTGNSS
+    [INCEPTIO_ST] = {0x7354, 20, 19},   // STATUS
+};
+
+static int fill_inceptio(output_stream_t *stream, uint8_t *buf, uint16_t size)
+{
+    inceptio_out_t *out = (inceptio_out_t *)stream->ctx;
+
+    gConfiguration.packetCode = out->code;
+    return fill_ucb(&inceptioUcbPacket, out->code, buf, size);
+}
+
+static int fill_rawimu(output_stream_t *stream, uint8_t *buf, uint16_t size)
+{
+    if (mGnssInsSystem.mlc_STATUS != INS_FUSING) {
+        return 0;
+    }
+    return fill_inceptio(stream, buf, size);
+}
 
-    // BESTGNSS gN
-    // if (bestgnssPacketRate != PACKET_RATE_QUIET) {
-    // if (bestgnssPacketDivide >= bestgnssPacketRate) {
-        // 1Hz 
-        if (g_gnss_sol.gnss_update == 1) {
-            gConfiguration.packetCode = 0x674E;
-            type[0] = 0x67;
-            type[1] = 0x4E;
-            inceptioUcbPacket.packetType = UcbPacketBytesToPacketType(type);
-            SendUcbPacket(UART_USER, &inceptioUcbPacket);
-        
-            g_gnss_sol.gnss_update = 0;
-            memset(gN_buff,0,50);
-            memcpy((char *)gN_buff,(const char *)&inceptioUcbPacket.sync_MSB, inceptioUcbPacket.payloadLength + 7);
-            gN_len = inceptioUcbPacket.payloadLength + 7;
+// 1Hz, on the gnss update
+static int fill_bestgnss(output_stream_t *stream, uint8_t *buf, uint16_t size)
+{
+    int n;
+
+    if (g_gnss_sol.gnss_update != 1) {
+        return 0;
+    }
+    n = fill_inceptio(stream, buf, size);
+    if (n != OUTPUT_FILL_LATER) {
+        g_gnss_sol.gnss_update = 0;
+    }
+    return n;
+}
+
+static uint32_t spi_sink_send(output_sink_t *sink, const output_frame_t *frame)
+{
+    const output_span_t *span;
+    inceptio_out_t *out;
+    uint32_t dropped = 0;
+    uint16_t off = 0;
+    uint8_t k;
+
+    for (k = 0; k < frame->nspan; k++) {
+        span = &frame->span[k];
+        if (!(span->stream->sinks & OUTPUT_SINK(sink->id))) {
+            continue;
         }
-    //     bestgnssPacketDivide = 1;
-    // } else {
-    //     bestgnssPacketDivide++;
-    // }
-    // }
-//STATUS sT
-    gConfiguration.packetCode = 0x7354;
-    type[0] = 0x73;
-    type[1] = 0x54;
-    inceptioUcbPacket.packetType = UcbPacketBytesToPacketType(type);
-    SendUcbPacket(UART_USER, &inceptioUcbPacket);
-
-    memset(sT_buff,0,20);
-    memcpy((char *)sT_buff,(const char *)&inceptioUcbPacket.sync_MSB, inceptioUcbPacket.payloadLength + 7);
-    sT_len = inceptioUcbPacket.payloadLength + 7;
-
-    memset(spi_buff,0,SPI_BUF_SIZE);
-    memcpy((char *)spi_buff,s1_buff,s1_len);
-    memcpy((char *)spi_buff+s1_len,iN_buff,iN_len);
-    memcpy((char *)spi_buff+s1_len+iN_len,d1_buff,d1_len);
-    memcpy((char *)spi_buff+s1_len+iN_len+d1_len,gN_buff,gN_len);
-    memcpy((char *)spi_buff+s1_len+iN_len+d1_len+gN_len,sT_buff,sT_len);    
-    // uart_write_bytes(UART_DEBUG,(char *)spi_buff,170+19,1);
+        out = (inceptio_out_t *)span->stream->ctx;
+        out->len = span->len < out->size ? span->len : out->size;
+        dropped += span->len - out->len;
+        memset(out->slot, 0, out->size);
+        memcpy(out->slot, frame->buf + span->off, out->len);
+    }
+
+    memset(spi_buff, 0, SPI_BUF_SIZE);
+    for (k = 0; k < INCEPTIO_OUT_NUM && off + inceptio_out[k].len <= SPI_BUF_SIZE; k++) {
+        memcpy(spi_buff + off, inceptio_out[k].slot, inceptio_out[k].len);
+        off += inceptio_out[k].len;
+    }
     spi_ready_flag ++;
     if (spi_ready_flag >= 2)
     {
         spi_ready_flag = 1;
         MX_SPI5_Init();
     }
-    
     DRDY_ON();
+    return dropped;
+}
+
+static output_sink_t spi_sink = {
+    .send = spi_sink_send,
+    .id = OUTPUT_SINK_SPI,
+};
+
+#define INCEPTIO_SINKS  (OUTPUT_UCB_SINKS | OUTPUT_SINK(OUTPUT_SINK_SPI))
+
+static output_stream_t inceptio_stream[INCEPTIO_OUT_NUM] = {
+    [INCEPTIO_S1] = {.fill = fill_rawimu, .priority = 0, .sinks = INCEPTIO_SINKS, .ctx = &inceptio_out[INCEPTIO_S1]},
+    [INCEPTIO_IN] = {.fill = fill_inceptio, .priority = 0, .sinks = INCEPTIO_SINKS, .ctx = &inceptio_out[INCEPTIO_IN]},
+    [INCEPTIO_D1] = {.fill = fill_inceptio, .priority = 0, .sinks = INCEPTIO_SINKS, .ctx = &inceptio_out[INCEPTIO_D1]},
+    [INCEPTIO_GN] = {.fill = fill_bestgnss, .divider = 1, .priority = 1, .sinks = INCEPTIO_SINKS, .ctx = &inceptio_out[INCEPTIO_GN]},
+    [INCEPTIO_ST] = {.fill = fill_inceptio, .divider = 1, .priority = 0, .sinks = INCEPTIO_SINKS, .ctx = &inceptio_out[INCEPTIO_ST]},
+};
+
+static uint16_t inceptio_divider(uint8_t rate)
+{
+    if (rate == PACKET_RATE_QUIET) {
+        return 0;
+    }
+    return rate ? rate : 1;
+}
+
+static void output_streams_init(void)
+{
+    uint8_t k;
+
+    output_sched_add_sink(&output_sched, &spi_sink);
+    for (k = 0; k < INCEPTIO_OUT_NUM; k++) {
+        output_sched_add_stream(&output_sched, &inceptio_stream[k]);
+    }
+}
+
+// 100Hz, the rates are the packet dividers set by the user packets
+static void output_streams_rate(void)
+{
+    inceptio_stream[INCEPTIO_S1].divider = inceptio_divider(rawimuPacketRate);
+    inceptio_stream[INCEPTIO_IN].divider = inceptio_divider(inspvaPacketRate);
+    inceptio_stream[INCEPTIO_D1].divider = inceptio_divider(insstdPacketRate);
+}
 
 #else
 
+/* the pS packet then the sK packets of a fix, the skyview data takes a packet
+   per ten satellites; what does not fit in a tick goes in the next ones. Each
+   sK build moves on to the next satellites, so a packet built that does not
+   fit is kept in its own struct until it does */
+static uint8_t gnss_ps_left = 0;
+static uint8_t gnss_sk_left = 0;
+static uint16_t gnss_sk_held = 0;           // length of the sK packet built, not sent
+static UcbPacketStruct skyviewUcbPacket;
+
+static uint8_t skyview_packets(uint8_t nsat)
+{
+    return nsat / 10 + (nsat % 10 != 0);
+}
+
+static int fill_gnss_data(output_stream_t *stream, uint8_t *buf, uint16_t size)
+{
+    uint16_t len = 0;
+    int n;
+
+    if (gnss_ps_left == 0 && gnss_sk_left == 0)
+    {
 #ifdef INS_APP
-    // 100Hz
-    uint16_t divider = configGetPacketRateDivider(gConfiguration.packetRateDivider);
-    if (divider != 0 && divider < 2) {
-        divider = 2;
-    }
-    divider = divider / 2;
+        if (checkUserOutPacketType(gConfiguration.packetCode) == UCB_USER_OUT){
+            gnss_ps_left = (get_mGnssInsSystem_mlc_STATUS() == 4 || g_gnss_sol.gnss_update == 1);
+            if (g_gnss_sol.gnss_update == 1){
+                gnss_sk_left = skyview_packets(g_ptr_gnss_sol->rov_n);
+            }
+        }
 #else
-    uint16_t divider = 1;
+        if (g_gnss_sol.gnss_update == 1 && checkUserOutPacketType(gConfiguration.packetCode) == UCB_USER_OUT){
+            gnss_ps_left = 1;
+            if (strstr(APP_VERSION_STRING, "RAWDATA")){
+                gnss_sk_left = skyview_packets(g_ptr_gnss_data->rov.n);
+            } else{
+                gnss_sk_left = skyview_packets(g_ptr_gnss_sol->rov_n);
+            }
+        }
 #endif
+        g_gnss_sol.gnss_update = 0;
+    }
+
+    if (gnss_ps_left){
+        // pS 0x7053
+        n = fill_ucb(&continuousUcbPacket, 0x7053, buf, size);
+        if (n == OUTPUT_FILL_LATER){
+            return OUTPUT_FILL_LATER;
+        }
+        gnss_ps_left = 0;
+        len += n;
+    }
+    // sK 0x734B, one packet at a time against the room left
+    while (gnss_sk_left){
+        if (gnss_sk_held == 0){
+            gnss_sk_held = build_ucb(&skyviewUcbPacket, 0x734B);
+            if (gnss_sk_held == 0){
+                gnss_sk_left--;
+                continue;
+            }
+        }
+        if (gnss_sk_held > size - len){
+            break;
+        }
+        memcpy(buf + len, &skyviewUcbPacket.sync_MSB, gnss_sk_held);
+        len += gnss_sk_held;
+        gnss_sk_held = 0;
+        gnss_sk_left--;
+    }
+    if (gnss_sk_left){
+        stream->pending = 1;
+        if (len == 0){
+            return OUTPUT_FILL_LATER;
+        }
+    }
+    return len;
+}
 
-    if (divider != 0) { ///< check for quiet mode
-        if (divideCount == 1) {
-            // gConfiguration.packetCode = 0x5331; //s1 7331
-            /// get enum for requested continuous packet type
-            type[0] = (uint8_t)((gConfiguration.packetCode >> 8) & 0xff);
-            type[1] = (uint8_t)(gConfiguration.packetCode & 0xff);
+static int fill_continuous(output_stream_t *stream, uint8_t *buf, uint16_t size)
+{
+    /// the continuous output packet type set by the configuration
+    int n = fill_ucb(&continuousUcbPacket, gConfiguration.packetCode, buf, size);
 
-            /// set continuous output packet type based on configuration
-            continuousUcbPacket.packetType = UcbPacketBytesToPacketType(type);
-            SendUcbPacket(UART_USER, &continuousUcbPacket);
 #ifdef DEBUG_ALL
-            fill_imu_data();
-#endif
-            divideCount = divider;
-        } else {
-            --divideCount;
-        }
+    if (n != OUTPUT_FILL_LATER) {
+        fill_imu_data();
     }
-    // send 'pS' packet and 'sK' packet, will display in the web GUI through python driver
-    // need to fill the data in 'Fill_posPacketPayload' and 'Fill_skyviewPacketPayload'
-    send_gnss_data();
+#endif
+    return n;
+}
+
+static int fill_nmea(output_stream_t *stream, uint8_t *buf, uint16_t size)
+{
+    const char *sentence[4];
+    uint16_t len = 0, n;
+    int num = 0, i;
 
+    if (!nema_update_flag) {
+        return 0;
+    }
 #ifndef RAW_APP
-    if(nema_update_flag)
-    {
 #ifdef INS_APP
 
 #ifdef USER_INS_NMEA
-        if (strlen(ggaBuff) == 0) {
-            uart_write_bytes(UART_USER, (char *)gga_buff, strlen(gga_buff), 1);
-            uart_write_bytes(UART_USER, (char *)rmc_buff, strlen(rmc_buff), 1);
-        }
+    if (strlen(ggaBuff) == 0) {
+        sentence[num++] = (const char *)gga_buff;
+        sentence[num++] = (const char *)rmc_buff;
+    }
 #else
-        if (strlen(ggaBuff) == 0) {
-            uart_write_bytes(UART_USER, (char *)gga_buff, strlen(gga_buff), 1);
-        } else {
-            uart_write_bytes(UART_USER, (char *)ggaBuff, strlen(ggaBuff), 1);
-        }
-        uart_write_bytes(UART_USER, (char *)rmc_buff, strlen(rmc_buff), 1);
+    if (strlen(ggaBuff) == 0) {
+        sentence[num++] = (const char *)gga_buff;
+    } else {
+        sentence[num++] = (const char *)ggaBuff;
+    }
+    sentence[num++] = (const char *)rmc_buff;
 #endif
 
 #else
-        uart_write_bytes(UART_USER, (char *)gga_buff, strlen(gga_buff), 1);
-        uart_write_bytes(UART_USER, (char *)rmc_buff, strlen(rmc_buff), 1);
+    sentence[num++] = (const char *)gga_buff;
+    sentence[num++] = (const char *)rmc_buff;
 #endif
+    sentence[num++] = (const char *)gsa_buff;
+    sentence[num++] = (const char *)zda_buff;
+#else
+    double ecef[3];
+    ecef[0] = g_gnss_sol.pos_ecef[0];
+    ecef[1] = g_gnss_sol.pos_ecef[1];
+    ecef[2] = g_gnss_sol.pos_ecef[2];
+
+    gtime_t time = gpst2time(g_gnss_sol.gps_week, g_gnss_sol.gps_tow*0.001);
+    print_rmc(time, ecef,1, rmc_buff);
+    print_gsv((unsigned char *)gsv_buff,1,sky_view_ptr);
+
+    sentence[num++] = (const char *)gga_buff;
+    sentence[num++] = (const char *)rmc_buff;
+    sentence[num++] = (const char *)gsv_buff;
+#endif
+    for (i = 0; i < num; i++) {
+        n = strlen(sentence[i]);
+        if (len + n > size) {
+            return OUTPUT_FILL_LATER;
+        }
+        memcpy(buf + len, sentence[i], n);
+        len += n;
+    }
+    nema_update_flag = 0;
+    return len;
+}
+
+static output_stream_t continuous_stream = {
+    .fill = fill_continuous,
+    .count = 200,           // initial delay
+    .priority = 0,
+    .sinks = OUTPUT_UCB_SINKS,
+};
+
+// send 'pS' packet and 'sK' packet, will display in the web GUI through python driver
+// need to fill the data in 'Fill_posPacketPayload' and 'Fill_skyviewPacketPayload'
+static output_stream_t gnss_stream = {
+    .fill = fill_gnss_data,
+    .divider = 1,
+    .priority = 1,
+    .sinks = OUTPUT_UCB_SINKS,
+};
+
+static output_stream_t nmea_stream = {
+    .fill = fill_nmea,
+    .divider = 1,
+    .priority = 2,
+    .sinks = OUTPUT_SINK(OUTPUT_SINK_UART),
+};
+
+static void output_streams_init(void)
+{
+    output_sched_add_stream(&output_sched, &continuous_stream);
+    output_sched_add_stream(&output_sched, &gnss_stream);
+    output_sched_add_stream(&output_sched, &nmea_stream);
+}
 
-        uart_write_bytes(UART_USER, (char *)gsa_buff, strlen(gsa_buff), 1);    
-        uart_write_bytes(UART_USER, (char *)zda_buff, strlen(zda_buff), 1); 
-        nema_update_flag = 0;
+static void output_streams_rate(void)
+{
+#ifdef INS_APP
+    // 100Hz
+    uint16_t divider = configGetPacketRateDivider(gConfiguration.packetRateDivider);
+    if (divider != 0 && divider < 2) {
+        divider = 2;
     }
+    divider = divider / 2;
 #else
-   if(nema_update_flag)
+    uint16_t divider = 1;
+#endif
+    continuous_stream.divider = divider; ///< 0 is quiet mode
+}
+#endif
+
+/** ****************************************************************************
+ * @name send_continuous_packet
+ * @brief one frame of the output scheduler a tick: the packets due, highest
+ *        priority first, as many as the user uart sends in a tick at its baud
+ *        rate, then once to each sink
+ * @param [In] N/A
+ * @retval N/A
+ ******************************************************************************/
+static void send_continuous_packet(void)
+{
+    static uint8_t output_init = 0;
+
+    if (!output_init) {
+        output_sched_init(&output_sched, 0);
+        output_sched_add_sink(&output_sched, &uart_sink);
+        output_sched_add_sink(&output_sched, &tcp_sink);
+        output_streams_init();
+        output_init = 1;
+    }
+    // the baud rate can change with the configuration
+    output_sched.budget = uart_tx_budget(UART_USER, OUTPUT_SCHED_TICK_MS);
+    output_streams_rate();
+    output_sched_tick(&output_sched);
+}
+
+/* "get output stats": a line per sink, frames bytes drop_frame drop_bytes
+   backlog backlog_max, then the frames let past the budget */
+static void output_stat_print(void)
+{
+    static const char *sink_name[] = {"uart", "tcp", "spi"};
+    char buf[128];
+    sentence_t s;
+    uint16_t len;
+    uint8_t i;
+
+    for (i = 0; i < output_sched.nsink; i++)
     {
-        double ecef[3];
-        ecef[0] = g_gnss_sol.pos_ecef[0];
-        ecef[1] = g_gnss_sol.pos_ecef[1];
-        ecef[2] = g_gnss_sol.pos_ecef[2];
-        
-        gtime_t time = gpst2time(g_gnss_sol.gps_week, g_gnss_sol.gps_tow*0.001);
-        print_rmc(time, ecef,1, rmc_buff);   
-        print_gsv((unsigned char *)gsv_buff,1,sky_view_ptr);
-
-        uart_write_bytes(UART_USER, (char *)gga_buff, strlen(gga_buff), 1);
-        uart_write_bytes(UART_USER, (char *)rmc_buff, strlen(rmc_buff), 1);
-        uart_write_bytes(UART_USER, (char *)gsv_buff, strlen(gsv_buff), 1);    
-        nema_update_flag = 0;
+        output_sink_t *sink = output_sched.sink[i];
+
+        sentence_begin(&s, buf, sizeof(buf));
+        sentence_str(&s, "$OUTPUT,");
+        sentence_str(&s, sink_name[sink->id]);
+        sentence_str(&s, ",");
+        sentence_uint(&s, sink->frames, 0);
+        sentence_str(&s, ",");
+        sentence_uint(&s, sink->bytes, 0);
+        sentence_str(&s, ",");
+        sentence_uint(&s, sink->drop_frame, 0);
+        sentence_str(&s, ",");
+        sentence_uint(&s, sink->drop_bytes, 0);
+        sentence_str(&s, ",");
+        sentence_uint(&s, sink->backlog_last, 0);
+        sentence_str(&s, ",");
+        sentence_uint(&s, sink->backlog_max, 0);
+        len = sentence_end_upper(&s, "*");
+        uart_write_bytes(UART_DEBUG, buf, len, 1);
     }
-#endif
+    sentence_begin(&s, buf, sizeof(buf));
+    sentence_str(&s, "$OUTPUT,over_budget,");
+    sentence_uint(&s, output_sched.over_budget, 0);
+    len = sentence_end_upper(&s, "*");
+    uart_write_bytes(UART_DEBUG, buf, len, 1);
+}
 
-#endif
+void SendContinuousPacket(void)
+{
+    EVENT_TRACE1(EVENT_OUTPUT_BEGIN, gConfiguration.packetCode);
+    send_continuous_packet();
+    EVENT_TRACE0(EVENT_OUTPUT_END);
 }
 
 void debug_com_process(void)
 {
+    static uint8_t trace_buf[2][EVENT_TRACE_FRAME_LEN(EVENT_TRACE_UART_RECORDS)];
+    static uint8_t trace_half = 0;
+    uint16_t len;
+
     if (uart_sem_wait(UART_DEBUG, 0) == RTK_SEM_OK){
         debug_com_rx_data_handle();
     }
+    // one buffer can still be in the dma while the other is filled
+    if (event_trace_sink() == EVENT_TRACE_SINK_UART)
+    {
+        len = event_trace_drain(trace_buf[trace_half], sizeof(trace_buf[0]));
+        if (len)
+        {
+            uart_write_bytes(UART_DEBUG, (const char *)trace_buf[trace_half], len, 1);
+            trace_half ^= 1;
+        }
+    }
 #ifdef INS_APP
     if (debug_com_log_on)
     {
@@ -36,13 +36,9 @@ limitations under the License.
 #include "main.h"
 #include "tcp_driver.h"
 
-typedef struct{
-    int      type;
-    uint16_t code;
-}ucbInputSyncTableEntry_t;
 // NEEDS TO BE CHECKED
 /// List of allowed input packet codes
-ucbInputSyncTableEntry_t ucbInputSyncTable[] = {
+ucb_packet_t ucbInputSyncTable[] = {
     {UCB_PING,              0x504B},    //  "PK"
     {UCB_ECHO,              0x4348},    //  "CH"
     {UCB_GET_PACKET,        0x4750},    //  "GP"
@@ -63,6 +59,7 @@ ucbInputSyncTableEntry_t ucbInputSyncTable[] = {
     {UCB_HARDWARE_TEST,     0x4854},    //  "HT"
     {UCB_INPUT_PACKET_MAX,  0x00000000},    //  "  "
 };
+#include "ucb_code_tables.h"     // ucbInputSyncIndex from the table above
 
 uint8_t dataBuffer[512];
 
@@ -94,7 +91,7 @@ BOOL HandleUcbRx (UcbPacketStruct  *ucbPacket)
     unsigned char tmp;
 	unsigned int  pos = 0, synced = 0, type;
 	uint16_t crcCalc;
-    ucbInputSyncTableEntry_t *syncTable;
+    int found;
 	
     
 	while(1){
@@ -119,15 +116,10 @@ BOOL HandleUcbRx (UcbPacketStruct  *ucbPacket)
         synced = 0;
         if((sync & 0xFFFF0000) == 0x55550000){
             code = sync & 0xffff;
-            syncTable = ucbInputSyncTable;
-            while (syncTable->type != UCB_INPUT_PACKET_MAX)
-            {
-                if (syncTable->code == code){
-                    synced = 1;
-                    type   = syncTable->type;
-                    break;
-                }
-                syncTable++;
+            found = UcbCodeIndexFind(&ucbInputSyncIndex, code);
+            if (found >= 0){
+                synced = 1;
+                type   = found;
             }
             if(!synced){
                 type = checkUserPacketType(code);
@@ -206,7 +198,7 @@ BOOL HandleUcbRx (UcbPacketStruct  *ucbPacket)
  *  payload (uint8_t)data[Length]
  *  CRC 0x####
  * Trace: [SDD_UCB_PROCESS_OUT <-- SRC_UCB_OUT_PKT]
- * @param [in] port - port type UCB or CRM
+ * @param [in] port - port type UCB or CRM, UCB_PORT_FRAME only builds it
  * @param [in] packetPtr -- buffer structure with payload, type and size
  * @retval valid packet in packetPtr TRUE
  ******************************************************************************/
@@ -236,6 +228,10 @@ void HandleUcbTx (int port, UcbPacketStruct *ptrUcbPacket)
     crc = CalculateCRC((uint8_t *)&ptrUcbPacket->code_MSB, ptrUcbPacket->payloadLength + 3);
     ptrUcbPacket->payload[ptrUcbPacket->payloadLength+1]   = (crc >> 8) & 0xff;
     ptrUcbPacket->payload[ptrUcbPacket->payloadLength]     =  crc  & 0xff;
+    if(port == UCB_PORT_FRAME)
+    {
+        return; // the output scheduler copies it into its frame
+    }
     if(get_tcp_driver_state() == CLIENT_STATE_INTERACTIVE)
     {
         client_write_data(&driver_client,(const char *)&ptrUcbPacket->sync_MSB, ptrUcbPacket->payloadLength + 7,  0x01);
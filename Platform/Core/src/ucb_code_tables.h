@@ -0,0 +1,121 @@
+#ifndef UCB_CODE_TABLES_H
+#define UCB_CODE_TABLES_H
+
+/* generated by ucb_code_tables.py from the tables it names, edit the
+   tables and run the script */
+
+#include <stdint.h>
+#include "ucb_packet.h"
+
+#if UCB_CODE_INDEX_BITS != 6
+#error the tables are hashed for 6 index bits
+#endif
+
+/// ucbPackets[] of src/ucb_packet.c, 26 codes
+static const ucb_code_index_t ucbPacketIndex = {
+	0x9F17,
+	{
+		[ 0] = {0x4A49, UCB_J2IAP},               // "JI"
+		[ 6] = {0x4750, UCB_GET_PACKET},          // "GP"
+		[ 7] = {0x5641, UCB_VERSION_ALL_DATA},    // "VA"
+		[ 8] = {0x464D, UCB_FACTORY_M},           // "FM"
+		[13] = {0x5741, UCB_WRITE_APP},           // "WA"
+		[15] = {0x5245, UCB_READ_EEPROM},         // "RE"
+		[18] = {0x5330, UCB_SCALED_0},            // "S0"
+		[19] = {0x534D, UCB_SCALED_M},            // "SM"
+		[20] = {0x5746, UCB_WRITE_FIELDS},        // "WF"
+		[22] = {0x5550, UCB_USER_OUT},            // "UP"
+		[23] = {0x4632, UCB_FACTORY_2},           // "F2"
+		[24] = {0x5430, UCB_TEST_0},              // "T0"
+		[26] = {0x5352, UCB_SOFTWARE_RESET},      // "SR"
+		[29] = {0x5743, UCB_WRITE_CAL},           // "WC"
+		[33] = {0x5545, UCB_UNLOCK_EEPROM},       // "UE"
+		[37] = {0x4E53, UCB_NET_STATS},           // "NS"
+		[43] = {0x5652, UCB_VERSION_DATA},        // "VR"
+		[44] = {0x5745, UCB_WRITE_EEPROM},        // "WE"
+		[47] = {0x4631, UCB_FACTORY_1},           // "F1"
+		[48] = {0x4348, UCB_ECHO},                // "CH"
+		[50] = {0x504B, UCB_PING},                // "PK"
+		[52] = {0x4944, UCB_IDENTIFICATION},      // "ID"
+		[55] = {0x5246, UCB_READ_FIELDS},         // "RF"
+		[56] = {0x4746, UCB_GET_FIELDS},          // "GF"
+		[58] = {0x5331, UCB_SCALED_1},            // "S1"
+		[61] = {0x5346, UCB_SET_FIELDS},          // "SF"
+	},
+};
+
+static const uint16_t ucbPacketCode[] = {
+	[UCB_J2IAP] = 0x4A49,
+	[UCB_PING] = 0x504B,
+	[UCB_ECHO] = 0x4348,
+	[UCB_GET_PACKET] = 0x4750,
+	[UCB_SET_FIELDS] = 0x5346,
+	[UCB_GET_FIELDS] = 0x4746,
+	[UCB_READ_FIELDS] = 0x5246,
+	[UCB_WRITE_FIELDS] = 0x5746,
+	[UCB_UNLOCK_EEPROM] = 0x5545,
+	[UCB_READ_EEPROM] = 0x5245,
+	[UCB_WRITE_EEPROM] = 0x5745,
+	[UCB_SOFTWARE_RESET] = 0x5352,
+	[UCB_WRITE_APP] = 0x5741,
+	[UCB_WRITE_CAL] = 0x5743,
+	[UCB_IDENTIFICATION] = 0x4944,
+	[UCB_VERSION_DATA] = 0x5652,
+	[UCB_VERSION_ALL_DATA] = 0x5641,
+	[UCB_SCALED_0] = 0x5330,
+	[UCB_SCALED_1] = 0x5331,
+	[UCB_SCALED_M] = 0x534D,
+	[UCB_TEST_0] = 0x5430,
+	[UCB_FACTORY_1] = 0x4631,
+	[UCB_FACTORY_2] = 0x4632,
+	[UCB_FACTORY_M] = 0x464D,
+	[UCB_NET_STATS] = 0x4E53,
+};
+
+/// ucbInputSyncTable[] of src/serial_port.c, 18 codes
+static const ucb_code_index_t ucbInputSyncIndex = {
+	0x9E69,
+	{
+		[ 2] = {0x4348, UCB_ECHO},                // "CH"
+		[ 5] = {0x5243, UCB_READ_CAL},            // "RC"
+		[ 9] = {0x5743, UCB_WRITE_CAL},           // "WC"
+		[12] = {0x4A42, UCB_J2BOOT},              // "JB"
+		[14] = {0x504B, UCB_PING},                // "PK"
+		[21] = {0x5245, UCB_READ_EEPROM},         // "RE"
+		[22] = {0x5346, UCB_SET_FIELDS},          // "SF"
+		[24] = {0x5745, UCB_WRITE_EEPROM},        // "WE"
+		[27] = {0x4746, UCB_GET_FIELDS},          // "GF"
+		[32] = {0x4854, UCB_HARDWARE_TEST},       // "HT"
+		[33] = {0x4A49, UCB_J2IAP},               // "JI"
+		[35] = {0x5545, UCB_UNLOCK_EEPROM},       // "UE"
+		[36] = {0x4A41, UCB_J2APP},               // "JA"
+		[39] = {0x4750, UCB_GET_PACKET},          // "GP"
+		[50] = {0x5352, UCB_SOFTWARE_RESET},      // "SR"
+		[57] = {0x5741, UCB_WRITE_APP},           // "WA"
+		[60] = {0x5246, UCB_READ_FIELDS},         // "RF"
+		[63] = {0x5746, UCB_WRITE_FIELDS},        // "WF"
+	},
+};
+
+static const uint16_t ucbInputSyncCode[] = {
+	[UCB_PING] = 0x504B,
+	[UCB_ECHO] = 0x4348,
+	[UCB_GET_PACKET] = 0x4750,
+	[UCB_SET_FIELDS] = 0x5346,
+	[UCB_GET_FIELDS] = 0x4746,
+	[UCB_READ_FIELDS] = 0x5246,
+	[UCB_WRITE_FIELDS] = 0x5746,
+	[UCB_UNLOCK_EEPROM] = 0x5545,
+	[UCB_READ_EEPROM] = 0x5245,
+	[UCB_WRITE_EEPROM] = 0x5745,
+	[UCB_SOFTWARE_RESET] = 0x5352,
+	[UCB_WRITE_CAL] = 0x5743,
+	[UCB_READ_CAL] = 0x5243,
+	[UCB_WRITE_APP] = 0x5741,
+	[UCB_J2BOOT] = 0x4A42,
+	[UCB_J2IAP] = 0x4A49,
+	[UCB_J2APP] = 0x4A41,
+	[UCB_HARDWARE_TEST] = 0x4854,
+};
+
+#endif
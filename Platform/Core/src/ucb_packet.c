@@ -57,12 +57,40 @@ ucb_packet_t ucbPackets[] = {		//
     {UCB_FACTORY_1,          0x4631},   //  "F1" 
     {UCB_FACTORY_2,          0x4632},   //  "F2"
     {UCB_FACTORY_M,          0x464D},   //  "FM"
+    {UCB_NET_STATS,          0x4E53},   //  "NS"
     {UCB_USER_OUT,           0x5550},   //  "UP" 
     {UCB_PKT_NONE,           0x0000}   //  "  "     should be last in the table as a end marker 
 };
 
 
 
+#include "ucb_code_tables.h"     // ucbPacketIndex, ucbPacketCode from the table above
+
+
+static uint16_t UcbCodeHash(uint16_t code, uint16_t mult)
+{
+    return (uint16_t)(code * mult) >> (16 - UCB_CODE_INDEX_BITS);
+}
+
+/** ****************************************************************************
+ * @name UcbCodeIndexFind
+ * @brief Look up a packet code in the generated hash of a code table, one
+ *        multiply and one compare
+ * @param [in] index - hash of the table, see ucb_code_tables.py
+ * @param [in] code - packet code eg 0x504B
+ * @Retval packet type, -1 if the code is not in the table
+ ******************************************************************************/
+int UcbCodeIndexFind(const ucb_code_index_t *index, uint16_t code)
+{
+    const ucb_code_slot_t *slot = &index->slot[UcbCodeHash(code, index->mult)];
+
+    if (code != 0 && slot->code == code) {
+        return slot->type;
+    }
+    return -1;
+}
+
+
 /** ****************************************************************************
  * @name UcbPacketBytesToPacketType
  * @brief Convert the packet bytes into the packet type enum eg "PK" -> 0x504B
@@ -76,20 +104,13 @@ ucb_packet_t ucbPackets[] = {		//
 UcbPacketType UcbPacketBytesToPacketType (const uint8_t bytes [])
 {
 	UcbPacketType packetType = UCB_ERROR_INVALID_TYPE;
-    ucb_packet_t *pkt = ucbPackets; 
 	uint16_t receivedCode = (uint16_t)(((bytes[0] & 0xff) << 8) |
                                                           (bytes[1] & 0xff));
+    int type = UcbCodeIndexFind(&ucbPacketIndex, receivedCode);
 
-    /// search through the packet code table for a matching code - check type
-    /// against valid types
-
-	while (pkt->packetType != UCB_PKT_NONE) {
-        if ( receivedCode == pkt->packetCode ) {
-            packetType = pkt->packetType;
-            break;
-        }
-        pkt++;
-	}
+    if (type >= 0) {
+        packetType = (UcbPacketType)type;
+    }
     
 #ifndef USER_PACKETS_NOT_SUPPORTED
     if(packetType == UCB_ERROR_INVALID_TYPE){
@@ -112,23 +133,17 @@ UcbPacketType UcbPacketBytesToPacketType (const uint8_t bytes [])
 BOOL UcbPacketPacketTypeToBytes (UcbPacketType type,
                                  uint8_t       bytes [])
 {
-    ucb_packet_t *ptr = ucbPackets;
-// carefull here, since for sake of speed it's indexing but not lookup through ucbPackets structure  
-
 #ifndef USER_PACKETS_NOT_SUPPORTED
     if(type == UCB_USER_OUT){
         userPacketTypeToBytes(bytes);
         return TRUE;
     }
 #endif
-    
-    while(ptr->packetType != UCB_PKT_NONE){
-        if(ptr->packetType == type){
-            bytes[0] = (uint8_t)((ptr->packetCode >> 8) & 0xff);
-            bytes[1] = (uint8_t)(ptr->packetCode & 0xff);
-            return TRUE;
-        }
-        ptr++;
+
+    if ((unsigned)type < sizeof(ucbPacketCode) / sizeof(ucbPacketCode[0]) && ucbPacketCode[type] != 0) {
+        bytes[0] = (uint8_t)((ucbPacketCode[type] >> 8) & 0xff);
+        bytes[1] = (uint8_t)(ucbPacketCode[type] & 0xff);
+        return TRUE;
     }
     
 	bytes[0] = 0;
@@ -203,6 +218,7 @@ BOOL UcbPacketIsAnOutputPacket (UcbPacketType type)
         case UCB_FACTORY_1:
         case UCB_FACTORY_2:
         case UCB_FACTORY_M:
+        case UCB_NET_STATS:
             break;
 		default:
           isAnOutputPacket = FALSE;
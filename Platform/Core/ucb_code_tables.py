@@ -0,0 +1,194 @@
+#!/usr/bin/env python3
+"""
+Generate src/ucb_code_tables.h, the const packet code lookups of
+src/ucb_packet.c and src/serial_port.c.
+
+    python3 ucb_code_tables.py [-o src/ucb_code_tables.h] [--check]
+    python3 ucb_code_tables.py --user user_message.c -o user_code_tables.h
+
+The code tables stay where they are and are read from the C sources:
+ucbPackets[] (src/ucb_packet.c) and ucbInputSyncTable[] (src/serial_port.c).
+Each one becomes
+
+ - a perfect hash of UCB_CODE_INDEX_SIZE slots: multipliers are tried until
+   every code of the table has a slot of its own, so UcbCodeIndexFind() is
+   one multiply and one compare, and nothing is built in RAM at run time
+ - a type -> code array, the first entry of a type wins. For the built-in
+   tables it holds the UcbPacketType types, the user packet types
+   (UCB_USER_IN, UCB_USER_OUT) are answered before the lookup
+
+The last entry of a table is its end marker, entries with code 0 are left
+out, as the table walks did.
+
+The user packet tables live in the application (usr_packet_t
+userInputPackets[] and userOutputPackets[] in its user_message.c). Run the
+script with --user on that file and include the output there, so
+checkUserPacketType() looks its codes up the same way. The host build does
+this for the stand-in tables in test/port/user_message.c.
+
+--check compares with the output file instead of writing it, the host build
+runs it as a test so a table edit without a new header fails.
+
+Keep ucb_hash() in sync with UcbCodeHash() in src/ucb_packet.c and
+INDEX_BITS with UCB_CODE_INDEX_BITS in include/ucb_packet.h.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+INDEX_BITS = 6
+MULT_FIRST = 0x9E37
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+# source file, table, name of the lookups
+TABLES = (
+    ("src/ucb_packet.c", "ucbPackets", "ucbPacket"),
+    ("src/serial_port.c", "ucbInputSyncTable", "ucbInputSync"),
+)
+
+
+def ucb_hash(code, mult):
+    return ((code * mult) & 0xFFFF) >> (16 - INDEX_BITS)
+
+
+def strip_comments(text):
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    return re.sub(r"//[^\n]*", "", text)
+
+
+def c_int(s):
+    s = s.strip()
+    if len(s) == 3 and s[0] == s[2] == "'":
+        return ord(s[1])
+    return int(s, 0)
+
+
+def usr_code(s):
+    """usr_packet_t code: "pG" or {0x70, 'G'}"""
+    s = s.strip()
+    if s.startswith('"'):
+        b = s[1:-1].encode()
+        return (b[0] << 8) | b[1]
+    a, b = s.strip("{}").split(",")
+    return (c_int(a) << 8) | c_int(b)
+
+
+def read_tables(path):
+    """every ucb_packet_t / usr_packet_t table of a C file, name -> [(type, code)]"""
+    with open(path) as f:
+        text = strip_comments(f.read())
+    tables = {}
+    for kind, name, body in re.findall(r"(ucb_packet_t|usr_packet_t)\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\};",
+                                       text, flags=re.S):
+        if kind == "ucb_packet_t":
+            rows = [(t, c_int(c)) for t, c in
+                    re.findall(r"\{\s*(\w+)\s*,\s*(\w+)\s*\}", body)]
+        else:
+            rows = [(t, usr_code(c)) for t, c in
+                    re.findall(r"\{\s*(\w+)\s*,\s*(\"..\"|\{[^}]*\})\s*\}", body)]
+        tables[name] = rows
+    return tables
+
+
+def enum_members(path, name):
+    with open(path) as f:
+        text = strip_comments(f.read())
+    body = re.search(r"typedef\s+enum\s*\{(.*?)\}\s*%s\s*;" % name, text, flags=re.S).group(1)
+    return set(re.findall(r"(\w+)\s*(?:=[^,]*)?,", body + ","))
+
+
+def perfect_mult(codes):
+    mult = MULT_FIRST
+    for _ in range(0x10000):
+        if len(set(ucb_hash(c, mult) for c in codes)) == len(codes):
+            return mult
+        mult = (mult + 2) & 0xFFFF
+    return None
+
+
+def emit(table, src, name, rows, types=None):
+    entries = [(t, c) for t, c in rows[:-1] if c != 0]
+    codes = sorted(set(c for _, c in entries))
+    mult = perfect_mult(codes)
+    if mult is None:
+        sys.exit("%s: no collision free multiplier for %d codes, raise INDEX_BITS"
+                 % (table, len(codes)))
+    slots = {}
+    first = {}
+    for t, c in entries:
+        slots.setdefault(ucb_hash(c, mult), (c, t))
+        if types is None or t in types:
+            first.setdefault(t, c)
+
+    out = ["/// %s[] of %s, %d codes" % (table, src, len(codes)),
+           "static const ucb_code_index_t %sIndex = {" % name,
+           "\t0x%04X," % mult,
+           "\t{"]
+    for slot in sorted(slots):
+        c, t = slots[slot]
+        out.append("\t\t[%2d] = {0x%04X, %s},%s// \"%s\"" %
+                   (slot, c, t, " " * max(1, 24 - len(t)), chr(c >> 8) + chr(c & 0xFF)))
+    out += ["\t},", "};", "",
+            "static const uint16_t %sCode[] = {" % name]
+    for t, c in first.items():
+        out.append("\t[%s] = 0x%04X," % (t, c))
+    out += ["};", ""]
+    return out
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument("-o", "--output")
+    ap.add_argument("--user", help="the application's user_message.c")
+    ap.add_argument("--check", action="store_true", help="compare with the output, do not write")
+    args = ap.parse_args()
+
+    if args.user:
+        output = args.output or "user_code_tables.h"
+        guard = "USER_CODE_TABLES_H"
+        tables = read_tables(args.user)
+        src = os.path.basename(args.user)
+        todo = [(src, n, re.sub(r"Packets$", "", n)) for n in tables]
+        load = {src: tables}
+        types = None
+    else:
+        output = args.output or os.path.join(HERE, "src/ucb_code_tables.h")
+        guard = "UCB_CODE_TABLES_H"
+        todo = TABLES
+        load = {src: read_tables(os.path.join(HERE, src)) for src, _, _ in TABLES}
+        types = enum_members(os.path.join(HERE, "include/ucb_packet.h"), "UcbPacketType")
+
+    text = ["#ifndef %s" % guard,
+            "#define %s" % guard,
+            "",
+            "/* generated by ucb_code_tables.py from the tables it names, edit the",
+            "   tables and run the script */",
+            "",
+            "#include <stdint.h>",
+            "#include \"ucb_packet.h\"",
+            "",
+            "#if UCB_CODE_INDEX_BITS != %d" % INDEX_BITS,
+            "#error the tables are hashed for %d index bits" % INDEX_BITS,
+            "#endif",
+            ""]
+    for src, table, name in todo:
+        if table not in load[src]:
+            sys.exit("%s: no table %s" % (src, table))
+        text += emit(table, src, name, load[src][table], types)
+    text += ["#endif", ""]
+    text = "\n".join(text)
+
+    if args.check:
+        with open(output) as f:
+            if f.read() != text:
+                sys.exit("%s is out of date, run ucb_code_tables.py" % output)
+        return
+    with open(output, "w", newline="\n") as f:
+        f.write(text)
+
+
+if __name__ == "__main__":
+    main()
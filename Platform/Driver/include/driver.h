@@ -24,6 +24,7 @@ typedef enum rtk_ret_e_
 	RTK_OK = 1,
     RTK_SEM_OK = 2,
 	UART_ERR = 10,
+	UART_TX_DROP = -1,      // uart_write_bytes: the frame did not fit and was dropped
     RTK_JSON = 100,
 	BT_CMD = 101,
     BT_BASE = 102,
@@ -0,0 +1,93 @@
+/** ***************************************************************************
+ * @file   event_trace.h
+ * @brief  binary event trace, fixed size records in a RAM ring
+ *
+ * A record is a cycle count, an event id and up to four 32 bit args. It is
+ * written without locks from tasks and isrs, so probes can stay in the
+ * production build: while tracing is off a probe is one load and a branch.
+ * "log trace on" on the debug uart or the driver data link turns it on and
+ * makes that link the sink, event_trace_drain() then packs the ring into
+ * frames for it and Platform/Driver/trace_decode.py turns the capture into
+ * a timeline.
+ *
+ * The decoder reads the event names from this file: keep every id an
+ * explicit EVENT_xxx = value line, BEGIN/END pairs become spans.
+ ******************************************************************************/
+#ifndef _EVENT_TRACE_H_
+#define _EVENT_TRACE_H_
+
+#include <stdint.h>
+
+#ifndef EVENT_TRACE_RECORDS
+#define EVENT_TRACE_RECORDS     256         /* power of 2 */
+#endif
+#ifndef EVENT_TRACE_UART_RECORDS
+#define EVENT_TRACE_UART_RECORDS 16         /* a frame per debug_com_process() */
+#endif
+#ifndef EVENT_TRACE_TCP_RECORDS
+#define EVENT_TRACE_TCP_RECORDS 64          /* a frame per driver_output_data_interface() */
+#endif
+#define EVENT_TRACE_MAX_ARGS    4
+
+#define EVENT_TRACE_SYNC0       'E'
+#define EVENT_TRACE_SYNC1       'T'
+#define EVENT_TRACE_VERSION     1
+#define EVENT_TRACE_HEADER_LEN  28          /* sync, version, nrec, lost, count, gps, hz */
+#define EVENT_TRACE_RECORD_LEN  24          /* time, id, ctx, nargs, arg[4] */
+#define EVENT_TRACE_FRAME_LEN(n) (EVENT_TRACE_HEADER_LEN + (n) * EVENT_TRACE_RECORD_LEN + 2)
+
+typedef enum {
+    EVENT_TRACE_SINK_NONE = 0,
+    EVENT_TRACE_SINK_UART,                  /* UART_DEBUG, from debug_com_process() */
+    EVENT_TRACE_SINK_TCP                    /* driver_data_client */
+} event_trace_sink_t;
+
+/* ids, the high byte is the group */
+typedef enum {
+    EVENT_LOG                   = 0x0000,   /* trace(), + level: format, up to 3 values */
+
+    EVENT_RTCM_DECODE_BEGIN     = 0x0100,   /* message type, length */
+    EVENT_RTCM_DECODE_END       = 0x0101,   /* message type, status */
+    EVENT_RTCM_PARITY           = 0x0102,   /* length */
+
+    EVENT_INS_FUSION_BEGIN      = 0x0200,   /* placed around ins_fusion() by its caller */
+    EVENT_INS_FUSION_END        = 0x0201,
+    EVENT_INS_IMU_RELEASE       = 0x0202,   /* imu sample time, us */
+
+    EVENT_OUTPUT_BEGIN          = 0x0300,   /* SendContinuousPacket, packet code */
+    EVENT_OUTPUT_END            = 0x0301,
+
+    EVENT_CAN_RX                = 0x0400,   /* identifier, dlc */
+    EVENT_CAN_TX_DONE           = 0x0401,
+
+    EVENT_NET_WRITE_BEGIN       = 0x0500,   /* netconn, length */
+    EVENT_NET_WRITE_END         = 0x0501,   /* netconn, err */
+    EVENT_NET_ETH_TX            = 0x0502,   /* frame length, err */
+} event_trace_id_t;
+
+#define EVENT_TRACE_GROUP(id)   ((id) >> 8)
+
+typedef struct {
+    uint32_t records;           /* written since on */
+    uint32_t lost;              /* overwritten before they were drained */
+    uint32_t frames;            /* drained */
+} event_trace_stat_t;
+
+extern volatile uint32_t event_trace_on;
+
+/* probes, for a call in a hot path the check is inline */
+#define EVENT_TRACE0(id)                do { if (event_trace_on) event_trace((id), 0, 0, 0, 0, 0); } while (0)
+#define EVENT_TRACE1(id, a)             do { if (event_trace_on) event_trace((id), 1, (uint32_t)(uintptr_t)(a), 0, 0, 0); } while (0)
+#define EVENT_TRACE2(id, a, b)          do { if (event_trace_on) event_trace((id), 2, (uint32_t)(uintptr_t)(a), (uint32_t)(uintptr_t)(b), 0, 0); } while (0)
+#define EVENT_TRACE3(id, a, b, c)       do { if (event_trace_on) event_trace((id), 3, (uint32_t)(uintptr_t)(a), (uint32_t)(uintptr_t)(b), (uint32_t)(uintptr_t)(c), 0); } while (0)
+#define EVENT_TRACE4(id, a, b, c, d)    do { if (event_trace_on) event_trace((id), 4, (uint32_t)(uintptr_t)(a), (uint32_t)(uintptr_t)(b), (uint32_t)(uintptr_t)(c), (uint32_t)(uintptr_t)(d)); } while (0)
+
+void event_trace(uint16_t id, uint8_t nargs, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+void event_trace_start(event_trace_sink_t sink);
+void event_trace_stop(void);
+event_trace_sink_t event_trace_sink(void);
+uint16_t event_trace_drain(uint8_t *buf, uint16_t len);
+int event_trace_command(const char *cmd, event_trace_sink_t sink);
+void event_trace_stat(event_trace_stat_t *stat);
+
+#endif
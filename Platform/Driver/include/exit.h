@@ -12,8 +12,10 @@
 #ifndef _EXIT_H_
 #define _EXIT_H_
 //#pragma once
+#include <stdint.h>
 void pps_exit_init(void);
 extern uint8_t get_gnss_signal_flag();
 void PLUSE_IRQ();
+int64_t get_wheel_tick_time();
 
 #endif
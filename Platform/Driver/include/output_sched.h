@@ -0,0 +1,110 @@
+/** ***************************************************************************
+ * @file   output_sched.h
+ * @brief  output scheduler: one frame a tick, fanned out once to each sink
+ *
+ * The periodic outputs are streams. Each tick output_sched_tick() asks the
+ * streams that are due, highest priority first, to fill their packets into
+ * one contiguous frame until the byte budget of the tick is spent, then
+ * hands the frame to every sink in one call. A stream that does not fit
+ * stays due for the next tick, so a burst (the 1 Hz gnss packets on top of
+ * the 100 Hz imu ones) is spread over the following ticks instead of
+ * overrunning the port.
+ *
+ * The budget is what the slowest paced sink (the user uart) sends in a tick,
+ * less its backlog. The first stream of a tick always gets in, also when it
+ * is larger than the budget, so a packet longer than a tick at a low baud
+ * rate is not held forever. That first place goes to the stream that has
+ * waited the most ticks, ahead of its priority, so a stream due every tick
+ * cannot keep a lower priority one out for good.
+ *
+ * Nothing here touches the hardware: the sinks are callbacks, so the module
+ * runs on the host as it is.
+ ******************************************************************************/
+#ifndef _OUTPUT_SCHED_H_
+#define _OUTPUT_SCHED_H_
+
+#include <stdint.h>
+
+#ifndef OUTPUT_SCHED_FRAME_SIZE
+#define OUTPUT_SCHED_FRAME_SIZE     1024    /* a tick at 921600 baud */
+#endif
+#define OUTPUT_SCHED_MAX_STREAMS    8
+#define OUTPUT_SCHED_MAX_SINKS      4
+#define OUTPUT_SCHED_TICK_MS        10      /* SendContinuousPacket() rate */
+
+#define OUTPUT_SINK(id)             (1u << (id))
+#define OUTPUT_FILL_LATER           (-1)    /* fill(): does not fit, keep the stream due */
+
+typedef struct output_stream_s output_stream_t;
+typedef struct output_sink_s output_sink_t;
+
+/* write the stream's packets into buf, at most size bytes, and return the
+   bytes written: 0 if there is nothing this period, OUTPUT_FILL_LATER if it
+   does not fit. Set pending to be called again next tick for the rest. */
+typedef int (*output_fill_t)(output_stream_t *stream, uint8_t *buf, uint16_t size);
+
+struct output_stream_s {
+    output_fill_t fill;
+    uint16_t divider;           /* due every divider-th tick, 0 quiet */
+    uint16_t count;             /* ticks to the next due one, start with the first delay */
+    uint8_t  priority;          /* 0 first */
+    uint8_t  sinks;             /* OUTPUT_SINK(id) of the sinks it goes to */
+    uint8_t  pending;           /* due whatever the divider */
+    void    *ctx;
+    /* counters */
+    uint32_t sent;              /* fills that wrote bytes */
+    uint32_t deferred;          /* ticks it waited for the budget */
+    uint16_t waited;            /* of them in a row, up to the last fill */
+};
+
+typedef struct {
+    output_stream_t *stream;
+    uint16_t off;
+    uint16_t len;
+} output_span_t;
+
+typedef struct {
+    const uint8_t *buf;
+    uint16_t len;
+    uint8_t  nspan;
+    output_span_t span[OUTPUT_SCHED_MAX_STREAMS];
+} output_frame_t;
+
+/* send the spans of the frame routed to the sink, return the bytes dropped */
+typedef uint32_t (*output_send_t)(output_sink_t *sink, const output_frame_t *frame);
+/* bytes still queued in the sink */
+typedef uint32_t (*output_backlog_t)(output_sink_t *sink);
+
+struct output_sink_s {
+    output_send_t send;
+    output_backlog_t backlog;   /* NULL: not paced, left out of the budget */
+    uint8_t  id;                /* 0..7, OUTPUT_SINK(id) in output_stream_t.sinks */
+    void    *ctx;
+    /* counters */
+    uint32_t frames;            /* frames with spans for it */
+    uint32_t bytes;             /* bytes it took */
+    uint32_t drop_frame;        /* frames it dropped bytes of */
+    uint32_t drop_bytes;
+    uint32_t backlog_last;      /* backlog at the last tick */
+    uint32_t backlog_max;
+};
+
+typedef struct {
+    output_stream_t *stream[OUTPUT_SCHED_MAX_STREAMS];  /* by priority */
+    output_sink_t *sink[OUTPUT_SCHED_MAX_SINKS];
+    uint8_t  nstream;
+    uint8_t  nsink;
+    uint32_t budget;            /* bytes a tick, 0 the frame size */
+    uint32_t ticks;
+    uint32_t over_budget;       /* frames let past the budget */
+    uint8_t  buf[OUTPUT_SCHED_FRAME_SIZE];
+    output_frame_t frame;
+} output_sched_t;
+
+void output_sched_init(output_sched_t *sched, uint32_t budget);
+int output_sched_add_stream(output_sched_t *sched, output_stream_t *stream);
+int output_sched_add_sink(output_sched_t *sched, output_sink_t *sink);
+uint16_t output_sched_tick(output_sched_t *sched);
+uint16_t output_frame_run(const output_frame_t *frame, uint8_t id, uint8_t *i, const uint8_t **data);
+
+#endif
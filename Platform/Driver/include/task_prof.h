@@ -0,0 +1,56 @@
+/** ***************************************************************************
+ * @file   task_prof.h
+ * @brief  per task response time, jitter and cpu share of the task graph
+ *
+ * Build with TASK_PROFILE defined to record, otherwise the TASK_PROF_xxx
+ * macros compile to nothing. The cpu share also needs
+ * configGENERATE_RUN_TIME_STATS and configUSE_TRACE_FACILITY set to 1 in
+ * FreeRTOSConfig.h, with the run time counter mapped to task_prof_runtime().
+ ******************************************************************************/
+#ifndef _TASK_PROF_H_
+#define _TASK_PROF_H_
+
+#include <stdint.h>
+
+typedef enum {
+    TASK_PROF_IMU = 0,          /* 100 Hz imu semaphore to data acquired */
+    TASK_PROF_INS,              /* ins fusion */
+    TASK_PROF_RTCM,             /* rtcm decode */
+    TASK_PROF_CAN,              /* TaskCANCommunicationJ1939 */
+    TASK_PROF_NTRIP,            /* NTRIP_interface */
+    TASK_PROF_DRIVER,           /* driver_interface */
+    TASK_PROF_DHCP,             /* dhcp_thread */
+    TASK_PROF_MAX
+} task_prof_id_t;
+
+typedef struct {
+    uint32_t n;                 /* completed jobs */
+    uint32_t nmiss;             /* releases while the previous job was pending */
+    uint32_t release;           /* counter at the last release */
+    uint8_t  pending;           /* released and not done */
+    uint32_t period_min;        /* release interval (counts) */
+    uint32_t period_max;
+    uint32_t resp_min;          /* release to done (counts) */
+    uint32_t resp_max;
+    uint64_t resp_sum;
+} task_prof_t;
+
+#ifdef TASK_PROFILE
+#define TASK_PROF_RELEASE(id)   task_prof_release(id)
+#define TASK_PROF_DONE(id)      task_prof_done(id)
+#else
+#define TASK_PROF_RELEASE(id)
+#define TASK_PROF_DONE(id)
+#endif
+
+void task_prof_init(void);
+void task_prof_reset(void);
+uint32_t task_prof_counter(void);
+uint32_t task_prof_counter_hz(void);
+uint32_t task_prof_runtime(void);
+void task_prof_release(task_prof_id_t id);
+void task_prof_done(task_prof_id_t id);
+int task_prof_get(task_prof_id_t id, task_prof_t *prof);
+int task_prof_cpu_share(char *buf, int len);
+
+#endif
@@ -0,0 +1,45 @@
+/** ***************************************************************************
+ * @file   time_service.h
+ * @brief  microsecond time stamps for all inputs, disciplined by the PPS
+ *
+ * The DWT cycle counter, extended to 64 bits, runs free. A linear model
+ * (time and rate at a reference count) turns counts into time. Each PPS
+ * edge corrects the model by slewing the rate, so the clock never jumps
+ * once it is locked; only an error over TIME_STEP_US sets it. The time
+ * base is the one of g_MCU_time: its seconds, with the PPS edge at
+ * TIME_PPS_PHASE_US into the second.
+ *
+ * Stamped with it, each kept with its input and read back by getter: the
+ * CAN frames of car_data.c (car_can_frame_t.time), the IMU sample release
+ * (get_imu_sample_time), the wheel ticks (get_wheel_tick_time), the end of
+ * each UART rx burst (uart_rx_time), the RTCM epochs where they are decoded
+ * and the event trace.
+ ******************************************************************************/
+#ifndef _TIME_SERVICE_H_
+#define _TIME_SERVICE_H_
+
+#include <stdint.h>
+
+#define TIME_PPS_PHASE_US       500000      /* where ST_PPS_IRQ puts g_MCU_time at the edge */
+#define TIME_STEP_US            1000        /* larger errors set the clock instead of slewing it */
+#define TIME_PPS_CLAMP_US       10          /* single edge correction limit, rejects late isrs */
+#define TIME_PPS_MAX_GAP_US     4000000     /* edges further apart restart the lock */
+
+typedef struct {
+    uint32_t pps;               /* edges used */
+    uint32_t steps;             /* times the clock was set */
+    uint32_t clamped;           /* edges off by more than TIME_PPS_CLAMP_US */
+    int32_t  err_ns;            /* last edge, reference minus clock */
+    int32_t  freq_ppb;          /* counter frequency against SystemCoreClock */
+    uint8_t  locked;            /* 0 free running, 1 phase set, 2 phase and frequency */
+} time_service_stat_t;
+
+void time_service_init(void);
+void time_service_tick(void);
+void time_service_pps(uint64_t count, int64_t ref_us);
+uint64_t time_count(void);
+int64_t time_count_to_gps(uint64_t count);
+int64_t now_gps(void);
+void time_service_stat(time_service_stat_t *stat);
+
+#endif
@@ -17,6 +17,7 @@
 #define _TIMER_H_
 //#pragma once
 #include <time.h>
+#include <stdint.h>
 #include "cmsis_os.h"
 typedef struct mcu_time_base_t_
 {
@@ -32,6 +33,7 @@ void MX_TIM1_Init(void);
 void MX_TIM_SENSOR_Init(void);
 time_t get_time_of_msec();
 volatile mcu_time_base_t *get_mcu_time();
+int64_t get_imu_sample_time();
 
 void release_sem(osSemaphoreId sem);
 double get_gnss_time();
@@ -66,6 +66,11 @@ typedef struct _uart_tx_fifo
     uint32_t data_total_num;
     uint32_t is_data_available;
     uint8_t is_dma_busy; //TODO:
+    uint16_t dma_len;           // bytes at the fifo tail owned by the running dma
+    uint32_t drop_frame;        // frames dropped because they did not fit
+    uint32_t drop_bytes;
+    uint16_t head;              // end of the spans claimed by writers, in once they are copied
+    uint8_t writers;            // writers copying into their claimed spans
 } uart_tx_dma_fifo_s;
 #endif
 
@@ -102,6 +107,7 @@ typedef struct
     UART_HandleTypeDef *huart;
     DMA_HandleTypeDef *hdma_usart_rx;
     DMA_HandleTypeDef *hdma_usart_tx;
+    volatile int64_t rx_time;       /* now_gps() of the end of the last rx burst */
 } uart_obj_t;
 
 int uart_read_bytes(uart_port_e uart_num, uint8_t *buf, uint32_t len, TickType_t ticks_to_wait);
@@ -109,5 +115,8 @@ int uart_driver_install(uart_port_e uart_num, fifo_type *uart_rx_fifo, UART_Hand
 rtk_ret_e uart_driver_delete(uart_port_e uart_num);
 int uart_write_bytes(uart_port_e uart_num, const char *src, size_t size, bool is_wait);
 void update_fifo_in(uart_port_e uart_num);
+uint32_t uart_tx_budget(uart_port_e uart_num, uint32_t period_ms);
+int uart_tx_stat(uart_port_e uart_num, uint32_t *backlog, uint32_t *drop_frame, uint32_t *drop_bytes);
 rtk_ret_e uart_sem_wait(uart_port_e uart_num, uint32_t millisec);
+int64_t uart_rx_time(uart_port_e uart_num);
 #endif
\ No newline at end of file
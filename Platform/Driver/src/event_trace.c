@@ -0,0 +1,273 @@
+/** ***************************************************************************
+ * @file   event_trace.c
+ * @brief  binary event trace, fixed size records in a RAM ring
+ *
+ * Writers take a slot with LDREX/STREX on the head index, so tasks and isrs
+ * of any priority write at the same time without masking interrupts. A slot
+ * carries the index it was written for, stored last: the one reader (the
+ * task of the sink) takes a record only when that index is the one it
+ * expects and still is after the copy, so a slot being written is waited
+ * for and one the writers have lapped is counted as lost. When the ring is
+ * full the oldest records go.
+ ******************************************************************************/
+#include <string.h>
+#include "stm32f4xx_hal.h"
+#include "crc.h"
+#include "time_service.h"
+#include "event_trace.h"
+
+#define EVENT_TRACE_MASK        (EVENT_TRACE_RECORDS - 1)
+
+typedef struct {
+    volatile uint32_t seq;      /* index + 1 once written, 0 while writing */
+    uint32_t time;              /* DWT cycle count */
+    uint16_t id;
+    uint8_t  ctx;               /* active exception, 0 thread mode */
+    uint8_t  nargs;
+    uint32_t arg[EVENT_TRACE_MAX_ARGS];
+} event_trace_slot_t;
+
+volatile uint32_t event_trace_on = 0;
+static volatile uint32_t head = 0;      /* next index to write */
+static uint32_t tail = 0;               /* next index to read */
+static event_trace_slot_t ring[EVENT_TRACE_RECORDS];
+static event_trace_sink_t sink = EVENT_TRACE_SINK_NONE;
+static event_trace_stat_t stat;
+
+
+static void _put16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void _put32(uint8_t *p, uint32_t v)
+{
+    _put16(p, (uint16_t)v);
+    _put16(p + 2, (uint16_t)(v >> 16));
+}
+
+static void _put64(uint8_t *p, uint64_t v)
+{
+    _put32(p, (uint32_t)v);
+    _put32(p + 4, (uint32_t)(v >> 32));
+}
+
+
+/** ***************************************************************************
+ * @name event_trace
+ * @brief write a record, callable from any task or isr. Use the EVENT_TRACEn
+ *        macros, they skip the call while tracing is off
+ * @param [in] id: event_trace_id_t
+ *             nargs: args used
+ *             a0..a3: args
+ * @retval N/A
+ ******************************************************************************/
+void event_trace(uint16_t id, uint8_t nargs, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3)
+{
+    event_trace_slot_t *s;
+    uint32_t idx;
+
+    if (!event_trace_on)
+    {
+        return;
+    }
+
+    do
+    {
+        idx = __LDREXW((volatile uint32_t *)&head);
+    } while (__STREXW(idx + 1, (volatile uint32_t *)&head));
+
+    s = &ring[idx & EVENT_TRACE_MASK];
+    s->seq = 0;
+    __DMB();
+    s->time = DWT->CYCCNT;
+    s->id = id;
+    s->ctx = (uint8_t)__get_IPSR();
+    s->nargs = nargs;
+    s->arg[0] = a0;
+    s->arg[1] = a1;
+    s->arg[2] = a2;
+    s->arg[3] = a3;
+    __DMB();
+    s->seq = idx + 1;
+}
+
+
+/** ***************************************************************************
+ * @name event_trace_start
+ * @brief drop what is in the ring and start tracing to a sink
+ * @param [in] to: link the frames go to
+ * @retval N/A
+ ******************************************************************************/
+void event_trace_start(event_trace_sink_t to)
+{
+    event_trace_on = 0;
+    __DMB();
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    tail = head;
+    memset(&stat, 0, sizeof(stat));
+    sink = to;
+    __DMB();
+    event_trace_on = (to != EVENT_TRACE_SINK_NONE);
+}
+
+
+/** ***************************************************************************
+ * @name event_trace_stop
+ * @brief stop tracing, records still in the ring are dropped
+ * @retval N/A
+ ******************************************************************************/
+void event_trace_stop(void)
+{
+    event_trace_on = 0;
+    sink = EVENT_TRACE_SINK_NONE;
+}
+
+
+/** ***************************************************************************
+ * @name event_trace_sink
+ * @brief link the frames go to
+ * @retval EVENT_TRACE_SINK_NONE while tracing is off
+ ******************************************************************************/
+event_trace_sink_t event_trace_sink(void)
+{
+    return sink;
+}
+
+
+/** ***************************************************************************
+ * @name event_trace_drain
+ * @brief move the oldest records into a frame, from the task of the sink only.
+ *        Frame, little endian: 'E' 'T' version nrec, lost u32 since the last
+ *        frame, time_count() u64 and its now_gps() i64 at the drain, counter
+ *        Hz u32, nrec records of time u32 id u16 ctx u8 nargs u8 arg u32[4],
+ *        CRC-16-CCITT of it all (seed CRC_CCITT_INITIAL_SEED) big endian
+ * @param [out] buf: frame
+ * @param [in] len: size of buf, EVENT_TRACE_FRAME_LEN(n) for up to n records
+ * @retval frame length, 0 nothing to send
+ ******************************************************************************/
+uint16_t event_trace_drain(uint8_t *buf, uint16_t len)
+{
+    event_trace_slot_t *s;
+    uint8_t *p = buf + EVENT_TRACE_HEADER_LEN;
+    uint32_t h = head;
+    uint32_t lost = 0;
+    uint32_t seq, max, n = 0;
+    uint64_t count;
+    uint16_t crc;
+    int i;
+
+    if (len < EVENT_TRACE_FRAME_LEN(1))
+    {
+        return 0;
+    }
+    max = (len - EVENT_TRACE_FRAME_LEN(0)) / EVENT_TRACE_RECORD_LEN;
+    if (max > 255)
+    {
+        max = 255;
+    }
+
+    if (h - tail > EVENT_TRACE_RECORDS)
+    {
+        lost = h - tail - EVENT_TRACE_RECORDS;
+        tail = h - EVENT_TRACE_RECORDS;
+    }
+
+    while (tail != h && n < max)
+    {
+        s = &ring[tail & EVENT_TRACE_MASK];
+        seq = s->seq;
+        __DMB();
+        if (seq != tail + 1)
+        {
+            if ((int32_t)(seq - (tail + 1)) > 0)
+            {
+                lost++;         /* lapped */
+                tail++;
+                continue;
+            }
+            break;              /* still being written */
+        }
+
+        _put32(p, s->time);
+        _put16(p + 4, s->id);
+        p[6] = s->ctx;
+        p[7] = s->nargs;
+        for (i = 0; i < EVENT_TRACE_MAX_ARGS; i++)
+        {
+            _put32(p + 8 + 4 * i, s->arg[i]);
+        }
+        __DMB();
+        if (s->seq != seq)
+        {
+            lost++;             /* overwritten during the copy */
+            tail++;
+            continue;
+        }
+        p += EVENT_TRACE_RECORD_LEN;
+        tail++;
+        n++;
+    }
+
+    if (n == 0 && lost == 0)
+    {
+        return 0;
+    }
+
+    count = time_count();
+    buf[0] = EVENT_TRACE_SYNC0;
+    buf[1] = EVENT_TRACE_SYNC1;
+    buf[2] = EVENT_TRACE_VERSION;
+    buf[3] = (uint8_t)n;
+    _put32(buf + 4, lost);
+    _put64(buf + 8, count);
+    _put64(buf + 16, (uint64_t)time_count_to_gps(count));
+    _put32(buf + 24, SystemCoreClock);
+    crc = CrcCcittUpdate(CRC_CCITT_INITIAL_SEED, buf, (uint32_t)(p - buf));
+    p[0] = (uint8_t)(crc >> 8);
+    p[1] = (uint8_t)crc;
+    p += 2;
+
+    stat.records += n;
+    stat.lost += lost;
+    stat.frames++;
+
+    return (uint16_t)(p - buf);
+}
+
+
+/** ***************************************************************************
+ * @name event_trace_command
+ * @brief "log trace on" / "log trace off" received on a link
+ * @param [in] cmd: received text
+ *             from: link it came in on, the sink when turned on
+ * @retval 1 handled, 0 not a trace command
+ ******************************************************************************/
+int event_trace_command(const char *cmd, event_trace_sink_t from)
+{
+    if (strstr(cmd, "log trace on\r\n") != NULL)
+    {
+        event_trace_start(from);
+        return 1;
+    }
+    if (strstr(cmd, "log trace off\r\n") != NULL)
+    {
+        event_trace_stop();
+        return 1;
+    }
+    return 0;
+}
+
+
+/** ***************************************************************************
+ * @name event_trace_stat
+ * @brief counters since the trace was turned on
+ * @param [out] out: copy of the counters
+ * @retval N/A
+ ******************************************************************************/
+void event_trace_stat(event_trace_stat_t *out)
+{
+    *out = stat;
+}
@@ -21,8 +21,10 @@
 #include "string.h"
 #include "app_version.h"
 #include "ins_interface_API.h"
+#include "time_service.h"
 
 volatile mcu_time_base_t g_obs_rcv_time;
+static volatile int64_t wheel_tick_time = 0;
 
 
 __weak uint8_t get_gnss_signal_flag()
@@ -55,6 +57,8 @@ extern uint32_t usCnt;
 extern TIM_HandleTypeDef htim_sensor;
 void ST_PPS_IRQ(void)
 {
+    uint64_t pps_count = time_count();
+
     OSEnterISR();   
     LED_PPS_TOOGLE();
 
@@ -78,8 +82,8 @@ void ST_PPS_IRQ(void)
             if(get_gnss_signal_flag() && (g_MCU_time.msec - g_obs_rcv_time.msec) >= 0 && (g_MCU_time.time == g_obs_rcv_time.time))
                 g_MCU_time.time = get_obs_time(); 
         }
-   
-    
+
+        time_service_pps(pps_count, (int64_t)g_MCU_time.time * 1000000 + TIME_PPS_PHASE_US);
     }
     HAL_GPIO_EXTI_IRQHandler(ST_PPS_PIN);
     OSExitISR();    
@@ -88,8 +92,14 @@ void ST_PPS_IRQ(void)
 
 void PLUSE_IRQ()
 {
+    wheel_tick_time = now_gps();
     add_wheel_tick_count();
     set_wheel_tick_fwd(HAL_GPIO_ReadPin(FWD_PORT,FWD_PIN));
     HAL_GPIO_EXTI_IRQHandler(PLUSE_PIN);
 }
 
+/* now_gps() of the last wheel tick, 0 before any */
+int64_t get_wheel_tick_time()
+{
+    return wheel_tick_time;
+}
@@ -0,0 +1,224 @@
+/** ***************************************************************************
+ * @file   output_sched.c
+ * @brief  output scheduler: one frame a tick, fanned out once to each sink
+ *
+ * Runs in the one task that calls SendContinuousPacket(), the streams and
+ * sinks are only touched from there, so there is no locking here; the sinks
+ * serialize against their other writers themselves.
+ ******************************************************************************/
+#include <string.h>
+#include "output_sched.h"
+
+void output_sched_init(output_sched_t *sched, uint32_t budget)
+{
+    memset(sched, 0, sizeof(*sched));
+    sched->budget = budget;
+    sched->frame.buf = sched->buf;
+}
+
+/* in priority order, after the streams of the same priority */
+int output_sched_add_stream(output_sched_t *sched, output_stream_t *stream)
+{
+    uint8_t i;
+
+    if (sched->nstream >= OUTPUT_SCHED_MAX_STREAMS || stream->fill == NULL)
+        return -1;
+    for (i = sched->nstream; i > 0 && sched->stream[i - 1]->priority > stream->priority; i--)
+        sched->stream[i] = sched->stream[i - 1];
+    sched->stream[i] = stream;
+    sched->nstream++;
+    return 0;
+}
+
+int output_sched_add_sink(output_sched_t *sched, output_sink_t *sink)
+{
+    if (sched->nsink >= OUTPUT_SCHED_MAX_SINKS || sink->send == NULL || sink->id > 7)
+        return -1;
+    sched->sink[sched->nsink++] = sink;
+    return 0;
+}
+
+/* the budget of this tick: the budget less the largest backlog of a paced sink */
+static uint32_t tick_budget(output_sched_t *sched)
+{
+    uint32_t budget = sched->budget ? sched->budget : OUTPUT_SCHED_FRAME_SIZE;
+    uint32_t backlog = 0, b;
+    uint8_t i;
+
+    for (i = 0; i < sched->nsink; i++)
+    {
+        output_sink_t *sink = sched->sink[i];
+
+        if (sink->backlog == NULL)
+            continue;
+        b = sink->backlog(sink);
+        sink->backlog_last = b;
+        if (b > sink->backlog_max)
+            sink->backlog_max = b;
+        if (b > backlog)
+            backlog = b;
+    }
+    return backlog < budget ? budget - backlog : 0;
+}
+
+static int stream_due(output_stream_t *st)
+{
+    int due = st->pending;
+
+    if (st->divider == 0)
+    {
+        st->pending = 0;
+        return 0;
+    }
+    if (st->count > 1)
+    {
+        st->count--;
+    }
+    else
+    {
+        st->count = st->divider;
+        due = 1;
+    }
+    return due;
+}
+
+static void fan_out(output_sched_t *sched)
+{
+    output_frame_t *frame = &sched->frame;
+    uint32_t routed, dropped;
+    uint8_t i, k;
+
+    for (i = 0; i < sched->nsink; i++)
+    {
+        output_sink_t *sink = sched->sink[i];
+
+        routed = 0;
+        for (k = 0; k < frame->nspan; k++)
+        {
+            if (frame->span[k].stream->sinks & OUTPUT_SINK(sink->id))
+                routed += frame->span[k].len;
+        }
+        if (routed == 0)
+            continue;
+        dropped = sink->send(sink, frame);
+        if (dropped > routed)
+            dropped = routed;
+        sink->frames++;
+        sink->bytes += routed - dropped;
+        if (dropped)
+        {
+            sink->drop_frame++;
+            sink->drop_bytes += dropped;
+        }
+    }
+}
+
+/* fill a due stream in after the frame so far, the first one in may go past
+   the budget, the rest have to fit */
+static void stream_fill(output_sched_t *sched, output_stream_t *st, uint32_t *left)
+{
+    output_frame_t *frame = &sched->frame;
+    uint16_t room;
+    int n;
+
+    room = OUTPUT_SCHED_FRAME_SIZE - frame->len;
+    if (frame->len != 0 && *left < room)
+        room = (uint16_t)*left;
+    if (*left == 0 || room == 0)
+    {
+        n = OUTPUT_FILL_LATER;
+    }
+    else
+    {
+        st->pending = 0;
+        n = st->fill(st, sched->buf + frame->len, room);
+    }
+    if (n == OUTPUT_FILL_LATER)
+    {
+        st->pending = 1;
+        st->deferred++;
+        if (st->waited < UINT16_MAX)
+            st->waited++;
+        return;
+    }
+    st->waited = 0;
+    if (n <= 0)
+        return;
+    if (n > room)
+        n = room;
+    frame->span[frame->nspan].stream = st;
+    frame->span[frame->nspan].off = frame->len;
+    frame->span[frame->nspan].len = (uint16_t)n;
+    frame->nspan++;
+    frame->len += (uint16_t)n;
+    st->sent++;
+    if ((uint32_t)n > *left)
+    {
+        sched->over_budget++;
+        *left = 0;
+    }
+    else
+    {
+        *left -= n;
+    }
+}
+
+/** ***************************************************************************
+ * @name output_sched_tick
+ * @brief build the frame of this tick from the due streams and hand it to
+ *        the sinks
+ * @param [in] sched: scheduler
+ * @retval frame length
+ ******************************************************************************/
+uint16_t output_sched_tick(output_sched_t *sched)
+{
+    output_frame_t *frame = &sched->frame;
+    uint32_t left = tick_budget(sched);
+    uint8_t due[OUTPUT_SCHED_MAX_STREAMS];
+    uint8_t i, first = OUTPUT_SCHED_MAX_STREAMS;
+
+    sched->ticks++;
+    frame->len = 0;
+    frame->nspan = 0;
+    /* the due stream that has waited longest goes first, by priority on a tie */
+    for (i = 0; i < sched->nstream; i++)
+    {
+        due[i] = (uint8_t)stream_due(sched->stream[i]);
+        if (due[i] && sched->stream[i]->waited &&
+            (first == OUTPUT_SCHED_MAX_STREAMS || sched->stream[i]->waited > sched->stream[first]->waited))
+            first = i;
+    }
+    if (first != OUTPUT_SCHED_MAX_STREAMS)
+        stream_fill(sched, sched->stream[first], &left);
+    for (i = 0; i < sched->nstream; i++)
+    {
+        if (due[i] && i != first)
+            stream_fill(sched, sched->stream[i], &left);
+    }
+    if (frame->len)
+        fan_out(sched);
+    return frame->len;
+}
+
+/** ***************************************************************************
+ * @name output_frame_run
+ * @brief next run of adjacent spans routed to a sink, for sinks that take a
+ *        byte stream; the frame is usually one run
+ * @param [in] frame: frame of the tick
+ * @param [in] id: sink id
+ * @param [in,out] i: span to start at, 0 for the first run
+ * @param [out] data: start of the run
+ * @retval run length, 0 when there are no more
+ ******************************************************************************/
+uint16_t output_frame_run(const output_frame_t *frame, uint8_t id, uint8_t *i, const uint8_t **data)
+{
+    uint16_t len = 0;
+
+    while (*i < frame->nspan && !(frame->span[*i].stream->sinks & OUTPUT_SINK(id)))
+        (*i)++;
+    if (*i < frame->nspan)
+        *data = frame->buf + frame->span[*i].off;
+    while (*i < frame->nspan && (frame->span[*i].stream->sinks & OUTPUT_SINK(id)))
+        len += frame->span[(*i)++].len;
+    return len;
+}
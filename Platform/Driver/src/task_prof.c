@@ -0,0 +1,218 @@
+/** ***************************************************************************
+ * @file   task_prof.c
+ * @brief  per task response time, jitter and cpu share of the task graph
+ *
+ * Times are taken from the DWT cycle counter. A job is released where its
+ * semaphore is given (or its wait returns) and done where the task goes back
+ * to waiting; the response time is the difference and the jitter is the
+ * spread of the release interval and of the response time.
+ *
+ * A release can come from an isr while the task marks the previous job done,
+ * so both update the record with interrupts masked up to
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY; the _FROM_ISR form nests and is
+ * valid in a task as well. An isr above that priority must not release.
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "stm32f4xx_hal.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_prof.h"
+
+#define TASK_PROF_NSTATUS   16          /* tasks listed by task_prof_cpu_share */
+
+static volatile task_prof_t task_prof[TASK_PROF_MAX];
+static uint32_t runtime_last = 0, runtime_hi = 0;
+
+
+/** ***************************************************************************
+ * @name task_prof_init
+ * @brief start the cycle counter and clear the records, the counter is not
+ *        reset as the time service runs on it too
+ * @retval N/A
+ ******************************************************************************/
+void task_prof_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    runtime_last = 0;
+    runtime_hi = 0;
+    task_prof_reset();
+}
+
+
+/** ***************************************************************************
+ * @name task_prof_reset
+ * @brief clear the records, e.g. after a configuration change
+ * @retval N/A
+ ******************************************************************************/
+void task_prof_reset(void)
+{
+    int i;
+
+    for (i = 0; i < TASK_PROF_MAX; i++)
+    {
+        memset((void *)&task_prof[i], 0, sizeof(task_prof_t));
+        task_prof[i].period_min = 0xFFFFFFFF;
+        task_prof[i].resp_min = 0xFFFFFFFF;
+    }
+}
+
+
+/** ***************************************************************************
+ * @name task_prof_counter
+ * @brief cycle count, differences are valid across the wrap
+ * @retval counts of task_prof_counter_hz()
+ ******************************************************************************/
+uint32_t task_prof_counter(void)
+{
+    return DWT->CYCCNT;
+}
+
+uint32_t task_prof_counter_hz(void)
+{
+    return SystemCoreClock;
+}
+
+
+/** ***************************************************************************
+ * @name task_prof_runtime
+ * @brief run time stats counter for portGET_RUN_TIME_COUNTER_VALUE, the cycle
+ *        count extended to 64 bits and divided by 256 so the 32 bit total of
+ *        the kernel lasts for hours. Called on every context switch, which
+ *        happens far more often than the cycle counter wraps.
+ * @retval counts of task_prof_counter_hz() / 256
+ ******************************************************************************/
+uint32_t task_prof_runtime(void)
+{
+    uint32_t cyc = DWT->CYCCNT;
+
+    if (cyc < runtime_last)
+    {
+        runtime_hi++;
+    }
+    runtime_last = cyc;
+
+    return (runtime_hi << 24) | (cyc >> 8);
+}
+
+
+/** ***************************************************************************
+ * @name task_prof_release
+ * @brief mark the release of a job, callable from isr at or below
+ *        configMAX_SYSCALL_INTERRUPT_PRIORITY
+ * @param [in] id: task
+ * @retval N/A
+ ******************************************************************************/
+void task_prof_release(task_prof_id_t id)
+{
+    volatile task_prof_t *p = &task_prof[id];
+    UBaseType_t mask;
+    uint32_t now, dt;
+
+    mask = taskENTER_CRITICAL_FROM_ISR();
+    now = DWT->CYCCNT;
+    if (p->release != 0)
+    {
+        dt = now - p->release;
+        if (dt < p->period_min) p->period_min = dt;
+        if (dt > p->period_max) p->period_max = dt;
+    }
+    if (p->pending)
+    {
+        p->nmiss++;     /* keep the first release, the job is late */
+    }
+    else
+    {
+        p->release = now;
+        p->pending = 1;
+    }
+    taskEXIT_CRITICAL_FROM_ISR(mask);
+}
+
+
+/** ***************************************************************************
+ * @name task_prof_done
+ * @brief mark the completion of the released job
+ * @param [in] id: task
+ * @retval N/A
+ ******************************************************************************/
+void task_prof_done(task_prof_id_t id)
+{
+    volatile task_prof_t *p = &task_prof[id];
+    UBaseType_t mask;
+    uint32_t dt;
+
+    mask = taskENTER_CRITICAL_FROM_ISR();
+    if (p->pending)
+    {
+        dt = DWT->CYCCNT - p->release;
+        if (dt < p->resp_min) p->resp_min = dt;
+        if (dt > p->resp_max) p->resp_max = dt;
+        p->resp_sum += dt;
+        p->n++;
+        p->pending = 0;
+    }
+    taskEXIT_CRITICAL_FROM_ISR(mask);
+}
+
+
+/** ***************************************************************************
+ * @name task_prof_get
+ * @brief copy the record of a task
+ * @param [in] id: task
+ * @param [out] prof: record
+ * @retval 1: record has completed jobs, 0: no jobs yet
+ ******************************************************************************/
+int task_prof_get(task_prof_id_t id, task_prof_t *prof)
+{
+    if (id >= TASK_PROF_MAX)
+    {
+        return 0;
+    }
+    taskENTER_CRITICAL();
+    memcpy(prof, (const void *)&task_prof[id], sizeof(task_prof_t));
+    taskEXIT_CRITICAL();
+
+    return prof->n > 0;
+}
+
+
+/** ***************************************************************************
+ * @name task_prof_cpu_share
+ * @brief format the cpu share of every task as "name permille" lines
+ * @param [out] buf: output
+ * @param [in] len: size of buf
+ * @retval number of characters written, 0 without run time stats
+ ******************************************************************************/
+int task_prof_cpu_share(char *buf, int len)
+{
+#if (configGENERATE_RUN_TIME_STATS == 1) && (configUSE_TRACE_FACILITY == 1)
+    static TaskStatus_t status[TASK_PROF_NSTATUS];
+    uint32_t total;
+    UBaseType_t i, n;
+    int pos = 0, ret;
+
+    n = uxTaskGetSystemState(status, TASK_PROF_NSTATUS, &total);
+    total /= 1000;
+    if (total == 0)
+    {
+        return 0;
+    }
+    for (i = 0; i < n && pos < len; i++)
+    {
+        ret = snprintf(buf + pos, len - pos, "%s %lu\r\n", status[i].pcTaskName,
+                       (unsigned long)(status[i].ulRunTimeCounter / total));
+        if (ret < 0 || ret >= len - pos)
+        {
+            break;
+        }
+        pos += ret;
+    }
+    return pos;
+#else
+    (void)buf;
+    (void)len;
+    return 0;
+#endif
+}
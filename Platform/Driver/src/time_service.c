@@ -0,0 +1,264 @@
+/** ***************************************************************************
+ * @file   time_service.c
+ * @brief  microsecond time stamps for all inputs, disciplined by the PPS
+ *
+ * time = us + (frac + (count - ref) * rate) / 2^32 with rate in us per count
+ * as Q32. At each PPS edge the model is moved to the edge where it stands
+ * and its rate set so that part of the error is gone by the next edge (the
+ * phase term) on top of the estimated counter frequency (the integral term).
+ * The model is read and written with interrupts masked, so now_gps() is a
+ * handful of instructions from any context; the loop's double arithmetic
+ * runs between those sections with interrupts on.
+ ******************************************************************************/
+#include <string.h>
+#include "stm32f4xx_hal.h"
+#include "timer.h"
+#include "time_service.h"
+
+#ifndef TIME_KP
+#define TIME_KP                 0.125       /* share of the phase error removed per edge */
+#endif
+#ifndef TIME_KI
+#define TIME_KI                 0.01        /* share of it taken into the frequency */
+#endif
+#define TIME_REBASE_COUNTS      0x80000000U /* keeps (count - ref) * rate in 64 bits */
+#define TIME_Q32                4294967296.0
+
+typedef struct {
+    uint64_t ref;               /* count at the reference */
+    int64_t  us;                /* time at the reference */
+    uint32_t frac;              /* and its fraction of a us, Q32 */
+    uint32_t rate;              /* us per count, Q32 */
+} time_model_t;
+
+static time_model_t model;
+static double rate_est;                 /* us per count, the frequency estimate */
+static double rate_nominal;
+static uint32_t count_last, count_hi;
+static uint64_t pps_count_last;
+static int64_t pps_ref_last;
+static time_service_stat_t stat;
+
+
+/* 64 bit count, with interrupts masked and called at least once a wrap */
+static uint64_t _time_count(void)
+{
+    uint32_t cnt = DWT->CYCCNT;
+
+    if (cnt < count_last)
+    {
+        count_hi++;
+    }
+    count_last = cnt;
+
+    return ((uint64_t)count_hi << 32) | cnt;
+}
+
+/* model time of count as whole us and Q32 fraction, the count may be a
+   little older than the reference */
+static int64_t _time_model(uint64_t count, uint32_t *frac)
+{
+    int64_t dt = (int64_t)(count - model.ref);
+    int64_t t = (int64_t)model.frac + dt * (int64_t)model.rate;
+
+    *frac = (uint32_t)t;
+    return model.us + (t >> 32);
+}
+
+static uint32_t _time_rate_q32(double rate)
+{
+    return (uint32_t)(rate * TIME_Q32 + 0.5);
+}
+
+
+/** ***************************************************************************
+ * @name time_service_init
+ * @brief start the cycle counter and run free at the nominal clock, from the
+ *        time of g_MCU_time, until the first PPS
+ * @retval N/A
+ ******************************************************************************/
+void time_service_init(void)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    __disable_irq();
+    count_last = DWT->CYCCNT;
+    count_hi = 0;
+    rate_nominal = 1000000.0 / SystemCoreClock;
+    rate_est = rate_nominal;
+    model.ref = _time_count();
+    model.us = (int64_t)g_MCU_time.time * 1000000 + (int64_t)g_MCU_time.msec * 1000;
+    model.frac = 0;
+    model.rate = _time_rate_q32(rate_est);
+    pps_ref_last = 0;
+    pps_count_last = 0;
+    memset(&stat, 0, sizeof(stat));
+    __set_PRIMASK(primask);
+}
+
+
+/** ***************************************************************************
+ * @name time_service_tick
+ * @brief from the 1 ms timer isr, keeps the count extension and the model
+ *        reference fresh while there is no PPS
+ * @retval N/A
+ ******************************************************************************/
+void time_service_tick(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint64_t count;
+    uint32_t frac;
+
+    __disable_irq();
+    count = _time_count();
+    if (count - model.ref > TIME_REBASE_COUNTS)
+    {
+        model.us = _time_model(count, &frac);
+        model.frac = frac;
+        model.ref = count;
+    }
+    __set_PRIMASK(primask);
+}
+
+
+/** ***************************************************************************
+ * @name time_service_pps
+ * @brief discipline the clock with a PPS edge
+ * @param [in] count: time_count() taken first thing in the edge isr
+ *             ref_us: time of the edge
+ * @retval N/A
+ ******************************************************************************/
+void time_service_pps(uint64_t count, int64_t ref_us)
+{
+    uint32_t primask = __get_PRIMASK();
+    int64_t interval = ref_us - pps_ref_last;
+    time_service_stat_t st = stat;  /* only written here and in init */
+    int64_t us;
+    uint32_t frac, rate;
+    double err;
+
+    /* the clock at the edge. time_service_tick() may move the reference
+       before the new model goes in, but only along the same line, so the
+       edge's time stays what it is here */
+    __disable_irq();
+    us = _time_model(count, &frac);
+    __set_PRIMASK(primask);
+
+    err = (double)(ref_us - us) - frac / TIME_Q32;
+
+    if (st.locked < 2 || err > TIME_STEP_US || err < -TIME_STEP_US ||
+        interval <= 0 || interval > TIME_PPS_MAX_GAP_US)
+    {
+        /* set the phase, and with two edges in a row the frequency too */
+        st.locked = 1;
+        if (interval > 0 && interval <= TIME_PPS_MAX_GAP_US && pps_count_last != 0)
+        {
+            rate_est = (double)interval / (double)(count - pps_count_last);
+            st.locked = 2;
+        }
+        us = ref_us;
+        frac = 0;
+        rate = _time_rate_q32(rate_est);
+        st.steps++;
+    }
+    else
+    {
+        if (err > TIME_PPS_CLAMP_US || err < -TIME_PPS_CLAMP_US)
+        {
+            err = err > 0 ? TIME_PPS_CLAMP_US : -TIME_PPS_CLAMP_US;
+            st.clamped++;
+        }
+        rate_est *= 1.0 + TIME_KI * err / interval;
+        rate = _time_rate_q32(rate_est * (1.0 + TIME_KP * err / interval));
+    }
+
+    pps_count_last = count;
+    pps_ref_last = ref_us;
+    st.pps++;
+    st.err_ns = (int32_t)(err * 1000.0);
+    st.freq_ppb = (int32_t)((rate_nominal / rate_est - 1.0) * 1e9);
+
+    __disable_irq();
+    model.ref = count;
+    model.us = us;
+    model.frac = frac;
+    model.rate = rate;
+    stat = st;
+    __set_PRIMASK(primask);
+}
+
+
+/** ***************************************************************************
+ * @name time_count
+ * @brief the free running count, to stamp an event first and convert later
+ * @retval counts of SystemCoreClock
+ ******************************************************************************/
+uint64_t time_count(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint64_t count;
+
+    __disable_irq();
+    count = _time_count();
+    __set_PRIMASK(primask);
+
+    return count;
+}
+
+
+/** ***************************************************************************
+ * @name time_count_to_gps
+ * @brief time of a count taken with time_count() in the last seconds
+ * @param [in] count: time_count() value
+ * @retval us
+ ******************************************************************************/
+int64_t time_count_to_gps(uint64_t count)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t frac;
+    int64_t us;
+
+    __disable_irq();
+    us = _time_model(count, &frac);
+    __set_PRIMASK(primask);
+
+    return us;
+}
+
+
+/** ***************************************************************************
+ * @name now_gps
+ * @brief current time, callable from isr
+ * @retval us, in the time base of g_MCU_time
+ ******************************************************************************/
+int64_t now_gps(void)
+{
+    uint32_t primask = __get_PRIMASK();
+    uint32_t frac;
+    int64_t us;
+
+    __disable_irq();
+    us = _time_model(_time_count(), &frac);
+    __set_PRIMASK(primask);
+
+    return us;
+}
+
+
+/** ***************************************************************************
+ * @name time_service_stat
+ * @brief lock state and last PPS error
+ * @param [out] stat: copy of the counters
+ * @retval N/A
+ ******************************************************************************/
+void time_service_stat(time_service_stat_t *out)
+{
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    *out = stat;
+    __set_PRIMASK(primask);
+}
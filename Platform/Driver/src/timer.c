@@ -22,6 +22,9 @@
 #include "main.h"
 #include "user_config.h"
 #include "app_version.h"
+#include "task_prof.h"
+#include "time_service.h"
+#include "event_trace.h"
 
 #define SENSOR_TIMER_IRQ                       TIM2_IRQHandler
 
@@ -92,6 +95,7 @@ void MX_TIM_SENSOR_Init(void)
         Error_Handler();
     }
     /* USER CODE BEGIN TIM2_Init 2 */
+        time_service_init();
         HAL_TIM_Base_Start_IT(&htim_sensor); //start tim2
     /* USER CODE END TIM2_Init 2 */
         HAL_TIM_IRQHandler(&htim_sensor);
@@ -115,12 +119,30 @@ volatile mcu_time_base_t* get_mcu_time()
 {
     return &g_MCU_time;
 }
+static volatile int64_t imu_sample_time = 0;
+
+/* the sensors are sampled when the acquisition task is released */
+static void imu_release(void)
+{
+    imu_sample_time = now_gps();
+    TASK_PROF_RELEASE(TASK_PROF_IMU);
+    EVENT_TRACE1(EVENT_INS_IMU_RELEASE, imu_sample_time);
+    release_sem(g_sem_imu_data_acq);
+}
+
+/* now_gps() of the last release of the acquisition task, 0 before any */
+int64_t get_imu_sample_time()
+{
+    return imu_sample_time;
+}
+
 volatile uint32_t usCnt = 0;
 static void timer_isr_if(TIM_HandleTypeDef* timer)
 {
     if(timer == &htim_sensor)
     {
         usCnt ++;
+        time_service_tick();
         {
             g_MCU_time.msec += 1;
             if(g_MCU_time.msec >= 1000)
@@ -131,7 +153,7 @@ static void timer_isr_if(TIM_HandleTypeDef* timer)
 #ifdef INS_APP
             if(g_MCU_time.msec % 10 == 0) // 100Hz
             {
-                release_sem(g_sem_imu_data_acq);
+                imu_release();
             } 
 #else
             switch (get_user_packet_rate())
@@ -139,25 +161,26 @@ static void timer_isr_if(TIM_HandleTypeDef* timer)
             case 200:
                 if(g_MCU_time.msec % 5 == 0) // 200Hz
                 {
-                    release_sem(g_sem_imu_data_acq);
+                    imu_release();
                 }
                 break;
             case 100:
                 if(g_MCU_time.msec % 10 == 0) // 100Hz
                 {
-                    release_sem(g_sem_imu_data_acq);
+                    imu_release();
                 } 
                 break;            
             default:
                 if(g_MCU_time.msec % 20 == 0) // 50Hz
                 {
-                    release_sem(g_sem_imu_data_acq);
+                    imu_release();
                 } 
                 break;             
             }
 #endif
-            if (gOdoConfigurationStruct.can_mode == 1) {
+            if (gOdoConfigurationStruct.can_mode == 0 || gOdoConfigurationStruct.can_mode == 1) {
                 if(g_MCU_time.msec % 10 == 0) { // 100Hz
+                    TASK_PROF_RELEASE(TASK_PROF_CAN);
                     release_sem(g_sem_can_data);
                 }
             }
@@ -174,26 +197,40 @@ void SENSOR_TIMER_IRQ(void)
     OSExitISR();
 }
 
+/* utc time of day as hhmmss.sss of the mcu time ------------------------------
+* utc_tod() keeps the utc second of day, leap seconds applied, and redoes it
+* only when the second or the leap seconds change; the calls in between add
+* the ms. the cache is shared by the rtcm and the output tasks, it is read and
+* written with interrupts masked, the conversion itself runs with them on
+*-----------------------------------------------------------------------------*/
+static utctod_t gnss_time_cache = { -1, 0, 0.0, 0.0, 0 };
+
 double get_gnss_time()
 {
-    gtime_t time;
-    int week;
-    double ep[6];
-    time.time = g_MCU_time.time;
-    time.sec = (double)g_MCU_time.msec/1000;
-    double timeOfWeek = 0;
-    timeOfWeek = time2gpst(time,&week); 
-    if (timeOfWeek < 0){
-        week = 0;
-        timeOfWeek = g_MCU_time.time + (double)g_MCU_time.msec/1000;
-    } 
-
-    gtime_t gpstime = gpst2time(week, timeOfWeek);
-    gtime_t utctime = gpst2utc(gpstime);
-    time2epoch(utctime, ep);
-    double gga_time = ep[3] * 10000 + ep[4] * 100 + ep[5] + 0.001;
-    return gga_time;
+    utctod_t c;
+    time_t sec;
+    time_t msec;
+    time_t cached_sec;
+    int cached_leaps;
+    double tod;
+    uint32_t primask;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    sec = g_MCU_time.time;
+    msec = g_MCU_time.msec;
+    c = gnss_time_cache;
+    __set_PRIMASK(primask);
+
+    cached_sec = c.sec;
+    cached_leaps = c.leaps;
+    tod = utc_tod(&c, sec, msec);
+    if (c.sec != cached_sec || c.leaps != cached_leaps)
+    {
+        primask = __get_PRIMASK();
+        __disable_irq();
+        gnss_time_cache = c;
+        __set_PRIMASK(primask);
+    }
+    return tod;
 }
-
-
-
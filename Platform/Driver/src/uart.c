@@ -22,6 +22,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <string.h>
 #include <time.h>
 #include "stm32f4xx_hal.h"
 #include "uart.h"
@@ -30,6 +31,7 @@
 #include "boardDefinition.h"
 #include "FreeRTOS.h"
 #include "osapi.h"
+#include "time_service.h"
 
 
 // osSemaphoreDef(RX_ACQ_SEM);
@@ -40,6 +42,10 @@ static uint8_t uart_user_buff[IMU_BUFF_SIZE];
 static uint8_t uart_bt_buff[GPS_BUFF_SIZE];
 static uint8_t uart_gps_buff[GPS_BUFF_SIZE];
 static uint8_t uart_debug_buff[GPS_BUFF_SIZE];
+FIFO_SIZE_CHECK(IMU_BUFF_SIZE);
+FIFO_SIZE_CHECK(GPS_BUFF_SIZE);
+FIFO_SIZE_CHECK(DMA_TX_FIFO_BUF_SIZE);
+FIFO_SIZE_CHECK(DEBUG_DMA_TX_FIFO_BUF_SIZE);
 
 
 DMA_HandleTypeDef hdma_usart_user_rx;
@@ -128,10 +134,6 @@ static int uart_dma_enanle_it(uart_port_e uart_num,uint32_t it_type)
 
 int uart_read_bytes(uart_port_e uart_num, uint8_t* buf, uint32_t len, TickType_t ticks_to_wait)
 {
-	uint16_t lenght;
-	uint16_t in = p_uart_obj[uart_num]->uart_rx_fifo->in;
-	uint16_t i;
-
 #ifdef UART_BLOCK    
     if(ticks_to_wait > 0)
     {
@@ -142,73 +144,185 @@ int uart_read_bytes(uart_port_e uart_num, uint8_t* buf, uint32_t len, TickType_t
         }
     }
 #endif
-	lenght = (in + p_uart_obj[uart_num]->uart_rx_fifo->size - p_uart_obj[uart_num]->uart_rx_fifo->out)%p_uart_obj[uart_num]->uart_rx_fifo->size;
-	if(lenght > len)
-		lenght = len;
-	for(i = 0; i < lenght; i++)     //TODO: memcpy?
-	{
-		buf[i] = p_uart_obj[uart_num]->uart_rx_fifo->buffer[(p_uart_obj[uart_num]->uart_rx_fifo->out + i)%p_uart_obj[uart_num]->uart_rx_fifo->size];
-	}
-	p_uart_obj[uart_num]->uart_rx_fifo->out = (p_uart_obj[uart_num]->uart_rx_fifo->out + lenght)%p_uart_obj[uart_num]->uart_rx_fifo->size;
-    //printf("len = %d\n",lenght);
-    return lenght;
-
+    if(len > 0xFFFF)
+        len = 0xFFFF;
+    return fifo_get(p_uart_obj[uart_num]->uart_rx_fifo, buf, (uint16_t)len);
 }
 
-static uint8_t data_to_write[DMA_TX_FIFO_BUF_SIZE];
-static uint8_t data_to_debug[DEBUG_DMA_TX_FIFO_BUF_SIZE];
-int uart_write_bytes(uart_port_e uart_num, const char* src, size_t size, bool is_wait)	//TODO:
+#if defined(USER_UART_DMA_FIFO) || defined(DEBUG_UART_DMA_FIFO)
+static uart_tx_dma_fifo_s *uart_tx_fifo(uart_port_e uart_num)
 {
 #ifdef USER_UART_DMA_FIFO
     if(uart_num == UART_USER)
+        return &user_uart_dma_tx_fifo;
+#endif
+#ifdef DEBUG_UART_DMA_FIFO
+    if(uart_num == UART_DEBUG)
+        return &debug_uart_dma_tx_fifo;
+#endif
+    return NULL;
+}
+
+/* start the dma on the contiguous span at the fifo tail, straight from the fifo
+   buffer; the span stays in the fifo until the dma is done with it.
+   called with interrupts masked or from the tx dma isr */
+static void uart_tx_dma_kick(uart_port_e uart_num, uart_tx_dma_fifo_s *tx)
+{
+    uint8_t *data;
+    uint16_t len;
+
+    if(tx->dma_len != 0 || p_uart_obj[uart_num]->huart->gState != HAL_UART_STATE_READY)
+        return;
+    len = fifo_peek(&tx->uart_tx_fifo, &data);
+    if(len == 0)
+        return;
+    tx->dma_len = len;
+    tx->is_dma_busy = 1;
+    if(HAL_UART_Transmit_DMA(p_uart_obj[uart_num]->huart, data, len) != HAL_OK)
     {
-        fifo_push(&user_uart_dma_tx_fifo.uart_tx_fifo,(uint8_t*)src,size);
-        user_uart_dma_tx_fifo.frame_num+= 1;
-        user_uart_dma_tx_fifo.data_total_num+= size;
-        if(user_uart_dma_tx_fifo.data_total_num > DMA_TX_FIFO_BUF_SIZE)
-        {
-        }
-        if(p_uart_obj[UART_USER]->huart->gState == HAL_UART_STATE_READY)
-        {
-            int data_len = fifo_get(&user_uart_dma_tx_fifo.uart_tx_fifo,data_to_write,DMA_TX_FIFO_BUF_SIZE);
-            user_uart_dma_tx_fifo.frame_num = 0;
-            user_uart_dma_tx_fifo.data_total_num = 0;
-            HAL_UART_Transmit_DMA(p_uart_obj[UART_USER]->huart, data_to_write, data_len);
-        }
-        return RTK_OK;
+        tx->dma_len = 0;
+        tx->is_dma_busy = 0;
     }
-#ifdef DEBUG_UART_DMA_FIFO
-    else if(uart_num == UART_DEBUG)
+}
+
+/* dma done: release the sent span and chain the data written meanwhile */
+static void uart_tx_dma_done(uart_port_e uart_num)
+{
+    uart_tx_dma_fifo_s *tx = uart_tx_fifo(uart_num);
+
+    if(tx == NULL || tx->dma_len == 0)
+        return;
+    fifo_commit(&tx->uart_tx_fifo, tx->dma_len);
+    tx->dma_len = 0;
+    tx->is_dma_busy = 0;
+    uart_tx_dma_kick(uart_num, tx);
+}
+#endif
+
+#if defined(USER_UART_DMA_FIFO) || defined(DEBUG_UART_DMA_FIFO)
+/* claim a span of size bytes behind the spans already claimed, under the mask.
+   0: no room yet */
+static int uart_tx_claim(uart_tx_dma_fifo_s *tx, uint16_t size, uint16_t *start)
+{
+    fifo_type *fifo = &tx->uart_tx_fifo;
+    uint32_t primask = __get_PRIMASK();
+    int ok = 0;
+
+    __disable_irq();
+    if(size <= ((uint16_t)(fifo->out - tx->head - 1) & (fifo->size - 1)))
     {
-        fifo_push(&debug_uart_dma_tx_fifo.uart_tx_fifo,(uint8_t*)src,size);
-        debug_uart_dma_tx_fifo.frame_num+= 1;
-        debug_uart_dma_tx_fifo.data_total_num+= size;
-        if(debug_uart_dma_tx_fifo.data_total_num > DEBUG_DMA_TX_FIFO_BUF_SIZE)
-        {
-        }
-        if(p_uart_obj[UART_DEBUG]->huart->gState == HAL_UART_STATE_READY)
+        *start = tx->head;
+        tx->head = (tx->head + size) & (fifo->size - 1);
+        tx->writers++;
+        ok = 1;
+    }
+    __set_PRIMASK(primask);
+    return ok;
+}
+
+/* the last writer done publishes every claimed span, so the dma never sees a
+   span that is still being copied and the frames go out in claim order */
+static void uart_tx_release(uart_port_e uart_num, uart_tx_dma_fifo_s *tx, uint16_t size)
+{
+    fifo_type *fifo = &tx->uart_tx_fifo;
+    uint32_t primask = __get_PRIMASK();
+
+    __disable_irq();
+    tx->frame_num += 1;
+    tx->data_total_num += size;
+    if(--tx->writers == 0)
+    {
+        fifo_publish(fifo, (tx->head - fifo->in) & (fifo->size - 1));
+        uart_tx_dma_kick(uart_num, tx);
+    }
+    __set_PRIMASK(primask);
+}
+#endif
+
+/* a frame goes in whole or not at all, a cut frame is worse than a lost one.
+   with is_wait a frame that does not fit waits for the dma to make room, at
+   most the time the port takes to send the whole fifo, before it is dropped.
+   RTK_OK or UART_TX_DROP */
+int uart_write_bytes(uart_port_e uart_num, const char* src, size_t size, bool is_wait)
+{
+#if defined(USER_UART_DMA_FIFO) || defined(DEBUG_UART_DMA_FIFO)
+    uart_tx_dma_fifo_s *tx = uart_tx_fifo(uart_num);
+    uint32_t primask, waited = 0, wait_max;
+    uint16_t start, first;
+
+    if(tx != NULL)
+    {
+        /* several tasks write to a port: the span is claimed and published
+           with interrupts masked, the copy runs with them on */
+        wait_max = is_wait ? (uint32_t)tx->uart_tx_fifo.size * 10000 / p_uart_obj[uart_num]->baudrate + 1 : 0;
+        while(size < tx->uart_tx_fifo.size)
         {
-            int data_len = fifo_get(&debug_uart_dma_tx_fifo.uart_tx_fifo,data_to_debug,DEBUG_DMA_TX_FIFO_BUF_SIZE);
-            debug_uart_dma_tx_fifo.frame_num = 0;
-            debug_uart_dma_tx_fifo.data_total_num = 0;
-            HAL_UART_Transmit_DMA(p_uart_obj[UART_DEBUG]->huart, data_to_debug, data_len);
+            if(uart_tx_claim(tx, (uint16_t)size, &start))
+            {
+                first = tx->uart_tx_fifo.size - start;
+                if(first > size)
+                    first = (uint16_t)size;
+                memcpy(tx->uart_tx_fifo.buffer + start, src, first);
+                memcpy(tx->uart_tx_fifo.buffer, src + first, size - first);
+                uart_tx_release(uart_num, tx, (uint16_t)size);
+                return RTK_OK;
+            }
+            if(waited++ >= wait_max)
+                break;
+            osDelay(1);
         }
-        return RTK_OK;
+        primask = __get_PRIMASK();
+        __disable_irq();
+        tx->drop_frame++;
+        tx->drop_bytes += size;
+        __set_PRIMASK(primask);
+        return UART_TX_DROP;
     }
     else
-#endif
 #endif
     {
         while(HAL_UART_Transmit_DMA(p_uart_obj[uart_num]->huart, (uint8_t *)src, size) == HAL_BUSY)
         {
             if(is_wait == 0)
-                return 0;
+                return UART_TX_DROP;
             osDelay(1);
         }
     }
     return RTK_OK;
 }
 
+/* bytes the port can send in period_ms (8N1, 10 bits a byte) */
+uint32_t uart_tx_budget(uart_port_e uart_num, uint32_t period_ms)
+{
+    if(p_uart_obj[uart_num] == NULL)
+        return 0;
+    return (uint32_t)p_uart_obj[uart_num]->baudrate / 10 * period_ms / 1000;
+}
+
+/* now_gps() of the last byte of the last rx burst, 0 before any */
+int64_t uart_rx_time(uart_port_e uart_num)
+{
+    if(p_uart_obj[uart_num] == NULL)
+        return 0;
+    return p_uart_obj[uart_num]->rx_time;
+}
+
+/* tx counters of a port, 0 if it has no tx fifo */
+int uart_tx_stat(uart_port_e uart_num, uint32_t *backlog, uint32_t *drop_frame, uint32_t *drop_bytes)
+{
+#if defined(USER_UART_DMA_FIFO) || defined(DEBUG_UART_DMA_FIFO)
+    uart_tx_dma_fifo_s *tx = uart_tx_fifo(uart_num);
+
+    if(tx != NULL)
+    {
+        if(backlog) *backlog = fifo_status(&tx->uart_tx_fifo);
+        if(drop_frame) *drop_frame = tx->drop_frame;
+        if(drop_bytes) *drop_bytes = tx->drop_bytes;
+        return 1;
+    }
+#endif
+    return 0;
+}
 
 int uart_driver_install(uart_port_e uart_num, fifo_type* uart_rx_fifo,UART_HandleTypeDef* huart,int baudrate)
 {
@@ -232,7 +346,9 @@ int uart_driver_install(uart_port_e uart_num, fifo_type* uart_rx_fifo,UART_Handl
 
 		//uint8_t* uart_x_buff = (uint8_t*)malloc(sizeof(uint8_t) * uart_config[uart_num].rec_buff_size);
 		
-        fifo_init(uart_rx_fifo, uart_config[uart_num].rec_buff, uart_config[uart_num].rec_buff_size);       
+        if (fifo_init(uart_rx_fifo, uart_config[uart_num].rec_buff, uart_config[uart_num].rec_buff_size) != 0) {
+            return RTK_FAIL;
+        }
         p_uart_obj[uart_num]->uart_rx_fifo = uart_rx_fifo;     
 		p_uart_obj[uart_num]->huart = huart;
 
@@ -281,6 +397,11 @@ int uart_driver_install(uart_port_e uart_num, fifo_type* uart_rx_fifo,UART_Handl
         user_uart_dma_tx_fifo.is_dma_busy = 0;
         user_uart_dma_tx_fifo.frame_num = 0;
         user_uart_dma_tx_fifo.is_data_available = 0;
+        user_uart_dma_tx_fifo.dma_len = 0;
+        user_uart_dma_tx_fifo.drop_frame = 0;
+        user_uart_dma_tx_fifo.drop_bytes = 0;
+        user_uart_dma_tx_fifo.head = 0;
+        user_uart_dma_tx_fifo.writers = 0;
         fifo_init(&user_uart_dma_tx_fifo.uart_tx_fifo, user_uart_dma_tx_buff, DMA_TX_FIFO_BUF_SIZE); 
     }
 #endif
@@ -291,6 +412,11 @@ int uart_driver_install(uart_port_e uart_num, fifo_type* uart_rx_fifo,UART_Handl
         debug_uart_dma_tx_fifo.is_dma_busy = 0;
         debug_uart_dma_tx_fifo.frame_num = 0;
         debug_uart_dma_tx_fifo.is_data_available = 0;
+        debug_uart_dma_tx_fifo.dma_len = 0;
+        debug_uart_dma_tx_fifo.drop_frame = 0;
+        debug_uart_dma_tx_fifo.drop_bytes = 0;
+        debug_uart_dma_tx_fifo.head = 0;
+        debug_uart_dma_tx_fifo.writers = 0;
         fifo_init(&debug_uart_dma_tx_fifo.uart_tx_fifo, debug_uart_dma_tx_buff, DEBUG_DMA_TX_FIFO_BUF_SIZE); 
     }
 #endif
@@ -302,9 +428,17 @@ rtk_ret_e uart_driver_delete(uart_port_e uart_num)
 	return RTK_OK;
 }
 
+/* the rx dma runs circular over the fifo buffer, its counter is the producer index */
+static void uart_rx_fifo_update(uart_obj_t *obj)
+{
+    fifo_type *fifo = obj->uart_rx_fifo;
+
+    fifo->in = (fifo->size - __HAL_DMA_GET_COUNTER(obj->hdma_usart_rx)) & (fifo->size - 1);
+}
+
 void update_fifo_in(uart_port_e uart_num)
 {
-    p_uart_obj[uart_num]->uart_rx_fifo->in = p_uart_obj[uart_num]->uart_rx_fifo->size - __HAL_DMA_GET_COUNTER(p_uart_obj[uart_num]->hdma_usart_rx);
+    uart_rx_fifo_update(p_uart_obj[uart_num]);
 }
 
 
@@ -313,9 +447,11 @@ static void uart_isr_if(uart_port_e uart_num)
     if (RESET != __HAL_UART_GET_FLAG(p_uart_obj[uart_num]->huart, UART_FLAG_IDLE))
     {
         __HAL_UART_CLEAR_IDLEFLAG(p_uart_obj[uart_num]->huart);
+        /* the line has been idle for a character since the last stop bit */
+        p_uart_obj[uart_num]->rx_time = now_gps() - 10000000 / p_uart_obj[uart_num]->baudrate;
         if(uart_num != UART_GPS)
         {
-            p_uart_obj[uart_num]->uart_rx_fifo->in = p_uart_obj[uart_num]->uart_rx_fifo->size - __HAL_DMA_GET_COUNTER(p_uart_obj[uart_num]->hdma_usart_rx);
+            uart_rx_fifo_update(p_uart_obj[uart_num]);
         }
     }
     if (RESET != __HAL_UART_GET_FLAG(p_uart_obj[uart_num]->huart, UART_FLAG_FE))
@@ -388,11 +524,20 @@ void GPS_USART_IRQ(void)
 
 static void uart_dma_tx_isr_if(uart_port_e uart_num)
 {
+    int done = 0;
+
 	if(__HAL_DMA_GET_COUNTER(p_uart_obj[uart_num]->hdma_usart_tx) == 0)
     {
         p_uart_obj[uart_num]->huart->gState = HAL_UART_STATE_READY;
+        done = 1;
     }
     HAL_DMA_IRQHandler(p_uart_obj[uart_num]->hdma_usart_tx);
+#if defined(USER_UART_DMA_FIFO) || defined(DEBUG_UART_DMA_FIFO)
+    if(done)
+    {
+        uart_tx_dma_done(uart_num);
+    }
+#endif
 }
 
 void USER_USART_DMA_TX_IRQHandler(void)
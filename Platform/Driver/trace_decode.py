@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+"""
+Decode an event trace capture into a timeline.
+
+    python3 trace_decode.py capture.bin [--elf app.elf] [--chrome trace.json]
+
+The capture is whatever came out of the debug uart or the driver data link
+after "log trace on": frames of src/event_trace.c, possibly mixed with other
+output, are found by their sync bytes and CRC. Each frame carries the cycle
+count and the PPS disciplined time of its drain, so the 32 bit cycle stamps
+of its records become us in the time base of now_gps().
+
+ - the text timeline goes to stdout: time, delta, context (thread or isr
+   number), event and args
+ - --chrome writes the Trace Event Format for chrome://tracing or Perfetto,
+   one lane per event group, BEGIN/END pairs as spans
+ - --elf resolves the formats of trace() log records, %s args and the
+   formats are read from the loaded sections of the image
+
+Event names come from include/event_trace.h, so a new id needs no change
+here.
+"""
+
+import argparse
+import json
+import os
+import re
+import struct
+import sys
+
+SYNC = b"ET"
+VERSION = 1
+HEADER = struct.Struct("<2sBBIQqI")
+RECORD = struct.Struct("<IHBB4I")
+EVENT_LOG = 0x0000
+GROUPS = {0: "log", 1: "rtcm", 2: "ins", 3: "output", 4: "can", 5: "net"}
+
+
+def crc_ccitt(data, crc=0x1D0F):
+    """CRC-16-CCITT, CrcCcittUpdate() with CRC_CCITT_INITIAL_SEED"""
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+def read_names(header):
+    names = {}
+    with open(header) as f:
+        for m in re.finditer(r"\b(EVENT_\w+)\s*=\s*(0x[0-9a-fA-F]+|\d+)", f.read()):
+            names[int(m.group(2), 0)] = m.group(1)[len("EVENT_"):]
+    return names
+
+
+class Elf(object):
+    """just enough of ELF32 to read strings at run time addresses"""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF" or self.data[4] != 1:
+            raise ValueError("%s: not an ELF32 file" % path)
+        shoff, = struct.unpack_from("<I", self.data, 32)
+        shentsize, shnum = struct.unpack_from("<HH", self.data, 46)
+        self.sections = []
+        for i in range(shnum):
+            (_, sh_type, flags, addr, offset, size) = struct.unpack_from(
+                "<IIIIII", self.data, shoff + i * shentsize)
+            if flags & 2 and sh_type != 8 and size:     # SHF_ALLOC, not NOBITS
+                self.sections.append((addr, offset, size))
+
+    def string(self, addr):
+        for base, offset, size in self.sections:
+            if base <= addr < base + size:
+                start = offset + addr - base
+                end = self.data.find(b"\0", start, offset + size)
+                return self.data[start:end].decode("latin-1")
+        return None
+
+
+CONVERSION = re.compile(r"%([-+ #0-9.]*)[hlLjzt]*([a-zA-Z%])")
+
+
+def format_log(fmt, args, elf):
+    """printf as trace() recorded it: floats as float, %s as a pointer"""
+    values = list(args)
+
+    def conv(m):
+        flags, c = m.group(1), m.group(2)
+        if c == "%":
+            return "%"
+        if not values:
+            return "?"
+        v = values.pop(0)
+        if c in "eEfFgG":
+            return ("%" + flags + c) % struct.unpack("<f", struct.pack("<I", v))[0]
+        if c == "s":
+            s = elf.string(v) if elf else None
+            return ("%" + flags + "s") % (s if s is not None else "<0x%08x>" % v)
+        if c in "di":
+            return ("%" + flags + "d") % (v - (1 << 32) if v & 0x80000000 else v)
+        if c == "c":
+            return ("%" + flags + "c") % chr(v & 0xFF)
+        if c in "uxXo":
+            return ("%" + flags + c) % v
+        return "0x%08x" % v
+
+    return CONVERSION.sub(conv, fmt)
+
+
+def frames(data):
+    """offset and record count of the frames that pass the CRC"""
+    pos = 0
+    while True:
+        i = data.find(SYNC, pos)
+        if i < 0 or i + HEADER.size + 2 > len(data):
+            return
+        if data[i + 2] != VERSION:
+            pos = i + 1
+            continue
+        n = data[i + 3]
+        end = i + HEADER.size + n * RECORD.size
+        if end + 2 > len(data) or \
+                crc_ccitt(data[i:end]) != struct.unpack_from(">H", data, end)[0]:
+            pos = i + 1
+            continue
+        yield i, n
+        pos = end + 2
+
+
+def decode(data):
+    """records in order as dicts, lost records as gaps"""
+    for i, n in frames(data):
+        _, _, _, lost, count, gps, hz = HEADER.unpack_from(data, i)
+        if lost:
+            yield {"lost": lost}
+        for k in range(n):
+            t, eid, ctx, nargs, a0, a1, a2, a3 = RECORD.unpack_from(
+                data, i + HEADER.size + k * RECORD.size)
+            # records are older than the drain, by less than a counter wrap
+            age = (count - t) & 0xFFFFFFFF
+            yield {"us": gps - age * 1e6 / hz, "id": eid, "ctx": ctx,
+                   "args": (a0, a1, a2, a3)[:nargs]}
+
+
+def describe(rec, names, elf):
+    eid = rec["id"]
+    if eid >> 8 == EVENT_LOG >> 8 and rec["args"]:
+        fmt = elf.string(rec["args"][0]) if elf else None
+        if fmt is not None:
+            return "LOG%d" % (eid & 0xFF), format_log(fmt, rec["args"][1:], elf).rstrip("\n")
+    name = names.get(eid, "0x%04x" % eid)
+    return name, " ".join("0x%08x" % a for a in rec["args"])
+
+
+def context(ctx):
+    return "thread" if ctx == 0 else "isr%d" % ctx
+
+
+def print_timeline(records, names, elf, out):
+    last = None
+    for rec in records:
+        if "lost" in rec:
+            out.write("%-42s %d records lost\n" % ("---", rec["lost"]))
+            continue
+        name, text = describe(rec, names, elf)
+        dt = rec["us"] - last if last is not None else 0.0
+        last = rec["us"]
+        out.write("%16.3f %+10.3f %-7s %-18s %s\n" % (rec["us"] / 1e6, dt,
+                  context(rec["ctx"]), name, text))
+
+
+def chrome_trace(records, names, elf):
+    events = []
+    pid = 1
+    for g, lane in GROUPS.items():
+        events.append({"name": "thread_name", "ph": "M", "pid": pid, "tid": g,
+                       "args": {"name": lane}})
+    for rec in records:
+        if "lost" in rec:
+            events.append({"name": "lost %d" % rec["lost"], "ph": "i", "s": "g",
+                           "pid": pid, "tid": 0, "ts": events[-1].get("ts", 0)})
+            continue
+        name, text = describe(rec, names, elf)
+        ev = {"pid": pid, "tid": rec["id"] >> 8, "ts": rec["us"],
+              "args": {"ctx": context(rec["ctx"]), "args": text}}
+        if name.endswith("_BEGIN"):
+            ev.update(name=name[:-6], ph="B")
+        elif name.endswith("_END"):
+            ev.update(name=name[:-4], ph="E")
+        else:
+            ev.update(name=name if not text or not name.startswith("LOG") else text,
+                      ph="i", s="t")
+        events.append(ev)
+    return {"traceEvents": events, "displayTimeUnit": "ns"}
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    ap = argparse.ArgumentParser()
+    ap.add_argument("capture", help="raw bytes from the debug uart or the data link")
+    ap.add_argument("--elf", help="firmware image, for trace() messages")
+    ap.add_argument("--header", default=os.path.join(here, "include", "event_trace.h"))
+    ap.add_argument("--chrome", help="write the Trace Event Format JSON here")
+    args = ap.parse_args()
+
+    names = read_names(args.header)
+    elf = Elf(args.elf) if args.elf else None
+    with open(args.capture, "rb") as f:
+        records = list(decode(f.read()))
+
+    if args.chrome:
+        with open(args.chrome, "w") as f:
+            json.dump(chrome_trace(records, names, elf), f)
+    else:
+        print_timeline(records, names, elf, sys.stdout)
+
+    n = sum(1 for r in records if "lost" not in r)
+    lost = sum(r["lost"] for r in records if "lost" in r)
+    sys.stderr.write("%d records, %d lost\n" % (n, lost))
+
+
+if __name__ == "__main__":
+    main()
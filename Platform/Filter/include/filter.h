@@ -59,6 +59,10 @@ enum eFilterType {
       IIR_40HZ_LPF        = 0x90
 };
 
+/// or'ed into the cutoff frequency of configSelectUserLPFilter to select the
+/// Bartlett fir (5, 10, 20 or 40 Hz) instead of the Butterworth iir
+#define USER_LPF_FIR  0x100
+
 
 typedef struct {
 	int32_t  *a; // numerator coeffiecients
@@ -78,6 +82,32 @@ uint32_t Butterworth_Q27_Filter(butterworth_fixed *coefficients,
 uint32_t Apply_Butterworth_Q27_Filter(int idx, butterworth_fixed *coefficients,
                                       uint8_t           sensor);
 
+/** @brief bank of 2nd order Butterworth sections, one per channel, kept as
+  struct of arrays so a whole sensor vector is filtered in one pass. The
+  channels are the accel and rate axes of every chip, chip major:
+  channel = chip * BUTTERWORTH_BANK_AXES + sensor (XACCEL..ZRATE).
+  Each channel gives the same output as Apply_Butterworth_Q27_Filter.
+*/
+#define BUTTERWORTH_BANK_AXES     6
+#define BUTTERWORTH_BANK_CHANNELS (3 * BUTTERWORTH_BANK_AXES) // NUM_SENSOR_CHIPS
+
+typedef struct {
+	uint32_t n;                              // channels in use
+	int32_t  g[BUTTERWORTH_BANK_CHANNELS];   // gain, 0 passes the channel through
+	int32_t  b1[BUTTERWORTH_BANK_CHANNELS];  // denominator taps
+	int32_t  b2[BUTTERWORTH_BANK_CHANNELS];
+	int32_t  x1[BUTTERWORTH_BANK_CHANNELS];  // raw delay data
+	int32_t  x2[BUTTERWORTH_BANK_CHANNELS];
+	int32_t  y1[BUTTERWORTH_BANK_CHANNELS];  // filtered delay data
+	int32_t  y2[BUTTERWORTH_BANK_CHANNELS];
+} butterworth_bank;
+
+void Butterworth_Q27_BankInit(butterworth_bank *bank, uint32_t n);
+void Butterworth_Q27_BankSet(butterworth_bank *bank, uint32_t first, uint32_t count,
+                             butterworth_fixed *coefficients);
+void Butterworth_Q27_BankFilter(butterworth_bank *bank, int32_t *data);
+uint32_t Apply_Butterworth_Q27_Bank(butterworth_bank *bank);
+
 typedef struct {
 	int32_t *taps; // filter coeffiecients
 	uint32_t N;     // order of the filter
@@ -104,6 +134,27 @@ uint32_t Apply_Bartlett_Q27_Filter(int idx, bartlett_fixed *coefficients,
                                     uint8_t        sensor,
                                     int32_t       *x );
 
+/** @brief multi channel fir with symmetric Q27 taps. bartlett_fixed holds the
+  first (N + 1) / 2 taps of an N tap filter, the rest mirror them. Each
+  channel keeps its delay line twice in a row so the newest N samples are
+  always contiguous and a sample costs no shifting whatever N is. Every channel
+  gives the same output as Apply_Bartlett_Q27_Filter with the same taps.
+*/
+typedef struct {
+	bartlett_fixed *coefficients;
+	uint32_t n;      // channels
+	uint32_t head;   // position of the newest sample, shared by the channels
+	int32_t  *delay; // n * 2 * N samples, supplied by the caller
+} fir_q27_bank;
+
+#define FIR_Q27_DELAY_SIZE(N, n)  (2 * (N) * (n)) // int32_t per bank
+#define FIR_MAX_TAPS              24                 // longest FilterInit() set, 5 Hz at 200 Hz
+
+int32_t FIR_Q27_Folded( bartlett_fixed *coefficients, const int32_t *x );
+void FIR_Q27_BankInit( fir_q27_bank *bank, bartlett_fixed *coefficients,
+                       uint32_t n, int32_t *delay );
+void FIR_Q27_BankFilter( fir_q27_bank *bank, int32_t *data );
+
 void FilterInit(int odr); // Fixed point init
 
 
@@ -248,10 +248,94 @@ Butterworth_Q27_Filter( butterworth_fixed *coefficients,
 	return 0; // force a context switch so function completes before returning
 }
 
+/** ****************************************************************************
+ * @name: Butterworth_Q27_BankInit - clear the delay data of a filter bank and
+ *        set all its channels to pass through
+ * @brief
+ * @param [in] bank - filter bank
+ * @param [in] n - number of channels, up to BUTTERWORTH_BANK_CHANNELS
+ * @retval N/A
+ ******************************************************************************/
+void Butterworth_Q27_BankInit(butterworth_bank *bank, uint32_t n)
+{
+    memset(bank, 0, sizeof(butterworth_bank));
+    bank->n = n > BUTTERWORTH_BANK_CHANNELS ? BUTTERWORTH_BANK_CHANNELS : n;
+}
+
+/** ****************************************************************************
+ * @name: Butterworth_Q27_BankSet - load the taps of a run of channels, call
+ *        again after FilterInit() since the taps are copied
+ * @brief
+ * @param [in] bank - filter bank
+ * @param [in] first - first channel
+ * @param [in] count - number of channels
+ * @param [in] coefficients - iir filter coefficients, NULL for unfiltered
+ * @retval N/A
+ ******************************************************************************/
+void Butterworth_Q27_BankSet(butterworth_bank *bank, uint32_t first, uint32_t count,
+                             butterworth_fixed *coefficients)
+{
+    uint32_t i;
+
+    for (i = first; i < first + count && i < bank->n; i++)
+    {
+        if (coefficients == NULL || coefficients->b == NULL) {
+            bank->g[i]  = 0;
+            bank->b1[i] = 0;
+            bank->b2[i] = 0;
+        } else {
+            bank->g[i]  = coefficients->g;
+            bank->b1[i] = coefficients->b[1];
+            bank->b2[i] = coefficients->b[2];
+        }
+    }
+}
+
+// one sample of channel i, shared by the bank and the per sensor filter
+static inline int32_t _Butterworth_Q27_BankStep(butterworth_bank *bank, uint32_t i, int32_t x0)
+{
+    int32_t  y0;
+    int64_t  poles, zeros;
+
+    poles = (int64_t)bank->g[i] * (int64_t)( (x0 + bank->x2[i]) + 2 * bank->x1[i] );
+    zeros = ((int64_t)bank->b1[i] * (int64_t)bank->y1[i]) + ((int64_t)bank->b2[i] * (int64_t)bank->y2[i]);
+    y0    = (int32_t)( ((poles - zeros) + 67108864) >> 27 ); //  67108864 = 0.5 * 2^27
+
+    bank->x2[i] = bank->x1[i];
+    bank->x1[i] = x0;
+    bank->y2[i] = bank->y1[i];
+    bank->y1[i] = y0;
+    return bank->g[i] ? y0 : x0;
+}
+
+/** ****************************************************************************
+ * @name: Butterworth_Q27_BankFilter - filter one sample of every channel
+ * @brief same difference equation and rounding as Butterworth_Q27_Filter, the
+ *        channel loop has no branches or cross channel dependencies so it
+ *        unrolls and pipelines the 32x32->64 multiply accumulates
+ * @param [in] bank - filter bank
+ * @param [in/out] data - bank->n raw samples in, filtered samples out
+ * @retval N/A
+ ******************************************************************************/
+void Butterworth_Q27_BankFilter(butterworth_bank *bank, int32_t *data)
+{
+    uint32_t i;
+
+    for (i = 0; i < bank->n; i++)
+    {
+        data[i] = _Butterworth_Q27_BankStep(bank, i, data[i]);
+    }
+}
+
+// accel and rate axes of every chip, chip major, for the per sensor calls of
+// libSensors; the taps are copied in when the call asks for others
+static butterworth_bank iirBank = { .n = BUTTERWORTH_BANK_CHANNELS };
+
 /** ****************************************************************************
  * @name: Butterworth_Q27_Filter - load the input and delay buffer with the
  *        latest sample and apply the filter.
- * @brief
+ * @brief the accel and rate axes are channels of a bank, the other sensors
+ *        keep their delay data here
  * @param [in] coefficients - iir fitler coefficients
  * @param [in] sensor - index into the raw data array
  * @retval always return 0
@@ -263,6 +347,17 @@ uint32_t Apply_Butterworth_Q27_Filter(int idx, butterworth_fixed *coefficients,
     static int32_t  iir_y[NUM_SENSOR_CHIPS][NUM_SENSOR_READINGS][3]; // [11][3] filtered + delay data
 
     int *dptr = GetRawChipSensorsDataPtr(idx);
+    uint32_t ch;
+
+    if (idx >= 0 && idx < NUM_SENSOR_CHIPS && sensor < BUTTERWORTH_BANK_AXES) {
+        ch = idx * BUTTERWORTH_BANK_AXES + sensor;
+        if (coefficients->b == NULL || iirBank.g[ch] != coefficients->g ||
+            iirBank.b1[ch] != coefficients->b[1] || iirBank.b2[ch] != coefficients->b[2]) {
+            Butterworth_Q27_BankSet(&iirBank, ch, 1, coefficients);
+        }
+        dptr[sensor] = _Butterworth_Q27_BankStep(&iirBank, ch, dptr[sensor]);
+        return 0;
+    }
 
     Butterworth_Q27_PushSample((int32_t*)iir_x[idx][sensor], dptr[sensor]);
 
@@ -272,6 +367,39 @@ uint32_t Apply_Butterworth_Q27_Filter(int idx, butterworth_fixed *coefficients,
 	return 0; // force fcn to finish before returning
 }
 
+/** ****************************************************************************
+ * @name: Apply_Butterworth_Q27_Bank - filter the accel and rate axes of all the
+ *        chips in the raw data arrays in one pass
+ * @brief
+ * @param [in] bank - filter bank laid out chip major
+ * @retval always return 0
+ ******************************************************************************/
+uint32_t Apply_Butterworth_Q27_Bank(butterworth_bank *bank)
+{
+    int32_t data[BUTTERWORTH_BANK_CHANNELS];
+    int     chip, axis, *dptr;
+
+    for (chip = 0; chip * BUTTERWORTH_BANK_AXES < (int)bank->n; chip++)
+    {
+        dptr = GetRawChipSensorsDataPtr(chip);
+        for (axis = 0; axis < BUTTERWORTH_BANK_AXES; axis++) {
+            data[chip * BUTTERWORTH_BANK_AXES + axis] = dptr[ACCEL_START + axis];
+        }
+    }
+
+    Butterworth_Q27_BankFilter(bank, data);
+
+    for (chip = 0; chip * BUTTERWORTH_BANK_AXES < (int)bank->n; chip++)
+    {
+        dptr = GetRawChipSensorsDataPtr(chip);
+        for (axis = 0; axis < BUTTERWORTH_BANK_AXES; axis++) {
+            dptr[ACCEL_START + axis] = data[chip * BUTTERWORTH_BANK_AXES + axis];
+        }
+    }
+
+    return 0;
+}
+
 /** ****************************************************************************
  * @name: Bartlett_Q27_PushSample - load the input and delay buffer with the
  *        latest sample and push the older samples down.
@@ -285,7 +413,8 @@ Bartlett_Q27_PushSample( bartlett_fixed *filter,
                          int32_t       *x,
                          int32_t       data )
 {   // crude way to do a fifo - with too small a buffer too much arithmatic is
-	// required to manage the indexing
+	// required to manage the indexing. Apply_Bartlett_Q27_Filter and
+	// FIR_Q27_BankFilter do not shift.
 	memmove(&x[1], &x[0], (filter->N - 1) * sizeof(int32_t) );
 	x[0] = data;
 }
@@ -311,45 +440,141 @@ Bartlett_Q27_Filter( bartlett_fixed *coefficients,
                      int32_t       *x,
                      int32_t       *y )
 {
-	// Can handle up to 256 coefficients
-    uint8_t i = 0;
-
-    // Filtering variables
-    int64_t tmp = 0;
-    int64_t multiplier;
-    int64_t sum;
-
-    // Check for 40 Hz Bartlett filter (the difference equations are not symmetric in the same way
-    //   as the others)
-    if( coefficients->N == 3 ) {
-        multiplier = coefficients->taps[0];
-        sum = (int64_t)( x[0] + x[ coefficients->N - 1] );
-        tmp = tmp + ( multiplier * sum );
-
-        multiplier = coefficients->taps[1];
-        sum = (int64_t)( x[1] );
-        tmp = tmp + ( multiplier * sum );
-    } else {
-        for (i = 0; i < coefficients->N / 2; i++)
-        {   // This takes advantage of the symmetry of a sinc function
-            //   *y += coefficients->taps[i] * ( x[i] + x[ coefficients->N - i - 1] );
-            multiplier = coefficients->taps[i];
-            sum = (int64_t)( x[i] + x[ coefficients->N - i - 1] );
+    *y = FIR_Q27_Folded( coefficients, x );
+    return 0; // force fcn to finish before returning
+}
 
-            tmp = tmp + ( multiplier * sum );
-        }
+/** ****************************************************************************
+ * @name: FIR_Q27_Folded - evaluate a symmetric Q27 fir on a delay line
+ * @brief the mirrored samples are added before the multiply, the center tap of
+ *        an odd length filter (the 40 Hz Bartlett) is applied on its own.
+ *        The result is truncated, not rounded. Inlined into the bank filter,
+ *        which runs it per sample.
+ * @param [in] coefficients - first (N + 1) / 2 taps and the length N
+ * @param [in] x - N samples, newest first
+ * @retval filtered value
+ ******************************************************************************/
+static inline int32_t
+_FIR_Q27_Folded( bartlett_fixed *coefficients, const int32_t *x )
+{
+    const int32_t *taps = coefficients->taps;
+    uint32_t N = coefficients->N;
+    uint32_t i;
+    int64_t  tmp = 0;
+
+    for (i = 0; i < N / 2; i++)
+    {   // This takes advantage of the symmetry of a sinc function
+        tmp += (int64_t)taps[i] * (int64_t)( x[i] + x[N - i - 1] );
+    }
+    if (N & 1) {
+        tmp += (int64_t)taps[N / 2] * (int64_t)x[N / 2];
     }
-    tmp = tmp >> 27;
 
-    //*y += 67108864; // 0.5 * 2^27 (for rounding)
-    *y = tmp;
-    return 0; // force fcn to finish before returning
+    return (int32_t)(tmp >> 27);
+}
+
+int32_t
+FIR_Q27_Folded( bartlett_fixed *coefficients, const int32_t *x )
+{
+    return _FIR_Q27_Folded( coefficients, x );
 }
 
 /** ****************************************************************************
- * @name: Apply_Bartlett_Q27_Filter - load the input and delay buffer with the
- *        latest sample then run the filter.
+ * @name: FIR_Q27_BankInit - set up a multi channel fir and clear its delay lines
  * @brief
+ * @param [in] bank - filter bank
+ * @param [in] coefficients - fir taps, shared by the channels
+ * @param [in] n - number of channels
+ * @param [in] delay - FIR_Q27_DELAY_SIZE(coefficients->N, n) samples
+ * @retval N/A
+ ******************************************************************************/
+void
+FIR_Q27_BankInit( fir_q27_bank *bank, bartlett_fixed *coefficients,
+                  uint32_t n, int32_t *delay )
+{
+    bank->coefficients = coefficients;
+    bank->n     = n;
+    bank->head  = 0;
+    bank->delay = delay;
+    memset(delay, 0, FIR_Q27_DELAY_SIZE(coefficients->N, n) * sizeof(int32_t));
+}
+
+/** ****************************************************************************
+ * @name: FIR_Q27_BankFilter - filter one sample of every channel
+ * @brief like Apply_Bartlett_Q27_Filter the output is taken from the delay line
+ *        before the new sample goes in
+ * @param [in] bank - filter bank
+ * @param [in/out] data - bank->n raw samples in, filtered samples out
+ * @retval N/A
+ ******************************************************************************/
+static inline void
+_FIR_Q27_BankFilter( fir_q27_bank *bank, int32_t *data )
+{
+    uint32_t N    = bank->coefficients->N;
+    uint32_t head = bank->head;
+    uint32_t next = head ? head - 1 : N - 1;
+    int32_t  *line = bank->delay;
+    int32_t  sample;
+    uint32_t ch;
+
+    for (ch = 0; ch < bank->n; ch++, line += 2 * N)
+    {
+        sample  = data[ch];
+        data[ch] = _FIR_Q27_Folded( bank->coefficients, &line[head] );
+        line[next]     = sample;
+        line[next + N] = sample;
+    }
+    bank->head = next;
+}
+
+void
+FIR_Q27_BankFilter( fir_q27_bank *bank, int32_t *data )
+{
+    _FIR_Q27_BankFilter( bank, data );
+}
+
+// the ring position of every libSensors buffer, per chip and sensor as it
+// calls in; the samples stay in the buffer, which is exactly N long
+typedef struct {
+    int32_t  *x;    // buffer the ring is in
+    uint32_t N;     // its length
+    uint32_t head;  // position of the newest sample
+} bartlett_ring;
+
+static bartlett_ring firRing[NUM_SENSOR_CHIPS][NUM_SENSOR_READINGS];
+
+// reverse x[first..last)
+static void _Bartlett_Q27_Reverse( int32_t *x, uint32_t first, uint32_t last )
+{
+    int32_t tmp;
+
+    while (first + 1 < last) {
+        tmp = x[first];
+        x[first++] = x[--last];
+        x[last] = tmp;
+    }
+}
+
+// put a ring back in the shifted order, newest sample first
+static void _Bartlett_Q27_Unwind( bartlett_ring *ring )
+{
+    if (ring->x != NULL && ring->head != 0) {
+        _Bartlett_Q27_Reverse( ring->x, 0, ring->head );
+        _Bartlett_Q27_Reverse( ring->x, ring->head, ring->N );
+        _Bartlett_Q27_Reverse( ring->x, 0, ring->N );
+    }
+    ring->head = 0;
+}
+
+/** ****************************************************************************
+ * @name: Apply_Bartlett_Q27_Filter - run the filter on the delay buffer then
+ *        load the latest sample into it
+ * @brief the buffer is a ring of N samples, so a sample costs no shifting; only
+ *        its head is kept here, per chip and sensor. Another buffer or another
+ *        tap length for the same sensor first puts the old buffer back in the
+ *        shifted order, so zeroing a buffer still resets its filter and the
+ *        buffers libSensors keeps per tap set give the shifted buffer's output.
+ *        A buffer must not go away while it is the one in use for its sensor.
  * @param [in] coefficients - fir filter tap structure
  * @param [in] sensor - index into the sensor array
  * @param [in] x - [Number of Taps] sample delay buffer
@@ -360,17 +585,46 @@ Apply_Bartlett_Q27_Filter( int idx, bartlett_fixed *coefficients,
                            uint8_t        sensor,
                            int32_t       *x )
 {
-    int32_t filteredValue = 0;
     int *dptr = GetRawChipSensorsDataPtr(idx);
-    // Filter the sensor data using buffered (raw) sensor readings
-    Bartlett_Q27_Filter( coefficients, x,  &filteredValue );
+    const int32_t *taps = coefficients->taps;
+    uint32_t N = coefficients->N;
+    bartlett_ring *ring;
+    uint32_t i, a, b;
+    int64_t  tmp = 0;
+
+    if (idx < 0 || idx >= NUM_SENSOR_CHIPS || sensor >= NUM_SENSOR_READINGS) {
+        tmp = _FIR_Q27_Folded( coefficients, x );
+        Bartlett_Q27_PushSample( coefficients, x, dptr[sensor] );
+        dptr[sensor] = (int32_t)tmp;
+        return 0;
+    }
+
+    ring = &firRing[idx][sensor];
+    if (ring->x != x || ring->N != N) {
+        _Bartlett_Q27_Unwind( ring );
+        ring->x = x;
+        ring->N = N;
+    }
+
+    // the folded kernel with the lags counted from the head: a runs from the
+    // newest sample up, b from the oldest down
+    a = ring->head;
+    b = a ? a - 1 : N - 1;
+    for (i = 0; i < N / 2; i++)
+    {   // This takes advantage of the symmetry of a sinc function
+        tmp += (int64_t)taps[i] * (int64_t)( x[a] + x[b] );
+        a = (a + 1 == N) ? 0 : a + 1;
+        b = b ? b - 1 : N - 1;
+    }
+    if (N & 1) {
+        tmp += (int64_t)taps[N / 2] * (int64_t)x[a];
+    }
 
-    // Write the (raw) value in rawSensors to the filter buffer
-    Bartlett_Q27_PushSample( coefficients, x,
-                             dptr[sensor]  );
+    // the new sample takes the place of the oldest
+    ring->head = ring->head ? ring->head - 1 : N - 1;
+    x[ring->head] = dptr[sensor];
 
-    // Update the output value with the filtered value
-    dptr[sensor]  = (int32_t)filteredValue; //x[0];
+    dptr[sensor] = (int32_t)(tmp >> 27);
 
     return 0; // finish before returning
 }
@@ -52,113 +52,116 @@ static const int64_t b_q27[4][2][7] = { { { 504,  7526,  55908,  388989,  711409
 
 #define  ONE_HALF_Q27  67108864
 
+// Filter state, struct of arrays over chips and axes. Each of the public
+//   functions below owns one of these, the rate and accel versions only
+//   differ in which state they run on.
+typedef struct {
+    uint8_t initFilt[NUM_AXIS];
+    uint8_t calledCount;
+    int64_t x_q27[4][NUM_AXIS];
+    int64_t y_q27[4][NUM_AXIS];
+} bwf3_state_t;
+
+typedef struct {
+    uint8_t initFilt[NUM_AXIS];
+    uint8_t calledCount;
+    int64_t x_q27[NUM_SENSOR_CHIPS][3][NUM_AXIS];
+    int64_t v_q27[NUM_SENSOR_CHIPS][3][NUM_AXIS];
+    int64_t w_q27[NUM_SENSOR_CHIPS][3][NUM_AXIS];
+} bwf4_cascaded2nd_state_t;
+
+typedef struct {
+    uint8_t initFilt[NUM_AXIS];
+    uint8_t calledCount;
+    int64_t x_q27[NUM_SENSOR_CHIPS][2][NUM_AXIS];
+    int64_t u_q27[NUM_SENSOR_CHIPS][2][NUM_AXIS];
+    int64_t v_q27[NUM_SENSOR_CHIPS][2][NUM_AXIS];
+    int64_t w_q27[NUM_SENSOR_CHIPS][2][NUM_AXIS];
+} bwf3_cascaded1st_state_t;
+
+static bwf3_state_t accelBwf3 = { .initFilt = {1,1,1} };
+static bwf3_state_t rateBwf3  = { .initFilt = {1,1,1} };
+static bwf4_cascaded2nd_state_t accelBwf4 = { .initFilt = {1,1,1} };
+static bwf4_cascaded2nd_state_t rateBwf4  = { .initFilt = {1,1,1} };
+static bwf3_cascaded1st_state_t accelBwf3c = { .initFilt = {1,1,1} };
+static bwf3_cascaded1st_state_t rateBwf3c  = { .initFilt = {1,1,1} };
+
+/** ****************************************************************************
+ * @name _waitTilValid
+ * @brief Allow WAIT_TIL_VALID data points to pass through unfiltered before
+ *        passing out filtered data (meant to be part of the initialization
+ *        routine)
+ * @param [in] calledCount samples seen by the filter
+ * @param [in] in input value
+ * @param [out] out output value
+ * @retval  TRUE: output valid, FALSE: input copied to output
+ ******************************************************************************/
+static uint8_t _waitTilValid(uint8_t *calledCount, int16_t in, int32_t *out)
+{
+    if (*calledCount > WAIT_TIL_VALID) {
+        return 1;
+    } else {
+        (*calledCount)++;
+        *out = in;
+        return 0;
+    }
+}
+
 /** ****************************************************************************
  * @name _butterWorth3rdLowPass
  * @brief Butterworth 3rd order low pass filter
  *
  * Trace:
  *
+ * @param [in] s filter state
  * @param [in] in input value
  * @param [out] out output value
  * @retval  TRUE: the filter reached steady state, output valid
  *          FALSE the filter has not reached steady state, input copied to output
  ******************************************************************************/
-uint8_t _accelFilt_3rdOrderBWF_LowPass_Axis(uint8_t axis, int16_t in, int32_t *out, uint8_t freq, uint8_t dataRate)
+static uint8_t _butterWorth3rdLowPass(bwf3_state_t *s, uint8_t axis, int16_t in, int32_t *out, uint8_t freq, uint8_t dataRate)
 {
-    static uint8_t initFilt[3] = {1,1,1};
-
-    static uint8_t accelCalledCount = 0;
-    static int64_t accel_x_q27[4][NUM_AXIS] = {0};
-    static int64_t accel_y_q27[4][NUM_AXIS] = {0};
-
     // Initialize the vector of previous readings
-    if( initFilt[axis] ) {
-        initFilt[axis] = 0;
+    if( s->initFilt[axis] ) {
+        s->initFilt[axis] = 0;
 
-        accel_x_q27[1][axis] = (int64_t)in;
-        accel_x_q27[2][axis] = (int64_t)in;
-        accel_x_q27[3][axis] = (int64_t)in;
+        s->x_q27[1][axis] = (int64_t)in;
+        s->x_q27[2][axis] = (int64_t)in;
+        s->x_q27[3][axis] = (int64_t)in;
 
-        accel_y_q27[1][axis] = (int64_t)in;
-        accel_y_q27[2][axis] = (int64_t)in;
-        accel_y_q27[3][axis] = (int64_t)in;
+        s->y_q27[1][axis] = (int64_t)in;
+        s->y_q27[2][axis] = (int64_t)in;
+        s->y_q27[3][axis] = (int64_t)in;
     }
 
     // Filter the input signal
-    int64_t tmp_out = a_q27[3][dataRate][freq] * accel_y_q27[3][axis] +
-                      a_q27[2][dataRate][freq] * accel_y_q27[2][axis] +
-                      a_q27[1][dataRate][freq] * accel_y_q27[1][axis];
-    int64_t tmp_in  = b_q27[0][dataRate][freq] * ( (int64_t)in + accel_x_q27[3][axis] +
-                                                   3*( accel_x_q27[1][axis] +
-                                                       accel_x_q27[2][axis] ) );
+    int64_t tmp_out = a_q27[3][dataRate][freq] * s->y_q27[3][axis] +
+                      a_q27[2][dataRate][freq] * s->y_q27[2][axis] +
+                      a_q27[1][dataRate][freq] * s->y_q27[1][axis];
+    int64_t tmp_in  = b_q27[0][dataRate][freq] * ( (int64_t)in + s->x_q27[3][axis] +
+                                                   3*( s->x_q27[1][axis] +
+                                                       s->x_q27[2][axis] ) );
     // add 0.5 to the data to round
-    accel_y_q27[0][axis]  = ( tmp_in - tmp_out + ONE_HALF_Q27 ) >> 27;
-    *out = (int32_t) accel_y_q27[0][axis];
+    s->y_q27[0][axis]  = ( tmp_in - tmp_out + ONE_HALF_Q27 ) >> 27;
+    *out = (int32_t) s->y_q27[0][axis];
 
     // Save off past values
-    accel_x_q27[3][axis] = accel_x_q27[2][axis];   accel_y_q27[3][axis] = accel_y_q27[2][axis];
-    accel_x_q27[2][axis] = accel_x_q27[1][axis];   accel_y_q27[2][axis] = accel_y_q27[1][axis];
-    accel_x_q27[1][axis] = (int64_t)in;            accel_y_q27[1][axis] = *out;
-
-    // Allow WAIT_TIL_VALID data points to pass through unfiltered before
-    //   passing out filtered data (meant to be part of the initialization
-    //   routine)
-    if (accelCalledCount > WAIT_TIL_VALID) {
-        return 1;
-    } else {
-        accelCalledCount++;
-        *out = in;
-        return 0;
-    }
-}
+    s->x_q27[3][axis] = s->x_q27[2][axis];   s->y_q27[3][axis] = s->y_q27[2][axis];
+    s->x_q27[2][axis] = s->x_q27[1][axis];   s->y_q27[2][axis] = s->y_q27[1][axis];
+    s->x_q27[1][axis] = (int64_t)in;         s->y_q27[1][axis] = *out;
 
+    return _waitTilValid(&s->calledCount, in, out);
+}
 
-uint8_t _rateFilt_3rdOrderBWF_LowPass_Axis(uint8_t axis, int16_t in, int32_t *out, uint8_t freq, uint8_t dataRate)
+uint8_t _accelFilt_3rdOrderBWF_LowPass_Axis(uint8_t axis, int16_t in, int32_t *out, uint8_t freq, uint8_t dataRate)
 {
-    static uint8_t initFilt[3] = {1,1,1};
-
-    static uint8_t rateCalledCount = 0;
-    static int64_t rate_x_q27[4][NUM_AXIS] = {0};
-    static int64_t rate_y_q27[4][NUM_AXIS] = {0};
-
-    if( initFilt[axis] ) {
-        initFilt[axis] = 0;
-
-        rate_x_q27[1][axis] = (int64_t)in;
-        rate_x_q27[2][axis] = (int64_t)in;
-        rate_x_q27[3][axis] = (int64_t)in;
-
-        rate_y_q27[1][axis] = (int64_t)in;
-        rate_y_q27[2][axis] = (int64_t)in;
-        rate_y_q27[3][axis] = (int64_t)in;
-    }
-
-    // Filter the input signal
-    int64_t tmp_out = a_q27[3][dataRate][freq] * rate_y_q27[3][axis] +
-                      a_q27[2][dataRate][freq] * rate_y_q27[2][axis] +
-                      a_q27[1][dataRate][freq] * rate_y_q27[1][axis];
-    int64_t tmp_in  = b_q27[0][dataRate][freq] * ( (int64_t)in + rate_x_q27[3][axis] +
-                                                   3*( rate_x_q27[1][axis] +
-                                                       rate_x_q27[2][axis] ) );
-    rate_y_q27[0][axis]  = ( tmp_in - tmp_out + ONE_HALF_Q27 ) >> 27;
+    return _butterWorth3rdLowPass(&accelBwf3, axis, in, out, freq, dataRate);
+}
 
-    *out = (int32_t) rate_y_q27[0][axis];
 
-    // Save off past values
-    rate_x_q27[3][axis] = rate_x_q27[2][axis];   rate_y_q27[3][axis] = rate_y_q27[2][axis];
-    rate_x_q27[2][axis] = rate_x_q27[1][axis];   rate_y_q27[2][axis] = rate_y_q27[1][axis];
-    rate_x_q27[1][axis] = (int64_t)in;           rate_y_q27[1][axis] = *out;
-
-    // Allow WAIT_TIL_VALID data points to pass through unfiltered before
-    //   passing out filtered data (meant to be part of the initialization
-    //   routine)
-    if (rateCalledCount > WAIT_TIL_VALID) {
-        return 1;
-    } else {
-        rateCalledCount++;
-        *out = in;
-        return 0;
-    }
+uint8_t _rateFilt_3rdOrderBWF_LowPass_Axis(uint8_t axis, int16_t in, int32_t *out, uint8_t freq, uint8_t dataRate)
+{
+    return _butterWorth3rdLowPass(&rateBwf3, axis, in, out, freq, dataRate);
 }
 
 
@@ -169,175 +172,159 @@ uint8_t _rateFilt_3rdOrderBWF_LowPass_Axis(uint8_t axis, int16_t in, int32_t *ou
 static const int64_t ac_q27[3] = {134217728, -178407861,  67562416};
 static const int64_t bc_q27[3] = {  5843071,   11686141,   5843071};
 
-uint8_t _rateFilt_4thOrderBWF_LowPass_Axis_cascaded2nd(uint8_t chip, uint8_t axis, int16_t in, int32_t *out, uint8_t freq, uint8_t dataRate)
+/** ****************************************************************************
+ * @name _butterWorth4thLowPassCascaded2nd
+ * @brief Butterworth 4th order low pass filter as two 2nd order sections
+ * @param [in] s filter state
+ * @param [in] chip sensor chip
+ * @param [in] axis axis
+ * @param [in] in input value
+ * @param [out] out output value
+ * @retval  TRUE: output valid, FALSE: input copied to output
+ ******************************************************************************/
+static uint8_t _butterWorth4thLowPassCascaded2nd(bwf4_cascaded2nd_state_t *s, uint8_t chip, uint8_t axis, int16_t in, int32_t *out)
 {
-    static uint8_t initFilt[3] = {1,1,1};
-
-    static uint8_t rateCalledCount = 0;
-    static int64_t x_q27[NUM_SENSOR_CHIPS][3][NUM_AXIS] = {0};
-    static int64_t v_q27[NUM_SENSOR_CHIPS][3][NUM_AXIS] = {0};
-    static int64_t w_q27[NUM_SENSOR_CHIPS][3][NUM_AXIS] = {0};
-
+    int64_t (*x_q27)[NUM_AXIS] = s->x_q27[chip];
+    int64_t (*v_q27)[NUM_AXIS] = s->v_q27[chip];
+    int64_t (*w_q27)[NUM_AXIS] = s->w_q27[chip];
     int64_t tmp_in, tmp_out;
 
-    if( initFilt[axis] ) {
-        initFilt[axis] = 0;
+    if( s->initFilt[axis] ) {
+        s->initFilt[axis] = 0;
 
-        x_q27[chip][CURR][axis]   = (int64_t)in;
-        x_q27[chip][PASTx1][axis] = (int64_t)in;
-        x_q27[chip][PASTx2][axis] = (int64_t)in;
+        x_q27[CURR][axis]   = (int64_t)in;
+        x_q27[PASTx1][axis] = (int64_t)in;
+        x_q27[PASTx2][axis] = (int64_t)in;
 
-        v_q27[chip][CURR][axis]   = (int64_t)in;
-        v_q27[chip][PASTx1][axis] = (int64_t)in;
-        v_q27[chip][PASTx2][axis] = (int64_t)in;
+        v_q27[CURR][axis]   = (int64_t)in;
+        v_q27[PASTx1][axis] = (int64_t)in;
+        v_q27[PASTx2][axis] = (int64_t)in;
 
-        w_q27[chip][CURR][axis]   = (int64_t)in;
-        w_q27[chip][PASTx1][axis] = (int64_t)in;
-        w_q27[chip][PASTx2][axis] = (int64_t)in;
+        w_q27[CURR][axis]   = (int64_t)in;
+        w_q27[PASTx1][axis] = (int64_t)in;
+        w_q27[PASTx2][axis] = (int64_t)in;
     }
 
     // Filter the input signal (first stage)
     tmp_in  = bc_q27[CURR] * ( (int64_t)in +
-                               2*x_q27[chip][PASTx1][axis] +
-                                 x_q27[chip][PASTx2][axis] );
-    tmp_out = ac_q27[PASTx1] * v_q27[chip][PASTx1][axis] +
-              ac_q27[PASTx2] * v_q27[chip][PASTx2][axis];
+                               2*x_q27[PASTx1][axis] +
+                                 x_q27[PASTx2][axis] );
+    tmp_out = ac_q27[PASTx1] * v_q27[PASTx1][axis] +
+              ac_q27[PASTx2] * v_q27[PASTx2][axis];
 
-    v_q27[chip][CURR][axis]  = ( tmp_in - tmp_out + ONE_HALF_Q27 ) >> 27;
+    v_q27[CURR][axis]  = ( tmp_in - tmp_out + ONE_HALF_Q27 ) >> 27;
 
     // Filter the input signal (second stage)
-    tmp_in  = bc_q27[CURR] * (   v_q27[chip][CURR][axis] +
-                               2*v_q27[chip][PASTx1][axis] +
-                                 v_q27[chip][PASTx2][axis] );
-    tmp_out = ac_q27[PASTx1] * w_q27[chip][PASTx1][axis] +
-              ac_q27[PASTx2] * w_q27[chip][PASTx2][axis];
-    w_q27[chip][0][axis]  = ( tmp_in - tmp_out + ONE_HALF_Q27 ) >> 27;
+    tmp_in  = bc_q27[CURR] * (   v_q27[CURR][axis] +
+                               2*v_q27[PASTx1][axis] +
+                                 v_q27[PASTx2][axis] );
+    tmp_out = ac_q27[PASTx1] * w_q27[PASTx1][axis] +
+              ac_q27[PASTx2] * w_q27[PASTx2][axis];
+    w_q27[CURR][axis]  = ( tmp_in - tmp_out + ONE_HALF_Q27 ) >> 27;
 
-    *out = (int32_t) w_q27[chip][0][axis];
+    *out = (int32_t) w_q27[CURR][axis];
 
     // Save off past values
-    x_q27[chip][PASTx2][axis] = x_q27[chip][PASTx1][axis];
-    x_q27[chip][PASTx1][axis] = (int64_t)in;
+    x_q27[PASTx2][axis] = x_q27[PASTx1][axis];
+    x_q27[PASTx1][axis] = (int64_t)in;
 
-    v_q27[chip][PASTx2][axis] = v_q27[chip][PASTx1][axis];
-    v_q27[chip][PASTx1][axis] = v_q27[chip][CURR][axis];
+    v_q27[PASTx2][axis] = v_q27[PASTx1][axis];
+    v_q27[PASTx1][axis] = v_q27[CURR][axis];
 
-    w_q27[chip][PASTx2][axis] = w_q27[chip][PASTx1][axis];
-    w_q27[chip][PASTx1][axis] = w_q27[chip][CURR][axis];
+    w_q27[PASTx2][axis] = w_q27[PASTx1][axis];
+    w_q27[PASTx1][axis] = w_q27[CURR][axis];
 
-    // Allow WAIT_TIL_VALID data points to pass through unfiltered before
-    //   passing out filtered data (meant to be part of the initialization
-    //   routine)
-    if (rateCalledCount > WAIT_TIL_VALID) {
-        return 1;
-    } else {
-        rateCalledCount++;
-        *out = in;
-        return 0;
-    }
+    return _waitTilValid(&s->calledCount, in, out);
+}
+
+uint8_t _rateFilt_4thOrderBWF_LowPass_Axis_cascaded2nd(uint8_t chip, uint8_t axis, int16_t in, int32_t *out, uint8_t freq, uint8_t dataRate)
+{
+    (void)freq;
+    (void)dataRate;
+    return _butterWorth4thLowPassCascaded2nd(&rateBwf4, chip, axis, in, out);
 }
 
 uint8_t _accelFilt_4thOrderBWF_LowPass_Axis_cascaded2nd(uint8_t chip, uint8_t axis, int16_t in, int32_t *out, uint8_t freq, uint8_t dataRate)
 {
-    static uint8_t initFilt[3] = {1,1,1};
+    (void)freq;
+    (void)dataRate;
+    return _butterWorth4thLowPassCascaded2nd(&accelBwf4, chip, axis, in, out);
+}
 
-    static uint8_t rateCalledCount = 0;
-    static int64_t x_q27[NUM_SENSOR_CHIPS][3][NUM_AXIS] = {0};
-    static int64_t v_q27[NUM_SENSOR_CHIPS][3][NUM_AXIS] = {0};
-    static int64_t w_q27[NUM_SENSOR_CHIPS][3][NUM_AXIS] = {0};
 
+static int64_t ac1_q27[2] = {134217728, -58883939};
+static int64_t bc1_q27[2] = { 37666894,  37666894};
+
+/** ****************************************************************************
+ * @name _butterWorth3rdLowPassCascaded1st
+ * @brief Butterworth 3rd order low pass filter as three 1st order sections,
+ *        with the taps last loaded by the rate filter
+ * @param [in] s filter state
+ * @param [in] chip sensor chip
+ * @param [in] axis axis
+ * @param [in] in input value
+ * @param [out] out output value
+ * @retval  TRUE: output valid, FALSE: input copied to output
+ ******************************************************************************/
+static uint8_t _butterWorth3rdLowPassCascaded1st(bwf3_cascaded1st_state_t *s, uint8_t chip, uint8_t axis, int16_t in, int32_t *out)
+{
+    int64_t (*x_q27)[NUM_AXIS] = s->x_q27[chip];
+    int64_t (*u_q27)[NUM_AXIS] = s->u_q27[chip];
+    int64_t (*v_q27)[NUM_AXIS] = s->v_q27[chip];
+    int64_t (*w_q27)[NUM_AXIS] = s->w_q27[chip];
     int64_t tmp_in, tmp_out;
 
-    if( initFilt[axis] ) {
-        initFilt[axis] = 0;
+    if( s->initFilt[axis] ) {
+        s->initFilt[axis] = 0;
+
+        x_q27[CURR][axis]   = (int64_t)in;
+        x_q27[PASTx1][axis] = (int64_t)in;
 
-        x_q27[chip][CURR][axis]   = (int64_t)in;
-        x_q27[chip][PASTx1][axis] = (int64_t)in;
-        x_q27[chip][PASTx2][axis] = (int64_t)in;
+        u_q27[CURR][axis]   = (int64_t)in;
+        u_q27[PASTx1][axis] = (int64_t)in;
 
-        v_q27[chip][CURR][axis]   = (int64_t)in;
-        v_q27[chip][PASTx1][axis] = (int64_t)in;
-        v_q27[chip][PASTx2][axis] = (int64_t)in;
+        v_q27[CURR][axis]   = (int64_t)in;
+        v_q27[PASTx1][axis] = (int64_t)in;
 
-        w_q27[chip][CURR][axis]   = (int64_t)in;
-        w_q27[chip][PASTx1][axis] = (int64_t)in;
-        w_q27[chip][PASTx2][axis] = (int64_t)in;
+        w_q27[CURR][axis]   = (int64_t)in;
+        w_q27[PASTx1][axis] = (int64_t)in;
     }
 
     // Filter the input signal (first stage)
-    tmp_in  = bc_q27[CURR] * ( (int64_t)in +
-                               2*x_q27[chip][PASTx1][axis] +
-                                 x_q27[chip][PASTx2][axis] );
-    tmp_out = ac_q27[PASTx1] * v_q27[chip][PASTx1][axis] +
-              ac_q27[PASTx2] * v_q27[chip][PASTx2][axis];
-
-    v_q27[chip][CURR][axis]  = ( tmp_in - tmp_out + ONE_HALF_Q27 ) >> 27;
+    tmp_in  = bc1_q27[CURR] * ( (int64_t)in +
+                                x_q27[PASTx1][axis] );
+    tmp_out = ac1_q27[PASTx1] * u_q27[PASTx1][axis];
 
-    // Filter the input signal (second stage)
-    tmp_in  = bc_q27[CURR] * (   v_q27[chip][CURR][axis] +
-                               2*v_q27[chip][PASTx1][axis] +
-                                 v_q27[chip][PASTx2][axis] );
-    tmp_out = ac_q27[PASTx1] * w_q27[chip][PASTx1][axis] +
-              ac_q27[PASTx2] * w_q27[chip][PASTx2][axis];
-    w_q27[chip][0][axis]  = ( tmp_in - tmp_out + ONE_HALF_Q27 ) >> 27;
+    u_q27[CURR][axis]  = ( tmp_in - tmp_out + ONE_HALF_Q27 ) >> 27;
 
-    *out = (int32_t) w_q27[chip][0][axis];
+    // Second stage
+    tmp_in  = bc1_q27[CURR] * ( u_q27[CURR][axis] +
+                                u_q27[PASTx1][axis] );
+    tmp_out = ac1_q27[PASTx1] * v_q27[PASTx1][axis];
 
-    // Save off past values
-    x_q27[chip][PASTx2][axis] = x_q27[chip][PASTx1][axis];
-    x_q27[chip][PASTx1][axis] = (int64_t)in;
+    v_q27[CURR][axis]  = ( tmp_in - tmp_out + ONE_HALF_Q27 ) >> 27;
 
-    v_q27[chip][PASTx2][axis] = v_q27[chip][PASTx1][axis];
-    v_q27[chip][PASTx1][axis] = v_q27[chip][CURR][axis];
+    // Third stage
+    tmp_in  = bc1_q27[CURR] * ( v_q27[CURR][axis] +
+                                v_q27[PASTx1][axis] );
+    tmp_out = ac1_q27[PASTx1] * w_q27[PASTx1][axis];
 
-    w_q27[chip][PASTx2][axis] = w_q27[chip][PASTx1][axis];
-    w_q27[chip][PASTx1][axis] = w_q27[chip][CURR][axis];
+    w_q27[CURR][axis]  = ( tmp_in - tmp_out + ONE_HALF_Q27 ) >> 27;
 
-    // Allow WAIT_TIL_VALID data points to pass through unfiltered before
-    //   passing out filtered data (meant to be part of the initialization
-    //   routine)
-    if (rateCalledCount > WAIT_TIL_VALID) {
-        return 1;
-    } else {
-        rateCalledCount++;
-        *out = in;
-        return 0;
-    }
-}
+    *out = (int32_t) w_q27[CURR][axis];
 
+    // Save off past values
+    x_q27[PASTx1][axis] = (int64_t)in;
+    u_q27[PASTx1][axis] = u_q27[CURR][axis];
+    v_q27[PASTx1][axis] = v_q27[CURR][axis];
+    w_q27[PASTx1][axis] = w_q27[CURR][axis];
 
-static int64_t ac1_q27[2] = {134217728, -58883939};
-static int64_t bc1_q27[2] = { 37666894,  37666894};
+    return _waitTilValid(&s->calledCount, in, out);
+}
 
 uint8_t _rateFilt_3rdOrderBWF_LowPass_Axis_cascaded1st(uint8_t chip, uint8_t axis, int16_t in, int32_t *out, uint8_t freq, uint8_t dataRate)
 {
-    static uint8_t initFilt[3] = {1,1,1};
-
-    static uint8_t rateCalledCount = 0;
-    static int64_t x_q27[NUM_SENSOR_CHIPS][2][NUM_AXIS] = {0};
-    static int64_t u_q27[NUM_SENSOR_CHIPS][2][NUM_AXIS] = {0};
-    static int64_t v_q27[NUM_SENSOR_CHIPS][2][NUM_AXIS] = {0};
-    static int64_t w_q27[NUM_SENSOR_CHIPS][2][NUM_AXIS] = {0};
-
-    int64_t tmp_in, tmp_out;
-
-    if( initFilt[axis] ) {
-        initFilt[axis] = 0;
-
-        x_q27[chip][CURR][axis]   = (int64_t)in;
-        x_q27[chip][PASTx1][axis] = (int64_t)in;
-
-        u_q27[chip][CURR][axis]   = (int64_t)in;
-        u_q27[chip][PASTx1][axis] = (int64_t)in;
-
-        v_q27[chip][CURR][axis]   = (int64_t)in;
-        v_q27[chip][PASTx1][axis] = (int64_t)in;
-
-        w_q27[chip][CURR][axis]   = (int64_t)in;
-        w_q27[chip][PASTx1][axis] = (int64_t)in;
-    }
-
-
+    (void)dataRate;
     switch( freq ) {
         case LPF_25HZ:
             // These are 50 Hz filter coefficients.  Need to generate other coeffs.
@@ -365,116 +352,14 @@ uint8_t _rateFilt_3rdOrderBWF_LowPass_Axis_cascaded1st(uint8_t chip, uint8_t axi
             bc1_q27[1] =  49121902;
             break;
     }
-    
-
-    // Filter the input signal (first stage)
-    tmp_in  = bc1_q27[CURR] * ( (int64_t)in + x_q27[chip][PASTx1][axis] );
-    tmp_out = ac1_q27[PASTx1] * u_q27[chip][PASTx1][axis];
-
-    u_q27[chip][CURR][axis]  = ( tmp_in - tmp_out + ONE_HALF_Q27 ) >> 27;
 
-    // Second stage
-    tmp_in  = bc1_q27[CURR] * ( u_q27[chip][CURR][axis] + u_q27[chip][PASTx1][axis] );
-    tmp_out = ac1_q27[PASTx1] * v_q27[chip][PASTx1][axis];
-
-    v_q27[chip][CURR][axis]  = ( tmp_in - tmp_out + ONE_HALF_Q27 ) >> 27;
-
-    // Third stage
-    tmp_in  = bc1_q27[CURR] * ( v_q27[chip][CURR][axis] +
-                                v_q27[chip][PASTx1][axis] );
-    tmp_out = ac1_q27[PASTx1] * w_q27[chip][PASTx1][axis];
-
-    w_q27[chip][CURR][axis]  = ( tmp_in - tmp_out + ONE_HALF_Q27 ) >> 27;
-
-    *out = (int32_t) w_q27[chip][CURR][axis];
-
-    // Save off past values
-    x_q27[chip][PASTx1][axis] = (int64_t)in;
-    u_q27[chip][PASTx1][axis] = u_q27[chip][CURR][axis];
-    v_q27[chip][PASTx1][axis] = v_q27[chip][CURR][axis];
-    w_q27[chip][PASTx1][axis] = w_q27[chip][CURR][axis];
-
-    // Allow WAIT_TIL_VALID data points to pass through unfiltered before
-    //   passing out filtered data (meant to be part of the initialization
-    //   routine)
-    if (rateCalledCount > WAIT_TIL_VALID) {
-        return 1;
-    } else {
-        rateCalledCount++;
-        *out = in;
-        return 0;
-    }
+    return _butterWorth3rdLowPassCascaded1st(&rateBwf3c, chip, axis, in, out);
 }
 
 
 uint8_t _accelFilt_3rdOrderBWF_LowPass_Axis_cascaded1st(uint8_t chip, uint8_t axis, int16_t in, int32_t *out, uint8_t freq, uint8_t dataRate)
 {
-    static uint8_t initFilt[3] = {1,1,1};
-
-    static uint8_t rateCalledCount = 0;
-    static int64_t x_q27[NUM_SENSOR_CHIPS][2][NUM_AXIS] = {0};
-    static int64_t u_q27[NUM_SENSOR_CHIPS][2][NUM_AXIS] = {0};
-    static int64_t v_q27[NUM_SENSOR_CHIPS][2][NUM_AXIS] = {0};
-    static int64_t w_q27[NUM_SENSOR_CHIPS][2][NUM_AXIS] = {0};
-
-    int64_t tmp_in, tmp_out;
-
-    if( initFilt[axis] ) {
-        initFilt[axis] = 0;
-
-        x_q27[chip][CURR][axis]   = (int64_t)in;
-        x_q27[chip][PASTx1][axis] = (int64_t)in;
-
-        u_q27[chip][CURR][axis]   = (int64_t)in;
-        u_q27[chip][PASTx1][axis] = (int64_t)in;
-
-        v_q27[chip][CURR][axis]   = (int64_t)in;
-        v_q27[chip][PASTx1][axis] = (int64_t)in;
-
-        w_q27[chip][CURR][axis]   = (int64_t)in;
-        w_q27[chip][PASTx1][axis] = (int64_t)in;
-    }
-
-    // Filter the input signal (first stage)
-    tmp_in  = bc1_q27[CURR] * ( (int64_t)in +
-                                x_q27[chip][PASTx1][axis] );
-    tmp_out = ac1_q27[PASTx1] * u_q27[chip][PASTx1][axis];
-
-    u_q27[chip][CURR][axis]  = ( tmp_in - tmp_out + ONE_HALF_Q27 ) >> 27;
-
-    // Second stage
-    tmp_in  = bc1_q27[CURR] * ( u_q27[chip][CURR][axis] +
-                                u_q27[chip][PASTx1][axis] );
-    tmp_out = ac1_q27[PASTx1] * v_q27[chip][PASTx1][axis];
-
-    v_q27[chip][CURR][axis]  = ( tmp_in - tmp_out + ONE_HALF_Q27 ) >> 27;
-
-    // Third stage
-    tmp_in  = bc1_q27[CURR] * ( v_q27[chip][CURR][axis] +
-                                v_q27[chip][PASTx1][axis] );
-    tmp_out = ac1_q27[PASTx1] * w_q27[chip][PASTx1][axis];
-
-    w_q27[chip][CURR][axis]  = ( tmp_in - tmp_out + ONE_HALF_Q27 ) >> 27;
-
-    *out = (int32_t) w_q27[chip][CURR][axis];
-
-    // Save off past values
-    x_q27[chip][PASTx1][axis] = (int64_t)in;
-    u_q27[chip][PASTx1][axis] = u_q27[chip][CURR][axis];
-    v_q27[chip][PASTx1][axis] = v_q27[chip][CURR][axis];
-    w_q27[chip][PASTx1][axis] = w_q27[chip][CURR][axis];
-
-    // Allow WAIT_TIL_VALID data points to pass through unfiltered before
-    //   passing out filtered data (meant to be part of the initialization
-    //   routine)
-    if (rateCalledCount > WAIT_TIL_VALID) {
-        return 1;
-    } else {
-        rateCalledCount++;
-        *out = in;
-        return 0;
-    }
+    (void)freq;
+    (void)dataRate;
+    return _butterWorth3rdLowPassCascaded1st(&accelBwf3c, chip, axis, in, out);
 }
-
-
-
@@ -27,10 +27,13 @@ limitations under the License.
 #ifndef _COMM_API_H
 #define _COMM_API_H
 
+#include "json_stream.h"
+
 extern void ProcessUserCommands(void);
 extern void SendContinuousPacket(void);
 extern void debug_com_process(void);
 extern void send_ins_nmea(void);
 extern void send_ins_to_bt(void);
 extern void handle_tcp_commands(void);
+extern int  write_configuration_json(json_sink_t sink, void *ctx);
 #endif
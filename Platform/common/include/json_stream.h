@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * @file:   json_stream.h
+ * @brief:  allocation free json writer and pull parser
+ *******************************************************************************/
+/*******************************************************************************
+Copyright 2020 ACEINNA, INC
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*******************************************************************************/
+
+
+#ifndef _JSON_STREAM_H
+#define _JSON_STREAM_H
+
+#include <stdint.h>
+
+#define JSON_MAX_DEPTH 8
+
+/* takes the bytes the writer could not keep, returns 0 on failure */
+typedef int (*json_sink_t)(void* ctx, const char* data, uint16_t len);
+
+/* writes json straight into buf, with the same text as cJSON_Print (fmt = 1)
+   or cJSON_PrintUnformatted (fmt = 0) would give for the same items. Without
+   a sink the whole text has to fit in buf, with a sink buf is flushed to it
+   whenever it fills */
+typedef struct {
+	char* buf;
+	uint16_t size;
+	uint16_t len;
+	json_sink_t sink;
+	void* ctx;
+	uint32_t total;					/* bytes written, flushed or not */
+	uint8_t fmt;
+	uint8_t depth;
+	uint8_t err;					/* buf overflow, sink failure or bad nesting */
+	uint8_t count[JSON_MAX_DEPTH];	/* members written in each open object */
+} json_writer_t;
+
+void json_writer_init(json_writer_t* w, char* buf, uint16_t size, json_sink_t sink, void* ctx, uint8_t fmt);
+void json_object_begin(json_writer_t* w, const char* key);
+void json_object_end(json_writer_t* w);
+void json_add_string(json_writer_t* w, const char* key, const char* val);
+void json_add_number(json_writer_t* w, const char* key, double val);
+int json_writer_end(json_writer_t* w);
+
+/* pull parser, walks the text in place and returns one token per call */
+typedef enum {
+	JSON_ERROR = -1,
+	JSON_DONE = 0,					/* first value complete, the rest is not read */
+	JSON_OBJECT_BEGIN,
+	JSON_OBJECT_END,
+	JSON_ARRAY_BEGIN,
+	JSON_ARRAY_END,
+	JSON_STRING,
+	JSON_NUMBER,
+	JSON_TRUE,
+	JSON_FALSE,
+	JSON_NULL
+} json_token_e;
+
+typedef struct {
+	const char* pos;
+	const char* end;
+	uint8_t depth;
+	uint8_t in_object[JSON_MAX_DEPTH];	/* container kind at each level */
+	uint8_t members[JSON_MAX_DEPTH];	/* values seen at each level, saturating */
+	const char* key;				/* member name of the token, raw, NULL in arrays */
+	uint16_t key_len;
+	const char* str;				/* JSON_STRING value, raw */
+	uint16_t str_len;
+	double num;						/* JSON_NUMBER value, as cJSON parses it */
+} json_reader_t;
+
+void json_reader_init(json_reader_t* r, const char* text, uint16_t len);
+json_token_e json_next(json_reader_t* r);
+int json_skip(json_reader_t* r, json_token_e tok);
+int json_key_is(const json_reader_t* r, const char* name);
+int json_string_copy(const char* raw, uint16_t len, char* out, uint16_t size);
+
+#endif
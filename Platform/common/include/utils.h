@@ -25,24 +25,57 @@ limitations under the License.
 
 #include "gnss_data_api.h"
 
-#define GPS_BUFF_SIZE (2000)
-#define IMU_BUFF_SIZE (2000)
-#define DEBUG_BUFF_SIZE (2000)
+#define GPS_BUFF_SIZE (2048)
+#define IMU_BUFF_SIZE (2048)
+#define DEBUG_BUFF_SIZE (2048)
 
 
+/* single-producer/single-consumer ring buffer over a power of two sized buffer.
+   the producer only moves in, the consumer only moves out, so no critical section is needed */
+#define FIFO_SIZE_VALID(size)   ((size) >= 2 && (size) <= 0x8000 && ((size) & ((size) - 1)) == 0)
+#define FIFO_SIZE_CHECK(size)   _Static_assert(FIFO_SIZE_VALID(size), #size " is not a power of two")
+
 typedef struct
  {
 	uint8_t* buffer;
-	uint16_t in;
-	uint16_t out;
+	volatile uint16_t in;
+	volatile uint16_t out;
 	uint16_t size;
+	uint32_t overflow;      // bytes dropped by fifo_push because the fifo was full
 } fifo_type;
 
 
-void fifo_init(fifo_type* fifo, uint8_t* buffer, uint16_t size);
+int fifo_init(fifo_type* fifo, uint8_t* buffer, uint16_t size);
 uint16_t fifo_get(fifo_type* fifo, uint8_t* buffer, uint16_t len);
 uint16_t fifo_status(fifo_type* fifo);
-void fifo_push(fifo_type* fifo, uint8_t* buffer, uint16_t size);
+uint16_t fifo_space(fifo_type* fifo);
+uint16_t fifo_push(fifo_type* fifo, uint8_t* buffer, uint16_t size);
+uint16_t fifo_peek(fifo_type* fifo, uint8_t** data);
+void fifo_commit(fifo_type* fifo, uint16_t len);
+uint16_t fifo_reserve(fifo_type* fifo, uint8_t** data);
+void fifo_publish(fifo_type* fifo, uint16_t len);
+
+/* text sentence builder, keeps the xor checksum of the bytes written so far */
+typedef struct
+ {
+	char* buf;
+	uint16_t len;
+	uint16_t size;
+	uint8_t sum;
+} sentence_t;
+
+
+void sentence_begin(sentence_t* s, char* buf, uint16_t size);
+void sentence_str(sentence_t* s, const char* str);
+void sentence_bytes(sentence_t* s, const uint8_t* data, uint16_t len);
+void sentence_uint(sentence_t* s, uint32_t val, int width);
+void sentence_fixed(sentence_t* s, double val, int width, int prec);
+void sentence_zfixed(sentence_t* s, double val, int width, int prec);
+uint16_t sentence_end(sentence_t* s, const char* sep);
+uint16_t sentence_end_upper(sentence_t* s, const char* sep);
+
+#define NMEA_GGA_MAXLEN (128)     // bound of the print_nmea_gga output buffer
+#define NMEA_RMC_MAXLEN (128)     // bound of the print_rmc output buffer
 
 char *i2a(int num, char *str, int radix);
 void float2arr(double data, char *a, unsigned char id, unsigned char dd);
@@ -51,6 +84,7 @@ int print_nmea_gga(double *ep, double *xyz, int nsat, int type, double dop,
 	double age, char *buff);
 int print_pos_gga(gtime_t time, double *pos, int num_of_sat, int fixID,
 	double hdop, double age, char *gga);
+int print_rmc(gtime_t time, double *ecef, int fixID, char *buff);
 
 
 #endif /* _UTILS_H */
@@ -0,0 +1,435 @@
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <float.h>
+#include <limits.h>
+
+#include "json_stream.h"
+#include "utils.h"
+
+/* the writer and the reader keep all their state in the caller's struct,
+   nothing is allocated and the stack use does not depend on the input */
+
+static void json_put(json_writer_t* w, const char* data, uint16_t len)
+{
+	uint16_t room, n;
+
+	w->total += len;
+	while (len) {
+		room = (uint16_t)(w->size - (w->sink ? 0 : 1) - w->len);
+		if (room == 0) {
+			if (w->sink == NULL || !w->sink(w->ctx, w->buf, w->len)) {
+				w->err = 1;
+				return;
+			}
+			w->len = 0;
+			continue;
+		}
+		n = len < room ? len : room;
+		memcpy(w->buf + w->len, data, n);
+		w->len += n;
+		data += n;
+		len -= n;
+	}
+}
+
+static void json_put_str(json_writer_t* w, const char* str)
+{
+	json_put(w, str, (uint16_t)strlen(str));
+}
+
+static void json_put_tabs(json_writer_t* w, int n)
+{
+	while (n-- > 0) {
+		json_put(w, "\t", 1);
+	}
+}
+
+/* quoted string, escaped the way cJSON does */
+static void json_put_quoted(json_writer_t* w, const char* str)
+{
+	const char* run;
+	char esc[8];
+	unsigned char c;
+
+	json_put(w, "\"", 1);
+	if (str) {
+		for (run = str; (c = (unsigned char)*str) != 0; str++) {
+			if (c > 31 && c != '\"' && c != '\\') {
+				continue;
+			}
+			json_put(w, run, (uint16_t)(str - run));
+			esc[0] = '\\';
+			esc[2] = '\0';
+			switch (c) {
+			case '\\': esc[1] = '\\'; break;
+			case '\"': esc[1] = '\"'; break;
+			case '\b': esc[1] = 'b'; break;
+			case '\f': esc[1] = 'f'; break;
+			case '\n': esc[1] = 'n'; break;
+			case '\r': esc[1] = 'r'; break;
+			case '\t': esc[1] = 't'; break;
+			default:
+				snprintf(esc + 1, sizeof(esc) - 1, "u%04x", c);
+				break;
+			}
+			json_put(w, esc, (uint16_t)strlen(esc));
+			run = str + 1;
+		}
+		json_put(w, run, (uint16_t)(str - run));
+	}
+	json_put(w, "\"", 1);
+}
+
+/* separator, indent and key of the next member of the open object */
+static void json_member(json_writer_t* w, const char* key)
+{
+	if (w->depth == 0) {
+		if (w->count[0]++) {
+			w->err = 1;				/* one root value only */
+		}
+		return;
+	}
+	if (w->count[w->depth]++) {
+		json_put(w, ",", 1);
+	}
+	if (w->fmt) {
+		json_put(w, "\n", 1);
+		json_put_tabs(w, w->depth);
+	}
+	json_put_quoted(w, key);
+	json_put_str(w, w->fmt ? ":\t" : ":");
+}
+
+void json_writer_init(json_writer_t* w, char* buf, uint16_t size, json_sink_t sink, void* ctx, uint8_t fmt)
+{
+	memset(w, 0, sizeof(json_writer_t));
+	w->buf = buf;
+	w->size = size;
+	w->sink = sink;
+	w->ctx = ctx;
+	w->fmt = fmt;
+	if (size == 0) {
+		w->err = 1;
+	}
+}
+
+/* key is ignored for the root object */
+void json_object_begin(json_writer_t* w, const char* key)
+{
+	json_member(w, key);
+	json_put(w, "{", 1);
+	if (w->depth + 1 >= JSON_MAX_DEPTH) {
+		w->err = 1;
+		return;
+	}
+	w->depth++;
+	w->count[w->depth] = 0;
+}
+
+void json_object_end(json_writer_t* w)
+{
+	if (w->depth == 0) {
+		w->err = 1;
+		return;
+	}
+	if (w->fmt) {
+		json_put(w, "\n", 1);
+		/* cJSON indents the brace of an empty object one tab less */
+		json_put_tabs(w, w->count[w->depth] ? w->depth - 1 : w->depth - 2);
+	}
+	json_put(w, "}", 1);
+	w->depth--;
+}
+
+void json_add_string(json_writer_t* w, const char* key, const char* val)
+{
+	json_member(w, key);
+	json_put_quoted(w, val);
+}
+
+/* same text as cJSON print_number */
+void json_add_number(json_writer_t* w, const char* key, double val)
+{
+	char tmp[64];
+	sentence_t s;
+	int n;
+
+	json_member(w, key);
+	sentence_begin(&s, tmp, sizeof(tmp));
+	if (val == 0) {
+		sentence_str(&s, "0");
+	}
+	else if (val <= INT_MAX && val >= INT_MIN && fabs((double)(int)val - val) <= DBL_EPSILON) {
+		if (val < 0) {
+			sentence_str(&s, "-");
+		}
+		sentence_uint(&s, val < 0 ? 0u - (uint32_t)(int)val : (uint32_t)(int)val, 0);
+	}
+	else if (fabs(floor(val) - val) <= DBL_EPSILON && fabs(val) < 1.0e60) {
+		sentence_fixed(&s, val, 0, 0);
+	}
+	else if (fabs(val) < 1.0e-6 || fabs(val) > 1.0e9) {
+		n = snprintf(tmp, sizeof(tmp), "%e", val);
+		s.len = (uint16_t)(n < (int)sizeof(tmp) ? n : (int)sizeof(tmp) - 1);
+	}
+	else {
+		sentence_fixed(&s, val, 0, 6);
+	}
+	json_put(w, tmp, s.len);
+}
+
+/* flush and terminate, return the text length or -1 */
+int json_writer_end(json_writer_t* w)
+{
+	if (w->depth != 0) {
+		w->err = 1;
+	}
+	if (w->sink) {
+		if (w->len && !w->sink(w->ctx, w->buf, w->len)) {
+			w->err = 1;
+		}
+		w->len = 0;
+	}
+	else if (w->size) {
+		w->buf[w->len] = '\0';
+	}
+	return w->err ? -1 : (int)w->total;
+}
+
+static const char* json_skip_space(const char* p, const char* end)
+{
+	while (p < end && (unsigned char)*p <= 32) {
+		p++;
+	}
+	return p;
+}
+
+/* raw string body, p on the opening quote; returns the char after the closing quote */
+static const char* json_scan_string(const char* p, const char* end, const char** str, uint16_t* len)
+{
+	const char* s = ++p;
+
+	while (p < end && *p != '\"') {
+		if (*p++ == '\\') {
+			p++;
+		}
+	}
+	if (p >= end) {
+		return NULL;
+	}
+	*str = s;
+	*len = (uint16_t)(p - s);
+	return p + 1;
+}
+
+/* cJSON parse_number, kept operation for operation so the doubles agree */
+static const char* json_scan_number(const char* p, const char* end, double* val)
+{
+	double n = 0, sign = 1, scale = 0;
+	int subscale = 0, signsubscale = 1;
+
+	if (p < end && *p == '-') sign = -1, p++;
+	if (p < end && *p == '0') p++;
+	if (p < end && *p >= '1' && *p <= '9') {
+		do {
+			n = (n * 10.0) + (*p++ - '0');
+		} while (p < end && *p >= '0' && *p <= '9');
+	}
+	if (p + 1 < end && *p == '.' && p[1] >= '0' && p[1] <= '9') {
+		p++;
+		do {
+			n = (n * 10.0) + (*p++ - '0'), scale--;
+		} while (p < end && *p >= '0' && *p <= '9');
+	}
+	if (p < end && (*p == 'e' || *p == 'E')) {
+		p++;
+		if (p < end && *p == '+') p++;
+		else if (p < end && *p == '-') signsubscale = -1, p++;
+		while (p < end && *p >= '0' && *p <= '9') {
+			subscale = (subscale * 10) + (*p++ - '0');
+		}
+	}
+	*val = sign * n * pow(10.0, (scale + subscale * signsubscale));
+	return p;
+}
+
+void json_reader_init(json_reader_t* r, const char* text, uint16_t len)
+{
+	memset(r, 0, sizeof(json_reader_t));
+	r->pos = text;
+	r->end = text + len;
+}
+
+/* next token of the first value in the text */
+json_token_e json_next(json_reader_t* r)
+{
+	const char* p = json_skip_space(r->pos, r->end);
+	const char* end = r->end;
+	json_token_e tok;
+
+	r->key = NULL;
+	r->key_len = 0;
+	if (r->depth == 0 && r->members[0]) {
+		return JSON_DONE;
+	}
+	if (p >= end) {
+		return JSON_ERROR;
+	}
+
+	if (r->depth) {
+		/* close, or separator before the next member */
+		if (*p == (r->in_object[r->depth] ? '}' : ']')) {
+			r->pos = p + 1;
+			return r->in_object[r->depth--] ? JSON_OBJECT_END : JSON_ARRAY_END;
+		}
+		if (r->members[r->depth]) {
+			if (*p != ',') {
+				return JSON_ERROR;
+			}
+			p = json_skip_space(p + 1, end);
+		}
+		if (r->in_object[r->depth]) {
+			if (p >= end || *p != '\"') {
+				return JSON_ERROR;
+			}
+			p = json_scan_string(p, end, &r->key, &r->key_len);
+			if (p == NULL) {
+				return JSON_ERROR;
+			}
+			p = json_skip_space(p, end);
+			if (p >= end || *p != ':') {
+				return JSON_ERROR;
+			}
+			p = json_skip_space(p + 1, end);
+		}
+		if (p >= end) {
+			return JSON_ERROR;
+		}
+	}
+
+	if (r->members[r->depth] < 0xFF) {
+		r->members[r->depth]++;
+	}
+	if (*p == '{' || *p == '[') {
+		if (r->depth + 1 >= JSON_MAX_DEPTH) {
+			return JSON_ERROR;
+		}
+		r->depth++;
+		r->in_object[r->depth] = (*p == '{');
+		r->members[r->depth] = 0;
+		tok = (*p == '{') ? JSON_OBJECT_BEGIN : JSON_ARRAY_BEGIN;
+		p++;
+	}
+	else if (*p == '\"') {
+		p = json_scan_string(p, end, &r->str, &r->str_len);
+		if (p == NULL) {
+			return JSON_ERROR;
+		}
+		tok = JSON_STRING;
+	}
+	else if (*p == '-' || (*p >= '0' && *p <= '9')) {
+		p = json_scan_number(p, end, &r->num);
+		tok = JSON_NUMBER;
+	}
+	else if (end - p >= 4 && !strncmp(p, "null", 4)) {
+		p += 4;
+		tok = JSON_NULL;
+	}
+	else if (end - p >= 5 && !strncmp(p, "false", 5)) {
+		p += 5;
+		tok = JSON_FALSE;
+	}
+	else if (end - p >= 4 && !strncmp(p, "true", 4)) {
+		p += 4;
+		tok = JSON_TRUE;
+	}
+	else {
+		return JSON_ERROR;
+	}
+	r->pos = p;
+	return tok;
+}
+
+/* step over the rest of a value whose first token was tok, 0 on a syntax error */
+int json_skip(json_reader_t* r, json_token_e tok)
+{
+	uint8_t depth = r->depth;
+
+	if (tok == JSON_ERROR) {
+		return 0;
+	}
+	if (tok != JSON_OBJECT_BEGIN && tok != JSON_ARRAY_BEGIN) {
+		return 1;
+	}
+	while (r->depth >= depth) {
+		if (json_next(r) == JSON_ERROR) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+static int json_tolower(int c)
+{
+	if ((c >= 'A') && (c <= 'Z'))
+		return c + ('a' - 'A');
+	return c;
+}
+
+/* member name of the current token equals name, ignoring case like cJSON_GetObjectItem */
+int json_key_is(const json_reader_t* r, const char* name)
+{
+	uint16_t i;
+
+	if (r->key == NULL) {
+		return 0;
+	}
+	for (i = 0; i < r->key_len; i++) {
+		if (name[i] == '\0' || json_tolower(r->key[i]) != json_tolower(name[i])) {
+			return 0;
+		}
+	}
+	return name[i] == '\0';
+}
+
+/* decode the escapes of a raw string into out, returns the length or -1 if it does not fit */
+int json_string_copy(const char* raw, uint16_t len, char* out, uint16_t size)
+{
+	const char* end = raw + len;
+	uint16_t n = 0;
+	unsigned uc;
+	char c;
+	int i;
+
+	while (raw < end) {
+		c = *raw++;
+		if (c == '\\' && raw < end) {
+			c = *raw++;
+			switch (c) {
+			case 'b': c = '\b'; break;
+			case 'f': c = '\f'; break;
+			case 'n': c = '\n'; break;
+			case 'r': c = '\r'; break;
+			case 't': c = '\t'; break;
+			case 'u':
+				/* only the ascii range, as written by json_put_quoted */
+				for (uc = 0, i = 0; i < 4 && raw < end; i++, raw++) {
+					uc = uc * 16 + (unsigned)(*raw <= '9' ? *raw - '0' : (*raw | 0x20) - 'a' + 10);
+				}
+				c = uc < 0x80 ? (char)uc : '?';
+				break;
+			default:
+				break;
+			}
+		}
+		if (n + 1 >= size) {
+			return -1;
+		}
+		out[n++] = c;
+	}
+	if (size) {
+		out[n] = '\0';
+	}
+	return n;
+}
@@ -1,6 +1,8 @@
 
 #include <string.h>
 #include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
 
 #include "utils.h"
 #include "nav_math.h"
@@ -8,51 +10,325 @@
 extern void ecef2enu(const double *pos, const double *r, double *e);
 extern double norm(const double* a, int n);
 
-extern int print_rmc(gtime_t time, double *ecef,int fixID,char *buff);
 extern int print_gsv(unsigned char *buff, int fixID, sky_view_t *rov);
 
-void fifo_init(fifo_type* fifo, uint8_t* buffer, uint16_t size)
+/* order the data copy before the index that publishes it, and the index read
+   before the data it covers (ISR/task or DMA on the other side) */
+#define FIFO_BARRIER() __sync_synchronize()
+
+/* size has to be a power of two, FIFO_SIZE_CHECK() it where the buffer is
+   declared. any other size fails and is rounded down to the largest power of
+   two that fits, so a caller that ignores the failure still has a working
+   fifo over the start of the buffer. below 2 the fifo stores nothing, every
+   push is counted in overflow */
+int fifo_init(fifo_type* fifo, uint8_t* buffer, uint16_t size)
 {
+	int ret = 0;
+
 	fifo->buffer = buffer;
 	fifo->in = 0;
 	fifo->out = 0;
+	fifo->overflow = 0;
+	if (!FIFO_SIZE_VALID(size)) {
+		ret = -1;
+		if (size < 2) {
+			size = 1;
+		}
+		while (!FIFO_SIZE_VALID(size) && size > 1) {
+			size &= size - 1;	// drop the lowest set bit
+		}
+	}
 	fifo->size = size;
+	return ret;
 }
 
-void fifo_push(fifo_type* fifo, uint8_t* buffer, uint16_t size)
+uint16_t fifo_status(fifo_type* fifo)
 {
-	uint16_t i;
+	return (uint16_t)(fifo->in - fifo->out) & (fifo->size - 1);
+}
 
-    for (i = 0; i < size; i++)
-    {
-        fifo->buffer[(fifo->in+i)%fifo->size] = buffer[i];
-    }
-    fifo->in = (fifo->in + size)%fifo->size;
+uint16_t fifo_space(fifo_type* fifo)
+{
+	return (uint16_t)(fifo->out - fifo->in - 1) & (fifo->size - 1);
+}
+
+/* push as much as fits, the rest is dropped and counted in fifo->overflow */
+uint16_t fifo_push(fifo_type* fifo, uint8_t* buffer, uint16_t size)
+{
+	uint16_t in = fifo->in;
+	uint16_t space = fifo_space(fifo);
+	uint16_t first;
+
+	if (size > space) {
+		fifo->overflow += size - space;
+		size = space;
+	}
+	first = fifo->size - in;
+	if (first > size) {
+		first = size;
+	}
+	memcpy(fifo->buffer + in, buffer, first);
+	memcpy(fifo->buffer, buffer + first, size - first);
+
+	FIFO_BARRIER();
+	fifo->in = (in + size) & (fifo->size - 1);
+	return size;
 }
 
 uint16_t fifo_get(fifo_type* fifo, uint8_t* buffer, uint16_t len)
 {
-	uint16_t lenght;
-	uint16_t in = fifo->in;	
-	uint16_t i;
-	lenght = (in + fifo->size - fifo->out)%fifo->size;
+	uint16_t out = fifo->out;
+	uint16_t lenght = fifo_status(fifo);
+	uint16_t first;
+
+	FIFO_BARRIER();
 	if(lenght > len)
 		lenght = len;
-	for(i = 0; i < lenght; i++)
-	{
-		buffer[i] = fifo->buffer[(fifo->out + i)%fifo->size];
+	first = fifo->size - out;
+	if (first > lenght) {
+		first = lenght;
 	}
-	fifo->out = (fifo->out + lenght)%fifo->size;
+	memcpy(buffer, fifo->buffer + out, first);
+	memcpy(buffer + first, fifo->buffer, lenght - first);
+
+	FIFO_BARRIER();
+	fifo->out = (out + lenght) & (fifo->size - 1);
 	return lenght;
 }
 
-uint16_t fifo_status(fifo_type* fifo)
+/* contiguous readable span at the tail, released with fifo_commit() */
+uint16_t fifo_peek(fifo_type* fifo, uint8_t** data)
 {
-	uint16_t lenght;
-	lenght = (fifo->in + fifo->size - fifo->out)%fifo->size;
+	uint16_t out = fifo->out;
+	uint16_t lenght = fifo_status(fifo);
+
+	FIFO_BARRIER();
+	if (lenght > fifo->size - out) {
+		lenght = fifo->size - out;
+	}
+	*data = fifo->buffer + out;
 	return lenght;
 }
 
+void fifo_commit(fifo_type* fifo, uint16_t len)
+{
+	FIFO_BARRIER();
+	fifo->out = (fifo->out + len) & (fifo->size - 1);
+}
+
+/* contiguous writable span at the head, made visible with fifo_publish() */
+uint16_t fifo_reserve(fifo_type* fifo, uint8_t** data)
+{
+	uint16_t in = fifo->in;
+	uint16_t space = fifo_space(fifo);
+
+	if (space > fifo->size - in) {
+		space = fifo->size - in;
+	}
+	*data = fifo->buffer + in;
+	return space;
+}
+
+void fifo_publish(fifo_type* fifo, uint16_t len)
+{
+	FIFO_BARRIER();
+	fifo->in = (fifo->in + len) & (fifo->size - 1);
+}
+
+
+/* sentence builder: writes never go past size - 1 and the text stays terminated */
+void sentence_begin(sentence_t* s, char* buf, uint16_t size)
+{
+	s->buf = buf;
+	s->len = 0;
+	s->size = size;
+	s->sum = 0;
+	buf[0] = 0;
+}
+
+/* copy and checksum in one pass, short pieces are the common case */
+void sentence_bytes(sentence_t* s, const uint8_t* data, uint16_t len)
+{
+	char* p = s->buf + s->len;
+	uint8_t sum = s->sum;   /* in a local, data may alias the struct */
+	uint16_t i;
+
+	if (len > s->size - 1 - s->len) {
+		len = s->size - 1 - s->len;
+	}
+	for (i = 0; i < len; i++) {
+		sum ^= data[i];
+		p[i] = (char)data[i];
+	}
+	p[len] = 0;
+	s->len += len;
+	s->sum = sum;
+}
+
+void sentence_str(sentence_t* s, const char* str)
+{
+	char* p = s->buf + s->len;
+	char* end = s->buf + s->size - 1;
+	uint8_t sum = s->sum;
+
+	while (*str && p < end) {
+		sum ^= (uint8_t)*str;
+		*p++ = *str++;
+	}
+	*p = 0;
+	s->len = (uint16_t)(p - s->buf);
+	s->sum = sum;
+}
+
+/* same text as printf("%0*u") */
+void sentence_uint(sentence_t* s, uint32_t val, int width)
+{
+	char tmp[12];
+	int n = 0;
+
+	do {
+		tmp[sizeof(tmp) - 1 - n++] = '0' + val % 10;
+		val /= 10;
+	} while (val);
+	while (n < width && n < (int)sizeof(tmp)) {
+		tmp[sizeof(tmp) - 1 - n++] = '0';
+	}
+	sentence_bytes(s, (const uint8_t*)tmp + sizeof(tmp) - n, (uint16_t)n);
+}
+
+/* snprintf fallback of put_fixed, printed in place so the text is only cut at
+   size - 1 as by any other write: %f of a large double runs to 300 digits */
+static void put_printf(sentence_t* s, double val, int width, int prec, char pad)
+{
+	char* p = s->buf + s->len;
+	int room = s->size - s->len;
+	uint8_t sum = s->sum;
+	int i, n;
+
+	n = snprintf(p, room, pad == '0' ? "%0*.*f" : "%*.*f", width, prec, val);
+	if (n < 0) {
+		n = 0;
+	}
+	else if (n > room - 1) {
+		n = room - 1;
+	}
+	p[n] = 0;
+	for (i = 0; i < n; i++) {
+		sum ^= (uint8_t)p[i];
+	}
+	s->len += n;
+	s->sum = sum;
+}
+
+/* same text as printf("%*.*f"), or "%0*.*f" with pad '0': the fraction of
+   the double is an exact binary fraction m / 2^k, digits are taken as
+   m * 10 / 2^k = m * 5 / 2^(k-1) in integers, so the digits and the
+   round-half-even tie are those of a correctly rounded printf. values out of
+   range fall back to snprintf */
+static void put_fixed(sentence_t* s, double val, int width, int prec, char pad)
+{
+	char tmp[32];
+	double x = fabs(val);
+	double ip = floor(x);
+	double fp = x - ip;
+	uint64_t m = 0, ipart, fpart = 0, scale = 1;
+	int e, k = 64, i, n = 0, up = 0;
+
+	if (!(x < 4294967296.0) || prec > 9) {
+		put_printf(s, val, width, prec, pad);
+		return;
+	}
+	ipart = (uint64_t)ip;
+
+	if (fp > 0.0) {
+		m = (uint64_t)ldexp(frexp(fp, &e), 53);
+		k = 53 - e;
+	}
+	for (i = 0; i < prec; i++) {
+		if (m >= ((uint64_t)1 << 60)) {
+			put_printf(s, val, width, prec, pad);
+			return;
+		}
+		m *= 5;
+		k--;
+		fpart *= 10;
+		if (k < 64) {
+			fpart += m >> k;
+			m &= ((uint64_t)1 << k) - 1;
+		}
+		scale *= 10;
+	}
+	if (m != 0 && k < 64) {
+		if (m > ((uint64_t)1 << (k - 1))) {
+			up = 1;
+		}
+		else if (m == ((uint64_t)1 << (k - 1))) {
+			up = prec ? (int)(fpart & 1) : (int)(ipart & 1);
+		}
+	}
+	if (up && ++fpart == scale) {
+		fpart = 0;
+		ipart++;
+	}
+
+	/* digits right to left */
+	for (i = 0; i < prec; i++) {
+		tmp[sizeof(tmp) - 1 - n++] = '0' + fpart % 10;
+		fpart /= 10;
+	}
+	if (prec) {
+		tmp[sizeof(tmp) - 1 - n++] = '.';
+	}
+	do {
+		tmp[sizeof(tmp) - 1 - n++] = '0' + ipart % 10;
+		ipart /= 10;
+	} while (ipart);
+	if (pad == '0') {
+		while (n < width - (signbit(val) ? 1 : 0) && n < (int)sizeof(tmp) - 1) {
+			tmp[sizeof(tmp) - 1 - n++] = '0';
+		}
+	}
+	if (signbit(val)) {
+		tmp[sizeof(tmp) - 1 - n++] = '-';
+	}
+	while (n < width && n < (int)sizeof(tmp)) {
+		tmp[sizeof(tmp) - 1 - n++] = ' ';
+	}
+	sentence_bytes(s, (const uint8_t*)tmp + sizeof(tmp) - n, (uint16_t)n);
+}
+
+void sentence_fixed(sentence_t* s, double val, int width, int prec)
+{
+	put_fixed(s, val, width, prec, ' ');
+}
+
+/* same text as printf("%0*.*f") */
+void sentence_zfixed(sentence_t* s, double val, int width, int prec)
+{
+	put_fixed(s, val, width, prec, '0');
+}
+
+static uint16_t put_end(sentence_t* s, const char* sep, const char* hex)
+{
+	uint8_t sum = s->sum;
+	const char tail[5] = { hex[sum >> 4], hex[sum & 0x0F], '\r', '\n', 0 };
+
+	sentence_str(s, sep);
+	sentence_str(s, tail);
+	return s->len;
+}
+
+/* append sep, the checksum as two hex digits and CR LF, return the sentence length */
+uint16_t sentence_end(sentence_t* s, const char* sep)
+{
+	return put_end(s, sep, "0123456789abcdef");
+}
+
+/* as sentence_end, upper case hex digits as the nmea sentences have them */
+uint16_t sentence_end_upper(sentence_t* s, const char* sep)
+{
+	return put_end(s, sep, "0123456789ABCDEF");
+}
 
 char *i2a(int num, char *str, int radix)
 {
@@ -100,19 +376,19 @@ void float2arr(double data, char *a, unsigned char id, unsigned char dd)
 
     if (id == 0)
     {
-        if (abs(data) < 10)
+        if (fabs(data) < 10)
         {
             id = 1;
         }
-        else if (abs(data) < 100)
+        else if (fabs(data) < 100)
         {
             id = 2;
         }
-        else if (abs(data) < 1000)
+        else if (fabs(data) < 1000)
         {
             id = 3;
         }
-        else if (abs(data) < 10000)
+        else if (fabs(data) < 10000)
         {
             id = 4;
         }
@@ -167,20 +443,16 @@ int print_nmea_gga(double *ep, double *xyz, int nsat, int type, double dop,
 	double age, char *buff)
 {
 	double h, pos[3], dms1[3], dms2[3];
-	char *p = (char *)buff, *q, sum;
 	char buf[20] = {0};
+	sentence_t s;
+
+	sentence_begin(&s, buff, NMEA_GGA_MAXLEN);
+	sentence_str(&s, "$");
+	s.sum = 0; /* nmea check-sum excludes '$' */
 
 	if ((xyz[0] * xyz[0] + xyz[1] * xyz[1] + xyz[2] * xyz[2]) < 1.0)
 	{
-		strcpy(buff,"$GPGGA,,,,,,,,,,,,,,");
-		for (q = (char *)buff + 1, sum = 0; *q; q++)
-			sum ^= *q;
-		strcat(buff, "*");
-		memset(buf, 0, 20);
-		i2a(sum, buf, 16);
-		strcat(buff, buf);
-		strcat(buff, "\r\n");
-
+		sentence_str(&s, "GPGGA,,,,,,,,,,,,,,");
 	}
 	else
 	{
@@ -189,65 +461,61 @@ int print_nmea_gga(double *ep, double *xyz, int nsat, int type, double dop,
 		deg2dms(fabs(pos[0]) * RAD_TO_DEG, dms1, 7);
 		deg2dms(fabs(pos[1]) * RAD_TO_DEG, dms2, 7);
 
-		strcpy(buff,"$GPGGA,");
+		sentence_str(&s, "GPGGA,");
 
 		float2arr(ep[3] * 10000 + ep[4] * 100 + ep[5] + 0.001, buf, 6, 2);
-		strcat(buff, buf);
-		strcat(buff, ",");
+		sentence_str(&s, buf);
+		sentence_str(&s, ",");
 
 		memset(buf, 0, 20);
 		float2arr(dms1[0] * 100 + dms1[1] + dms1[2] / 60.0, buf, 4, 7);
-		strcat(buff, buf);
-		strcat(buff, pos[0] >= 0 ? ",N," : ",S,");
+		sentence_str(&s, buf);
+		sentence_str(&s, pos[0] >= 0 ? ",N," : ",S,");
 
 		memset(buf, 0, 20);
 		float2arr(dms2[0] * 100 + dms2[1] + dms2[2] / 60.0, buf, 5, 7);
-		strcat(buff, buf);
-		strcat(buff, pos[1] >= 0 ? ",E," : ",W,");
+		sentence_str(&s, buf);
+		sentence_str(&s, pos[1] >= 0 ? ",E," : ",W,");
 
 		memset(buf, 0, 20);
 		// float2arr(type,buf,1,0);
 		i2a(type, buf, 10);
-		strcat(buff, buf);
-		strcat(buff, ",");
+		sentence_str(&s, buf);
+		sentence_str(&s, ",");
 
 		memset(buf, 0, 20);
 		float2arr(nsat, buf, 2, 0);
 		buf[2] = 0;
-		strcat(buff, buf);
-		strcat(buff, ",");
+		sentence_str(&s, buf);
+		sentence_str(&s, ",");
 
 		memset(buf, 0, 20);
 		float2arr(dop, buf, 0, 1);
-		strcat(buff, buf);
-		strcat(buff, ",");
+		sentence_str(&s, buf);
+		sentence_str(&s, ",");
 
 		memset(buf, 0, 20);
 		float2arr(pos[2] - h, buf, 0, 3);
-		strcat(buff, buf);
-		strcat(buff, ",M,");
+		sentence_str(&s, buf);
+		sentence_str(&s, ",M,");
 
 		memset(buf, 0, 20);
 		float2arr(h, buf, 0, 3);
-		strcat(buff, buf);
-		strcat(buff, ",M,");
+		sentence_str(&s, buf);
+		sentence_str(&s, ",M,");
 
 		memset(buf, 0, 20);
 		float2arr(age, buf, 0, 1);
-		strcat(buff, buf);
-		strcat(buff, ",");
-
-		for (q = (char *)buff + 1, sum = 0; *q; q++)
-			sum ^= *q; /* check-sum */
-
-		strcat(buff, "*");
-		memset(buf, 0, 20);
-		i2a(sum, buf, 16);
-		strcat(buff, buf);
-
-		strcat(buff, "\r\n");
+		sentence_str(&s, buf);
+		sentence_str(&s, ",");
 	}
-	return strlen(buff);
+	memset(buf, 0, 20);
+	i2a((char)s.sum, buf, 16);
+	sentence_str(&s, "*");
+	sentence_str(&s, buf);
+	sentence_str(&s, "\r\n");
+
+	return s.len;
 }
 
 int print_pos_gga(gtime_t time, double *pos, int num_of_sat, int fixID,
@@ -278,13 +546,16 @@ extern int print_rmc(gtime_t time, double *ecef,int fixID,char *buff)
     static double dirp = 0.0;
     gtime_t ut;
     double ep[6],pos[3],enuv[3],dms1[3],dms2[3],vel,dir,amag=0.0;
-    char *p = buff,*q,sum,*emag = "E";
+    char *emag = "E";
+    sentence_t s;
+
+    sentence_begin(&s, buff, NMEA_RMC_MAXLEN);
+    sentence_str(&s, "$");
+    s.sum = 0; /* nmea check-sum excludes '$' */
 
     if (fixID<=0) {
-        p+=sprintf(p,"$GPRMC,,,,,,,,,,,,");
-        for (q=(char *)buff+1,sum=0;*q;q++) sum^=*q;
-        p+=sprintf(p,"*%02X%c%c",sum,0x0D,0x0A);
-        return p-(char *)buff;
+        sentence_str(&s, "GPRMC,,,,,,,,,,,,");
+        return sentence_end_upper(&s, "*");
     }
     ut=gpst2utc(time);
     if (ut.sec>=0.995) {ut.time++; ut.sec=0.0;}
@@ -300,15 +571,35 @@ extern int print_rmc(gtime_t time, double *ecef,int fixID,char *buff)
     else dir=dirp;
     deg2dms(fabs(pos[0])*R2D,dms1,7);
     deg2dms(fabs(pos[1])*R2D,dms2,7);
-    p+=sprintf(p,"$GPRMC,%02.0f%02.0f%05.2f,A,%02.0f%010.7f,%s,%03.0f%010.7f,%s,%4.2f,%4.2f,%02.0f%02.0f%02d,%.1f,%s,%s",
-               ep[3],ep[4],ep[5],dms1[0],dms1[1]+dms1[2]/60.0,pos[0]>=0?"N":"S",
-               dms2[0],dms2[1]+dms2[2]/60.0,pos[1]>=0?"E":"W",vel/KNOT2M,dir,
-               ep[2],ep[1],(int)ep[0]%100,amag,emag,
-               fixID == 4 || fixID == 5?"D":"A");
+
+    /* same text as "%02.0f%02.0f%05.2f,A,%02.0f%010.7f,%s,%03.0f%010.7f,%s,
+       %4.2f,%4.2f,%02.0f%02.0f%02d,%.1f,%s,%s" */
+    sentence_str(&s, "GPRMC,");
+    sentence_zfixed(&s, ep[3], 2, 0);
+    sentence_zfixed(&s, ep[4], 2, 0);
+    sentence_zfixed(&s, ep[5], 5, 2);
+    sentence_str(&s, ",A,");
+    sentence_zfixed(&s, dms1[0], 2, 0);
+    sentence_zfixed(&s, dms1[1]+dms1[2]/60.0, 10, 7);
+    sentence_str(&s, pos[0]>=0 ? ",N," : ",S,");
+    sentence_zfixed(&s, dms2[0], 3, 0);
+    sentence_zfixed(&s, dms2[1]+dms2[2]/60.0, 10, 7);
+    sentence_str(&s, pos[1]>=0 ? ",E," : ",W,");
+    sentence_fixed(&s, vel/KNOT2M, 4, 2);
+    sentence_str(&s, ",");
+    sentence_fixed(&s, dir, 4, 2);
+    sentence_str(&s, ",");
+    sentence_zfixed(&s, ep[2], 2, 0);
+    sentence_zfixed(&s, ep[1], 2, 0);
+    sentence_uint(&s, (uint32_t)((int)ep[0]%100), 2);
+    sentence_str(&s, ",");
+    sentence_fixed(&s, amag, 0, 1);
+    sentence_str(&s, ",");
+    sentence_str(&s, emag);
+    sentence_str(&s, ",");
+    sentence_str(&s, fixID == 4 || fixID == 5 ? "D" : "A");
             //    sol->stat==SOLQ_DGPS||sol->stat==SOLQ_FLOAT||sol->stat==SOLQ_FIX?"D":"A");
-    for (q=(char *)buff+1,sum=0;*q;q++) sum^=*q; /* check-sum */
-    p+=sprintf(p,"*%02X%c%c",sum,0x0D,0x0A);
-    return p-(char *)buff;
+    return sentence_end_upper(&s, "*");
 }
 /* output solution in the form of nmea GSV sentence --------------------------*/
 extern int print_gsv(unsigned char *buff, int fixID, sky_view_t *rov)
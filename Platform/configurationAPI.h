@@ -44,7 +44,7 @@ uint16_t configGetOrientation(void);
 int      configGetAccelLfpFreq();
 int      configGetRateLfpFreq();
 uint16_t configGetPrefilterFreq();
-BOOL     configSelectUserLPFilter(int sensor, int cutoffFreq, BOOL fApply);
+BOOL     configSelectUserLPFilter(int sensor, int cutoffFreq, BOOL fApply); // USER_LPF_FIR in filter.h
 int      configApplyOrientation(uint16_t orientation);
 uint16_t configGetUsedChips(void);
 uint16_t configGetActiveChips(void);
@@ -421,6 +421,7 @@ typedef struct
 	unsigned char smooth;                  /* divergence free smoothing indicator */
 	unsigned char tint_s;                  /* soothing interval */
 	unsigned char nsat, nsig;              /* number of satellites/signals */
+	unsigned int sigmask;                  /* signal mask */
 	unsigned char sats[64];                /* satellites */
 	unsigned char sigs[32];                /* signals */
 	unsigned char cellmask[64];            /* cell mask */
@@ -433,6 +434,132 @@ typedef struct {                        /* rtcm data struct */
 	double time;
 } gnss_rtcm_t;
 
+typedef struct {                        /* observation epoch assembler, double buffered */
+	obs_t buf[2];                          /* epoch buffers, the decoder fills buf[front^1] */
+	volatile unsigned int front;           /* buffer of the last complete epoch */
+	volatile unsigned int seq;             /* number of complete epochs published */
+	unsigned int npartial;                 /* epochs dropped before completion */
+	unsigned int nmsg;                     /* obs messages of the epoch being filled */
+	unsigned int nmsg_last;                /* obs messages of the published epoch */
+	unsigned int nmsg_max;                 /* most obs messages of a published epoch */
+	unsigned int nshort;                   /* epochs published with fewer than nmsg_max */
+	int64_t first_us;                      /* now_gps() at the first message of the epoch */
+	unsigned int age_us_last;              /* published epoch: now_gps() minus epoch time */
+	unsigned int age_us_max;
+	uint64_t age_us_sum;                   /* over seq epochs */
+	unsigned int span_us_last;             /* published epoch: first to last message */
+	unsigned int span_us_max;
+} obsepoch_t;
+
+#define RTCM_STAT_NTYPE 13                /* 1004,1012,1019,1020,1042,1045,1046,999,msm4-7,other */
+
+typedef struct {                        /* rtcm decoder statistics, opt-in per station */
+	unsigned int nbyte;                    /* number of input bytes */
+	unsigned int nmsg;                     /* number of decoded messages */
+	unsigned int nerr;                     /* number of parity errors */
+	unsigned int ntype[RTCM_STAT_NTYPE];   /* decoded messages by type (see rtcm_stat_index) */
+	unsigned int maxobs;                   /* peak obs->n */
+	unsigned int maxeph;                   /* peak nav->n */
+	unsigned int maxgeph;                  /* peak nav->ng */
+} rtcm_stat_t;
+
+typedef struct {                        /* slot age list (oldest at head) */
+	unsigned char n;                       /* number of linked slots (0..n-1) */
+	unsigned char head, tail;              /* oldest/newest slot (0xFF: empty) */
+	unsigned char prev[MAXEPH];            /* previous (older) slot */
+	unsigned char next[MAXEPH];            /* next (newer) slot */
+} slotage_t;
+
+typedef struct {                        /* satellite to obs->data slot index of a receiver */
+	unsigned char obs[MAXSAT];             /* sat -> slot in the obs buffer being filled */
+} satslot_t;
+
+typedef struct {                        /* satellite to slot index of a nav_t, shared by its receivers */
+	const nav_t *nav;                      /* nav indexed (NULL: rebuild on next use) */
+	unsigned char eph[MAXSAT];             /* sat -> nav.eph slot */
+	unsigned char geph[MAXSAT];            /* sat -> nav.geph slot */
+	unsigned char ephsat[MAXEPH];          /* sat of each nav.eph slot when it was indexed */
+	unsigned char gephsat[MAXEPH_R];       /* sat of each nav.geph slot when it was indexed */
+	slotage_t ephage;                      /* nav.eph slots by update age */
+	slotage_t gephage;                     /* nav.geph slots by update age */
+} navslot_t;
+
+typedef struct {                        /* pool stream state read rarely, taken on first use */
+	char msmtype[6][128];                  /* msm signal types, as rtcm_t.msmtype */
+	st_pvt_type999_t st_pvt;               /* last type 999 pvt (subtype 4) */
+	st_epvt_type999_t st_epvt;             /* last type 999 extended pvt (subtype 21) */
+	char antdes[32];                       /* antenna descriptor (1007/1008/1033) */
+	char antsno[32];                       /* antenna serial number (1008/1033) */
+	char rectype[32];                      /* receiver type descriptor (1033) */
+	char recver[32];                       /* receiver firmware version (1033) */
+	char recsno[32];                       /* receiver serial number (1033) */
+	int antsetup;                          /* antenna setup id */
+} rtcmcold_t;
+
+typedef struct {                        /* cold state blocks of a pool, handed out on first use */
+	rtcmcold_t *cold;                      /* blocks (cold[n]) */
+	unsigned int n;                        /* number of blocks */
+	unsigned int nused;                    /* blocks taken by streams */
+	unsigned int nmiss;                    /* rare messages not kept, no block left */
+} rtcmcoldpool_t;
+
+typedef struct {                        /* time adjustment of a message header */
+	gtime_t in;                            /* message time before the adjustment */
+	double t;                              /* tow/tod adjusted to */
+	gtime_t out;                           /* message time after it */
+} timememo_t;
+
+typedef struct {                        /* time adjustment memo of a receiver, see rtcm_attach_memo() */
+	timememo_t week;                       /* last adjweek(), gps/gal/qzs/bds tow */
+	timememo_t day;                        /* last adjday_glot(), glonass tod */
+	unsigned int nhit;                     /* headers adjusted from the memo */
+	unsigned int nmiss;                    /* headers adjusted by the time conversions */
+} rtcmmemo_t;
+
+typedef struct {                        /* utc time of day of a gps second, see utc_tod() */
+	time_t sec;                            /* gps second (-1: none) */
+	int leaps;                             /* leap seconds applied */
+	double tow;                            /* time of week of sec */
+	double hhmm;                           /* hours and minutes of the utc second as hhmm00 */
+	int ss;                                /* seconds of the utc second */
+} utctod_t;
+
+typedef struct {                        /* pool stream state every message touches */
+	gtime_t time;                          /* message time */
+	unsigned short lock[MAXSAT][NFREQ+NEXOBS]; /* lock time */
+	unsigned int nbyte;                    /* bytes of the partial frame */
+	unsigned char buff[1200];              /* partial frame */
+	rtcmmemo_t memo;                       /* time adjustment memo */
+	rtcmcold_t *cold;                      /* cold state (NULL: none taken yet) */
+} rtcmhot_t;
+
+typedef struct {                        /* rtcm receiver: a decoder and the data it decodes into */
+	rtcm_t *rtcm;                          /* decoder state */
+	obs_t  *obs;                           /* observation data */
+	nav_t  *nav;                           /* navigation data, may be shared by receivers */
+	satslot_t *slot;                       /* obs slot index (NULL: none) */
+	navslot_t *navslot;                    /* nav slot index, shared like nav (NULL: none) */
+	rtcm_stat_t *stat;                     /* decoder statistics (NULL: none) */
+	obsepoch_t *ep;                        /* epoch assembler, replaces obs (NULL: none) */
+	rtcmmemo_t *memo;                      /* time adjustment memo (NULL: none) */
+	rtcmhot_t *hot;                        /* pool stream decoded for (NULL: not a pool stream) */
+	rtcmcoldpool_t *coldpool;              /* cold blocks of that pool */
+} rtcmrcv_t;
+
+typedef struct {                        /* decoder pool of network stations, opt-in beside gnss_rtcm_t */
+	unsigned int n;                        /* number of streams */
+	rtcm_t *work;                          /* decoder state a stream is swapped into to decode */
+	unsigned int cur;                      /* stream in work, its hot state is stale (n: none) */
+	rtcmhot_t *hot;                        /* hot state of each stream (hot[n]) */
+	obs_t  *obs;                           /* observation data of each stream (obs[n]) */
+	nav_t  *nav;                           /* navigation data shared by all streams */
+	rtcmcoldpool_t cold;                   /* cold state blocks (none: rare messages not kept) */
+	satslot_t *slot;                       /* obs slot index of each stream (slot[n], NULL: none) */
+	navslot_t *navslot;                    /* nav slot index (NULL: none) */
+	rtcm_stat_t *stat;                     /* decoder statistics of each stream (stat[n], NULL: none) */
+	unsigned int last;                     /* stream of the last station lookup */
+} rtcmpool_t;
+
 
 /* ssr update intervals ------------------------------------------------------*/
 static const double ssrudint[16] = {
@@ -506,6 +633,7 @@ static const int codes_sbs[] = {
 extern void trace (int level, const char *format, ...);
 
 extern unsigned int rtcm_getbitu(const unsigned char *buff, int pos, int len);
+extern int rtcm_getbits(const unsigned char *buff, int pos, int len);
 extern void setbitu(unsigned char *buff, int pos, int len, unsigned int data);
 extern void rtcm_setbits_38(unsigned char *buff, int pos, double data);
 extern unsigned int rtk_crc24q(const unsigned char *buff, int len);
@@ -515,6 +643,8 @@ extern void set_glo_frq(unsigned char prn, int frq);
 extern int  get_glo_frq(unsigned char prn);
 extern void set_week_number(int week);
 extern int  get_week_number();
+extern void set_leap_seconds(int leaps);
+extern int  get_leap_seconds();
 
 /* time function */
 extern gtime_t timeadd(gtime_t t, double sec);
@@ -526,6 +656,7 @@ extern double  time2bdt(gtime_t t, int *week);
 extern double  time2gpst(gtime_t t, int *week);
 extern gtime_t utc2gpst(gtime_t t);
 extern gtime_t gpst2utc(gtime_t t);
+extern double  utc_tod(utctod_t *c, time_t sec, time_t msec);
 extern gtime_t gpst2time(int week, double sec);
 extern gtime_t gpst2bdt(gtime_t t);
 extern gtime_t bdt2gpst(gtime_t t);
@@ -543,9 +674,9 @@ extern char sys2char(int sys);
 extern double satwavelen(int sat, int frq);
 extern unsigned char obs2code(int sys, const char * obs, int * freq);
 extern int getcodepri(int sys, unsigned char code, const char * opt);
-static int add_obs(obsd_t* obsd, obs_t* obs);
-static int add_eph(eph_t* eph, nav_t* nav);
-static int add_geph(geph_t* eph, nav_t* nav);
+static int add_obs(obsd_t* obsd, obs_t* obs, satslot_t* slot);
+static int add_eph(eph_t* eph, nav_t* nav, navslot_t* ns);
+static int add_geph(geph_t* eph, nav_t* nav, navslot_t* ns);
 
 #ifdef __cplusplus
 }
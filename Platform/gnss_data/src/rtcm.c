@@ -9,10 +9,16 @@
 #include <stdlib.h>
 
 #include "rtcm.h"
-#include "gnss_data_api.h"
+#include "crc.h"
+#include "constants.h"
 #include "nav_math.h"
+#include "time_service.h"
+#include "event_trace.h"
+#ifdef DEBUG_ALL
 #include "uart.h"
 #include "tcp_driver.h"
+#include "utils.h"
+#endif
 
 #define SC2RAD 3.1415926535898 /* semi-circle to radian (IS-GPS) */
 #define AU 149597870691.0      /* 1 AU (m) */
@@ -22,10 +28,10 @@
 #define RTCM3PREAMB 0xD3 /* rtcm ver.3 frame preamble */
 
 static int decode_type4001(rtcm_t *rtcm);
-extern void OS_Delay(uint32_t msec);
 
 /* set the default week numner for real-time system without a UTC time */
 static uint16_t default_week_number = 2068;
+static volatile int leap_seconds = 18;     /* gps - utc (s), see set_leap_seconds() */
 static uint8_t dayofweek = 3;
 
 static int default_glo_frq_table[30] = {
@@ -33,9 +39,9 @@ static int default_glo_frq_table[30] = {
 	04, -3, 03, 02, 04, -3, 03, 02, 0, -5, -99, -99, -99, -99
 };
 
-const static double gpst0[] = { 1980, 1, 6, 0, 0, 0 }; /* gps time reference */
+static const double gpst0[] = { 1980, 1, 6, 0, 0, 0 }; /* gps time reference */
 //const static double gst0 []={1999,8,22,0,0,0}; /* galileo system time reference */
-const static double bdt0[] = { 2006, 1, 1, 0, 0, 0 }; /* beidou time reference */
+static const double bdt0[] = { 2006, 1, 1, 0, 0, 0 }; /* beidou time reference */
 
 static char *obscodes[] = {
 	/* observation code strings */
@@ -118,41 +124,6 @@ static unsigned char obsfreqs_irn[] = {
 	1, 1, 2, 2, 2, 2, 0, 0, 0, 0  /* 50-59 */
 };
 
-static const unsigned int tbl_CRC24Q[] = {
-	0x000000, 0x864CFB, 0x8AD50D, 0x0C99F6, 0x93E6E1, 0x15AA1A, 0x1933EC, 0x9F7F17,
-	0xA18139, 0x27CDC2, 0x2B5434, 0xAD18CF, 0x3267D8, 0xB42B23, 0xB8B2D5, 0x3EFE2E,
-	0xC54E89, 0x430272, 0x4F9B84, 0xC9D77F, 0x56A868, 0xD0E493, 0xDC7D65, 0x5A319E,
-	0x64CFB0, 0xE2834B, 0xEE1ABD, 0x685646, 0xF72951, 0x7165AA, 0x7DFC5C, 0xFBB0A7,
-	0x0CD1E9, 0x8A9D12, 0x8604E4, 0x00481F, 0x9F3708, 0x197BF3, 0x15E205, 0x93AEFE,
-	0xAD50D0, 0x2B1C2B, 0x2785DD, 0xA1C926, 0x3EB631, 0xB8FACA, 0xB4633C, 0x322FC7,
-	0xC99F60, 0x4FD39B, 0x434A6D, 0xC50696, 0x5A7981, 0xDC357A, 0xD0AC8C, 0x56E077,
-	0x681E59, 0xEE52A2, 0xE2CB54, 0x6487AF, 0xFBF8B8, 0x7DB443, 0x712DB5, 0xF7614E,
-	0x19A3D2, 0x9FEF29, 0x9376DF, 0x153A24, 0x8A4533, 0x0C09C8, 0x00903E, 0x86DCC5,
-	0xB822EB, 0x3E6E10, 0x32F7E6, 0xB4BB1D, 0x2BC40A, 0xAD88F1, 0xA11107, 0x275DFC,
-	0xDCED5B, 0x5AA1A0, 0x563856, 0xD074AD, 0x4F0BBA, 0xC94741, 0xC5DEB7, 0x43924C,
-	0x7D6C62, 0xFB2099, 0xF7B96F, 0x71F594, 0xEE8A83, 0x68C678, 0x645F8E, 0xE21375,
-	0x15723B, 0x933EC0, 0x9FA736, 0x19EBCD, 0x8694DA, 0x00D821, 0x0C41D7, 0x8A0D2C,
-	0xB4F302, 0x32BFF9, 0x3E260F, 0xB86AF4, 0x2715E3, 0xA15918, 0xADC0EE, 0x2B8C15,
-	0xD03CB2, 0x567049, 0x5AE9BF, 0xDCA544, 0x43DA53, 0xC596A8, 0xC90F5E, 0x4F43A5,
-	0x71BD8B, 0xF7F170, 0xFB6886, 0x7D247D, 0xE25B6A, 0x641791, 0x688E67, 0xEEC29C,
-	0x3347A4, 0xB50B5F, 0xB992A9, 0x3FDE52, 0xA0A145, 0x26EDBE, 0x2A7448, 0xAC38B3,
-	0x92C69D, 0x148A66, 0x181390, 0x9E5F6B, 0x01207C, 0x876C87, 0x8BF571, 0x0DB98A,
-	0xF6092D, 0x7045D6, 0x7CDC20, 0xFA90DB, 0x65EFCC, 0xE3A337, 0xEF3AC1, 0x69763A,
-	0x578814, 0xD1C4EF, 0xDD5D19, 0x5B11E2, 0xC46EF5, 0x42220E, 0x4EBBF8, 0xC8F703,
-	0x3F964D, 0xB9DAB6, 0xB54340, 0x330FBB, 0xAC70AC, 0x2A3C57, 0x26A5A1, 0xA0E95A,
-	0x9E1774, 0x185B8F, 0x14C279, 0x928E82, 0x0DF195, 0x8BBD6E, 0x872498, 0x016863,
-	0xFAD8C4, 0x7C943F, 0x700DC9, 0xF64132, 0x693E25, 0xEF72DE, 0xE3EB28, 0x65A7D3,
-	0x5B59FD, 0xDD1506, 0xD18CF0, 0x57C00B, 0xC8BF1C, 0x4EF3E7, 0x426A11, 0xC426EA,
-	0x2AE476, 0xACA88D, 0xA0317B, 0x267D80, 0xB90297, 0x3F4E6C, 0x33D79A, 0xB59B61,
-	0x8B654F, 0x0D29B4, 0x01B042, 0x87FCB9, 0x1883AE, 0x9ECF55, 0x9256A3, 0x141A58,
-	0xEFAAFF, 0x69E604, 0x657FF2, 0xE33309, 0x7C4C1E, 0xFA00E5, 0xF69913, 0x70D5E8,
-	0x4E2BC6, 0xC8673D, 0xC4FECB, 0x42B230, 0xDDCD27, 0x5B81DC, 0x57182A, 0xD154D1,
-	0x26359F, 0xA07964, 0xACE092, 0x2AAC69, 0xB5D37E, 0x339F85, 0x3F0673, 0xB94A88,
-	0x87B4A6, 0x01F85D, 0x0D61AB, 0x8B2D50, 0x145247, 0x921EBC, 0x9E874A, 0x18CBB1,
-	0xE37B16, 0x6537ED, 0x69AE1B, 0xEFE2E0, 0x709DF7, 0xF6D10C, 0xFA48FA, 0x7C0401,
-	0x42FA2F, 0xC4B6D4, 0xC82F22, 0x4E63D9, 0xD11CCE, 0x575035, 0x5BC9C3, 0xDD8538 
-};
-
 static char codepris[7][MAXFREQ][16] = {
 	/* code priority table */
 
@@ -188,7 +159,7 @@ extern int get_glo_frq(unsigned char prn)
 {
     int max_prn = sizeof(default_glo_frq_table) / sizeof(int);
     int frq = -99;
-    if (prn <= max_prn)
+    if (prn >= 1 && prn <= max_prn)
     {
         frq = default_glo_frq_table[prn - 1];
     }
@@ -206,6 +177,17 @@ extern int get_week_number()
     return default_week_number;
 }
 
+/* gps - utc leap seconds once they change, 0 (not known) keeps the current ones */
+extern void set_leap_seconds(int leaps)
+{
+    if (leaps > 0) leap_seconds = leaps;
+}
+
+extern int get_leap_seconds()
+{
+    return leap_seconds;
+}
+
 /* add time --------------------------------------------------------------------
 * add time to gtime_t struct
 * args   : gtime_t t        I   gtime_t struct
@@ -345,7 +327,7 @@ extern double time2gpst(gtime_t t, int *week)
 *-----------------------------------------------------------------------------*/
 extern gtime_t utc2gpst(gtime_t t)
 {
-    return timeadd(t, 18.0);
+    return timeadd(t, (double)leap_seconds);
 }
 
 /* gpstime to utc --------------------------------------------------------------
@@ -356,7 +338,47 @@ extern gtime_t utc2gpst(gtime_t t)
 *-----------------------------------------------------------------------------*/
 extern gtime_t gpst2utc(gtime_t t)
 {
-    return timeadd(t, -18.0);
+    return timeadd(t, -(double)leap_seconds);
+}
+
+/* utc time of day of a gps time -----------------------------------------------
+* gps time sec + msec as utc hhmmss.sss, the value of gpst2utc and time2epoch
+* of it. the utc second of day, leap seconds applied, is worked out when sec
+* or the leap seconds change and kept in the cache, the rest of the calls
+* only add the ms
+* args   : utctod_t *c      IO  cache (sec -1: empty)
+*          time_t sec       I   gps time (s), before the gps epoch the time of week
+*          time_t msec      I   ms of the second
+* return : hhmmss.sss
+*-----------------------------------------------------------------------------*/
+extern double utc_tod(utctod_t *c, time_t sec, time_t msec)
+{
+    gtime_t time;
+    double tow;
+    int week, leaps = leap_seconds, day_sec;
+
+    if (sec != c->sec || leaps != c->leaps)
+    {
+        time.time = sec;
+        time.sec = 0.0;
+        tow = time2gpst(time, &week);
+        if (tow < 0) {
+            week = 0;
+            tow = (double)sec;
+        }
+        time.time = gpst2time(week, 0.0).time + (time_t)tow - leaps;
+        day_sec = (int)(time.time - (time.time / 86400) * 86400);
+        c->sec = sec;
+        c->leaps = leaps;
+        c->tow = tow;
+        c->hhmm = (double)(day_sec / 3600) * 10000 + (double)(day_sec % 3600 / 60) * 100;
+        c->ss = day_sec % 60;
+    }
+    tow = c->tow + (double)msec / 1000;
+    time.time = 0;
+    time.sec = tow - (int)tow;
+    time = timeadd(time, -(double)c->leaps);  /* the fraction as gpst2utc leaves it */
+    return c->hhmm + (c->ss + time.sec) + 0.001;
 }
 
 /* gps time to time ------------------------------------------------------------
@@ -442,10 +464,46 @@ extern gtime_t timeget()
     return gpst2time(get_week_number(), 0.0);
 }
 
+/* time adjustment memo -------------------------------------------------------
+* the messages of an epoch repeat the same tow/tod, so each receiver keeps its
+* last adjustment and a repeated header costs a compare instead of the time
+* conversions. the first message of an epoch adjusts the time of the last one,
+* the rest the time it was adjusted to, so the memo matches either. the memo
+* is the one of the receiver being decoded: the gnss_rtcm_t stations and the
+* pool streams have their own, other receivers one attached by
+* rtcm_attach_memo(); without one every header is converted.
+*-----------------------------------------------------------------------------*/
+static rtcmmemo_t stnmemo[MAXSTN];      /* of the gnss_rtcm_t stations */
+static rtcmmemo_t *timememo = NULL;     /* of the receiver being decoded */
+
+static int timememo_hit(const timememo_t *memo, const gtime_t *time, double t)
+{
+    return memo->t == t && ((memo->in.time == time->time && memo->in.sec == time->sec) ||
+                            (memo->out.time == time->time && memo->out.sec == time->sec));
+}
+static void timememo_put(timememo_t *memo, gtime_t in, double t, gtime_t out)
+{
+    memo->in = in;
+    memo->t = t;
+    memo->out = out;
+    timememo->nmiss++;
+}
+/* attach/detach (memo=NULL) a time adjustment memo to a receiver ---------------
+* args   : rtcmrcv_t *rcv    IO  receiver
+*          rtcmmemo_t *memo  O   memo (NULL: detach, every header is converted)
+* return : none
+*-----------------------------------------------------------------------------*/
+extern void rtcm_attach_memo(rtcmrcv_t *rcv, rtcmmemo_t *memo)
+{
+    if (memo) memset(memo, 0, sizeof(rtcmmemo_t));
+    rcv->memo = memo;
+}
+
 /* adjust weekly rollover of gps time ----------------------------------------*/
 extern void adjweek(gtime_t *time, double tow)
 {
-    double tow_p;
+    gtime_t time_in = *time;
+    double tow_p, tow_in = tow;
     int week;
 
     /* if no time, get cpu time */
@@ -453,6 +511,11 @@ extern void adjweek(gtime_t *time, double tow)
     {
         *time = utc2gpst(timeget());
     }
+    else if (timememo && timememo_hit(&timememo->week, time, tow))
+    {
+        *time = timememo->week.out;
+        timememo->nhit++;
+    }
     else
     {
         tow_p = time2gpst(*time, &week);
@@ -461,6 +524,7 @@ extern void adjweek(gtime_t *time, double tow)
         else if (tow > tow_p + 302400.0)
             tow -= 604800.0;
         *time = gpst2time(week, tow);
+        if (timememo) timememo_put(&timememo->week, time_in, tow_in, *time);
     }
 }
 /* adjust gps week number ------------------------------------------------------
@@ -495,11 +559,18 @@ static int adjbdtweek(gtime_t *time, int week)
 /* adjust daily rollover of glonass time -------------------------------------*/
 void adjday_glot(gtime_t *time, double tod)
 {
-    double tow, tod_p;
+    gtime_t time_in = *time;
+    double tow, tod_p, tod_in = tod;
     int week;
 
     if (time->time == 0)
         *time = utc2gpst(timeget());
+    else if (timememo && timememo_hit(&timememo->day, time, tod))
+    {
+        *time = timememo->day.out;
+        timememo->nhit++;
+        return;
+    }
     *time = timeadd(gpst2utc(*time), 10800.0); /* glonass time */
     tow = time2gpst(*time, &week);
     tod_p = fmod(tow, 86400.0);
@@ -510,24 +581,68 @@ void adjday_glot(gtime_t *time, double tod)
         tod -= 86400.0;
     *time = gpst2time(week, tow + tod);
     *time = utc2gpst(timeadd(*time, -10800.0));
+    if (time_in.time != 0 && timememo)
+        timememo_put(&timememo->day, time_in, tod_in, *time);
 }
 
+/* trace message -----------------------------------------------------------------
+* records the format and up to 3 of its values as an EVENT_LOG + level event,
+* the host decoder looks the format up in the elf and prints the message.
+* %e %f %g values go as float, anything else as 32 bits. %s is recorded as 0:
+* the ring is read long after the call, when a string on the caller's stack is
+* gone, so formats carry numbers only (gtime_t as its whole seconds).
+* cheap enough to stay in: without "log trace on" it returns right away.
+*-----------------------------------------------------------------------------*/
 extern void trace(int level, const char *format, ...)
 {
-#ifdef _TRACE_
     va_list ap;
+    const char *p;
+    uint32_t arg[3] = {0};
+    union { float f; uint32_t u; } v;
+    int n = 0, l;
 
-    char buffer[255];
+    if (level <= 0 || !event_trace_on) return;
 
-    if (level > 0)
+    va_start(ap, format);
+    for (p = format; *p && n < 3; p++)
     {
-        va_start(ap, format);
-        vsprintf(buffer, format, ap);
-        va_end(ap);
-        printf("%s", buffer);
-        //OutputDebugString(buffer);
+        if (*p != '%' || *++p == '%') continue;
+        for (l = 0; *p && strchr("-+ #0123456789.hlLjzt", *p); p++)
+        {
+            if (*p == 'l') l++;
+        }
+        if (*p == '\0') break;
+        if (strchr("eEfFgG", *p))
+        {
+            v.f = (float)va_arg(ap, double);
+            arg[n++] = v.u;
+        }
+        else if (*p == 's')
+        {
+            (void)va_arg(ap, const char *);
+            arg[n++] = 0;
+        }
+        else if (*p == 'p')
+        {
+            arg[n++] = (uint32_t)(uintptr_t)va_arg(ap, void *);
+        }
+        else if (l >= 2)
+        {
+            arg[n++] = (uint32_t)va_arg(ap, long long);
+        }
+        else if (l == 1)
+        {
+            arg[n++] = (uint32_t)va_arg(ap, long);
+        }
+        else
+        {
+            arg[n++] = va_arg(ap, unsigned int);
+        }
     }
-#endif
+    va_end(ap);
+
+    event_trace((uint16_t)(EVENT_LOG + (level & 0xff)), (uint8_t)(n + 1),
+                (uint32_t)(uintptr_t)format, arg[0], arg[1], arg[2]);
 }
 
 #ifdef QT_QML_DEBUG
@@ -559,15 +674,114 @@ extern void CloseLogFile()
 *-----------------------------------------------------------------------------*/
 unsigned int rtk_crc24q(const unsigned char *buff, int len)
 {
-    unsigned int crc = 0;
-    int i;
-
     trace(4, "crc24q: len=%d\n", len);
 
-    for (i = 0; i < len; i++)
-        crc = ((crc << 8) & 0xFFFFFF) ^ tbl_CRC24Q[(crc >> 16) ^ buff[i]];
+    return Crc24qUpdate(CRC_24Q_INITIAL_SEED, buff, len);
+}
+
+/* bit cursor ------------------------------------------------------------------
+* sequential big-endian bit field reader over a byte buffer. whole bytes are
+* loaded into a 64-bit cache (4 at a time where possible) so each field costs a
+* shift and a mask instead of one loop iteration per bit.
+* bytes at or beyond the end of the buffer are read as zero.
+*-----------------------------------------------------------------------------*/
+typedef struct {                        /* bit cursor type for rtcm field extraction */
+	const unsigned char *buff;             /* start of byte data */
+	const unsigned char *end;              /* end of readable byte data */
+	const unsigned char *p;                /* next byte to load into word */
+	uint64_t word;                         /* bit cache (msb aligned) */
+	int nbit;                              /* number of valid bits in word */
+	int pos;                               /* bit position from start of data (bits) */
+} bitcur_t;
+
+static inline void bitcur_fill(bitcur_t *bc)
+{
+    const unsigned char *p = bc->p;
+
+    if (bc->nbit <= 32 && bc->end - p >= 4)
+    {
+        bc->word |= (uint64_t)(((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+                               ((uint32_t)p[2] << 8) | p[3]) << (32 - bc->nbit);
+        bc->nbit += 32;
+        p += 4;
+    }
+    while (bc->nbit <= 56)
+    {
+        if (p < bc->end)
+            bc->word |= (uint64_t)*p << (56 - bc->nbit);
+        bc->nbit += 8;
+        p++;
+    }
+    bc->p = p;
+}
+static inline void bitcur_seek(bitcur_t *bc, int pos)
+{
+    bc->p = bc->buff + (pos >> 3);
+    bc->word = 0;
+    bc->nbit = 0;
+    bc->pos = pos;
+    bitcur_fill(bc);
+    bc->word <<= (pos & 7);
+    bc->nbit -= (pos & 7);
+}
+static inline void bitcur_init(bitcur_t *bc, const unsigned char *buff, int nbyte, int pos)
+{
+    bc->buff = buff;
+    bc->end = buff + nbyte;
+    bitcur_seek(bc, pos);
+}
+static inline void bitcur_skip(bitcur_t *bc, int len)
+{
+    if (len < 32 && len <= bc->nbit)
+    {
+        bc->word <<= len;
+        bc->nbit -= len;
+        bc->pos += len;
+    }
+    else
+    {
+        bitcur_seek(bc, bc->pos + len);
+    }
+}
+static inline unsigned int bitcur_getu(bitcur_t *bc, int len)
+{
+    unsigned int bits;
+
+    if (len <= 0)
+        return 0;
+    if (bc->nbit < len)
+        bitcur_fill(bc);
+
+    bits = (unsigned int)(bc->word >> (64 - len));
+    bc->word <<= len;
+    bc->nbit -= len;
+    bc->pos += len;
+
+    return bits;
+}
+static inline int bitcur_gets(bitcur_t *bc, int len)
+{
+    unsigned int bits = bitcur_getu(bc, len);
+
+    if (len <= 0 || 32 <= len || !(bits & (1u << (len - 1))))
+        return (int)bits;
+
+    return (int)(bits | (~0u << len)); /* extend sign */
+}
+/* get sign-magnitude bits ---------------------------------------------------*/
+static inline double bitcur_getg(bitcur_t *bc, int len)
+{
+    unsigned int sign = bitcur_getu(bc, 1);
+    double value = bitcur_getu(bc, len - 1);
+
+    return sign ? -value : value;
+}
+/* get signed 38bit field ----------------------------------------------------*/
+static inline double bitcur_gets_38(bitcur_t *bc)
+{
+    double value = (double)bitcur_gets(bc, 32) * 64.0;
 
-    return crc;
+    return value + bitcur_getu(bc, 6);
 }
 
 /* extract unsigned/signed bits ------------------------------------------------
@@ -576,25 +790,27 @@ unsigned int rtk_crc24q(const unsigned char *buff, int len)
 *          int    pos    I      bit position from start of data (bits)
 *          int    len    I      bit length (bits) (len<=32)
 * return : extracted unsigned/signed bits
+* notes  : only the bytes spanned by the field are read
 *-----------------------------------------------------------------------------*/
 unsigned int rtcm_getbitu(const unsigned char *buff, int pos, int len)
 {
-    unsigned int bits = 0;
-    int i;
+    bitcur_t bc;
 
-    for (i = pos; i < pos + len; i++)
-        bits = (bits << 1) + ((buff[i / 8] >> (7 - i % 8)) & 1u);
+    if (len <= 0)
+        return 0;
+    bitcur_init(&bc, buff, (pos + len + 7) >> 3, pos);
 
-    return bits;
+    return bitcur_getu(&bc, len);
 }
 int rtcm_getbits(const unsigned char *buff, int pos, int len)
 {
-    unsigned int bits = rtcm_getbitu(buff, pos, len);
+    bitcur_t bc;
 
-    if (len <= 0 || 32 <= len || !(bits & (1u << (len - 1))))
-        return (int)bits;
+    if (len <= 0)
+        return 0;
+    bitcur_init(&bc, buff, (pos + len + 7) >> 3, pos);
 
-    return (int)(bits | (~0u << len)); /* extend sign */
+    return bitcur_gets(&bc, len);
 }
 /* set unsigned/signed bits ----------------------------------------------------
 * set unsigned/signed bits to byte data
@@ -631,14 +847,20 @@ void setbits(unsigned char *buff, int pos, int len, int data)
 /* get sign-magnitude bits ---------------------------------------------------*/
 static double getbitg(const unsigned char *buff, int pos, int len)
 {
-    double value = rtcm_getbitu(buff, pos + 1, len - 1);
+    bitcur_t bc;
+
+    bitcur_init(&bc, buff, (pos + len + 7) >> 3, pos);
 
-    return rtcm_getbitu(buff, pos, 1) ? -value : value;
+    return bitcur_getg(&bc, len);
 }
 /* get signed 38bit field ----------------------------------------------------*/
 static double rtcm_getbits_38(const unsigned char *buff, int pos)
 {
-    return (double)rtcm_getbits(buff, pos, 32) * 64.0 + rtcm_getbitu(buff, pos + 32, 6);
+    bitcur_t bc;
+
+    bitcur_init(&bc, buff, (pos + 38 + 7) >> 3, pos);
+
+    return bitcur_gets_38(&bc);
 }
 /* set signed 38bit field ----------------------------------------------------*/
 void rtcm_setbits_38(unsigned char *buff, int pos, double data)
@@ -650,10 +872,150 @@ void rtcm_setbits_38(unsigned char *buff, int pos, double data)
     setbitu(buff, pos + 32, 6, word_l);
 }
 
+/* satellite to slot index ------------------------------------------------------
+* optional O(1) sat->slot lookup, attached to a receiver by rtcm_attach_satslot().
+* satslot_t indexes whatever obs buffer the receiver fills (its obs, the back
+* buffer of an epoch assembler): a slot is only trusted if it is below obs->n
+* and holds the same satellite, so epoch resets and buffer flips need no
+* clearing, but every satellite of the buffer has to go in through the index.
+* navslot_t indexes a nav_t that may also change outside the decoder. a slot
+* is trusted if it holds the satellite in nav and in the index's own copy; a
+* miss scans the table, and finding the satellite there, a count that differs
+* or a slot holding another satellite than indexed rebuilds the index.
+*-----------------------------------------------------------------------------*/
+#define SLOT_NONE 0xFF
+
+/* age list: move slot to the newest end, slot==age->n links a new slot -------*/
+static void slotage_touch(slotage_t *age, int slot)
+{
+    if (slot < age->n)
+    {
+        if (slot == age->head) age->head = age->next[slot];
+        else age->next[age->prev[slot]] = age->next[slot];
+        if (slot == age->tail) age->tail = age->prev[slot];
+        else age->prev[age->next[slot]] = age->prev[slot];
+    }
+    else
+    {
+        age->n = (unsigned char)(slot + 1);
+    }
+    age->prev[slot] = age->tail;
+    age->next[slot] = SLOT_NONE;
+    if (age->head == SLOT_NONE) age->head = (unsigned char)slot;
+    else age->next[age->tail] = (unsigned char)slot;
+    age->tail = (unsigned char)slot;
+}
+static void slotage_reset(slotage_t *age)
+{
+    age->n = 0;
+    age->head = age->tail = SLOT_NONE;
+}
+/* rebuild the nav index from the tables, in slot order -----------------------*/
+static void navslot_sync(navslot_t *ns, const nav_t *nav)
+{
+    unsigned int i;
+    int sat;
+
+    memset(ns->eph, SLOT_NONE, sizeof(ns->eph));
+    memset(ns->geph, SLOT_NONE, sizeof(ns->geph));
+    slotage_reset(&ns->ephage);
+    slotage_reset(&ns->gephage);
+    for (i = 0; i < nav->n && i < MAXEPH; i++)
+    {
+        sat = nav->eph[i].sat;
+        if (sat > 0 && sat <= MAXSAT) ns->eph[sat - 1] = (unsigned char)i;
+        ns->ephsat[i] = (unsigned char)sat;
+        slotage_touch(&ns->ephage, i);
+    }
+    for (i = 0; i < nav->ng && i < MAXEPH_R; i++)
+    {
+        sat = nav->geph[i].sat;
+        if (sat > 0 && sat <= MAXSAT) ns->geph[sat - 1] = (unsigned char)i;
+        ns->gephsat[i] = (unsigned char)sat;
+        slotage_touch(&ns->gephage, i);
+    }
+    ns->nav = nav;
+}
+static void navslot_check(navslot_t *ns, const nav_t *nav)
+{
+    if (ns->nav != nav || ns->ephage.n != nav->n || ns->gephage.n != nav->ng)
+    {
+        navslot_sync(ns, nav);
+    }
+}
+/* nav.eph slot of a satellite (-1: not in nav) -------------------------------*/
+static int navslot_eph(navslot_t *ns, const nav_t *nav, int sat)
+{
+    unsigned int i = ns->eph[sat - 1];
+
+    if (i < nav->n && nav->eph[i].sat == sat && ns->ephsat[i] == sat) return (int)i;
+
+    for (i = 0; i < nav->n; i++)
+    {
+        if (nav->eph[i].sat == sat)
+        {
+            navslot_sync(ns, nav); /* moved or written outside the decoder */
+            return (int)i;
+        }
+    }
+    return -1;
+}
+/* nav.geph slot of a satellite (-1: not in nav) ------------------------------*/
+static int navslot_geph(navslot_t *ns, const nav_t *nav, int sat)
+{
+    unsigned int i = ns->geph[sat - 1];
+
+    if (i < nav->ng && nav->geph[i].sat == sat && ns->gephsat[i] == sat) return (int)i;
+
+    for (i = 0; i < nav->ng; i++)
+    {
+        if (nav->geph[i].sat == sat)
+        {
+            navslot_sync(ns, nav);
+            return (int)i;
+        }
+    }
+    return -1;
+}
+/* attach/detach (NULL) the satellite slot indexes of a receiver -----------------
+* args   : rtcmrcv_t *rcv    IO  receiver
+*          satslot_t *slot   O   obs index of this receiver (NULL: none)
+*          navslot_t *navslot O  index of rcv->nav, one for all receivers that
+*                                share the nav (NULL: none)
+* return : none
+* notes  : with the nav index attached, a full nav.eph/nav.geph evicts the entry
+*          updated least recently
+*-----------------------------------------------------------------------------*/
+extern void rtcm_attach_satslot(rtcmrcv_t *rcv, satslot_t *slot, navslot_t *navslot)
+{
+    if (slot) memset(slot, SLOT_NONE, sizeof(satslot_t));
+    if (navslot) navslot->nav = NULL;
+    rcv->slot = slot;
+    rcv->navslot = navslot;
+}
+/* find satellite in observation data (obs->n: not found) -------------------*/
+static unsigned int findobs(obs_t *obs, int sat, unsigned char *idx)
+{
+    unsigned int i;
+
+    if (idx && sat > 0 && sat <= MAXSAT)
+    {
+        i = idx[sat - 1];
+        return (i < obs->n && obs->data[i].sat == sat) ? i : obs->n;
+    }
+    for (i = 0; i < obs->n; i++)
+    {
+        if (obs->data[i].sat == sat)
+            break; /* field already exists */
+    }
+    return i;
+}
+
 /* get observation data index ------------------------------------------------*/
-static int obsindex(obs_t *obs, gtime_t time, int sat)
+static int obsindex(obs_t *obs, satslot_t *slot, gtime_t time, int sat)
 {
     unsigned int i;
+    unsigned char *idx = slot ? slot->obs : NULL;
 
     double tt = timediff(obs->time, time);
 
@@ -668,11 +1030,7 @@ static int obsindex(obs_t *obs, gtime_t time, int sat)
         /* first obs, set the time tag */
         obs->time = time;
     }
-    for (i = 0; i < obs->n; i++)
-    {
-		if (obs->data[i].sat == sat)
-			break; /* field already exists */
-    }
+    i = findobs(obs, sat, idx);
 	if (i == obs->n)
 	{
 		/* add new field */
@@ -681,6 +1039,7 @@ static int obsindex(obs_t *obs, gtime_t time, int sat)
 			memset(obs->data + i, 0, sizeof(obsd_t));
 			obs->data[i].sat = (unsigned char)sat;
 			obs->n++;
+			if (idx && sat > 0 && sat <= MAXSAT) idx[sat - 1] = (unsigned char)i;
 		}
 		else
 		{
@@ -706,7 +1065,7 @@ static int test_staid(obs_t *obs, int staid)
     {
         obs->staid = staid;
     }
-    else if (staid != obs->staid)
+    else if (staid != (int)obs->staid)
     {
         trace(2, "rtcm3 staid invalid id=%d %d\n", staid, obs->staid);
 
@@ -1090,6 +1449,8 @@ extern char *code2obs(int sys, unsigned char code, int *freq)
 
     return obscodes[code];
 }
+static void msmsig_flush(void);
+
 /* set code priority -----------------------------------------------------------
 * set code priority for multiple codes in a frequency
 * args   : int    sys     I     system (or of SYS_???)
@@ -1097,13 +1458,15 @@ extern char *code2obs(int sys, unsigned char code, int *freq)
 *          char   *pri    I     priority of codes (series of code characters)
 *                               (higher priority precedes lower)
 * return : none
+* notes  : the msm signal mappings resolved with the old priorities are dropped
 *-----------------------------------------------------------------------------*/
 extern void setcodepri(int sys, int freq, const char *pri)
 {
-    trace(3, "setcodepri:sys=%c freq=%d pri=%s\n", sys2char(sys), freq, pri);
+    trace(3, "setcodepri:sys=%c freq=%d\n", sys2char(sys), freq);
 
     if (freq <= 0 || MAXFREQ < freq)
         return;
+    msmsig_flush();
     if (sys & _SYS_GPS_)
         strcpy(codepris[0][freq - 1], pri);
     if (sys & _SYS_GLO_)
@@ -1232,6 +1595,9 @@ static void sigindex(int sys, const unsigned char *code, const int *freq, int n,
 /* adjust carrier-phase rollover ---------------------------------------------*/
 static double adjcp(rtcm_t *rtcm, int sat, int freq, double cp)
 {
+    (void)rtcm;
+    (void)sat;
+    (void)freq;
     //if (rtcm->cp[sat-1][freq]==0.0) ;
     //else if (cp<rtcm->cp[sat-1][freq]-750.0) cp+=1500.0;
     //else if (cp>rtcm->cp[sat-1][freq]+750.0) cp-=1500.0;
@@ -1253,9 +1619,10 @@ static unsigned char snratio(double snr)
     return (unsigned char)(snr <= 0.0 || 255.5 <= snr ? 0.0 : snr * 4.0 + 0.5);
 }
 /* add obsd to obs */
-static int add_obs(obsd_t* obsd, obs_t* obs)
+static int add_obs(obsd_t* obsd, obs_t* obs, satslot_t* slot)
 {
 	unsigned int i;
+	unsigned char *idx = slot ? slot->obs : NULL;
 
 	double tt = timediff(obs->time, obsd->time);
 
@@ -1270,11 +1637,7 @@ static int add_obs(obsd_t* obsd, obs_t* obs)
 		/* first obs, set the time tag */
 		obs->time = obsd->time;
 	}
-	for (i = 0; i < obs->n; i++)
-	{
-		if (obs->data[i].sat == obsd->sat)
-			break; /* field already exists */
-	}
+	i = findobs(obs, obsd->sat, idx);
 	if (i == obs->n)
 	{
 		/* add new field */
@@ -1282,6 +1645,7 @@ static int add_obs(obsd_t* obsd, obs_t* obs)
 		{
 			obs->data[i] = *obsd;
 			obs->n++;
+			if (idx && obsd->sat > 0 && obsd->sat <= MAXSAT) idx[obsd->sat - 1] = (unsigned char)i;
 		}
 		else
 		{
@@ -1296,8 +1660,74 @@ static int add_obs(obsd_t* obsd, obs_t* obs)
 
 	return i;
 }
+/* add eph to nav through the slot index, full table evicts the oldest update */
+static int add_eph_slot(eph_t* eph, nav_t* nav, navslot_t* ns)
+{
+	int sat = eph->sat, ret = 0, i;
+
+	navslot_check(ns, nav);
+
+	if ((i = navslot_eph(ns, nav, sat)) < 0)
+	{
+		if (nav->n < MAXEPH)
+		{
+			i = nav->n++;
+		}
+		else
+		{
+			i = ns->ephage.head;
+			if (ns->ephsat[i] != nav->eph[i].sat)
+			{
+				navslot_sync(ns, nav);
+				i = ns->ephage.head;
+			}
+			if (ns->ephsat[i] > 0 && ns->ephsat[i] <= MAXSAT) ns->eph[ns->ephsat[i] - 1] = SLOT_NONE;
+		}
+		ns->eph[sat - 1] = (unsigned char)i;
+		ns->ephsat[i] = (unsigned char)sat;
+		ret = 1;
+	}
+	nav->eph[i] = *eph;
+	nav->ephsat = sat;
+	slotage_touch(&ns->ephage, i);
+
+	return ret;
+}
+/* add geph to nav through the slot index, full table evicts the oldest update */
+static int add_geph_slot(geph_t* eph, nav_t* nav, navslot_t* ns)
+{
+	int sat = eph->sat, ret = 0, i;
+
+	navslot_check(ns, nav);
+
+	if ((i = navslot_geph(ns, nav, sat)) < 0)
+	{
+		if (nav->ng < MAXEPH_R)
+		{
+			i = nav->ng++;
+		}
+		else
+		{
+			i = ns->gephage.head;
+			if (ns->gephsat[i] != nav->geph[i].sat)
+			{
+				navslot_sync(ns, nav);
+				i = ns->gephage.head;
+			}
+			if (ns->gephsat[i] > 0 && ns->gephsat[i] <= MAXSAT) ns->geph[ns->gephsat[i] - 1] = SLOT_NONE;
+		}
+		ns->geph[sat - 1] = (unsigned char)i;
+		ns->gephsat[i] = (unsigned char)sat;
+		ret = 1;
+	}
+	nav->geph[i] = *eph;
+	nav->ephsat = sat;
+	slotage_touch(&ns->gephage, i);
+
+	return ret;
+}
 /* add eph to nav */
-static int add_eph(eph_t* eph, nav_t* nav)
+static int add_eph(eph_t* eph, nav_t* nav, navslot_t* ns)
 {
 	int i = 0, ret = 0;
 	int sat = eph->sat;
@@ -1308,21 +1738,25 @@ static int add_eph(eph_t* eph, nav_t* nav)
 	{
 		return 0;
 	}
+	if (ns && sat <= MAXSAT)
+	{
+		return add_eph_slot(eph, nav, ns);
+	}
 
-	for (i = 0; i < nav->n; ++i)
+	for (i = 0; i < (int)nav->n; ++i)
 	{
 		if (nav->eph[i].sat == sat)
 		{
 			break;
 		}
 	}
-	if (i < nav->n)
+	if (i < (int)nav->n)
 	{
 		/* replace old */
 		nav->eph[i] = *eph;
 		nav->ephsat = sat;
 	}
-	else if (i == nav->n)
+	else if (i == (int)nav->n)
 	{
 		if (i < MAXEPH)
 		{
@@ -1334,7 +1768,7 @@ static int add_eph(eph_t* eph, nav_t* nav)
 		else
 		{
 			/* remove the oldest one */
-			for (i = 0; i < nav->n; ++i)
+			for (i = 0; i < (int)nav->n; ++i)
 			{
 				double diffT = fabs(timediff(nav->eph[i].toe, eph->toe));
 				if (bestL < 0 || bestT>diffT)
@@ -1355,7 +1789,7 @@ static int add_eph(eph_t* eph, nav_t* nav)
 	return ret;
 }
 /* add eph to nav */
-static int add_geph(geph_t* eph, nav_t* nav)
+static int add_geph(geph_t* eph, nav_t* nav, navslot_t* ns)
 {
 	int i = 0, ret = 0;
 	int sat = eph->sat;
@@ -1366,21 +1800,25 @@ static int add_geph(geph_t* eph, nav_t* nav)
 	{
 		return 0;
 	}
+	if (ns && sat <= MAXSAT)
+	{
+		return add_geph_slot(eph, nav, ns);
+	}
 
-	for (i = 0; i < nav->ng; ++i)
+	for (i = 0; i < (int)nav->ng; ++i)
 	{
 		if (nav->geph[i].sat == sat)
 		{
 			break;
 		}
 	}
-	if (i < nav->ng)
+	if (i < (int)nav->ng)
 	{
 		/* replace old */
 		nav->geph[i] = *eph;
 		nav->ephsat = sat;
 	}
-	else if (i == nav->ng)
+	else if (i == (int)nav->ng)
 	{
 		if (i < MAXEPH_R)
 		{
@@ -1392,7 +1830,7 @@ static int add_geph(geph_t* eph, nav_t* nav)
 		else
 		{
 			/* remove the oldest one */
-			for (i = 0; i < nav->ng; ++i)
+			for (i = 0; i < (int)nav->ng; ++i)
 			{
 				double diffT = fabs(timediff(nav->geph[i].toe, eph->toe));
 				if (bestL < 0 || bestT>diffT)
@@ -1558,7 +1996,6 @@ static int decode_type999(rtcm_t *rtcm, obs_t *obs)
 static int decode_head1001(rtcm_t *rtcm, obs_t *obs, int *sync)
 {
     double tow;
-    char tstr[64];
     unsigned int i = 24;
     int staid, nsat, type;
 
@@ -1586,8 +2023,7 @@ static int decode_head1001(rtcm_t *rtcm, obs_t *obs, int *sync)
 
     adjweek(&rtcm->time, tow);
 
-    time2str(rtcm->time, tstr, 2);
-    trace(4, "decode_head1001: time=%s nsat=%d sync=%d\n", tstr, nsat, *sync);
+    trace(4, "decode_head1001: time=%u nsat=%d sync=%d\n", (unsigned int)rtcm->time.time, nsat, *sync);
 
     return nsat;
 }
@@ -1601,7 +2037,7 @@ static int decode_type1001(rtcm_t *rtcm, obs_t *obs)
     return sync ? 0 : 1;
 }
 /* decode type 1002: extended L1-only gps rtk observables --------------------*/
-static int decode_type1002(rtcm_t *rtcm, obs_t *obs)
+static int decode_type1002(rtcm_t *rtcm, obs_t *obs, satslot_t *slot)
 {
     double pr1, cnr1, /*tt,*/ cp1;
     unsigned int i = 24 + 64, j = 0;
@@ -1610,7 +2046,7 @@ static int decode_type1002(rtcm_t *rtcm, obs_t *obs)
     if ((nsat = decode_head1001(rtcm, obs, &sync)) < 0)
         return -1;
 
-    for (j = 0; j < nsat && obs->n < MAXOBS && i + 74 <= rtcm->len * 8; j++)
+    for (j = 0; j < (unsigned int)nsat && obs->n < MAXOBS && i + 74 <= rtcm->len * 8; j++)
     {
         prn = rtcm_getbitu(rtcm->buff, i, 6);
         i += 6;
@@ -1640,7 +2076,7 @@ static int decode_type1002(rtcm_t *rtcm, obs_t *obs)
             trace(2, "rtcm3 1002 satellite number error: prn=%d\n", prn);
             continue;
         }
-        if ((index = obsindex(obs, rtcm->time, sat)) < 0)
+        if ((index = obsindex(obs, slot, rtcm->time, sat)) < 0)
             continue;
         pr1 = pr1 * 0.02 + amb * PRUNIT_GPS;
         if (ppr1 != (int)0xFFF80000)
@@ -1665,7 +2101,7 @@ static int decode_type1003(rtcm_t *rtcm, obs_t *obs)
     return sync ? 0 : 1;
 }
 /* decode type 1004: extended L1&L2 gps rtk observables ----------------------*/
-static int decode_type1004(rtcm_t *rtcm, obs_t *obs)
+static int decode_type1004(rtcm_t *rtcm, obs_t *obs, satslot_t *slot)
 {
     const int L2codes[] = {CODE_L2X, CODE_L2P, CODE_L2D, CODE_L2W};
     double pr1, cnr1, cnr2, /*tt,*/ cp1, cp2;
@@ -1675,7 +2111,7 @@ static int decode_type1004(rtcm_t *rtcm, obs_t *obs)
     if ((nsat = decode_head1001(rtcm, obs, &sync)) < 0)
         return -1;
 
-    for (j = 0; j < nsat && obs->n < MAXOBS && i + 125 <= rtcm->len * 8; j++)
+    for (j = 0; j < nsat && obs->n < MAXOBS && i + 125 <= (int)rtcm->len * 8; j++)
     {
         prn = rtcm_getbitu(rtcm->buff, i, 6);
         i += 6;
@@ -1715,7 +2151,7 @@ static int decode_type1004(rtcm_t *rtcm, obs_t *obs)
             trace(2, "rtcm3 1004 satellite number error: sys=%c prn=%d\n", sys2char(sys), prn);
             continue;
         }
-        if ((index = obsindex(obs, rtcm->time, sat)) < 0)
+        if ((index = obsindex(obs, slot, rtcm->time, sat)) < 0)
             continue;
         pr1 = pr1 * 0.02 + amb * PRUNIT_GPS;
         if (ppr1 != (int)0xFFF80000)
@@ -1752,7 +2188,7 @@ static int decode_type1005(rtcm_t *rtcm, obs_t *obs)
     double rr[3];
     int i = 24 + 12, j, staid /*,itrf*/;
 
-    if (i + 140 == rtcm->len * 8)
+    if (i + 140 == (int)rtcm->len * 8)
     {
         staid = rtcm_getbitu(rtcm->buff, i, 12);
         i += 12;
@@ -1785,7 +2221,7 @@ static int decode_type1006(rtcm_t *rtcm, obs_t *obs)
     double rr[3] /*,anth*/;
     int i = 24 + 12, j, staid, itrf;
 
-    if (i + 156 <= rtcm->len * 8)
+    if (i + 156 <= (int)rtcm->len * 8)
     {
         staid = rtcm_getbitu(rtcm->buff, i, 12);
         i += 12;
@@ -1823,7 +2259,7 @@ static int decode_type1007(rtcm_t *rtcm, obs_t *obs)
 
     n = rtcm_getbitu(rtcm->buff, i + 12, 8);
 
-    if (i + 28 + 8 * n <= rtcm->len * 8)
+    if (i + 28 + 8 * n <= (int)rtcm->len * 8)
     {
         staid = rtcm_getbitu(rtcm->buff, i, 12);
         i += 12 + 8;
@@ -1854,7 +2290,7 @@ static int decode_type1008(rtcm_t *rtcm, obs_t *obs)
     n = rtcm_getbitu(rtcm->buff, i + 12, 8);
     m = rtcm_getbitu(rtcm->buff, i + 28 + 8 * n, 8);
 
-    if (i + 36 + 8 * (n + m) <= rtcm->len * 8)
+    if (i + 36 + 8 * (n + m) <= (int)rtcm->len * 8)
     {
         staid = rtcm_getbitu(rtcm->buff, i, 12);
         i += 12 + 8;
@@ -1883,13 +2319,12 @@ static int decode_type1008(rtcm_t *rtcm, obs_t *obs)
 static int decode_head1009(rtcm_t *rtcm, obs_t *obs, int *sync)
 {
     double tod;
-    char tstr[64];
     int i = 24, staid, nsat, type;
 
     type = rtcm_getbitu(rtcm->buff, i, 12);
     i += 12;
 
-    if (i + 49 <= rtcm->len * 8)
+    if (i + 49 <= (int)rtcm->len * 8)
     {
         staid = rtcm_getbitu(rtcm->buff, i, 12);
         i += 12;
@@ -1910,8 +2345,7 @@ static int decode_head1009(rtcm_t *rtcm, obs_t *obs, int *sync)
 
     adjday_glot(&rtcm->time, tod);
 
-    time2str(rtcm->time, tstr, 2);
-    trace(4, "decode_head1009: time=%s nsat=%d sync=%d\n", tstr, nsat, *sync);
+    trace(4, "decode_head1009: time=%u nsat=%d sync=%d\n", (unsigned int)rtcm->time.time, nsat, *sync);
 
     return nsat;
 }
@@ -1925,7 +2359,7 @@ static int decode_type1009(rtcm_t *rtcm, obs_t *obs)
     return sync ? 0 : 1;
 }
 /* decode type 1010: extended L1-only glonass rtk observables ----------------*/
-static int decode_type1010(rtcm_t *rtcm, obs_t *obs)
+static int decode_type1010(rtcm_t *rtcm, obs_t *obs, satslot_t *slot)
 {
     double pr1, cnr1, tt, cp1, lam1;
     int i = 24 + 61, j, index, nsat, sync, prn, sat, code, freq, ppr1, lock1, amb, sys = _SYS_GLO_;
@@ -1933,7 +2367,7 @@ static int decode_type1010(rtcm_t *rtcm, obs_t *obs)
     if ((nsat = decode_head1009(rtcm, obs, &sync)) < 0)
         return -1;
 
-    for (j = 0; j < nsat && obs->n < MAXOBS && i + 79 <= rtcm->len * 8; j++)
+    for (j = 0; j < nsat && obs->n < MAXOBS && i + 79 <= (int)rtcm->len * 8; j++)
     {
         prn = rtcm_getbitu(rtcm->buff, i, 6);
         i += 6;
@@ -1956,7 +2390,7 @@ static int decode_type1010(rtcm_t *rtcm, obs_t *obs)
             trace(2, "rtcm3 1010 satellite number error: prn=%d\n", prn);
             continue;
         }
-        if ((index = obsindex(obs, rtcm->time, sat)) < 0)
+        if ((index = obsindex(obs, slot, rtcm->time, sat)) < 0)
             continue;
         pr1 = pr1 * 0.02 + amb * PRUNIT_GLO;
         if (ppr1 != (int)0xFFF80000)
@@ -1986,7 +2420,7 @@ static int decode_type1011(rtcm_t *rtcm, obs_t *obs)
     return sync ? 0 : 1;
 }
 /* decode type 1012: extended L1&L2 glonass rtk observables ------------------*/
-static int decode_type1012(rtcm_t *rtcm, obs_t *obs)
+static int decode_type1012(rtcm_t *rtcm, obs_t *obs, satslot_t *slot)
 {
     double pr1, cnr1, cnr2, tt, cp1, cp2, lam1, lam2;
     int i = 24 + 61, j, index, nsat, sync, prn, sat, freq, code1, code2, pr21, ppr1, ppr2;
@@ -1995,7 +2429,7 @@ static int decode_type1012(rtcm_t *rtcm, obs_t *obs)
     if ((nsat = decode_head1009(rtcm, obs, &sync)) < 0)
         return -1;
 
-    for (j = 0; j < nsat && obs->n < MAXOBS && i + 130 <= rtcm->len * 8; j++)
+    for (j = 0; j < nsat && obs->n < MAXOBS && i + 130 <= (int)rtcm->len * 8; j++)
     {
         prn = rtcm_getbitu(rtcm->buff, i, 6);
         i += 6;
@@ -2028,7 +2462,7 @@ static int decode_type1012(rtcm_t *rtcm, obs_t *obs)
             trace(2, "rtcm3 1012 satellite number error: sys=%c prn=%d\n", sys2char(sys), prn);
             continue;
         }
-        if ((index = obsindex(obs, rtcm->time, sat)) < 0)
+        if ((index = obsindex(obs, slot, rtcm->time, sat)) < 0)
             continue;
         pr1 = pr1 * 0.02 + amb * PRUNIT_GLO;
         if (ppr1 != (int)0xFFF80000)
@@ -2062,76 +2496,51 @@ static int decode_type1012(rtcm_t *rtcm, obs_t *obs)
 /* decode type 1013: system parameters ---------------------------------------*/
 static int decode_type1013(rtcm_t *rtcm)
 {
+    (void)rtcm;
     return 0;
 }
 /* decode type 1019: gps ephemerides -----------------------------------------*/
-static int decode_type1019(rtcm_t *rtcm, nav_t *nav)
+static int decode_type1019(rtcm_t *rtcm, nav_t *nav, navslot_t *ns)
 {
     eph_t eph = {0};
     double toc, sqrtA;
-    int i = 24 + 12, prn, sat, week, sys = _SYS_GPS_;
-
-    if (i + 476 <= rtcm->len * 8)
-    {
-        prn = rtcm_getbitu(rtcm->buff, i, 6);
-        i += 6;
-        week = rtcm_getbitu(rtcm->buff, i, 10);
-        i += 10;
-        eph.sva = rtcm_getbitu(rtcm->buff, i, 4);
-        i += 4;
-        eph.code = rtcm_getbitu(rtcm->buff, i, 2);
-        i += 2;
-        eph.idot = rtcm_getbits(rtcm->buff, i, 14) * P2_43 * SC2RAD;
-        i += 14;
-        eph.iode = rtcm_getbitu(rtcm->buff, i, 8);
-        i += 8;
-        toc = rtcm_getbitu(rtcm->buff, i, 16) * 16.0;
-        i += 16;
-        eph.f2 = rtcm_getbits(rtcm->buff, i, 8) * P2_55;
-        i += 8;
-        eph.f1 = rtcm_getbits(rtcm->buff, i, 16) * P2_43;
-        i += 16;
-        eph.f0 = rtcm_getbits(rtcm->buff, i, 22) * P2_31;
-        i += 22;
-        eph.iodc = rtcm_getbitu(rtcm->buff, i, 10);
-        i += 10;
-        eph.crs = rtcm_getbits(rtcm->buff, i, 16) * P2_5;
-        i += 16;
-        eph.deln = rtcm_getbits(rtcm->buff, i, 16) * P2_43 * SC2RAD;
-        i += 16;
-        eph.M0 = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.cuc = rtcm_getbits(rtcm->buff, i, 16) * P2_29;
-        i += 16;
-        eph.e = rtcm_getbitu(rtcm->buff, i, 32) * P2_33;
-        i += 32;
-        eph.cus = rtcm_getbits(rtcm->buff, i, 16) * P2_29;
-        i += 16;
-        sqrtA = rtcm_getbitu(rtcm->buff, i, 32) * P2_19;
-        i += 32;
-        eph.toes = rtcm_getbitu(rtcm->buff, i, 16) * 16.0;
-        i += 16;
-        eph.cic = rtcm_getbits(rtcm->buff, i, 16) * P2_29;
-        i += 16;
-        eph.OMG0 = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.cis = rtcm_getbits(rtcm->buff, i, 16) * P2_29;
-        i += 16;
-        eph.i0 = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.crc = rtcm_getbits(rtcm->buff, i, 16) * P2_5;
-        i += 16;
-        eph.omg = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.OMGd = rtcm_getbits(rtcm->buff, i, 24) * P2_43 * SC2RAD;
-        i += 24;
-        eph.tgd[0] = rtcm_getbits(rtcm->buff, i, 8) * P2_31;
-        i += 8;
-        eph.svh = rtcm_getbitu(rtcm->buff, i, 6);
-        i += 6;
-        eph.flag = rtcm_getbitu(rtcm->buff, i, 1);
-        i += 1;
-        eph.fit = rtcm_getbitu(rtcm->buff, i, 1) ? 0.0 : 4.0; /* 0:4hr,1:>4hr */
+    bitcur_t bc;
+    int prn, sat, week, sys = _SYS_GPS_;
+
+    bitcur_init(&bc, rtcm->buff, rtcm->len, 24 + 12);
+
+    if (bc.pos + 476 <= (int)rtcm->len * 8)
+    {
+        prn = bitcur_getu(&bc, 6);
+        week = bitcur_getu(&bc, 10);
+        eph.sva = bitcur_getu(&bc, 4);
+        eph.code = bitcur_getu(&bc, 2);
+        eph.idot = bitcur_gets(&bc, 14) * P2_43 * SC2RAD;
+        eph.iode = bitcur_getu(&bc, 8);
+        toc = bitcur_getu(&bc, 16) * 16.0;
+        eph.f2 = bitcur_gets(&bc, 8) * P2_55;
+        eph.f1 = bitcur_gets(&bc, 16) * P2_43;
+        eph.f0 = bitcur_gets(&bc, 22) * P2_31;
+        eph.iodc = bitcur_getu(&bc, 10);
+        eph.crs = bitcur_gets(&bc, 16) * P2_5;
+        eph.deln = bitcur_gets(&bc, 16) * P2_43 * SC2RAD;
+        eph.M0 = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.cuc = bitcur_gets(&bc, 16) * P2_29;
+        eph.e = bitcur_getu(&bc, 32) * P2_33;
+        eph.cus = bitcur_gets(&bc, 16) * P2_29;
+        sqrtA = bitcur_getu(&bc, 32) * P2_19;
+        eph.toes = bitcur_getu(&bc, 16) * 16.0;
+        eph.cic = bitcur_gets(&bc, 16) * P2_29;
+        eph.OMG0 = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.cis = bitcur_gets(&bc, 16) * P2_29;
+        eph.i0 = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.crc = bitcur_gets(&bc, 16) * P2_5;
+        eph.omg = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.OMGd = bitcur_gets(&bc, 24) * P2_43 * SC2RAD;
+        eph.tgd[0] = bitcur_gets(&bc, 8) * P2_31;
+        eph.svh = bitcur_getu(&bc, 6);
+        eph.flag = bitcur_getu(&bc, 1);
+        eph.fit = bitcur_getu(&bc, 1) ? 0.0 : 4.0; /* 0:4hr,1:>4hr */
     }
     else
     {
@@ -2157,55 +2566,45 @@ static int decode_type1019(rtcm_t *rtcm, nav_t *nav)
     eph.ttr = rtcm->time;
     eph.A = sqrtA * sqrtA;
 
-   	if (add_eph(&eph, nav)==1)
+   	if (add_eph(&eph, nav, ns)==1)
 		++nav->n_gps;
 
     return 2;
 }
 /* decode type 1020: glonass ephemerides -------------------------------------*/
-static int decode_type1020(rtcm_t *rtcm, nav_t *nav)
+static int decode_type1020(rtcm_t *rtcm, nav_t *nav, navslot_t *ns)
 {
     geph_t geph = {0};
     double tk_h, tk_m, tk_s, toe, tow, tod, tof;
-    int i = 24 + 12, prn, sat, week, tb, bn, sys = _SYS_GLO_;
-
-    if (i + 348 <= rtcm->len * 8)
-    {
-        prn = rtcm_getbitu(rtcm->buff, i, 6);
-        i += 6;
-        geph.frq = rtcm_getbitu(rtcm->buff, i, 5) - 7;
-        i += 5 + 2 + 2;
-        tk_h = rtcm_getbitu(rtcm->buff, i, 5);
-        i += 5;
-        tk_m = rtcm_getbitu(rtcm->buff, i, 6);
-        i += 6;
-        tk_s = rtcm_getbitu(rtcm->buff, i, 1) * 30.0;
-        i += 1;
-        bn = rtcm_getbitu(rtcm->buff, i, 1);
-        i += 1 + 1;
-        tb = rtcm_getbitu(rtcm->buff, i, 7);
-        i += 7;
-        geph.vel[0] = getbitg(rtcm->buff, i, 24) * P2_20 * 1E3;
-        i += 24;
-        geph.pos[0] = getbitg(rtcm->buff, i, 27) * P2_11 * 1E3;
-        i += 27;
-        geph.acc[0] = getbitg(rtcm->buff, i, 5) * P2_30 * 1E3;
-        i += 5;
-        geph.vel[1] = getbitg(rtcm->buff, i, 24) * P2_20 * 1E3;
-        i += 24;
-        geph.pos[1] = getbitg(rtcm->buff, i, 27) * P2_11 * 1E3;
-        i += 27;
-        geph.acc[1] = getbitg(rtcm->buff, i, 5) * P2_30 * 1E3;
-        i += 5;
-        geph.vel[2] = getbitg(rtcm->buff, i, 24) * P2_20 * 1E3;
-        i += 24;
-        geph.pos[2] = getbitg(rtcm->buff, i, 27) * P2_11 * 1E3;
-        i += 27;
-        geph.acc[2] = getbitg(rtcm->buff, i, 5) * P2_30 * 1E3;
-        i += 5 + 1;
-        geph.gamn = getbitg(rtcm->buff, i, 11) * P2_40;
-        i += 11 + 3;
-        geph.taun = getbitg(rtcm->buff, i, 22) * P2_30;
+    bitcur_t bc;
+    int prn, sat, week, tb, bn, sys = _SYS_GLO_;
+
+    bitcur_init(&bc, rtcm->buff, rtcm->len, 24 + 12);
+
+    if (bc.pos + 348 <= (int)rtcm->len * 8)
+    {
+        prn = bitcur_getu(&bc, 6);
+        geph.frq = bitcur_getu(&bc, 5) - 7;
+        bitcur_skip(&bc, 2 + 2);
+        tk_h = bitcur_getu(&bc, 5);
+        tk_m = bitcur_getu(&bc, 6);
+        tk_s = bitcur_getu(&bc, 1) * 30.0;
+        bn = bitcur_getu(&bc, 1);
+        bitcur_skip(&bc, 1);
+        tb = bitcur_getu(&bc, 7);
+        geph.vel[0] = bitcur_getg(&bc, 24) * P2_20 * 1E3;
+        geph.pos[0] = bitcur_getg(&bc, 27) * P2_11 * 1E3;
+        geph.acc[0] = bitcur_getg(&bc, 5) * P2_30 * 1E3;
+        geph.vel[1] = bitcur_getg(&bc, 24) * P2_20 * 1E3;
+        geph.pos[1] = bitcur_getg(&bc, 27) * P2_11 * 1E3;
+        geph.acc[1] = bitcur_getg(&bc, 5) * P2_30 * 1E3;
+        geph.vel[2] = bitcur_getg(&bc, 24) * P2_20 * 1E3;
+        geph.pos[2] = bitcur_getg(&bc, 27) * P2_11 * 1E3;
+        geph.acc[2] = bitcur_getg(&bc, 5) * P2_30 * 1E3;
+        bitcur_skip(&bc, 1);
+        geph.gamn = bitcur_getg(&bc, 11) * P2_40;
+        bitcur_skip(&bc, 3);
+        geph.taun = bitcur_getg(&bc, 22) * P2_30;
 
         set_glo_frq(prn, geph.frq);
     }
@@ -2242,49 +2641,56 @@ static int decode_type1020(rtcm_t *rtcm, nav_t *nav)
         toe -= 86400.0;
     geph.toe = utc2gpst(gpst2time(week, tow + toe)); /* utc->gpst */
 
-    add_geph(&geph, nav);
+    add_geph(&geph, nav, ns);
     
     return 2;
 }
 /* decode type 1021: helmert/abridged molodenski -----------------------------*/
 static int decode_type1021(rtcm_t *rtcm)
 {
+    (void)rtcm;
     trace(2, "rtcm3 1021: not supported message\n");
     return 0;
 }
 /* decode type 1022: moledenski-badekas transfromation -----------------------*/
 static int decode_type1022(rtcm_t *rtcm)
 {
+    (void)rtcm;
     trace(2, "rtcm3 1022: not supported message\n");
     return 0;
 }
 /* decode type 1023: residual, ellipoidal grid representation ----------------*/
 static int decode_type1023(rtcm_t *rtcm)
 {
+    (void)rtcm;
     trace(2, "rtcm3 1023: not supported message\n");
     return 0;
 }
 /* decode type 1024: residual, plane grid representation ---------------------*/
 static int decode_type1024(rtcm_t *rtcm)
 {
+    (void)rtcm;
     trace(2, "rtcm3 1024: not supported message\n");
     return 0;
 }
 /* decode type 1025: projection (types except LCC2SP,OM) ---------------------*/
 static int decode_type1025(rtcm_t *rtcm)
 {
+    (void)rtcm;
     trace(2, "rtcm3 1025: not supported message\n");
     return 0;
 }
 /* decode type 1026: projection (LCC2SP - lambert conic conformal (2sp)) -----*/
 static int decode_type1026(rtcm_t *rtcm)
 {
+    (void)rtcm;
     trace(2, "rtcm3 1026: not supported message\n");
     return 0;
 }
 /* decode type 1027: projection (type OM - oblique mercator) -----------------*/
 static int decode_type1027(rtcm_t *rtcm)
 {
+    (void)rtcm;
     trace(2, "rtcm3 1027: not supported message\n");
     return 0;
 }
@@ -2293,7 +2699,7 @@ static int decode_type1029(rtcm_t *rtcm)
 {
     int i = 24 + 12, staid, mjd, tod, nchar, cunit;
 
-    if (i + 60 <= rtcm->len * 8)
+    if (i + 60 <= (int)rtcm->len * 8)
     {
         staid = rtcm_getbitu(rtcm->buff, i, 12);
         i += 12;
@@ -2311,7 +2717,7 @@ static int decode_type1029(rtcm_t *rtcm)
         trace(2, "rtcm3 1029 length error: len=%d\n", rtcm->len);
         return -1;
     }
-    if (i + nchar * 8 > rtcm->len * 8)
+    if (i + nchar * 8 > (int)rtcm->len * 8)
     {
         trace(2, "rtcm3 1029 length error: len=%d nchar=%d\n", rtcm->len, nchar);
         return -1;
@@ -2322,18 +2728,21 @@ static int decode_type1029(rtcm_t *rtcm)
 /* decode type 1030: network rtk residual ------------------------------------*/
 static int decode_type1030(rtcm_t *rtcm)
 {
+    (void)rtcm;
     trace(2, "rtcm3 1030: not supported message\n");
     return 0;
 }
 /* decode type 1031: glonass network rtk residual ----------------------------*/
 static int decode_type1031(rtcm_t *rtcm)
 {
+    (void)rtcm;
     trace(2, "rtcm3 1031: not supported message\n");
     return 0;
 }
 /* decode type 1032: physical reference station position information ---------*/
 static int decode_type1032(rtcm_t *rtcm)
 {
+    (void)rtcm;
     trace(2, "rtcm3 1032: not supported message\n");
     return 0;
 }
@@ -2349,7 +2758,7 @@ static int decode_type1033(rtcm_t *rtcm, obs_t *obs)
     n2 = rtcm_getbitu(rtcm->buff, i + 44 + 8 * (n + m + n1), 8);
     n3 = rtcm_getbitu(rtcm->buff, i + 52 + 8 * (n + m + n1 + n2), 8);
 
-    if (i + 60 + 8 * (n + m + n1 + n2 + n3) <= rtcm->len * 8)
+    if (i + 60 + 8 * (n + m + n1 + n2 + n3) <= (int)rtcm->len * 8)
     {
         staid = rtcm_getbitu(rtcm->buff, i, 12);
         i += 12 + 8;
@@ -2393,25 +2802,28 @@ static int decode_type1033(rtcm_t *rtcm, obs_t *obs)
     if (!test_staid(obs, staid))
         return -1;
 
-    trace(3, "rtcm3 1033: ant=%s:%s rec=%s:%s:%s\n", des, sno, rec, ver, rsn);
+    trace(3, "rtcm3 1033: staid=%d ant=%d rec=%d\n", staid, n, n1);
 
     return 5;
 }
 /* decode type 1034: gps network fkp gradient --------------------------------*/
 static int decode_type1034(rtcm_t *rtcm)
 {
+    (void)rtcm;
     trace(2, "rtcm3 1034: not supported message\n");
     return 0;
 }
 /* decode type 1035: glonass network fkp gradient ----------------------------*/
 static int decode_type1035(rtcm_t *rtcm)
 {
+    (void)rtcm;
     trace(2, "rtcm3 1035: not supported message\n");
     return 0;
 }
 /* decode type 1037: glonass network rtk ionospheric correction difference ---*/
 static int decode_type1037(rtcm_t *rtcm)
 {
+    (void)rtcm;
     int i = 0;
     trace(2, "rtcm3 1037: not supported message\n");
     return 0;
@@ -2419,81 +2831,58 @@ static int decode_type1037(rtcm_t *rtcm)
 /* decode type 1038: glonass network rtk geometic correction difference ------*/
 static int decode_type1038(rtcm_t *rtcm)
 {
+    (void)rtcm;
     trace(2, "rtcm3 1038: not supported message\n");
     return 0;
 }
 /* decode type 1039: glonass network rtk combined correction difference ------*/
 static int decode_type1039(rtcm_t *rtcm)
 {
+    (void)rtcm;
     trace(2, "rtcm3 1039: not supported message\n");
     return 0;
 }
 /* decode type 1044: qzss ephemerides (ref [15]) -----------------------------*/
-static int decode_type1044(rtcm_t *rtcm, nav_t *nav)
+static int decode_type1044(rtcm_t *rtcm, nav_t *nav, navslot_t *ns)
 {
     eph_t eph = {0};
     double toc, sqrtA;
-    int i = 24 + 12, prn, sat, week, sys = _SYS_QZS_;
-
-    if (i + 473 <= rtcm->len * 8)
-    {
-        prn = rtcm_getbitu(rtcm->buff, i, 4) + 192;
-        i += 4;
-        toc = rtcm_getbitu(rtcm->buff, i, 16) * 16.0;
-        i += 16;
-        eph.f2 = rtcm_getbits(rtcm->buff, i, 8) * P2_55;
-        i += 8;
-        eph.f1 = rtcm_getbits(rtcm->buff, i, 16) * P2_43;
-        i += 16;
-        eph.f0 = rtcm_getbits(rtcm->buff, i, 22) * P2_31;
-        i += 22;
-        eph.iode = rtcm_getbitu(rtcm->buff, i, 8);
-        i += 8;
-        eph.crs = rtcm_getbits(rtcm->buff, i, 16) * P2_5;
-        i += 16;
-        eph.deln = rtcm_getbits(rtcm->buff, i, 16) * P2_43 * SC2RAD;
-        i += 16;
-        eph.M0 = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.cuc = rtcm_getbits(rtcm->buff, i, 16) * P2_29;
-        i += 16;
-        eph.e = rtcm_getbitu(rtcm->buff, i, 32) * P2_33;
-        i += 32;
-        eph.cus = rtcm_getbits(rtcm->buff, i, 16) * P2_29;
-        i += 16;
-        sqrtA = rtcm_getbitu(rtcm->buff, i, 32) * P2_19;
-        i += 32;
-        eph.toes = rtcm_getbitu(rtcm->buff, i, 16) * 16.0;
-        i += 16;
-        eph.cic = rtcm_getbits(rtcm->buff, i, 16) * P2_29;
-        i += 16;
-        eph.OMG0 = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.cis = rtcm_getbits(rtcm->buff, i, 16) * P2_29;
-        i += 16;
-        eph.i0 = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.crc = rtcm_getbits(rtcm->buff, i, 16) * P2_5;
-        i += 16;
-        eph.omg = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.OMGd = rtcm_getbits(rtcm->buff, i, 24) * P2_43 * SC2RAD;
-        i += 24;
-        eph.idot = rtcm_getbits(rtcm->buff, i, 14) * P2_43 * SC2RAD;
-        i += 14;
-        eph.code = rtcm_getbitu(rtcm->buff, i, 2);
-        i += 2;
-        week = rtcm_getbitu(rtcm->buff, i, 10);
-        i += 10;
-        eph.sva = rtcm_getbitu(rtcm->buff, i, 4);
-        i += 4;
-        eph.svh = rtcm_getbitu(rtcm->buff, i, 6);
-        i += 6;
-        eph.tgd[0] = rtcm_getbits(rtcm->buff, i, 8) * P2_31;
-        i += 8;
-        eph.iodc = rtcm_getbitu(rtcm->buff, i, 10);
-        i += 10;
-        eph.fit = rtcm_getbitu(rtcm->buff, i, 1) ? 0.0 : 2.0; /* 0:2hr,1:>2hr */
+    bitcur_t bc;
+    int prn, sat, week, sys = _SYS_QZS_;
+
+    bitcur_init(&bc, rtcm->buff, rtcm->len, 24 + 12);
+
+    if (bc.pos + 473 <= (int)rtcm->len * 8)
+    {
+        prn = bitcur_getu(&bc, 4) + 192;
+        toc = bitcur_getu(&bc, 16) * 16.0;
+        eph.f2 = bitcur_gets(&bc, 8) * P2_55;
+        eph.f1 = bitcur_gets(&bc, 16) * P2_43;
+        eph.f0 = bitcur_gets(&bc, 22) * P2_31;
+        eph.iode = bitcur_getu(&bc, 8);
+        eph.crs = bitcur_gets(&bc, 16) * P2_5;
+        eph.deln = bitcur_gets(&bc, 16) * P2_43 * SC2RAD;
+        eph.M0 = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.cuc = bitcur_gets(&bc, 16) * P2_29;
+        eph.e = bitcur_getu(&bc, 32) * P2_33;
+        eph.cus = bitcur_gets(&bc, 16) * P2_29;
+        sqrtA = bitcur_getu(&bc, 32) * P2_19;
+        eph.toes = bitcur_getu(&bc, 16) * 16.0;
+        eph.cic = bitcur_gets(&bc, 16) * P2_29;
+        eph.OMG0 = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.cis = bitcur_gets(&bc, 16) * P2_29;
+        eph.i0 = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.crc = bitcur_gets(&bc, 16) * P2_5;
+        eph.omg = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.OMGd = bitcur_gets(&bc, 24) * P2_43 * SC2RAD;
+        eph.idot = bitcur_gets(&bc, 14) * P2_43 * SC2RAD;
+        eph.code = bitcur_getu(&bc, 2);
+        week = bitcur_getu(&bc, 10);
+        eph.sva = bitcur_getu(&bc, 4);
+        eph.svh = bitcur_getu(&bc, 6);
+        eph.tgd[0] = bitcur_gets(&bc, 8) * P2_31;
+        eph.iodc = bitcur_getu(&bc, 10);
+        eph.fit = bitcur_getu(&bc, 1) ? 0.0 : 2.0; /* 0:2hr,1:>2hr */
     }
     else
     {
@@ -2516,76 +2905,55 @@ static int decode_type1044(rtcm_t *rtcm, nav_t *nav)
     
     /* do not use QZSS now */
 #ifdef ENAQZS
-	if (add_eph(&eph, nav) == 1)
+	if (add_eph(&eph, nav, ns) == 1)
 		++nav->n_qzs;
+#else
+    (void)nav;
+    (void)ns;
 #endif
 
     return 2;
 }
 /* decode type 1045: galileo F/NAV satellite ephemerides (ref [15]) ----------*/
-static int decode_type1045(rtcm_t *rtcm, nav_t *nav)
+static int decode_type1045(rtcm_t *rtcm, nav_t *nav, navslot_t *ns)
 {
     eph_t eph = {0};
     double toc, sqrtA, ws;
-    int i = 24 + 12, prn, sat, week, e5a_hs, e5a_dvs, rsv, sys = _SYS_GAL_, wk;
-
-    if (i + 484 <= rtcm->len * 8)
-    {
-        prn = rtcm_getbitu(rtcm->buff, i, 6);
-        i += 6;
-        week = rtcm_getbitu(rtcm->buff, i, 12);
-        i += 12; /* gst-week */
-        eph.iode = rtcm_getbitu(rtcm->buff, i, 10);
-        i += 10;
-        eph.sva = rtcm_getbitu(rtcm->buff, i, 8);
-        i += 8;
-        eph.idot = rtcm_getbits(rtcm->buff, i, 14) * P2_43 * SC2RAD;
-        i += 14;
-        toc = rtcm_getbitu(rtcm->buff, i, 14) * 60.0;
-        i += 14;
-        eph.f2 = rtcm_getbits(rtcm->buff, i, 6) * P2_59;
-        i += 6;
-        eph.f1 = rtcm_getbits(rtcm->buff, i, 21) * P2_46;
-        i += 21;
-        eph.f0 = rtcm_getbits(rtcm->buff, i, 31) * P2_34;
-        i += 31;
-        eph.crs = rtcm_getbits(rtcm->buff, i, 16) * P2_5;
-        i += 16;
-        eph.deln = rtcm_getbits(rtcm->buff, i, 16) * P2_43 * SC2RAD;
-        i += 16;
-        eph.M0 = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.cuc = rtcm_getbits(rtcm->buff, i, 16) * P2_29;
-        i += 16;
-        eph.e = rtcm_getbitu(rtcm->buff, i, 32) * P2_33;
-        i += 32;
-        eph.cus = rtcm_getbits(rtcm->buff, i, 16) * P2_29;
-        i += 16;
-        sqrtA = rtcm_getbitu(rtcm->buff, i, 32) * P2_19;
-        i += 32;
-        eph.toes = rtcm_getbitu(rtcm->buff, i, 14) * 60.0;
-        i += 14;
-        eph.cic = rtcm_getbits(rtcm->buff, i, 16) * P2_29;
-        i += 16;
-        eph.OMG0 = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.cis = rtcm_getbits(rtcm->buff, i, 16) * P2_29;
-        i += 16;
-        eph.i0 = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.crc = rtcm_getbits(rtcm->buff, i, 16) * P2_5;
-        i += 16;
-        eph.omg = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.OMGd = rtcm_getbits(rtcm->buff, i, 24) * P2_43 * SC2RAD;
-        i += 24;
-        eph.tgd[0] = rtcm_getbits(rtcm->buff, i, 10) * P2_32;
-        i += 10; /* E5a/E1 */
-        e5a_hs = rtcm_getbitu(rtcm->buff, i, 2);
-        i += 2; /* OSHS */
-        e5a_dvs = rtcm_getbitu(rtcm->buff, i, 1);
-        i += 1; /* OSDVS */
-        rsv = rtcm_getbitu(rtcm->buff, i, 7);
+    bitcur_t bc;
+    int prn, sat, week, e5a_hs, e5a_dvs, rsv, sys = _SYS_GAL_, wk;
+
+    bitcur_init(&bc, rtcm->buff, rtcm->len, 24 + 12);
+
+    if (bc.pos + 484 <= (int)rtcm->len * 8)
+    {
+        prn = bitcur_getu(&bc, 6);
+        week = bitcur_getu(&bc, 12); /* gst-week */
+        eph.iode = bitcur_getu(&bc, 10);
+        eph.sva = bitcur_getu(&bc, 8);
+        eph.idot = bitcur_gets(&bc, 14) * P2_43 * SC2RAD;
+        toc = bitcur_getu(&bc, 14) * 60.0;
+        eph.f2 = bitcur_gets(&bc, 6) * P2_59;
+        eph.f1 = bitcur_gets(&bc, 21) * P2_46;
+        eph.f0 = bitcur_gets(&bc, 31) * P2_34;
+        eph.crs = bitcur_gets(&bc, 16) * P2_5;
+        eph.deln = bitcur_gets(&bc, 16) * P2_43 * SC2RAD;
+        eph.M0 = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.cuc = bitcur_gets(&bc, 16) * P2_29;
+        eph.e = bitcur_getu(&bc, 32) * P2_33;
+        eph.cus = bitcur_gets(&bc, 16) * P2_29;
+        sqrtA = bitcur_getu(&bc, 32) * P2_19;
+        eph.toes = bitcur_getu(&bc, 14) * 60.0;
+        eph.cic = bitcur_gets(&bc, 16) * P2_29;
+        eph.OMG0 = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.cis = bitcur_gets(&bc, 16) * P2_29;
+        eph.i0 = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.crc = bitcur_gets(&bc, 16) * P2_5;
+        eph.omg = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.OMGd = bitcur_gets(&bc, 24) * P2_43 * SC2RAD;
+        eph.tgd[0] = bitcur_gets(&bc, 10) * P2_32; /* E5a/E1 */
+        e5a_hs = bitcur_getu(&bc, 2); /* OSHS */
+        e5a_dvs = bitcur_getu(&bc, 1); /* OSDVS */
+        rsv = bitcur_getu(&bc, 7);
     }
     else
     {
@@ -2612,80 +2980,53 @@ static int decode_type1045(rtcm_t *rtcm, nav_t *nav)
     eph.svh = (e5a_hs << 4) + (e5a_dvs << 3);
     eph.code = (1 << 1) | (1 << 8); /* data source = f/nav e5a + af0-2,toc,sisa for e5a-e1 */
     
-    if (add_eph(&eph, nav) == 1)
+    if (add_eph(&eph, nav, ns) == 1)
 		++nav->n_gal;
 
     return 2;
 }
 /* decode type 1046: galileo I/NAV satellite ephemerides (ref [17]) ----------*/
-static int decode_type1046(rtcm_t *rtcm, nav_t *nav)
+static int decode_type1046(rtcm_t *rtcm, nav_t *nav, navslot_t *ns)
 {
     eph_t eph = {0};
     double toc, sqrtA, ws;
-    int i = 24 + 12, prn, sat, week, e5b_hs, e5b_dvs, e1_hs, e1_dvs, sys = _SYS_GAL_, wk;
-
-    if (i + 492 <= rtcm->len * 8)
-    {
-        prn = rtcm_getbitu(rtcm->buff, i, 6);
-        i += 6;
-        week = rtcm_getbitu(rtcm->buff, i, 12);
-        i += 12;
-        eph.iode = rtcm_getbitu(rtcm->buff, i, 10);
-        i += 10;
-        eph.sva = rtcm_getbitu(rtcm->buff, i, 8);
-        i += 8;
-        eph.idot = rtcm_getbits(rtcm->buff, i, 14) * P2_43 * SC2RAD;
-        i += 14;
-        toc = rtcm_getbitu(rtcm->buff, i, 14) * 60.0;
-        i += 14;
-        eph.f2 = rtcm_getbits(rtcm->buff, i, 6) * P2_59;
-        i += 6;
-        eph.f1 = rtcm_getbits(rtcm->buff, i, 21) * P2_46;
-        i += 21;
-        eph.f0 = rtcm_getbits(rtcm->buff, i, 31) * P2_34;
-        i += 31;
-        eph.crs = rtcm_getbits(rtcm->buff, i, 16) * P2_5;
-        i += 16;
-        eph.deln = rtcm_getbits(rtcm->buff, i, 16) * P2_43 * SC2RAD;
-        i += 16;
-        eph.M0 = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.cuc = rtcm_getbits(rtcm->buff, i, 16) * P2_29;
-        i += 16;
-        eph.e = rtcm_getbitu(rtcm->buff, i, 32) * P2_33;
-        i += 32;
-        eph.cus = rtcm_getbits(rtcm->buff, i, 16) * P2_29;
-        i += 16;
-        sqrtA = rtcm_getbitu(rtcm->buff, i, 32) * P2_19;
-        i += 32;
-        eph.toes = rtcm_getbitu(rtcm->buff, i, 14) * 60.0;
-        i += 14;
-        eph.cic = rtcm_getbits(rtcm->buff, i, 16) * P2_29;
-        i += 16;
-        eph.OMG0 = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.cis = rtcm_getbits(rtcm->buff, i, 16) * P2_29;
-        i += 16;
-        eph.i0 = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.crc = rtcm_getbits(rtcm->buff, i, 16) * P2_5;
-        i += 16;
-        eph.omg = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.OMGd = rtcm_getbits(rtcm->buff, i, 24) * P2_43 * SC2RAD;
-        i += 24;
-        eph.tgd[0] = rtcm_getbits(rtcm->buff, i, 10) * P2_32;
-        i += 10; /* E5a/E1 */
-        eph.tgd[1] = rtcm_getbits(rtcm->buff, i, 10) * P2_32;
-        i += 10; /* E5b/E1 */
-        e5b_hs = rtcm_getbitu(rtcm->buff, i, 2);
-        i += 2; /* E5b OSHS */
-        e5b_dvs = rtcm_getbitu(rtcm->buff, i, 1);
-        i += 1; /* E5b OSDVS */
-        e1_hs = rtcm_getbitu(rtcm->buff, i, 2);
-        i += 2; /* E1 OSHS */
-        e1_dvs = rtcm_getbitu(rtcm->buff, i, 1);
-        i += 1; /* E1 OSDVS */
+    bitcur_t bc;
+    int prn, sat, week, e5b_hs, e5b_dvs, e1_hs, e1_dvs, sys = _SYS_GAL_, wk;
+
+    bitcur_init(&bc, rtcm->buff, rtcm->len, 24 + 12);
+
+    if (bc.pos + 492 <= (int)rtcm->len * 8)
+    {
+        prn = bitcur_getu(&bc, 6);
+        week = bitcur_getu(&bc, 12);
+        eph.iode = bitcur_getu(&bc, 10);
+        eph.sva = bitcur_getu(&bc, 8);
+        eph.idot = bitcur_gets(&bc, 14) * P2_43 * SC2RAD;
+        toc = bitcur_getu(&bc, 14) * 60.0;
+        eph.f2 = bitcur_gets(&bc, 6) * P2_59;
+        eph.f1 = bitcur_gets(&bc, 21) * P2_46;
+        eph.f0 = bitcur_gets(&bc, 31) * P2_34;
+        eph.crs = bitcur_gets(&bc, 16) * P2_5;
+        eph.deln = bitcur_gets(&bc, 16) * P2_43 * SC2RAD;
+        eph.M0 = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.cuc = bitcur_gets(&bc, 16) * P2_29;
+        eph.e = bitcur_getu(&bc, 32) * P2_33;
+        eph.cus = bitcur_gets(&bc, 16) * P2_29;
+        sqrtA = bitcur_getu(&bc, 32) * P2_19;
+        eph.toes = bitcur_getu(&bc, 14) * 60.0;
+        eph.cic = bitcur_gets(&bc, 16) * P2_29;
+        eph.OMG0 = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.cis = bitcur_gets(&bc, 16) * P2_29;
+        eph.i0 = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.crc = bitcur_gets(&bc, 16) * P2_5;
+        eph.omg = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.OMGd = bitcur_gets(&bc, 24) * P2_43 * SC2RAD;
+        eph.tgd[0] = bitcur_gets(&bc, 10) * P2_32; /* E5a/E1 */
+        eph.tgd[1] = bitcur_gets(&bc, 10) * P2_32; /* E5b/E1 */
+        e5b_hs = bitcur_getu(&bc, 2); /* E5b OSHS */
+        e5b_dvs = bitcur_getu(&bc, 1); /* E5b OSDVS */
+        e1_hs = bitcur_getu(&bc, 2); /* E1 OSHS */
+        e1_dvs = bitcur_getu(&bc, 1); /* E1 OSDVS */
     }
     else
     {
@@ -2713,76 +3054,51 @@ static int decode_type1046(rtcm_t *rtcm, nav_t *nav)
     eph.svh = (e5b_hs << 7) + (e5b_dvs << 6) + (e1_hs << 1) + (e1_dvs << 0);
     eph.code = (1 << 0) | (1 << 9); /* data source = i/nav e1b + af0-2,toc,sisa for e5b-e1 */
 
-    if (add_eph(&eph, nav)==1)
+    if (add_eph(&eph, nav, ns)==1)
 		++nav->n_gal;
     
     return 2;
 }
 /* decode type 1042/63: beidou ephemerides -----------------------------------*/
-static int decode_type1042(rtcm_t *rtcm, nav_t *nav)
+static int decode_type1042(rtcm_t *rtcm, nav_t *nav, navslot_t *ns)
 {
     eph_t eph = {0};
     double toc, sqrtA, ws;
-    int i = 24 + 12, prn, sat, week, sys = _SYS_BDS_, wk;
-
-    if (i + 499 <= rtcm->len * 8)
-    {
-        prn = rtcm_getbitu(rtcm->buff, i, 6);
-        i += 6;
-        week = rtcm_getbitu(rtcm->buff, i, 13);
-        i += 13;
-        eph.sva = rtcm_getbitu(rtcm->buff, i, 4);
-        i += 4;
-        eph.idot = rtcm_getbits(rtcm->buff, i, 14) * P2_43 * SC2RAD;
-        i += 14;
-        eph.iode = rtcm_getbitu(rtcm->buff, i, 5);
-        i += 5; /* AODE */
-        toc = rtcm_getbitu(rtcm->buff, i, 17) * 8.0;
-        i += 17;
-        eph.f2 = rtcm_getbits(rtcm->buff, i, 11) * P2_66;
-        i += 11;
-        eph.f1 = rtcm_getbits(rtcm->buff, i, 22) * P2_50;
-        i += 22;
-        eph.f0 = rtcm_getbits(rtcm->buff, i, 24) * P2_33;
-        i += 24;
-        eph.iodc = rtcm_getbitu(rtcm->buff, i, 5);
-        i += 5; /* AODC */
-        eph.crs = rtcm_getbits(rtcm->buff, i, 18) * P2_6;
-        i += 18;
-        eph.deln = rtcm_getbits(rtcm->buff, i, 16) * P2_43 * SC2RAD;
-        i += 16;
-        eph.M0 = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.cuc = rtcm_getbits(rtcm->buff, i, 18) * P2_31;
-        i += 18;
-        eph.e = rtcm_getbitu(rtcm->buff, i, 32) * P2_33;
-        i += 32;
-        eph.cus = rtcm_getbits(rtcm->buff, i, 18) * P2_31;
-        i += 18;
-        sqrtA = rtcm_getbitu(rtcm->buff, i, 32) * P2_19;
-        i += 32;
-        eph.toes = rtcm_getbitu(rtcm->buff, i, 17) * 8.0;
-        i += 17;
-        eph.cic = rtcm_getbits(rtcm->buff, i, 18) * P2_31;
-        i += 18;
-        eph.OMG0 = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.cis = rtcm_getbits(rtcm->buff, i, 18) * P2_31;
-        i += 18;
-        eph.i0 = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.crc = rtcm_getbits(rtcm->buff, i, 18) * P2_6;
-        i += 18;
-        eph.omg = rtcm_getbits(rtcm->buff, i, 32) * P2_31 * SC2RAD;
-        i += 32;
-        eph.OMGd = rtcm_getbits(rtcm->buff, i, 24) * P2_43 * SC2RAD;
-        i += 24;
-        eph.tgd[0] = rtcm_getbits(rtcm->buff, i, 10) * 1E-10;
-        i += 10;
-        eph.tgd[1] = rtcm_getbits(rtcm->buff, i, 10) * 1E-10;
-        i += 10;
-        eph.svh = rtcm_getbitu(rtcm->buff, i, 1);
-        i += 1;
+    bitcur_t bc;
+    int prn, sat, week, sys = _SYS_BDS_, wk;
+
+    bitcur_init(&bc, rtcm->buff, rtcm->len, 24 + 12);
+
+    if (bc.pos + 499 <= (int)rtcm->len * 8)
+    {
+        prn = bitcur_getu(&bc, 6);
+        week = bitcur_getu(&bc, 13);
+        eph.sva = bitcur_getu(&bc, 4);
+        eph.idot = bitcur_gets(&bc, 14) * P2_43 * SC2RAD;
+        eph.iode = bitcur_getu(&bc, 5); /* AODE */
+        toc = bitcur_getu(&bc, 17) * 8.0;
+        eph.f2 = bitcur_gets(&bc, 11) * P2_66;
+        eph.f1 = bitcur_gets(&bc, 22) * P2_50;
+        eph.f0 = bitcur_gets(&bc, 24) * P2_33;
+        eph.iodc = bitcur_getu(&bc, 5); /* AODC */
+        eph.crs = bitcur_gets(&bc, 18) * P2_6;
+        eph.deln = bitcur_gets(&bc, 16) * P2_43 * SC2RAD;
+        eph.M0 = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.cuc = bitcur_gets(&bc, 18) * P2_31;
+        eph.e = bitcur_getu(&bc, 32) * P2_33;
+        eph.cus = bitcur_gets(&bc, 18) * P2_31;
+        sqrtA = bitcur_getu(&bc, 32) * P2_19;
+        eph.toes = bitcur_getu(&bc, 17) * 8.0;
+        eph.cic = bitcur_gets(&bc, 18) * P2_31;
+        eph.OMG0 = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.cis = bitcur_gets(&bc, 18) * P2_31;
+        eph.i0 = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.crc = bitcur_gets(&bc, 18) * P2_6;
+        eph.omg = bitcur_gets(&bc, 32) * P2_31 * SC2RAD;
+        eph.OMGd = bitcur_gets(&bc, 24) * P2_43 * SC2RAD;
+        eph.tgd[0] = bitcur_gets(&bc, 10) * 1E-10;
+        eph.tgd[1] = bitcur_gets(&bc, 10) * 1E-10;
+        eph.svh = bitcur_getu(&bc, 1);
     }
     else
     {
@@ -2807,7 +3123,7 @@ static int decode_type1042(rtcm_t *rtcm, nav_t *nav)
     eph.ttr = rtcm->time;
     eph.A = sqrtA * sqrtA;
 
-    if (add_eph(&eph, nav) == 1)
+    if (add_eph(&eph, nav, ns) == 1)
 		++nav->n_bds;
 
     return 2;
@@ -2846,90 +3162,153 @@ static int decode_type4001(rtcm_t *rtcm)
 	return i;
 }
 
-/* save obs data in msm message ----------------------------------------------*/
-static void save_msm_obs(rtcm_t *rtcm, obs_t *obs, int sys, msm_h_t *h, const double *r,
-                         const double *pr, const double *cp, const double *rr,
-                         const double *rrf, const double *cnr, const int *lock,
-                         const int *ex, const int *half)
+/* msm signal mapping cache ---------------------------------------------------
+* code/frequency/obs index of each signal of a mask only depends on the system
+* and the signal mask, which a station repeats every epoch, and on the code
+* priorities, so setcodepri() flushes it
+*-----------------------------------------------------------------------------*/
+#define MSMSIG_NCACHE 8                  /* number of cached signal masks */
+
+typedef struct {                        /* msm signal mapping type */
+    int sys;                               /* navigation system (0: empty) */
+    unsigned int sigmask;                  /* signal mask */
+    unsigned char code[32];                /* obs code of each signal */
+    unsigned char freq[32];                /* frequency index (1:L1,2:L2,...) */
+    signed char ind[32];                   /* index in obs data (-1: no space) */
+    char type[128];                        /* msm signal types */
+} msmsig_t;
+
+static msmsig_t msmsig[MSMSIG_NCACHE];
+static int msmsig_next = 0;
+
+/* drop the cached mappings, the code priorities changed ------------------------*/
+static void msmsig_flush(void)
+{
+    memset(msmsig, 0, sizeof(msmsig));
+    msmsig_next = 0;
+}
+
+/* resolve signal mapping of msm header ----------------------------------------*/
+static void msmsig_map(int type, int sys, const msm_h_t *h, msmsig_t *m)
 {
-    const char *sig[32];
-    double tt, wl;
-    unsigned char code[32];
-    char *msm_type = "", *q = NULL;
-    int i, j, k, type, prn, sat, fn, index = 0, freq[32], ind[32];
+    const char *sig;
+    char *q = m->type;
+    int i, freq[32], ind[32];
     char opt[256] = {0};
-	obsd_t obsd = { 0 };
 
-    type = rtcm_getbitu(rtcm->buff, 24, 12);
+    m->type[0] = '\0';
 
-    switch (sys)
-    {
-    case _SYS_GPS_:
-        msm_type = q = rtcm->msmtype[0];
-        break;
-    case _SYS_GLO_:
-        msm_type = q = rtcm->msmtype[1];
-        break;
-    case _SYS_GAL_:
-        msm_type = q = rtcm->msmtype[2];
-        break;
-    case _SYS_QZS_:
-        msm_type = q = rtcm->msmtype[3];
-        break;
-    case _SYS_SBS_:
-        msm_type = q = rtcm->msmtype[4];
-        break;
-    case _SYS_BDS_:
-        msm_type = q = rtcm->msmtype[5];
-        break;
-    }
     /* id to signal */
     for (i = 0; i < h->nsig; i++)
     {
         switch (sys)
         {
         case _SYS_GPS_:
-            sig[i] = rtcm_msm_sig_gps[h->sigs[i] - 1];
+            sig = rtcm_msm_sig_gps[h->sigs[i] - 1];
             break;
         case _SYS_GLO_:
-            sig[i] = rtcm_msm_sig_glo[h->sigs[i] - 1];
+            sig = rtcm_msm_sig_glo[h->sigs[i] - 1];
             break;
         case _SYS_GAL_:
-            sig[i] = msm_sig_gal[h->sigs[i] - 1];
+            sig = msm_sig_gal[h->sigs[i] - 1];
             break;
         case _SYS_QZS_:
-            sig[i] = msm_sig_qzs[h->sigs[i] - 1];
+            sig = msm_sig_qzs[h->sigs[i] - 1];
             break;
         case _SYS_SBS_:
-            sig[i] = msm_sig_sbs[h->sigs[i] - 1];
+            sig = msm_sig_sbs[h->sigs[i] - 1];
             break;
         case _SYS_BDS_:
-            sig[i] = msm_sig_cmp[h->sigs[i] - 1];
+            sig = msm_sig_cmp[h->sigs[i] - 1];
             break;
         default:
-            sig[i] = "";
+            sig = "";
             break;
         }
         /* signal to rinex obs type */
-        code[i] = obs2code(sys, sig[i], freq + i);
+        m->code[i] = obs2code(sys, sig, freq + i);
 
-        if (code[i] != CODE_NONE)
+        if (m->code[i] != CODE_NONE)
         {
-            if (q)
-                q += sprintf(q, "L%s%s", sig[i], i < h->nsig - 1 ? "," : "");
+            q += sprintf(q, "L%s%s", sig, i < h->nsig - 1 ? "," : "");
         }
         else
         {
-            if (q)
-                q += sprintf(q, "(%d)%s", h->sigs[i], i < h->nsig - 1 ? "," : "");
+            q += sprintf(q, "(%d)%s", h->sigs[i], i < h->nsig - 1 ? "," : "");
 
             trace(2, "rtcm3 %d: unknown signal id=%2d\n", type, h->sigs[i]);
         }
     }
-    trace(3, "rtcm3 %d: signals=%s\n", type, msm_type);
+    trace(3, "rtcm3 %d: nsig=%d\n", type, h->nsig);
 
     /* get signal index */
-    sigindex(sys, code, freq, h->nsig, opt, ind);
+    sigindex(sys, m->code, freq, h->nsig, opt, ind);
+
+    for (i = 0; i < h->nsig; i++)
+    {
+        m->freq[i] = (unsigned char)freq[i];
+        m->ind[i] = (signed char)ind[i];
+    }
+    m->sigmask = h->sigmask;
+    m->sys = sys;
+}
+/* get signal mapping of msm header, resolved on a cache miss -------------------*/
+static const msmsig_t *msmsig_get(int type, int sys, const msm_h_t *h)
+{
+    msmsig_t *m;
+    int i;
+
+    for (i = 0; i < MSMSIG_NCACHE; i++)
+    {
+        if (msmsig[i].sys == sys && msmsig[i].sigmask == h->sigmask)
+        {
+            return msmsig + i;
+        }
+    }
+    m = msmsig + msmsig_next;
+    msmsig_next = (msmsig_next + 1) % MSMSIG_NCACHE;
+
+    msmsig_map(type, sys, h, m);
+    return m;
+}
+/* save obs data in msm message ----------------------------------------------*/
+static void save_msm_obs(rtcm_t *rtcm, obs_t *obs, satslot_t *slot, int sys, msm_h_t *h, const double *r,
+                         const double *pr, const double *cp, const double *rr,
+                         const double *rrf, const double *cnr, const int *lock,
+                         const int *ex, const int *half)
+{
+    const msmsig_t *m;
+    double wl;
+    char *q = NULL;
+    int i, j, k, type, prn, sat, fn;
+	obsd_t obsd = { 0 };
+
+    type = rtcm_getbitu(rtcm->buff, 24, 12);
+
+    switch (sys)
+    {
+    case _SYS_GPS_:
+        q = rtcm->msmtype[0];
+        break;
+    case _SYS_GLO_:
+        q = rtcm->msmtype[1];
+        break;
+    case _SYS_GAL_:
+        q = rtcm->msmtype[2];
+        break;
+    case _SYS_QZS_:
+        q = rtcm->msmtype[3];
+        break;
+    case _SYS_SBS_:
+        q = rtcm->msmtype[4];
+        break;
+    case _SYS_BDS_:
+        q = rtcm->msmtype[5];
+        break;
+    }
+    m = msmsig_get(type, sys, h);
+    if (q)
+        strcpy(q, m->type);
 
     for (i = j = 0; i < h->nsat; i++)
     {
@@ -2957,36 +3336,36 @@ static void save_msm_obs(rtcm_t *rtcm, obs_t *obs, int sys, msm_h_t *h, const do
                 continue;
 
 			//if (sat && index>=0 && ind[k] >= 0)
-            if (sat && ind[k] >= 0)
+            if (sat && m->ind[k] >= 0)
             {
 
                 /* satellite carrier wave length */
-                wl = satwavelen(sat, freq[k] - 1);
+                wl = satwavelen(sat, m->freq[k] - 1);
 
                 /* glonass wave length by extended info */
                 if (sys == _SYS_GLO_ && ex && ex[i] <= 13)
                 {
                     fn = ex[i] - 7;
-                    wl = CLIGHT / ((freq[k] == 2 ? FREQ2_GLO : FREQ1_GLO) +
-                                   (freq[k] == 2 ? DFRQ2_GLO : DFRQ1_GLO) * fn);
+                    wl = CLIGHT / ((m->freq[k] == 2 ? FREQ2_GLO : FREQ1_GLO) +
+                                   (m->freq[k] == 2 ? DFRQ2_GLO : DFRQ1_GLO) * fn);
                 }
                 /* pseudorange (m) */
                 if (r[i] != 0.0 && pr[j] > -1E12)
                 {
                     //obs->data[index].P[ind[k]] = r[i] + pr[j];
-					obsd.P[ind[k]] = r[i] + pr[j];
+					obsd.P[m->ind[k]] = r[i] + pr[j];
                 }
                 /* carrier-phase (cycle) */
                 if (r[i] != 0.0 && cp[j] > -1E12 && wl > 0.0)
                 {
                     //obs->data[index].L[ind[k]] = (r[i] + cp[j]) / wl;
-					obsd.L[ind[k]] = (r[i] + cp[j]) / wl;
+					obsd.L[m->ind[k]] = (r[i] + cp[j]) / wl;
                 }
                 /* doppler (hz) */
                 if (rr && rrf && rrf[j] > -1E12 && wl > 0.0)
                 {
                     //obs->data[index].D[ind[k]] = (float)(-(rr[i] + rrf[j]) / wl);
-					obsd.D[ind[k]] = (float)(-(rr[i] + rrf[j]) / wl);
+					obsd.D[m->ind[k]] = (float)(-(rr[i] + rrf[j]) / wl);
                 }
                 //obs->data[index].LLI[ind[k]] = (unsigned char)
                 //                                   lossoflock(rtcm, sat, ind[k], lock[j]) +
@@ -2994,11 +3373,11 @@ static void save_msm_obs(rtcm_t *rtcm, obs_t *obs, int sys, msm_h_t *h, const do
                 //obs->data[index].SNR[ind[k]] = (unsigned char)(cnr[j] * 4.0);
                 //obs->data[index].code[ind[k]] = code[k];
 
-				obsd.LLI[ind[k]] = (unsigned char)lossoflock(rtcm, sat, ind[k], lock[j]) +
+				obsd.LLI[m->ind[k]] = (unsigned char)lossoflock(rtcm, sat, m->ind[k], lock[j]) +
 					               (half[j] ? 2 : 0);
-				obsd.SNR[ind[k]] = (unsigned char)(cnr[j] * 4.0);
-				obsd.code[ind[k]] = code[k];
-				add_obs(&obsd, obs);
+				obsd.SNR[m->ind[k]] = (unsigned char)(cnr[j] * 4.0);
+				obsd.code[m->ind[k]] = m->code[k];
+				add_obs(&obsd, obs, slot);
             }
             j++;
         }
@@ -3006,69 +3385,58 @@ static void save_msm_obs(rtcm_t *rtcm, obs_t *obs, int sys, msm_h_t *h, const do
 }
 /* decode type msm message header --------------------------------------------*/
 static int decode_msm_head(rtcm_t *rtcm, obs_t *obs, int sys, int *sync, int *iod,
-                           msm_h_t *h, int *hsize)
+                           msm_h_t *h, bitcur_t *bc)
 {
     msm_h_t h0 = {0};
     double tow, tod;
-    char tstr[64];
-    int i = 24, j, dow, mask, staid, type, ncell = 0;
+    uint64_t satmask;
+    unsigned int sigmask;
+    int j, dow, staid, type, ncell = 0;
 
-    type = rtcm_getbitu(rtcm->buff, i, 12);
-    i += 12;
+    bitcur_init(bc, rtcm->buff, rtcm->len, 24);
+    type = bitcur_getu(bc, 12);
 
     *h = h0;
-    if (i + 157 <= rtcm->len * 8)
+    if (bc->pos + 157 <= (int)rtcm->len * 8)
     {
-        staid = rtcm_getbitu(rtcm->buff, i, 12);
-        i += 12;
+        staid = bitcur_getu(bc, 12);
 
         if (sys == _SYS_GLO_)
         {
-            dow = rtcm_getbitu(rtcm->buff, i, 3);
-            i += 3;
-            tod = rtcm_getbitu(rtcm->buff, i, 27) * 0.001;
-            i += 27;
+            dow = bitcur_getu(bc, 3);
+            tod = bitcur_getu(bc, 27) * 0.001;
             adjday_glot(&rtcm->time, tod);
         }
         else if (sys == _SYS_BDS_)
         {
-            tow = rtcm_getbitu(rtcm->buff, i, 30) * 0.001;
-            i += 30;
+            tow = bitcur_getu(bc, 30) * 0.001;
             tow += 14.0; /* BDT -> GPST */
             adjweek(&rtcm->time, tow);
         }
         else
         {
-            tow = rtcm_getbitu(rtcm->buff, i, 30) * 0.001;
-            i += 30;
+            tow = bitcur_getu(bc, 30) * 0.001;
             adjweek(&rtcm->time, tow);
         }
-        *sync = rtcm_getbitu(rtcm->buff, i, 1);
-        i += 1;
-        *iod = rtcm_getbitu(rtcm->buff, i, 3);
-        i += 3;
-        h->time_s = (unsigned char)rtcm_getbitu(rtcm->buff, i, 7);
-        i += 7;
-        h->clk_str = (unsigned char)rtcm_getbitu(rtcm->buff, i, 2);
-        i += 2;
-        h->clk_ext = (unsigned char)rtcm_getbitu(rtcm->buff, i, 2);
-        i += 2;
-        h->smooth = (unsigned char)rtcm_getbitu(rtcm->buff, i, 1);
-        i += 1;
-        h->tint_s = (unsigned char)rtcm_getbitu(rtcm->buff, i, 3);
-        i += 3;
+        *sync = bitcur_getu(bc, 1);
+        *iod = bitcur_getu(bc, 3);
+        h->time_s = (unsigned char)bitcur_getu(bc, 7);
+        h->clk_str = (unsigned char)bitcur_getu(bc, 2);
+        h->clk_ext = (unsigned char)bitcur_getu(bc, 2);
+        h->smooth = (unsigned char)bitcur_getu(bc, 1);
+        h->tint_s = (unsigned char)bitcur_getu(bc, 3);
+        satmask = (uint64_t)bitcur_getu(bc, 32) << 32;
+        satmask |= bitcur_getu(bc, 32);
+        sigmask = bitcur_getu(bc, 32);
+        h->sigmask = sigmask;
         for (j = 1; j <= 64; j++)
         {
-            mask = rtcm_getbitu(rtcm->buff, i, 1);
-            i += 1;
-            if (mask)
+            if ((satmask >> (64 - j)) & 1)
                 h->sats[h->nsat++] = (unsigned char)j;
         }
         for (j = 1; j <= 32; j++)
         {
-            mask = rtcm_getbitu(rtcm->buff, i, 1);
-            i += 1;
-            if (mask)
+            if ((sigmask >> (32 - j)) & 1)
                 h->sigs[h->nsig++] = (unsigned char)j;
         }
     }
@@ -3087,7 +3455,7 @@ static int decode_msm_head(rtcm_t *rtcm, obs_t *obs, int sys, int *sync, int *io
               type, h->nsat, h->nsig);
         return -1;
     }
-    if (i + h->nsat * h->nsig > rtcm->len * 8)
+    if (bc->pos + h->nsat * h->nsig > (int)rtcm->len * 8)
     {
         trace(2, "rtcm3 %d length error: len=%d nsat=%d nsig=%d\n", type,
               rtcm->len, h->nsat, h->nsig);
@@ -3095,16 +3463,12 @@ static int decode_msm_head(rtcm_t *rtcm, obs_t *obs, int sys, int *sync, int *io
     }
     for (j = 0; j < h->nsat * h->nsig; j++)
     {
-        h->cellmask[j] = (unsigned char)rtcm_getbitu(rtcm->buff, i, 1);
-        i += 1;
+        h->cellmask[j] = (unsigned char)bitcur_getu(bc, 1);
         if (h->cellmask[j])
             ncell++;
     }
-    *hsize = i;
 
-    time2str(rtcm->time, tstr, 2);
-    trace(4, "decode_head_msm: time=%s sys=%c staid=%d nsat=%d nsig=%d sync=%d iod=%d ncell=%d\n",
-          tstr, sys2char(sys), staid, h->nsat, h->nsig, *sync, *iod, ncell);
+    trace(4, "decode_head_msm: time=%u staid=%d ncell=%d\n", (unsigned int)rtcm->time.time, staid, ncell);
 
     return ncell;
 }
@@ -3112,28 +3476,30 @@ static int decode_msm_head(rtcm_t *rtcm, obs_t *obs, int sys, int *sync, int *io
 static int decode_msm0(rtcm_t *rtcm, obs_t *obs, int sys)
 {
     msm_h_t h = {0};
-    int i, sync, iod;
+    bitcur_t bc;
+    int sync, iod;
 
-    if (decode_msm_head(rtcm, obs, sys, &sync, &iod, &h, &i) < 0)
+    if (decode_msm_head(rtcm, obs, sys, &sync, &iod, &h, &bc) < 0)
         return -1;
     obs->obsflag = !sync;
 
     return sync ? 0 : 1;
 }
 /* decode msm 4: full pseudorange and phaserange plus cnr --------------------*/
-static int decode_msm4(rtcm_t *rtcm, obs_t *obs, int sys)
+static int decode_msm4(rtcm_t *rtcm, obs_t *obs, satslot_t *slot, int sys)
 {
     msm_h_t h = {0};
     double r[64], pr[64], cp[64], cnr[64];
-    int i, j, type, sync, iod, ncell, rng, rng_m, prv, cpv, lock[64], half[64];
+    bitcur_t bc;
+    int j, type, sync, iod, ncell, rng, rng_m, prv, cpv, lock[64], half[64];
 
     type = rtcm_getbitu(rtcm->buff, 24, 12);
 
     /* decode msm header */
-    if ((ncell = decode_msm_head(rtcm, obs, sys, &sync, &iod, &h, &i)) < 0)
+    if ((ncell = decode_msm_head(rtcm, obs, sys, &sync, &iod, &h, &bc)) < 0)
         return -1;
 
-    if (i + h.nsat * 18 + ncell * 48 > rtcm->len * 8)
+    if (bc.pos + h.nsat * 18 + ncell * 48 > (int)rtcm->len * 8)
     {
         trace(2, "rtcm3 %d length error: nsat=%d ncell=%d len=%d\n", type, h.nsat,
               ncell, rtcm->len);
@@ -3147,70 +3513,64 @@ static int decode_msm4(rtcm_t *rtcm, obs_t *obs, int sys)
     /* decode satellite data */
     for (j = 0; j < h.nsat; j++)
     { /* range */
-        rng = rtcm_getbitu(rtcm->buff, i, 8);
-        i += 8;
+        rng = bitcur_getu(&bc, 8);
         if (rng != 255)
             r[j] = rng * RANGE_MS;
     }
     for (j = 0; j < h.nsat; j++)
     {
-        rng_m = rtcm_getbitu(rtcm->buff, i, 10);
-        i += 10;
+        rng_m = bitcur_getu(&bc, 10);
         if (r[j] != 0.0)
             r[j] += rng_m * P2_10 * RANGE_MS;
     }
     /* decode signal data */
     for (j = 0; j < ncell; j++)
     { /* pseudorange */
-        prv = rtcm_getbits(rtcm->buff, i, 15);
-        i += 15;
+        prv = bitcur_gets(&bc, 15);
         if (prv != -16384)
             pr[j] = prv * P2_24 * RANGE_MS;
     }
     for (j = 0; j < ncell; j++)
     { /* phaserange */
-        cpv = rtcm_getbits(rtcm->buff, i, 22);
-        i += 22;
+        cpv = bitcur_gets(&bc, 22);
         if (cpv != -2097152)
             cp[j] = cpv * P2_29 * RANGE_MS;
     }
     for (j = 0; j < ncell; j++)
     { /* lock time */
-        lock[j] = rtcm_getbitu(rtcm->buff, i, 4);
-        i += 4;
+        lock[j] = bitcur_getu(&bc, 4);
     }
     for (j = 0; j < ncell; j++)
     { /* half-cycle ambiguity */
-        half[j] = rtcm_getbitu(rtcm->buff, i, 1);
-        i += 1;
+        half[j] = bitcur_getu(&bc, 1);
     }
     for (j = 0; j < ncell; j++)
     { /* cnr */
-        cnr[j] = rtcm_getbitu(rtcm->buff, i, 6) * 1.0;
-        i += 6;
+        cnr[j] = bitcur_getu(&bc, 6) * 1.0;
     }
     /* save obs data in msm message */
-    save_msm_obs(rtcm, obs, sys, &h, r, pr, cp, NULL, NULL, cnr, lock, NULL, half);
+    save_msm_obs(rtcm, obs, slot, sys, &h, r, pr, cp, NULL, NULL, cnr, lock, NULL, half);
 
     obs->obsflag = !sync;
 
     return sync ? 0 : 1;
 }
 /* decode msm 5: full pseudorange, phaserange, phaserangerate and cnr --------*/
-static int decode_msm5(rtcm_t *rtcm, obs_t *obs, int sys)
+static int decode_msm5(rtcm_t *rtcm, obs_t *obs, satslot_t *slot, int sys)
 {
     msm_h_t h = {0};
     double r[64], rr[64], pr[64], cp[64], rrf[64], cnr[64];
-    int i, j, type, sync, iod, ncell, rng, rng_m, rate, prv, cpv, rrv, lock[64];
+    bitcur_t bc;
+    int j, type, sync, iod, ncell, rng, rng_m, rate, prv, cpv, rrv, lock[64];
     int ex[64], half[64];
 
     type = rtcm_getbitu(rtcm->buff, 24, 12);
 
     /* decode msm header */
-    if ((ncell = decode_msm_head(rtcm, obs, sys, &sync, &iod, &h, &i)) < 0)
+    if ((ncell = decode_msm_head(rtcm, obs, sys, &sync, &iod, &h, &bc)) < 0)
         return -1;
 
-    if (i + h.nsat * 36 + ncell * 63 > rtcm->len * 8)
+    if (bc.pos + h.nsat * 36 + ncell * 63 > (int)rtcm->len * 8)
     {
         trace(2, "rtcm3 %d length error: nsat=%d ncell=%d len=%d\n", type, h.nsat,
               ncell, rtcm->len);
@@ -3227,88 +3587,79 @@ static int decode_msm5(rtcm_t *rtcm, obs_t *obs, int sys)
     /* decode satellite data */
     for (j = 0; j < h.nsat; j++)
     { /* range */
-        rng = rtcm_getbitu(rtcm->buff, i, 8);
-        i += 8;
+        rng = bitcur_getu(&bc, 8);
         if (rng != 255)
             r[j] = rng * RANGE_MS;
     }
     for (j = 0; j < h.nsat; j++)
     { /* extended info */
-        ex[j] = rtcm_getbitu(rtcm->buff, i, 4);
-        i += 4;
+        ex[j] = bitcur_getu(&bc, 4);
     }
     for (j = 0; j < h.nsat; j++)
     {
-        rng_m = rtcm_getbitu(rtcm->buff, i, 10);
-        i += 10;
+        rng_m = bitcur_getu(&bc, 10);
         if (r[j] != 0.0)
             r[j] += rng_m * P2_10 * RANGE_MS;
     }
     for (j = 0; j < h.nsat; j++)
     { /* phaserangerate */
-        rate = rtcm_getbits(rtcm->buff, i, 14);
-        i += 14;
+        rate = bitcur_gets(&bc, 14);
         if (rate != -8192)
             rr[j] = rate * 1.0;
     }
     /* decode signal data */
     for (j = 0; j < ncell; j++)
     { /* pseudorange */
-        prv = rtcm_getbits(rtcm->buff, i, 15);
-        i += 15;
+        prv = bitcur_gets(&bc, 15);
         if (prv != -16384)
             pr[j] = prv * P2_24 * RANGE_MS;
     }
     for (j = 0; j < ncell; j++)
     { /* phaserange */
-        cpv = rtcm_getbits(rtcm->buff, i, 22);
-        i += 22;
+        cpv = bitcur_gets(&bc, 22);
         if (cpv != -2097152)
             cp[j] = cpv * P2_29 * RANGE_MS;
     }
     for (j = 0; j < ncell; j++)
     { /* lock time */
-        lock[j] = rtcm_getbitu(rtcm->buff, i, 4);
-        i += 4;
+        lock[j] = bitcur_getu(&bc, 4);
     }
     for (j = 0; j < ncell; j++)
     { /* half-cycle ambiguity */
-        half[j] = rtcm_getbitu(rtcm->buff, i, 1);
-        i += 1;
+        half[j] = bitcur_getu(&bc, 1);
     }
     for (j = 0; j < ncell; j++)
     { /* cnr */
-        cnr[j] = rtcm_getbitu(rtcm->buff, i, 6) * 1.0;
-        i += 6;
+        cnr[j] = bitcur_getu(&bc, 6) * 1.0;
     }
     for (j = 0; j < ncell; j++)
     { /* phaserangerate */
-        rrv = rtcm_getbits(rtcm->buff, i, 15);
-        i += 15;
+        rrv = bitcur_gets(&bc, 15);
         if (rrv != -16384)
             rrf[j] = rrv * 0.0001;
     }
     /* save obs data in msm message */
-    save_msm_obs(rtcm, obs, sys, &h, r, pr, cp, rr, rrf, cnr, lock, ex, half);
+    save_msm_obs(rtcm, obs, slot, sys, &h, r, pr, cp, rr, rrf, cnr, lock, ex, half);
 
     obs->obsflag = !sync;
 
     return sync ? 0 : 1;
 }
 /* decode msm 6: full pseudorange and phaserange plus cnr (high-res) ---------*/
-static int decode_msm6(rtcm_t *rtcm, obs_t *obs, int sys)
+static int decode_msm6(rtcm_t *rtcm, obs_t *obs, satslot_t *slot, int sys)
 {
     msm_h_t h = {0};
     double r[64], pr[64], cp[64], cnr[64];
-    int i, j, type, sync, iod, ncell, rng, rng_m, prv, cpv, lock[64], half[64];
+    bitcur_t bc;
+    int j, type, sync, iod, ncell, rng, rng_m, prv, cpv, lock[64], half[64];
 
     type = rtcm_getbitu(rtcm->buff, 24, 12);
 
     /* decode msm header */
-    if ((ncell = decode_msm_head(rtcm, obs, sys, &sync, &iod, &h, &i)) < 0)
+    if ((ncell = decode_msm_head(rtcm, obs, sys, &sync, &iod, &h, &bc)) < 0)
         return -1;
 
-    if (i + h.nsat * 18 + ncell * 65 > rtcm->len * 8)
+    if (bc.pos + h.nsat * 18 + ncell * 65 > (int)rtcm->len * 8)
     {
         trace(2, "rtcm3 %d length error: nsat=%d ncell=%d len=%d\n", type, h.nsat,
               ncell, rtcm->len);
@@ -3322,70 +3673,64 @@ static int decode_msm6(rtcm_t *rtcm, obs_t *obs, int sys)
     /* decode satellite data */
     for (j = 0; j < h.nsat; j++)
     { /* range */
-        rng = rtcm_getbitu(rtcm->buff, i, 8);
-        i += 8;
+        rng = bitcur_getu(&bc, 8);
         if (rng != 255)
             r[j] = rng * RANGE_MS;
     }
     for (j = 0; j < h.nsat; j++)
     {
-        rng_m = rtcm_getbitu(rtcm->buff, i, 10);
-        i += 10;
+        rng_m = bitcur_getu(&bc, 10);
         if (r[j] != 0.0)
             r[j] += rng_m * P2_10 * RANGE_MS;
     }
     /* decode signal data */
     for (j = 0; j < ncell; j++)
     { /* pseudorange */
-        prv = rtcm_getbits(rtcm->buff, i, 20);
-        i += 20;
+        prv = bitcur_gets(&bc, 20);
         if (prv != -524288)
             pr[j] = prv * P2_29 * RANGE_MS;
     }
     for (j = 0; j < ncell; j++)
     { /* phaserange */
-        cpv = rtcm_getbits(rtcm->buff, i, 24);
-        i += 24;
+        cpv = bitcur_gets(&bc, 24);
         if (cpv != -8388608)
             cp[j] = cpv * P2_31 * RANGE_MS;
     }
     for (j = 0; j < ncell; j++)
     { /* lock time */
-        lock[j] = rtcm_getbitu(rtcm->buff, i, 10);
-        i += 10;
+        lock[j] = bitcur_getu(&bc, 10);
     }
     for (j = 0; j < ncell; j++)
     { /* half-cycle ambiguity */
-        half[j] = rtcm_getbitu(rtcm->buff, i, 1);
-        i += 1;
+        half[j] = bitcur_getu(&bc, 1);
     }
     for (j = 0; j < ncell; j++)
     { /* cnr */
-        cnr[j] = rtcm_getbitu(rtcm->buff, i, 10) * 0.0625;
-        i += 10;
+        cnr[j] = bitcur_getu(&bc, 10) * 0.0625;
     }
     /* save obs data in msm message */
-    save_msm_obs(rtcm, obs, sys, &h, r, pr, cp, NULL, NULL, cnr, lock, NULL, half);
+    save_msm_obs(rtcm, obs, slot, sys, &h, r, pr, cp, NULL, NULL, cnr, lock, NULL, half);
 
     obs->obsflag = !sync;
 
     return sync ? 0 : 1;
 }
 /* decode msm 7: full pseudorange, phaserange, phaserangerate and cnr (h-res) */
-static int decode_msm7(rtcm_t *rtcm, obs_t *obs, int sys)
+static int decode_msm7(rtcm_t *rtcm, obs_t *obs, satslot_t *slot, int sys)
 {
     msm_h_t h = {0};
     double r[64] = {0}, rr[64] = {0}, pr[64] = {0}, cp[64] = {0}, rrf[64] = {0}, cnr[64] = {0};
-    int i, j, type, sync, iod, ncell, rng, rng_m, rate, prv, cpv, rrv, lock[64];
+    bitcur_t bc;
+    int j, type, sync, iod, ncell, rng, rng_m, rate, prv, cpv, rrv, lock[64];
     int ex[64] = {0}, half[64] = {0};
 
     type = rtcm_getbitu(rtcm->buff, 24, 12);
 
     /* decode msm header */
-    if ((ncell = decode_msm_head(rtcm, obs, sys, &sync, &iod, &h, &i)) < 0)
+    if ((ncell = decode_msm_head(rtcm, obs, sys, &sync, &iod, &h, &bc)) < 0)
         return -1;
 
-    if (i + h.nsat * 36 + ncell * 80 > rtcm->len * 8)
+    if (bc.pos + h.nsat * 36 + ncell * 80 > (int)rtcm->len * 8)
     {
         trace(2, "rtcm3 %d length error: nsat=%d ncell=%d len=%d\n", type, h.nsat,
               ncell, rtcm->len);
@@ -3402,69 +3747,59 @@ static int decode_msm7(rtcm_t *rtcm, obs_t *obs, int sys)
     /* decode satellite data */
     for (j = 0; j < h.nsat; j++)
     { /* range */
-        rng = rtcm_getbitu(rtcm->buff, i, 8);
-        i += 8;
+        rng = bitcur_getu(&bc, 8);
         if (rng != 255)
             r[j] = rng * RANGE_MS;
     }
     for (j = 0; j < h.nsat; j++)
     { /* extended info */
-        ex[j] = rtcm_getbitu(rtcm->buff, i, 4);
-        i += 4;
+        ex[j] = bitcur_getu(&bc, 4);
     }
     for (j = 0; j < h.nsat; j++)
     {
-        rng_m = rtcm_getbitu(rtcm->buff, i, 10);
-        i += 10;
+        rng_m = bitcur_getu(&bc, 10);
         if (r[j] != 0.0)
             r[j] += rng_m * P2_10 * RANGE_MS;
     }
     for (j = 0; j < h.nsat; j++)
     { /* phaserangerate */
-        rate = rtcm_getbits(rtcm->buff, i, 14);
-        i += 14;
+        rate = bitcur_gets(&bc, 14);
         if (rate != -8192)
             rr[j] = rate * 1.0;
     }
     /* decode signal data */
     for (j = 0; j < ncell; j++)
     { /* pseudorange */
-        prv = rtcm_getbits(rtcm->buff, i, 20);
-        i += 20;
+        prv = bitcur_gets(&bc, 20);
         if (prv != -524288)
             pr[j] = prv * P2_29 * RANGE_MS;
     }
     for (j = 0; j < ncell; j++)
     { /* phaserange */
-        cpv = rtcm_getbits(rtcm->buff, i, 24);
-        i += 24;
+        cpv = bitcur_gets(&bc, 24);
         if (cpv != -8388608)
             cp[j] = cpv * P2_31 * RANGE_MS;
     }
     for (j = 0; j < ncell; j++)
     { /* lock time */
-        lock[j] = rtcm_getbitu(rtcm->buff, i, 10);
-        i += 10;
+        lock[j] = bitcur_getu(&bc, 10);
     }
     for (j = 0; j < ncell; j++)
     { /* half-cycle amiguity */
-        half[j] = rtcm_getbitu(rtcm->buff, i, 1);
-        i += 1;
+        half[j] = bitcur_getu(&bc, 1);
     }
     for (j = 0; j < ncell; j++)
     { /* cnr */
-        cnr[j] = rtcm_getbitu(rtcm->buff, i, 10) * 0.0625;
-        i += 10;
+        cnr[j] = bitcur_getu(&bc, 10) * 0.0625;
     }
     for (j = 0; j < ncell; j++)
     { /* phaserangerate */
-        rrv = rtcm_getbits(rtcm->buff, i, 15);
-        i += 15;
+        rrv = bitcur_gets(&bc, 15);
         if (rrv != -16384)
             rrf[j] = rrv * 0.0001;
     }
     /* save obs data in msm message */
-    save_msm_obs(rtcm, obs, sys, &h, r, pr, cp, rr, rrf, cnr, lock, ex, half);
+    save_msm_obs(rtcm, obs, slot, sys, &h, r, pr, cp, rr, rrf, cnr, lock, ex, half);
 
     obs->obsflag = !sync;
 
@@ -3474,102 +3809,78 @@ static int decode_msm7(rtcm_t *rtcm, obs_t *obs, int sys)
 /* decode type 1230: glonass L1 and L2 code-phase biases ---------------------*/
 static int decode_type1230(rtcm_t *rtcm)
 {
+    (void)rtcm;
     trace(2, "rtcm3 1230: not supported message\n");
     return 0;
 }
 #ifdef _USE_PPP_
 /* decode ssr 1,4 message header ---------------------------------------------*/
 static int decode_ssr1_head(rtcm_t *rtcm, int sys, int *sync, int *iod,
-                            double *udint, int *refd, int *hsize)
+                            double *udint, int *refd, bitcur_t *bc)
 {
     double tod, tow;
-    char tstr[64];
-    int i = 24 + 12, nsat, udi, provid = 0, solid = 0, ns;
+    int nsat, udi, provid = 0, solid = 0, ns;
 
+    bitcur_init(bc, rtcm->buff, rtcm->len, 24 + 12);
     ns = sys == _SYS_QZS_ ? 4 : 6;
 
-    if (i + (sys == _SYS_GLO_ ? 53 : 50 + ns) > rtcm->len * 8)
+    if (bc->pos + (sys == _SYS_GLO_ ? 53 : 50 + ns) > rtcm->len * 8)
         return -1;
 
     if (sys == _SYS_GLO_)
     {
-        tod = rtcm_getbitu(rtcm->buff, i, 17);
-        i += 17;
+        tod = bitcur_getu(bc, 17);
         adjday_glot(&rtcm->time, tod);
     }
     else
     {
-        tow = rtcm_getbitu(rtcm->buff, i, 20);
-        i += 20;
+        tow = bitcur_getu(bc, 20);
         adjweek(&rtcm->time, tow);
     }
-    udi = rtcm_getbitu(rtcm->buff, i, 4);
-    i += 4;
-    *sync = rtcm_getbitu(rtcm->buff, i, 1);
-    i += 1;
-    *refd = rtcm_getbitu(rtcm->buff, i, 1);
-    i += 1; /* satellite ref datum */
-    *iod = rtcm_getbitu(rtcm->buff, i, 4);
-    i += 4; /* iod */
-    provid = rtcm_getbitu(rtcm->buff, i, 16);
-    i += 16; /* provider id */
-    solid = rtcm_getbitu(rtcm->buff, i, 4);
-    i += 4; /* solution id */
-    nsat = rtcm_getbitu(rtcm->buff, i, ns);
-    i += ns;
+    udi = bitcur_getu(bc, 4);
+    *sync = bitcur_getu(bc, 1);
+    *refd = bitcur_getu(bc, 1); /* satellite ref datum */
+    *iod = bitcur_getu(bc, 4); /* iod */
+    provid = bitcur_getu(bc, 16); /* provider id */
+    solid = bitcur_getu(bc, 4); /* solution id */
+    nsat = bitcur_getu(bc, ns);
     *udint = ssrudint[udi];
 
-    time2str(rtcm->time, tstr, 2);
-    trace(4, "decode_ssr1_head: time=%s sys=%c nsat=%d sync=%d iod=%d provid=%d solid=%d\n",
-          tstr, sys2char(sys), nsat, *sync, *iod, provid, solid);
-
-    *hsize = i;
+    trace(4, "decode_ssr1_head: time=%u sys=%c nsat=%d\n", (unsigned int)rtcm->time.time, sys2char(sys), nsat);
     return nsat;
 }
 /* decode ssr 2,3,5,6 message header -----------------------------------------*/
 static int decode_ssr2_head(rtcm_t *rtcm, int sys, int *sync, int *iod,
-                            double *udint, int *hsize)
+                            double *udint, bitcur_t *bc)
 {
     double tod, tow;
-    char tstr[64];
-    int i = 24 + 12, nsat, udi, provid = 0, solid = 0, ns;
+    int nsat, udi, provid = 0, solid = 0, ns;
 
+    bitcur_init(bc, rtcm->buff, rtcm->len, 24 + 12);
     ns = sys == _SYS_QZS_ ? 4 : 6;
 
-    if (i + (sys == _SYS_GLO_ ? 52 : 49 + ns) > rtcm->len * 8)
+    if (bc->pos + (sys == _SYS_GLO_ ? 52 : 49 + ns) > rtcm->len * 8)
         return -1;
 
     if (sys == _SYS_GLO_)
     {
-        tod = rtcm_getbitu(rtcm->buff, i, 17);
-        i += 17;
+        tod = bitcur_getu(bc, 17);
         adjday_glot(&rtcm->time, tod);
     }
     else
     {
-        tow = rtcm_getbitu(rtcm->buff, i, 20);
-        i += 20;
+        tow = bitcur_getu(bc, 20);
         adjweek(&rtcm->time, tow);
     }
-    udi = rtcm_getbitu(rtcm->buff, i, 4);
-    i += 4;
-    *sync = rtcm_getbitu(rtcm->buff, i, 1);
-    i += 1;
-    *iod = rtcm_getbitu(rtcm->buff, i, 4);
-    i += 4;
-    provid = rtcm_getbitu(rtcm->buff, i, 16);
-    i += 16; /* provider id */
-    solid = rtcm_getbitu(rtcm->buff, i, 4);
-    i += 4; /* solution id */
-    nsat = rtcm_getbitu(rtcm->buff, i, ns);
-    i += ns;
+    udi = bitcur_getu(bc, 4);
+    *sync = bitcur_getu(bc, 1);
+    *iod = bitcur_getu(bc, 4);
+    provid = bitcur_getu(bc, 16); /* provider id */
+    solid = bitcur_getu(bc, 4); /* solution id */
+    nsat = bitcur_getu(bc, ns);
     *udint = ssrudint[udi];
 
-    time2str(rtcm->time, tstr, 2);
-    trace(4, "decode_ssr2_head: time=%s sys=%d nsat=%c sync=%d iod=%d provid=%d solid=%d\n",
-          tstr, sys2char(sys), nsat, *sync, *iod, provid, solid);
-
-    *hsize = i;
+    trace(4, "decode_ssr2_head: time=%u sys=%c nsat=%d\n", (unsigned int)rtcm->time.time, sys2char(sys), nsat);
     return nsat;
 }
 
@@ -3577,12 +3888,13 @@ static int decode_ssr2_head(rtcm_t *rtcm, int sys, int *sync, int *iod,
 static int decode_ssr1(rtcm_t *rtcm, int sys, nav_t *nav, obs_t *obs)
 {
     double udint, deph[3], ddeph[3];
-    int i, j, k, type, sync, iod, nsat, prn, sat, iode, iodcrc, refd = 0, np, ni, nj, offp, loc;
+    bitcur_t bc;
+    int j, k, type, sync, iod, nsat, prn, sat, iode, iodcrc, refd = 0, np, ni, nj, offp, loc;
     ssr_t ssr = {0};
 
     type = rtcm_getbitu(rtcm->buff, 24, 12);
 
-    if ((nsat = decode_ssr1_head(rtcm, sys, &sync, &iod, &udint, &refd, &i)) < 0)
+    if ((nsat = decode_ssr1_head(rtcm, sys, &sync, &iod, &udint, &refd, &bc)) < 0)
     {
         trace(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
         return -1;
@@ -3628,26 +3940,17 @@ static int decode_ssr1(rtcm_t *rtcm, int sys, nav_t *nav, obs_t *obs)
     default:
         return sync ? 0 : 10;
     }
-    for (j = 0; j < nsat && i + 121 + np + ni + nj <= rtcm->len * 8; j++)
-    {
-        prn = rtcm_getbitu(rtcm->buff, i, np) + offp;
-        i += np;
-        iode = rtcm_getbitu(rtcm->buff, i, ni);
-        i += ni;
-        iodcrc = rtcm_getbitu(rtcm->buff, i, nj);
-        i += nj;
-        deph[0] = rtcm_getbits(rtcm->buff, i, 22) * 1E-4;
-        i += 22;
-        deph[1] = rtcm_getbits(rtcm->buff, i, 20) * 4E-4;
-        i += 20;
-        deph[2] = rtcm_getbits(rtcm->buff, i, 20) * 4E-4;
-        i += 20;
-        ddeph[0] = rtcm_getbits(rtcm->buff, i, 21) * 1E-6;
-        i += 21;
-        ddeph[1] = rtcm_getbits(rtcm->buff, i, 19) * 4E-6;
-        i += 19;
-        ddeph[2] = rtcm_getbits(rtcm->buff, i, 19) * 4E-6;
-        i += 19;
+    for (j = 0; j < nsat && bc.pos + 121 + np + ni + nj <= rtcm->len * 8; j++)
+    {
+        prn = bitcur_getu(&bc, np) + offp;
+        iode = bitcur_getu(&bc, ni);
+        iodcrc = bitcur_getu(&bc, nj);
+        deph[0] = bitcur_gets(&bc, 22) * 1E-4;
+        deph[1] = bitcur_gets(&bc, 20) * 4E-4;
+        deph[2] = bitcur_gets(&bc, 20) * 4E-4;
+        ddeph[0] = bitcur_gets(&bc, 21) * 1E-6;
+        ddeph[1] = bitcur_gets(&bc, 19) * 4E-6;
+        ddeph[2] = bitcur_gets(&bc, 19) * 4E-6;
 
         if (!(sat = satno(sys, prn)))
         {
@@ -3694,12 +3997,13 @@ static int decode_ssr1(rtcm_t *rtcm, int sys, nav_t *nav, obs_t *obs)
 static int decode_ssr2(rtcm_t *rtcm, int sys, nav_t *nav, obs_t *obs)
 {
     double udint, dclk[3];
-    int i, j, k, type, sync, iod, nsat, prn, sat, np, offp, loc;
+    bitcur_t bc;
+    int j, k, type, sync, iod, nsat, prn, sat, np, offp, loc;
     ssr_t ssr = {0};
 
     type = rtcm_getbitu(rtcm->buff, 24, 12);
 
-    if ((nsat = decode_ssr2_head(rtcm, sys, &sync, &iod, &udint, &i)) < 0)
+    if ((nsat = decode_ssr2_head(rtcm, sys, &sync, &iod, &udint, &bc)) < 0)
     {
         trace(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
         return -1;
@@ -3733,16 +4037,12 @@ static int decode_ssr2(rtcm_t *rtcm, int sys, nav_t *nav, obs_t *obs)
     default:
         return sync ? 0 : 10;
     }
-    for (j = 0; j < nsat && i + 70 + np <= rtcm->len * 8; j++)
+    for (j = 0; j < nsat && bc.pos + 70 + np <= rtcm->len * 8; j++)
     {
-        prn = rtcm_getbitu(rtcm->buff, i, np) + offp;
-        i += np;
-        dclk[0] = rtcm_getbits(rtcm->buff, i, 22) * 1E-4;
-        i += 22;
-        dclk[1] = rtcm_getbits(rtcm->buff, i, 21) * 1E-6;
-        i += 21;
-        dclk[2] = rtcm_getbits(rtcm->buff, i, 27) * 2E-8;
-        i += 27;
+        prn = bitcur_getu(&bc, np) + offp;
+        dclk[0] = bitcur_gets(&bc, 22) * 1E-4;
+        dclk[1] = bitcur_gets(&bc, 21) * 1E-6;
+        dclk[2] = bitcur_gets(&bc, 27) * 2E-8;
 
         if (!(sat = satno(sys, prn)))
         {
@@ -3787,12 +4087,13 @@ static int decode_ssr3(rtcm_t *rtcm, int sys, nav_t *nav, obs_t *obs)
     const int *codes;
     const unsigned char *freqs;
     double udint, bias; // cbias[NFREQ];
-    int i, j, k, type, mode, sync, iod, nsat, prn, sat, nbias, np, offp, ncode, loc;
+    bitcur_t bc;
+    int j, k, type, mode, sync, iod, nsat, prn, sat, nbias, np, offp, ncode, loc;
     ssr_t ssr = {0};
     memset(&ssr, 0, sizeof(ssr_t));
     type = rtcm_getbitu(rtcm->buff, 24, 12);
 
-    if ((nsat = decode_ssr2_head(rtcm, sys, &sync, &iod, &udint, &i)) < 0)
+    if ((nsat = decode_ssr2_head(rtcm, sys, &sync, &iod, &udint, &bc)) < 0)
     {
         trace(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
         return -1;
@@ -3844,19 +4145,15 @@ static int decode_ssr3(rtcm_t *rtcm, int sys, nav_t *nav, obs_t *obs)
     default:
         return sync ? 0 : 10;
     }
-    for (j = 0; j < nsat && i + 5 + np <= rtcm->len * 8; j++)
+    for (j = 0; j < nsat && bc.pos + 5 + np <= rtcm->len * 8; j++)
     {
-        prn = rtcm_getbitu(rtcm->buff, i, np) + offp;
-        i += np;
-        nbias = rtcm_getbitu(rtcm->buff, i, 5);
-        i += 5;
+        prn = bitcur_getu(&bc, np) + offp;
+        nbias = bitcur_getu(&bc, 5);
 
-        for (k = 0; k < nbias && i + 19 <= rtcm->len * 8; k++)
+        for (k = 0; k < nbias && bc.pos + 19 <= rtcm->len * 8; k++)
         {
-            mode = rtcm_getbitu(rtcm->buff, i, 5);
-            i += 5;
-            bias = rtcm_getbits(rtcm->buff, i, 14) * 0.01;
-            i += 14;
+            mode = bitcur_getu(&bc, 5);
+            bias = bitcur_gets(&bc, 14) * 0.01;
             if (mode <= ncode && bias != 0.0 && freqs[codes[mode] + 1] <= NFREQ)
             {
                 //  ssr.cbias[freqs[codes[mode] + 1] - 1] = (float)bias;
@@ -3948,12 +4245,13 @@ static int decode_ssr3(rtcm_t *rtcm, int sys, nav_t *nav, obs_t *obs)
 static int decode_ssr4(rtcm_t *rtcm, int sys, nav_t *nav, obs_t *obs)
 {
     double udint, deph[3], ddeph[3], dclk[3];
-    int i, j, k, type, nsat, sync, iod, prn, sat, iode, iodcrc, refd = 0, np, ni, nj, offp, loc;
+    bitcur_t bc;
+    int j, k, type, nsat, sync, iod, prn, sat, iode, iodcrc, refd = 0, np, ni, nj, offp, loc;
     ssr_t ssr = {0};
 
     type = rtcm_getbitu(rtcm->buff, 24, 12);
 
-    if ((nsat = decode_ssr1_head(rtcm, sys, &sync, &iod, &udint, &refd, &i)) < 0)
+    if ((nsat = decode_ssr1_head(rtcm, sys, &sync, &iod, &udint, &refd, &bc)) < 0)
     {
         trace(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
         return -1;
@@ -3999,33 +4297,21 @@ static int decode_ssr4(rtcm_t *rtcm, int sys, nav_t *nav, obs_t *obs)
     default:
         return sync ? 0 : 10;
     }
-    for (j = 0; j < nsat && i + 191 + np + ni + nj <= rtcm->len * 8; j++)
-    {
-        prn = rtcm_getbitu(rtcm->buff, i, np) + offp;
-        i += np;
-        iode = rtcm_getbitu(rtcm->buff, i, ni);
-        i += ni;
-        iodcrc = rtcm_getbitu(rtcm->buff, i, nj);
-        i += nj;
-        deph[0] = rtcm_getbits(rtcm->buff, i, 22) * 1E-4;
-        i += 22;
-        deph[1] = rtcm_getbits(rtcm->buff, i, 20) * 4E-4;
-        i += 20;
-        deph[2] = rtcm_getbits(rtcm->buff, i, 20) * 4E-4;
-        i += 20;
-        ddeph[0] = rtcm_getbits(rtcm->buff, i, 21) * 1E-6;
-        i += 21;
-        ddeph[1] = rtcm_getbits(rtcm->buff, i, 19) * 4E-6;
-        i += 19;
-        ddeph[2] = rtcm_getbits(rtcm->buff, i, 19) * 4E-6;
-        i += 19;
-
-        dclk[0] = rtcm_getbits(rtcm->buff, i, 22) * 1E-4;
-        i += 22;
-        dclk[1] = rtcm_getbits(rtcm->buff, i, 21) * 1E-6;
-        i += 21;
-        dclk[2] = rtcm_getbits(rtcm->buff, i, 27) * 2E-8;
-        i += 27;
+    for (j = 0; j < nsat && bc.pos + 191 + np + ni + nj <= rtcm->len * 8; j++)
+    {
+        prn = bitcur_getu(&bc, np) + offp;
+        iode = bitcur_getu(&bc, ni);
+        iodcrc = bitcur_getu(&bc, nj);
+        deph[0] = bitcur_gets(&bc, 22) * 1E-4;
+        deph[1] = bitcur_gets(&bc, 20) * 4E-4;
+        deph[2] = bitcur_gets(&bc, 20) * 4E-4;
+        ddeph[0] = bitcur_gets(&bc, 21) * 1E-6;
+        ddeph[1] = bitcur_gets(&bc, 19) * 4E-6;
+        ddeph[2] = bitcur_gets(&bc, 19) * 4E-6;
+
+        dclk[0] = bitcur_gets(&bc, 22) * 1E-4;
+        dclk[1] = bitcur_gets(&bc, 21) * 1E-6;
+        dclk[2] = bitcur_gets(&bc, 27) * 2E-8;
 
         if (!(sat = satno(sys, prn)))
         {
@@ -4116,13 +4402,14 @@ static int decode_ssr4(rtcm_t *rtcm, int sys, nav_t *nav, obs_t *obs)
 static int decode_ssr5(rtcm_t *rtcm, int sys, nav_t *nav)
 {
     double udint;
-    int i, j, type, nsat, sync, iod, prn, sat, ura, np, offp, loc;
+    bitcur_t bc;
+    int j, type, nsat, sync, iod, prn, sat, ura, np, offp, loc;
     ssr_t ssr = {0};
     ;
 
     type = rtcm_getbitu(rtcm->buff, 24, 12);
 
-    if ((nsat = decode_ssr2_head(rtcm, sys, &sync, &iod, &udint, &i)) < 0)
+    if ((nsat = decode_ssr2_head(rtcm, sys, &sync, &iod, &udint, &bc)) < 0)
     {
         trace(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
         return -1;
@@ -4156,12 +4443,10 @@ static int decode_ssr5(rtcm_t *rtcm, int sys, nav_t *nav)
     default:
         return sync ? 0 : 10;
     }
-    for (j = 0; j < nsat && i + 6 + np <= rtcm->len * 8; j++)
+    for (j = 0; j < nsat && bc.pos + 6 + np <= rtcm->len * 8; j++)
     {
-        prn = rtcm_getbitu(rtcm->buff, i, np) + offp;
-        i += np;
-        ura = rtcm_getbitu(rtcm->buff, i, 6);
-        i += 6;
+        prn = bitcur_getu(&bc, np) + offp;
+        ura = bitcur_getu(&bc, 6);
 
         if (!(sat = satno(sys, prn)))
         {
@@ -4199,12 +4484,13 @@ static int decode_ssr5(rtcm_t *rtcm, int sys, nav_t *nav)
 static int decode_ssr6(rtcm_t *rtcm, int sys, nav_t *nav)
 {
     double udint, hrclk;
-    int i, j, type, nsat, sync, iod, prn, sat, np, offp, loc;
+    bitcur_t bc;
+    int j, type, nsat, sync, iod, prn, sat, np, offp, loc;
     ssr_t ssr = {0};
 
     type = rtcm_getbitu(rtcm->buff, 24, 12);
 
-    if ((nsat = decode_ssr2_head(rtcm, sys, &sync, &iod, &udint, &i)) < 0)
+    if ((nsat = decode_ssr2_head(rtcm, sys, &sync, &iod, &udint, &bc)) < 0)
     {
         trace(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
         return -1;
@@ -4238,12 +4524,10 @@ static int decode_ssr6(rtcm_t *rtcm, int sys, nav_t *nav)
     default:
         return sync ? 0 : 10;
     }
-    for (j = 0; j < nsat && i + 22 + np <= rtcm->len * 8; j++)
+    for (j = 0; j < nsat && bc.pos + 22 + np <= rtcm->len * 8; j++)
     {
-        prn = rtcm_getbitu(rtcm->buff, i, np) + offp;
-        i += np;
-        hrclk = rtcm_getbits(rtcm->buff, i, 22) * 1E-4;
-        i += 22;
+        prn = bitcur_getu(&bc, np) + offp;
+        hrclk = bitcur_gets(&bc, 22) * 1E-4;
 
         if (!(sat = satno(sys, prn)))
         {
@@ -4279,52 +4563,38 @@ static int decode_ssr6(rtcm_t *rtcm, int sys, nav_t *nav)
 }
 /* decode ssr 7 message header -----------------------------------------------*/
 static int decode_ssr7_head(rtcm_t *rtcm, int sys, int *sync, int *iod,
-                            double *udint, int *dispe, int *mw, int *hsize)
+                            double *udint, int *dispe, int *mw, bitcur_t *bc)
 {
     double tod, tow;
-    char tstr[64];
-    int i = 24 + 12, nsat, udi, provid = 0, solid = 0, ns;
+    int nsat, udi, provid = 0, solid = 0, ns;
 
+    bitcur_init(bc, rtcm->buff, rtcm->len, 24 + 12);
     ns = sys == _SYS_QZS_ ? 4 : 6;
 
-    if (i + (sys == _SYS_GLO_ ? 54 : 51 + ns) > rtcm->len * 8)
+    if (bc->pos + (sys == _SYS_GLO_ ? 54 : 51 + ns) > rtcm->len * 8)
         return -1;
 
     if (sys == _SYS_GLO_)
     {
-        tod = rtcm_getbitu(rtcm->buff, i, 17);
-        i += 17;
+        tod = bitcur_getu(bc, 17);
         adjday_glot(&rtcm->time, tod);
     }
     else
     {
-        tow = rtcm_getbitu(rtcm->buff, i, 20);
-        i += 20;
+        tow = bitcur_getu(bc, 20);
         adjweek(&rtcm->time, tow);
     }
-    udi = rtcm_getbitu(rtcm->buff, i, 4);
-    i += 4;
-    *sync = rtcm_getbitu(rtcm->buff, i, 1);
-    i += 1;
-    *iod = rtcm_getbitu(rtcm->buff, i, 4);
-    i += 4;
-    provid = rtcm_getbitu(rtcm->buff, i, 16);
-    i += 16; /* provider id */
-    solid = rtcm_getbitu(rtcm->buff, i, 4);
-    i += 4; /* solution id */
-    *dispe = rtcm_getbitu(rtcm->buff, i, 1);
-    i += 1; /* dispersive bias consistency ind */
-    *mw = rtcm_getbitu(rtcm->buff, i, 1);
-    i += 1; /* MW consistency indicator */
-    nsat = rtcm_getbitu(rtcm->buff, i, ns);
-    i += ns;
+    udi = bitcur_getu(bc, 4);
+    *sync = bitcur_getu(bc, 1);
+    *iod = bitcur_getu(bc, 4);
+    provid = bitcur_getu(bc, 16); /* provider id */
+    solid = bitcur_getu(bc, 4); /* solution id */
+    *dispe = bitcur_getu(bc, 1); /* dispersive bias consistency ind */
+    *mw = bitcur_getu(bc, 1); /* MW consistency indicator */
+    nsat = bitcur_getu(bc, ns);
     *udint = ssrudint[udi];
 
-    time2str(rtcm->time, tstr, 2);
-    trace(4, "decode_ssr7_head: time=%s sys=%c nsat=%d sync=%d iod=%d provid=%d solid=%d\n",
-          tstr, sys2char(sys), nsat, *sync, *iod, provid, solid);
-
-    *hsize = i;
+    trace(4, "decode_ssr7_head: time=%u sys=%c nsat=%d\n", (unsigned int)rtcm->time.time, sys2char(sys), nsat);
     return nsat;
 }
 /* decode ssr 7: phase bias --------------------------------------------------*/
@@ -4332,14 +4602,15 @@ static int decode_ssr7(rtcm_t *rtcm, int sys, nav_t *nav)
 {
     const int *codes;
     double udint, bias, std, pbias[MAXCODE], stdpb[MAXCODE];
-    int i, j, k, type, mode, sync, iod, nsat, prn, sat, nbias, ncode, np, mw, offp, sii, swl;
+    bitcur_t bc;
+    int j, k, type, mode, sync, iod, nsat, prn, sat, nbias, ncode, np, mw, offp, sii, swl;
     int dispe, sdc, yaw_ang, yaw_rate;
     int loc;
     ssr_t ssr = {0};
 
     type = rtcm_getbitu(rtcm->buff, 24, 12);
 
-    if ((nsat = decode_ssr7_head(rtcm, sys, &sync, &iod, &udint, &dispe, &mw, &i)) < 0)
+    if ((nsat = decode_ssr7_head(rtcm, sys, &sync, &iod, &udint, &dispe, &mw, &bc)) < 0)
     {
         trace(2, "rtcm3 %d length error: len=%d\n", type, rtcm->len);
         return -1;
@@ -4379,33 +4650,23 @@ static int decode_ssr7(rtcm_t *rtcm, int sys, nav_t *nav)
     default:
         return sync ? 0 : 10;
     }
-    for (j = 0; j < nsat && i + 5 + 17 + np <= rtcm->len * 8; j++)
+    for (j = 0; j < nsat && bc.pos + 5 + 17 + np <= rtcm->len * 8; j++)
     {
-        prn = rtcm_getbitu(rtcm->buff, i, np) + offp;
-        i += np;
-        nbias = rtcm_getbitu(rtcm->buff, i, 5);
-        i += 5;
-        yaw_ang = rtcm_getbitu(rtcm->buff, i, 9);
-        i += 9;
-        yaw_rate = rtcm_getbits(rtcm->buff, i, 8);
-        i += 8;
+        prn = bitcur_getu(&bc, np) + offp;
+        nbias = bitcur_getu(&bc, 5);
+        yaw_ang = bitcur_getu(&bc, 9);
+        yaw_rate = bitcur_gets(&bc, 8);
 
         for (k = 0; k < MAXCODE; k++)
             pbias[k] = stdpb[k] = 0.0;
-        for (k = 0; k < nbias && i + 49 <= rtcm->len * 8; k++)
+        for (k = 0; k < nbias && bc.pos + 49 <= rtcm->len * 8; k++)
         {
-            mode = rtcm_getbitu(rtcm->buff, i, 5);
-            i += 5;
-            sii = rtcm_getbitu(rtcm->buff, i, 1);
-            i += 1; /* integer-indicator */
-            swl = rtcm_getbitu(rtcm->buff, i, 2);
-            i += 2; /* WL integer-indicator */
-            sdc = rtcm_getbitu(rtcm->buff, i, 4);
-            i += 4; /* discontinuity counter */
-            bias = rtcm_getbits(rtcm->buff, i, 20);
-            i += 20; /* phase bias (m) */
-            std = rtcm_getbitu(rtcm->buff, i, 17);
-            i += 17; /* phase bias std-dev (m) */
+            mode = bitcur_getu(&bc, 5);
+            sii = bitcur_getu(&bc, 1); /* integer-indicator */
+            swl = bitcur_getu(&bc, 2); /* WL integer-indicator */
+            sdc = bitcur_getu(&bc, 4); /* discontinuity counter */
+            bias = bitcur_gets(&bc, 20); /* phase bias (m) */
+            std = bitcur_getu(&bc, 17); /* phase bias std-dev (m) */
             if (mode <= ncode)
             {
                 pbias[codes[mode] - 1] = bias * 0.0001; /* (m) */
@@ -4456,8 +4717,9 @@ static int decode_ssr7(rtcm_t *rtcm, int sys, nav_t *nav)
 }
 #endif
 
-/* decode rtcm ver.3 message -------------------------------------------------*/
-int decode_rtcm3(rtcm_t *rtcm, obs_t *obs, nav_t *nav)
+/* decode rtcm ver.3 message through the slot indexes (NULL: none) -----------*/
+static int decode_rtcm3_slot(rtcm_t *rtcm, obs_t *obs, nav_t *nav, satslot_t *slot,
+                             navslot_t *ns)
 {
     int ret = 0, type = rtcm->type = rtcm_getbitu(rtcm->buff, 24, 12);
 
@@ -4471,13 +4733,13 @@ int decode_rtcm3(rtcm_t *rtcm, obs_t *obs, nav_t *nav)
         ret = decode_type1001(rtcm, obs);
         break; /* not supported */
     case 1002:
-        ret = decode_type1002(rtcm, obs);
+        ret = decode_type1002(rtcm, obs, slot);
         break;
     case 1003:
         ret = decode_type1003(rtcm, obs);
         break; /* not supported */
     case 1004:
-        ret = decode_type1004(rtcm, obs);
+        ret = decode_type1004(rtcm, obs, slot);
         break;
     case 1005:
         ret = decode_type1005(rtcm, obs);
@@ -4495,22 +4757,22 @@ int decode_rtcm3(rtcm_t *rtcm, obs_t *obs, nav_t *nav)
         ret = decode_type1009(rtcm, obs);
         break; /* not supported */
     case 1010:
-        ret = decode_type1010(rtcm, obs);
+        ret = decode_type1010(rtcm, obs, slot);
         break;
     case 1011:
         ret = decode_type1011(rtcm, obs);
         break; /* not supported */
     case 1012:
-        ret = decode_type1012(rtcm, obs);
+        ret = decode_type1012(rtcm, obs, slot);
         break;
     case 1013:
         ret = decode_type1013(rtcm);
         break; /* not supported */
     case 1019:
-        ret = decode_type1019(rtcm, nav);
+        ret = decode_type1019(rtcm, nav, ns);
         break;
     case 1020:
-        ret = decode_type1020(rtcm, nav);
+        ret = decode_type1020(rtcm, nav, ns);
         break;
     case 1021:
         ret = decode_type1021(rtcm);
@@ -4564,19 +4826,19 @@ int decode_rtcm3(rtcm_t *rtcm, obs_t *obs, nav_t *nav)
         ret = decode_type1039(rtcm);
         break; /* not supported */
     case 1044:
-        ret = decode_type1044(rtcm, nav);
+        ret = decode_type1044(rtcm, nav, ns);
         break;
     case 1045:
-        ret = decode_type1045(rtcm, nav);
+        ret = decode_type1045(rtcm, nav, ns);
         break;
     case 1046:
-        ret = decode_type1046(rtcm, nav);
+        ret = decode_type1046(rtcm, nav, ns);
         break;
     case 63:
-        ret = decode_type1042(rtcm, nav);
+        ret = decode_type1042(rtcm, nav, ns);
         break; /* RTCM draft */
     case 1042:
-        ret = decode_type1042(rtcm, nav);
+        ret = decode_type1042(rtcm, nav, ns);
         break;
     case 4001:
         ret = decode_type4001(rtcm);
@@ -4630,16 +4892,16 @@ int decode_rtcm3(rtcm_t *rtcm, obs_t *obs, nav_t *nav)
         ret = decode_msm0(rtcm, obs, _SYS_GPS_);
         break; /* not supported */
     case 1074:
-        ret = decode_msm4(rtcm, obs, _SYS_GPS_);
+        ret = decode_msm4(rtcm, obs, slot, _SYS_GPS_);
         break;
     case 1075:
-        ret = decode_msm5(rtcm, obs, _SYS_GPS_);
+        ret = decode_msm5(rtcm, obs, slot, _SYS_GPS_);
         break;
     case 1076:
-        ret = decode_msm6(rtcm, obs, _SYS_GPS_);
+        ret = decode_msm6(rtcm, obs, slot, _SYS_GPS_);
         break;
     case 1077:
-        ret = decode_msm7(rtcm, obs, _SYS_GPS_);
+        ret = decode_msm7(rtcm, obs, slot, _SYS_GPS_);
         break;
     case 1081:
         ret = decode_msm0(rtcm, obs, _SYS_GLO_);
@@ -4651,16 +4913,16 @@ int decode_rtcm3(rtcm_t *rtcm, obs_t *obs, nav_t *nav)
         ret = decode_msm0(rtcm, obs, _SYS_GLO_);
         break; /* not supported */
     case 1084:
-        ret = decode_msm4(rtcm, obs, _SYS_GLO_);
+        ret = decode_msm4(rtcm, obs, slot, _SYS_GLO_);
         break;
     case 1085:
-        ret = decode_msm5(rtcm, obs, _SYS_GLO_);
+        ret = decode_msm5(rtcm, obs, slot, _SYS_GLO_);
         break;
     case 1086:
-        ret = decode_msm6(rtcm, obs, _SYS_GLO_);
+        ret = decode_msm6(rtcm, obs, slot, _SYS_GLO_);
         break;
     case 1087:
-        ret = decode_msm7(rtcm, obs, _SYS_GLO_);
+        ret = decode_msm7(rtcm, obs, slot, _SYS_GLO_);
         break;
     case 1091:
         ret = decode_msm0(rtcm, obs, _SYS_GAL_);
@@ -4672,16 +4934,16 @@ int decode_rtcm3(rtcm_t *rtcm, obs_t *obs, nav_t *nav)
         ret = decode_msm0(rtcm, obs, _SYS_GAL_);
         break; /* not supported */
     case 1094:
-        ret = decode_msm4(rtcm, obs, _SYS_GAL_);
+        ret = decode_msm4(rtcm, obs, slot, _SYS_GAL_);
         break;
     case 1095:
-        ret = decode_msm5(rtcm, obs, _SYS_GAL_);
+        ret = decode_msm5(rtcm, obs, slot, _SYS_GAL_);
         break;
     case 1096:
-        ret = decode_msm6(rtcm, obs, _SYS_GAL_);
+        ret = decode_msm6(rtcm, obs, slot, _SYS_GAL_);
         break;
     case 1097:
-        ret = decode_msm7(rtcm, obs, _SYS_GAL_);
+        ret = decode_msm7(rtcm, obs, slot, _SYS_GAL_);
         break;
     case 1101:
         ret = decode_msm0(rtcm, obs, _SYS_SBS_);
@@ -4693,16 +4955,16 @@ int decode_rtcm3(rtcm_t *rtcm, obs_t *obs, nav_t *nav)
         ret = decode_msm0(rtcm, obs, _SYS_SBS_);
         break; /* not supported */
     case 1104:
-        ret = decode_msm4(rtcm, obs, _SYS_SBS_);
+        ret = decode_msm4(rtcm, obs, slot, _SYS_SBS_);
         break;
     case 1105:
-        ret = decode_msm5(rtcm, obs, _SYS_SBS_);
+        ret = decode_msm5(rtcm, obs, slot, _SYS_SBS_);
         break;
     case 1106:
-        ret = decode_msm6(rtcm, obs, _SYS_SBS_);
+        ret = decode_msm6(rtcm, obs, slot, _SYS_SBS_);
         break;
     case 1107:
-        ret = decode_msm7(rtcm, obs, _SYS_SBS_);
+        ret = decode_msm7(rtcm, obs, slot, _SYS_SBS_);
         break;
     case 1111:
         ret = decode_msm0(rtcm, obs, _SYS_QZS_);
@@ -4714,16 +4976,16 @@ int decode_rtcm3(rtcm_t *rtcm, obs_t *obs, nav_t *nav)
         ret = decode_msm0(rtcm, obs, _SYS_QZS_);
         break; /* not supported */
     case 1114:
-        ret = decode_msm4(rtcm, obs, _SYS_QZS_);
+        ret = decode_msm4(rtcm, obs, slot, _SYS_QZS_);
         break;
     case 1115:
-        ret = decode_msm5(rtcm, obs, _SYS_QZS_);
+        ret = decode_msm5(rtcm, obs, slot, _SYS_QZS_);
         break;
     case 1116:
-        ret = decode_msm6(rtcm, obs, _SYS_QZS_);
+        ret = decode_msm6(rtcm, obs, slot, _SYS_QZS_);
         break;
     case 1117:
-        ret = decode_msm7(rtcm, obs, _SYS_QZS_);
+        ret = decode_msm7(rtcm, obs, slot, _SYS_QZS_);
         break;
     case 1121:
         ret = decode_msm0(rtcm, obs, _SYS_BDS_);
@@ -4735,16 +4997,16 @@ int decode_rtcm3(rtcm_t *rtcm, obs_t *obs, nav_t *nav)
         ret = decode_msm0(rtcm, obs, _SYS_BDS_);
         break; /* not supported */
     case 1124:
-        ret = decode_msm4(rtcm, obs, _SYS_BDS_);
+        ret = decode_msm4(rtcm, obs, slot, _SYS_BDS_);
         break;
     case 1125:
-        ret = decode_msm5(rtcm, obs, _SYS_BDS_);
+        ret = decode_msm5(rtcm, obs, slot, _SYS_BDS_);
         break;
     case 1126:
-        ret = decode_msm6(rtcm, obs, _SYS_BDS_);
+        ret = decode_msm6(rtcm, obs, slot, _SYS_BDS_);
         break;
     case 1127:
-        ret = decode_msm7(rtcm, obs, _SYS_BDS_);
+        ret = decode_msm7(rtcm, obs, slot, _SYS_BDS_);
         break;
     case 1230:
         ret = decode_type1230(rtcm);
@@ -4840,6 +5102,11 @@ int decode_rtcm3(rtcm_t *rtcm, obs_t *obs, nav_t *nav)
     }
     return ret;
 }
+/* decode rtcm ver.3 message -------------------------------------------------*/
+int decode_rtcm3(rtcm_t *rtcm, obs_t *obs, nav_t *nav)
+{
+    return decode_rtcm3_slot(rtcm, obs, nav, NULL, NULL);
+}
 
 /* input rtcm 3 message from stream --------------------------------------------
 * fetch next rtcm 3 message and input a message from byte stream
@@ -4907,103 +5174,402 @@ int decode_rtcm3(rtcm_t *rtcm, obs_t *obs, nav_t *nav)
 *            
 *-----------------------------------------------------------------------------*/
 
+#ifdef DEBUG_ALL
+/* echo base station frames as $GPREF to the debug port and data client */
 extern uint8_t stnID;
 extern uint8_t debug_com_log_on;
 extern client_s driver_data_client;
 void fill_base_data(rtcm_t *rtcm,int rtcm_len)
 {
-    uint8_t base_data_buf[2000] = {0};
+    char base_data_buf[1200 + 32];
+    sentence_t s;
+    uint16_t len;
     double gga_time = get_gnss_time();
     //  sizeof(",%02x\r\n") 5 sizeof(',') 1
     uint32_t data_len = rtcm_len + 5*sizeof(char) + 1*sizeof(char); 
-    int head_len = sprintf(( char*)base_data_buf,"$GPREF,%6.2f,%04u,",gga_time,data_len);
-    memcpy(base_data_buf + strlen(( char*)base_data_buf),rtcm->buff,rtcm_len);
-    int all_bytes_to_sum = head_len + rtcm_len;
-    char sum = 0;
-    for(int i = 0;i < all_bytes_to_sum;i++)
-    {
-        sum ^= base_data_buf[i];
-    }
-    int end_len = sprintf((char*)base_data_buf + head_len + rtcm_len,",%02x\r\n",sum);
+
+    /* "$GPREF,%6.2f,%04u,<frame>,<xor of all before the comma>\r\n" */
+    sentence_begin(&s, base_data_buf, sizeof(base_data_buf));
+    sentence_str(&s, "$GPREF,");
+    sentence_fixed(&s, gga_time, 6, 2);
+    sentence_str(&s, ",");
+    sentence_uint(&s, data_len, 4);
+    sentence_str(&s, ",");
+    sentence_bytes(&s, rtcm->buff, (uint16_t)rtcm_len);
+    len = sentence_end(&s, ",");
+
     if (debug_com_log_on) {
-       uart_write_bytes(UART_DEBUG,( char*)base_data_buf,head_len + rtcm_len + end_len,1);
+       uart_write_bytes(UART_DEBUG,base_data_buf,len,1);
     }
     if(get_tcp_data_driver_state() == CLIENT_STATE_INTERACTIVE)
     {
-        //driver_data_push((char*)base_data_buf,head_len + rtcm_len + end_len);
-        client_write_data(&driver_data_client,(char*)base_data_buf,head_len + rtcm_len + end_len,0x01);
+        //driver_data_push(base_data_buf,len);
+        client_write_data(&driver_data_client,base_data_buf,len,0x01);
     }
 }
+#endif
 
 uint8_t rtcm_decode_completion = 0;
 uint32_t rtcm_decode_length = 0;
 
-extern int input_rtcm3_data(rtcm_t *rtcm, unsigned char data, obs_t *obs, nav_t *nav)
+/* drop buffered bytes up to the next preamble at or after index from ---------*/
+static void sync_rtcm3(rtcm_t *rtcm, unsigned int from)
 {
-    /* synchronize frame */
-    int ret = 0;
-    rtcm->type = 0;
-    if (rtcm->nbyte == 0)
+    const unsigned char *p = NULL;
+
+    if (from < rtcm->nbyte)
     {
-        /* key = 0 => RTCM, key = 1 => NMEA */
-        if (data == RTCM3PREAMB /* RTCM data format */
-                                //  || data == '$'      /* NMEA data format */
-        )
-        {
-            rtcm->key = data;
-            rtcm->buff[rtcm->nbyte++] = data;
-        }
-        return 0;
+        p = memchr(rtcm->buff + from, RTCM3PREAMB, rtcm->nbyte - from);
+    }
+    if (p == NULL)
+    {
+        rtcm->nbyte = 0;
+        return;
+    }
+    rtcm->nbyte -= (unsigned int)(p - rtcm->buff);
+    memmove(rtcm->buff, p, rtcm->nbyte);
+}
+
+/* decoder statistics ---------------------------------------------------------*/
+/* attach/detach (stat=NULL) decoder statistics to a receiver ------------------
+* args   : rtcmrcv_t *rcv    IO  receiver
+*          rtcm_stat_t *stat O   statistics (NULL: detach)
+* return : none
+*-----------------------------------------------------------------------------*/
+extern void rtcm_attach_stat(rtcmrcv_t *rcv, rtcm_stat_t *stat)
+{
+    if (stat) memset(stat, 0, sizeof(rtcm_stat_t));
+    rcv->stat = stat;
+}
+/* statistics bucket of message type ---------------------------------------------
+* return : 0-6: 1004,1012,1019,1020,1042,1045,1046  7: 999  8-11: msm4-7  12: other
+*-----------------------------------------------------------------------------*/
+extern int rtcm_stat_index(int type)
+{
+    switch (type)
+    {
+    case 1004: return 0;
+    case 1012: return 1;
+    case 1019: return 2;
+    case 1020: return 3;
+    case 1042: return 4;
+    case 1045: return 5;
+    case 1046: return 6;
+    case 999:  return 7;
+    }
+    if (type >= 1071 && type <= 1137 && type % 10 >= 4 && type % 10 <= 7)
+    {
+        return 8 + type % 10 - 4;
     }
+    return RTCM_STAT_NTYPE - 1;
+}
+static void rtcm_stat_msg(rtcm_stat_t *st, const rtcm_t *rtcm, const obs_t *obs, const nav_t *nav)
+{
+    st->nmsg++;
+    st->ntype[rtcm_stat_index(rtcm->type)]++;
+    if (obs->n > st->maxobs) st->maxobs = obs->n;
+    if (nav->n > st->maxeph) st->maxeph = nav->n;
+    if (nav->ng > st->maxgeph) st->maxgeph = nav->ng;
+}
 
-    /* RTCM decorder */
-    rtcm->buff[rtcm->nbyte++] = data;
+/* observation epoch assembler -------------------------------------------------
+* with an assembler attached to a receiver the decoder fills the back buffer and
+* flips it to the front once the epoch completes (sync flag cleared), so the
+* reader gets a complete epoch that stays untouched until the next one completes.
+* each published epoch is measured: its obs messages against the most seen
+* (an epoch short of them lost a system), its age at publication against the
+* time service clock and the time from its first to its last message.
+*-----------------------------------------------------------------------------*/
+
+/* attach/detach (ep=NULL) an epoch assembler to a receiver ----------------------
+* args   : rtcmrcv_t *rcv    IO  receiver
+*          obsepoch_t *ep    O   epoch assembler (NULL: detach)
+* return : none
+*-----------------------------------------------------------------------------*/
+extern void rtcm_attach_epoch(rtcmrcv_t *rcv, obsepoch_t *ep)
+{
+    if (ep) memset(ep, 0, sizeof(obsepoch_t));
+    rcv->ep = ep;
+}
+/* get the last complete epoch ---------------------------------------------------
+* args   : obsepoch_t *ep    I   epoch assembler
+*          unsigned int *seq O   epoch sequence number, for rtcm_epoch_valid()
+* return : observation data (NULL: no complete epoch yet)
+*-----------------------------------------------------------------------------*/
+extern const obs_t *rtcm_epoch_get(const obsepoch_t *ep, unsigned int *seq)
+{
+    unsigned int front;
 
-    if (rtcm->nbyte == 3)
+    do
     {
-        rtcm->len = rtcm_getbitu(rtcm->buff, 14, 10) + 3; /* length without parity */
+        *seq = ep->seq;
+        front = ep->front;
+        __sync_synchronize();
+    } while (*seq != ep->seq);
+
+    return *seq ? ep->buf + front : NULL;
+}
+/* test that an epoch from rtcm_epoch_get() was not overwritten meanwhile -------*/
+extern int rtcm_epoch_valid(const obsepoch_t *ep, unsigned int seq)
+{
+    __sync_synchronize();
+    return ep->seq == seq;
+}
+/* buffer the decoder fills ---------------------------------------------------*/
+static obs_t *epoch_back(obsepoch_t *ep)
+{
+    return ep->buf + (ep->front ^ 1);
+}
+/* us to an unsigned statistic, negative (clock not set yet) as 0 ------------*/
+static unsigned int epoch_us(int64_t us)
+{
+    return us <= 0 ? 0 : us >= 0xFFFFFFFF ? 0xFFFFFFFF : (unsigned int)us;
+}
+/* measure the epoch being published ----------------------------------------*/
+static void epoch_stat(obsepoch_t *ep, const obs_t *obs, int64_t now)
+{
+    int64_t t = (int64_t)obs->time.time * 1000000 + (int64_t)(obs->time.sec * 1e6);
+
+    ep->nmsg_last = ep->nmsg;
+    if (ep->nmsg > ep->nmsg_max) ep->nmsg_max = ep->nmsg;
+    else if (ep->nmsg < ep->nmsg_max) ep->nshort++;
+
+    ep->age_us_last = epoch_us(now - t);
+    if (ep->age_us_last > ep->age_us_max) ep->age_us_max = ep->age_us_last;
+    ep->age_us_sum += ep->age_us_last;
+    ep->span_us_last = epoch_us(now - ep->first_us);
+    if (ep->span_us_last > ep->span_us_max) ep->span_us_max = ep->span_us_last;
+}
+/* account a decoded message, publish the epoch on completion -----------------*/
+static obs_t *epoch_msg(obsepoch_t *ep, obs_t *obs, gtime_t t0, unsigned int n0, int ret)
+{
+    obs_t *back;
+    int64_t now;
+
+    if (timediff(obs->time, t0) != 0.0)
+    {
+        if (n0 > 0) ep->npartial++;
+        ep->nmsg = 0;
     }
-    if (rtcm->nbyte < 3 || rtcm->nbyte < rtcm->len + 3)
-        return 0;
-#ifdef DEBUG_ALL
-    if((rtcm->nbyte > 0) && (stnID == BASE))
+    else if (obs->n == n0 && ret != 1)
     {
-        fill_base_data(rtcm,rtcm->nbyte);
+        return obs; /* not an observation message */
     }
+    now = now_gps();
+    if (ep->nmsg++ == 0) ep->first_us = now;
+
+    if (ret != 1 || !obs->obsflag) return obs;
+
+    epoch_stat(ep, obs, now);
+    ep->nmsg = 0;
+    __sync_synchronize();
+    ep->front ^= 1;
+    ep->seq++;
+
+    /* carry station info into the new back buffer */
+    back = epoch_back(ep);
+    back->n = 0;
+    back->time = obs->time;
+    back->obsflag = obs->obsflag;
+    back->staid = obs->staid;
+    memcpy(back->pos, obs->pos, sizeof(obs->pos));
+    memcpy(back->refpos, obs->refpos, sizeof(obs->refpos));
+    return back;
+}
+
+static void pool_cold_msg(const rtcmrcv_t *rcv, const rtcm_t *rtcm, int ret);
+
+/* frame rtcm3 messages from a byte span -----------------------------------------
+* scan for the preamble, copy frames into rtcm->buff, check parity and decode.
+* a header with reserved bits set, or a frame failing parity, is rescanned
+* from its second byte for a preamble, so a frame starting inside it is kept.
+* scanning stops after a message completing an observation epoch (status 1)
+* args   : rtcmrcv_t *rcv    IO  receiver
+*          unsigned char *data I data bytes
+*          unsigned int len  I   number of data bytes
+*          unsigned int *nused O number of data bytes consumed
+*          int    *stat      O   status of the last decoded message
+* return : number of messages decoded
+*-----------------------------------------------------------------------------*/
+static int frame_rtcm3(const rtcmrcv_t *rcv, const unsigned char *data, unsigned int len,
+                       unsigned int *nused, int *stat)
+{
+    const unsigned char *p;
+    unsigned int pos = 0, n, n0, frame;
+    int ndec = 0, ret;
+    gtime_t t0;
+    rtcm_t *rtcm = rcv->rtcm;
+    obs_t *obs = rcv->obs;
+    nav_t *nav = rcv->nav;
+    rtcm_stat_t *st = rcv->stat;
+    obsepoch_t *ep = rcv->ep;
+
+    if (ep) obs = epoch_back(ep);
+
+    rtcm->type = 0;
+    *stat = 0;
+
+    for (;;)
+    {
+        /* synchronize frame */
+        if (rtcm->nbyte == 0)
+        {
+            if (pos >= len || (p = memchr(data + pos, RTCM3PREAMB, len - pos)) == NULL)
+            {
+                pos = len;
+                break;
+            }
+            pos = (unsigned int)(p - data);
+            rtcm->key = RTCM3PREAMB;
+        }
+        if (rtcm->nbyte < 3)
+        {
+            n = 3 - rtcm->nbyte;
+            if (n > len - pos) n = len - pos;
+            memcpy(rtcm->buff + rtcm->nbyte, data + pos, n);
+            rtcm->nbyte += n;
+            pos += n;
+            if (rtcm->nbyte < 3) break;
+        }
+        /* the 6 bits after the preamble are reserved (0), anything else is a
+           preamble byte inside other data: scan on from the byte after it */
+        if (rtcm_getbitu(rtcm->buff, 8, 6) != 0)
+        {
+            sync_rtcm3(rtcm, 1);
+            continue;
+        }
+        rtcm->len = rtcm_getbitu(rtcm->buff, 14, 10) + 3; /* length without parity */
+        frame = rtcm->len + 3;
+
+        if (rtcm->nbyte < frame)
+        {
+            n = frame - rtcm->nbyte;
+            if (n > len - pos) n = len - pos;
+            memcpy(rtcm->buff + rtcm->nbyte, data + pos, n);
+            rtcm->nbyte += n;
+            pos += n;
+            if (rtcm->nbyte < frame) break;
+        }
+#ifdef DEBUG_ALL
+        if (stnID == BASE)
+        {
+            fill_base_data(rtcm, frame);
+        }
 #endif
-    rtcm_decode_length = rtcm->nbyte;
-    rtcm->nbyte = 0;
-    rtcm->type = rtcm_getbitu(rtcm->buff, 24, 12);
+        rtcm_decode_length = frame;
+        rtcm->type = rtcm_getbitu(rtcm->buff, 24, 12);
+
+        /* check parity */
+        if (rtk_crc24q(rtcm->buff, rtcm->len) != rtcm_getbitu(rtcm->buff, rtcm->len * 8, 24))
+        {
+            trace(2, "rtcm3 parity error: len=%d\n", rtcm->len);
+            EVENT_TRACE1(EVENT_RTCM_PARITY, rtcm->len);
+            if (st) st->nerr++;
+            sync_rtcm3(rtcm, 1);
+            continue;
+        }
+        rtcm_decode_completion = 1;
+
+        /* decode rtcm3 message */
+        t0 = obs->time;
+        n0 = obs->n;
+        EVENT_TRACE2(EVENT_RTCM_DECODE_BEGIN, rtcm->type, frame);
+        timememo = rcv->memo;
+        ret = decode_rtcm3_slot(rtcm, obs, nav, rcv->slot, rcv->navslot);
+        timememo = NULL;
+        EVENT_TRACE2(EVENT_RTCM_DECODE_END, rtcm->type, ret);
+        ndec++;
+        if (st) rtcm_stat_msg(st, rtcm, obs, nav);
+        if (rcv->hot) pool_cold_msg(rcv, rtcm, ret);
+        if (ep) obs = epoch_msg(ep, obs, t0, n0, ret);
+        *stat = ret;
+        sync_rtcm3(rtcm, frame);
+
+        if (ret == 1) break;
+    }
+    if (st) st->nbyte += pos;
+    *nused = pos;
+    return ndec;
+}
+
+/* one byte into the framer ------------------------------------------------------
+* an epoch completed from bytes still buffered after a resync stops the framer
+* before it takes the new byte. with bytes left in the buffer the byte goes in
+* behind them, which is where the next call would have put it; with none left
+* it goes through the framer again, so it is synced like any other byte
+*-----------------------------------------------------------------------------*/
+static int frame_rtcm3_byte(const rtcmrcv_t *rcv, unsigned char data)
+{
+    rtcm_t *rtcm = rcv->rtcm;
+    unsigned int nused;
+    int stat, stat2, type;
 
-    /* check parity */
-    if (rtk_crc24q(rtcm->buff, rtcm->len) != rtcm_getbitu(rtcm->buff, rtcm->len * 8, 24))
+    frame_rtcm3(rcv, &data, 1, &nused, &stat);
+    if (nused == 0)
     {
-        trace(2, "rtcm3 parity error: len=%d\n", rtcm->len);
-        return 0;
+        if (rtcm->nbyte > 0)
+        {
+            if (rtcm->nbyte < sizeof(rtcm->buff))
+            {
+                rtcm->buff[rtcm->nbyte++] = data;
+                if (rcv->stat) rcv->stat->nbyte++;
+            }
+        }
+        else
+        {
+            /* a single byte decodes nothing, keep the completed message */
+            type = rtcm->type;
+            frame_rtcm3(rcv, &data, 1, &nused, &stat2);
+            rtcm->type = type;
+        }
     }
+    return stat;
+}
 
-    rtcm_decode_completion = 1;
+/* set up a receiver -------------------------------------------------------------
+* bundles the decoder state and the data one rtcm stream decodes into. slot
+* indexes, statistics and epoch assembler start detached, see rtcm_attach_*()
+* args   : rtcmrcv_t *rcv    O   receiver
+*          rtcm_t *rtcm      I   decoder state
+*          obs_t  *obs       I   observation data
+*          nav_t  *nav       I   navigation data, may be shared with other receivers
+* return : none
+*-----------------------------------------------------------------------------*/
+extern void rtcm_rcv_init(rtcmrcv_t *rcv, rtcm_t *rtcm, obs_t *obs, nav_t *nav)
+{
+    rcv->rtcm = rtcm;
+    rcv->obs = obs;
+    rcv->nav = nav;
+    rcv->slot = NULL;
+    rcv->navslot = NULL;
+    rcv->stat = NULL;
+    rcv->ep = NULL;
+    rcv->memo = NULL;
+    rcv->hot = NULL;
+    rcv->coldpool = NULL;
+}
 
-    // printf("rtcm type: %d\r\n", rtcm->type);
+extern int input_rtcm3_data(rtcm_t *rtcm, unsigned char data, obs_t *obs, nav_t *nav)
+{
+    rtcmrcv_t rcv;
 
-    /* decode rtcm3 message */
-    return decode_rtcm3(rtcm, obs, nav);
+    rtcm_rcv_init(&rcv, rtcm, obs, nav);
+    return frame_rtcm3_byte(&rcv, data);
 }
 
 extern int input_rtcm3(unsigned char data, unsigned int stnID, gnss_rtcm_t *gnss)
 {
     rtcm_t *rtcm = NULL;
-    obs_t *obs = NULL;
-    nav_t *nav = NULL;
+    rtcmrcv_t rcv;
     int ret = 0;
     static int obs_flag = 0;
 
     if (stnID < MAXSTN)
     {
         rtcm = gnss->rcv + stnID;
-        nav = &gnss->nav;
-        obs = gnss->obs + stnID;
-        ret = input_rtcm3_data(rtcm, data, obs, nav);
+        rtcm_rcv_init(&rcv, rtcm, gnss->obs + stnID, &gnss->nav);
+        rcv.memo = stnmemo + stnID;
+        ret = frame_rtcm3_byte(&rcv, data);
 
         if (stnID == BASE && rtcm->time.time == 0) {
             rtcm->time.time = gnss->rcv[ROVER].time.time;
@@ -5013,3 +5579,344 @@ extern int input_rtcm3(unsigned char data, unsigned int stnID, gnss_rtcm_t *gnss
     return ret;
 }
 
+/* input rtcm3 message from a byte span ------------------------------------------
+* block counterpart of input_rtcm3(), e.g. for a contiguous fifo_peek() span.
+* when an observation epoch completes the scan stops with *stat = 1 and *nused
+* short of len; call again with the remaining bytes after handling the epoch.
+* args   : unsigned char *data I data bytes
+*          unsigned int len  I   number of data bytes
+*          unsigned int stnID I  station index (ROVER/BASE)
+*          gnss_rtcm_t *gnss IO  rtcm data struct
+*          unsigned int *nused O number of data bytes consumed
+*          int    *stat      O   status of the last decoded message (NULL: no output)
+*                                (-1: error message, 0: no message, 1: input observation data,
+*                                 2: input ephemeris, 5: input station pos/ant parameters)
+* return : number of messages decoded
+*-----------------------------------------------------------------------------*/
+extern int input_rtcm3_buf(const unsigned char *data, unsigned int len, unsigned int stnID,
+                           gnss_rtcm_t *gnss, unsigned int *nused, int *stat)
+{
+    rtcm_t *rtcm;
+    rtcmrcv_t rcv;
+    int ndec, ret;
+
+    if (stnID >= MAXSTN)
+    {
+        *nused = len;
+        if (stat) *stat = 0;
+        return 0;
+    }
+    rtcm = gnss->rcv + stnID;
+    rtcm_rcv_init(&rcv, rtcm, gnss->obs + stnID, &gnss->nav);
+    rcv.memo = stnmemo + stnID;
+    ndec = frame_rtcm3(&rcv, data, len, nused, &ret);
+
+    if (stnID == BASE && rtcm->time.time == 0) {
+        rtcm->time.time = gnss->rcv[ROVER].time.time;
+    }
+    if (stat) *stat = ret;
+    return ndec;
+}
+
+/* input rtcm3 message of a receiver from a byte span -----------------------------
+* same as input_rtcm3_buf() for a receiver set up by rtcm_rcv_init(); with
+* rtcm_attach_epoch() observations go to the assembler, not rcv->obs.
+* args   : unsigned char *data I data bytes
+*          unsigned int len  I   number of data bytes
+*          rtcmrcv_t *rcv    IO  receiver
+*          unsigned int *nused O number of data bytes consumed
+*          int    *stat      O   status of the last decoded message (NULL: no output)
+* return : number of messages decoded
+*-----------------------------------------------------------------------------*/
+extern int input_rtcm3_rcv(const unsigned char *data, unsigned int len, rtcmrcv_t *rcv,
+                           unsigned int *nused, int *stat)
+{
+    int ndec, ret;
+
+    ndec = frame_rtcm3(rcv, data, len, nused, &ret);
+    if (stat) *stat = ret;
+    return ndec;
+}
+/* input one byte of rtcm3 message into a receiver, see input_rtcm3() ----------*/
+extern int input_rtcm3_rcv_byte(unsigned char data, rtcmrcv_t *rcv)
+{
+    return frame_rtcm3_byte(rcv, data);
+}
+
+/* network station decoder pool ------------------------------------------------
+* for network rtk with more reference streams than the rover/base pair of
+* gnss_rtcm_t. the state of a stream is split by how often it is used:
+*
+*   hot  (rtcmhot_t, one per stream): message time, lock times, the partial
+*        frame and the time adjustment memo, what every message needs
+*   cold (rtcmcold_t, taken on first use from rtcm_pool_attach_cold()):
+*        type 999 pvt and the antenna and receiver descriptors of 1007, 1008
+*        and 1033, which a station sends rarely if at all, and the msm signal
+*        types, written by every msm message but only read on request
+*
+* the decoders work on an rtcm_t, whose layout is fixed by libINS, so a pool
+* has one, work, and the hot state of a stream is swapped into it when a span
+* of another stream comes in; consecutive spans of a stream swap nothing. the
+* msm signal types each msm message writes into work are copied to the cold
+* block of its stream, the table in work is the one of the last message of
+* any stream. ephemerides go to one nav_t.
+*
+* per stream a pool costs sizeof(rtcmhot_t) + sizeof(obs_t), plus
+* sizeof(rtcmcold_t) for a stream that sent an msm or a rare message. with
+* MAXSAT 150 and NFREQ 2 that is about 1.9 + 3.7 kbytes, against 2.9 kbytes
+* for a whole rtcm_t, and 1216 bytes a cold block, 768 of them the msm
+* signal types; the pool itself adds one rtcm_t. rtcm_replay -n prints the
+* sizes of the build.
+*-----------------------------------------------------------------------------*/
+
+/* a descriptor string: 8 bit count, then the characters ---------------------*/
+static void cold_str(const unsigned char *buff, int *i, char *str, int size)
+{
+    int j, n = rtcm_getbitu(buff, *i, 8);
+
+    *i += 8;
+    for (j = 0; j < n; j++, *i += 8)
+    {
+        if (j < size - 1) str[j] = (char)rtcm_getbitu(buff, *i, 8);
+    }
+    str[n < size - 1 ? n : size - 1] = '\0';
+}
+/* keep what a rare message decoded in the cold state of its stream ----------*/
+static void pool_cold_msg(const rtcmrcv_t *rcv, const rtcm_t *rtcm, int ret)
+{
+    static const signed char msmsys[] = {0, 1, 2, 4, 3, 5}; /* gps glo gal sbs qzs bds */
+    rtcmcoldpool_t *cp = rcv->coldpool;
+    rtcmcold_t *cold = rcv->hot->cold;
+    int i = 24 + 12 + 12, sys = -1;
+
+    if (rtcm->type >= 1074 && rtcm->type <= 1127 && rtcm->type % 10 >= 4 && rtcm->type % 10 <= 7)
+    {
+        if (ret < 0) return;
+        sys = msmsys[(rtcm->type - 1070) / 10];
+    }
+    else switch (rtcm->type)
+    {
+    case 999:
+        if (rtcm->st_pvt.sub_type_id != 4 && rtcm->st_pvt.sub_type_id != 21) return;
+        break;
+    case 1007:
+    case 1008:
+    case 1033:
+        if (ret != 5) return;
+        break;
+    default:
+        return;
+    }
+    if (cold == NULL)
+    {
+        if (cp->nused >= cp->n)
+        {
+            cp->nmiss++;
+            return;
+        }
+        cold = rcv->hot->cold = cp->cold + cp->nused++;
+        memset(cold, 0, sizeof(rtcmcold_t));
+    }
+    if (sys >= 0)
+    {
+        strcpy(cold->msmtype[sys], rtcm->msmtype[sys]);
+        return;
+    }
+    if (rtcm->type == 999)
+    {
+        /* subtype 21 writes the extended record and the header of st_pvt */
+        if (rtcm->st_pvt.sub_type_id == 4)
+        {
+            cold->st_pvt = rtcm->st_pvt;
+        }
+        else
+        {
+            cold->st_pvt.message_number = rtcm->st_pvt.message_number;
+            cold->st_pvt.sub_type_id = rtcm->st_pvt.sub_type_id;
+            cold->st_epvt = rtcm->st_epvt;
+        }
+        return;
+    }
+    cold_str(rtcm->buff, &i, cold->antdes, sizeof(cold->antdes));
+    cold->antsetup = rtcm_getbitu(rtcm->buff, i, 8);
+    i += 8;
+    if (rtcm->type == 1007) return;
+    cold_str(rtcm->buff, &i, cold->antsno, sizeof(cold->antsno));
+    if (rtcm->type == 1008) return;
+    cold_str(rtcm->buff, &i, cold->rectype, sizeof(cold->rectype));
+    cold_str(rtcm->buff, &i, cold->recver, sizeof(cold->recver));
+    cold_str(rtcm->buff, &i, cold->recsno, sizeof(cold->recsno));
+}
+/* move the hot state of a stream between its rtcmhot_t and work -------------*/
+static void pool_store(rtcmpool_t *pool)
+{
+    rtcmhot_t *hot = pool->hot + pool->cur;
+    const rtcm_t *work = pool->work;
+
+    hot->time = work->time;
+    memcpy(hot->lock, work->lock, sizeof(hot->lock));
+    hot->nbyte = work->nbyte;
+    memcpy(hot->buff, work->buff, work->nbyte);
+}
+static void pool_load(rtcmpool_t *pool, unsigned int stream)
+{
+    const rtcmhot_t *hot = pool->hot + stream;
+    rtcm_t *work = pool->work;
+
+    work->time = hot->time;
+    memcpy(work->lock, hot->lock, sizeof(work->lock));
+    work->nbyte = hot->nbyte;
+    memcpy(work->buff, hot->buff, hot->nbyte);
+    pool->cur = stream;
+}
+/* initialize a decoder pool -----------------------------------------------------
+* args   : rtcmpool_t *pool  O   decoder pool
+*          rtcm_t *work      O   decoder state the streams are swapped into
+*          rtcmhot_t *hot    O   hot state of each stream (hot[n])
+*          obs_t  *obs       O   observation data of each stream (obs[n])
+*          unsigned int n    I   number of streams
+*          nav_t  *nav       IO  navigation data shared by the streams
+* return : none
+*-----------------------------------------------------------------------------*/
+extern void rtcm_pool_init(rtcmpool_t *pool, rtcm_t *work, rtcmhot_t *hot, obs_t *obs, unsigned int n,
+                           nav_t *nav)
+{
+    memset(work, 0, sizeof(rtcm_t));
+    memset(hot, 0, sizeof(rtcmhot_t) * n);
+    memset(obs, 0, sizeof(obs_t) * n);
+    memset(&pool->cold, 0, sizeof(pool->cold));
+    pool->n = n;
+    pool->work = work;
+    pool->cur = n;
+    pool->hot = hot;
+    pool->obs = obs;
+    pool->nav = nav;
+    pool->slot = NULL;
+    pool->navslot = NULL;
+    pool->stat = NULL;
+    pool->last = 0;
+}
+/* reset a stream, e.g. when its connection drops or changes mountpoint ---------
+* a cold block the stream took stays with it, cleared
+*-----------------------------------------------------------------------------*/
+extern void rtcm_pool_reset(rtcmpool_t *pool, unsigned int stream)
+{
+    rtcmcold_t *cold;
+
+    if (stream >= pool->n) return;
+
+    if (pool->cur == stream) pool->cur = pool->n;
+    cold = pool->hot[stream].cold;
+    memset(pool->hot + stream, 0, sizeof(rtcmhot_t));
+    if (cold) memset(cold, 0, sizeof(rtcmcold_t));
+    pool->hot[stream].cold = cold;
+    memset(pool->obs + stream, 0, sizeof(obs_t));
+    if (pool->slot) memset(pool->slot + stream, SLOT_NONE, sizeof(satslot_t));
+}
+/* input rtcm3 message of a pool stream from a byte span ---------------------------
+* same as input_rtcm3_buf() for stream of the pool
+* args   : unsigned char *data I data bytes
+*          unsigned int len  I   number of data bytes
+*          unsigned int stream I stream index (0..pool->n-1)
+*          rtcmpool_t *pool  IO  decoder pool
+*          unsigned int *nused O number of data bytes consumed
+*          int    *stat      O   status of the last decoded message (NULL: no output)
+* return : number of messages decoded
+*-----------------------------------------------------------------------------*/
+extern int input_rtcm3_pool(const unsigned char *data, unsigned int len, unsigned int stream,
+                            rtcmpool_t *pool, unsigned int *nused, int *stat)
+{
+    rtcmrcv_t rcv;
+    int ndec, ret;
+
+    if (stream >= pool->n)
+    {
+        *nused = len;
+        if (stat) *stat = 0;
+        return 0;
+    }
+    if (pool->cur != stream)
+    {
+        if (pool->cur < pool->n) pool_store(pool);
+        pool_load(pool, stream);
+    }
+    rtcm_rcv_init(&rcv, pool->work, pool->obs + stream, pool->nav);
+    if (pool->slot) rcv.slot = pool->slot + stream;
+    if (pool->stat) rcv.stat = pool->stat + stream;
+    rcv.navslot = pool->navslot;
+    rcv.memo = &pool->hot[stream].memo;
+    rcv.hot = pool->hot + stream;
+    rcv.coldpool = &pool->cold;
+    ndec = frame_rtcm3(&rcv, data, len, nused, &ret);
+    if (stat) *stat = ret;
+    return ndec;
+}
+/* attach/detach (NULL) the satellite slot indexes of a pool --------------------
+* args   : rtcmpool_t *pool  IO  decoder pool
+*          satslot_t *slot   O   obs index of each stream (slot[pool->n], NULL: none)
+*          navslot_t *navslot O  index of pool->nav (NULL: none)
+* return : none
+*-----------------------------------------------------------------------------*/
+extern void rtcm_pool_attach_satslot(rtcmpool_t *pool, satslot_t *slot, navslot_t *navslot)
+{
+    if (slot) memset(slot, SLOT_NONE, sizeof(satslot_t) * pool->n);
+    if (navslot) navslot->nav = NULL;
+    pool->slot = slot;
+    pool->navslot = navslot;
+}
+/* attach/detach (NULL) the cold state blocks of a pool -------------------------
+* a stream takes a block with its first msm4-7, 999, 1007, 1008 or 1033 and
+* keeps it; with fewer blocks than streams what the late streams would keep
+* there is counted in pool->cold.nmiss and dropped. streams give up the blocks
+* they had.
+* args   : rtcmpool_t *pool  IO  decoder pool
+*          rtcmcold_t *cold  O   blocks (cold[n], NULL: none)
+*          unsigned int n    I   number of blocks
+* return : none
+*-----------------------------------------------------------------------------*/
+extern void rtcm_pool_attach_cold(rtcmpool_t *pool, rtcmcold_t *cold, unsigned int n)
+{
+    unsigned int i;
+
+    for (i = 0; i < pool->n; i++) pool->hot[i].cold = NULL;
+    pool->cold.cold = cold;
+    pool->cold.n = cold ? n : 0;
+    pool->cold.nused = 0;
+    pool->cold.nmiss = 0;
+}
+/* attach/detach (NULL) decoder statistics, one per stream (stat[pool->n]) -----*/
+extern void rtcm_pool_attach_stat(rtcmpool_t *pool, rtcm_stat_t *stat)
+{
+    if (stat) memset(stat, 0, sizeof(rtcm_stat_t) * pool->n);
+    pool->stat = stat;
+}
+/* cold state of a stream (NULL: it sent no msm or rare message yet) ---------*/
+extern const rtcmcold_t *rtcm_pool_cold(const rtcmpool_t *pool, unsigned int stream)
+{
+    return stream < pool->n ? pool->hot[stream].cold : NULL;
+}
+/* observation data of a station -------------------------------------------------
+* args   : rtcmpool_t *pool  IO  decoder pool
+*          unsigned int staid I  reference station id
+* return : observation data in the pool (NULL: station not received)
+*-----------------------------------------------------------------------------*/
+extern obs_t *rtcm_pool_obs(rtcmpool_t *pool, unsigned int staid)
+{
+    unsigned int i;
+
+    if (staid == 0 || pool->n == 0) return NULL;
+
+    if (pool->last < pool->n && pool->obs[pool->last].staid == staid)
+    {
+        return pool->obs + pool->last;
+    }
+    for (i = 0; i < pool->n; i++)
+    {
+        if (pool->obs[i].staid == staid)
+        {
+            pool->last = i;
+            return pool->obs + i;
+        }
+    }
+    return NULL;
+}
@@ -99,5 +99,28 @@ extern uint32_t rtcm_decode_length;
 
 extern int input_rtcm3_data(rtcm_t *rtcm, unsigned char data, obs_t *obs, nav_t *nav);
 extern int input_rtcm3(unsigned char data, unsigned int stnID, gnss_rtcm_t *gnss);
+extern int input_rtcm3_buf(const unsigned char *data, unsigned int len, unsigned int stnID,
+                           gnss_rtcm_t *gnss, unsigned int *nused, int *stat);
+extern void rtcm_rcv_init(rtcmrcv_t *rcv, rtcm_t *rtcm, obs_t *obs, nav_t *nav);
+extern int input_rtcm3_rcv(const unsigned char *data, unsigned int len, rtcmrcv_t *rcv,
+                           unsigned int *nused, int *stat);
+extern int input_rtcm3_rcv_byte(unsigned char data, rtcmrcv_t *rcv);
+extern void rtcm_attach_satslot(rtcmrcv_t *rcv, satslot_t *slot, navslot_t *navslot);
+extern void rtcm_attach_stat(rtcmrcv_t *rcv, rtcm_stat_t *stat);
+extern int rtcm_stat_index(int type);
+extern void rtcm_attach_epoch(rtcmrcv_t *rcv, obsepoch_t *ep);
+extern void rtcm_attach_memo(rtcmrcv_t *rcv, rtcmmemo_t *memo);
+extern const obs_t *rtcm_epoch_get(const obsepoch_t *ep, unsigned int *seq);
+extern int rtcm_epoch_valid(const obsepoch_t *ep, unsigned int seq);
+extern void rtcm_pool_init(rtcmpool_t *pool, rtcm_t *work, rtcmhot_t *hot, obs_t *obs, unsigned int n,
+                           nav_t *nav);
+extern void rtcm_pool_reset(rtcmpool_t *pool, unsigned int stream);
+extern int input_rtcm3_pool(const unsigned char *data, unsigned int len, unsigned int stream,
+                            rtcmpool_t *pool, unsigned int *nused, int *stat);
+extern void rtcm_pool_attach_satslot(rtcmpool_t *pool, satslot_t *slot, navslot_t *navslot);
+extern void rtcm_pool_attach_cold(rtcmpool_t *pool, rtcmcold_t *cold, unsigned int n);
+extern void rtcm_pool_attach_stat(rtcmpool_t *pool, rtcm_stat_t *stat);
+extern const rtcmcold_t *rtcm_pool_cold(const rtcmpool_t *pool, unsigned int stream);
+extern obs_t *rtcm_pool_obs(rtcmpool_t *pool, unsigned int staid);
 
 #endif /* _GNSS_DATA_API_H */
@@ -0,0 +1,85 @@
+/** ***************************************************************************
+ * @file   bench_car_data.c
+ * @brief  odometry CAN frames: queueing in the isr, decoding in the task
+ ******************************************************************************/
+#include <string.h>
+#include "bench.h"
+#include "user_config.h"
+#include "car_data.h"
+#include "time_service.h"
+#include "rtcm.h"
+
+extern int32_t gps_start_week;
+
+static void odo_set(int i, uint32_t id, int startbit, int length, int endian, int source,
+                    double factor, double offset)
+{
+    odo_mesg_t *m = &gOdoConfigurationStruct.odo_mesg[i];
+
+    m->usage = 0x55;
+    m->mesgID = id;
+    m->startbit = (uint8_t)startbit;
+    m->length = (uint8_t)length;
+    m->endian = (uint8_t)endian;
+    m->sign = 0;
+    m->unit = 0;
+    m->source = (uint8_t)source;
+    m->factor = factor;
+    m->offset = offset;
+}
+
+/* two wheel speeds on 0xAA and the gear on 0x3BC, as the default car */
+static void setup(void)
+{
+    static int ready;
+    gtime_t t;
+
+    if (ready) return;
+    t = gpst2time(2230, 100.0);
+    time_service_init();
+    time_service_pps(time_count(), (int64_t)t.time * 1000000);
+    gps_start_week = 2230;
+    memset(&gOdoConfigurationStruct, 0, sizeof(gOdoConfigurationStruct));
+    odo_set(0, 0xAA, 8, 16, 1, 0, 0.01, -6767);
+    odo_set(1, 0xAA, 24, 16, 1, 1, 0.01, -6767);
+    odo_set(2, 0x3BC, 0, 3, 0, 3, 1, 0);
+    car_can_initialize();
+    ready = 1;
+}
+
+/* a frame through the queue, the task drains it every 16 */
+static uint64_t bench_isr_task(uint32_t n)
+{
+    uint8_t data[8] = {0x1b, 0x0f, 0x1b, 0x2d, 0, 0, 0, 0};
+    uint32_t i;
+
+    setup();
+    for (i = 0; i < n; i++)
+    {
+        data[1] = (uint8_t)i;
+        car_can_rx_isr(i & 1 ? 0xAA : 0x3BC, data);
+        if ((i & 15) == 15) bench_sink += car_can_rx_process();
+    }
+    bench_sink += car_can_rx_process();
+    return (uint64_t)n * 8;
+}
+
+/* frames of other ECUs are dropped in the isr */
+static uint64_t bench_isr_unknown(uint32_t n)
+{
+    uint8_t data[8] = {0};
+    uint32_t i;
+
+    setup();
+    for (i = 0; i < n; i++)
+    {
+        car_can_rx_isr(0x123 + (i & 7), data);
+    }
+    return (uint64_t)n * 8;
+}
+
+const bench_t bench_car_data[] = {
+    {"car_data/isr_and_task", bench_isr_task},
+    {"car_data/isr_unknown_id", bench_isr_unknown},
+    BENCH_END
+};
@@ -0,0 +1,58 @@
+/** ***************************************************************************
+ * @file   bench_crc.c
+ * @brief  crc throughput over a rtcm3 frame and a 4 KB block, the library
+ *         build (slice-by-4) and the byte-wise and slice-by-8 variants
+ ******************************************************************************/
+#include "bench.h"
+#include "crc.h"
+#include "rtcm.h"
+#include "crc_variant.h"
+
+static uint8_t block[4096];
+
+static void setup(void)
+{
+    static int ready;
+    uint32_t i;
+
+    if (ready) return;
+    for (i = 0; i < sizeof(block); i++) block[i] = (uint8_t)(i * 2654435761u >> 24);
+    ready = 1;
+}
+
+#define CRC_BENCH(name, len, expr) \
+    static uint64_t name(uint32_t n) \
+    { \
+        uint32_t i, crc = 0; \
+        setup(); \
+        for (i = 0; i < n; i++) crc ^= (expr); \
+        bench_sink += crc; \
+        return (uint64_t)n * (len); \
+    }
+
+CRC_BENCH(bench_ccitt_4k, 4096, CrcCcittUpdate(CRC_CCITT_INITIAL_SEED, block, 4096))
+CRC_BENCH(bench_crc32_4k, 4096, Crc32Update(CRC_32_INITIAL_SEED, block, 4096))
+CRC_BENCH(bench_crc24q_4k, 4096, Crc24qUpdate(0, block, 4096))
+CRC_BENCH(bench_ccitt_4k_1, 4096, CrcCcittUpdate_1(CRC_CCITT_INITIAL_SEED, block, 4096))
+CRC_BENCH(bench_crc32_4k_1, 4096, Crc32Update_1(CRC_32_INITIAL_SEED, block, 4096))
+CRC_BENCH(bench_crc24q_4k_1, 4096, Crc24qUpdate_1(0, block, 4096))
+CRC_BENCH(bench_ccitt_4k_8, 4096, CrcCcittUpdate_8(CRC_CCITT_INITIAL_SEED, block, 4096))
+CRC_BENCH(bench_crc32_4k_8, 4096, Crc32Update_8(CRC_32_INITIAL_SEED, block, 4096))
+CRC_BENCH(bench_crc24q_4k_8, 4096, Crc24qUpdate_8(0, block, 4096))
+CRC_BENCH(bench_crc24q_frame, 300, rtk_crc24q(block, 300))
+CRC_BENCH(bench_ccitt_packet, 40, CrcCcittUpdate(CRC_CCITT_INITIAL_SEED, block, 40))
+
+const bench_t bench_crc[] = {
+    {"crc/ccitt_4k_slice1", bench_ccitt_4k_1},
+    {"crc/ccitt_4k", bench_ccitt_4k},
+    {"crc/ccitt_4k_slice8", bench_ccitt_4k_8},
+    {"crc/crc32_4k_slice1", bench_crc32_4k_1},
+    {"crc/crc32_4k", bench_crc32_4k},
+    {"crc/crc32_4k_slice8", bench_crc32_4k_8},
+    {"crc/crc24q_4k_slice1", bench_crc24q_4k_1},
+    {"crc/crc24q_4k", bench_crc24q_4k},
+    {"crc/crc24q_4k_slice8", bench_crc24q_4k_8},
+    {"crc/rtk_crc24q_300", bench_crc24q_frame},
+    {"crc/ccitt_40", bench_ccitt_packet},
+    BENCH_END
+};
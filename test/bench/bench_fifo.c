@@ -0,0 +1,248 @@
+/** ***************************************************************************
+ * @file   bench_fifo.c
+ * @brief  fifo copies and spans, a producer and a consumer thread, sentence
+ *         formatting, one nmea sentence an op against the sprintf code it
+ *         replaced
+ ******************************************************************************/
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include "bench.h"
+#include "utils.h"
+#include "constants.h"
+#include "nav_math.h"
+#include "rtcm.h"
+#include "nmea_ref.h"
+
+static uint8_t ring[2048];
+FIFO_SIZE_CHECK(sizeof(ring));
+static uint8_t chunk[256];
+
+/* push and get a chunk, the positions walk round the ring */
+static uint64_t bench_push_get(uint32_t n)
+{
+    fifo_type f;
+    uint32_t i;
+
+    fifo_init(&f, ring, sizeof(ring));
+    for (i = 0; i < n; i++)
+    {
+        fifo_push(&f, chunk, 100);
+        fifo_get(&f, chunk, 100);
+    }
+    bench_sink += f.in;
+    return (uint64_t)n * 100;
+}
+
+/* the consumer side of the rtcm path: peek a span and commit it */
+static uint64_t bench_peek_commit(uint32_t n)
+{
+    fifo_type f;
+    uint8_t *p;
+    uint16_t len;
+    uint32_t i;
+    uint64_t bytes = 0;
+
+    fifo_init(&f, ring, sizeof(ring));
+    for (i = 0; i < n; i++)
+    {
+        fifo_push(&f, chunk, 100);
+        while ((len = fifo_peek(&f, &p)) != 0)
+        {
+            bench_sink += p[0];
+            fifo_commit(&f, len);
+            bytes += len;
+        }
+    }
+    return bytes;
+}
+
+/* a uart rx sized fifo between two threads, 100 byte pushes against spans
+   peeked on the other side, one op is one push */
+typedef struct {
+    fifo_type f;
+    uint32_t n;
+} spsc_t;
+
+static void *spsc_consumer(void *arg)
+{
+    spsc_t *sp = arg;
+    uint64_t want = (uint64_t)sp->n * 100, got = 0;
+    uint8_t *p;
+    uint16_t len;
+
+    while (got < want)
+    {
+        len = fifo_peek(&sp->f, &p);
+        if (len == 0)
+        {
+            sched_yield();
+            continue;
+        }
+        bench_sink += p[0];
+        fifo_commit(&sp->f, len);
+        got += len;
+    }
+    return NULL;
+}
+
+static uint64_t bench_spsc_threads(uint32_t n)
+{
+    static spsc_t sp;
+    pthread_t cons;
+    uint32_t i;
+
+    fifo_init(&sp.f, ring, sizeof(ring));
+    sp.n = n;
+    pthread_create(&cons, NULL, spsc_consumer, &sp);
+    for (i = 0; i < n; i++)
+    {
+        while (fifo_space(&sp.f) < 100) sched_yield();
+        fifo_push(&sp.f, chunk, 100);
+    }
+    pthread_join(cons, NULL);
+    return (uint64_t)n * 100;
+}
+
+static uint64_t bench_sentence(uint32_t n)
+{
+    char buf[128];
+    sentence_t s;
+    uint32_t i;
+    uint64_t bytes = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        sentence_begin(&s, buf, sizeof(buf));
+        sentence_str(&s, "$GPIMU,");
+        sentence_uint(&s, 2230, 0);
+        sentence_str(&s, ",");
+        sentence_fixed(&s, 345600.123 + i, 0, 3);
+        sentence_str(&s, ",");
+        sentence_fixed(&s, -0.0123456, 0, 7);
+        sentence_str(&s, ",");
+        sentence_fixed(&s, 9.8012345, 0, 7);
+        bytes += sentence_end(&s, "*");
+    }
+    bench_sink += (uint8_t)buf[10];
+    return bytes;
+}
+
+static uint64_t bench_snprintf(uint32_t n)
+{
+    char buf[128];
+    uint32_t i;
+    uint64_t bytes = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        bytes += (uint64_t)snprintf(buf, sizeof(buf), "$GPIMU,%u,%.3f,%.7f,%.7f*",
+                                    2230u, 345600.123 + i, -0.0123456, 9.8012345) + 4;
+    }
+    bench_sink += (uint8_t)buf[10];
+    return bytes;
+}
+
+/* a walk round a 45 deg latitude circle at 20 m/s, one fix a second */
+#define NMEA_FIXES  64
+
+static double fix_xyz[NMEA_FIXES][6];
+static gtime_t fix_time[NMEA_FIXES];
+static double fix_ep[NMEA_FIXES][6];
+
+static void nmea_setup(void)
+{
+    double pos[3];
+    int i;
+
+    if (fix_time[0].time != 0) return;
+    for (i = 0; i < NMEA_FIXES; i++)
+    {
+        pos[0] = 45.123456789 * D2R;
+        pos[1] = (7.0 + i * 0.00025) * D2R;
+        pos[2] = 312.345;
+        pos2ecef(pos, fix_xyz[i]);
+        fix_xyz[i][3] = -14.1 * sin(pos[1]);
+        fix_xyz[i][4] = 14.1 * cos(pos[1]);
+        fix_xyz[i][5] = 0.0;
+        fix_time[i] = gpst2time(2230, 345600.0 + i + 0.2);
+        time2epoch(gpst2utc(fix_time[i]), fix_ep[i]);
+    }
+}
+
+static uint64_t bench_gga(uint32_t n)
+{
+    char buf[NMEA_GGA_MAXLEN];
+    uint32_t i, k;
+    uint64_t bytes = 0;
+
+    nmea_setup();
+    for (i = 0; i < n; i++)
+    {
+        k = i % NMEA_FIXES;
+        bytes += print_nmea_gga(fix_ep[k], fix_xyz[k], 18, 4, 0.8, 1.2, buf);
+    }
+    bench_sink += (uint8_t)buf[10];
+    return bytes;
+}
+
+static uint64_t bench_gga_ref(uint32_t n)
+{
+    char buf[NMEA_GGA_MAXLEN];
+    uint32_t i, k;
+    uint64_t bytes = 0;
+
+    nmea_setup();
+    for (i = 0; i < n; i++)
+    {
+        k = i % NMEA_FIXES;
+        bytes += nmea_ref_gga(fix_ep[k], fix_xyz[k], 18, 4, 0.8, 1.2, buf);
+    }
+    bench_sink += (uint8_t)buf[10];
+    return bytes;
+}
+
+static uint64_t bench_rmc(uint32_t n)
+{
+    char buf[NMEA_RMC_MAXLEN];
+    uint32_t i, k;
+    uint64_t bytes = 0;
+
+    nmea_setup();
+    for (i = 0; i < n; i++)
+    {
+        k = i % NMEA_FIXES;
+        bytes += print_rmc(fix_time[k], fix_xyz[k], 4, buf);
+    }
+    bench_sink += (uint8_t)buf[10];
+    return bytes;
+}
+
+static uint64_t bench_rmc_ref(uint32_t n)
+{
+    char buf[NMEA_RMC_MAXLEN];
+    uint32_t i, k;
+    uint64_t bytes = 0;
+
+    nmea_setup();
+    for (i = 0; i < n; i++)
+    {
+        k = i % NMEA_FIXES;
+        bytes += nmea_ref_rmc(fix_time[k], fix_xyz[k], 4, buf);
+    }
+    bench_sink += (uint8_t)buf[10];
+    return bytes;
+}
+
+const bench_t bench_fifo[] = {
+    {"fifo/push_get_100", bench_push_get},
+    {"fifo/peek_commit_100", bench_peek_commit},
+    {"fifo/spsc_threads_100", bench_spsc_threads},
+    {"sentence/gpimu", bench_sentence},
+    {"sentence/gpimu_snprintf", bench_snprintf},
+    {"sentence/gga", bench_gga},
+    {"sentence/gga_ref", bench_gga_ref},
+    {"sentence/rmc", bench_rmc},
+    {"sentence/rmc_ref", bench_rmc_ref},
+    BENCH_END
+};
@@ -0,0 +1,113 @@
+/** ***************************************************************************
+ * @file   bench_filter.c
+ * @brief  sensor filters, one op is a sample of every chip and axis
+ ******************************************************************************/
+#include <string.h>
+#include "bench.h"
+#include "filter.h"
+#include "Indices.h"
+#include "sensorsAPI.h"
+
+static void setup(void)
+{
+    static int ready;
+
+    if (ready) return;
+    FilterInit(200);
+    ready = 1;
+}
+
+static void load(uint32_t i)
+{
+    int c, s, *dptr;
+
+    for (c = 0; c < NUM_SENSOR_CHIPS; c++)
+    {
+        dptr = GetRawChipSensorsDataPtr(c);
+        for (s = 0; s < BUTTERWORTH_BANK_AXES; s++) dptr[s] = (int)((i * 7919u + s * 131u) & 0xfffff);
+    }
+}
+
+static uint64_t bench_iir_per_channel(uint32_t n)
+{
+    uint32_t i;
+    int c, s;
+
+    setup();
+    for (i = 0; i < n; i++)
+    {
+        load(i);
+        for (c = 0; c < NUM_SENSOR_CHIPS; c++)
+        {
+            for (s = 0; s < BUTTERWORTH_BANK_AXES; s++) Apply_Butterworth_Q27_Filter(c, &iirTaps_10_Hz, (uint8_t)s);
+        }
+    }
+    bench_sink += GetRawChipSensorsDataPtr(0)[0];
+    return 0;
+}
+
+static uint64_t bench_iir_bank(uint32_t n)
+{
+    static butterworth_bank bank;
+    uint32_t i;
+
+    setup();
+    Butterworth_Q27_BankInit(&bank, BUTTERWORTH_BANK_CHANNELS);
+    Butterworth_Q27_BankSet(&bank, 0, BUTTERWORTH_BANK_CHANNELS, &iirTaps_10_Hz);
+    for (i = 0; i < n; i++)
+    {
+        load(i);
+        Apply_Butterworth_Q27_Bank(&bank);
+    }
+    bench_sink += GetRawChipSensorsDataPtr(0)[0];
+    return 0;
+}
+
+static uint64_t bench_fir_per_channel(uint32_t n)
+{
+    static int32_t x[BUTTERWORTH_BANK_CHANNELS][64];
+    uint32_t i;
+    int c, s;
+
+    setup();
+    for (i = 0; i < n; i++)
+    {
+        load(i);
+        for (c = 0; c < NUM_SENSOR_CHIPS; c++)
+        {
+            for (s = 0; s < BUTTERWORTH_BANK_AXES; s++)
+            {
+                Apply_Bartlett_Q27_Filter(c, &firTaps_5_Hz, (uint8_t)s, x[c * BUTTERWORTH_BANK_AXES + s]);
+            }
+        }
+    }
+    bench_sink += GetRawChipSensorsDataPtr(0)[0];
+    return 0;
+}
+
+static uint64_t bench_fir_bank(uint32_t n)
+{
+    static int32_t delay[FIR_Q27_DELAY_SIZE(64, BUTTERWORTH_BANK_CHANNELS)];
+    int32_t data[BUTTERWORTH_BANK_CHANNELS];
+    fir_q27_bank bank;
+    uint32_t i;
+    int k;
+
+    setup();
+    FIR_Q27_BankInit(&bank, &firTaps_5_Hz, BUTTERWORTH_BANK_CHANNELS, delay);
+    for (i = 0; i < n; i++)
+    {
+        for (k = 0; k < BUTTERWORTH_BANK_CHANNELS; k++) data[k] = (int32_t)((i * 7919u + k * 131u) & 0xfffff);
+        FIR_Q27_BankFilter(&bank, data);
+    }
+    bench_sink += data[0];
+    return 0;
+}
+
+const bench_t bench_filter[] = {
+    {"filter/iir_18ch_per_channel", bench_iir_per_channel},
+    {"filter/iir_18ch_bank", bench_iir_bank},
+    {"filter/fir5hz_18ch_per_channel", bench_fir_per_channel},
+    {"filter/fir5hz_18ch_bank", bench_fir_bank},
+    BENCH_END
+};
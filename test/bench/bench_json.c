@@ -0,0 +1,212 @@
+/** ***************************************************************************
+ * @file   bench_json.c
+ * @brief  status and configuration json, streaming writer and reader
+ *         against cJSON. The B peak column is the heap each one needs.
+ ******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "json_stream.h"
+#include "cJSON.h"
+
+static const char *const keys[] = {
+    "week", "tow", "lat", "lon", "height", "vn", "ve", "vd", "roll", "pitch", "heading", "status"
+};
+#define NKEY    (sizeof(keys) / sizeof(keys[0]))
+
+static uint64_t bench_writer(uint32_t n)
+{
+    static char buf[1024];
+    json_writer_t w;
+    uint32_t i, k;
+    uint64_t bytes = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        json_writer_init(&w, buf, sizeof(buf), NULL, NULL, 1);
+        json_object_begin(&w, NULL);
+        json_add_string(&w, "packetType", "ins");
+        json_object_begin(&w, "data");
+        for (k = 0; k < NKEY; k++) json_add_number(&w, keys[k], k * 1.25 + i);
+        json_object_end(&w);
+        json_object_end(&w);
+        bytes += (uint64_t)json_writer_end(&w);
+    }
+    bench_sink += (uint8_t)buf[3];
+    return bytes;
+}
+
+static uint64_t bench_cjson(uint32_t n)
+{
+    cJSON *root, *data;
+    char *text;
+    uint32_t i, k;
+    uint64_t bytes = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        root = cJSON_CreateObject();
+        cJSON_AddStringToObject(root, "packetType", "ins");
+        data = cJSON_CreateObject();
+        cJSON_AddItemToObject(root, "data", data);
+        for (k = 0; k < NKEY; k++) cJSON_AddNumberToObject(data, keys[k], k * 1.25 + i);
+        text = cJSON_Print(root);
+        bytes += strlen(text);
+        bench_sink += (uint8_t)text[3];
+        free(text);
+        cJSON_Delete(root);
+    }
+    return bytes;
+}
+
+/* the configuration document of the bt link, written and parsed */
+static const char *const cfg_keys[] = {
+    "leverArmBx", "leverArmBy", "leverArmBz",
+    "pointOfInterestBx", "pointOfInterestBy", "pointOfInterestBz",
+    "rotationRbvx", "rotationRbvy", "rotationRbvz"
+};
+#define NCFG    (sizeof(cfg_keys) / sizeof(cfg_keys[0]))
+
+static uint64_t bench_writer_config(uint32_t n)
+{
+    static char buf[1024];
+    json_writer_t w;
+    uint32_t i, k;
+    uint64_t bytes = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        json_writer_init(&w, buf, sizeof(buf), NULL, NULL, 1);
+        json_object_begin(&w, NULL);
+        json_object_begin(&w, "openrtk config");
+        json_add_string(&w, "Product Name", "OpenRTK330L");
+        json_add_string(&w, "Product PN", "5020-3021-01");
+        json_add_number(&w, "Product SN", 2178200112);
+        json_add_string(&w, "Version", "RTK_INS App v2.0.0");
+        json_add_string(&w, "Compile Time", "Oct 16 2026");
+        json_add_string(&w, "userPacketType", "s1");
+        json_add_number(&w, "userPacketRate", 100);
+        for (k = 0; k < NCFG; k++) json_add_number(&w, cfg_keys[k], k * 0.125f + (i & 7));
+        json_object_end(&w);
+        json_object_end(&w);
+        bytes += (uint64_t)json_writer_end(&w);
+    }
+    bench_sink += (uint8_t)buf[3];
+    return bytes;
+}
+
+static uint64_t bench_cjson_config(uint32_t n)
+{
+    cJSON *root, *fmt;
+    char *text;
+    uint32_t i, k;
+    uint64_t bytes = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        root = cJSON_CreateObject();
+        fmt = cJSON_CreateObject();
+        cJSON_AddItemToObject(root, "openrtk config", fmt);
+        cJSON_AddItemToObject(fmt, "Product Name", cJSON_CreateString("OpenRTK330L"));
+        cJSON_AddItemToObject(fmt, "Product PN", cJSON_CreateString("5020-3021-01"));
+        cJSON_AddItemToObject(fmt, "Product SN", cJSON_CreateNumber(2178200112));
+        cJSON_AddItemToObject(fmt, "Version", cJSON_CreateString("RTK_INS App v2.0.0"));
+        cJSON_AddItemToObject(fmt, "Compile Time", cJSON_CreateString("Oct 16 2026"));
+        cJSON_AddItemToObject(fmt, "userPacketType", cJSON_CreateString("s1"));
+        cJSON_AddItemToObject(fmt, "userPacketRate", cJSON_CreateNumber(100));
+        for (k = 0; k < NCFG; k++) cJSON_AddItemToObject(fmt, cfg_keys[k], cJSON_CreateNumber(k * 0.125f + (i & 7)));
+        text = cJSON_Print(root);
+        bytes += strlen(text);
+        bench_sink += (uint8_t)text[3];
+        free(text);
+        cJSON_Delete(root);
+    }
+    return bytes;
+}
+
+static const char config_text[] =
+    "{\"userPacketType\":\"s1\",\"userPacketRate\":100,"
+    "\"leverArmBx\":0.1,\"leverArmBy\":-0.25,\"leverArmBz\":1.5,"
+    "\"pointOfInterestBx\":0,\"pointOfInterestBy\":0,\"pointOfInterestBz\":0,"
+    "\"rotationRbvx\":0,\"rotationRbvy\":0,\"rotationRbvz\":90}";
+
+/* the keys taken the way bt_uart_parse() takes them */
+static uint64_t bench_reader_bt(uint32_t n)
+{
+    json_reader_t r;
+    json_token_e tok;
+    uint32_t i, k;
+    double sum = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        json_reader_init(&r, config_text, sizeof(config_text) - 1);
+        if (json_next(&r) != JSON_OBJECT_BEGIN) break;
+        while ((tok = json_next(&r)) > JSON_DONE && tok != JSON_OBJECT_END)
+        {
+            for (k = 0; k < NCFG; k++)
+            {
+                if (tok == JSON_NUMBER && json_key_is(&r, cfg_keys[k]))
+                {
+                    sum += r.num;
+                    break;
+                }
+            }
+            if (!json_skip(&r, tok)) break;
+        }
+    }
+    bench_sink += (uint64_t)sum;
+    return (uint64_t)n * (sizeof(config_text) - 1);
+}
+
+static uint64_t bench_cjson_parse_bt(uint32_t n)
+{
+    cJSON *root, *item;
+    uint32_t i, k;
+    double sum = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        root = cJSON_Parse(config_text);
+        if (root == NULL) break;
+        for (k = 0; k < NCFG; k++)
+        {
+            item = cJSON_GetObjectItem(root, cfg_keys[k]);
+            if (item != NULL) sum += item->valuedouble;
+        }
+        cJSON_Delete(root);
+    }
+    bench_sink += (uint64_t)sum;
+    return (uint64_t)n * (sizeof(config_text) - 1);
+}
+
+static uint64_t bench_reader(uint32_t n)
+{
+    static const char text[] =
+        "{\"packetType\":\"ntrip\",\"data\":{\"ip\":\"192.168.1.10\",\"port\":2101,"
+        "\"mount\":\"RTCM32\",\"user\":\"u\",\"password\":\"p\",\"list\":[1,2,3]}}";
+    json_reader_t r;
+    json_token_e tok;
+    uint32_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        json_reader_init(&r, text, sizeof(text) - 1);
+        while ((tok = json_next(&r)) > JSON_DONE)
+        {
+            bench_sink += tok;
+        }
+    }
+    return (uint64_t)n * (sizeof(text) - 1);
+}
+
+const bench_t bench_json[] = {
+    {"json/writer_status", bench_writer},
+    {"json/cjson_print_status", bench_cjson},
+    {"json/reader_config", bench_reader},
+    {"json/writer_bt_config", bench_writer_config},
+    {"json/cjson_print_bt_config", bench_cjson_config},
+    {"json/reader_bt_config", bench_reader_bt},
+    {"json/cjson_parse_bt_config", bench_cjson_parse_bt},
+    BENCH_END
+};
@@ -0,0 +1,92 @@
+/** ***************************************************************************
+ * @file   bench_main.c
+ * @brief  host benchmark runner, make bench or host_bench [name filter]
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "bench.h"
+#include "alloc_count.h"
+
+#define BENCH_MIN_NS    200000000ULL    /* a run at least this long is reported */
+#define BENCH_MAX_N     (1U << 30)
+
+volatile uint64_t bench_sink;
+
+extern const bench_t bench_rtcm[];
+extern const bench_t bench_fifo[];
+extern const bench_t bench_crc[];
+extern const bench_t bench_ucb[];
+extern const bench_t bench_json[];
+extern const bench_t bench_filter[];
+extern const bench_t bench_car_data[];
+
+static const bench_t *const benches[] = {
+    bench_rtcm,
+    bench_fifo,
+    bench_crc,
+    bench_ucb,
+    bench_json,
+    bench_filter,
+    bench_car_data,
+};
+
+static uint64_t now_ns(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ULL + (uint64_t)t.tv_nsec;
+}
+
+static void bench_one(const bench_t *b)
+{
+    uint64_t t0, ns, bytes;
+    uint32_t n = 1;
+
+    b->run(1);      /* set up */
+    for (;;)
+    {
+        alloc_count_reset();
+        t0 = now_ns();
+        bytes = b->run(n);
+        ns = now_ns() - t0;
+        if (ns >= BENCH_MIN_NS || n >= BENCH_MAX_N) break;
+        /* aim a little past the minimum, at most 100 times longer per step */
+        if (ns < BENCH_MIN_NS / 100) n *= 100;
+        else n = (uint32_t)((double)n * BENCH_MIN_NS * 1.2 / (double)ns) + 1;
+    }
+
+    printf("%-36s %10u %12.1f ns/op", b->name, n, (double)ns / n);
+    if (bytes)
+    {
+        printf(" %9.1f MB/s", (double)bytes * 1e3 / (double)ns);
+    }
+    else
+    {
+        printf(" %14s", "");
+    }
+    printf(" %8.2f allocs/op %10.1f B/op %8llu B peak\n",
+           (double)alloc_count.allocs / n, (double)alloc_count.bytes / n,
+           (unsigned long long)alloc_count.peak);
+}
+
+int main(int argc, char **argv)
+{
+    const char *filter = argc > 1 ? argv[1] : NULL;
+    const bench_t *b;
+    unsigned int i;
+
+    for (i = 0; i < sizeof(benches) / sizeof(benches[0]); i++)
+    {
+        for (b = benches[i]; b->name; b++)
+        {
+            if (filter == NULL || strstr(b->name, filter))
+            {
+                bench_one(b);
+                fflush(stdout);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,358 @@
+/** ***************************************************************************
+ * @file   bench_rtcm.c
+ * @brief  rtcm3 framing and decoding of generated streams
+ ******************************************************************************/
+#include <string.h>
+#include "bench.h"
+#include "rtcm_gen.h"
+#include "gnss_data_api.h"
+#include "rtcm.h"
+
+#define STREAM_MAX  (256 * 1024)
+
+static gnss_rtcm_t gnss;
+static unsigned char stream[5][STREAM_MAX];     /* 1004/1012, msm4..msm7 */
+static int stream_len[5];
+
+static void setup(void)
+{
+    rtcm_gen_t g;
+    int s, n;
+
+    if (stream_len[0]) return;
+    for (s = 0; s < 5; s++)
+    {
+        rtcm_gen_init(&g, 1 + s, 100);
+        for (n = 0; n + 8 * RTCM_GEN_FRAME_MAX < STREAM_MAX;)
+        {
+            n += rtcm_gen_epoch(&g, s ? 3 + s : 0, 10, stream[s] + n, STREAM_MAX - n);
+        }
+        stream_len[s] = n;
+    }
+}
+
+/* decodes the stream round and round, a stream is one op */
+static uint64_t run_stream(int s, uint32_t n)
+{
+    unsigned int pos, nused;
+    int stat;
+    uint32_t i;
+
+    setup();
+    for (i = 0; i < n; i++)
+    {
+        for (pos = 0; pos < (unsigned int)stream_len[s]; pos += nused)
+        {
+            input_rtcm3_buf(stream[s] + pos, stream_len[s] - pos, ROVER, &gnss, &nused, &stat);
+        }
+    }
+    bench_sink += gnss.obs[ROVER].n;
+    return (uint64_t)stream_len[s] * n;
+}
+
+static uint64_t bench_legacy(uint32_t n) { return run_stream(0, n); }
+static uint64_t bench_msm4(uint32_t n) { return run_stream(1, n); }
+static uint64_t bench_msm5(uint32_t n) { return run_stream(2, n); }
+static uint64_t bench_msm6(uint32_t n) { return run_stream(3, n); }
+static uint64_t bench_msm7(uint32_t n) { return run_stream(4, n); }
+
+/* the byte at a time entry the uart path used */
+static uint64_t bench_msm7_bytes(uint32_t n)
+{
+    uint32_t i;
+    int pos;
+
+    setup();
+    for (i = 0; i < n; i++)
+    {
+        for (pos = 0; pos < stream_len[4]; pos++)
+        {
+            input_rtcm3(stream[4][pos], ROVER, &gnss);
+        }
+    }
+    bench_sink += gnss.obs[ROVER].n;
+    return (uint64_t)stream_len[4] * n;
+}
+
+/* one msm7 frame of 10 satellites, two signals each */
+static uint64_t bench_msm7_frame(uint32_t n)
+{
+    static unsigned char frame[RTCM_GEN_FRAME_MAX];
+    static int len;
+    unsigned int nused;
+    int stat;
+    uint32_t i;
+
+    if (!len)
+    {
+        rtcm_gen_t g;
+        rtcm_gen_init(&g, 9, 100);
+        len = rtcm_gen_frame(&g, 1077, 0, frame);
+    }
+    for (i = 0; i < n; i++)
+    {
+        gnss.obs[ROVER].n = 0;
+        input_rtcm3_buf(frame, len, ROVER, &gnss, &nused, &stat);
+    }
+    bench_sink += gnss.obs[ROVER].n;
+    return (uint64_t)len * n;
+}
+
+/* msm7 through a decoder pool, an epoch of each station in turn, so every
+   call swaps the hot state; against stream_msm7 that is the cost of a pool */
+#define POOL_STATIONS   16
+
+static rtcm_t pool_work;
+static rtcmhot_t pool_hot[POOL_STATIONS];
+static obs_t pool_obs[POOL_STATIONS];
+static nav_t pool_nav;
+
+static uint64_t run_pool(unsigned int nst, uint32_t n)
+{
+    rtcmpool_t pool;
+    unsigned int pos[POOL_STATIONS], k, nused, len, more;
+    int stat;
+    uint32_t i;
+
+    setup();
+    len = (unsigned int)stream_len[4];
+    rtcm_pool_init(&pool, &pool_work, pool_hot, pool_obs, nst, &pool_nav);
+    for (i = 0; i < n; i++)
+    {
+        memset(pos, 0, sizeof(pos));
+        do
+        {
+            more = 0;
+            for (k = 0; k < nst; k++)
+            {
+                if (pos[k] >= len) continue;
+                input_rtcm3_pool(stream[4] + pos[k], len - pos[k], k, &pool, &nused, &stat);
+                pos[k] += nused;
+                more = 1;
+            }
+        } while (more);
+    }
+    bench_sink += pool_obs[0].n;
+    return (uint64_t)len * nst * n;
+}
+
+static uint64_t bench_pool_1(uint32_t n) { return run_pool(1, n); }
+static uint64_t bench_pool_16(uint32_t n) { return run_pool(POOL_STATIONS, n); }
+
+/* msm7 of a rover and a base interleaved by epoch, each receiver with or
+   without its time memo; against each other that is what the memo saves on
+   the headers, two of the four an epoch are taken from it */
+static rtcm_t pair_rtcm[2];
+static obs_t pair_obs[2];
+static nav_t pair_nav;
+static unsigned char pair_base[STREAM_MAX];
+static int pair_base_len;
+
+static uint64_t run_pair(int memo_on, uint32_t n)
+{
+    static rtcmmemo_t memo[2];
+    const unsigned char *data[2];
+    rtcmrcv_t rcv[2];
+    unsigned int pos[2], len[2], nused, more;
+    int k, stat;
+    uint32_t i;
+
+    setup();
+    if (!pair_base_len)
+    {
+        rtcm_gen_t g;
+        rtcm_gen_init(&g, 5, 200);
+        g.tow_ms += 2 * 86400000 + 37000;
+        while (pair_base_len + 8 * RTCM_GEN_FRAME_MAX < STREAM_MAX)
+        {
+            pair_base_len += rtcm_gen_epoch(&g, 7, 0, pair_base + pair_base_len, STREAM_MAX - pair_base_len);
+        }
+    }
+    data[0] = stream[4];
+    len[0] = (unsigned int)stream_len[4];
+    data[1] = pair_base;
+    len[1] = (unsigned int)pair_base_len;
+    for (k = 0; k < 2; k++)
+    {
+        rtcm_rcv_init(rcv + k, pair_rtcm + k, pair_obs + k, &pair_nav);
+        rtcm_attach_memo(rcv + k, memo_on ? memo + k : NULL);
+    }
+    for (i = 0; i < n; i++)
+    {
+        pos[0] = pos[1] = 0;
+        do
+        {
+            more = 0;
+            for (k = 0; k < 2; k++)
+            {
+                if (pos[k] >= len[k]) continue;
+                input_rtcm3_rcv(data[k] + pos[k], len[k] - pos[k], rcv + k, &nused, &stat);
+                pos[k] += nused;
+                more = 1;
+            }
+        } while (more);
+    }
+    bench_sink += pair_obs[0].n + pair_obs[1].n;
+    return (uint64_t)(len[0] + len[1]) * n;
+}
+
+static uint64_t bench_pair_memo(uint32_t n) { return run_pair(1, n); }
+static uint64_t bench_pair_nomemo(uint32_t n) { return run_pair(0, n); }
+
+/* msm7 bit reading ------------------------------------------------------------
+* every field of one msm7 frame per system, walked the way the decoder walks
+* it. "bitloop" is the bit at a time rtcm_getbitu/getbits the decoder had
+* before the word cache, "getbitu" the library one now, which re-seeks for each
+* field and so is the slow end of the cursor. rtcm/decode_<type> is the whole
+* decoder on the same frame, fields through the sequential cursor.
+*-----------------------------------------------------------------------------*/
+static unsigned int bitloop_getbitu(const unsigned char *buff, int pos, int len)
+{
+    unsigned int bits = 0;
+    int i;
+
+    for (i = pos; i < pos + len; i++)
+        bits = (bits << 1) + ((buff[i / 8] >> (7 - i % 8)) & 1u);
+    return bits;
+}
+static int bitloop_getbits(const unsigned char *buff, int pos, int len)
+{
+    unsigned int bits = bitloop_getbitu(buff, pos, len);
+
+    if (len <= 0 || 32 <= len || !(bits & (1u << (len - 1))))
+        return (int)bits;
+    return (int)(bits | (~0u << len));
+}
+
+/* header, masks, satellite and cell fields of msm7, returns a checksum */
+#define MSM7_WALK(name, getu, gets)                                             \
+static uint32_t name(const unsigned char *b)                                    \
+{                                                                               \
+    static const int head[] = {12, 12, 30, 1, 3, 7, 2, 2, 1, 3};                \
+    static const int sat[] = {8, 4, 10};                                        \
+    static const int cell[] = {20, 24, 10, 1, 10, 15};                          \
+    uint32_t sum = 0, satmask_h, satmask_l, sigmask;                            \
+    int i = 24, j, k, nsat, nsig, ncell = 0;                                    \
+                                                                                \
+    for (k = 0; k < 10; k++) { sum += getu(b, i, head[k]); i += head[k]; }      \
+    satmask_h = getu(b, i, 32); i += 32;                                        \
+    satmask_l = getu(b, i, 32); i += 32;                                        \
+    sigmask = getu(b, i, 32); i += 32;                                          \
+    nsat = __builtin_popcount(satmask_h) + __builtin_popcount(satmask_l);       \
+    nsig = __builtin_popcount(sigmask);                                         \
+    for (j = 0; j < nsat * nsig; j++) { ncell += getu(b, i, 1); i++; }          \
+    for (k = 0; k < 3; k++)                                                     \
+        for (j = 0; j < nsat; j++) { sum += getu(b, i, sat[k]); i += sat[k]; }  \
+    for (j = 0; j < nsat; j++) { sum += gets(b, i, 14); i += 14; }              \
+    for (k = 0; k < 6; k++)                                                     \
+        for (j = 0; j < ncell; j++)                                             \
+        {                                                                       \
+            sum += (k == 0 || k == 1 || k == 5) ? (uint32_t)gets(b, i, cell[k]) \
+                                                : getu(b, i, cell[k]);          \
+            i += cell[k];                                                       \
+        }                                                                       \
+    return sum;                                                                 \
+}
+MSM7_WALK(msm7_walk_bitloop, bitloop_getbitu, bitloop_getbits)
+MSM7_WALK(msm7_walk_getbitu, rtcm_getbitu, rtcm_getbits)
+
+static const int msm7_types[4] = {1077, 1087, 1097, 1127};
+static unsigned char msm7_frame[4][RTCM_GEN_FRAME_MAX];
+static int msm7_len[4];
+
+static void msm7_setup(void)
+{
+    rtcm_gen_t g;
+    int s;
+
+    if (msm7_len[0]) return;
+    rtcm_gen_init(&g, 9, 100);
+    for (s = 0; s < 4; s++)
+    {
+        msm7_len[s] = rtcm_gen_frame(&g, msm7_types[s], 0, msm7_frame[s]);
+    }
+}
+
+static uint64_t run_msm7_bitloop(int s, uint32_t n)
+{
+    uint32_t i, sum = 0;
+
+    msm7_setup();
+    for (i = 0; i < n; i++)
+    {
+        __asm__ volatile("" : : "r"(msm7_frame[s]) : "memory");   /* no hoisting */
+        sum += msm7_walk_bitloop(msm7_frame[s]);
+    }
+    bench_sink += sum;
+    return (uint64_t)msm7_len[s] * n;
+}
+
+static uint64_t run_msm7_getbitu(int s, uint32_t n)
+{
+    uint32_t i, sum = 0;
+
+    msm7_setup();
+    for (i = 0; i < n; i++)
+    {
+        __asm__ volatile("" : : "r"(msm7_frame[s]) : "memory");   /* no hoisting */
+        sum += msm7_walk_getbitu(msm7_frame[s]);
+    }
+    bench_sink += sum;
+    return (uint64_t)msm7_len[s] * n;
+}
+
+static uint64_t run_msm7_decode(int s, uint32_t n)
+{
+    unsigned int nused;
+    int stat;
+    uint32_t i;
+
+    msm7_setup();
+    for (i = 0; i < n; i++)
+    {
+        gnss.obs[ROVER].n = 0;
+        input_rtcm3_buf(msm7_frame[s], msm7_len[s], ROVER, &gnss, &nused, &stat);
+    }
+    bench_sink += gnss.obs[ROVER].n;
+    return (uint64_t)msm7_len[s] * n;
+}
+
+static uint64_t bench_bitloop_1077(uint32_t n) { return run_msm7_bitloop(0, n); }
+static uint64_t bench_bitloop_1087(uint32_t n) { return run_msm7_bitloop(1, n); }
+static uint64_t bench_bitloop_1097(uint32_t n) { return run_msm7_bitloop(2, n); }
+static uint64_t bench_bitloop_1127(uint32_t n) { return run_msm7_bitloop(3, n); }
+static uint64_t bench_getbitu_1077(uint32_t n) { return run_msm7_getbitu(0, n); }
+static uint64_t bench_getbitu_1087(uint32_t n) { return run_msm7_getbitu(1, n); }
+static uint64_t bench_getbitu_1097(uint32_t n) { return run_msm7_getbitu(2, n); }
+static uint64_t bench_getbitu_1127(uint32_t n) { return run_msm7_getbitu(3, n); }
+static uint64_t bench_decode_1077(uint32_t n) { return run_msm7_decode(0, n); }
+static uint64_t bench_decode_1087(uint32_t n) { return run_msm7_decode(1, n); }
+static uint64_t bench_decode_1097(uint32_t n) { return run_msm7_decode(2, n); }
+static uint64_t bench_decode_1127(uint32_t n) { return run_msm7_decode(3, n); }
+
+const bench_t bench_rtcm[] = {
+    {"rtcm/stream_1004_1012", bench_legacy},
+    {"rtcm/stream_msm4", bench_msm4},
+    {"rtcm/stream_msm5", bench_msm5},
+    {"rtcm/stream_msm6", bench_msm6},
+    {"rtcm/stream_msm7", bench_msm7},
+    {"rtcm/stream_msm7_bytewise", bench_msm7_bytes},
+    {"rtcm/frame_msm7", bench_msm7_frame},
+    {"rtcm/pool_msm7_1", bench_pool_1},
+    {"rtcm/pool_msm7_16", bench_pool_16},
+    {"rtcm/pair_msm7_memo", bench_pair_memo},
+    {"rtcm/pair_msm7_nomemo", bench_pair_nomemo},
+    {"rtcm/bits_1077_bitloop", bench_bitloop_1077},
+    {"rtcm/bits_1077_getbitu", bench_getbitu_1077},
+    {"rtcm/decode_1077", bench_decode_1077},
+    {"rtcm/bits_1087_bitloop", bench_bitloop_1087},
+    {"rtcm/bits_1087_getbitu", bench_getbitu_1087},
+    {"rtcm/decode_1087", bench_decode_1087},
+    {"rtcm/bits_1097_bitloop", bench_bitloop_1097},
+    {"rtcm/bits_1097_getbitu", bench_getbitu_1097},
+    {"rtcm/decode_1097", bench_decode_1097},
+    {"rtcm/bits_1127_bitloop", bench_bitloop_1127},
+    {"rtcm/bits_1127_getbitu", bench_getbitu_1127},
+    {"rtcm/decode_1127", bench_decode_1127},
+    BENCH_END
+};
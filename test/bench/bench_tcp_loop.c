@@ -0,0 +1,218 @@
+/** ***************************************************************************
+ * @file   bench_tcp_loop.c
+ * @brief  tcp throughput of lwIP on the kernel over the loopback netif,
+ *         make bench or bench_tcp_loop [-m MB] [-w bytes]
+ *
+ * lwIP is built as in the firmware (lwip_sys_host): the tcpip thread and the
+ * netconn api on the host port of the kernel, through the mboxes,
+ * semaphores and protection of LWIP/arch/sys_arch.c. A sender task writes
+ * -m MB in -w byte writes to a receiver task over 127.0.0.1, the receiver
+ * takes netbufs as netconn.c does. Every write and every segment polled off
+ * the loopback netif is a message in the tcpip thread's mbox.
+ *
+ * The kernel's time moves on only while every task waits (the idle hook
+ * fires SysTick), so the ticks are the time the stack sat on its timers,
+ * e.g. delayed acks; the host time is the cost of the code path. Reports
+ * MB/s of host time, the ticks and the lwip_stat.c counters. Exits 1 if the
+ * bytes do not all arrive in order or the ticks run past LOOP_LIMIT_MS.
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "hal_host.h"
+#include "lwip/api.h"
+#include "lwip/tcpip.h"
+#include "lwip_stat.h"
+
+#define LOOP_PORT       5001
+#define LOOP_PERIOD     251             /* the pattern, prime so it walks the segments */
+#define LOOP_WRITE_MAX  (64 * 1024)
+#define LOOP_LIMIT_MS   60000
+
+typedef struct {
+    uint64_t bytes;                     /* to send */
+    uint32_t write;
+    struct netconn *listen;
+    sys_sem_t done;
+    uint64_t got;
+    uint64_t bad;                       /* bytes off the pattern */
+    int timeout;
+    uint64_t t0_ns, t1_ns;
+    TickType_t t0_tick, t1_tick;
+    lwip_stat_t stat;
+} loop_t;
+
+extern void xPortSysTickHandler(void);
+
+static loop_t loop;
+static uint8_t pattern[LOOP_WRITE_MAX + LOOP_PERIOD];
+
+static uint64_t now_ns(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ULL + (uint64_t)t.tv_nsec;
+}
+
+u32_t sys_now(void)
+{
+    return (u32_t)xTaskGetTickCount() * portTICK_PERIOD_MS;
+}
+
+void vApplicationIdleHook(void)
+{
+    host_isr(xPortSysTickHandler);
+    if (xTaskGetTickCount() > LOOP_LIMIT_MS)
+    {
+        loop.timeout = 1;
+        vTaskEndScheduler();
+    }
+}
+
+static void rx_task(void *arg)
+{
+    struct netconn *conn;
+    struct netbuf *buf;
+    struct pbuf *q;
+    uint8_t expect = 0;
+    uint16_t i;
+
+    (void)arg;
+    if (netconn_accept(loop.listen, &conn) == ERR_OK)
+    {
+        while (netconn_recv(conn, &buf) == ERR_OK)
+        {
+            for (q = buf->p; q != NULL; q = q->next)
+            {
+                const uint8_t *p = q->payload;
+
+                for (i = 0; i < q->len; i++)
+                {
+                    loop.bad += p[i] != expect;
+                    expect = expect == LOOP_PERIOD - 1 ? 0 : expect + 1;
+                }
+                loop.got += q->len;
+            }
+            netbuf_delete(buf);
+        }
+        netconn_close(conn);
+        netconn_delete(conn);
+    }
+    sys_sem_signal(&loop.done);
+    vTaskDelete(NULL);
+}
+
+static void tcpip_ready(void *arg)
+{
+    sys_sem_signal((sys_sem_t *)arg);
+}
+
+static void tx_task(void *arg)
+{
+    struct netconn *conn;
+    ip_addr_t addr;
+    uint64_t sent = 0;
+    uint32_t n;
+
+    (void)arg;
+    sys_sem_new(&loop.done, 0);
+    tcpip_init(tcpip_ready, &loop.done);
+    sys_arch_sem_wait(&loop.done, 0);
+
+    loop.listen = netconn_new(NETCONN_TCP);
+    netconn_bind(loop.listen, IP_ADDR_ANY, LOOP_PORT);
+    netconn_listen(loop.listen);
+    sys_thread_new("rx", rx_task, NULL, DEFAULT_THREAD_STACKSIZE, osPriorityNormal);
+
+    loop.t0_ns = now_ns();
+    loop.t0_tick = xTaskGetTickCount();
+    IP4_ADDR(&addr, 127, 0, 0, 1);
+    conn = netconn_new(NETCONN_TCP);
+    if (netconn_connect(conn, &addr, LOOP_PORT) == ERR_OK)
+    {
+        while (sent < loop.bytes)
+        {
+            n = loop.bytes - sent < loop.write ? (uint32_t)(loop.bytes - sent) : loop.write;
+            if (netconn_write(conn, pattern + sent % LOOP_PERIOD, n, NETCONN_COPY) != ERR_OK)
+            {
+                break;
+            }
+            sent += n;
+        }
+    }
+    netconn_close(conn);
+    netconn_delete(conn);
+
+    sys_arch_sem_wait(&loop.done, 0);
+    loop.t1_ns = now_ns();
+    loop.t1_tick = xTaskGetTickCount();
+    lwip_stat_get(&loop.stat);
+    vTaskEndScheduler();
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: bench_tcp_loop [-m MB] [-w bytes, at most %u]\n", LOOP_WRITE_MAX);
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    const lwip_stat_pool_t *pool;
+    double mb;
+    int opt, i;
+
+    loop.bytes = 16u << 20;
+    loop.write = TCP_MSS;
+    while ((opt = getopt(argc, argv, "m:w:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'm': loop.bytes = (uint64_t)(atof(optarg) * (1 << 20)); break;
+        case 'w': loop.write = (uint32_t)atoi(optarg); break;
+        default: usage();
+        }
+    }
+    if (loop.bytes == 0 || loop.write == 0 || loop.write > LOOP_WRITE_MAX || optind != argc) usage();
+
+    for (i = 0; i < (int)sizeof(pattern); i++)
+    {
+        pattern[i] = (uint8_t)(i % LOOP_PERIOD);
+    }
+    sys_thread_new("tx", tx_task, NULL, DEFAULT_THREAD_STACKSIZE, osPriorityNormal);
+    vTaskStartScheduler();
+
+    if (loop.timeout)
+    {
+        printf("tcp_loop: %llu of %llu bytes in, no progress for %u ms of kernel time\n",
+               (unsigned long long)loop.got, (unsigned long long)loop.bytes, LOOP_LIMIT_MS);
+        return 1;
+    }
+    mb = (double)loop.got / (1 << 20);
+    printf("tcp_loop %.1f MB in %u B writes: %.1f MB/s host, %u ms kernel time\n",
+           mb, loop.write, (double)loop.got * 1e3 / (double)(loop.t1_ns - loop.t0_ns),
+           (unsigned int)((loop.t1_tick - loop.t0_tick) * portTICK_PERIOD_MS));
+    printf("  mbox max %u full %u, tcp rexmit %u\n",
+           loop.stat.mbox_max, loop.stat.mbox_full, loop.stat.tcp_rexmit);
+    for (i = 0; i < LWIP_STAT_POOLS; i++)
+    {
+        pool = &loop.stat.pool[i];
+        if (pool->avail)
+        {
+            printf("  %-16s max %3u of %3u, err %u\n", lwip_stat_pool_name(i), pool->max, pool->avail, pool->err);
+        }
+    }
+    printf("  %-16s max %5u of %5u, err %u\n", "heap", loop.stat.heap.max, loop.stat.heap.avail, loop.stat.heap.err);
+
+    if (loop.got != loop.bytes || loop.bad != 0)
+    {
+        printf("tcp_loop: %llu of %llu bytes in, %llu off the pattern\n", (unsigned long long)loop.got,
+               (unsigned long long)loop.bytes, (unsigned long long)loop.bad);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,81 @@
+/** ***************************************************************************
+ * @file   bench_ucb.c
+ * @brief  ucb packet code lookups
+ ******************************************************************************/
+#include "bench.h"
+#include "ucb_packet.h"
+
+extern ucb_packet_t ucbPackets[];
+
+/* every code of the table in turn */
+static uint64_t bench_code_to_type(uint32_t n)
+{
+    static uint8_t codes[64][2];
+    static int ncode;
+    uint32_t i, sum = 0;
+
+    if (!ncode)
+    {
+        const ucb_packet_t *pkt;
+        for (pkt = ucbPackets; pkt->packetType != UCB_PKT_NONE; pkt++, ncode++)
+        {
+            codes[ncode][0] = (uint8_t)(pkt->packetCode >> 8);
+            codes[ncode][1] = (uint8_t)pkt->packetCode;
+        }
+    }
+    for (i = 0; i < n; i++)
+    {
+        sum += UcbPacketBytesToPacketType(codes[i % ncode]);
+    }
+    bench_sink += sum;
+    return 0;
+}
+
+static uint64_t bench_unknown_code(uint32_t n)
+{
+    uint8_t code[2] = {'Z', 'Q'};
+    uint32_t i, sum = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        sum += UcbPacketBytesToPacketType(code);
+    }
+    bench_sink += sum;
+    return 0;
+}
+
+/* a user packet, after the miss in the built-in table */
+static uint64_t bench_user_code(uint32_t n)
+{
+    uint8_t code[2] = {'s', '1'};
+    uint32_t i, sum = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        sum += UcbPacketBytesToPacketType(code);
+    }
+    bench_sink += sum;
+    return 0;
+}
+
+static uint64_t bench_type_to_code(uint32_t n)
+{
+    uint8_t code[2];
+    uint32_t i, sum = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        UcbPacketPacketTypeToBytes((UcbPacketType)(UCB_IDENTIFICATION + i % 10), code);
+        sum += code[0];
+    }
+    bench_sink += sum;
+    return 0;
+}
+
+const bench_t bench_ucb[] = {
+    {"ucb/code_to_type", bench_code_to_type},
+    {"ucb/code_to_type_unknown", bench_unknown_code},
+    {"ucb/code_to_type_user", bench_user_code},
+    {"ucb/type_to_code", bench_type_to_code},
+    BENCH_END
+};
@@ -0,0 +1,71 @@
+/** ***************************************************************************
+ * @file   FreeRTOSConfig.h
+ * @brief  kernel configuration of the host build, the firmware one with the
+ *         host port (port_host.c) settings
+ ******************************************************************************/
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <stdint.h>
+#include <assert.h>
+extern uint32_t SystemCoreClock;
+
+#define configUSE_PREEMPTION              1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION 0
+#define configUSE_NEWLIB_REENTRANT        0
+#define configUSE_IDLE_HOOK               1     /* the idle task moves the simulated time on */
+#define configUSE_TICK_HOOK               0
+#define configCPU_CLOCK_HZ                (SystemCoreClock)
+#define configTICK_RATE_HZ                ((TickType_t)1000)
+#define configMAX_PRIORITIES              (7)
+#define configMINIMAL_STACK_SIZE          ((uint16_t)256)
+#define configTOTAL_HEAP_SIZE             ((size_t)(1024 * 1024))
+#define configMAX_TASK_NAME_LEN           (16)
+#define configUSE_TRACE_FACILITY          1
+#define configUSE_16_BIT_TICKS            0
+#define configIDLE_SHOULD_YIELD           1
+#define configUSE_MUTEXES                 1
+#define configQUEUE_REGISTRY_SIZE         0
+#define configCHECK_FOR_STACK_OVERFLOW    0
+#define configUSE_RECURSIVE_MUTEXES       1
+#define configUSE_MALLOC_FAILED_HOOK      0
+#define configUSE_APPLICATION_TASK_TAG    0
+#define configUSE_COUNTING_SEMAPHORES     1
+#define configUSE_TASK_NOTIFICATIONS      1
+#define configSUPPORT_DYNAMIC_ALLOCATION  1
+#define configSUPPORT_STATIC_ALLOCATION   0
+#define configGENERATE_RUN_TIME_STATS     1
+
+/* cpu share from task_prof.h, as in the firmware template */
+#if (configGENERATE_RUN_TIME_STATS == 1)
+extern void task_prof_init(void);
+extern uint32_t task_prof_runtime(void);
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() task_prof_init()
+#define portGET_RUN_TIME_COUNTER_VALUE()         task_prof_runtime()
+#endif
+
+/* Co-routine definitions. */
+#define configUSE_CO_ROUTINES           0
+#define configMAX_CO_ROUTINE_PRIORITIES (2)
+
+/* Software timer definitions. */
+#define configUSE_TIMERS             1
+#define configTIMER_TASK_PRIORITY    (6)
+#define configTIMER_QUEUE_LENGTH     10
+#define configTIMER_TASK_STACK_DEPTH (configMINIMAL_STACK_SIZE * 2)
+
+#define INCLUDE_vTaskPrioritySet       1
+#define INCLUDE_uxTaskPriorityGet      1
+#define INCLUDE_vTaskDelete            1
+#define INCLUDE_vTaskCleanUpResources  0
+#define INCLUDE_vTaskSuspend           1
+#define INCLUDE_vTaskDelayUntil        1
+#define INCLUDE_vTaskDelay             1
+#define INCLUDE_xTaskGetSchedulerState 1
+#define INCLUDE_xTaskGetCurrentTaskHandle 1
+#define INCLUDE_eTaskGetState          1
+#define INCLUDE_xTimerPendFunctionCall 1
+
+#define configASSERT(x) assert(x)
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,69 @@
+/** ***************************************************************************
+ * @file   app_host.c
+ * @brief  host stand-ins for what the application, the board drivers and the
+ *         closed libraries supply to the modules under test
+ ******************************************************************************/
+#include <math.h>
+#include <string.h>
+#include "user_config.h"
+#include "user_message.h"
+#include "timer.h"
+#include "can.h"
+#include "ucb_packet.h"
+
+UserConfigurationStruct gUserConfiguration;
+OdoConfigurationStruct gOdoConfigurationStruct;
+uint8_t nema_update_flag = 0;
+int32_t gps_start_week = -1;
+volatile mcu_time_base_t g_MCU_time;
+
+/* can.c */
+uint32_t filterNum = 0;
+
+void can_config(uint8_t mode, int baudRate)
+{
+    (void)mode;
+    (void)baudRate;
+}
+
+void can_config_filter_list_message(uint32_t ID1, uint32_t ID2)
+{
+    (void)ID1;
+    (void)ID2;
+    filterNum++;
+}
+
+/* libSensors */
+static int raw_chip_sensors[3][16];
+
+int *GetRawChipSensorsDataPtr(int chipId)
+{
+    return raw_chip_sensors[chipId % 3];
+}
+
+/* libINS, the rtklib definitions */
+double norm(const double *a, int n)
+{
+    double c = 0.0;
+    int i;
+
+    for (i = 0; i < n; i++)
+    {
+        c += a[i] * a[i];
+    }
+    return sqrt(c);
+}
+
+void ecef2enu(const double *pos, const double *r, double *e)
+{
+    double sinp = sin(pos[0]), cosp = cos(pos[0]), sinl = sin(pos[1]), cosl = cos(pos[1]);
+    double E[9];
+
+    E[0] = -sinl;           E[3] = cosl;            E[6] = 0.0;
+    E[1] = -sinp * cosl;    E[4] = -sinp * sinl;    E[7] = cosp;
+    E[2] = cosp * cosl;     E[5] = cosp * sinl;     E[8] = sinp;
+
+    e[0] = E[0] * r[0] + E[3] * r[1] + E[6] * r[2];
+    e[1] = E[1] * r[0] + E[4] * r[1] + E[7] * r[2];
+    e[2] = E[2] * r[0] + E[5] * r[1] + E[8] * r[2];
+}
@@ -0,0 +1,46 @@
+/** ***************************************************************************
+ * @file   cc.h
+ * @brief  LWIP/arch/cc.h for the host build: the same types at their sizes
+ *         on a 64 bit host
+ ******************************************************************************/
+#ifndef __CC_H__
+#define __CC_H__
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BYTE_ORDER_LOCAL LITTLE_ENDIAN
+
+typedef uint8_t   u8_t;
+typedef int8_t    s8_t;
+typedef uint16_t  u16_t;
+typedef int16_t   s16_t;
+typedef uint32_t  u32_t;
+typedef int32_t   s32_t;
+
+typedef uintptr_t mem_ptr_t;
+typedef int sys_prot_t;
+
+#define PACK_STRUCT_BEGIN
+#define PACK_STRUCT_STRUCT __attribute__ ((__packed__))
+#define PACK_STRUCT_END
+#define PACK_STRUCT_FIELD(x) x
+
+#define U16_F "u"
+#define S16_F "d"
+#define X16_F "x"
+#define U32_F "u"
+#define S32_F "d"
+#define X32_F "x"
+#define SZT_F "zu"
+
+#define LWIP_PLATFORM_ASSERT(x) \
+    do \
+    {   printf("Assertion \"%s\" failed at line %d in %s\n", x, __LINE__, __FILE__); \
+        abort(); \
+    } while(0)
+
+#define LWIP_PLATFORM_DIAG(x) do {printf x;} while(0)
+
+#endif /* __CC_H__ */
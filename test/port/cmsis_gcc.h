@@ -0,0 +1,11 @@
+/** ***************************************************************************
+ * @file   cmsis_gcc.h
+ * @brief  host stand-in, the core functions cmsis_os.c uses come from
+ *         stm32f4xx_hal.h
+ ******************************************************************************/
+#ifndef _HOST_CMSIS_GCC_H_
+#define _HOST_CMSIS_GCC_H_
+
+#include "stm32f4xx_hal.h"
+
+#endif /* _HOST_CMSIS_GCC_H_ */
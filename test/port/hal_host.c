@@ -0,0 +1,131 @@
+/** ***************************************************************************
+ * @file   hal_host.c
+ * @brief  host stand-in for the HAL and the CMSIS core registers
+ ******************************************************************************/
+#include <pthread.h>
+#include "stm32f4xx_hal.h"
+#include "hal_host.h"
+
+DWT_Type host_dwt;
+CoreDebug_Type host_core_debug;
+uint32_t SystemCoreClock = HOST_CORE_CLOCK;
+__thread uint32_t host_ipsr = 0;
+
+static pthread_mutex_t primask_lock = PTHREAD_MUTEX_INITIALIZER;
+static __thread uint32_t primask = 0;
+static __thread volatile void *exclusive_addr = NULL;
+static __thread uint32_t exclusive_value = 0;
+static host_cycles_hook_t cycles_hook = NULL;
+
+
+/** ***************************************************************************
+ * @name host_cycles_advance
+ * @brief move the cycle counter on, the hook sees every step so it can fire
+ *        the interrupts due in between
+ * @param [in] cycles: counts to add
+ * @retval N/A
+ ******************************************************************************/
+void host_cycles_advance(uint32_t cycles)
+{
+    if (cycles_hook != NULL)
+    {
+        cycles_hook(cycles);
+    }
+    else
+    {
+        host_dwt.CYCCNT += cycles;
+    }
+}
+
+
+/** ***************************************************************************
+ * @name host_cycles_hook
+ * @brief hand host_cycles_advance() to the simulation, NULL to detach
+ * @param [in] hook: advances the counter itself
+ * @retval N/A
+ ******************************************************************************/
+void host_cycles_hook(host_cycles_hook_t hook)
+{
+    cycles_hook = hook;
+}
+
+
+uint32_t __get_PRIMASK(void)
+{
+    return primask;
+}
+
+void __set_PRIMASK(uint32_t mask)
+{
+    if (mask && !primask)
+    {
+        pthread_mutex_lock(&primask_lock);
+    }
+    else if (!mask && primask)
+    {
+        pthread_mutex_unlock(&primask_lock);
+    }
+    primask = mask ? 1 : 0;
+}
+
+void __disable_irq(void)
+{
+    __set_PRIMASK(1);
+}
+
+void __enable_irq(void)
+{
+    __set_PRIMASK(0);
+}
+
+
+uint32_t __LDREXW(volatile uint32_t *addr)
+{
+    exclusive_value = __atomic_load_n(addr, __ATOMIC_SEQ_CST);
+    exclusive_addr = addr;
+    return exclusive_value;
+}
+
+uint32_t __STREXW(uint32_t value, volatile uint32_t *addr)
+{
+    uint32_t expected = exclusive_value;
+
+    if (exclusive_addr != addr)
+    {
+        return 1;
+    }
+    exclusive_addr = NULL;
+    return __atomic_compare_exchange_n(addr, &expected, value, 0,
+                                       __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? 0 : 1;
+}
+
+uint16_t __LDREXH(volatile uint16_t *addr)
+{
+    exclusive_value = __atomic_load_n(addr, __ATOMIC_SEQ_CST);
+    exclusive_addr = addr;
+    return (uint16_t)exclusive_value;
+}
+
+uint32_t __STREXH(uint16_t value, volatile uint16_t *addr)
+{
+    uint16_t expected = (uint16_t)exclusive_value;
+
+    if (exclusive_addr != addr)
+    {
+        return 1;
+    }
+    exclusive_addr = NULL;
+    return __atomic_compare_exchange_n(addr, &expected, value, 0,
+                                       __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST) ? 0 : 1;
+}
+
+
+uint32_t HAL_GetTick(void)
+{
+    return (uint32_t)((uint64_t)host_dwt.CYCCNT * 1000 / SystemCoreClock);
+}
+
+/* the tick is read off the cycle counter */
+void HAL_IncTick(void)
+{
+}
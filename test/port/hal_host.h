@@ -0,0 +1,19 @@
+/** ***************************************************************************
+ * @file   hal_host.h
+ * @brief  controls of the host stand-ins that the target has no API for
+ ******************************************************************************/
+#ifndef _HAL_HOST_H_
+#define _HAL_HOST_H_
+
+#include <stdint.h>
+
+#define HOST_CORE_CLOCK     180000000U      /* SystemCoreClock of the target */
+
+typedef void (*host_cycles_hook_t)(uint32_t cycles);
+
+void host_cycles_hook(host_cycles_hook_t hook);
+
+/* port_host.c: run an interrupt handler on the running task */
+void host_isr(void (*isr)(void));
+
+#endif /* _HAL_HOST_H_ */
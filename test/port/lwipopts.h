@@ -0,0 +1,39 @@
+/** ***************************************************************************
+ * @file   lwipopts.h
+ * @brief  the firmware's lwipopts.h for the host build of lwIP: the raw api
+ *         without a kernel (NO_SYS), on the loopback netif only. With
+ *         HOST_LWIP_SYS the kernel, sys_arch.c and the netconn api stay in
+ *         as in the firmware (lwip_sys_host).
+ ******************************************************************************/
+#ifndef _HOST_LWIPOPTS_H_
+#define _HOST_LWIPOPTS_H_
+
+#include_next "lwipopts.h"
+
+#ifndef HOST_LWIP_SYS
+#undef NO_SYS
+#define NO_SYS                         1
+#undef SYS_LIGHTWEIGHT_PROT
+#define SYS_LIGHTWEIGHT_PROT           0
+
+#undef LWIP_NETCONN
+#define LWIP_NETCONN                   0
+
+#undef LWIP_STATS
+#define LWIP_STATS                     0
+#undef MEM_STATS
+#undef MEMP_STATS
+#undef SYS_STATS
+#endif
+
+#undef LWIP_SOCKET
+#define LWIP_SOCKET                    0
+#undef LWIP_DHCP
+#define LWIP_DHCP                      0
+#undef LWIP_DNS
+#define LWIP_DNS                       0
+
+#define LWIP_NETIF_LOOPBACK            1
+#define LWIP_HAVE_LOOPIF               1
+
+#endif /* _HOST_LWIPOPTS_H_ */
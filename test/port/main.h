@@ -0,0 +1,12 @@
+/** ***************************************************************************
+ * @file   main.h
+ * @brief  host stand-in for the application's main.h
+ ******************************************************************************/
+#ifndef _HOST_MAIN_H_
+#define _HOST_MAIN_H_
+
+#include <stdint.h>
+
+extern uint8_t nema_update_flag;        /* set when print_pos_gga() wrote a sentence */
+
+#endif /* _HOST_MAIN_H_ */
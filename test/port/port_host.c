@@ -0,0 +1,167 @@
+/** ***************************************************************************
+ * @file   port_host.c
+ * @brief  FreeRTOS port of the host build: tasks on threads, one at a time
+ *
+ * Every task is a thread that runs only while it is the kernel's current
+ * task; a context switch posts the semaphore of the next thread and waits on
+ * its own. Time does not pass on its own: the simulated code moves the cycle
+ * counter on with host_cycles_advance() and the simulation's hook fires the
+ * interrupts due, through host_isr(), on the thread of the running task. A
+ * yield in an isr or a critical section is held back to its end, as PendSV
+ * is on the target, so the kernel sees the same preemption points. With one
+ * thread running and time only moving on request the schedule is the same
+ * on every run.
+ ******************************************************************************/
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdint.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stm32f4xx_hal.h"
+#include "hal_host.h"
+
+typedef struct {
+    pthread_t thread;
+    sem_t run;                  /* posted when the task is switched in */
+    TaskFunction_t code;
+    void *param;
+    UBaseType_t nesting;        /* critical nesting while switched out */
+} host_task_t;
+
+extern __thread uint32_t host_ipsr;
+
+static host_task_t *running = NULL;
+static UBaseType_t critical_nesting = 0;
+static int yield_pending = 0;
+static sem_t scheduler_end;
+
+/* the port keeps its task in place of the stack pointer, first in the tcb */
+static host_task_t *task_of(TaskHandle_t handle)
+{
+    return *(host_task_t *volatile *)handle;
+}
+
+static void host_switch(host_task_t *from, host_task_t *to)
+{
+    from->nesting = critical_nesting;
+    running = to;
+    sem_post(&to->run);
+    while (sem_wait(&from->run) != 0)
+    {
+    }
+    critical_nesting = from->nesting;
+}
+
+static void *host_task_main(void *arg)
+{
+    host_task_t *task = arg;
+
+    while (sem_wait(&task->run) != 0)
+    {
+    }
+    critical_nesting = 0;
+    task->code(task->param);
+    vTaskDelete(NULL);      /* a task function must not return */
+    return NULL;
+}
+
+StackType_t *pxPortInitialiseStack(StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters)
+{
+    host_task_t *task = (host_task_t *)(((uintptr_t)pxTopOfStack - sizeof(host_task_t)) & ~(uintptr_t)15);
+    pthread_attr_t attr;
+
+    task->code = pxCode;
+    task->param = pvParameters;
+    task->nesting = 0;
+    sem_init(&task->run, 0, 0);
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    pthread_create(&task->thread, &attr, host_task_main, task);
+    pthread_attr_destroy(&attr);
+
+    return (StackType_t *)task;
+}
+
+BaseType_t xPortStartScheduler(void)
+{
+    sem_init(&scheduler_end, 0, 0);
+    critical_nesting = 0;
+    running = task_of(xTaskGetCurrentTaskHandle());
+    sem_post(&running->run);
+    while (sem_wait(&scheduler_end) != 0)
+    {
+    }
+    return pdFALSE;
+}
+
+/* back to the caller of vTaskStartScheduler(), the tasks stay parked */
+void vPortEndScheduler(void)
+{
+    host_task_t *self = running;
+
+    running = NULL;
+    sem_post(&scheduler_end);
+    for (;;)
+    {
+        sem_wait(&self->run);
+    }
+}
+
+void vPortYield(void)
+{
+    host_task_t *from = running, *to;
+
+    if (host_ipsr != 0 || critical_nesting != 0 || from == NULL)
+    {
+        yield_pending = 1;
+        return;
+    }
+    yield_pending = 0;
+    vTaskSwitchContext();
+    to = task_of(xTaskGetCurrentTaskHandle());
+    if (to != from)
+    {
+        host_switch(from, to);
+    }
+}
+
+void vPortEnterCritical(void)
+{
+    critical_nesting++;
+}
+
+void vPortExitCritical(void)
+{
+    if (--critical_nesting == 0 && yield_pending && host_ipsr == 0)
+    {
+        vPortYield();
+    }
+}
+
+/** ***************************************************************************
+ * @name host_isr
+ * @brief run an interrupt handler on the running task, switch on its way out
+ *        if it woke a higher priority task. Held back interrupts are not
+ *        modelled: the simulation does not move time on in critical sections.
+ * @param [in] isr: handler
+ * @retval N/A
+ ******************************************************************************/
+void host_isr(void (*isr)(void))
+{
+    host_ipsr = 1;
+    isr();
+    host_ipsr = 0;
+    if (yield_pending && critical_nesting == 0)
+    {
+        vPortYield();
+    }
+}
+
+/* cmsis_os.c osSystickHandler() */
+void xPortSysTickHandler(void)
+{
+    if (xTaskIncrementTick() != pdFALSE)
+    {
+        yield_pending = 1;
+    }
+}
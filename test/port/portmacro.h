@@ -0,0 +1,47 @@
+/** ***************************************************************************
+ * @file   portmacro.h
+ * @brief  FreeRTOS port of the host build, see port_host.c
+ ******************************************************************************/
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+#include <stdint.h>
+
+#define portCHAR        char
+#define portFLOAT       float
+#define portDOUBLE      double
+#define portLONG        long
+#define portSHORT       short
+#define portSTACK_TYPE  uintptr_t
+#define portBASE_TYPE   long
+
+typedef portSTACK_TYPE StackType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define portMAX_DELAY               (TickType_t)0xffffffffUL
+#define portTICK_TYPE_IS_ATOMIC     1
+#define portSTACK_GROWTH            (-1)
+#define portTICK_PERIOD_MS          ((TickType_t)1000 / configTICK_RATE_HZ)
+#define portBYTE_ALIGNMENT          8
+#define portPOINTER_SIZE_TYPE       uintptr_t
+
+void vPortYield(void);
+void vPortEnterCritical(void);
+void vPortExitCritical(void);
+
+#define portYIELD()                             vPortYield()
+#define portEND_SWITCHING_ISR(x)                do { if ((x) != pdFALSE) portYIELD(); } while (0)
+#define portYIELD_FROM_ISR(x)                   portEND_SWITCHING_ISR(x)
+#define portSET_INTERRUPT_MASK_FROM_ISR()       0
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)    (void)(x)
+#define portDISABLE_INTERRUPTS()
+#define portENABLE_INTERRUPTS()
+#define portENTER_CRITICAL()                    vPortEnterCritical()
+#define portEXIT_CRITICAL()                     vPortExitCritical()
+#define portTASK_FUNCTION_PROTO(f, p)           void f(void *p)
+#define portTASK_FUNCTION(f, p)                 void f(void *p)
+#define portNOP()
+
+#endif /* PORTMACRO_H */
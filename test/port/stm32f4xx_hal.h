@@ -0,0 +1,114 @@
+/** ***************************************************************************
+ * @file   stm32f4xx_hal.h
+ * @brief  host stand-in for the HAL and the CMSIS core registers
+ *
+ * Only what the modules built on the host use. The cycle counter is a plain
+ * variable the tests and the simulation drive, PRIMASK is one lock shared by
+ * every thread so a critical section on the host excludes the same code it
+ * excludes on the target, and LDREX/STREX are a compare and swap.
+ ******************************************************************************/
+#ifndef _HOST_STM32F4XX_HAL_H_
+#define _HOST_STM32F4XX_HAL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum
+{
+    HAL_OK       = 0x00U,
+    HAL_ERROR    = 0x01U,
+    HAL_BUSY     = 0x02U,
+    HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+/* DWT and CoreDebug */
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern DWT_Type host_dwt;
+extern CoreDebug_Type host_core_debug;
+extern uint32_t SystemCoreClock;
+
+#define DWT                             (&host_dwt)
+#define CoreDebug                       (&host_core_debug)
+#define DWT_CTRL_CYCCNTENA_Msk          (1UL)
+#define CoreDebug_DEMCR_TRCENA_Msk      (1UL << 24)
+
+/* cycle counter, host_cycles_advance() also runs the work hooked to the
+   counter (the simulation's timer interrupts) */
+void host_cycles_advance(uint32_t cycles);
+
+/* PRIMASK */
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t primask);
+void __disable_irq(void);
+void __enable_irq(void);
+
+static inline uint32_t __get_IPSR(void)
+{
+    extern __thread uint32_t host_ipsr;
+    return host_ipsr;
+}
+
+/* exclusive access */
+uint32_t __LDREXW(volatile uint32_t *addr);
+uint32_t __STREXW(uint32_t value, volatile uint32_t *addr);
+uint16_t __LDREXH(volatile uint16_t *addr);
+uint32_t __STREXH(uint16_t value, volatile uint16_t *addr);
+#define __CLREX()                       ((void)0)
+#define __DMB()                         __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __DSB()                         __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __ISB()                         __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define __NOP()                         ((void)0)
+#define __REV(x)                        __builtin_bswap32(x)
+
+uint32_t HAL_GetTick(void);
+void HAL_IncTick(void);
+
+/* CAN */
+#define CAN_ID_STD                      (0x00000000U)
+#define CAN_ID_EXT                      (0x00000004U)
+#define CAN_RTR_DATA                    (0x00000000U)
+#define CAN_RTR_REMOTE                  (0x00000002U)
+#define CAN_TX_MAILBOX0                 (0x00000001U)
+#define CAN_TX_MAILBOX1                 (0x00000002U)
+#define CAN_TX_MAILBOX2                 (0x00000004U)
+#define CAN_RX_FIFO0                    (0x00000000U)
+#define CAN_RX_FIFO1                    (0x00000001U)
+
+typedef struct
+{
+    uint32_t StdId;
+    uint32_t ExtId;
+    uint32_t IDE;
+    uint32_t RTR;
+    uint32_t DLC;
+    uint32_t TransmitGlobalTime;
+} CAN_TxHeaderTypeDef;
+
+typedef struct
+{
+    uint32_t StdId;
+    uint32_t ExtId;
+    uint32_t IDE;
+    uint32_t RTR;
+    uint32_t DLC;
+    uint32_t Timestamp;
+    uint32_t FilterMatchIndex;
+} CAN_RxHeaderTypeDef;
+
+typedef struct
+{
+    void *Instance;
+    uint32_t ErrorCode;
+} CAN_HandleTypeDef;
+
+#endif /* _HOST_STM32F4XX_HAL_H_ */
@@ -0,0 +1,39 @@
+/** ***************************************************************************
+ * @file   user_config.h
+ * @brief  host stand-in for the application's configuration, with the fields
+ *         the platform library reads
+ ******************************************************************************/
+#ifndef _HOST_USER_CONFIG_H_
+#define _HOST_USER_CONFIG_H_
+
+#include <stdint.h>
+
+typedef struct {
+    uint8_t  usage;             /* 0x55: in use */
+    uint32_t mesgID;
+    uint8_t  startbit;
+    uint8_t  length;
+    uint8_t  endian;
+    uint8_t  sign;
+    uint8_t  unit;
+    uint8_t  source;
+    double   factor;
+    double   offset;
+} odo_mesg_t;
+
+typedef struct {
+    uint8_t    flag;
+    uint8_t    can_mode;
+    uint8_t    wheeltick_pin_mode;
+    double     gears[4];
+    odo_mesg_t odo_mesg[3];
+} OdoConfigurationStruct;
+
+typedef struct {
+    int32_t  can_baudrate;
+} UserConfigurationStruct;
+
+extern UserConfigurationStruct gUserConfiguration;
+extern OdoConfigurationStruct gOdoConfigurationStruct;
+
+#endif /* _HOST_USER_CONFIG_H_ */
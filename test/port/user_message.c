@@ -0,0 +1,60 @@
+/** ***************************************************************************
+ * @file   user_message.c
+ * @brief  host stand-in for the application's user packets: tables in the
+ *         application's form, looked up through the hash ucb_code_tables.py
+ *         generates from them at build time
+ ******************************************************************************/
+#include <stdint.h>
+#include "ucb_packet.h"
+#include "user_message.h"
+
+usr_packet_t userInputPackets[] = {
+//   Packet Type                Packet Code
+    {USR_IN_NONE,               {0,0}},
+    {USR_IN_PING,               "pG"},
+    {USR_IN_UPDATE_PARAM,       "uP"},
+    {USR_IN_SAVE_CONFIG,        "sC"},
+    {USR_IN_GET_ALL,            "gA"},
+    {USR_IN_GET_BLOCK,          "gB"},
+    {USR_IN_MAX,                {0xff, 0xff}},   //  "  "
+};
+
+usr_packet_t userOutputPackets[] = {
+//   Packet Type                Packet Code
+    {USR_OUT_NONE,              {0,0}},
+    {USR_OUT_SCALED1,           "s1"},
+    {USR_OUT_INSPVA,            "iN"},
+    {USR_OUT_STATUS,            "sT"},
+    {USR_OUT_MAX,               {0xff, 0xff}},   //  "  "
+};
+
+#include "user_code_tables.h"     // userInputIndex, userOutputIndex, userOutputCode
+
+static int userInputPacketType = USR_IN_NONE;    /* kept for the handler, as the application does */
+int userOutputPacketType = USR_OUT_SCALED1;
+
+int checkUserPacketType(uint16_t receivedCode)
+{
+    int type = UcbCodeIndexFind(&userInputIndex, receivedCode);
+
+    if (type >= 0) {
+        userInputPacketType = type;
+        return UCB_USER_IN;
+    }
+    type = UcbCodeIndexFind(&userOutputIndex, receivedCode);
+    if (type >= 0) {
+        return UCB_USER_OUT;
+    }
+    return UCB_ERROR_INVALID_TYPE;
+}
+
+void userPacketTypeToBytes(uint8_t bytes[])
+{
+    uint16_t code = 0;
+
+    if ((unsigned)userOutputPacketType < sizeof(userOutputCode) / sizeof(userOutputCode[0])) {
+        code = userOutputCode[userOutputPacketType];
+    }
+    bytes[0] = (uint8_t)(code >> 8);
+    bytes[1] = (uint8_t)code;
+}
@@ -0,0 +1,34 @@
+/** ***************************************************************************
+ * @file   user_message.h
+ * @brief  host stand-in for the application's user packets
+ ******************************************************************************/
+#ifndef _HOST_USER_MESSAGE_H_
+#define _HOST_USER_MESSAGE_H_
+
+#include <stdint.h>
+
+/* user packets of the stand-in tables in user_message.c */
+typedef enum {
+    USR_IN_NONE = 0,
+    USR_IN_PING,
+    USR_IN_UPDATE_PARAM,
+    USR_IN_SAVE_CONFIG,
+    USR_IN_GET_ALL,
+    USR_IN_GET_BLOCK,
+    USR_IN_MAX
+} UserInPacketType;
+
+typedef enum {
+    USR_OUT_NONE = 0,
+    USR_OUT_SCALED1,
+    USR_OUT_INSPVA,
+    USR_OUT_STATUS,
+    USR_OUT_MAX
+} UserOutPacketType;
+
+extern int userOutputPacketType;    /* output packet of the UCB_USER_OUT type */
+
+int checkUserPacketType(uint16_t receivedCode);
+void userPacketTypeToBytes(uint8_t bytes[]);
+
+#endif /* _HOST_USER_MESSAGE_H_ */
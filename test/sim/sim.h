@@ -0,0 +1,88 @@
+/** ***************************************************************************
+ * @file   sim.h
+ * @brief  simulated time and the stand-in drivers of the task graph simulation
+ *
+ * Time is a 64 bit cycle count of the target clock, DWT->CYCCNT is its low
+ * word. It moves on only when the running task charges work (sim_work()) or
+ * the idle task waits for the next interrupt; the interrupts due are fired
+ * in order of time through the kernel port, so a run is the same every time.
+ ******************************************************************************/
+#ifndef _SIM_H_
+#define _SIM_H_
+
+#include <stdint.h>
+#include "utils.h"
+#include "hal_host.h"
+
+#define SIM_US(us)          ((uint64_t)(us) * (HOST_CORE_CLOCK / 1000000))
+#define SIM_NEVER           UINT64_MAX
+
+/* an interrupt source, the handler sets next for its next firing */
+typedef struct sim_irq {
+    const char *name;
+    uint64_t next;                      /* cycle of the next firing, SIM_NEVER: off */
+    void (*isr)(struct sim_irq *irq);
+    uint32_t n;                         /* firings */
+} sim_irq_t;
+
+void sim_init(uint64_t end);
+void sim_irq_add(sim_irq_t *irq);
+uint64_t sim_now(void);
+void sim_work(uint64_t cycles);
+void sim_idle(void);
+
+/* a periodic interrupt, e.g. SysTick or the sensor timer */
+typedef struct {
+    sim_irq_t irq;
+    uint64_t period;
+    void (*handler)(void);
+} sim_timer_t;
+
+void sim_timer_init(sim_timer_t *t, const char *name, uint32_t period_us, uint32_t phase_us,
+                    void (*handler)(void));
+
+/* a byte stream arriving in bursts, one burst a period, at the link rate and
+   an interrupt each chunk or at the end of the burst: the gnss uart (dma
+   half transfer and idle line) or the ethernet rx of the NTRIP socket (one
+   segment an interrupt). Bytes go to the fifo of the task, what does not fit
+   is dropped. The stream starts over after the last burst. */
+typedef struct sim_link {
+    sim_irq_t irq;
+    const uint8_t *data;
+    const uint32_t *burst;              /* burst lengths, summing to the data length */
+    uint32_t nburst;
+    uint32_t period_us;
+    uint32_t bytes_per_s;
+    uint32_t chunk;
+    fifo_type *fifo;
+    void (*rx)(struct sim_link *link);  /* after the bytes are pushed, in the isr */
+    uint32_t pos, iburst, left;
+    uint64_t burst_start;
+    uint32_t nbyte, ndrop, nburst_done;
+} sim_link_t;
+
+void sim_link_init(sim_link_t *link, const char *name, const uint8_t *data,
+                   const uint32_t *burst, uint32_t nburst, uint32_t period_us,
+                   uint32_t bytes_per_s, uint32_t chunk, fifo_type *fifo,
+                   void (*rx)(sim_link_t *link));
+
+/* the car's CAN bus: Toyota wheel speed frames on 0xAA, the speed moving
+   slowly, handed to car_can_rx_isr() as the CAN rx interrupt does */
+typedef struct {
+    sim_irq_t irq;
+    uint64_t period;
+    uint32_t id;
+    uint32_t nframe;
+} sim_can_t;
+
+void sim_can_init(sim_can_t *can, uint32_t id, uint32_t period_us, uint32_t phase_us);
+
+/* the tcp sink of the driver output: bytes and segments sent */
+typedef struct {
+    uint32_t nbyte;
+    uint32_t nseg;
+} sim_net_t;
+
+void sim_net_send(sim_net_t *net, uint32_t len);
+
+#endif /* _SIM_H_ */
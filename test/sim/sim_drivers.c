@@ -0,0 +1,270 @@
+/** ***************************************************************************
+ * @file   sim_drivers.c
+ * @brief  simulated time and the stand-in drivers of the task graph simulation
+ ******************************************************************************/
+#include <stddef.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stm32f4xx_hal.h"
+#include "car_data.h"
+#include "sim.h"
+
+#define SIM_NIRQ        8
+#define SIM_MSS         1460            /* tcp segment of the driver output */
+
+static uint64_t now = 0;
+static sim_irq_t *irqs[SIM_NIRQ];
+static int nirq = 0;
+static sim_irq_t *firing = NULL;
+static sim_irq_t end_irq;
+
+static void set_now(uint64_t t)
+{
+    now = t;
+    DWT->CYCCNT = (uint32_t)t;
+}
+
+static sim_irq_t *next_irq(void)
+{
+    sim_irq_t *irq = NULL;
+    int i;
+
+    /* the first added wins a tie, as the lower exception number does */
+    for (i = 0; i < nirq; i++)
+    {
+        if (irqs[i]->next != SIM_NEVER && (irq == NULL || irqs[i]->next < irq->next))
+        {
+            irq = irqs[i];
+        }
+    }
+    return irq;
+}
+
+static void dispatch(void)
+{
+    sim_irq_t *irq = firing;
+
+    irq->n++;
+    irq->isr(irq);
+}
+
+/* charge cycles to the running context, firing what falls due on the way; an
+   interrupt may switch to another task, whose work moves the time on before
+   this one gets the rest of its share */
+static void sim_run(uint64_t cycles)
+{
+    sim_irq_t *irq;
+
+    while ((irq = next_irq()) != NULL && irq->next - now <= cycles)
+    {
+        cycles -= irq->next - now;
+        set_now(irq->next);
+        firing = irq;
+        host_isr(dispatch);
+    }
+    set_now(now + cycles);
+}
+
+static void sim_advance(uint32_t cycles)
+{
+    sim_run(cycles);
+}
+
+static void end_isr(sim_irq_t *irq)
+{
+    (void)irq;
+    vTaskEndScheduler();
+}
+
+
+/** ***************************************************************************
+ * @name sim_init
+ * @brief start the time at 0 and hook it to the cycle counter
+ * @param [in] end: cycle at which the scheduler is stopped
+ * @retval N/A
+ ******************************************************************************/
+void sim_init(uint64_t end)
+{
+    set_now(0);
+    nirq = 0;
+    end_irq.name = "end";
+    end_irq.next = end;
+    end_irq.isr = end_isr;
+    sim_irq_add(&end_irq);
+    host_cycles_hook(sim_advance);
+}
+
+void sim_irq_add(sim_irq_t *irq)
+{
+    configASSERT(nirq < SIM_NIRQ);
+    irq->n = 0;
+    irqs[nirq++] = irq;
+}
+
+uint64_t sim_now(void)
+{
+    return now;
+}
+
+
+/** ***************************************************************************
+ * @name sim_work
+ * @brief the running task computes for a while
+ * @param [in] cycles: cpu time of the work
+ * @retval N/A
+ ******************************************************************************/
+void sim_work(uint64_t cycles)
+{
+    sim_run(cycles);
+}
+
+
+/** ***************************************************************************
+ * @name sim_idle
+ * @brief sleep to the next interrupt, from the idle task
+ * @retval N/A
+ ******************************************************************************/
+void sim_idle(void)
+{
+    sim_irq_t *irq = next_irq();
+
+    if (irq != NULL)
+    {
+        sim_run(irq->next - now);
+    }
+}
+
+
+static void timer_isr(sim_irq_t *irq)
+{
+    sim_timer_t *t = (sim_timer_t *)irq;
+
+    irq->next += t->period;
+    t->handler();
+}
+
+void sim_timer_init(sim_timer_t *t, const char *name, uint32_t period_us, uint32_t phase_us,
+                    void (*handler)(void))
+{
+    t->irq.name = name;
+    t->irq.next = SIM_US(phase_us);
+    t->irq.isr = timer_isr;
+    t->period = SIM_US(period_us);
+    t->handler = handler;
+    sim_irq_add(&t->irq);
+}
+
+
+static uint64_t link_cycles(const sim_link_t *link, uint32_t len)
+{
+    return ((uint64_t)len * HOST_CORE_CLOCK + link->bytes_per_s - 1) / link->bytes_per_s;
+}
+
+static uint32_t link_chunk(const sim_link_t *link)
+{
+    return link->left < link->chunk ? link->left : link->chunk;
+}
+
+static void link_isr(sim_irq_t *irq)
+{
+    sim_link_t *link = (sim_link_t *)irq;
+    uint32_t n, pushed;
+
+    /* a burst starts: its first bytes are on the wire, nothing to hand over */
+    if (link->left == 0)
+    {
+        irq->n--;
+        link->burst_start = now;
+        link->left = link->burst[link->iburst];
+        irq->next = now + link_cycles(link, link_chunk(link));
+        return;
+    }
+
+    n = link_chunk(link);
+    pushed = fifo_push(link->fifo, (uint8_t *)link->data + link->pos, (uint16_t)n);
+    link->nbyte += pushed;
+    link->ndrop += n - pushed;
+    link->pos += n;
+    link->left -= n;
+    if (link->left > 0)
+    {
+        irq->next = now + link_cycles(link, link_chunk(link));
+    }
+    else
+    {
+        link->nburst_done++;
+        if (++link->iburst == link->nburst)
+        {
+            link->iburst = 0;
+            link->pos = 0;
+        }
+        irq->next = link->burst_start + SIM_US(link->period_us);
+        if (irq->next < now)
+        {
+            irq->next = now;        /* the link is saturated, the next burst follows on */
+        }
+    }
+    link->rx(link);
+}
+
+void sim_link_init(sim_link_t *link, const char *name, const uint8_t *data,
+                   const uint32_t *burst, uint32_t nburst, uint32_t period_us,
+                   uint32_t bytes_per_s, uint32_t chunk, fifo_type *fifo,
+                   void (*rx)(sim_link_t *link))
+{
+    link->irq.name = name;
+    link->irq.next = nburst > 0 ? 0 : SIM_NEVER;
+    link->irq.isr = link_isr;
+    link->data = data;
+    link->burst = burst;
+    link->nburst = nburst;
+    link->period_us = period_us;
+    link->bytes_per_s = bytes_per_s;
+    link->chunk = chunk;
+    link->fifo = fifo;
+    link->rx = rx;
+    link->pos = 0;
+    link->iburst = 0;
+    link->left = 0;
+    link->burst_start = 0;
+    link->nbyte = 0;
+    link->ndrop = 0;
+    link->nburst_done = 0;
+    sim_irq_add(&link->irq);
+}
+
+
+/* 0..60 km/h and back in a minute, 0.01 km/h with the -67.67 offset of the
+   Toyota signal, front wheels in bytes 0-1 and 2-3, motorola */
+static void can_isr(sim_irq_t *irq)
+{
+    sim_can_t *can = (sim_can_t *)irq;
+    uint32_t ms = (uint32_t)(now / SIM_US(1000)) % 60000;
+    uint32_t speed = (ms < 30000 ? ms : 60000 - ms) / 5;
+    uint16_t raw = (uint16_t)(speed + 6767);
+    uint8_t data[8] = {0};
+
+    data[0] = data[2] = (uint8_t)(raw >> 8);
+    data[1] = data[3] = (uint8_t)raw;
+    irq->next += can->period;
+    can->nframe++;
+    car_can_rx_isr(can->id, data);
+}
+
+void sim_can_init(sim_can_t *can, uint32_t id, uint32_t period_us, uint32_t phase_us)
+{
+    can->irq.name = "can";
+    can->irq.next = SIM_US(phase_us);
+    can->irq.isr = can_isr;
+    can->period = SIM_US(period_us);
+    can->id = id;
+    can->nframe = 0;
+    sim_irq_add(&can->irq);
+}
+
+
+void sim_net_send(sim_net_t *net, uint32_t len)
+{
+    net->nbyte += len;
+    net->nseg += (len + SIM_MSS - 1) / SIM_MSS;
+}
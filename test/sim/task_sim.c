@@ -0,0 +1,520 @@
+/** ***************************************************************************
+ * @file   task_sim.c
+ * @brief  the firmware task graph on the kernel, on the host, in simulated time
+ *
+ *   task_sim [-t seconds] [-r rover.rtcm] [-b base.rtcm] [-p task=prio] [-c task=us[/ns]]
+ *
+ * FreeRTOS runs with the host port and the tasks of the graph run as they do
+ * on the target: the sensor timer releases the imu and CAN tasks, the imu
+ * task hands over to ins, the gnss uart feeds the rtcm task and the NTRIP
+ * socket the NTRIP task, driver_interface and dhcp_thread delay. The rtcm
+ * decoder, the CAN signal extraction and the timing records of task_prof.c
+ * are the firmware's own; the rest of a task is a cpu cost, -c task=us for a
+ * job and ns for each byte or frame of it. -p sets a task's osPriority.
+ * Without files the rover (msm7) and base (msm4) streams are generated.
+ *
+ * Reports the response time (release to done), jitter (spread of release
+ * interval and response), late releases and cpu share of each task, and the
+ * traffic of the stand-in drivers. Exits 1 if a task never completed a job,
+ * an imu release came while the last was pending or the decoder lost data.
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "cmsis_os.h"
+#include "task_prof.h"
+#include "timer.h"
+#include "time_service.h"
+#include "user_config.h"
+#include "car_data.h"
+#include "gnss_data_api.h"
+#include "rtcm_gen.h"
+#include "sim.h"
+
+#define STREAM_MAX      (4 * 1024 * 1024)
+#define STREAM_EPOCHS   4096
+#define UART_BAUD       115200
+#define NET_BYTES_S     (100000000 / 8)
+#define DRIVER_PERIOD   100                     /* ms */
+#define DRIVER_OUT_LEN  320                     /* bytes of output a period */
+#define DHCP_PERIOD     250                     /* ms, dhcp_thread */
+
+typedef struct {
+    const char *name;
+    task_prof_id_t id;
+    os_pthread code;
+    osPriority prio;
+    uint32_t job_us;                            /* cpu time of a job */
+    uint32_t item_ns;                           /* and of each byte or frame */
+} sim_task_t;
+
+typedef struct {
+    uint8_t *data;
+    uint32_t len;
+    uint32_t burst[STREAM_EPOCHS];              /* one epoch each */
+    uint32_t nburst;
+} stream_t;
+
+static void imu_task(void const *arg);
+static void ins_task(void const *arg);
+static void rtcm_task(void const *arg);
+static void can_task(void const *arg);
+static void ntrip_task(void const *arg);
+static void driver_task(void const *arg);
+static void dhcp_task(void const *arg);
+
+/* priorities of the firmware where lwip_comm.c sets them (dhcp), the others
+   are the application's and assumed here */
+static sim_task_t tasks[TASK_PROF_MAX] = {
+    {"imu",    TASK_PROF_IMU,    imu_task,    osPriorityHigh,        120,  0},
+    {"ins",    TASK_PROF_INS,    ins_task,    osPriorityAboveNormal, 2500, 0},
+    {"rtcm",   TASK_PROF_RTCM,   rtcm_task,   osPriorityNormal,      20,   400},
+    {"can",    TASK_PROF_CAN,    can_task,    osPriorityNormal,      10,   4000},
+    {"ntrip",  TASK_PROF_NTRIP,  ntrip_task,  osPriorityBelowNormal, 20,   400},
+    {"driver", TASK_PROF_DRIVER, driver_task, osPriorityBelowNormal, 200,  50},
+    {"dhcp",   TASK_PROF_DHCP,   dhcp_task,   osPriorityLow,         50,   0},
+};
+
+osSemaphoreDef(sem_imu);
+osSemaphoreDef(sem_ins);
+osSemaphoreDef(sem_can);
+osSemaphoreDef(sem_rtcm);
+osSemaphoreDef(sem_ntrip);
+static osSemaphoreId sem_imu, sem_ins, sem_can, sem_rtcm, sem_ntrip;
+
+static sim_timer_t systick, sensor_timer;
+static sim_link_t uart, eth;
+static sim_can_t can;
+static sim_net_t net;
+
+static stream_t rover_stream, base_stream;
+static uint8_t rover_buf[4096], base_buf[4096];
+FIFO_SIZE_CHECK(sizeof(rover_buf));
+FIFO_SIZE_CHECK(sizeof(base_buf));
+static fifo_type rover_fifo, base_fifo;
+
+static gnss_rtcm_t gnss;
+static rtcmrcv_t rover, base;
+static rtcm_stat_t rover_stat, base_stat;
+
+
+static uint64_t item_cost(const sim_task_t *t, uint32_t items)
+{
+    return (uint64_t)items * t->item_ns * (HOST_CORE_CLOCK / 1000000) / 1000;
+}
+
+static uint64_t cost(const sim_task_t *t, uint32_t items)
+{
+    return SIM_US(t->job_us) + item_cost(t, items);
+}
+
+/* the released job of a task waits for the last of its input */
+static void take(osSemaphoreId sem)
+{
+    osSemaphoreWait(sem, osWaitForever);
+}
+
+static void imu_task(void const *arg)
+{
+    const sim_task_t *t = arg;
+
+    for (;;)
+    {
+        take(sem_imu);
+        sim_work(cost(t, 0));
+        TASK_PROF_DONE(TASK_PROF_IMU);
+        TASK_PROF_RELEASE(TASK_PROF_INS);
+        osSemaphoreRelease(sem_ins);
+    }
+}
+
+static void ins_task(void const *arg)
+{
+    const sim_task_t *t = arg;
+
+    for (;;)
+    {
+        take(sem_ins);
+        sim_work(cost(t, 0));
+        TASK_PROF_DONE(TASK_PROF_INS);
+    }
+}
+
+static void decode(rtcmrcv_t *rcv, fifo_type *fifo, const sim_task_t *t)
+{
+    uint8_t buf[256];
+    unsigned int pos, nused;
+    uint16_t n;
+    int st;
+
+    sim_work(cost(t, 0));
+    while ((n = fifo_get(fifo, buf, sizeof(buf))) > 0)
+    {
+        for (pos = 0; pos < n; pos += nused)
+        {
+            input_rtcm3_rcv(buf + pos, n - pos, rcv, &nused, &st);
+        }
+        sim_work(item_cost(t, n));
+    }
+}
+
+static void rtcm_task(void const *arg)
+{
+    for (;;)
+    {
+        take(sem_rtcm);
+        decode(&rover, &rover_fifo, arg);
+        TASK_PROF_DONE(TASK_PROF_RTCM);
+    }
+}
+
+static void ntrip_task(void const *arg)
+{
+    for (;;)
+    {
+        take(sem_ntrip);
+        decode(&base, &base_fifo, arg);
+        TASK_PROF_DONE(TASK_PROF_NTRIP);
+    }
+}
+
+/* TaskCANCommunicationJ1939, can_mode 0 */
+static void can_task(void const *arg)
+{
+    const sim_task_t *t = arg;
+    uint32_t n;
+
+    car_can_initialize();
+    for (;;)
+    {
+        osSemaphoreWait(sem_can, 1000);
+        n = car_can_rx_process();
+        sim_work(cost(t, n));
+        TASK_PROF_DONE(TASK_PROF_CAN);
+    }
+}
+
+/* a delaying task's release is its wake up, the wait for the cpu shows in
+   the spread of its period */
+static void driver_task(void const *arg)
+{
+    const sim_task_t *t = arg;
+    uint32_t wake = osKernelSysTick();
+
+    for (;;)
+    {
+        osDelayUntil(&wake, DRIVER_PERIOD);
+        TASK_PROF_RELEASE(TASK_PROF_DRIVER);
+        sim_work(cost(t, DRIVER_OUT_LEN));
+        sim_net_send(&net, DRIVER_OUT_LEN);
+        TASK_PROF_DONE(TASK_PROF_DRIVER);
+    }
+}
+
+static void dhcp_task(void const *arg)
+{
+    const sim_task_t *t = arg;
+
+    for (;;)
+    {
+        osDelay(DHCP_PERIOD);
+        TASK_PROF_RELEASE(TASK_PROF_DHCP);
+        sim_work(cost(t, 0));
+        TASK_PROF_DONE(TASK_PROF_DHCP);
+    }
+}
+
+/* timer_isr_if() of the sensor timer with INS_APP, 1 kHz */
+static void sensor_timer_isr(void)
+{
+    time_service_tick();
+    g_MCU_time.msec += 1;
+    if (g_MCU_time.msec >= 1000)
+    {
+        g_MCU_time.msec = 0;
+        g_MCU_time.time++;
+    }
+    if (g_MCU_time.msec % 10 == 0)
+    {
+        TASK_PROF_RELEASE(TASK_PROF_IMU);
+        osSemaphoreRelease(sem_imu);
+    }
+    if (gOdoConfigurationStruct.can_mode == 0 || gOdoConfigurationStruct.can_mode == 1)
+    {
+        if (g_MCU_time.msec % 10 == 0)
+        {
+            TASK_PROF_RELEASE(TASK_PROF_CAN);
+            osSemaphoreRelease(sem_can);
+        }
+    }
+}
+
+/* a job is the decode of an epoch, released when its last byte is in */
+static void uart_rx(sim_link_t *link)
+{
+    if (link->left == 0)
+    {
+        TASK_PROF_RELEASE(TASK_PROF_RTCM);
+    }
+    osSemaphoreRelease(sem_rtcm);
+}
+
+static void eth_rx(sim_link_t *link)
+{
+    if (link->left == 0)
+    {
+        TASK_PROF_RELEASE(TASK_PROF_NTRIP);
+    }
+    osSemaphoreRelease(sem_ntrip);
+}
+
+void vApplicationIdleHook(void)
+{
+    sim_idle();
+}
+
+/* a recorded stream is cut into epochs where the decoder completes one */
+static int cut(stream_t *s)
+{
+    static gnss_rtcm_t scratch;
+    rtcmrcv_t rcv;
+    unsigned int pos, nused, start = 0;
+    int st;
+
+    rtcm_rcv_init(&rcv, scratch.rcv, scratch.obs, &scratch.nav);
+    for (pos = 0; pos < s->len && s->nburst < STREAM_EPOCHS; pos += nused)
+    {
+        input_rtcm3_rcv(s->data + pos, s->len - pos, &rcv, &nused, &st);
+        if (st == 1)
+        {
+            s->burst[s->nburst++] = pos + nused - start;
+            start = pos + nused;
+        }
+    }
+    s->len = start;
+    return s->nburst > 0;
+}
+
+static int load(stream_t *s, const char *path, uint32_t seed, int staid, int msm, int epochs)
+{
+    rtcm_gen_t g;
+    FILE *fp;
+    int i, n;
+
+    if ((s->data = malloc(STREAM_MAX)) == NULL) return 0;
+    s->len = 0;
+    s->nburst = 0;
+    if (path)
+    {
+        if ((fp = fopen(path, "rb")) == NULL)
+        {
+            perror(path);
+            return 0;
+        }
+        s->len = (uint32_t)fread(s->data, 1, STREAM_MAX, fp);
+        fclose(fp);
+        if (!cut(s))
+        {
+            fprintf(stderr, "%s: no complete epoch\n", path);
+            return 0;
+        }
+        return 1;
+    }
+    rtcm_gen_init(&g, seed, staid);
+    for (i = 0; i < epochs && i < STREAM_EPOCHS; i++)
+    {
+        if ((n = rtcm_gen_epoch(&g, msm, 5, s->data + s->len, STREAM_MAX - s->len)) == 0) break;
+        s->len += n;
+        s->burst[s->nburst++] = n;
+    }
+    return 1;
+}
+
+static sim_task_t *task_named(const char *arg, const char **value)
+{
+    const char *eq = strchr(arg, '=');
+    int i;
+
+    if (eq == NULL) return NULL;
+    *value = eq + 1;
+    for (i = 0; i < TASK_PROF_MAX; i++)
+    {
+        if (strlen(tasks[i].name) == (size_t)(eq - arg) && strncmp(tasks[i].name, arg, eq - arg) == 0)
+        {
+            return tasks + i;
+        }
+    }
+    return NULL;
+}
+
+/* a binary semaphore is created given, the first wait would run a job that
+   was never released */
+static osSemaphoreId semaphore(const osSemaphoreDef_t *def)
+{
+    osSemaphoreId sem = osSemaphoreCreate(def, 1);
+
+    osSemaphoreWait(sem, 0);
+    return sem;
+}
+
+static void start(void)
+{
+    osThreadDef_t def = {0};
+    int i;
+
+    sem_imu = semaphore(osSemaphore(sem_imu));
+    sem_ins = semaphore(osSemaphore(sem_ins));
+    sem_can = semaphore(osSemaphore(sem_can));
+    sem_rtcm = semaphore(osSemaphore(sem_rtcm));
+    sem_ntrip = semaphore(osSemaphore(sem_ntrip));
+    for (i = 0; i < TASK_PROF_MAX; i++)
+    {
+        def.name = (char *)tasks[i].name;
+        def.pthread = tasks[i].code;
+        def.tpriority = tasks[i].prio;
+        def.instances = 1;
+        def.stacksize = configMINIMAL_STACK_SIZE;
+        osThreadCreate(&def, tasks + i);
+    }
+    osKernelStart();
+}
+
+static double us(uint64_t cycles)
+{
+    return cycles * 1e6 / HOST_CORE_CLOCK;
+}
+
+static int report(double seconds)
+{
+    static char share[1024];
+    task_prof_t p;
+    uint32_t rx, drop;
+    int i, fail = 0;
+
+    printf("%.1f s simulated\n\n", seconds);
+    printf("%-7s %4s %6s %5s %10s %10s %9s %9s %9s %9s %9s\n", "task", "prio", "jobs", "late",
+           "period min", "max (ms)", "resp min", "mean", "max (us)", "per jit", "resp jit");
+    for (i = 0; i < TASK_PROF_MAX; i++)
+    {
+        if (!task_prof_get(tasks[i].id, &p))
+        {
+            printf("%-7s %4d %6u\n", tasks[i].name, tasks[i].prio, 0u);
+            fprintf(stderr, "%s: no job completed\n", tasks[i].name);
+            fail = 1;
+            continue;
+        }
+        if (p.period_max == 0) p.period_min = 0;
+        printf("%-7s %4d %6u %5u %10.3f %10.3f %9.1f %9.1f %9.1f %9.1f %9.1f\n", tasks[i].name,
+               tasks[i].prio, p.n, p.nmiss, us(p.period_min) / 1000, us(p.period_max) / 1000,
+               us(p.resp_min), us(p.resp_sum) / p.n, us(p.resp_max),
+               us(p.period_max - p.period_min), us(p.resp_max - p.resp_min));
+    }
+    if (task_prof_get(TASK_PROF_IMU, &p) && p.nmiss > 0)
+    {
+        fprintf(stderr, "imu: %u releases while pending\n", p.nmiss);
+        fail = 1;
+    }
+
+    printf("\ncpu share (permille)\n");
+    task_prof_cpu_share(share, sizeof(share));
+    for (i = 0; share[i] != '\0'; i++)
+    {
+        if (share[i] != '\r') putchar(share[i]);
+    }
+
+    car_can_rx_stat(&rx, &drop);
+    printf("\nuart  %u bytes in %u irqs, %u epochs, %u dropped; rover %u msgs, %u parity errors\n",
+           uart.nbyte, uart.irq.n, uart.nburst_done, uart.ndrop, rover_stat.nmsg, rover_stat.nerr);
+    printf("eth   %u bytes in %u irqs, %u epochs, %u dropped; base %u msgs, %u parity errors\n",
+           eth.nbyte, eth.irq.n, eth.nburst_done, eth.ndrop, base_stat.nmsg, base_stat.nerr);
+    printf("can   %u frames, %u received, %u dropped\n", can.nframe, rx, drop);
+    printf("net   %u bytes in %u segments out\n", net.nbyte, net.nseg);
+    printf("tick  %u systick, %u sensor timer\n", systick.irq.n, sensor_timer.irq.n);
+
+    if (uart.ndrop || eth.ndrop || rover_stat.nerr || base_stat.nerr || drop || rover_stat.nmsg == 0)
+    {
+        fprintf(stderr, "input lost or not decoded\n");
+        fail = 1;
+    }
+    return fail;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: task_sim [-t seconds] [-r rover.rtcm] [-b base.rtcm] "
+                    "[-p task=prio] [-c task=us[/ns]]\n");
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    const char *rover_path = NULL, *base_path = NULL, *value;
+    double seconds = 10;
+    sim_task_t *t;
+    int opt, n;
+
+    while ((opt = getopt(argc, argv, "t:r:b:p:c:")) != -1)
+    {
+        switch (opt)
+        {
+        case 't': seconds = atof(optarg); break;
+        case 'r': rover_path = optarg; break;
+        case 'b': base_path = optarg; break;
+        case 'p':
+            if ((t = task_named(optarg, &value)) == NULL) usage();
+            n = atoi(value);
+            if (n < osPriorityIdle || n > osPriorityRealtime) usage();
+            t->prio = (osPriority)n;
+            break;
+        case 'c':
+            if ((t = task_named(optarg, &value)) == NULL) usage();
+            t->job_us = (uint32_t)atoi(value);
+            if ((value = strchr(value, '/')) != NULL) t->item_ns = (uint32_t)atoi(value + 1);
+            break;
+        default: usage();
+        }
+    }
+    if (seconds <= 0 || optind != argc) usage();
+
+    if (!load(&rover_stream, rover_path, 1, 100, 7, (int)seconds + 1) ||
+        !load(&base_stream, base_path, 2, 200, 4, (int)seconds + 1))
+    {
+        return 1;
+    }
+    rtcm_rcv_init(&rover, gnss.rcv + ROVER, gnss.obs + ROVER, &gnss.nav);
+    rtcm_rcv_init(&base, gnss.rcv + BASE, gnss.obs + BASE, &gnss.nav);
+    rtcm_attach_stat(&rover, &rover_stat);
+    rtcm_attach_stat(&base, &base_stat);
+    fifo_init(&rover_fifo, rover_buf, sizeof(rover_buf));
+    fifo_init(&base_fifo, base_buf, sizeof(base_buf));
+
+    /* Toyota wheel speeds, can_mode 0 */
+    memset(&gOdoConfigurationStruct, 0, sizeof(gOdoConfigurationStruct));
+    for (n = 0; n < 2; n++)
+    {
+        odo_mesg_t *m = &gOdoConfigurationStruct.odo_mesg[n];
+
+        m->usage = 0x55;
+        m->mesgID = 0xAA;
+        m->startbit = (uint8_t)(8 + 16 * n);
+        m->length = 16;
+        m->endian = 1;
+        m->source = (uint8_t)n;
+        m->factor = 0.01;
+        m->offset = -6767;
+    }
+
+    sim_init(SIM_US(seconds * 1e6));
+    sim_timer_init(&systick, "systick", 1000, 0, osSystickHandler);
+    sim_timer_init(&sensor_timer, "sensor", 1000, 500, sensor_timer_isr);
+    sim_can_init(&can, 0xAA, 10000, 3300);
+    sim_link_init(&uart, "uart", rover_stream.data, rover_stream.burst, rover_stream.nburst,
+                  1000000, UART_BAUD / 10, 64, &rover_fifo, uart_rx);
+    sim_link_init(&eth, "eth", base_stream.data, base_stream.burst, base_stream.nburst,
+                  1000000, NET_BYTES_S, 1460, &base_fifo, eth_rx);
+    time_service_init();
+
+    start();        /* returns at the end of the simulated time */
+    return report(seconds);
+}
@@ -0,0 +1,79 @@
+/** ***************************************************************************
+ * @file   alloc_count.c
+ * @brief  heap calls of the code under test
+ ******************************************************************************/
+#include <malloc.h>
+#include <stdlib.h>
+#include <string.h>
+#include "alloc_count.h"
+
+alloc_count_t alloc_count;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *p, size_t size);
+void __real_free(void *p);
+
+void alloc_count_reset(void)
+{
+    memset(&alloc_count, 0, sizeof(alloc_count));
+}
+
+/* blocks from before the reset can take live below zero, the peak is
+   counted from the reset */
+static void held(void *p, int sign)
+{
+    if (p == NULL)
+    {
+        return;
+    }
+    alloc_count.live += sign * (int64_t)malloc_usable_size(p);
+    if (alloc_count.live > (int64_t)alloc_count.peak)
+    {
+        alloc_count.peak = (uint64_t)alloc_count.live;
+    }
+}
+
+void *__wrap_malloc(size_t size)
+{
+    void *p;
+
+    alloc_count.allocs++;
+    alloc_count.bytes += size;
+    p = __real_malloc(size);
+    held(p, 1);
+    return p;
+}
+
+void *__wrap_calloc(size_t n, size_t size)
+{
+    void *p;
+
+    alloc_count.allocs++;
+    alloc_count.bytes += n * size;
+    p = __real_calloc(n, size);
+    held(p, 1);
+    return p;
+}
+
+void *__wrap_realloc(void *p, size_t size)
+{
+    void *q;
+
+    alloc_count.allocs++;
+    alloc_count.bytes += size;
+    held(p, -1);
+    q = __real_realloc(p, size);
+    held(q != NULL ? q : (size ? p : NULL), 1);
+    return q;
+}
+
+void __wrap_free(void *p)
+{
+    if (p != NULL)
+    {
+        alloc_count.frees++;
+    }
+    held(p, -1);
+    __real_free(p);
+}
@@ -0,0 +1,23 @@
+/** ***************************************************************************
+ * @file   alloc_count.h
+ * @brief  heap calls of the code under test, counted by wrapping malloc and
+ *         friends at link time (-Wl,--wrap=malloc,...)
+ ******************************************************************************/
+#ifndef _ALLOC_COUNT_H_
+#define _ALLOC_COUNT_H_
+
+#include <stdint.h>
+
+typedef struct {
+    uint64_t allocs;            /* malloc, calloc and realloc calls */
+    uint64_t bytes;             /* bytes they asked for */
+    uint64_t frees;
+    int64_t live;               /* bytes held since the reset, malloc_usable_size */
+    uint64_t peak;              /* the most of them at any time */
+} alloc_count_t;
+
+extern alloc_count_t alloc_count;
+
+void alloc_count_reset(void);
+
+#endif /* _ALLOC_COUNT_H_ */
@@ -0,0 +1,28 @@
+/** ***************************************************************************
+ * @file   bench.h
+ * @brief  host benchmarks
+ *
+ * A benchmark runs its operation n times and returns the bytes it went
+ * through (0 if that means nothing for it). The runner grows n until a run
+ * takes long enough, then reports ns per operation, MB/s, the heap calls
+ * per operation and the most heap held at once in the last run. Set up on the first call, into statics, so
+ * the setup is not in the measured run.
+ ******************************************************************************/
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#include <stdint.h>
+
+typedef uint64_t (*bench_fn_t)(uint32_t n);
+
+typedef struct {
+    const char *name;
+    bench_fn_t run;
+} bench_t;
+
+#define BENCH_END   {NULL, NULL}
+
+/* keeps a result alive so the compiler can not drop the work */
+extern volatile uint64_t bench_sink;
+
+#endif /* _BENCH_H_ */
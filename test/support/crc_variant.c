@@ -0,0 +1,21 @@
+/** ***************************************************************************
+ * @file   crc_variant.c
+ * @brief  crc.c with the CRC_SLICE_BY given on the command line, every
+ *         function it defines renamed to <name>_<CRC_SLICE_BY>
+ ******************************************************************************/
+#define CRC_VARIANT_CAT2(a, b)      a##_##b
+#define CRC_VARIANT_CAT(a, b)       CRC_VARIANT_CAT2(a, b)
+#define CRC_VARIANT(name)           CRC_VARIANT_CAT(name, CRC_SLICE_BY)
+
+#define CrcCcittUpdate              CRC_VARIANT(CrcCcittUpdate)
+#define Crc32Update                 CRC_VARIANT(Crc32Update)
+#define Crc24qUpdate                CRC_VARIANT(Crc24qUpdate)
+#define CrcCcitt                    CRC_VARIANT(CrcCcitt)
+#define Crc32                       CRC_VARIANT(Crc32)
+#define CrcCcittTypeToBytes         CRC_VARIANT(CrcCcittTypeToBytes)
+#define BytesToCrcCcittType         CRC_VARIANT(BytesToCrcCcittType)
+#define Crc32TypeToBytes            CRC_VARIANT(Crc32TypeToBytes)
+#define BytesToCrc32Type            CRC_VARIANT(BytesToCrc32Type)
+#define initCRC_16bit               CRC_VARIANT(initCRC_16bit)
+
+#include "../../Platform/Core/src/crc.c"
@@ -0,0 +1,19 @@
+/** ***************************************************************************
+ * @file   crc_variant.h
+ * @brief  crc.c built again with CRC_SLICE_BY 1 and 8, next to the library
+ *         build (4), for the tests and the per variant benchmarks
+ ******************************************************************************/
+#ifndef _CRC_VARIANT_H_
+#define _CRC_VARIANT_H_
+
+#include <stdint.h>
+
+#define CRC_VARIANT_DECLARE(n) \
+    uint16_t CrcCcittUpdate_##n(uint16_t crc, const uint8_t data[], uint32_t length); \
+    uint32_t Crc32Update_##n(uint32_t crc, const uint8_t data[], uint32_t length); \
+    uint32_t Crc24qUpdate_##n(uint32_t crc, const uint8_t data[], uint32_t length);
+
+CRC_VARIANT_DECLARE(1)
+CRC_VARIANT_DECLARE(8)
+
+#endif /* _CRC_VARIANT_H_ */
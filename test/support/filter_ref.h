@@ -0,0 +1,24 @@
+/** ***************************************************************************
+ * @file   filter_ref.h
+ * @brief  the filters of lowpass_filter.c and filter.c as they were before
+ *         the filter banks, copied bodies with their own statics, kept as the
+ *         reference the shared code has to match bit for bit
+ ******************************************************************************/
+#ifndef _FILTER_REF_H_
+#define _FILTER_REF_H_
+
+#include <stdint.h>
+#include "filter.h"
+
+uint8_t ref_accelFilt_3rdOrderBWF_LowPass_Axis(uint8_t axis, int16_t in, int32_t *out, uint8_t freq, uint8_t dataRate);
+uint8_t ref_rateFilt_3rdOrderBWF_LowPass_Axis(uint8_t axis, int16_t in, int32_t *out, uint8_t freq, uint8_t dataRate);
+uint8_t ref_rateFilt_4thOrderBWF_LowPass_Axis_cascaded2nd(uint8_t chip, uint8_t axis, int16_t in, int32_t *out, uint8_t freq, uint8_t dataRate);
+uint8_t ref_accelFilt_4thOrderBWF_LowPass_Axis_cascaded2nd(uint8_t chip, uint8_t axis, int16_t in, int32_t *out, uint8_t freq, uint8_t dataRate);
+uint8_t ref_rateFilt_3rdOrderBWF_LowPass_Axis_cascaded1st(uint8_t chip, uint8_t axis, int16_t in, int32_t *out, uint8_t freq, uint8_t dataRate);
+uint8_t ref_accelFilt_3rdOrderBWF_LowPass_Axis_cascaded1st(uint8_t chip, uint8_t axis, int16_t in, int32_t *out, uint8_t freq, uint8_t dataRate);
+uint32_t ref_Bartlett_Q27_Filter(bartlett_fixed *coefficients, int32_t *x, int32_t *y);
+void ref_Apply_Butterworth_Q27_Reset(void);
+int32_t ref_Apply_Butterworth_Q27_Filter(int idx, butterworth_fixed *coefficients, uint8_t sensor, int32_t sample);
+int32_t ref_Apply_Bartlett_Q27_Filter(bartlett_fixed *coefficients, int32_t *x, int32_t sample);
+
+#endif /* _FILTER_REF_H_ */
@@ -0,0 +1,138 @@
+/** ***************************************************************************
+ * @file   nmea_ref.c
+ * @brief  print_nmea_gga() and print_rmc() of utils.c before the sentence
+ *         builder, unchanged
+ ******************************************************************************/
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "rtcm.h"
+#include "constants.h"
+#include "nav_math.h"
+#include "nmea_ref.h"
+
+#define KNOT2M     0.514444444  /* m/knot */
+
+extern void ecef2enu(const double *pos, const double *r, double *e);
+extern double norm(const double* a, int n);
+
+int nmea_ref_gga(double *ep, double *xyz, int nsat, int type, double dop,
+                 double age, char *buff)
+{
+    double h, pos[3], dms1[3], dms2[3];
+    char *q, sum;
+    char buf[20] = {0};
+
+    if ((xyz[0] * xyz[0] + xyz[1] * xyz[1] + xyz[2] * xyz[2]) < 1.0)
+    {
+        strcpy(buff, "$GPGGA,,,,,,,,,,,,,,");
+        for (q = (char *)buff + 1, sum = 0; *q; q++)
+            sum ^= *q;
+        strcat(buff, "*");
+        memset(buf, 0, 20);
+        i2a(sum, buf, 16);
+        strcat(buff, buf);
+        strcat(buff, "\r\n");
+    }
+    else
+    {
+        ecef2pos(xyz, pos);
+        h = 0.0;
+        deg2dms(fabs(pos[0]) * RAD_TO_DEG, dms1, 7);
+        deg2dms(fabs(pos[1]) * RAD_TO_DEG, dms2, 7);
+
+        strcpy(buff, "$GPGGA,");
+
+        float2arr(ep[3] * 10000 + ep[4] * 100 + ep[5] + 0.001, buf, 6, 2);
+        strcat(buff, buf);
+        strcat(buff, ",");
+
+        memset(buf, 0, 20);
+        float2arr(dms1[0] * 100 + dms1[1] + dms1[2] / 60.0, buf, 4, 7);
+        strcat(buff, buf);
+        strcat(buff, pos[0] >= 0 ? ",N," : ",S,");
+
+        memset(buf, 0, 20);
+        float2arr(dms2[0] * 100 + dms2[1] + dms2[2] / 60.0, buf, 5, 7);
+        strcat(buff, buf);
+        strcat(buff, pos[1] >= 0 ? ",E," : ",W,");
+
+        memset(buf, 0, 20);
+        i2a(type, buf, 10);
+        strcat(buff, buf);
+        strcat(buff, ",");
+
+        memset(buf, 0, 20);
+        float2arr(nsat, buf, 2, 0);
+        buf[2] = 0;
+        strcat(buff, buf);
+        strcat(buff, ",");
+
+        memset(buf, 0, 20);
+        float2arr(dop, buf, 0, 1);
+        strcat(buff, buf);
+        strcat(buff, ",");
+
+        memset(buf, 0, 20);
+        float2arr(pos[2] - h, buf, 0, 3);
+        strcat(buff, buf);
+        strcat(buff, ",M,");
+
+        memset(buf, 0, 20);
+        float2arr(h, buf, 0, 3);
+        strcat(buff, buf);
+        strcat(buff, ",M,");
+
+        memset(buf, 0, 20);
+        float2arr(age, buf, 0, 1);
+        strcat(buff, buf);
+        strcat(buff, ",");
+
+        for (q = (char *)buff + 1, sum = 0; *q; q++)
+            sum ^= *q; /* check-sum */
+
+        strcat(buff, "*");
+        memset(buf, 0, 20);
+        i2a(sum, buf, 16);
+        strcat(buff, buf);
+        strcat(buff, "\r\n");
+    }
+    return strlen(buff);
+}
+
+int nmea_ref_rmc(gtime_t time, double *ecef, int fixID, char *buff)
+{
+    static double dirp = 0.0;
+    gtime_t ut;
+    double ep[6],pos[3],enuv[3],dms1[3],dms2[3],vel,dir,amag=0.0;
+    char *p = buff,*q,sum,*emag = "E";
+
+    if (fixID<=0) {
+        p+=sprintf(p,"$GPRMC,,,,,,,,,,,,");
+        for (q=(char *)buff+1,sum=0;*q;q++) sum^=*q;
+        p+=sprintf(p,"*%02X%c%c",sum,0x0D,0x0A);
+        return p-(char *)buff;
+    }
+    ut=gpst2utc(time);
+    if (ut.sec>=0.995) {ut.time++; ut.sec=0.0;}
+    time2epoch(ut,ep);
+    ecef2pos(ecef,pos);
+    ecef2enu(pos,ecef+3,enuv);
+    vel=norm(enuv,3);
+    if (vel>=1.0) {
+        dir=atan2(enuv[0],enuv[1])*R2D;
+        if (dir<0.0) dir+=360.0;
+        dirp=dir;
+    }
+    else dir=dirp;
+    deg2dms(fabs(pos[0])*R2D,dms1,7);
+    deg2dms(fabs(pos[1])*R2D,dms2,7);
+    p+=sprintf(p,"$GPRMC,%02.0f%02.0f%05.2f,A,%02.0f%010.7f,%s,%03.0f%010.7f,%s,%4.2f,%4.2f,%02.0f%02.0f%02d,%.1f,%s,%s",
+               ep[3],ep[4],ep[5],dms1[0],dms1[1]+dms1[2]/60.0,pos[0]>=0?"N":"S",
+               dms2[0],dms2[1]+dms2[2]/60.0,pos[1]>=0?"E":"W",vel/KNOT2M,dir,
+               ep[2],ep[1],(int)ep[0]%100,amag,emag,
+               fixID == 4 || fixID == 5?"D":"A");
+    for (q=(char *)buff+1,sum=0;*q;q++) sum^=*q; /* check-sum */
+    p+=sprintf(p,"*%02X%c%c",sum,0x0D,0x0A);
+    return p-(char *)buff;
+}
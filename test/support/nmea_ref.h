@@ -0,0 +1,16 @@
+/** ***************************************************************************
+ * @file   nmea_ref.h
+ * @brief  the nmea sentences of utils.c as they were built before the
+ *         sentence builder, sprintf/strcat and a checksum pass, kept as the
+ *         reference the builder output has to match byte for byte
+ ******************************************************************************/
+#ifndef _NMEA_REF_H_
+#define _NMEA_REF_H_
+
+#include "utils.h"
+
+int nmea_ref_gga(double *ep, double *xyz, int nsat, int type, double dop,
+                 double age, char *buff);
+int nmea_ref_rmc(gtime_t time, double *ecef, int fixID, char *buff);
+
+#endif /* _NMEA_REF_H_ */
@@ -0,0 +1,364 @@
+/** ***************************************************************************
+ * @file   rtcm_gen.c
+ * @brief  synthetic rtcm3 streams for the host tests, benchmarks and replay
+ *
+ * Bit packing and parity are done here bit by bit, independent of the
+ * decoder under test.
+ ******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include "rtcm_gen.h"
+
+#define RTCM_GEN_SYS_GPS    0
+#define RTCM_GEN_SYS_GLO    1
+#define RTCM_GEN_SYS_GAL    2
+#define RTCM_GEN_SYS_BDS    3
+
+/* msm base type, highest prn and signal ids (rtcm3 signal mask bit 1..32) */
+static const struct {
+    int type0;
+    int maxprn;
+    int sig[4];
+} gen_sys[4] = {
+    {1070, 32, {2, 16, 23, 10}},    /* 1C 2L 5Q 2W */
+    {1080, 24, {2, 8, 9, 3}},       /* 1C 2C 2P 1P */
+    {1090, 36, {2, 15, 23, 5}},     /* 1C 7Q 5Q 1X */
+    {1120, 40, {2, 14, 8, 3}},      /* 1I 7I 6I 1X */
+};
+
+/* msm satellite and cell field bits of msm 4..7 */
+static const int msm_sat_bits[4] = {18, 36, 18, 36};
+static const int msm_cell_bits[4] = {48, 63, 65, 80};
+
+
+static void put_bits(unsigned char *buff, int pos, int len, uint32_t data)
+{
+    int i;
+
+    for (i = 0; i < len; i++, pos++)
+    {
+        if ((data >> (len - 1 - i)) & 1)
+        {
+            buff[pos / 8] |= (unsigned char)(0x80 >> (pos % 8));
+        }
+        else
+        {
+            buff[pos / 8] &= (unsigned char)~(0x80 >> (pos % 8));
+        }
+    }
+}
+
+static uint32_t crc24q(const unsigned char *buff, int len)
+{
+    uint32_t crc = 0;
+    int i, j;
+
+    for (i = 0; i < len; i++)
+    {
+        crc ^= (uint32_t)buff[i] << 16;
+        for (j = 0; j < 8; j++)
+        {
+            crc <<= 1;
+            if (crc & 0x1000000)
+            {
+                crc ^= 0x1864CFB;
+            }
+        }
+    }
+    return crc & 0xFFFFFF;
+}
+
+void rtcm_gen_init(rtcm_gen_t *g, uint32_t seed, int staid)
+{
+    g->state = seed ? seed : 1;
+    g->staid = staid;
+    g->tow_ms = 345600000;          /* wednesday 00:00 */
+    g->nsat = 10;
+    g->nsig = 2;
+}
+
+uint32_t rtcm_gen_rand(rtcm_gen_t *g)
+{
+    uint32_t x = g->state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    g->state = x;
+    return x;
+}
+
+/* random payload of nbit bits after the header byte triplet */
+static void fill_random(rtcm_gen_t *g, unsigned char *out, int nbit)
+{
+    int i;
+
+    for (i = 3; i < 3 + (nbit + 7) / 8; i++)
+    {
+        out[i] = (unsigned char)rtcm_gen_rand(g);
+    }
+}
+
+/* preamble, length and parity around a payload of nbit bits */
+static int close_frame(unsigned char *out, int nbit)
+{
+    int len = (nbit + 7) / 8;
+
+    put_bits(out, 3 * 8 + nbit, len * 8 - nbit, 0);
+    out[0] = 0xD3;
+    put_bits(out, 8, 6, 0);
+    put_bits(out, 14, 10, (uint32_t)len);
+    put_bits(out, (len + 3) * 8, 24, crc24q(out, len + 3));
+    return len + 6;
+}
+
+/* nsat distinct prns of 1..maxprn, ascending as in a satellite mask */
+static uint64_t pick_sats(rtcm_gen_t *g, int nsat, int maxprn)
+{
+    uint64_t mask = 0;
+    int n = 0, prn;
+
+    if (nsat > maxprn) nsat = maxprn;
+    while (n < nsat)
+    {
+        prn = 1 + (int)(rtcm_gen_rand(g) % (uint32_t)maxprn);
+        if (!(mask & ((uint64_t)1 << (64 - prn))))
+        {
+            mask |= (uint64_t)1 << (64 - prn);
+            n++;
+        }
+    }
+    return mask;
+}
+
+static uint32_t glo_tod(uint32_t tow_ms)
+{
+    return (tow_ms % 86400000 + 10800000 - 18000) % 86400000;
+}
+
+static int gen_1004_1012(rtcm_gen_t *g, int glo, int sync, unsigned char *out)
+{
+    uint64_t mask;
+    int i = 24, j, prn, nbit, nsat = g->nsat;
+
+    if (nsat > 31) nsat = 31;
+    nbit = (glo ? 61 : 64) + nsat * (glo ? 130 : 125);
+    fill_random(g, out, nbit);
+    mask = pick_sats(g, nsat, glo ? 24 : 32);
+
+    put_bits(out, i, 12, glo ? 1012 : 1004);    i += 12;
+    put_bits(out, i, 12, (uint32_t)g->staid);   i += 12;
+    if (glo)
+    {
+        put_bits(out, i, 27, glo_tod(g->tow_ms)); i += 27;
+    }
+    else
+    {
+        put_bits(out, i, 30, g->tow_ms);          i += 30;
+    }
+    put_bits(out, i, 1, (uint32_t)sync);        i += 1;
+    put_bits(out, i, 5, (uint32_t)nsat);        i += 5;
+    put_bits(out, i, 4, 0);                     i += 4;
+
+    for (prn = 1, j = 0; prn <= 64 && j < nsat; prn++)
+    {
+        if (!(mask & ((uint64_t)1 << (64 - prn)))) continue;
+        put_bits(out, i, 6, (uint32_t)prn);
+        if (glo)
+        {
+            put_bits(out, i + 7, 5, 7 + (prn % 7) - 3);     /* frequency channel + 7 */
+        }
+        i += glo ? 130 : 125;
+        j++;
+    }
+    return close_frame(out, nbit);
+}
+
+static int gen_msm(rtcm_gen_t *g, int type, int sync, unsigned char *out)
+{
+    int sys, msm = type % 10, k, j, i = 24, nbit, nsat, nsig = g->nsig;
+    uint64_t satmask;
+    uint32_t sigmask = 0;
+
+    for (sys = 0; sys < 4; sys++)
+    {
+        if (type - msm == gen_sys[sys].type0) break;
+    }
+    if (sys == 4 || msm < 4 || msm > 7) return 0;
+
+    if (nsig < 1) nsig = 1;
+    if (nsig > 4) nsig = 4;
+    nsat = g->nsat;
+    if (nsat * nsig > 64) nsat = 64 / nsig;
+    if (nsat > gen_sys[sys].maxprn) nsat = gen_sys[sys].maxprn;
+
+    nbit = 169 + nsat * nsig + nsat * msm_sat_bits[msm - 4] + nsat * nsig * msm_cell_bits[msm - 4];
+    fill_random(g, out, nbit);
+    satmask = pick_sats(g, nsat, gen_sys[sys].maxprn);
+    for (k = 0; k < nsig; k++)
+    {
+        sigmask |= 1u << (32 - gen_sys[sys].sig[k]);
+    }
+
+    put_bits(out, i, 12, (uint32_t)type);       i += 12;
+    put_bits(out, i, 12, (uint32_t)g->staid);   i += 12;
+    if (sys == RTCM_GEN_SYS_GLO)
+    {
+        put_bits(out, i, 3, (g->tow_ms / 86400000) % 7);
+        put_bits(out, i + 3, 27, glo_tod(g->tow_ms));
+    }
+    else if (sys == RTCM_GEN_SYS_BDS)
+    {
+        put_bits(out, i, 30, (g->tow_ms + 604800000 - 14000) % 604800000);
+    }
+    else
+    {
+        put_bits(out, i, 30, g->tow_ms);
+    }
+    i += 30;
+    put_bits(out, i, 1, (uint32_t)sync);        i += 1;
+    put_bits(out, i, 18, 0);                    i += 18;    /* iod .. smoothing interval */
+    put_bits(out, i, 32, (uint32_t)(satmask >> 32));    i += 32;
+    put_bits(out, i, 32, (uint32_t)satmask);    i += 32;
+    put_bits(out, i, 32, sigmask);              i += 32;
+    for (j = 0; j < nsat * nsig; j++)
+    {
+        put_bits(out, i++, 1, 1);
+    }
+    /* rough ranges of 60..90 ms, the fields behind stay random */
+    for (j = 0; j < nsat; j++)
+    {
+        put_bits(out, i + j * 8, 8, 60 + rtcm_gen_rand(g) % 30);
+    }
+    return close_frame(out, nbit);
+}
+
+static int gen_eph(rtcm_gen_t *g, int type, unsigned char *out)
+{
+    int nbit, maxprn;
+
+    switch (type)
+    {
+    case 1019: nbit = 488; maxprn = 32; break;
+    case 1020: nbit = 360; maxprn = 24; break;
+    case 1042: nbit = 512; maxprn = 40; break;
+    case 1045: nbit = 496; maxprn = 36; break;
+    case 1046: nbit = 504; maxprn = 36; break;
+    default: return 0;
+    }
+    fill_random(g, out, nbit);
+    put_bits(out, 24, 12, (uint32_t)type);
+    put_bits(out, 36, 6, 1 + rtcm_gen_rand(g) % (uint32_t)maxprn);
+    if (type == 1020)
+    {
+        put_bits(out, 42, 5, 7 + rtcm_gen_rand(g) % 7 - 3);
+    }
+    return close_frame(out, nbit);
+}
+
+static int gen_1005(rtcm_gen_t *g, unsigned char *out)
+{
+    fill_random(g, out, 152);
+    put_bits(out, 24, 12, 1005);
+    put_bits(out, 36, 12, (uint32_t)g->staid);
+    return close_frame(out, 152);
+}
+
+/* count and characters of a descriptor string */
+static int put_str(unsigned char *out, int pos, const char *str)
+{
+    int n = (int)strlen(str), i;
+
+    put_bits(out, pos, 8, (uint32_t)n);
+    for (i = 0; i < n; i++) put_bits(out, pos + 8 + 8 * i, 8, (unsigned char)str[i]);
+    return pos + 8 + 8 * n;
+}
+
+/* antenna and receiver descriptors, fixed strings with the staid in the serials */
+static int gen_1033(rtcm_gen_t *g, unsigned char *out)
+{
+    char sno[16];
+    int i = 36;
+
+    snprintf(sno, sizeof(sno), "ANT%04d", g->staid);
+    put_bits(out, 24, 12, 1033);
+    put_bits(out, i, 12, (uint32_t)g->staid);
+    i = put_str(out, i + 12, "TRM59800.00     NONE");
+    put_bits(out, i, 8, 1);
+    i = put_str(out, i + 8, sno);
+    i = put_str(out, i, "GEN RECEIVER");
+    i = put_str(out, i, "1.0");
+    snprintf(sno, sizeof(sno), "RCV%04d", g->staid);
+    i = put_str(out, i, sno);
+    return close_frame(out, i - 24);
+}
+
+static int gen_999(rtcm_gen_t *g, unsigned char *out)
+{
+    const int nbit = 44 + 595;
+
+    fill_random(g, out, nbit);
+    put_bits(out, 24, 12, 999);
+    put_bits(out, 36, 8, (rtcm_gen_rand(g) & 1) ? 4 : 21);
+    put_bits(out, 44, 12, (uint32_t)g->staid);
+    return close_frame(out, nbit);
+}
+
+int rtcm_gen_frame(rtcm_gen_t *g, int type, int sync, unsigned char *out)
+{
+    memset(out, 0, RTCM_GEN_FRAME_MAX);
+
+    switch (type)
+    {
+    case 1004: return gen_1004_1012(g, 0, sync, out);
+    case 1012: return gen_1004_1012(g, 1, sync, out);
+    case 1005: return gen_1005(g, out);
+    case 999:  return gen_999(g, out);
+    case 1033: return gen_1033(g, out);
+    case 1019:
+    case 1020:
+    case 1042:
+    case 1045:
+    case 1046: return gen_eph(g, type, out);
+    }
+    return gen_msm(g, type, sync, out);
+}
+
+int rtcm_gen_epoch(rtcm_gen_t *g, int msm, int eph_every, unsigned char *out, int size)
+{
+    static const int eph_types[] = {1019, 1020, 1042, 1045, 1046};
+    unsigned char frame[RTCM_GEN_FRAME_MAX];
+    int types[4], ntype, k, n = 0, len;
+
+    if (msm == 0)
+    {
+        types[0] = 1004;
+        types[1] = 1012;
+        ntype = 2;
+    }
+    else
+    {
+        for (k = 0; k < 4; k++)
+        {
+            types[k] = gen_sys[k].type0 + msm;
+        }
+        ntype = 4;
+    }
+
+    if (eph_every > 0 && (g->tow_ms / 1000) % (uint32_t)eph_every == 0)
+    {
+        len = rtcm_gen_frame(g, eph_types[(g->tow_ms / 1000 / eph_every) % 5], 0, frame);
+        if (n + len > size) return 0;
+        memcpy(out + n, frame, len);
+        n += len;
+    }
+    for (k = 0; k < ntype; k++)
+    {
+        len = rtcm_gen_frame(g, types[k], k < ntype - 1, frame);
+        if (n + len > size) return 0;
+        memcpy(out + n, frame, len);
+        n += len;
+    }
+    g->tow_ms = (g->tow_ms + 1000) % 604800000;
+    return n;
+}
@@ -0,0 +1,37 @@
+/** ***************************************************************************
+ * @file   rtcm_gen.h
+ * @brief  synthetic rtcm3 streams for the host tests, benchmarks and replay
+ *
+ * Frames carry valid headers, station id, time, satellite numbers and masks
+ * and random measurement and orbit fields, so every message decodes the way
+ * a live one does. The same seed gives the same stream.
+ ******************************************************************************/
+#ifndef _RTCM_GEN_H_
+#define _RTCM_GEN_H_
+
+#include <stdint.h>
+
+#define RTCM_GEN_FRAME_MAX  (1023 + 6)
+
+typedef struct {
+    uint32_t state;             /* xorshift32 */
+    int      staid;             /* reference station id */
+    uint32_t tow_ms;            /* time of the epoch being generated, gps tow */
+    int      nsat;              /* satellites per system in an observation message */
+    int      nsig;              /* msm signals per satellite, 1..4 */
+} rtcm_gen_t;
+
+void rtcm_gen_init(rtcm_gen_t *g, uint32_t seed, int staid);
+uint32_t rtcm_gen_rand(rtcm_gen_t *g);
+
+/* one frame of type (1004,1005,1012,1019,1020,1042,1045,1046,1033,999,msm4-7 of
+   gps/glo/gal/bds), sync: more observation messages of the epoch follow.
+   returns the frame length, 0 for a type it does not build */
+int rtcm_gen_frame(rtcm_gen_t *g, int type, int sync, unsigned char *out);
+
+/* one epoch: msm of gps, glo, gal and bds, msm 0 for 1004+1012 instead,
+   preceded by an ephemeris every eph_every epochs (0: none). moves the
+   time on a second, returns the bytes written or 0 if size is too small */
+int rtcm_gen_epoch(rtcm_gen_t *g, int msm, int eph_every, unsigned char *out, int size);
+
+#endif /* _RTCM_GEN_H_ */
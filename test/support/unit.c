@@ -0,0 +1,19 @@
+/** ***************************************************************************
+ * @file   unit.c
+ * @brief  checks of the host unit tests
+ ******************************************************************************/
+#include "unit.h"
+
+int unit_checks = 0;
+int unit_failures = 0;
+
+/** ***************************************************************************
+ * @name unit_end
+ * @brief print the totals
+ * @retval exit status of the test program
+ ******************************************************************************/
+int unit_end(void)
+{
+    printf("%d checks, %d failed\n", unit_checks, unit_failures);
+    return unit_failures ? 1 : 0;
+}
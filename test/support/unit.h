@@ -0,0 +1,55 @@
+/** ***************************************************************************
+ * @file   unit.h
+ * @brief  checks of the host unit tests
+ *
+ * Each test program runs its cases with UNIT_RUN() and returns unit_end()
+ * from main(), ctest counts a non zero exit as a failure. A failed check
+ * prints where and carries on with the next check.
+ ******************************************************************************/
+#ifndef _UNIT_H_
+#define _UNIT_H_
+
+#include <stdio.h>
+#include <string.h>
+
+extern int unit_checks;
+extern int unit_failures;
+
+#define UNIT_CHECK(cond) \
+    do { \
+        unit_checks++; \
+        if (!(cond)) { \
+            unit_failures++; \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        } \
+    } while (0)
+
+#define UNIT_CHECK_EQ(a, b) \
+    do { \
+        long long _a = (long long)(a), _b = (long long)(b); \
+        unit_checks++; \
+        if (_a != _b) { \
+            unit_failures++; \
+            printf("%s:%d: %s == %s failed: %lld != %lld\n", __FILE__, __LINE__, #a, #b, _a, _b); \
+        } \
+    } while (0)
+
+#define UNIT_CHECK_MEM(a, b, n) \
+    do { \
+        unit_checks++; \
+        if (memcmp((a), (b), (n)) != 0) { \
+            unit_failures++; \
+            printf("%s:%d: %s and %s differ\n", __FILE__, __LINE__, #a, #b); \
+        } \
+    } while (0)
+
+#define UNIT_RUN(test) \
+    do { \
+        int _f = unit_failures; \
+        test(); \
+        printf("%-40s %s\n", #test, unit_failures == _f ? "ok" : "FAILED"); \
+    } while (0)
+
+int unit_end(void);
+
+#endif /* _UNIT_H_ */
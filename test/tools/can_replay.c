@@ -0,0 +1,432 @@
+/** ***************************************************************************
+ * @file   can_replay.c
+ * @brief  replay a vehicle CAN log through the odometry queue on the host
+ *
+ *   can_replay [-b bitrate] [-l load] [-p period] [-t seconds] [file]
+ *
+ * Plays a candump log ("(1600000000.000000) can0 0AA#1B0F1B2D00000000", as
+ * candump -l writes it) or, without a file, -t seconds of a generated one:
+ * the default car's wheel speeds on 0xAA at 80 Hz and its gear on 0x3BC at
+ * 30 Hz, the rest of the bus taken by the frames of other ECUs. The log
+ * gives the frames and their order, the bus their times: each frame ends
+ * its length in bits (stuff bits and interframe space counted) after the
+ * one before at -b bit/s, stretched to a -l percent bus load.
+ *
+ * The cycle counter runs in bus time, so car_can_rx_isr() stamps each frame
+ * with its end of frame, and car_can_rx_process() drains the queue every -p
+ * ms as the CAN task does. Reports the frame rate and bus load, the host
+ * time of the isr for odometry frames and for the ones it drops by their ID,
+ * the decode time of a frame in the task, and the queue drops.
+ *
+ * For the generated log the decoded speeds and their time stamps are checked
+ * against the frames sent; it exits 1 on a mismatch or a dropped frame.
+ ******************************************************************************/
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "stm32f4xx_hal.h"
+#include "hal_host.h"
+#include "user_config.h"
+#include "car_data.h"
+#include "time_service.h"
+#include "rtcm.h"
+
+#define WEEK            2230
+#define HIST_NBIN       12              /* < 125 ns, then doubling, the last open */
+#define CAN_CRC15_POLY  0x4599
+#define SPEED_ID        0xAA
+#define SPEED_US        12500           /* 80 Hz */
+#define GEAR_ID         0x3BC
+#define GEAR_US         33333           /* 30 Hz */
+#define STAMP_TOL_US    2.0
+
+extern int32_t gps_start_week;
+
+typedef struct {
+    unsigned int n;
+    unsigned int bin[HIST_NBIN];
+    uint64_t sum_ns;
+    uint64_t max_ns;
+} hist_t;
+
+typedef struct {
+    uint32_t id;
+    uint8_t dlc;
+    uint8_t data[8];
+} can_frame_t;
+
+/* the frames of other ECUs on a Corolla bus, taken in turn */
+static const uint16_t other_id[] = {
+    0x024, 0x025, 0x0B4, 0x0B0, 0x0B2, 0x1C4, 0x224, 0x260, 0x262, 0x2C1,
+    0x2E4, 0x320, 0x343, 0x367, 0x380, 0x381, 0x389, 0x399, 0x3B0, 0x3B1,
+    0x3B7, 0x3D3, 0x411, 0x423, 0x440, 0x445, 0x4CB, 0x611, 0x620, 0x621,
+};
+
+typedef struct {
+    FILE *fp;                   /* the log, NULL generated */
+    uint64_t end_ns;            /* generated: bus time to stop at */
+    uint64_t speed_due_ns;
+    uint64_t gear_due_ns;
+    unsigned int other;
+} source_t;
+
+static hist_t hist_odo, hist_other, hist_task;
+static uint64_t host_cycles;    /* the cycle counter, 64 bits */
+
+static uint64_t now_ns(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ULL + (uint64_t)t.tv_nsec;
+}
+
+static void hist_add(hist_t *h, uint64_t ns)
+{
+    int i;
+    uint64_t edge = 125;
+
+    for (i = 0; i < HIST_NBIN - 1 && ns >= edge; i++) edge <<= 1;
+    h->bin[i]++;
+    h->n++;
+    h->sum_ns += ns;
+    if (ns > h->max_ns) h->max_ns = ns;
+}
+
+/* upper edge of the bin holding the q quantile, at most the maximum */
+static uint64_t hist_quantile(const hist_t *h, double q)
+{
+    unsigned int i, n = 0, k = (unsigned int)(q * h->n);
+
+    for (i = 0; i < HIST_NBIN - 1; i++)
+    {
+        n += h->bin[i];
+        if (n > k) return (125ULL << i) < h->max_ns ? 125ULL << i : h->max_ns;
+    }
+    return h->max_ns;
+}
+
+/* the cycle counter to bus time ns */
+static void cycles_to(uint64_t ns)
+{
+    uint64_t target = ns * (HOST_CORE_CLOCK / 1000000) / 1000;
+
+    host_cycles_advance((uint32_t)(target - host_cycles));
+    host_cycles = target;
+}
+
+/* bits on the wire of a standard data frame: the stuffed part from SOF to
+   the CRC, then CRC delimiter, ACK, EOF and the interframe space */
+static unsigned int frame_bits(const can_frame_t *f)
+{
+    uint8_t bit[19 + 64 + 15];
+    unsigned int n = 0, i, k, run = 1, stuff = 0;
+    uint16_t crc = 0;
+    uint8_t last;
+
+    bit[n++] = 0;
+    for (k = 11; k-- > 0;) bit[n++] = (f->id >> k) & 1;
+    bit[n++] = 0;               /* RTR */
+    bit[n++] = 0;               /* IDE */
+    bit[n++] = 0;               /* r0 */
+    for (k = 4; k-- > 0;) bit[n++] = (f->dlc >> k) & 1;
+    for (i = 0; i < f->dlc; i++)
+        for (k = 8; k-- > 0;) bit[n++] = (f->data[i] >> k) & 1;
+    for (i = 0; i < n; i++)
+    {
+        uint16_t top = ((crc >> 14) & 1) ^ bit[i];
+
+        crc = (uint16_t)((crc << 1) & 0x7FFF);
+        if (top) crc ^= CAN_CRC15_POLY;
+    }
+    for (k = 15; k-- > 0;) bit[n++] = (crc >> k) & 1;
+    for (i = 1, last = bit[0]; i < n; i++)
+    {
+        if (bit[i] == last)
+        {
+            run++;
+        }
+        else
+        {
+            last = bit[i];
+            run = 1;
+        }
+        if (run == 5)
+        {
+            /* the stuff bit starts the next run */
+            stuff++;
+            last = !last;
+            run = 1;
+        }
+    }
+    return n + stuff + 1 + 2 + 7 + 3;
+}
+
+/* next frame of a candump log, 0 at its end */
+static int log_frame(FILE *fp, can_frame_t *f)
+{
+    char line[256], *p, *e;
+    unsigned int i;
+
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        if ((p = strchr(line, '#')) == NULL || p - line < 4) continue;
+        for (e = p; e > line && e[-1] != ' '; e--);
+        f->id = (uint32_t)strtoul(e, NULL, 16);
+        if (p - e > 3 || f->id > 0x7FF) continue;   /* extended ids, not odometry */
+        for (p++, i = 0; i < 8 && isxdigit((unsigned char)p[0]) && isxdigit((unsigned char)p[1]); i++, p += 2)
+        {
+            char hex[3] = {p[0], p[1], 0};
+
+            f->data[i] = (uint8_t)strtoul(hex, NULL, 16);
+        }
+        f->dlc = (uint8_t)i;
+        for (; i < 8; i++) f->data[i] = 0;
+        return 1;
+    }
+    return 0;
+}
+
+/* wheel speed of the generated log, km/h */
+static double speed_kmh(uint64_t ns)
+{
+    return 60.0 + 40.0 * sin(2.0 * M_PI * (double)ns * 1e-9 / 20.0);
+}
+
+static void speed_frame(can_frame_t *f, uint64_t ns)
+{
+    uint16_t rr = (uint16_t)lround(speed_kmh(ns) / 0.01 + 6767);
+    uint16_t rl = (uint16_t)(rr + 3);
+
+    f->id = SPEED_ID;
+    f->dlc = 8;
+    memset(f->data, 0, 8);
+    f->data[0] = (uint8_t)(rr >> 8);
+    f->data[1] = (uint8_t)rr;
+    f->data[2] = (uint8_t)(rl >> 8);
+    f->data[3] = (uint8_t)rl;
+}
+
+/* next frame to go on the bus at ns, the periodic ones when due */
+static int next_frame(source_t *src, uint64_t ns, can_frame_t *f)
+{
+    int i;
+
+    if (src->fp) return log_frame(src->fp, f);
+    if (ns >= src->end_ns) return 0;
+    if (ns >= src->speed_due_ns)
+    {
+        speed_frame(f, ns);
+        src->speed_due_ns += SPEED_US * 1000ULL;
+        return 1;
+    }
+    f->dlc = 8;
+    if (ns >= src->gear_due_ns)
+    {
+        f->id = GEAR_ID;
+        memset(f->data, 0, 8);
+        f->data[0] = 4;
+        src->gear_due_ns += GEAR_US * 1000ULL;
+        return 1;
+    }
+    f->id = other_id[src->other % (sizeof(other_id) / sizeof(other_id[0]))];
+    for (i = 0; i < 8; i++) f->data[i] = (uint8_t)(src->other * 31 + i * 7);
+    src->other++;
+    return 1;
+}
+
+/* the Toyota default of the odometry configuration */
+static void car_setup(void)
+{
+    odo_mesg_t *m = gOdoConfigurationStruct.odo_mesg;
+    gtime_t t = gpst2time(WEEK, 100.0);
+    int i;
+
+    time_service_init();
+    time_service_pps(time_count(), (int64_t)t.time * 1000000);
+    gps_start_week = WEEK;
+    memset(&gOdoConfigurationStruct, 0, sizeof(gOdoConfigurationStruct));
+    for (i = 0; i < 3; i++)
+    {
+        m[i].usage = 0x55;
+        m[i].mesgID = i < 2 ? SPEED_ID : GEAR_ID;
+        m[i].startbit = (uint8_t)(i < 2 ? 8 + 16 * i : 0);
+        m[i].length = (uint8_t)(i < 2 ? 16 : 3);
+        m[i].endian = (uint8_t)(i < 2);
+        m[i].source = (uint8_t)(i < 2 ? i : 3);
+        m[i].factor = i < 2 ? 0.01 : 1;
+        m[i].offset = i < 2 ? -6767 : 0;
+    }
+    gOdoConfigurationStruct.gears[0] = 4;     /* drive */
+    car_can_initialize();
+}
+
+typedef struct {
+    unsigned int frames;
+    uint64_t bits;
+    uint64_t bus_ns;
+    unsigned int decoded;
+    unsigned int speeds;
+    unsigned int speed_bad;
+    double stamp_max_us;
+    uint32_t rx;
+    uint32_t drop;
+} result_t;
+
+/* the task of a period: drain the queue, check the speed it gives */
+static void task(result_t *r, int check, double sent_kmh, uint64_t sent_ns)
+{
+    double v, ts, err;
+    uint8_t fwd;
+    uint32_t week, n;
+    uint64_t t1;
+
+    t1 = now_ns();
+    n = car_can_rx_process();
+    t1 = now_ns() - t1;
+    if (n == 0) return;
+    hist_add(&hist_task, t1 / n);
+    r->decoded += n;
+    if (!car_get_wheel_speed(&v, &fwd, &week, &ts)) return;
+    r->speeds++;
+    if (!check) return;
+    /* the mean of the two wheels, 0.015 km/h above the right one */
+    if (fabs(v - (sent_kmh + 0.015) / 3.6) > 0.006 / 3.6 || week != WEEK || !fwd) r->speed_bad++;
+    err = fabs(ts - (100.0 + (double)sent_ns * 1e-9)) * 1e6;
+    if (err > r->stamp_max_us) r->stamp_max_us = err;
+}
+
+static void replay(source_t *src, unsigned int bitrate, unsigned int load, unsigned int period_ms,
+                   result_t *r)
+{
+    can_frame_t f;
+    uint64_t ns = 0, end, tick_ns = 1000000, task_ns = period_ms * 1000000ULL, t1;
+    uint64_t sent_ns = 0;
+    double sent_kmh = 0;
+    unsigned int bits;
+
+    while (next_frame(src, ns, &f))
+    {
+        bits = frame_bits(&f);
+        end = ns + (uint64_t)bits * 1000000000ULL * 100 / ((uint64_t)bitrate * load);
+        /* the 1 ms timer and the task periods that come first */
+        while (tick_ns <= end)
+        {
+            cycles_to(tick_ns);
+            time_service_tick();
+            if (tick_ns >= task_ns)
+            {
+                task(r, src->fp == NULL, sent_kmh, sent_ns);
+                task_ns += period_ms * 1000000ULL;
+            }
+            tick_ns += 1000000;
+        }
+        cycles_to(end);
+        t1 = now_ns();
+        car_can_rx_isr(f.id, f.data);
+        t1 = now_ns() - t1;
+        if (f.id == SPEED_ID || f.id == GEAR_ID) hist_add(&hist_odo, t1);
+        else hist_add(&hist_other, t1);
+        if (f.id == SPEED_ID)
+        {
+            sent_kmh = ((f.data[0] << 8 | f.data[1]) - 6767) * 0.01;
+            sent_ns = end;
+        }
+        r->frames++;
+        r->bits += bits;
+        ns = end;
+    }
+    cycles_to(ns);
+    task(r, src->fp == NULL, sent_kmh, sent_ns);
+    r->bus_ns = ns;
+    car_can_rx_stat(&r->rx, &r->drop);
+}
+
+static void hist_print(const char *name, const hist_t *h)
+{
+    int k;
+
+    printf("%-7s %8u", name, h->n);
+    if (h->n == 0)
+    {
+        printf("\n");
+        return;
+    }
+    printf(" %7llu %7llu %7llu %7llu", (unsigned long long)(h->sum_ns / h->n),
+           (unsigned long long)hist_quantile(h, 0.5), (unsigned long long)hist_quantile(h, 0.99),
+           (unsigned long long)h->max_ns);
+    for (k = 0; k < HIST_NBIN; k++) printf(" %6u", h->bin[k]);
+    printf("\n");
+}
+
+static void report(const result_t *r, unsigned int bitrate, int check)
+{
+    double s = r->bus_ns * 1e-9;
+    uint64_t isr_ns = hist_odo.sum_ns + hist_other.sum_ns;
+    int k;
+
+    printf("%u frames in %.3f s of bus time: %.0f frames/s, %.1f%% of %u bit/s, %.1f bits a frame\n",
+           r->frames, s, r->frames / s, r->bits * 1e2 / ((double)bitrate * s), bitrate,
+           r->frames ? (double)r->bits / r->frames : 0.0);
+    printf("isr %.3f ms, %.4f%% of the bus time; task %.3f ms for %u frames, %u speeds\n",
+           isr_ns * 1e-6, isr_ns * 1e2 / r->bus_ns, hist_task.sum_ns * 1e-6, r->decoded, r->speeds);
+    printf("queue %u frames received, %u dropped (%d deep)\n", r->rx, r->drop, CAR_CAN_RX_QUEUE_SIZE);
+    if (check)
+        printf("speeds %u off, time stamps at most %.3f us off the end of frame\n",
+               r->speed_bad, r->stamp_max_us);
+    printf("\nhost time in ns, frames by bin upper edge; task is per frame decoded\n");
+    printf("%-7s %8s %7s %7s %7s %7s", "", "frames", "mean", "p50", "p99", "max");
+    for (k = 0; k < HIST_NBIN - 1; k++) printf(" %6llu", 125ULL << k);
+    printf(" %6s\n", "more");
+    hist_print("isr odo", &hist_odo);
+    hist_print("isr oth", &hist_other);
+    hist_print("task", &hist_task);
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: can_replay [-b bitrate] [-l load] [-p period] [-t seconds] [file]\n");
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    unsigned int bitrate = 1000000, load = 100, period_ms = 10, seconds = 60;
+    source_t src;
+    result_t r;
+    int opt, check;
+
+    while ((opt = getopt(argc, argv, "b:l:p:t:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'b': bitrate = (unsigned int)atoi(optarg); break;
+        case 'l': load = (unsigned int)atoi(optarg); break;
+        case 'p': period_ms = (unsigned int)atoi(optarg); break;
+        case 't': seconds = (unsigned int)atoi(optarg); break;
+        default: usage();
+        }
+    }
+    if (bitrate == 0 || load == 0 || load > 100 || period_ms == 0 || optind + 1 < argc) usage();
+
+    memset(&src, 0, sizeof(src));
+    memset(&r, 0, sizeof(r));
+    if (optind < argc && (src.fp = fopen(argv[optind], "r")) == NULL)
+    {
+        perror(argv[optind]);
+        return 1;
+    }
+    src.end_ns = seconds * 1000000000ULL;
+    check = src.fp == NULL;
+
+    car_setup();
+    replay(&src, bitrate, load, period_ms, &r);
+    report(&r, bitrate, check);
+    if (src.fp) fclose(src.fp);
+    if (r.drop || (check && (r.speed_bad || r.stamp_max_us > STAMP_TOL_US))) return 1;
+    return 0;
+}
@@ -0,0 +1,320 @@
+/** ***************************************************************************
+ * @file   rtcm_replay.c
+ * @brief  replay an rtcm3 stream through the decoder on the host
+ *
+ *   rtcm_replay [-s rover|base] [-n stations] [-w] [-c chunk] [-e epochs] [-m msm] [file]
+ *
+ * Feeds a recorded stream (or, without a file, a generated one of -e epochs
+ * of msm -m, 0 for 1004+1012) in -c byte spans to a receiver over station -s
+ * of a gnss_rtcm_t, as fast as it goes or with -w at the pace of the epoch
+ * times. Reports the message and byte rate, the decode time of each message
+ * type as a histogram, parity errors and the peak obs and nav occupancy.
+ *
+ * With -n the spans go round the streams of a decoder pool of that many
+ * stations instead, each its own generated stream (or the file again), and
+ * the report adds the memory a station takes and its decode time.
+ *
+ * A span that completes one message times that message; spans completing
+ * more than one count for the rates only, so keep -c below the shortest
+ * frame for a histogram of every message.
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "gnss_data_api.h"
+#include "rtcm_gen.h"
+
+#define REPLAY_MAX      (64 * 1024 * 1024)
+#define POOL_MAX        256             /* -n stations */
+#define HIST_NBIN       12              /* < 125 ns, then doubling, the last open */
+
+static const char *const type_name[RTCM_STAT_NTYPE] = {
+    "1004", "1012", "1019", "1020", "1042", "1045", "1046", "999",
+    "msm4", "msm5", "msm6", "msm7", "other",
+};
+
+typedef struct {
+    unsigned int n;
+    unsigned int bin[HIST_NBIN];
+    uint64_t sum_ns;
+    uint64_t max_ns;
+} hist_t;
+
+static gnss_rtcm_t gnss;
+static rtcm_stat_t stat;
+static hist_t hist[RTCM_STAT_NTYPE];
+
+static rtcmpool_t pool;
+static rtcm_t work;
+static rtcmhot_t hot[POOL_MAX];
+static obs_t obs[POOL_MAX];
+static rtcmcold_t cold[POOL_MAX];
+static rtcm_stat_t pool_stat[POOL_MAX];
+static uint64_t pool_ns[POOL_MAX];
+
+static uint64_t now_ns(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ULL + (uint64_t)t.tv_nsec;
+}
+
+static void hist_add(hist_t *h, uint64_t ns)
+{
+    int i;
+    uint64_t edge = 125;
+
+    for (i = 0; i < HIST_NBIN - 1 && ns >= edge; i++) edge <<= 1;
+    h->bin[i]++;
+    h->n++;
+    h->sum_ns += ns;
+    if (ns > h->max_ns) h->max_ns = ns;
+}
+
+/* upper edge of the bin holding the q quantile, at most the maximum */
+static uint64_t hist_quantile(const hist_t *h, double q)
+{
+    unsigned int i, n = 0, k = (unsigned int)(q * h->n);
+
+    for (i = 0; i < HIST_NBIN - 1; i++)
+    {
+        n += h->bin[i];
+        if (n > k) return (125ULL << i) < h->max_ns ? 125ULL << i : h->max_ns;
+    }
+    return h->max_ns;
+}
+
+static unsigned char *load(const char *path, int msm, int epochs, int k, unsigned int max,
+                           unsigned int *len)
+{
+    unsigned char *buf = malloc(max);
+    rtcm_gen_t g;
+    FILE *fp;
+    int i, n;
+
+    if (buf == NULL) return NULL;
+    *len = 0;
+    if (path)
+    {
+        if ((fp = fopen(path, "rb")) == NULL)
+        {
+            perror(path);
+            free(buf);
+            return NULL;
+        }
+        *len = (unsigned int)fread(buf, 1, max, fp);
+        fclose(fp);
+        return buf;
+    }
+    rtcm_gen_init(&g, 1 + k, 100 + k);
+    for (i = 0; i < epochs; i++)
+    {
+        if ((n = rtcm_gen_epoch(&g, msm, 5, buf + *len, max - *len)) == 0) break;
+        *len += n;
+    }
+    return buf;
+}
+
+/* -w: hold an epoch back until its time comes, counted from the first one */
+static void pace(const obs_t *obs, uint64_t t0_ns, gtime_t *t0)
+{
+    double dt;
+    uint64_t due, now;
+
+    if (t0->time == 0)
+    {
+        *t0 = obs->time;
+        return;
+    }
+    dt = timediff(obs->time, *t0);
+    if (dt <= 0.0) return;
+    due = t0_ns + (uint64_t)(dt * 1e9);
+    if ((now = now_ns()) < due) usleep((useconds_t)((due - now) / 1000));
+}
+
+static void report(unsigned int len, uint64_t ns)
+{
+    const hist_t *h;
+    int i, k;
+
+    printf("%u bytes, %u messages in %.3f s: %.0f msgs/s %.2f MB/s, %u parity errors\n",
+           stat.nbyte, stat.nmsg, ns * 1e-9, stat.nmsg * 1e9 / ns, stat.nbyte * 1e3 / ns,
+           stat.nerr);
+    if (stat.nbyte != len) printf("%u bytes left in the framer\n", len - stat.nbyte);
+    printf("peak obs %u/%d, eph %u/%d, geph %u/%d\n\n",
+           stat.maxobs, MAXOBS, stat.maxeph, MAXEPH, stat.maxgeph, MAXEPH_R);
+
+    printf("decode time in ns, messages timed by bin upper edge\n");
+    printf("%-6s %8s %7s %7s %7s %7s", "type", "msgs", "mean", "p50", "p99", "max");
+    for (k = 0; k < HIST_NBIN - 1; k++) printf(" %6llu", 125ULL << k);
+    printf(" %6s\n", "more");
+    for (i = 0; i < RTCM_STAT_NTYPE; i++)
+    {
+        h = hist + i;
+        if (stat.ntype[i] == 0) continue;
+        printf("%-6s %8u", type_name[i], stat.ntype[i]);
+        if (h->n == 0)
+        {
+            printf("   (no message timed alone)\n");
+            continue;
+        }
+        printf(" %7llu %7llu %7llu %7llu", (unsigned long long)(h->sum_ns / h->n),
+               (unsigned long long)hist_quantile(h, 0.5), (unsigned long long)hist_quantile(h, 0.99),
+               (unsigned long long)h->max_ns);
+        for (k = 0; k < HIST_NBIN; k++) printf(" %6u", h->bin[k]);
+        printf("\n");
+    }
+}
+
+/* per station memory and decode time of a pool, its totals into stat */
+static void pool_report(unsigned int n)
+{
+    const rtcm_stat_t *ps;
+    unsigned int k, i;
+
+    for (k = 0; k < n; k++)
+    {
+        ps = pool_stat + k;
+        stat.nbyte += ps->nbyte;
+        stat.nmsg += ps->nmsg;
+        stat.nerr += ps->nerr;
+        for (i = 0; i < RTCM_STAT_NTYPE; i++) stat.ntype[i] += ps->ntype[i];
+        if (ps->maxobs > stat.maxobs) stat.maxobs = ps->maxobs;
+        if (ps->maxeph > stat.maxeph) stat.maxeph = ps->maxeph;
+        if (ps->maxgeph > stat.maxgeph) stat.maxgeph = ps->maxgeph;
+    }
+    printf("pool of %u stations, bytes per station: hot %zu + obs %zu = %zu, cold %zu when taken (%u taken)\n",
+           n, sizeof(rtcmhot_t), sizeof(obs_t), sizeof(rtcmhot_t) + sizeof(obs_t), sizeof(rtcmcold_t),
+           pool.cold.nused);
+    printf("shared: work rtcm_t %zu, nav_t %zu; a receiver of its own takes rtcm_t %zu + obs_t %zu = %zu\n",
+           sizeof(rtcm_t), sizeof(nav_t), sizeof(rtcm_t), sizeof(obs_t), sizeof(rtcm_t) + sizeof(obs_t));
+    printf("%-7s %5s %8s %10s %10s\n", "station", "staid", "msgs", "ns/msg", "ns/byte");
+    for (k = 0; k < n; k++)
+    {
+        ps = pool_stat + k;
+        printf("%-7u %5u %8u %10.0f %10.2f\n", k, obs[k].staid, ps->nmsg,
+               ps->nmsg ? (double)pool_ns[k] / ps->nmsg : 0.0,
+               ps->nbyte ? (double)pool_ns[k] / ps->nbyte : 0.0);
+    }
+    printf("\n");
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: rtcm_replay [-s rover|base] [-n stations] [-w] [-c chunk] [-e epochs] [-m msm] [file]\n");
+    exit(2);
+}
+
+/* the spans of the streams in turn, each message timed like replay() */
+static uint64_t replay_pool(unsigned char **buf, const unsigned int *len, unsigned int n,
+                            unsigned int chunk, int wall)
+{
+    unsigned int pos[POOL_MAX] = {0}, k, m, nused, nmsg, more;
+    int st;
+    uint64_t t0 = now_ns(), t1, ns = 0;
+    gtime_t first = {0};
+
+    do
+    {
+        more = 0;
+        for (k = 0; k < n; k++)
+        {
+            if (pos[k] >= len[k]) continue;
+            m = len[k] - pos[k] < chunk ? len[k] - pos[k] : chunk;
+            nmsg = pool_stat[k].nmsg;
+            t1 = now_ns();
+            input_rtcm3_pool(buf[k] + pos[k], m, k, &pool, &nused, &st);
+            t1 = now_ns() - t1;
+            ns += t1;
+            pool_ns[k] += t1;
+            if (pool_stat[k].nmsg == nmsg + 1) hist_add(hist + rtcm_stat_index(work.type), t1);
+            if (wall && st == 1) pace(obs + k, t0, &first);
+            pos[k] += nused;
+            more = 1;
+        }
+    } while (more);
+    return wall ? now_ns() - t0 : ns;
+}
+
+static uint64_t replay(unsigned char *buf, unsigned int len, unsigned int stn, unsigned int chunk,
+                       int wall)
+{
+    unsigned int pos, nused, n, nmsg;
+    int st;
+    uint64_t t0, t1, ns = 0;
+    gtime_t first = {0};
+    rtcmrcv_t rcv;
+
+    rtcm_rcv_init(&rcv, gnss.rcv + stn, gnss.obs + stn, &gnss.nav);
+    rtcm_attach_stat(&rcv, &stat);
+
+    t0 = now_ns();
+    for (pos = 0; pos < len; pos += nused)
+    {
+        n = len - pos < chunk ? len - pos : chunk;
+        nmsg = stat.nmsg;
+        t1 = now_ns();
+        input_rtcm3_rcv(buf + pos, n, &rcv, &nused, &st);
+        t1 = now_ns() - t1;
+        ns += t1;
+        if (stat.nmsg == nmsg + 1) hist_add(hist + rtcm_stat_index(rcv.rtcm->type), t1);
+        if (wall && st == 1) pace(rcv.obs, t0, &first);
+    }
+    return wall ? now_ns() - t0 : ns;
+}
+
+int main(int argc, char **argv)
+{
+    static unsigned char *buf[POOL_MAX];
+    static unsigned int len[POOL_MAX];
+    const char *path;
+    unsigned int stn = ROVER, chunk = 64, nstation = 0, k, total = 0;
+    int opt, wall = 0, epochs = 1000, msm = 7;
+    uint64_t ns;
+
+    while ((opt = getopt(argc, argv, "s:n:wc:e:m:")) != -1)
+    {
+        switch (opt)
+        {
+        case 's':
+            if (strcmp(optarg, "rover") == 0) stn = ROVER;
+            else if (strcmp(optarg, "base") == 0) stn = BASE;
+            else usage();
+            break;
+        case 'n': nstation = (unsigned int)atoi(optarg); break;
+        case 'w': wall = 1; break;
+        case 'c': chunk = (unsigned int)atoi(optarg); break;
+        case 'e': epochs = atoi(optarg); break;
+        case 'm': msm = atoi(optarg); break;
+        default: usage();
+        }
+    }
+    if (chunk == 0 || nstation > POOL_MAX || optind + 1 < argc) usage();
+    path = optind < argc ? argv[optind] : NULL;
+
+    if (nstation == 0)
+    {
+        if ((buf[0] = load(path, msm, epochs, 0, REPLAY_MAX, len)) == NULL) return 1;
+        ns = replay(buf[0], len[0], stn, chunk, wall);
+        report(len[0], ns);
+        free(buf[0]);
+        return 0;
+    }
+
+    for (k = 0; k < nstation; k++)
+    {
+        if ((buf[k] = load(path, msm, epochs, k, REPLAY_MAX / nstation, len + k)) == NULL) return 1;
+        total += len[k];
+    }
+    rtcm_pool_init(&pool, &work, hot, obs, nstation, &gnss.nav);
+    rtcm_pool_attach_cold(&pool, cold, nstation);
+    rtcm_pool_attach_stat(&pool, pool_stat);
+    ns = replay_pool(buf, len, nstation, chunk, wall);
+    pool_report(nstation);
+    report(total, ns);
+    for (k = 0; k < nstation; k++) free(buf[k]);
+    return 0;
+}
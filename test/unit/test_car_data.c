@@ -0,0 +1,237 @@
+/** ***************************************************************************
+ * @file   test_car_data.c
+ * @brief  odometry CAN signal plans against a bit at a time extraction
+ ******************************************************************************/
+#include <math.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include "unit.h"
+#include "user_config.h"
+#include "car_data.h"
+#include "can.h"
+#include "time_service.h"
+#include "rtcm.h"
+
+#define WEEK    2230
+
+extern int32_t gps_start_week;
+
+/* intel runs up through the frame, motorola goes on in the byte before */
+static double ref_value(const odo_mesg_t *m, const uint8_t *data)
+{
+    uint64_t value = 0;
+    int i, pos = m->startbit;
+    double v, scale = m->factor;
+
+    for (i = 0; i < m->length; i++)
+    {
+        value |= (uint64_t)((data[pos / 8] >> (pos % 8)) & 1) << i;
+        if (m->endian == 1 && pos % 8 == 7) pos -= 15;
+        else pos++;
+    }
+    v = (double)value;
+    if (m->sign && (value >> (m->length - 1)) & 1)
+    {
+        v = -(double)(value - ((uint64_t)1 << (m->length - 1)));
+    }
+    if (m->unit == 0) scale /= 3.6;
+    else if (m->unit == 1) scale *= 0.44704;
+    return (v + m->offset) * scale;
+}
+
+static void odo_set(int i, uint32_t id, int startbit, int length, int endian, int sign,
+                    int unit, int source, double factor, double offset)
+{
+    odo_mesg_t *m = &gOdoConfigurationStruct.odo_mesg[i];
+
+    m->usage = 0x55;
+    m->mesgID = id;
+    m->startbit = (uint8_t)startbit;
+    m->length = (uint8_t)length;
+    m->endian = (uint8_t)endian;
+    m->sign = (uint8_t)sign;
+    m->unit = (uint8_t)unit;
+    m->source = (uint8_t)source;
+    m->factor = factor;
+    m->offset = offset;
+}
+
+static void clock_start(void)
+{
+    gtime_t t = gpst2time(WEEK, 100.0);
+
+    time_service_init();
+    time_service_pps(time_count(), (int64_t)t.time * 1000000);
+    gps_start_week = WEEK;
+}
+
+/* Toyota wheel speeds: two motorola words on 0xAA and a gear on 0x3BC */
+static void test_wheel_speed(void)
+{
+    uint8_t speed[8] = {0x1b, 0x0f, 0x1b, 0x2d, 0, 0, 0, 0}, gear[8] = {4, 0, 0, 0, 0, 0, 0, 0};
+    double v = 0, ts = 0;
+    uint8_t fwd = 0;
+    uint32_t week = 0, rx0, drop0, rx, drop;
+
+    memset(&gOdoConfigurationStruct, 0, sizeof(gOdoConfigurationStruct));
+    odo_set(0, 0xAA, 8, 16, 1, 0, 0, 0, 0.01, -6767);
+    odo_set(1, 0xAA, 24, 16, 1, 0, 0, 1, 0.01, -6767);
+    odo_set(2, 0x3BC, 0, 3, 0, 0, 0, 3, 1, 0);
+    gOdoConfigurationStruct.gears[1] = 4;
+    car_can_initialize();
+
+    can_config_filter_car();
+    UNIT_CHECK_EQ(filterNum, 2);
+
+    car_can_rx_stat(&rx0, &drop0);
+    car_can_rx_isr(0x3BC, gear);
+    car_can_rx_isr(0x123, speed);
+    car_can_rx_isr(0xAA, speed);
+    UNIT_CHECK_EQ(car_can_rx_process(), 2);
+    car_can_rx_stat(&rx, &drop);
+    UNIT_CHECK_EQ(rx - rx0, 3);
+    UNIT_CHECK_EQ(drop - drop0, 0);
+
+    UNIT_CHECK(car_get_wheel_speed(&v, &fwd, &week, &ts));
+    UNIT_CHECK(fabs(v - ((0x1b0f - 6767) + (0x1b2d - 6767)) * 0.5 * 0.01 / 3.6) < 1e-4);
+    UNIT_CHECK_EQ(fwd, 0);
+    UNIT_CHECK_EQ(week, WEEK);
+    UNIT_CHECK(fabs(ts - 100.0) < 1.0);
+    UNIT_CHECK(!car_get_wheel_speed(&v, &fwd, &week, &ts));
+}
+
+/* random layouts, decoded through the plans and bit by bit */
+static void test_random_signals(void)
+{
+    uint8_t data[8];
+    double v, ref, ts;
+    uint8_t fwd;
+    uint32_t week;
+    int trial, i, sb, len, endian, bad = 0;
+
+    srand(21);
+    for (trial = 0; trial < 5000; trial++)
+    {
+        endian = rand() % 2;
+        sb = rand() % 64;
+        len = 1 + rand() % 32;
+        if (endian == 0 && sb + len > 64) len = 64 - sb;
+        if (endian == 1 && len > (sb / 8 + 1) * 8 - sb % 8) len = (sb / 8 + 1) * 8 - sb % 8;
+
+        memset(&gOdoConfigurationStruct, 0, sizeof(gOdoConfigurationStruct));
+        odo_set(0, 0x123, sb, len, endian, rand() % 2, rand() % 3, 2, (rand() % 1000) / 100.0, rand() % 200 - 100);
+        car_can_initialize();
+
+        for (i = 0; i < 8; i++) data[i] = (uint8_t)rand();
+        car_can_data_process(0x123, data);
+        UNIT_CHECK(car_get_wheel_speed(&v, &fwd, &week, &ts));
+        ref = ref_value(&gOdoConfigurationStruct.odo_mesg[0], data);
+        if (fabs(v - ref) > 1e-5 * (1.0 + fabs(ref))) bad++;
+    }
+    UNIT_CHECK_EQ(bad, 0);
+}
+
+/* raw values past 2^24 keep their last count */
+static void test_wide_signal(void)
+{
+    uint8_t data[8] = {0};
+    uint64_t raw = ((uint64_t)1 << 40) + 1;
+    double v, ts;
+    uint8_t fwd;
+    uint32_t week;
+
+    memset(&gOdoConfigurationStruct, 0, sizeof(gOdoConfigurationStruct));
+    odo_set(0, 0x123, 0, 48, 0, 0, 2, 2, 1.0, -(double)((uint64_t)1 << 40));
+    car_can_initialize();
+    memcpy(data, &raw, 6);
+    car_can_data_process(0x123, data);
+    UNIT_CHECK(car_get_wheel_speed(&v, &fwd, &week, &ts));
+    UNIT_CHECK(v == 1.0);
+}
+
+/* recompile under the decoder -------------------------------------------------
+* a timer signal stands in for a higher priority task: it preempts the
+* decoding and compiles the two wheels twice, with a factor other than the
+* last time, so the set the decoder holds is overwritten. a frame giving both
+* wheels the same raw value must always come out of one set.
+*-----------------------------------------------------------------------------*/
+#define RECOMPILES      4000
+
+static volatile int recompiles;
+
+static void recompile(int sig)
+{
+    int i;
+
+    (void)sig;
+    for (i = 0; i < 2; i++)
+    {
+        gOdoConfigurationStruct.odo_mesg[0].factor = (recompiles & 2) ? 0.02 : 0.01;
+        gOdoConfigurationStruct.odo_mesg[1].factor = (recompiles & 2) ? 0.02 : 0.01;
+        car_can_compile();
+        recompiles++;
+    }
+}
+
+static void test_recompile(void)
+{
+    uint8_t data[8] = {0, 100, 0, 100, 0, 0, 0, 0};
+    struct itimerval it = {{0, 20}, {0, 20}}, off = {{0, 0}, {0, 0}};
+    double v, ts;
+    uint8_t fwd;
+    uint32_t week;
+    int n = 0, bad = 0;
+
+    memset(&gOdoConfigurationStruct, 0, sizeof(gOdoConfigurationStruct));
+    odo_set(0, 0xAA, 0, 16, 0, 0, 2, 0, 0.01, 0);
+    odo_set(1, 0xAA, 16, 16, 0, 0, 2, 1, 0.01, 0);
+    car_can_initialize();
+
+    recompiles = 0;
+    signal(SIGALRM, recompile);
+    setitimer(ITIMER_REAL, &it, NULL);
+    while (recompiles < RECOMPILES)
+    {
+        car_can_data_process(0xAA, data);
+        if (!car_get_wheel_speed(&v, &fwd, &week, &ts) || (v != 25600 * 0.01 && v != 25600 * 0.02))
+        {
+            bad++;
+        }
+        n++;
+    }
+    setitimer(ITIMER_REAL, &off, NULL);
+    signal(SIGALRM, SIG_DFL);
+    UNIT_CHECK(n > 0);
+    UNIT_CHECK_EQ(bad, 0);
+}
+
+/* the queue keeps what fits and counts the rest */
+static void test_queue_full(void)
+{
+    uint8_t data[8] = {0};
+    uint32_t rx0, drop0, rx, drop;
+    int i;
+
+    car_can_rx_stat(&rx0, &drop0);
+    for (i = 0; i < CAR_CAN_RX_QUEUE_SIZE + 8; i++)
+    {
+        car_can_rx_isr(0x123, data);
+    }
+    car_can_rx_stat(&rx, &drop);
+    UNIT_CHECK_EQ(drop - drop0, 8);
+    UNIT_CHECK_EQ(car_can_rx_process(), CAR_CAN_RX_QUEUE_SIZE);
+    UNIT_CHECK_EQ(car_can_rx_process(), 0);
+}
+
+int main(void)
+{
+    clock_start();
+    UNIT_RUN(test_wheel_speed);
+    UNIT_RUN(test_random_signals);
+    UNIT_RUN(test_queue_full);
+    UNIT_RUN(test_wide_signal);
+    UNIT_RUN(test_recompile);
+    return unit_end();
+}
@@ -0,0 +1,121 @@
+/** ***************************************************************************
+ * @file   test_crc.c
+ * @brief  table driven crcs against bit at a time references
+ ******************************************************************************/
+#include <stdlib.h>
+#include "unit.h"
+#include "crc.h"
+#include "crc16.h"
+#include "rtcm.h"
+#include "crc_variant.h"
+
+/* MSB first, no reflection, no final xor */
+static uint32_t crc_bitwise(uint32_t poly, int width, uint32_t crc, const uint8_t *data, uint32_t len)
+{
+    uint32_t top = 1u << (width - 1);
+    uint32_t mask = width == 32 ? 0xffffffffu : (1u << width) - 1;
+    uint32_t i;
+    int b;
+
+    for (i = 0; i < len; i++)
+    {
+        crc ^= (uint32_t)data[i] << (width - 8);
+        for (b = 0; b < 8; b++)
+        {
+            crc = (crc & top) ? (crc << 1) ^ poly : crc << 1;
+        }
+        crc &= mask;
+    }
+    return crc;
+}
+
+static uint8_t data[1024 + 8];
+
+static void fill(void)
+{
+    unsigned int i;
+
+    srand(11);
+    for (i = 0; i < sizeof(data); i++) data[i] = (uint8_t)rand();
+}
+
+static void test_known_values(void)
+{
+    static const uint8_t check[] = "123456789";
+
+    /* CRC-16/AUG-CCITT check value, CalculateCRC() sends it byte swapped */
+    UNIT_CHECK_EQ(CrcCcittUpdate(0x1d0f, check, 9), 0xe5cc);
+    UNIT_CHECK_EQ(Crc24qUpdate(0, check, 9), crc_bitwise(0x864cfb, 24, 0, check, 9));
+    UNIT_CHECK_EQ(Crc32Update(0xffffffff, check, 9), crc_bitwise(0xedb88320, 32, 0xffffffff, check, 9));
+    UNIT_CHECK_EQ(CalculateCRC((uint8_t *)check, 9), 0xcce5);
+}
+
+/* every length and alignment through the sliced and the byte loops */
+static void test_slices(void)
+{
+    uint32_t len, off, crc, ref;
+    int ok_ccitt = 1, ok_24q = 1, ok_32 = 1, ok_rtk = 1, ok_variant = 1;
+
+    for (off = 0; off < 8; off++)
+    {
+        for (len = 0; len <= 300; len++)
+        {
+            const uint8_t *p = data + off;
+
+            if (CrcCcittUpdate(0x1d0f, p, len) != crc_bitwise(0x1021, 16, 0x1d0f, p, len)) ok_ccitt = 0;
+            if (Crc24qUpdate(0, p, len) != crc_bitwise(0x864cfb, 24, 0, p, len)) ok_24q = 0;
+            if (rtk_crc24q(p, len) != Crc24qUpdate(0, p, len)) ok_rtk = 0;
+
+            /* crc32 keeps its legacy table: 0xEDB88320 taken MSB first */
+            crc = Crc32Update(0xffffffff, p, len);
+            ref = crc_bitwise(0xedb88320, 32, 0xffffffff, p, len);
+            if (crc != ref) ok_32 = 0;
+
+            /* the byte-wise and slice-by-8 builds of crc.c */
+            if (CrcCcittUpdate_1(0x1d0f, p, len) != CrcCcittUpdate(0x1d0f, p, len) ||
+                CrcCcittUpdate_8(0x1d0f, p, len) != CrcCcittUpdate(0x1d0f, p, len) ||
+                Crc32Update_1(0xffffffff, p, len) != crc ||
+                Crc32Update_8(0xffffffff, p, len) != crc ||
+                Crc24qUpdate_1(0, p, len) != Crc24qUpdate(0, p, len) ||
+                Crc24qUpdate_8(0, p, len) != Crc24qUpdate(0, p, len)) ok_variant = 0;
+        }
+    }
+    UNIT_CHECK(ok_ccitt);
+    UNIT_CHECK(ok_24q);
+    UNIT_CHECK(ok_32);
+    UNIT_CHECK(ok_rtk);
+    UNIT_CHECK(ok_variant);
+}
+
+static void test_chunks(void)
+{
+    uint32_t k;
+    int ok = 1;
+
+    for (k = 0; k <= 1024; k += 37)
+    {
+        if (Crc32Update(Crc32Update(0xffffffff, data, k), data + k, 1024 - k) != Crc32(data, 1024, 0xffffffff)) ok = 0;
+        if (CrcCcittUpdate(CrcCcittUpdate(0x1d0f, data, k), data + k, 1024 - k) != CrcCcitt(data, 1024, 0x1d0f)) ok = 0;
+    }
+    UNIT_CHECK(ok);
+}
+
+static void test_bytes(void)
+{
+    uint8_t b[4];
+
+    CrcCcittTypeToBytes(0x1234, b);
+    UNIT_CHECK_EQ(BytesToCrcCcittType(b), 0x1234);
+    Crc32TypeToBytes(0xdeadbeef, b);
+    UNIT_CHECK_EQ(BytesToCrc32Type(b), 0xdeadbeef);
+}
+
+int main(void)
+{
+    fill();
+    UNIT_RUN(test_known_values);
+    UNIT_RUN(test_slices);
+    UNIT_RUN(test_chunks);
+    UNIT_RUN(test_bytes);
+    return unit_end();
+}
@@ -0,0 +1,242 @@
+/** ***************************************************************************
+ * @file   test_event_trace.c
+ * @brief  event trace ring: wrap, frames, and a drain running against
+ *         writers on other threads
+ ******************************************************************************/
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include "unit.h"
+#include "crc.h"
+#include "event_trace.h"
+
+#define EVENT_TEST_ID   0x7f00
+
+static uint8_t frame[EVENT_TRACE_FRAME_LEN(255)];
+
+static uint32_t get32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static const uint8_t *record(int i)
+{
+    return frame + EVENT_TRACE_HEADER_LEN + i * EVENT_TRACE_RECORD_LEN;
+}
+
+/* frame length, sync, count and crc agree */
+static int frame_ok(uint16_t len)
+{
+    uint16_t crc;
+
+    if (len < EVENT_TRACE_FRAME_LEN(0) || frame[0] != EVENT_TRACE_SYNC0 || frame[1] != EVENT_TRACE_SYNC1 ||
+        len != EVENT_TRACE_FRAME_LEN(frame[3]))
+    {
+        return 0;
+    }
+    crc = CrcCcittUpdate(CRC_CCITT_INITIAL_SEED, frame, len - 2u);
+    return frame[len - 2] == (uint8_t)(crc >> 8) && frame[len - 1] == (uint8_t)crc;
+}
+
+/* nothing is written while tracing is off */
+static void test_off(void)
+{
+    event_trace_stop();
+    event_trace(EVENT_TEST_ID, 1, 1, 0, 0, 0);
+    UNIT_CHECK_EQ(event_trace_drain(frame, sizeof(frame)), 0);
+    UNIT_CHECK_EQ(event_trace_command("log trace on\r\n", EVENT_TRACE_SINK_TCP), 1);
+    UNIT_CHECK_EQ(event_trace_sink(), EVENT_TRACE_SINK_TCP);
+    UNIT_CHECK_EQ(event_trace_drain(frame, sizeof(frame)), 0);
+    UNIT_CHECK_EQ(event_trace_command("log trace off\r\n", EVENT_TRACE_SINK_TCP), 1);
+    UNIT_CHECK_EQ(event_trace_sink(), EVENT_TRACE_SINK_NONE);
+}
+
+/* a full ring keeps the newest records, the lapped ones are counted once
+   in the frame after them */
+static void test_ring_wrap(void)
+{
+    event_trace_stat_t st;
+    uint32_t i, next, got = 0, lost = 0;
+    uint16_t len;
+    int k, n, ok = 1;
+
+    event_trace_start(EVENT_TRACE_SINK_UART);
+    for (i = 0; i < EVENT_TRACE_RECORDS + 37; i++)
+    {
+        event_trace(EVENT_TEST_ID, 2, i, ~i, 0, 0);
+    }
+
+    next = 37;
+    while ((len = event_trace_drain(frame, sizeof(frame))) != 0)
+    {
+        UNIT_CHECK(frame_ok(len));
+        n = frame[3];
+        lost += get32(frame + 4);
+        for (k = 0; k < n; k++)
+        {
+            if ((record(k)[4] | (record(k)[5] << 8)) != EVENT_TEST_ID || record(k)[7] != 2 ||
+                get32(record(k) + 8) != next || get32(record(k) + 12) != ~next)
+            {
+                ok = 0;
+            }
+            next++;
+        }
+        got += n;
+    }
+    UNIT_CHECK(ok);
+    UNIT_CHECK_EQ(lost, 37);
+    UNIT_CHECK_EQ(got, EVENT_TRACE_RECORDS);
+    UNIT_CHECK_EQ(next, EVENT_TRACE_RECORDS + 37);
+
+    /* half drained, then lapped: the rest of the old records are lost */
+    for (i = 0; i < 100; i++)
+    {
+        event_trace(EVENT_TEST_ID, 1, i, 0, 0, 0);
+    }
+    len = event_trace_drain(frame, EVENT_TRACE_FRAME_LEN(40));
+    UNIT_CHECK_EQ(frame[3], 40);
+    UNIT_CHECK_EQ(get32(frame + 4), 0);
+    for (i = 0; i < EVENT_TRACE_RECORDS; i++)
+    {
+        event_trace(EVENT_TEST_ID, 1, 1000 + i, 0, 0, 0);
+    }
+    len = event_trace_drain(frame, sizeof(frame));
+    UNIT_CHECK(frame_ok(len));
+    UNIT_CHECK_EQ(get32(frame + 4), 60);
+    UNIT_CHECK_EQ(get32(record(0) + 8), 1000);
+
+    while (event_trace_drain(frame, sizeof(frame)) != 0)
+    {
+    }
+    event_trace_stat(&st);
+    UNIT_CHECK_EQ(st.records, EVENT_TRACE_RECORDS + 40 + EVENT_TRACE_RECORDS);
+    UNIT_CHECK_EQ(st.lost, 37 + 60);
+
+    /* a buffer too small for one record gets nothing, the record stays */
+    event_trace(EVENT_TEST_ID, 0, 0, 0, 0, 0);
+    UNIT_CHECK_EQ(event_trace_drain(frame, EVENT_TRACE_FRAME_LEN(1) - 1), 0);
+    UNIT_CHECK_EQ(event_trace_drain(frame, sizeof(frame)), EVENT_TRACE_FRAME_LEN(1));
+    event_trace_stop();
+}
+
+/* concurrent drain -----------------------------------------------------------
+* writer threads put a per thread count and its complement in every record
+* while the reader drains on its own thread. every record must come out
+* whole and in order per writer, and what came out plus what was counted
+* lost must be what went in.
+*-----------------------------------------------------------------------------*/
+#define WRITERS         3
+#define WRITES          200000u
+
+typedef struct {
+    volatile int running;
+    uint32_t next[WRITERS];
+    uint32_t got;
+    uint32_t lost;
+    uint32_t torn;
+    uint32_t order;
+    uint32_t badframe;
+} drain_t;
+
+static void *writer(void *arg)
+{
+    uint32_t w = (uint32_t)(uintptr_t)arg, i, a;
+
+    for (i = 0; i < WRITES; i++)
+    {
+        a = (w << 24) | i;
+        event_trace(EVENT_TEST_ID, 3, a, ~a, a * 2654435761u, 0);
+        if ((i & 0xff) == 0) sched_yield();
+    }
+    return NULL;
+}
+
+static void drain_frame(drain_t *d, uint16_t len)
+{
+    const uint8_t *r;
+    uint32_t a, w;
+    int k;
+
+    if (!frame_ok(len))
+    {
+        d->badframe++;
+        return;
+    }
+    d->lost += get32(frame + 4);
+    for (k = 0; k < frame[3]; k++)
+    {
+        r = record(k);
+        a = get32(r + 8);
+        w = a >> 24;
+        if (w >= WRITERS || get32(r + 12) != ~a || get32(r + 16) != a * 2654435761u)
+        {
+            d->torn++;
+            continue;
+        }
+        if ((a & 0xffffff) < d->next[w]) d->order++;
+        d->next[w] = (a & 0xffffff) + 1;
+        d->got++;
+    }
+}
+
+static void *reader(void *arg)
+{
+    drain_t *d = arg;
+    uint16_t len;
+
+    while (d->running)
+    {
+        len = event_trace_drain(frame, (uint16_t)(EVENT_TRACE_FRAME_LEN(16 + d->got % 64)));
+        if (len == 0)
+        {
+            sched_yield();
+            continue;
+        }
+        drain_frame(d, len);
+    }
+    while ((len = event_trace_drain(frame, sizeof(frame))) != 0)
+    {
+        drain_frame(d, len);
+    }
+    return NULL;
+}
+
+static void test_concurrent_drain(void)
+{
+    static drain_t d;
+    event_trace_stat_t st;
+    pthread_t w[WRITERS], r;
+    uintptr_t i;
+
+    event_trace_start(EVENT_TRACE_SINK_TCP);
+    d.running = 1;
+    pthread_create(&r, NULL, reader, &d);
+    for (i = 0; i < WRITERS; i++)
+    {
+        pthread_create(&w[i], NULL, writer, (void *)i);
+    }
+    for (i = 0; i < WRITERS; i++)
+    {
+        pthread_join(w[i], NULL);
+    }
+    d.running = 0;
+    pthread_join(r, NULL);
+    event_trace_stat(&st);
+    event_trace_stop();
+
+    UNIT_CHECK_EQ(d.badframe, 0);
+    UNIT_CHECK_EQ(d.torn, 0);
+    UNIT_CHECK_EQ(d.order, 0);
+    UNIT_CHECK_EQ(d.got + d.lost, WRITERS * WRITES);
+    UNIT_CHECK_EQ(st.records, d.got);
+    UNIT_CHECK_EQ(st.lost, d.lost);
+    UNIT_CHECK(d.got > 0);
+}
+
+int main(void)
+{
+    UNIT_RUN(test_off);
+    UNIT_RUN(test_ring_wrap);
+    UNIT_RUN(test_concurrent_drain);
+    return unit_end();
+}
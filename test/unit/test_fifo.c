@@ -0,0 +1,270 @@
+/** ***************************************************************************
+ * @file   test_fifo.c
+ * @brief  byte fifo and text sentence builder of utils.c
+ ******************************************************************************/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unit.h"
+#include "utils.h"
+
+static void test_push_get(void)
+{
+    fifo_type f;
+    uint8_t buf[16], in[32], out[32];
+    int i;
+    FIFO_SIZE_CHECK(sizeof(buf));
+
+    for (i = 0; i < 32; i++) in[i] = (uint8_t)i;
+    fifo_init(&f, buf, sizeof(buf));
+
+    UNIT_CHECK_EQ(fifo_status(&f), 0);
+    UNIT_CHECK_EQ(fifo_space(&f), 15);
+    UNIT_CHECK_EQ(fifo_push(&f, in, 10), 10);
+    UNIT_CHECK_EQ(fifo_status(&f), 10);
+    UNIT_CHECK_EQ(fifo_get(&f, out, 4), 4);
+    UNIT_CHECK_MEM(out, in, 4);
+
+    /* wraps, and drops what does not fit */
+    UNIT_CHECK_EQ(fifo_push(&f, in + 10, 12), 9);
+    UNIT_CHECK_EQ(f.overflow, 3);
+    UNIT_CHECK_EQ(fifo_space(&f), 0);
+    UNIT_CHECK_EQ(fifo_get(&f, out, sizeof(out)), 15);
+    UNIT_CHECK_MEM(out, in + 4, 15);
+    UNIT_CHECK_EQ(fifo_status(&f), 0);
+}
+
+static void test_size(void)
+{
+    fifo_type f;
+    uint8_t buf[2000], in[8] = {1, 2, 3, 4, 5, 6, 7, 8}, out[8];
+
+    UNIT_CHECK_EQ(fifo_init(&f, buf, 1024), 0);
+    UNIT_CHECK_EQ(fifo_init(&f, buf, 2), 0);
+
+    /* other sizes fail and round down to the power of two that fits */
+    UNIT_CHECK_EQ(fifo_init(&f, buf, 2000), -1);
+    UNIT_CHECK_EQ(f.size, 1024);
+    UNIT_CHECK_EQ(fifo_space(&f), 1023);
+    UNIT_CHECK_EQ(fifo_push(&f, in, 8), 8);
+    UNIT_CHECK_EQ(fifo_get(&f, out, 8), 8);
+    UNIT_CHECK_MEM(out, in, 8);
+    UNIT_CHECK_EQ(fifo_init(&f, buf, 0xffff), -1);
+    UNIT_CHECK_EQ(f.size, 0x8000);
+
+    /* too small for any, the fifo takes nothing */
+    UNIT_CHECK_EQ(fifo_init(&f, buf, 0), -1);
+    UNIT_CHECK_EQ(fifo_init(&f, buf, 1), -1);
+    UNIT_CHECK_EQ(fifo_space(&f), 0);
+    UNIT_CHECK_EQ(fifo_push(&f, in, 8), 0);
+    UNIT_CHECK_EQ(f.overflow, 8);
+    UNIT_CHECK_EQ(fifo_get(&f, out, 8), 0);
+}
+
+static void test_peek_commit(void)
+{
+    fifo_type f;
+    uint8_t buf[16], in[16], *p;
+    int i;
+    FIFO_SIZE_CHECK(sizeof(buf));
+
+    for (i = 0; i < 16; i++) in[i] = (uint8_t)(0xa0 + i);
+    fifo_init(&f, buf, sizeof(buf));
+    fifo_push(&f, in, 12);
+    fifo_commit(&f, 12);
+    fifo_push(&f, in, 8);
+
+    /* 4 bytes to the end of the buffer, 4 more after the wrap */
+    UNIT_CHECK_EQ(fifo_peek(&f, &p), 4);
+    UNIT_CHECK_MEM(p, in, 4);
+    fifo_commit(&f, 4);
+    UNIT_CHECK_EQ(fifo_peek(&f, &p), 4);
+    UNIT_CHECK_MEM(p, in + 4, 4);
+    fifo_commit(&f, 4);
+    UNIT_CHECK_EQ(fifo_peek(&f, &p), 0);
+}
+
+static void test_reserve_publish(void)
+{
+    fifo_type f;
+    uint8_t buf[16], out[16], *p;
+    uint16_t n;
+    FIFO_SIZE_CHECK(sizeof(buf));
+
+    fifo_init(&f, buf, sizeof(buf));
+    fifo_push(&f, (uint8_t *)"0123456789", 10);
+    fifo_get(&f, out, 10);
+
+    n = fifo_reserve(&f, &p);
+    UNIT_CHECK_EQ(n, 6);
+    memcpy(p, "abcdef", 6);
+    fifo_publish(&f, 6);
+    n = fifo_reserve(&f, &p);
+    UNIT_CHECK_EQ(n, 9);
+    memcpy(p, "gh", 2);
+    fifo_publish(&f, 2);
+
+    UNIT_CHECK_EQ(fifo_get(&f, out, sizeof(out)), 8);
+    UNIT_CHECK_MEM(out, "abcdefgh", 8);
+}
+
+static void test_sentence(void)
+{
+    char buf[96], ref[96];
+    sentence_t s;
+    uint16_t len;
+    uint8_t sum = 0;
+    const double vals[] = {0.0, 0.5, 1.005, 123.456789, 2.675, 1e-7, 99999.99999, 4294967296.5};
+    unsigned int i;
+
+    sentence_begin(&s, buf, sizeof(buf));
+    sentence_str(&s, "$GPZDA,");
+    sentence_uint(&s, 7, 2);
+    sentence_str(&s, ",");
+    sentence_uint(&s, 2026, 0);
+    len = sentence_end(&s, "*");
+    for (i = 0; i < 14; i++) sum ^= (uint8_t)buf[i];
+    snprintf(ref, sizeof(ref), "$GPZDA,07,2026*%02x\r\n", sum);
+    UNIT_CHECK_EQ(len, strlen(ref));
+    UNIT_CHECK(strcmp(buf, ref) == 0);
+
+    for (i = 0; i < sizeof(vals) / sizeof(vals[0]); i++)
+    {
+        sentence_begin(&s, buf, sizeof(buf));
+        sentence_fixed(&s, vals[i], 0, 3);
+        sentence_str(&s, ",");
+        sentence_fixed(&s, -vals[i], 10, 7);
+        snprintf(ref, sizeof(ref), "%.3f,%10.7f", vals[i], -vals[i]);
+        UNIT_CHECK(strcmp(buf, ref) == 0);
+    }
+
+    /* zero padded, the sign ahead of the zeros */
+    for (i = 0; i < sizeof(vals) / sizeof(vals[0]); i++)
+    {
+        sentence_begin(&s, buf, sizeof(buf));
+        sentence_zfixed(&s, vals[i], 5, 2);
+        sentence_str(&s, ",");
+        sentence_zfixed(&s, -vals[i], 10, 7);
+        sentence_str(&s, ",");
+        sentence_zfixed(&s, vals[i], 3, 0);
+        snprintf(ref, sizeof(ref), "%05.2f,%010.7f,%03.0f", vals[i], -vals[i], vals[i]);
+        UNIT_CHECK(strcmp(buf, ref) == 0);
+    }
+
+    /* never past the buffer, always terminated */
+    sentence_begin(&s, buf, 8);
+    sentence_str(&s, "0123456789");
+    UNIT_CHECK_EQ(s.len, 7);
+    UNIT_CHECK(strcmp(buf, "0123456") == 0);
+}
+
+/* spsc stress ----------------------------------------------------------------
+* a producer thread writes a byte counter in random chunks, through copies and
+* through reserved spans, a consumer thread reads it back through copies and
+* peeked spans. any torn index or early data read shows up as a gap.
+*-----------------------------------------------------------------------------*/
+#define STRESS_BYTES    (16u << 20)
+
+typedef struct {
+    fifo_type f;
+    uint32_t errors;
+    uint32_t seed;
+} stress_t;
+
+static uint32_t stress_rand(uint32_t *x)
+{
+    *x ^= *x << 13;
+    *x ^= *x >> 17;
+    *x ^= *x << 5;
+    return *x;
+}
+
+static void *stress_producer(void *arg)
+{
+    stress_t *st = arg;
+    uint8_t chunk[300], *p;
+    uint32_t seed = st->seed, sent = 0, i;
+    uint16_t len, n;
+
+    while (sent < STRESS_BYTES)
+    {
+        len = (uint16_t)(1 + stress_rand(&seed) % sizeof(chunk));
+        if (len > STRESS_BYTES - sent) len = (uint16_t)(STRESS_BYTES - sent);
+        if (stress_rand(&seed) & 1)
+        {
+            for (i = 0; i < len; i++) chunk[i] = (uint8_t)(sent + i);
+            n = (uint16_t)(fifo_space(&st->f) < len ? fifo_space(&st->f) : len);
+            sent += fifo_push(&st->f, chunk, n);
+        }
+        else
+        {
+            n = fifo_reserve(&st->f, &p);
+            if (n > len) n = len;
+            for (i = 0; i < n; i++) p[i] = (uint8_t)(sent + i);
+            fifo_publish(&st->f, n);
+            sent += n;
+        }
+        if (n == 0) sched_yield();
+    }
+    return NULL;
+}
+
+static void *stress_consumer(void *arg)
+{
+    stress_t *st = arg;
+    uint8_t chunk[300], *p;
+    uint32_t seed = st->seed * 7, got = 0, i;
+    uint16_t n;
+
+    while (got < STRESS_BYTES)
+    {
+        if (stress_rand(&seed) & 1)
+        {
+            n = fifo_get(&st->f, chunk, (uint16_t)(1 + stress_rand(&seed) % sizeof(chunk)));
+            p = chunk;
+        }
+        else
+        {
+            n = fifo_peek(&st->f, &p);
+        }
+        for (i = 0; i < n; i++)
+        {
+            if (p[i] != (uint8_t)(got + i)) st->errors++;
+        }
+        if (p != chunk) fifo_commit(&st->f, n);
+        got += n;
+        if (n == 0) sched_yield();
+    }
+    return NULL;
+}
+
+static void test_spsc_stress(void)
+{
+    static uint8_t ring[256];
+    static stress_t st;
+    pthread_t prod, cons;
+    FIFO_SIZE_CHECK(sizeof(ring));
+
+    st.seed = 0x2545f491;
+    UNIT_CHECK_EQ(fifo_init(&st.f, ring, sizeof(ring)), 0);
+    pthread_create(&cons, NULL, stress_consumer, &st);
+    pthread_create(&prod, NULL, stress_producer, &st);
+    pthread_join(prod, NULL);
+    pthread_join(cons, NULL);
+
+    UNIT_CHECK_EQ(st.errors, 0);
+    UNIT_CHECK_EQ(st.f.overflow, 0);
+    UNIT_CHECK_EQ(fifo_status(&st.f), 0);
+}
+
+int main(void)
+{
+    UNIT_RUN(test_push_get);
+    UNIT_RUN(test_size);
+    UNIT_RUN(test_peek_commit);
+    UNIT_RUN(test_reserve_publish);
+    UNIT_RUN(test_sentence);
+    UNIT_RUN(test_spsc_stress);
+    return unit_end();
+}
@@ -0,0 +1,293 @@
+/** ***************************************************************************
+ * @file   test_filter.c
+ * @brief  filter banks against the per channel filters they replace, and the
+ *         shared filter code against the copies it replaced (filter_ref.c)
+ ******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include "unit.h"
+#include "filter.h"
+#include "Indices.h"
+#include "sensorsAPI.h"
+#include "lowpass_filter.h"
+#include "filter_ref.h"
+
+#define SAMPLES 20000
+
+static int32_t sample(void)
+{
+    return (rand() % 2000001) - 1000000;
+}
+
+/* every channel of the bank, bit for bit the per channel filter it replaced */
+static void test_butterworth_bank(void)
+{
+    static butterworth_bank bank;
+    int32_t ref[NUM_SENSOR_CHIPS][BUTTERWORTH_BANK_AXES];
+    int i, c, s, bad = 0;
+    int *dptr;
+
+    ref_Apply_Butterworth_Q27_Reset();
+    Butterworth_Q27_BankInit(&bank, BUTTERWORTH_BANK_CHANNELS);
+    for (c = 0; c < NUM_SENSOR_CHIPS; c++)
+    {
+        Butterworth_Q27_BankSet(&bank, c * BUTTERWORTH_BANK_AXES + XACCEL, 3, &iirTaps_5_Hz);
+        Butterworth_Q27_BankSet(&bank, c * BUTTERWORTH_BANK_AXES + XRATE, 3, &iirTaps_40_Hz);
+    }
+    for (i = 0; i < SAMPLES; i++)
+    {
+        for (c = 0; c < NUM_SENSOR_CHIPS; c++)
+        {
+            dptr = GetRawChipSensorsDataPtr(c);
+            for (s = 0; s < BUTTERWORTH_BANK_AXES; s++)
+            {
+                dptr[s] = sample();
+                ref[c][s] = ref_Apply_Butterworth_Q27_Filter(c, s < XRATE ? &iirTaps_5_Hz : &iirTaps_40_Hz,
+                                                             (uint8_t)s, dptr[s]);
+            }
+        }
+        Apply_Butterworth_Q27_Bank(&bank);
+        for (c = 0; c < NUM_SENSOR_CHIPS; c++)
+        {
+            dptr = GetRawChipSensorsDataPtr(c);
+            for (s = 0; s < BUTTERWORTH_BANK_AXES; s++)
+            {
+                if (dptr[s] != ref[c][s]) bad++;
+            }
+        }
+    }
+    UNIT_CHECK_EQ(bad, 0);
+}
+
+/* Apply_Butterworth_Q27_Filter as libSensors calls it, a sensor at a time:
+   the bank channels and the other sensors give the old output, and keep
+   their delay data when the taps change */
+static void test_butterworth_apply(void)
+{
+    butterworth_fixed *taps[] = {&iirTaps_2_Hz, &iirTaps_10_Hz, &iirTaps_50_Hz, &iirTaps_25_Hz};
+    int32_t ref;
+    int t, i, c, s, bad = 0;
+    int *dptr;
+
+    ref_Apply_Butterworth_Q27_Reset();
+    for (t = 0; t < 4; t++)
+    {
+        for (i = 0; i < SAMPLES / 8; i++)
+        {
+            for (c = 0; c < NUM_SENSOR_CHIPS; c++)
+            {
+                dptr = GetRawChipSensorsDataPtr(c);
+                for (s = 0; s < NUM_SENSOR_READINGS; s++)
+                {
+                    dptr[s] = sample();
+                    ref = ref_Apply_Butterworth_Q27_Filter(c, taps[(t + s) % 4], (uint8_t)s, dptr[s]);
+                    Apply_Butterworth_Q27_Filter(c, taps[(t + s) % 4], (uint8_t)s);
+                    if (dptr[s] != ref) bad++;
+                }
+            }
+        }
+    }
+    UNIT_CHECK_EQ(bad, 0);
+}
+
+/* a channel with no taps passes the samples through */
+static void test_butterworth_pass(void)
+{
+    static butterworth_bank bank;
+    int32_t data[BUTTERWORTH_BANK_CHANNELS];
+    int i;
+
+    Butterworth_Q27_BankInit(&bank, BUTTERWORTH_BANK_CHANNELS);
+    for (i = 0; i < BUTTERWORTH_BANK_CHANNELS; i++) data[i] = i * 1000 - 7;
+    Butterworth_Q27_BankFilter(&bank, data);
+    for (i = 0; i < BUTTERWORTH_BANK_CHANNELS; i++) UNIT_CHECK_EQ(data[i], i * 1000 - 7);
+}
+
+/* the circular fir gives the shifted buffer's output for every tap set */
+static void test_fir_bank(void)
+{
+    bartlett_fixed *taps[] = {&firTaps_5_Hz, &firTaps_10_Hz, &firTaps_20_Hz, &firTaps_40_Hz};
+    static int32_t delay[FIR_Q27_DELAY_SIZE(64, NUM_SENSORS)];
+    static int32_t x[NUM_SENSORS][64];
+    fir_q27_bank bank;
+    int32_t data[NUM_SENSORS], ref[NUM_SENSORS];
+    int t, i, s, bad = 0;
+
+    for (t = 0; t < 4; t++)
+    {
+        UNIT_CHECK(taps[t]->N <= 64);
+        memset(x, 0, sizeof(x));
+        FIR_Q27_BankInit(&bank, taps[t], NUM_SENSORS, delay);
+        for (i = 0; i < SAMPLES / 4; i++)
+        {
+            for (s = 0; s < NUM_SENSORS; s++)
+            {
+                data[s] = sample();
+                ref[s] = ref_Apply_Bartlett_Q27_Filter(taps[t], x[s], data[s]);
+            }
+            FIR_Q27_BankFilter(&bank, data);
+            for (s = 0; s < NUM_SENSORS; s++)
+            {
+                if (data[s] != ref[s]) bad++;
+            }
+        }
+    }
+    UNIT_CHECK_EQ(bad, 0);
+}
+
+/* Apply_Bartlett_Q27_Filter as libSensors calls it: every sensor on a ring
+   in its buffer, the same output as the shifted buffers through shorter and
+   shorter tap sets, and a buffer handed back is in the shifted order */
+static void test_bartlett_apply(void)
+{
+    bartlett_fixed *taps[] = {&firTaps_5_Hz, &firTaps_10_Hz, &firTaps_20_Hz, &firTaps_40_Hz};
+    static int32_t x[2][NUM_SENSOR_CHIPS][NUM_SENSOR_READINGS][FIR_MAX_TAPS];
+    static int32_t xref[2][NUM_SENSOR_CHIPS][NUM_SENSOR_READINGS][FIR_MAX_TAPS];
+    int32_t ref;
+    int t, i, b, c, s, bad = 0;
+    int *dptr;
+
+    UNIT_CHECK_EQ(firTaps_5_Hz.N, FIR_MAX_TAPS);
+    for (t = 0; t < 4; t++)
+    {
+        for (i = 0; i < SAMPLES / 8; i++)
+        {
+            /* one buffer an axis, then two in turn: the filter state is all
+               in them */
+            b = i < SAMPLES / 16 ? 0 : i & 1;
+            if (i == SAMPLES / 16 + SAMPLES / 32)
+            {
+                /* zeroing a buffer resets its filter */
+                memset(x[b][1], 0, sizeof(x[b][1]));
+                memset(xref[b][1], 0, sizeof(xref[b][1]));
+            }
+            for (c = 0; c < NUM_SENSOR_CHIPS; c++)
+            {
+                dptr = GetRawChipSensorsDataPtr(c);
+                for (s = 0; s < NUM_SENSOR_READINGS; s++)
+                {
+                    dptr[s] = sample();
+                    ref = ref_Apply_Bartlett_Q27_Filter(taps[t], xref[b][c][s], dptr[s]);
+                    Apply_Bartlett_Q27_Filter(c, taps[t], (uint8_t)s, x[b][c][s]);
+                    if (dptr[s] != ref) bad++;
+                }
+            }
+        }
+    }
+    UNIT_CHECK_EQ(bad, 0);
+    b = (SAMPLES / 8 - 1) & 1;  /* the buffers of the last sample are still rings */
+    UNIT_CHECK(memcmp(x[b ^ 1], xref[b ^ 1], sizeof(x[0])) == 0);
+}
+
+/* the shared step functions of lowpass_filter.c, bit for bit the copied
+   bodies: the same call sequence into both, each keeps its own state */
+static void test_lowpass(void)
+{
+    static const uint8_t cascaded1st_freq[] = {25, 100, 50, 7};
+    int32_t a, b;
+    uint8_t r1, r2, axis, chip, freq, rate;
+    int16_t in;
+    int i, bad = 0;
+
+    for (i = 0; i < 30 * SAMPLES; i++)
+    {
+        in = (int16_t)(rand() % 65536 - 32768);
+        if (i % 3) in = (int16_t)(in / 64);     /* mostly small, now and then full scale */
+        axis = rand() % NUM_AXIS;
+        chip = rand() % NUM_SENSOR_CHIPS;
+        freq = rand() % 7;
+        rate = rand() % 2;
+        switch (i % 6)
+        {
+        case 0:
+            r1 = _accelFilt_3rdOrderBWF_LowPass_Axis(axis, in, &a, freq, rate);
+            r2 = ref_accelFilt_3rdOrderBWF_LowPass_Axis(axis, in, &b, freq, rate);
+            break;
+        case 1:
+            r1 = _rateFilt_3rdOrderBWF_LowPass_Axis(axis, in, &a, freq, rate);
+            r2 = ref_rateFilt_3rdOrderBWF_LowPass_Axis(axis, in, &b, freq, rate);
+            break;
+        case 2:
+            r1 = _rateFilt_4thOrderBWF_LowPass_Axis_cascaded2nd(chip, axis, in, &a, freq, rate);
+            r2 = ref_rateFilt_4thOrderBWF_LowPass_Axis_cascaded2nd(chip, axis, in, &b, freq, rate);
+            break;
+        case 3:
+            r1 = _accelFilt_4thOrderBWF_LowPass_Axis_cascaded2nd(chip, axis, in, &a, freq, rate);
+            r2 = ref_accelFilt_4thOrderBWF_LowPass_Axis_cascaded2nd(chip, axis, in, &b, freq, rate);
+            break;
+        case 4:
+            freq = cascaded1st_freq[rand() % 4];
+            r1 = _rateFilt_3rdOrderBWF_LowPass_Axis_cascaded1st(chip, axis, in, &a, freq, rate);
+            r2 = ref_rateFilt_3rdOrderBWF_LowPass_Axis_cascaded1st(chip, axis, in, &b, freq, rate);
+            break;
+        default:
+            freq = cascaded1st_freq[rand() % 4];
+            r1 = _accelFilt_3rdOrderBWF_LowPass_Axis_cascaded1st(chip, axis, in, &a, freq, rate);
+            r2 = ref_accelFilt_3rdOrderBWF_LowPass_Axis_cascaded1st(chip, axis, in, &b, freq, rate);
+            break;
+        }
+        if (a != b || r1 != r2) bad++;
+    }
+    UNIT_CHECK_EQ(bad, 0);
+}
+
+/* the folded fir kernel, bit for bit the Bartlett_Q27_Filter it replaced with
+   its own 3 tap branch, every tap set at both rates */
+static void test_bartlett_ref(void)
+{
+    static const int odr[] = {100, 200};
+    bartlett_fixed *taps[] = {&firTaps_5_Hz, &firTaps_10_Hz, &firTaps_20_Hz, &firTaps_40_Hz};
+    int32_t x[64], a, b;
+    int r, t, i, k, bad = 0;
+
+    for (r = 0; r < 2; r++)
+    {
+        FilterInit(odr[r]);
+        for (t = 0; t < 4; t++)
+        {
+            UNIT_CHECK(taps[t]->N <= 64);
+            for (i = 0; i < SAMPLES / 4; i++)
+            {
+                for (k = 0; k < (int)taps[t]->N; k++) x[k] = sample();
+                Bartlett_Q27_Filter(taps[t], x, &a);
+                ref_Bartlett_Q27_Filter(taps[t], x, &b);
+                if (a != b) bad++;
+            }
+        }
+    }
+    FilterInit(200);
+    UNIT_CHECK_EQ(bad, 0);
+}
+
+/* unity dc gain: a constant comes out as itself once the filter settles */
+static void test_dc_gain(void)
+{
+    static butterworth_bank bank;
+    int32_t data[BUTTERWORTH_BANK_CHANNELS];
+    int i, err;
+
+    Butterworth_Q27_BankInit(&bank, 1);
+    Butterworth_Q27_BankSet(&bank, 0, 1, &iirTaps_10_Hz);
+    for (i = 0; i < 2000; i++)
+    {
+        data[0] = 100000;
+        Butterworth_Q27_BankFilter(&bank, data);
+    }
+    err = abs(data[0] - 100000);
+    UNIT_CHECK(err <= 2);
+}
+
+int main(void)
+{
+    FilterInit(200);
+    srand(3);
+    UNIT_RUN(test_butterworth_apply);
+    UNIT_RUN(test_butterworth_bank);
+    UNIT_RUN(test_butterworth_pass);
+    UNIT_RUN(test_fir_bank);
+    UNIT_RUN(test_bartlett_apply);
+    UNIT_RUN(test_dc_gain);
+    UNIT_RUN(test_lowpass);
+    UNIT_RUN(test_bartlett_ref);
+    return unit_end();
+}
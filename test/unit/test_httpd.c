@@ -0,0 +1,385 @@
+/** ***************************************************************************
+ * @file   test_httpd.c
+ * @brief  the web server over lwIP's loopback netif
+ *
+ * lwIP runs on the raw api without a kernel (test/port/lwipopts.h), httpd.c
+ * and fs.c with the generated rover fsdata.h as they are on the target. A
+ * raw api client sends each request to 127.0.0.1:80 and takes the whole
+ * answer, until httpd closes the connection.
+ *
+ * Built twice: with the fsdata.h of the tree, and with FS_IDENTITY on one
+ * that makefsdata.py --identity made, which keeps the plain copies.
+ ******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unit.h"
+#include "lwip/init.h"
+#include "lwip/netif.h"
+#include "lwip/tcp.h"
+#include "lwip/timers.h"
+#include "httpd.h"
+#include "fs.h"
+
+#define RESP_MAX        (32 * 1024)
+#define STEP_MS         10
+#define STEPS_MAX       2000
+
+typedef struct {
+    const char *req;
+    char buf[RESP_MAX];
+    int len;
+    int done;
+    int err;
+} client_t;
+
+static u32_t now_ms;
+
+u32_t sys_now(void)
+{
+    return now_ms;
+}
+
+/* httpd_handler.c registers the application's handlers here */
+static const char *ssi_tags[] = {"version"};
+
+static u16_t ssi_handler(int index, char *insert, int len)
+{
+    (void)index;
+    return (u16_t)snprintf(insert, len, "1.0");
+}
+
+void httpd_ssi_init(void)
+{
+    http_set_ssi_handler(ssi_handler, ssi_tags, 1);
+}
+
+void httpd_cgi_init(void)
+{
+}
+
+void httpd_js_init(void)
+{
+}
+
+static err_t client_recv(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t err)
+{
+    client_t *c = arg;
+    u16_t n;
+
+    LWIP_UNUSED_ARG(err);
+
+    if (p == NULL)
+    {
+        c->done = 1;
+        tcp_close(pcb);
+        return ERR_OK;
+    }
+    n = p->tot_len;
+    if (c->len + n > RESP_MAX)
+    {
+        n = RESP_MAX - c->len;
+        c->err = 1;
+    }
+    pbuf_copy_partial(p, c->buf + c->len, n, 0);
+    c->len += n;
+    tcp_recved(pcb, p->tot_len);
+    pbuf_free(p);
+    return ERR_OK;
+}
+
+static void client_err(void *arg, err_t err)
+{
+    client_t *c = arg;
+
+    LWIP_UNUSED_ARG(err);
+    c->done = 1;
+    c->err = 1;
+}
+
+static err_t client_connected(void *arg, struct tcp_pcb *pcb, err_t err)
+{
+    client_t *c = arg;
+
+    LWIP_UNUSED_ARG(err);
+    tcp_write(pcb, c->req, (u16_t)strlen(c->req), TCP_WRITE_FLAG_COPY);
+    tcp_output(pcb);
+    return ERR_OK;
+}
+
+/* the answer of httpd to req in resp, its length; -1 if it did not finish */
+static int http_get(const char *req, client_t *c)
+{
+    struct tcp_pcb *pcb = tcp_new();
+    ip_addr_t lo;
+    int i;
+
+    memset(c, 0, sizeof(*c));
+    c->req = req;
+    IP4_ADDR(&lo, 127, 0, 0, 1);
+    tcp_arg(pcb, c);
+    tcp_recv(pcb, client_recv);
+    tcp_err(pcb, client_err);
+    tcp_connect(pcb, &lo, 80, client_connected);
+    for (i = 0; i < STEPS_MAX && !c->done; i++)
+    {
+        netif_poll_all();
+        sys_check_timeouts();
+        now_ms += STEP_MS;
+    }
+    /* let the close handshake run out */
+    for (i = 0; i < 10; i++)
+    {
+        netif_poll_all();
+        sys_check_timeouts();
+    }
+    return c->done && !c->err ? c->len : -1;
+}
+
+/* the body after the header, its length */
+static int http_body(const client_t *c, const char **body)
+{
+    const char *end = strstr(c->buf, "\r\n\r\n");
+
+    if (end == NULL)
+        return -1;
+    *body = end + 4;
+    return c->len - (int)(end + 4 - c->buf);
+}
+
+static int http_header(const client_t *c, const char *field)
+{
+    const char *end = strstr(c->buf, "\r\n\r\n");
+    const char *f = strstr(c->buf, field);
+
+    return f != NULL && end != NULL && f < end;
+}
+
+/* quoted ETag of the answer in etag */
+static void http_etag(const client_t *c, char *etag, int size)
+{
+    const char *f = strstr(c->buf, "ETag: ");
+    int n = 0;
+
+    if (f != NULL)
+    {
+        f += 6;
+        while (f[n] != '\r' && n < size - 1)
+            n++;
+    }
+    memcpy(etag, f ? f : "", n);
+    etag[n] = 0;
+}
+
+static char *read_file(const char *name, int *len)
+{
+    char path[256];
+    char *data;
+    FILE *f;
+
+    snprintf(path, sizeof(path), "%s%s", WEB_FS_DIR, name);
+    f = fopen(path, "rb");
+    if (f == NULL)
+        return NULL;
+    fseek(f, 0, SEEK_END);
+    *len = (int)ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = malloc(*len);
+    if (fread(data, 1, *len, f) != (size_t)*len)
+        *len = -1;
+    fclose(f);
+    return data;
+}
+
+static client_t resp;
+
+/* the stored gzip file, header and all, to a client that takes gzip */
+static void test_gzip_accepted(void)
+{
+    static const char *reqs[] = {
+        "GET /css/style.css HTTP/1.1\r\nHost: lo\r\nAccept-Encoding: gzip, deflate, br\r\n\r\n",
+        "GET /css/style.css HTTP/1.1\r\nAccept-Encoding: deflate, gzip;q=0.5\r\nHost: lo\r\n\r\n",
+        "GET /css/style.css HTTP/1.1\r\nAccept-Encoding: gzip\r\n\r\n",
+        "GET /css/style.css HTTP/1.1\r\naccept-encoding: gzip\r\n\r\n",
+        "GET /css/style.css HTTP/1.1\r\nHost: lo\r\nACCEPT-ENCODING: gzip\r\n\r\n",
+#if !FS_IDENTITY
+        /* no Accept-Encoding header: any coding will do, and gzip is all
+           there is */
+        "GET /css/style.css HTTP/1.1\r\nHost: lo\r\n\r\n",
+        "GET /css/style.css HTTP/1.0\r\n\r\n",
+#endif
+    };
+    struct fs_file *file = fs_open("/css/style.css");
+    int i, len;
+
+    UNIT_CHECK(file != NULL && (file->flags & FS_FILE_FLAGS_GZIP));
+    if (file == NULL)
+        return;
+    for (i = 0; i < (int)(sizeof(reqs) / sizeof(reqs[0])); i++)
+    {
+        len = http_get(reqs[i], &resp);
+        UNIT_CHECK_EQ(len, file->len);
+        if (len == file->len)
+            UNIT_CHECK_MEM(resp.buf, file->data, len);
+        UNIT_CHECK(http_header(&resp, "Content-Encoding: gzip\r\n"));
+        UNIT_CHECK(http_header(&resp, "Vary: Accept-Encoding\r\n"));
+    }
+    fs_close(file);
+}
+
+#if FS_IDENTITY
+/* the plain file to a client that does not take gzip, or does not say */
+static void test_gzip_refused(void)
+{
+    static const char *reqs[] = {
+        "GET /css/style.css HTTP/1.1\r\nHost: lo\r\n\r\n",
+        "GET /css/style.css HTTP/1.1\r\nAccept-Encoding: identity\r\n\r\n",
+        "GET /css/style.css HTTP/1.1\r\naccept-encoding: identity\r\n\r\n",
+        "GET /css/style.css HTTP/1.1\r\nAccept-Encoding: deflate, gzip;q=0\r\n\r\n",
+        "GET /css/style.css HTTP/1.1\r\nAccept-Encoding: gzip; q=0.000\r\n\r\n",
+    };
+    const char *body = NULL;
+    char *plain;
+    int i, len, plain_len = 0;
+
+    plain = read_file("/css/style.css", &plain_len);
+    UNIT_CHECK(plain != NULL && plain_len > 0);
+    if (plain == NULL)
+        return;
+    for (i = 0; i < (int)(sizeof(reqs) / sizeof(reqs[0])); i++)
+    {
+        UNIT_CHECK(http_get(reqs[i], &resp) > 0);
+        UNIT_CHECK(!http_header(&resp, "Content-Encoding"));
+        len = http_body(&resp, &body);
+        UNIT_CHECK_EQ(len, plain_len);
+        if (len == plain_len)
+            UNIT_CHECK_MEM(body, plain, len);
+    }
+
+    /* HTTP/0.9 has no headers at all, the file alone */
+    len = http_get("GET /css/style.css\r\n", &resp);
+    UNIT_CHECK_EQ(len, plain_len);
+    if (len == plain_len)
+        UNIT_CHECK_MEM(resp.buf, plain, len);
+    free(plain);
+}
+#else
+/* no plain copy in flash: 406 to a client that does not take gzip */
+static void test_gzip_refused(void)
+{
+    static const char *reqs[] = {
+        "GET /css/style.css HTTP/1.1\r\nAccept-Encoding: identity\r\n\r\n",
+        "GET /css/style.css HTTP/1.1\r\naccept-encoding: identity\r\n\r\n",
+        "GET /css/style.css HTTP/1.1\r\nAccept-Encoding: deflate, gzip;q=0\r\n\r\n",
+        "GET /css/style.css HTTP/1.1\r\nAccept-Encoding: gzip; q=0.000\r\n\r\n",
+        "GET /css/style.css\r\n",
+    };
+    const char *body = NULL;
+    int i;
+
+    for (i = 0; i < (int)(sizeof(reqs) / sizeof(reqs[0])); i++)
+    {
+        UNIT_CHECK(http_get(reqs[i], &resp) > 0);
+        UNIT_CHECK(strncmp(resp.buf, "HTTP/1.0 406 Not Acceptable\r\n", 29) == 0);
+        UNIT_CHECK(http_header(&resp, "Vary: Accept-Encoding\r\n"));
+        UNIT_CHECK(!http_header(&resp, "Content-Encoding"));
+        UNIT_CHECK_EQ(http_body(&resp, &body), 0);
+    }
+}
+#endif
+
+/* files that are not compressed go to every client as they are */
+static void test_not_compressed(void)
+{
+    static const char *reqs[] = {
+        "GET /images/aceinna.png HTTP/1.1\r\nAccept-Encoding: gzip\r\n\r\n",
+        "GET /images/aceinna.png HTTP/1.1\r\n\r\n",
+    };
+    const char *body = NULL;
+    char *plain;
+    int i, len, plain_len = 0;
+
+    plain = read_file("/images/aceinna.png", &plain_len);
+    UNIT_CHECK(plain != NULL);
+    if (plain == NULL)
+        return;
+    for (i = 0; i < 2; i++)
+    {
+        UNIT_CHECK(http_get(reqs[i], &resp) > 0);
+        UNIT_CHECK(!http_header(&resp, "Content-Encoding"));
+        UNIT_CHECK(!http_header(&resp, "Vary"));
+        len = http_body(&resp, &body);
+        UNIT_CHECK_EQ(len, plain_len);
+        if (len == plain_len)
+            UNIT_CHECK_MEM(body, plain, len);
+    }
+    free(plain);
+
+    /* the SSI pages are never compressed, whatever the client takes */
+    UNIT_CHECK(http_get("GET /DeviceInfo.shtml HTTP/1.1\r\nAccept-Encoding: gzip\r\n\r\n", &resp) > 0);
+    UNIT_CHECK(strncmp(resp.buf, "HTTP/1.0 200 OK\r\n", 17) == 0);
+    UNIT_CHECK(!http_header(&resp, "Content-Encoding"));
+}
+
+/* 304 for the ETag of the encoding the client gets, the file otherwise */
+static void test_not_modified(void)
+{
+    static const char *gz = "Accept-Encoding: gzip\r\n";
+    char gz_etag[32], req[256];
+#if FS_IDENTITY
+    char plain_etag[32];
+#endif
+
+    http_get("GET /EthCfg.shtml HTTP/1.1\r\nAccept-Encoding: gzip\r\n\r\n", &resp);
+    UNIT_CHECK(http_header(&resp, "Content-Encoding: gzip\r\n"));
+    http_etag(&resp, gz_etag, sizeof(gz_etag));
+#if FS_IDENTITY
+    http_get("GET /EthCfg.shtml HTTP/1.1\r\n\r\n", &resp);
+    UNIT_CHECK(!http_header(&resp, "Content-Encoding"));
+    http_etag(&resp, plain_etag, sizeof(plain_etag));
+    UNIT_CHECK(gz_etag[0] == '"' && plain_etag[0] == '"');
+    UNIT_CHECK(strcmp(gz_etag, plain_etag) != 0);
+#else
+    UNIT_CHECK(gz_etag[0] == '"');
+#endif
+
+    snprintf(req, sizeof(req), "GET /EthCfg.shtml HTTP/1.1\r\n%sIf-None-Match: %s\r\n\r\n", gz, gz_etag);
+    UNIT_CHECK(http_get(req, &resp) > 0);
+    UNIT_CHECK(strncmp(resp.buf, "HTTP/1.0 304 Not Modified\r\n", 27) == 0);
+
+#if FS_IDENTITY
+    snprintf(req, sizeof(req), "GET /EthCfg.shtml HTTP/1.1\r\nIf-None-Match: %s\r\n\r\n", plain_etag);
+    UNIT_CHECK(http_get(req, &resp) > 0);
+    UNIT_CHECK(strncmp(resp.buf, "HTTP/1.0 304 Not Modified\r\n", 27) == 0);
+
+    /* a cached gzip copy is no good to a client that takes no gzip now */
+    snprintf(req, sizeof(req), "GET /EthCfg.shtml HTTP/1.1\r\nIf-None-Match: %s\r\n\r\n", gz_etag);
+    UNIT_CHECK(http_get(req, &resp) > 0);
+    UNIT_CHECK(strncmp(resp.buf, "HTTP/1.0 200 OK\r\n", 17) == 0);
+    UNIT_CHECK(!http_header(&resp, "Content-Encoding"));
+#else
+    /* without Accept-Encoding the gzip copy is the one it gets */
+    snprintf(req, sizeof(req), "GET /EthCfg.shtml HTTP/1.1\r\nif-none-match: %s\r\n\r\n", gz_etag);
+    UNIT_CHECK(http_get(req, &resp) > 0);
+    UNIT_CHECK(strncmp(resp.buf, "HTTP/1.0 304 Not Modified\r\n", 27) == 0);
+
+    /* a cached gzip copy is no good to a client that takes no gzip now,
+       and there is nothing else to send it */
+    snprintf(req, sizeof(req), "GET /EthCfg.shtml HTTP/1.1\r\n"
+             "Accept-Encoding: identity\r\nIf-None-Match: %s\r\n\r\n", gz_etag);
+    UNIT_CHECK(http_get(req, &resp) > 0);
+    UNIT_CHECK(strncmp(resp.buf, "HTTP/1.0 406 Not Acceptable\r\n", 29) == 0);
+#endif
+}
+
+int main(void)
+{
+    lwip_init();
+    httpd_init();
+
+    UNIT_RUN(test_gzip_accepted);
+    UNIT_RUN(test_gzip_refused);
+    UNIT_RUN(test_not_compressed);
+    UNIT_RUN(test_not_modified);
+    return unit_end();
+}
@@ -0,0 +1,497 @@
+/** ***************************************************************************
+ * @file   test_j1939.c
+ * @brief  J1939 transmit scheduler and BAM transport on a virtual CAN bus
+ *
+ * The bus stands in for can.c: three mailboxes sent in the order they were
+ * filled (TransmitFifoPriority, as can.c sets up the bxCAN), one 8 byte
+ * extended frame every BUS_FRAME_US at 250 kbit/s, and the mailbox complete
+ * interrupt after each frame. Time is the cycle counter, so HAL_GetTick()
+ * follows the bus.
+ ******************************************************************************/
+#include <string.h>
+#include "unit.h"
+#include "stm32f4xx_hal.h"
+#include "hal_host.h"
+#include "can.h"
+#include "sae_j1939.h"
+
+#define BUS_FRAME_US    540             /* 8 byte extended frame with stuff bits at 250k */
+#define BUS_MAILBOXES   3
+#define WIRE_MAX        4096
+#define TICK_US         (SAE_J1939_TASK_PERIOD_MS * 1000)
+
+#define PGN_ACCEL       0x0F02D
+#define PGN_RATE        0x0F02A
+#define PGN_POSITION    0x0FEF3
+#define PGN_ATTITUDE    0x1F119
+#define PGN_BAM         0x0FF10
+
+typedef struct {
+    CanTxMsg msg;
+    uint32_t ms;                /* end of frame */
+} wire_frame_t;
+
+static struct {
+    CanTxMsg mailbox[BUS_MAILBOXES];
+    uint32_t order[BUS_MAILBOXES];
+    uint8_t  full[BUS_MAILBOXES];
+    uint32_t filled;
+    uint32_t us;                /* bus time */
+    uint32_t starved;           /* frames that left with a mailbox empty and a desc queued */
+    int preempt;                /* a frame leaves inside every mailbox write of the task */
+    int in_isr;
+    uint32_t nested;            /* mailbox complete interrupts inside a task's write */
+    int in_write;
+    uint32_t reentered;         /* mailbox writes inside a mailbox write */
+    void (*tx_isr)(void);
+    wire_frame_t wire[WIRE_MAX];
+    int nwire;
+} bus;
+
+extern struct sae_j1939_tx_desc ecu_tx_desc[SAE_J1939_MAX_TX_DESC];
+
+BOOL canStarted = TRUE;
+
+void can_rtx_fun_config(void (*callback1)(void), void (*callback2)(void))
+{
+    (void)callback2;
+    bus.tx_isr = callback1;
+}
+
+static void bus_frame(void);
+
+BOOL can_transmit(CanTxMsg *canTxMsg)
+{
+    int i;
+
+    /* the HAL's mailbox write is not reentrant */
+    if (bus.in_write)
+        bus.reentered++;
+    for (i = 0; i < BUS_MAILBOXES; i++)
+    {
+        if (!bus.full[i])
+        {
+            bus.in_write = 1;
+            bus.mailbox[i] = *canTxMsg;
+            bus.order[i] = bus.filled++;
+            bus.full[i] = 1;
+            if (bus.preempt && !bus.in_isr)
+            {
+                bus.nested++;
+                bus_frame();
+            }
+            bus.in_write = 0;
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/* the application's handlers, the transmit path does not get to them */
+ACEINNA_J1939_PACKET_TYPE is_valid_config_command(SAE_J1939_IDENTIFIER_FIELD *ident)
+{
+    (void)ident;
+    return ACEINNA_J1939_INVALID_IDENTIFIER;
+}
+
+void platformGetVersionBytes(uint8_t *bytes)
+{
+    (void)bytes;
+}
+
+void process_data_packet(void *dsc)
+{
+    (void)dsc;
+}
+
+void process_ecu_commands(void *command, uint8_t ps, uint8_t addr)
+{
+    (void)command;
+    (void)ps;
+    (void)addr;
+}
+
+void process_request_packet(void *dsc)
+{
+    (void)dsc;
+}
+
+void save_ecu_address(uint16_t address)
+{
+    (void)address;
+}
+
+static int desc_queued(void)
+{
+    int i, n = 0;
+
+    for (i = 0; i < SAE_J1939_MAX_TX_DESC; i++)
+        n += ecu_tx_desc[i].tx_pkt_ready == DESC_OCCUPIED;
+    return n;
+}
+
+/* one frame time: the oldest mailbox goes out and its interrupt refills it */
+static void bus_frame(void)
+{
+    int i, b = -1;
+
+    host_cycles_advance(BUS_FRAME_US * (HOST_CORE_CLOCK / 1000000));
+    bus.us += BUS_FRAME_US;
+    for (i = 0; i < BUS_MAILBOXES; i++)
+    {
+        if (bus.full[i] && (b < 0 || bus.order[i] < bus.order[b]))
+            b = i;
+    }
+    if (b < 0)
+        return;
+    if (bus.nwire < WIRE_MAX)
+    {
+        bus.wire[bus.nwire].msg = bus.mailbox[b];
+        bus.wire[bus.nwire].ms = HAL_GetTick();
+        bus.nwire++;
+    }
+    bus.full[b] = 0;
+    bus.in_isr = 1;
+    bus.tx_isr();
+    bus.in_isr = 0;
+    for (i = 0; i < BUS_MAILBOXES; i++)
+    {
+        if (!bus.full[i] && desc_queued())
+            bus.starved++;
+    }
+}
+
+/* the CAN task of a period, then the bus up to the next one */
+static void bus_tick(void)
+{
+    uint32_t end = bus.us + TICK_US;
+
+    aceinna_j1939_tp_process();
+    ecu_transmit();
+    while (bus.us + BUS_FRAME_US <= end)
+        bus_frame();
+    host_cycles_advance((end - bus.us) * (HOST_CORE_CLOCK / 1000000));
+    bus.us = end;
+}
+
+static void bus_reset(void)
+{
+    int i;
+
+    /* the queue of the test before goes out first */
+    for (i = 0; i < 100 && (desc_queued() || bus.full[0] || bus.full[1] || bus.full[2]); i++)
+        bus_tick();
+    sae_j1939_initialize(_ECU_250K, 0x80);
+    gEcuInst.state = _ECU_READY;
+    bus.nwire = 0;
+    bus.starved = 0;
+}
+
+static uint8_t wire_priority(const wire_frame_t *f)
+{
+    return (f->msg.tx_header.ExtId >> 26) & 7;
+}
+
+static uint32_t wire_pgn(const wire_frame_t *f)
+{
+    uint32_t id = f->msg.tx_header.ExtId;
+    uint32_t pgn = (id >> 8) & 0x3FF00;
+
+    if (((id >> 16) & 0xFF) >= SAE_J1939_PDU2_FORMAT_MIN)
+        pgn |= (id >> 8) & 0xFF;
+    return pgn;
+}
+
+static void pgn_stat(uint32_t pgn, SAE_J1939_PGN_STAT *stat)
+{
+    uint8_t i;
+
+    for (i = 0; aceinna_j1939_tx_stat(i, stat); i++)
+    {
+        if (stat->pgn == pgn)
+            return;
+    }
+    memset(stat, 0, sizeof(*stat));
+    stat->pgn = pgn;
+}
+
+/* the four data packets of the IMU, k in the first byte */
+static void send_data(uint32_t pgn, uint8_t k)
+{
+    static const struct {
+        uint32_t pgn;
+        int priority;
+        uint8_t pf, ps, dp;
+    } pkt[] = {
+        {PGN_ACCEL, SAE_J1939_ACCELERATION_PRIORITY, SAE_J1939_PDU_FORMAT_DATA, SAE_J1939_GROUP_EXTENSION_ACCELERATION, 0},
+        {PGN_RATE, SAE_J1939_ANGULAR_PRIORITY, SAE_J1939_PDU_FORMAT_DATA, SAE_J1939_GROUP_EXTENSION_ANGULAR_RATE, 0},
+        {PGN_POSITION, SAE_J1939_POSITION_PRIORITY, SAE_J1939_PDU_FORMAT_254, SAE_J1939_PDU_SPECIFIC_243, 0},
+        {PGN_ATTITUDE, SAE_J1939_ATTITUDE_PRIORITY, SAE_J1939_PDU_FORMAT_241, SAE_J1939_PDU_SPECIFIC_25, 1},
+    };
+    uint8_t data[8] = {k, 1, 2, 3, 4, 5, 6, 7};
+    msg_params_t params;
+    int i;
+
+    for (i = 0; pkt[i].pgn != pgn; i++);
+    memset(&params, 0, sizeof(params));
+    params.pkt_type = SAE_J1939_DATA_PACKET;
+    params.priority = pkt[i].priority;
+    params.PF = pkt[i].pf;
+    params.PS = pkt[i].ps;
+    params.data_page = pkt[i].dp;
+    params.len = 8;
+    aceinna_j1939_build_msg(data, &params);
+}
+
+static const uint32_t data_pgn[] = {PGN_ATTITUDE, PGN_POSITION, PGN_RATE, PGN_ACCEL};
+
+/* what was queued before the mailboxes free up goes out by priority, each
+   PGN in queue order */
+static void test_priority_order(void)
+{
+    uint8_t next[4] = {0};
+    int i, k, ok = 1;
+
+    bus_reset();
+    for (k = 0; k < 4; k++)
+        for (i = 0; i < 4; i++)
+            send_data(data_pgn[i], (uint8_t)k);
+    bus_tick();
+
+    UNIT_CHECK_EQ(bus.nwire, 16);
+    for (i = 0; i < bus.nwire; i++)
+    {
+        if (i > 0 && wire_priority(&bus.wire[i]) < wire_priority(&bus.wire[i - 1]))
+            ok = 0;
+        for (k = 0; k < 4 && wire_pgn(&bus.wire[i]) != data_pgn[k]; k++);
+        if (k == 4 || bus.wire[i].msg.data[0] != next[k]++)
+            ok = 0;
+    }
+    UNIT_CHECK(ok);
+    UNIT_CHECK_EQ(wire_priority(&bus.wire[0]), SAE_J1939_ACCELERATION_PRIORITY);
+    UNIT_CHECK_EQ(bus.starved, 0);
+}
+
+/* a period's worth of frames leaves in that period, back to back */
+static void test_mailboxes_full(void)
+{
+    SAE_J1939_PGN_STAT before[4], after[4];
+    int i, k, t;
+
+    bus_reset();
+    for (i = 0; i < 4; i++)
+        pgn_stat(data_pgn[i], before + i);
+    for (t = 0; t < 10; t++)
+    {
+        for (k = 0; k < 3; k++)
+            for (i = 0; i < 4; i++)
+                send_data(data_pgn[i], (uint8_t)t);
+        bus_tick();
+        UNIT_CHECK_EQ(bus.nwire, 12 * (t + 1));
+    }
+    UNIT_CHECK_EQ(bus.starved, 0);
+    for (i = 0; i < 4; i++)
+    {
+        pgn_stat(data_pgn[i], after + i);
+        UNIT_CHECK_EQ(after[i].sent - before[i].sent, 30);
+        UNIT_CHECK_EQ(after[i].overflow - before[i].overflow, 0);
+        UNIT_CHECK_EQ(after[i].expired - before[i].expired, 0);
+        UNIT_CHECK(after[i].latency_max < SAE_J1939_TASK_PERIOD_MS);
+    }
+}
+
+/* the mailbox complete interrupt lands in the middle of the task's mailbox
+   writes: it leaves the refill to the task, every packet goes out once */
+static void test_preempted(void)
+{
+    SAE_J1939_PGN_STAT before[4], after[4];
+    uint8_t next[4] = {0};
+    int i, k, t, ok = 1;
+
+    bus_reset();
+    for (i = 0; i < 4; i++)
+        pgn_stat(data_pgn[i], before + i);
+    bus.preempt = 1;
+    bus.nested = 0;
+    bus.reentered = 0;
+    for (t = 0; t < 10; t++)
+    {
+        for (k = 0; k < 3; k++)
+            for (i = 0; i < 4; i++)
+                send_data(data_pgn[i], (uint8_t)(t * 3 + k));
+        bus_tick();
+    }
+    bus.preempt = 0;
+    bus_tick();
+
+    UNIT_CHECK(bus.nested > 0);
+    UNIT_CHECK_EQ(bus.reentered, 0);
+    UNIT_CHECK_EQ(desc_queued(), 0);
+    UNIT_CHECK_EQ(bus.nwire, 120);
+    for (i = 0; i < bus.nwire; i++)
+    {
+        for (k = 0; k < 4 && wire_pgn(&bus.wire[i]) != data_pgn[k]; k++);
+        if (k == 4 || bus.wire[i].msg.data[0] != next[k]++)
+            ok = 0;
+    }
+    UNIT_CHECK(ok);
+    for (i = 0; i < 4; i++)
+    {
+        pgn_stat(data_pgn[i], after + i);
+        UNIT_CHECK_EQ(after[i].sent - before[i].sent, 30);
+        UNIT_CHECK_EQ(after[i].expired - before[i].expired, 0);
+    }
+}
+
+/* at twice what the bus takes the high priorities keep their rate, the low
+   ones are dropped and counted; every packet is counted once */
+static void test_overload(void)
+{
+    SAE_J1939_PGN_STAT before[4], after[4];
+    uint32_t queued = 0, sent, dropped;
+    int i, k, t;
+
+    bus_reset();
+    for (i = 0; i < 4; i++)
+        pgn_stat(data_pgn[i], before + i);
+    for (t = 0; t < 100; t++)
+    {
+        for (i = 3; i >= 0; i--)
+            for (k = 0; k < 8; k++)
+                send_data(data_pgn[i], (uint8_t)k);
+        queued += 8;
+        bus_tick();
+    }
+    for (t = 0; t < 10; t++)
+        bus_tick();
+    UNIT_CHECK_EQ(desc_queued(), 0);
+
+    for (i = 0; i < 4; i++)
+    {
+        pgn_stat(data_pgn[i], after + i);
+        sent = after[i].sent - before[i].sent;
+        dropped = after[i].overflow - before[i].overflow + after[i].expired - before[i].expired;
+        UNIT_CHECK_EQ(sent + dropped, queued);
+        if (data_pgn[i] == PGN_ACCEL || data_pgn[i] == PGN_RATE)
+        {
+            UNIT_CHECK_EQ(sent, queued);
+            UNIT_CHECK(after[i].latency_max <= SAE_J1939_TASK_PERIOD_MS);
+        }
+        else
+        {
+            UNIT_CHECK(dropped > 0);
+        }
+    }
+    UNIT_CHECK_EQ(bus.starved, 0);
+}
+
+/* J1939-21 BAM receiver: TP.CM announces, TP.DT in sequence */
+typedef struct {
+    uint32_t pgn;
+    uint16_t len;
+    uint8_t  packets;
+    uint8_t  next;
+    uint32_t last_ms;
+    uint32_t gap_min, gap_max;
+    int      bad;
+    int      done;
+    uint8_t  data[SAE_J1939_TP_MAX_LEN];
+} bam_rx_t;
+
+static void bam_rx(bam_rx_t *rx, const wire_frame_t *f)
+{
+    uint32_t id = f->msg.tx_header.ExtId;
+    const uint8_t *d = f->msg.data;
+    uint8_t pf = (id >> 16) & 0xFF;
+    uint32_t gap;
+    int n;
+
+    if (pf != SAE_J1939_PDU_FORMAT_TP_CM && pf != SAE_J1939_PDU_FORMAT_TP_DT)
+        return;
+    if (((id >> 8) & 0xFF) != SAE_J1939_PDU_FORMAT_GLOBAL || wire_priority(f) != SAE_J1939_TP_PRIORITY)
+        rx->bad++;
+    if (pf == SAE_J1939_PDU_FORMAT_TP_CM)
+    {
+        if (d[0] != SAE_J1939_TP_CM_BAM || rx->next != 0)
+            rx->bad++;
+        rx->len = (uint16_t)(d[1] | d[2] << 8);
+        rx->packets = d[3];
+        rx->pgn = d[5] | d[6] << 8 | (uint32_t)d[7] << 16;
+        rx->next = 1;
+        rx->last_ms = f->ms;
+        rx->gap_min = 0xFFFFFFFF;
+        return;
+    }
+    if (rx->next == 0 || d[0] != rx->next || rx->next > rx->packets)
+    {
+        rx->bad++;
+        return;
+    }
+    gap = f->ms - rx->last_ms;
+    if (gap < rx->gap_min) rx->gap_min = gap;
+    if (gap > rx->gap_max) rx->gap_max = gap;
+    rx->last_ms = f->ms;
+    n = rx->len - (rx->next - 1) * 7;
+    memcpy(rx->data + (rx->next - 1) * 7, d + 1, n < 7 ? n : 7);
+    if (rx->next++ == rx->packets)
+        rx->done = 1;
+}
+
+/* a 100 byte message under periodic traffic, reassembled off the wire */
+static void test_bam(void)
+{
+    static bam_rx_t rx;
+    SAE_J1939_PGN_STAT before, after;
+    uint8_t msg[100];
+    msg_params_t params;
+    int i, t, seen = 0;
+
+    bus_reset();
+    memset(&rx, 0, sizeof(rx));
+    pgn_stat(PGN_BAM, &before);
+    for (i = 0; i < (int)sizeof(msg); i++)
+        msg[i] = (uint8_t)(i * 7 + 3);
+    memset(&params, 0, sizeof(params));
+    params.pkt_type = SAE_J1939_DATA_PACKET;
+    params.priority = SAE_J1939_CONTROL_PRIORITY;
+    params.PF = PGN_BAM >> 8;
+    params.PS = PGN_BAM & 0xFF;
+    UNIT_CHECK(aceinna_j1939_send_bam(msg, sizeof(msg), &params));
+    UNIT_CHECK(!aceinna_j1939_send_bam(msg, sizeof(msg), &params));
+
+    for (t = 0; t < 150 && !rx.done; t++)
+    {
+        for (i = 0; i < 4; i++)
+            send_data(data_pgn[i], (uint8_t)t);
+        bus_tick();
+        for (; seen < bus.nwire; seen++)
+            bam_rx(&rx, &bus.wire[seen]);
+    }
+    bus_tick();
+    UNIT_CHECK(rx.done);
+    UNIT_CHECK_EQ(rx.bad, 0);
+    UNIT_CHECK_EQ(rx.pgn, PGN_BAM);
+    UNIT_CHECK_EQ(rx.len, sizeof(msg));
+    UNIT_CHECK_EQ(rx.packets, 15);
+    UNIT_CHECK_MEM(rx.data, msg, sizeof(msg));
+    /* J1939-21: 50 to 200 ms between the packets of a BAM */
+    UNIT_CHECK(rx.gap_min >= 50 && rx.gap_max <= 200);
+
+    pgn_stat(PGN_BAM, &after);
+    UNIT_CHECK_EQ(after.sent - before.sent, 1);
+    UNIT_CHECK_EQ(after.overflow - before.overflow, 1);
+    UNIT_CHECK(after.latency_max >= 14 * SAE_J1939_TP_BAM_GAP);
+
+    /* the session is over, the next one starts */
+    UNIT_CHECK(aceinna_j1939_send_bam(msg, sizeof(msg), &params));
+}
+
+int main(void)
+{
+    UNIT_RUN(test_priority_order);
+    UNIT_RUN(test_mailboxes_full);
+    UNIT_RUN(test_preempted);
+    UNIT_RUN(test_overload);
+    UNIT_RUN(test_bam);
+    return unit_end();
+}
@@ -0,0 +1,265 @@
+/** ***************************************************************************
+ * @file   test_json.c
+ * @brief  streaming json writer against cJSON, and the pull reader
+ ******************************************************************************/
+#include <malloc.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unit.h"
+#include "alloc_count.h"
+#include "json_stream.h"
+#include "cJSON.h"
+
+/* a status document the size of the web interface ones */
+static void write_doc(json_writer_t *w)
+{
+    json_object_begin(w, NULL);
+    json_add_string(w, "packetType", "DeviceStatus");
+    json_add_number(w, "time", 345600.25);
+    json_object_begin(w, "data");
+    json_add_number(w, "week", 2230);
+    json_add_number(w, "lat", 31.123456789);
+    json_add_number(w, "neg", -0.000125);
+    json_add_number(w, "big", 1.5e20);
+    json_add_number(w, "huge", -9.5e58);
+    json_add_string(w, "esc", "a\"b\\c\n\t\x01");
+    json_object_begin(w, "empty");
+    json_object_end(w);
+    json_object_end(w);
+    json_object_end(w);
+}
+
+static char *cjson_doc(int fmt)
+{
+    cJSON *root = cJSON_CreateObject(), *data, *empty;
+    char *text;
+
+    cJSON_AddStringToObject(root, "packetType", "DeviceStatus");
+    cJSON_AddNumberToObject(root, "time", 345600.25);
+    data = cJSON_CreateObject();
+    cJSON_AddItemToObject(root, "data", data);
+    cJSON_AddNumberToObject(data, "week", 2230);
+    cJSON_AddNumberToObject(data, "lat", 31.123456789);
+    cJSON_AddNumberToObject(data, "neg", -0.000125);
+    cJSON_AddNumberToObject(data, "big", 1.5e20);
+    cJSON_AddNumberToObject(data, "huge", -9.5e58);
+    cJSON_AddStringToObject(data, "esc", "a\"b\\c\n\t\x01");
+    empty = cJSON_CreateObject();
+    cJSON_AddItemToObject(data, "empty", empty);
+    text = fmt ? cJSON_Print(root) : cJSON_PrintUnformatted(root);
+    cJSON_Delete(root);
+    return text;
+}
+
+static void test_same_text_as_cjson(void)
+{
+    static char buf[1024];
+    json_writer_t w;
+    char *ref;
+    int fmt, len;
+
+    for (fmt = 0; fmt <= 1; fmt++)
+    {
+        ref = cjson_doc(fmt);
+        alloc_count_reset();
+        json_writer_init(&w, buf, sizeof(buf), NULL, NULL, (uint8_t)fmt);
+        write_doc(&w);
+        len = json_writer_end(&w);
+        UNIT_CHECK_EQ(alloc_count.allocs, 0);
+        UNIT_CHECK_EQ(len, strlen(ref));
+        UNIT_CHECK(strcmp(buf, ref) == 0);
+        free(ref);
+    }
+}
+
+typedef struct {
+    char text[1024];
+    int len;
+    int calls;
+} sink_t;
+
+static int sink_append(void *ctx, const char *data, uint16_t len)
+{
+    sink_t *s = (sink_t *)ctx;
+
+    if (s->len + len >= (int)sizeof(s->text)) return 0;
+    memcpy(s->text + s->len, data, len);
+    s->len += len;
+    s->text[s->len] = 0;
+    s->calls++;
+    return 1;
+}
+
+/* a small buffer with a sink gives the same text in pieces */
+static void test_sink(void)
+{
+    static sink_t s;
+    char buf[16];
+    json_writer_t w;
+    char *ref = cjson_doc(1);
+
+    json_writer_init(&w, buf, sizeof(buf), sink_append, &s, 1);
+    write_doc(&w);
+    UNIT_CHECK_EQ(json_writer_end(&w), strlen(ref));
+    UNIT_CHECK(s.calls > 1);
+    UNIT_CHECK(strcmp(s.text, ref) == 0);
+    free(ref);
+}
+
+static void test_overflow(void)
+{
+    char buf[24];
+    json_writer_t w;
+
+    json_writer_init(&w, buf, sizeof(buf), NULL, NULL, 0);
+    write_doc(&w);
+    UNIT_CHECK_EQ(json_writer_end(&w), -1);
+    UNIT_CHECK(strlen(buf) < sizeof(buf));
+
+    json_writer_init(&w, buf, sizeof(buf), NULL, NULL, 0);
+    json_object_begin(&w, NULL);
+    UNIT_CHECK_EQ(json_writer_end(&w), -1);
+}
+
+static void test_reader(void)
+{
+    static const char text[] =
+        "{\"ntrip\":{\"ip\":\"1.2.3.4\",\"port\":2101,\"list\":[1,true,null]},\"x\":\"a\\u0041\\n\"}";
+    json_reader_t r;
+    json_token_e tok;
+    char out[16];
+    int n = 0;
+
+    json_reader_init(&r, text, sizeof(text) - 1);
+    UNIT_CHECK_EQ(json_next(&r), JSON_OBJECT_BEGIN);
+    UNIT_CHECK_EQ(json_next(&r), JSON_OBJECT_BEGIN);
+    UNIT_CHECK(json_key_is(&r, "ntrip"));
+    UNIT_CHECK_EQ(json_next(&r), JSON_STRING);
+    UNIT_CHECK(json_key_is(&r, "ip"));
+    UNIT_CHECK_EQ(json_next(&r), JSON_NUMBER);
+    UNIT_CHECK(r.num == 2101.0);
+    tok = json_next(&r);
+    UNIT_CHECK_EQ(tok, JSON_ARRAY_BEGIN);
+    UNIT_CHECK(json_skip(&r, tok) >= 0);
+    UNIT_CHECK_EQ(json_next(&r), JSON_OBJECT_END);
+    UNIT_CHECK_EQ(json_next(&r), JSON_STRING);
+    n = json_string_copy(r.str, r.str_len, out, sizeof(out));
+    UNIT_CHECK_EQ(n, 3);
+    UNIT_CHECK(strcmp(out, "aA\n") == 0);
+    UNIT_CHECK_EQ(json_next(&r), JSON_OBJECT_END);
+    UNIT_CHECK_EQ(json_next(&r), JSON_DONE);
+
+    json_reader_init(&r, "{\"a\":}", 6);
+    UNIT_CHECK_EQ(json_next(&r), JSON_OBJECT_BEGIN);
+    UNIT_CHECK_EQ(json_next(&r), JSON_ERROR);
+}
+
+/* heap churn -----------------------------------------------------------------
+* the bt link's round trip, the configuration document written and its keys
+* read back, 10^6 times with other values each time. cJSON took about a
+* hundred small blocks for each one (json/cjson_*_bt_config in the bench),
+* here there must be no heap call and the heap must end up as it started,
+* block for block.
+*-----------------------------------------------------------------------------*/
+#define CHURN_ROUNDS    1000000
+
+static const char *const churn_keys[] = {
+    "userPacketRate",
+    "leverArmBx", "leverArmBy", "leverArmBz",
+    "pointOfInterestBx", "pointOfInterestBy", "pointOfInterestBz",
+    "rotationRbvx", "rotationRbvy", "rotationRbvz"
+};
+#define NCHURN  (sizeof(churn_keys) / sizeof(churn_keys[0]))
+
+static int churn_write(char *buf, uint16_t size, const float *para)
+{
+    json_writer_t w;
+    unsigned int k;
+
+    json_writer_init(&w, buf, size, NULL, NULL, 1);
+    json_object_begin(&w, NULL);
+    json_object_begin(&w, "openrtk config");
+    json_add_string(&w, "Product Name", "OpenRTK330L");
+    json_add_number(&w, "Product SN", 2178200112);
+    json_add_string(&w, "userPacketType", "s1");
+    for (k = 0; k < NCHURN; k++)
+        json_add_number(&w, churn_keys[k], para[k]);
+    json_object_end(&w);
+    json_object_end(&w);
+    return json_writer_end(&w);
+}
+
+/* the numbers of the keys in "openrtk config", 1 if all were there */
+static int churn_read(const char *text, int len, double *val)
+{
+    json_reader_t r;
+    json_token_e tok;
+    unsigned int k, found = 0;
+
+    json_reader_init(&r, text, (uint16_t)len);
+    if (json_next(&r) != JSON_OBJECT_BEGIN || json_next(&r) != JSON_OBJECT_BEGIN ||
+        !json_key_is(&r, "openrtk config"))
+        return 0;
+    while ((tok = json_next(&r)) > JSON_DONE && tok != JSON_OBJECT_END)
+    {
+        for (k = 0; k < NCHURN; k++)
+        {
+            if (tok == JSON_NUMBER && json_key_is(&r, churn_keys[k]))
+            {
+                val[k] = r.num;
+                found |= 1u << k;
+            }
+        }
+        if (!json_skip(&r, tok))
+            return 0;
+    }
+    return tok == JSON_OBJECT_END && found == (1u << NCHURN) - 1;
+}
+
+static void test_heap_churn(void)
+{
+    static char buf[1024];
+    struct mallinfo2 before, after;
+    float para[NCHURN];
+    double val[NCHURN] = {0};
+    unsigned int i, k, bad = 0;
+    int len;
+
+    before = mallinfo2();
+    alloc_count_reset();
+    for (i = 0; i < CHURN_ROUNDS; i++)
+    {
+        para[0] = (float)(1 + i % 200);
+        for (k = 1; k < NCHURN; k++)
+            para[k] = (float)((int)(i * k % 20001) - 10000) / 64.0f;
+        len = churn_write(buf, sizeof(buf), para);
+        if (len <= 0 || !churn_read(buf, len, val))
+        {
+            bad++;
+            continue;
+        }
+        /* %.15g and back gives the float's double again */
+        for (k = 0; k < NCHURN; k++)
+            if (val[k] != (double)para[k])
+                bad++;
+    }
+    after = mallinfo2();
+
+    UNIT_CHECK_EQ(bad, 0);
+    UNIT_CHECK_EQ(alloc_count.allocs, 0);
+    UNIT_CHECK_EQ(alloc_count.frees, 0);
+    UNIT_CHECK_EQ(after.arena, before.arena);
+    UNIT_CHECK_EQ(after.ordblks, before.ordblks);
+    UNIT_CHECK_EQ(after.uordblks, before.uordblks);
+    UNIT_CHECK_EQ(after.fordblks, before.fordblks);
+}
+
+int main(void)
+{
+    UNIT_RUN(test_same_text_as_cjson);
+    UNIT_RUN(test_sink);
+    UNIT_RUN(test_overflow);
+    UNIT_RUN(test_reader);
+    UNIT_RUN(test_heap_churn);
+    return unit_end();
+}
@@ -0,0 +1,137 @@
+/** ***************************************************************************
+ * @file   test_nmea.c
+ * @brief  nmea sentences of utils.c against the sprintf code they replace
+ ******************************************************************************/
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unit.h"
+#include "constants.h"
+#include "nav_math.h"
+#include "rtcm.h"
+#include "utils.h"
+#include "nmea_ref.h"
+
+#define NFIX    200000
+
+static double urand(double lo, double hi)
+{
+    return lo + (hi - lo) * ((double)rand() / RAND_MAX);
+}
+
+/* a fix anywhere on earth, the velocity now and then below the 1 m/s the
+   rmc course is held at */
+static void random_fix(double *ecef)
+{
+    double pos[3], v = rand() % 4 ? 40.0 : 0.7;
+
+    pos[0] = urand(-90.0, 90.0) * D2R;
+    pos[1] = urand(-180.0, 180.0) * D2R;
+    pos[2] = urand(-100.0, 9000.0);
+    pos2ecef(pos, ecef);
+    ecef[3] = urand(-v, v);
+    ecef[4] = urand(-v, v);
+    ecef[5] = urand(-v, v);
+}
+
+/* times on the ms grid and off it, seconds close to the .995 round up */
+static gtime_t random_time(void)
+{
+    double tow = (double)(rand() % 604800000) * 1e-3;
+
+    if (rand() % 2)
+    {
+        tow = floor(tow) + urand(0.99, 0.9999);
+    }
+    return gpst2time(2230, tow);
+}
+
+static void test_gga(void)
+{
+    char buf[NMEA_GGA_MAXLEN], ref[NMEA_GGA_MAXLEN];
+    double xyz[6], ep[6] = {0}, dop, age;
+    int i, nsat, type, len, bad = 0;
+
+    memset(xyz, 0, sizeof(xyz));
+    len = print_nmea_gga(ep, xyz, 0, 0, 0.0, 0.0, buf);
+    UNIT_CHECK_EQ(len, nmea_ref_gga(ep, xyz, 0, 0, 0.0, 0.0, ref));
+    UNIT_CHECK(strcmp(buf, ref) == 0);
+
+    srand(13);
+    for (i = 0; i < NFIX; i++)
+    {
+        random_fix(xyz);
+        time2epoch(gpst2utc(random_time()), ep);
+        nsat = rand() % 40;
+        type = rand() % 6;
+        dop = urand(0.5, 20.0);
+        age = urand(0.0, 30.0);
+        len = print_nmea_gga(ep, xyz, nsat, type, dop, age, buf);
+        if (len != nmea_ref_gga(ep, xyz, nsat, type, dop, age, ref) || strcmp(buf, ref) != 0)
+        {
+            bad++;
+        }
+    }
+    UNIT_CHECK_EQ(bad, 0);
+}
+
+static void test_rmc(void)
+{
+    char buf[NMEA_RMC_MAXLEN], ref[NMEA_RMC_MAXLEN];
+    double xyz[6];
+    gtime_t t;
+    int i, fix, len, bad = 0;
+
+    memset(xyz, 0, sizeof(xyz));
+    t = gpst2time(2230, 0.0);
+    len = print_rmc(t, xyz, 0, buf);
+    UNIT_CHECK_EQ(len, nmea_ref_rmc(t, xyz, 0, ref));
+    UNIT_CHECK(strcmp(buf, ref) == 0);
+
+    /* in step, both keep the last course for the slow fixes */
+    srand(17);
+    for (i = 0; i < NFIX; i++)
+    {
+        random_fix(xyz);
+        t = random_time();
+        fix = 1 + rand() % 5;
+        len = print_rmc(t, xyz, fix, buf);
+        if (len != nmea_ref_rmc(t, xyz, fix, ref) || strcmp(buf, ref) != 0)
+        {
+            bad++;
+        }
+    }
+    UNIT_CHECK_EQ(bad, 0);
+}
+
+/* values past the integer digit path come out whole, up to the buffer end */
+static void test_fixed_fallback(void)
+{
+    static const double val[] = { 4294967296.5, -1.5e20, 1e60, -3e300 };
+    char buf[400], ref[400];
+    sentence_t s;
+    unsigned int i;
+
+    for (i = 0; i < sizeof(val) / sizeof(val[0]); i++)
+    {
+        sentence_begin(&s, buf, sizeof(buf));
+        sentence_str(&s, "$");
+        sentence_fixed(&s, val[i], 0, 3);
+        snprintf(ref, sizeof(ref), "$%.3f", val[i]);
+        UNIT_CHECK(strcmp(buf, ref) == 0);
+        UNIT_CHECK_EQ(s.len, strlen(ref));
+    }
+    sentence_begin(&s, buf, 16);
+    sentence_fixed(&s, 1e60, 0, 0);
+    UNIT_CHECK_EQ(s.len, 15);
+    UNIT_CHECK(strncmp(buf, "999999999999999", 15) == 0);
+}
+
+int main(void)
+{
+    UNIT_RUN(test_gga);
+    UNIT_RUN(test_rmc);
+    UNIT_RUN(test_fixed_fallback);
+    return unit_end();
+}
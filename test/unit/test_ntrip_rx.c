@@ -0,0 +1,211 @@
+/** ***************************************************************************
+ * @file   test_ntrip_rx.c
+ * @brief  netbuf ring of the ntrip clients: peek and commit through pbuf
+ *         chains, index wrap, a full ring holding the data back in the
+ *         connection, and the rtcm3 consumer on generated epochs
+ ******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include "unit.h"
+#include "rtcm_gen.h"
+#include "lwip/init.h"
+#include "lwip/stats.h"
+#include "lwip/pbuf.h"
+#include "ntrip_rx.h"
+
+#define STREAM_MAX  (64 * 1024)
+#define PENDING_MAX 2   /* with the ring, within MEMP_NUM_NETBUF */
+
+/* lwIP and the kernel are linked in for the netbufs only, nothing runs */
+u32_t sys_now(void)
+{
+    return 0;
+}
+
+void vApplicationIdleHook(void)
+{
+}
+
+/* netconn_recv of the clients, handing out the netbufs the test made */
+static struct netbuf *pending[NTRIP_RX_REFS + 1];   /* a full ring and one more */
+static int npending = 0;
+static int recv_calls = 0;
+
+err_t netconn_recv(struct netconn *conn, struct netbuf **new_buf)
+{
+    (void)conn;
+    recv_calls++;
+    if (npending == 0)
+    {
+        *new_buf = NULL;
+        return ERR_TIMEOUT;
+    }
+    *new_buf = pending[0];
+    memmove(&pending[0], &pending[1], --npending * sizeof(pending[0]));
+    return ERR_OK;
+}
+
+/* a netbuf of len bytes in nseg pbufs of about the same size */
+static struct netbuf *make_netbuf(const uint8_t *data, int len, int nseg)
+{
+    struct netbuf *nb = netbuf_new();
+    struct pbuf *p;
+    int i, n, pos = 0;
+
+    for (i = 0; i < nseg; i++)
+    {
+        n = (len - pos) / (nseg - i);
+        p = pbuf_alloc(PBUF_RAW, (u16_t)n, PBUF_RAM);
+        memcpy(p->payload, data + pos, n);
+        pos += n;
+        if (nb->p == NULL) nb->p = p;
+        else pbuf_cat(nb->p, p);
+    }
+    nb->ptr = nb->p;
+    return nb;
+}
+
+static void send_netbuf(const uint8_t *data, int len, int nseg)
+{
+    pending[npending++] = make_netbuf(data, len, nseg);
+}
+
+static int netbufs_used(void)
+{
+    return lwip_stats.memp[MEMP_NETBUF].used;
+}
+
+/* a chain is read pbuf by pbuf in place, and given back once read */
+static void test_peek_commit(void)
+{
+    uint8_t in[31], *data;
+    uint32_t arrival;
+    int i;
+
+    for (i = 0; i < (int)sizeof(in); i++) in[i] = (uint8_t)(i * 7);
+    send_netbuf(in, sizeof(in), 3);     /* 10, 10 and 11 bytes */
+    UNIT_CHECK_EQ(netbufs_used(), 1);
+
+    UNIT_CHECK_EQ(ntrip_rx_peek(&data, &arrival), 0);
+    UNIT_CHECK_EQ(ntrip_rx_recv(NULL), ERR_OK);
+    UNIT_CHECK_EQ(ntrip_rx_peek(&data, &arrival), 10);
+    UNIT_CHECK_MEM(data, in, 10);
+    ntrip_rx_commit(4);
+    UNIT_CHECK_EQ(ntrip_rx_peek(&data, NULL), 6);
+    UNIT_CHECK_MEM(data, in + 4, 6);
+    ntrip_rx_commit(6);
+    UNIT_CHECK_EQ(ntrip_rx_peek(&data, NULL), 10);
+    UNIT_CHECK_MEM(data, in + 10, 10);
+    ntrip_rx_commit(10);
+    UNIT_CHECK_EQ(ntrip_rx_peek(&data, NULL), 11);
+    UNIT_CHECK_MEM(data, in + 20, 11);
+    ntrip_rx_commit(11);
+    UNIT_CHECK_EQ(ntrip_rx_peek(&data, NULL), 0);
+    UNIT_CHECK_EQ(netbufs_used(), 0);
+}
+
+/* a full ring leaves the data in the connection until a netbuf is read */
+static void test_full(void)
+{
+    uint8_t in[NTRIP_RX_REFS + 1], out[NTRIP_RX_REFS + 1];
+    int i, calls;
+
+    for (i = 0; i <= NTRIP_RX_REFS; i++)
+    {
+        in[i] = (uint8_t)(100 + i);
+        send_netbuf(in + i, 1, 1);
+    }
+    for (i = 0; i < NTRIP_RX_REFS; i++) UNIT_CHECK_EQ(ntrip_rx_recv(NULL), ERR_OK);
+    UNIT_CHECK_EQ(npending, 1);
+
+    calls = recv_calls;
+    UNIT_CHECK_EQ(ntrip_rx_recv(NULL), ERR_OK);
+    UNIT_CHECK_EQ(recv_calls, calls);
+    UNIT_CHECK_EQ(npending, 1);
+
+    UNIT_CHECK_EQ(ntrip_rx_get(out, 1), 1);
+    UNIT_CHECK_EQ(ntrip_rx_recv(NULL), ERR_OK);
+    UNIT_CHECK_EQ(npending, 0);
+    UNIT_CHECK_EQ(ntrip_rx_get(out + 1, sizeof(out) - 1), NTRIP_RX_REFS);
+    UNIT_CHECK_MEM(out, in, sizeof(in));
+    UNIT_CHECK_EQ(netbufs_used(), 0);
+
+    /* nothing queued, nothing received */
+    UNIT_CHECK_EQ(ntrip_rx_recv(NULL), ERR_TIMEOUT);
+}
+
+/* enough netbufs through to wrap the free running indexes, read in pieces
+   that do not line up with the pbufs */
+static void test_wrap(void)
+{
+    static uint8_t in[STREAM_MAX], out[STREAM_MAX];
+    int sent = 0, got = 0, nbuf = 0, len;
+
+    srand(19);
+    for (len = 0; len < STREAM_MAX; len++) in[len] = (uint8_t)rand();
+    while (got < STREAM_MAX)
+    {
+        if (sent < STREAM_MAX && npending < PENDING_MAX)
+        {
+            len = 1 + rand() % 200;
+            if (len > STREAM_MAX - sent) len = STREAM_MAX - sent;
+            send_netbuf(in + sent, len, 1 + (len > 3 ? rand() % 3 : 0));
+            sent += len;
+            nbuf++;
+        }
+        ntrip_rx_recv(NULL);
+        got += ntrip_rx_get(out + got, (uint16_t)(1 + rand() % 150));
+    }
+    UNIT_CHECK(nbuf > 2 * 256);
+    UNIT_CHECK_EQ(sent, STREAM_MAX);
+    UNIT_CHECK_MEM(out, in, STREAM_MAX);
+    UNIT_CHECK_EQ(netbufs_used(), 0);
+}
+
+/* the rtcm3 consumer frames the netbufs in place, an epoch split anywhere,
+   and times every epoch */
+static void test_input_rtcm3(void)
+{
+    static gnss_rtcm_t gnss;
+    static uint8_t stream[STREAM_MAX];
+    const ntrip_rx_latency_t *lat = ntrip_rx_latency();
+    rtcm_gen_t g;
+    int i, n = 0, pos = 0, len, nepoch = 0;
+
+    rtcm_gen_init(&g, 1234, 77);
+    for (i = 0; i < 20; i++)
+    {
+        n += rtcm_gen_epoch(&g, 4 + i % 4, 5, stream + n, STREAM_MAX - n);
+    }
+    memset(&gnss, 0, sizeof(gnss));
+    while (pos < n || npending)
+    {
+        if (pos < n && npending < PENDING_MAX)
+        {
+            len = 536 - rand() % 100;       /* a tcp segment about */
+            if (len > n - pos) len = n - pos;
+            send_netbuf(stream + pos, len, 2);
+            pos += len;
+        }
+        ntrip_rx_recv(NULL);
+        nepoch += ntrip_rx_input_rtcm3(BASE, &gnss);
+    }
+    nepoch += ntrip_rx_input_rtcm3(BASE, &gnss);
+
+    UNIT_CHECK_EQ(nepoch, 20);
+    UNIT_CHECK_EQ(gnss.obs[BASE].staid, 77);
+    UNIT_CHECK_EQ(lat->n, 20);
+    UNIT_CHECK(lat->min <= lat->last && lat->last <= lat->max);
+    UNIT_CHECK_EQ(netbufs_used(), 0);
+}
+
+int main(void)
+{
+    lwip_init();
+
+    UNIT_RUN(test_peek_commit);
+    UNIT_RUN(test_full);
+    UNIT_RUN(test_wrap);
+    UNIT_RUN(test_input_rtcm3);
+    return unit_end();
+}
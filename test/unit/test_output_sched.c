@@ -0,0 +1,363 @@
+/** ***************************************************************************
+ * @file   test_output_sched.c
+ * @brief  output scheduler: dividers, priorities, budget, progress, fan-out, counters
+ ******************************************************************************/
+#include <string.h>
+#include "unit.h"
+#include "output_sched.h"
+
+/* a stream writing len bytes of its tag */
+typedef struct {
+    uint8_t  tag;
+    uint16_t len;
+    int      calls;
+    int      parts;             /* > 0: that many calls of len each, pending between */
+} fake_stream_t;
+
+static int fake_fill(output_stream_t *stream, uint8_t *buf, uint16_t size)
+{
+    fake_stream_t *f = stream->ctx;
+
+    f->calls++;
+    if (f->len > size)
+        return OUTPUT_FILL_LATER;
+    memset(buf, f->tag, f->len);
+    if (f->parts > 0 && --f->parts > 0)
+        stream->pending = 1;
+    return f->len;
+}
+
+/* a sink keeping what it was sent, run by run */
+typedef struct {
+    uint8_t  data[OUTPUT_SCHED_FRAME_SIZE];
+    uint16_t len;
+    int      runs;
+    int      calls;
+    uint32_t backlog;
+    uint32_t drop;              /* bytes to report dropped a call */
+} fake_sink_t;
+
+static uint32_t fake_send(output_sink_t *sink, const output_frame_t *frame)
+{
+    fake_sink_t *f = sink->ctx;
+    const uint8_t *data;
+    uint16_t len;
+    uint8_t i = 0;
+
+    f->calls++;
+    while ((len = output_frame_run(frame, sink->id, &i, &data)) != 0)
+    {
+        memcpy(f->data + f->len, data, len);
+        f->len += len;
+        f->runs++;
+    }
+    return f->drop;
+}
+
+static uint32_t fake_backlog(output_sink_t *sink)
+{
+    return ((fake_sink_t *)sink->ctx)->backlog;
+}
+
+static output_sched_t sched;
+
+static void setup_stream(output_stream_t *st, fake_stream_t *f, uint8_t tag, uint16_t len,
+                         uint16_t divider, uint8_t priority, uint8_t sinks)
+{
+    memset(st, 0, sizeof(*st));
+    memset(f, 0, sizeof(*f));
+    f->tag = tag;
+    f->len = len;
+    st->fill = fake_fill;
+    st->divider = divider;
+    st->priority = priority;
+    st->sinks = sinks;
+    st->ctx = f;
+}
+
+static void setup_sink(output_sink_t *sink, fake_sink_t *f, uint8_t id, int paced)
+{
+    memset(sink, 0, sizeof(*sink));
+    memset(f, 0, sizeof(*f));
+    sink->send = fake_send;
+    sink->backlog = paced ? fake_backlog : NULL;
+    sink->id = id;
+    sink->ctx = f;
+}
+
+static void test_divider(void)
+{
+    output_stream_t a, quiet;
+    fake_stream_t fa, fq;
+    output_sink_t sink;
+    fake_sink_t fs;
+    int t, sent[12];
+
+    output_sched_init(&sched, 0);
+    setup_sink(&sink, &fs, 0, 0);
+    setup_stream(&a, &fa, 'a', 4, 3, 0, OUTPUT_SINK(0));
+    setup_stream(&quiet, &fq, 'q', 4, 0, 0, OUTPUT_SINK(0));
+    a.count = 5;                /* first one after a delay */
+    quiet.pending = 1;
+    UNIT_CHECK_EQ(output_sched_add_sink(&sched, &sink), 0);
+    UNIT_CHECK_EQ(output_sched_add_stream(&sched, &a), 0);
+    UNIT_CHECK_EQ(output_sched_add_stream(&sched, &quiet), 0);
+
+    for (t = 1; t <= 12; t++)
+        sent[t - 1] = output_sched_tick(&sched) != 0;
+    /* ticks 5, 8, 11 */
+    UNIT_CHECK_EQ(fa.calls, 3);
+    UNIT_CHECK(sent[4] && sent[7] && sent[10]);
+    UNIT_CHECK(!sent[0] && !sent[5] && !sent[11]);
+    UNIT_CHECK_EQ(fq.calls, 0);
+    UNIT_CHECK_EQ(quiet.pending, 0);
+    UNIT_CHECK_EQ(sink.frames, 3);
+    UNIT_CHECK_EQ(fs.calls, 3);
+    UNIT_CHECK_EQ(sink.bytes, 12);
+}
+
+static void test_priority_budget(void)
+{
+    output_stream_t lo, hi;
+    fake_stream_t flo, fhi;
+    output_sink_t sink;
+    fake_sink_t fs;
+
+    output_sched_init(&sched, 100);
+    setup_sink(&sink, &fs, 0, 1);
+    setup_stream(&lo, &flo, 'l', 60, 1, 1, OUTPUT_SINK(0));
+    setup_stream(&hi, &fhi, 'h', 60, 2, 0, OUTPUT_SINK(0));
+    output_sched_add_sink(&sched, &sink);
+    output_sched_add_stream(&sched, &lo);   /* added first, goes second */
+    output_sched_add_stream(&sched, &hi);
+
+    /* both due, only the first fits: the other waits a tick */
+    UNIT_CHECK_EQ(output_sched_tick(&sched), 60);
+    UNIT_CHECK_EQ(fs.data[0], 'h');
+    UNIT_CHECK_EQ(lo.pending, 1);
+    UNIT_CHECK_EQ(lo.deferred, 1);
+    UNIT_CHECK_EQ(output_sched_tick(&sched), 60);
+    UNIT_CHECK_EQ(fs.data[60], 'l');
+    UNIT_CHECK_EQ(lo.pending, 0);
+    UNIT_CHECK_EQ(sched.over_budget, 0);
+
+    /* the backlog of a paced sink comes off the budget */
+    fs.backlog = 50;
+    UNIT_CHECK_EQ(output_sched_tick(&sched), 60);
+    UNIT_CHECK_EQ(lo.deferred, 2);
+    fs.backlog = 100;
+    UNIT_CHECK_EQ(output_sched_tick(&sched), 0);
+    UNIT_CHECK_EQ(lo.pending, 1);
+    UNIT_CHECK_EQ(sink.backlog_last, 100);
+    UNIT_CHECK_EQ(sink.backlog_max, 100);
+}
+
+static void test_over_budget(void)
+{
+    output_stream_t big, small;
+    fake_stream_t fbig, fsmall;
+    output_sink_t sink;
+    fake_sink_t fs;
+
+    /* a packet longer than a tick gets in alone, not never */
+    output_sched_init(&sched, 10);
+    setup_sink(&sink, &fs, 0, 1);
+    setup_stream(&big, &fbig, 'b', 50, 1, 0, OUTPUT_SINK(0));
+    setup_stream(&small, &fsmall, 's', 5, 1, 1, OUTPUT_SINK(0));
+    output_sched_add_sink(&sched, &sink);
+    output_sched_add_stream(&sched, &big);
+    output_sched_add_stream(&sched, &small);
+
+    UNIT_CHECK_EQ(output_sched_tick(&sched), 50);
+    UNIT_CHECK_EQ(sched.over_budget, 1);
+    UNIT_CHECK_EQ(small.deferred, 1);
+    UNIT_CHECK_EQ(fsmall.calls, 0);
+
+    /* larger than the frame: later, for ever, without writing past it */
+    fbig.len = OUTPUT_SCHED_FRAME_SIZE + 1;
+    fs.len = 0;
+    UNIT_CHECK_EQ(output_sched_tick(&sched), 5);
+    UNIT_CHECK_EQ(big.pending, 1);
+    UNIT_CHECK_EQ(fs.data[0], 's');
+}
+
+static void test_parts(void)
+{
+    output_stream_t sky, imu;
+    fake_stream_t fsky, fimu;
+    output_sink_t sink;
+    fake_sink_t fs;
+    int t;
+
+    /* a burst of three 40 byte packets next to a 30 byte one every tick */
+    output_sched_init(&sched, 80);
+    setup_sink(&sink, &fs, 0, 0);
+    setup_stream(&imu, &fimu, 'i', 30, 1, 0, OUTPUT_SINK(0));
+    setup_stream(&sky, &fsky, 'k', 40, 100, 1, OUTPUT_SINK(0));
+    sky.count = 1;
+    fsky.parts = 3;
+    output_sched_add_sink(&sched, &sink);
+    output_sched_add_stream(&sched, &imu);
+    output_sched_add_stream(&sched, &sky);
+
+    for (t = 0; t < 3; t++)
+    {
+        fs.len = 0;
+        UNIT_CHECK_EQ(output_sched_tick(&sched), 70);
+        UNIT_CHECK_EQ(fs.data[0], 'i');
+        UNIT_CHECK_EQ(fs.data[30], 'k');
+    }
+    UNIT_CHECK_EQ(sky.pending, 0);
+    UNIT_CHECK_EQ(output_sched_tick(&sched), 30);
+    UNIT_CHECK_EQ(fsky.calls, 3);
+}
+
+/* the user uart at 115200 baud: 115 bytes a tick, the backlog what it has
+   not sent yet */
+#define UART_115200_TICK    115
+
+static uint16_t uart_tick(fake_sink_t *fs)
+{
+    uint16_t n;
+
+    fs->len = 0;
+    n = output_sched_tick(&sched);
+    fs->backlog += n;
+    fs->backlog = fs->backlog > UART_115200_TICK ? fs->backlog - UART_115200_TICK : 0;
+    return n;
+}
+
+static void test_progress_115200(void)
+{
+    output_stream_t imu, gnss, nmea;
+    fake_stream_t fimu, fgnss, fnmea;
+    output_sink_t sink;
+    fake_sink_t fs;
+    int t;
+
+    /* a 43 byte imu packet every tick, pS and three sK packets each larger
+       than a tick and the nmea sentences once a second */
+    output_sched_init(&sched, UART_115200_TICK);
+    setup_sink(&sink, &fs, 0, 1);
+    setup_stream(&imu, &fimu, 'i', 43, 1, 0, OUTPUT_SINK(0));
+    setup_stream(&gnss, &fgnss, 'g', 255, 100, 1, OUTPUT_SINK(0));
+    setup_stream(&nmea, &fnmea, 'n', 230, 100, 2, OUTPUT_SINK(0));
+    output_sched_add_sink(&sched, &sink);
+    output_sched_add_stream(&sched, &imu);
+    output_sched_add_stream(&sched, &gnss);
+    output_sched_add_stream(&sched, &nmea);
+
+    for (t = 0; t < 1000; t++)
+    {
+        if (t % 100 == 0)
+            fgnss.parts = 4;
+        uart_tick(&fs);
+    }
+    UNIT_CHECK_EQ(gnss.sent, 40);
+    UNIT_CHECK_EQ(nmea.sent, 10);
+    /* the imu packet of the tick or two the uart needs for one of those
+       packets is coalesced into the next one */
+    UNIT_CHECK(imu.sent >= 1000 - 2 * (gnss.sent + nmea.sent));
+    UNIT_CHECK(fs.backlog < 2 * 255);
+
+    /* more than the port takes: a lower priority stream due every tick still
+       gets its turn, the higher one is not shut out in turn */
+    output_sched_init(&sched, UART_115200_TICK);
+    setup_sink(&sink, &fs, 0, 1);
+    setup_stream(&imu, &fimu, 'i', 43, 1, 0, OUTPUT_SINK(0));
+    setup_stream(&nmea, &fnmea, 'n', 255, 1, 2, OUTPUT_SINK(0));
+    output_sched_add_sink(&sched, &sink);
+    output_sched_add_stream(&sched, &imu);
+    output_sched_add_stream(&sched, &nmea);
+
+    for (t = 0; t < 10000; t++)
+        uart_tick(&fs);
+    UNIT_CHECK(nmea.sent > 1000);
+    UNIT_CHECK(imu.sent > 1000);
+    UNIT_CHECK(imu.waited < 10 && nmea.waited < 10);
+}
+
+static void test_fan_out(void)
+{
+    output_stream_t x, y, z;
+    fake_stream_t fx, fy, fz;
+    output_sink_t uart, tcp, spi;
+    fake_sink_t fu, ft, fsp;
+    uint8_t want[30];
+
+    output_sched_init(&sched, 0);
+    setup_sink(&uart, &fu, 0, 1);
+    setup_sink(&tcp, &ft, 1, 0);
+    setup_sink(&spi, &fsp, 2, 0);
+    setup_stream(&x, &fx, 'x', 10, 1, 0, OUTPUT_SINK(0) | OUTPUT_SINK(1));
+    setup_stream(&y, &fy, 'y', 10, 1, 1, OUTPUT_SINK(0));
+    setup_stream(&z, &fz, 'z', 10, 1, 2, OUTPUT_SINK(0) | OUTPUT_SINK(1));
+    output_sched_add_sink(&sched, &uart);
+    output_sched_add_sink(&sched, &tcp);
+    output_sched_add_sink(&sched, &spi);
+    output_sched_add_stream(&sched, &x);
+    output_sched_add_stream(&sched, &y);
+    output_sched_add_stream(&sched, &z);
+    ft.drop = 4;
+
+    UNIT_CHECK_EQ(output_sched_tick(&sched), 30);
+
+    /* one call a sink, the spans of the sink, a run per gap */
+    memset(want, 'x', 10);
+    memset(want + 10, 'y', 10);
+    memset(want + 20, 'z', 10);
+    UNIT_CHECK_EQ(fu.calls, 1);
+    UNIT_CHECK_EQ(fu.runs, 1);
+    UNIT_CHECK_EQ(fu.len, 30);
+    UNIT_CHECK_MEM(fu.data, want, 30);
+    UNIT_CHECK_EQ(ft.calls, 1);
+    UNIT_CHECK_EQ(ft.runs, 2);
+    UNIT_CHECK_EQ(ft.len, 20);
+    UNIT_CHECK_MEM(ft.data, want, 10);
+    UNIT_CHECK_MEM(ft.data + 10, want + 20, 10);
+    UNIT_CHECK_EQ(fsp.calls, 0);
+    UNIT_CHECK_EQ(spi.frames, 0);
+
+    UNIT_CHECK_EQ(uart.bytes, 30);
+    UNIT_CHECK_EQ(uart.drop_frame, 0);
+    UNIT_CHECK_EQ(tcp.bytes, 16);
+    UNIT_CHECK_EQ(tcp.drop_frame, 1);
+    UNIT_CHECK_EQ(tcp.drop_bytes, 4);
+}
+
+static void test_limits(void)
+{
+    output_stream_t st[OUTPUT_SCHED_MAX_STREAMS + 1];
+    fake_stream_t f[OUTPUT_SCHED_MAX_STREAMS + 1];
+    output_sink_t sink;
+    fake_sink_t fs;
+    int i;
+
+    output_sched_init(&sched, 0);
+    for (i = 0; i <= OUTPUT_SCHED_MAX_STREAMS; i++)
+    {
+        setup_stream(&st[i], &f[i], 'a' + i, 1, 1, (uint8_t)(OUTPUT_SCHED_MAX_STREAMS - i), 1);
+        UNIT_CHECK_EQ(output_sched_add_stream(&sched, &st[i]), i < OUTPUT_SCHED_MAX_STREAMS ? 0 : -1);
+    }
+    /* by priority */
+    for (i = 0; i < OUTPUT_SCHED_MAX_STREAMS; i++)
+        UNIT_CHECK(sched.stream[i] == &st[OUTPUT_SCHED_MAX_STREAMS - 1 - i]);
+
+    setup_sink(&sink, &fs, 8, 0);
+    UNIT_CHECK_EQ(output_sched_add_sink(&sched, &sink), -1);
+    sink.id = 0;
+    sink.send = NULL;
+    UNIT_CHECK_EQ(output_sched_add_sink(&sched, &sink), -1);
+}
+
+int main(void)
+{
+    UNIT_RUN(test_divider);
+    UNIT_RUN(test_priority_budget);
+    UNIT_RUN(test_over_budget);
+    UNIT_RUN(test_parts);
+    UNIT_RUN(test_progress_115200);
+    UNIT_RUN(test_fan_out);
+    UNIT_RUN(test_limits);
+    return unit_end();
+}
@@ -0,0 +1,926 @@
+/** ***************************************************************************
+ * @file   test_rtcm.c
+ * @brief  rtcm3 framer and decoder on generated streams
+ ******************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+#include "unit.h"
+#include "rtcm_gen.h"
+#include "gnss_data_api.h"
+#include "event_trace.h"
+
+#define STREAM_MAX  (64 * 1024)
+#define TEST_TIME   1700000000     /* decoder time, so the week does not come from the clock */
+
+extern void setcodepri(int sys, int freq, const char *pri);
+
+static gnss_rtcm_t gnss;
+static unsigned char stream[STREAM_MAX];
+
+static int make_stream(int msm, int epochs, int eph_every)
+{
+    rtcm_gen_t g;
+    int i, n = 0;
+
+    rtcm_gen_init(&g, 1234, 77);
+    for (i = 0; i < epochs; i++)
+    {
+        n += rtcm_gen_epoch(&g, msm, eph_every, stream + n, STREAM_MAX - n);
+    }
+    return n;
+}
+
+/* feed a span, count completed epochs */
+static int feed_buf(const unsigned char *data, int len, unsigned int stn)
+{
+    unsigned int pos = 0, nused;
+    int stat, nepoch = 0;
+
+    while (pos < (unsigned int)len)
+    {
+        input_rtcm3_buf(data + pos, len - pos, stn, &gnss, &nused, &stat);
+        pos += nused;
+        if (stat == 1) nepoch++;
+    }
+    return nepoch;
+}
+
+static void test_stat_index(void)
+{
+    UNIT_CHECK_EQ(rtcm_stat_index(1004), 0);
+    UNIT_CHECK_EQ(rtcm_stat_index(1046), 6);
+    UNIT_CHECK_EQ(rtcm_stat_index(999), 7);
+    UNIT_CHECK_EQ(rtcm_stat_index(1074), 8);
+    UNIT_CHECK_EQ(rtcm_stat_index(1127), 11);
+    UNIT_CHECK_EQ(rtcm_stat_index(1073), RTCM_STAT_NTYPE - 1);
+    UNIT_CHECK_EQ(rtcm_stat_index(1005), RTCM_STAT_NTYPE - 1);
+}
+
+static void test_msm_epochs(void)
+{
+    int msm, len;
+
+    for (msm = 4; msm <= 7; msm++)
+    {
+        memset(&gnss, 0, sizeof(gnss));
+        len = make_stream(msm, 10, 0);
+        UNIT_CHECK_EQ(feed_buf(stream, len, ROVER), 10);
+        UNIT_CHECK_EQ(gnss.obs[ROVER].n, 40);
+        UNIT_CHECK_EQ(gnss.obs[ROVER].staid, 77);
+        UNIT_CHECK_EQ(gnss.rcv[ROVER].nbyte, 0);
+    }
+}
+
+/* gps l2 of the generator at four signals is 2L and 2W, the priority
+   picks which one goes to the L2 slot; a change applies from the next
+   epoch on, not only to signal masks not seen yet */
+static int l2_code(void)
+{
+    unsigned int i;
+
+    for (i = 0; i < gnss.obs[ROVER].n; i++)
+    {
+        if (gnss.obs[ROVER].data[i].sat <= 32 && gnss.obs[ROVER].data[i].code[1])
+            return gnss.obs[ROVER].data[i].code[1];
+    }
+    return 0;
+}
+
+static void test_code_priority(void)
+{
+    rtcm_gen_t g;
+    int len[3], e, pos = 0;
+
+    memset(&gnss, 0, sizeof(gnss));
+    gnss.rcv[ROVER].time.time = TEST_TIME;
+    rtcm_gen_init(&g, 42, 5);
+    g.nsig = 4;
+    for (e = 0; e < 3; e++)
+    {
+        len[e] = rtcm_gen_epoch(&g, 7, 0, stream + pos, STREAM_MAX - pos);
+        pos += len[e];
+    }
+
+    UNIT_CHECK_EQ(feed_buf(stream, len[0], ROVER), 1);
+    UNIT_CHECK_EQ(l2_code(), CODE_L2W);
+    setcodepri(_SYS_GPS_, 2, "LPYWCMNDSX");
+    UNIT_CHECK_EQ(feed_buf(stream + len[0], len[1], ROVER), 1);
+    UNIT_CHECK_EQ(l2_code(), CODE_L2L);
+    setcodepri(_SYS_GPS_, 2, "PYWCMNDSLX");
+    UNIT_CHECK_EQ(feed_buf(stream + len[0] + len[1], len[2], ROVER), 1);
+    UNIT_CHECK_EQ(l2_code(), CODE_L2W);
+}
+
+static void test_legacy_epochs(void)
+{
+    int len;
+
+    memset(&gnss, 0, sizeof(gnss));
+    len = make_stream(0, 5, 0);
+    UNIT_CHECK_EQ(feed_buf(stream, len, ROVER), 5);
+    UNIT_CHECK(gnss.obs[ROVER].n > 0);
+}
+
+/* byte at a time and a whole span must leave the same observations */
+static void test_byte_vs_span(void)
+{
+    static obs_t ref;
+    int i, len, nepoch = 0;
+
+    memset(&gnss, 0, sizeof(gnss));
+    len = make_stream(7, 4, 2);
+    feed_buf(stream, len, ROVER);
+    ref = gnss.obs[ROVER];
+
+    memset(&gnss, 0, sizeof(gnss));
+    for (i = 0; i < len; i++)
+    {
+        if (input_rtcm3(stream[i], ROVER, &gnss) == 1) nepoch++;
+    }
+    UNIT_CHECK_EQ(nepoch, 4);
+    UNIT_CHECK_EQ(gnss.obs[ROVER].n, ref.n);
+    UNIT_CHECK_MEM(gnss.obs[ROVER].data, ref.data, sizeof(obsd_t) * ref.n);
+}
+
+static void test_ephemeris(void)
+{
+    rtcm_gen_t g;
+    unsigned char frame[RTCM_GEN_FRAME_MAX];
+    unsigned int nused;
+    int len, stat;
+
+    memset(&gnss, 0, sizeof(gnss));
+    rtcm_gen_init(&g, 99, 1);
+    len = rtcm_gen_frame(&g, 1019, 0, frame);
+    UNIT_CHECK_EQ(len, 61 + 6);
+    input_rtcm3_buf(frame, len, ROVER, &gnss, &nused, &stat);
+    UNIT_CHECK_EQ(nused, len);
+    UNIT_CHECK_EQ(stat, 2);
+    UNIT_CHECK_EQ(gnss.nav.n, 1);
+}
+
+/* a receiver over a station of gnss */
+static void gnss_rcv(rtcmrcv_t *rcv, unsigned int stn)
+{
+    rtcm_rcv_init(rcv, gnss.rcv + stn, gnss.obs + stn, &gnss.nav);
+}
+
+static void test_statistics(void)
+{
+    static rtcm_stat_t stat[MAXSTN];
+    rtcmrcv_t rcv[MAXSTN];
+    unsigned int pos, nused;
+    int len;
+
+    memset(&gnss, 0, sizeof(gnss));
+    gnss_rcv(rcv + ROVER, ROVER);
+    gnss_rcv(rcv + BASE, BASE);
+    rtcm_attach_stat(rcv + ROVER, stat + ROVER);
+    rtcm_attach_stat(rcv + BASE, stat + BASE);
+    len = make_stream(5, 3, 1);
+    for (pos = 0; pos < (unsigned int)len; pos += nused)
+    {
+        input_rtcm3_rcv(stream + pos, len - pos, rcv + BASE, &nused, NULL);
+    }
+
+    UNIT_CHECK_EQ(stat[BASE].nbyte, len);
+    UNIT_CHECK_EQ(stat[BASE].nmsg, 3 * 5);
+    UNIT_CHECK_EQ(stat[BASE].ntype[9], 3 * 4);
+    UNIT_CHECK_EQ(stat[BASE].nerr, 0);
+    UNIT_CHECK_EQ(stat[ROVER].nmsg, 0);
+    UNIT_CHECK_EQ(stat[BASE].maxobs, 40);
+
+    /* the station entry points run without */
+    rtcm_attach_stat(rcv + BASE, NULL);
+    feed_buf(stream, len, BASE);
+    UNIT_CHECK_EQ(stat[BASE].nmsg, 3 * 5);
+}
+
+/* complete epochs only, each measured */
+static void test_epoch_assembler(void)
+{
+    static obsepoch_t ep;
+    static unsigned char cut[STREAM_MAX];
+    rtcmrcv_t rcv;
+    const obs_t *obs;
+    unsigned int seq, pos, nused, flen;
+    int len, n = 0, msg = 0;
+
+    memset(&gnss, 0, sizeof(gnss));
+    gnss_rcv(&rcv, ROVER);
+    rtcm_attach_epoch(&rcv, &ep);
+    UNIT_CHECK(rtcm_epoch_get(&ep, &seq) == NULL);
+
+    /* 4 msm per epoch, the gps message of the third epoch lost */
+    len = make_stream(7, 4, 0);
+    for (pos = 0; pos < (unsigned int)len; pos += flen)
+    {
+        flen = ((stream[pos + 1] & 3) << 8 | stream[pos + 2]) + 6;
+        if (msg++ == 8) continue;
+        memcpy(cut + n, stream + pos, flen);
+        n += flen;
+    }
+    for (pos = 0; pos < (unsigned int)n; pos += nused)
+    {
+        input_rtcm3_rcv(cut + pos, n - pos, &rcv, &nused, NULL);
+    }
+    obs = rtcm_epoch_get(&ep, &seq);
+    UNIT_CHECK_EQ(seq, 4);
+    UNIT_CHECK(obs != NULL && obs->n == 40);
+    UNIT_CHECK(rtcm_epoch_valid(&ep, seq));
+    UNIT_CHECK_EQ(gnss.obs[ROVER].n, 0);
+    UNIT_CHECK_EQ(ep.nmsg_max, 4);
+    UNIT_CHECK_EQ(ep.nmsg_last, 4);
+    UNIT_CHECK_EQ(ep.nshort, 1);
+    UNIT_CHECK(ep.span_us_max >= ep.span_us_last);
+    UNIT_CHECK(ep.age_us_sum >= ep.age_us_max);
+}
+
+/* garbage between frames is skipped, a flipped bit costs that frame only */
+static void test_noise_and_parity(void)
+{
+    static rtcm_stat_t stat;
+    static unsigned char noisy[STREAM_MAX];
+    rtcm_gen_t g;
+    unsigned char frame[RTCM_GEN_FRAME_MAX];
+    rtcmrcv_t rcv;
+    unsigned int pos, nused;
+    int i, n = 0, len, st, nepoch = 0;
+
+    memset(&gnss, 0, sizeof(gnss));
+    gnss_rcv(&rcv, ROVER);
+    rtcm_attach_stat(&rcv, &stat);
+    rtcm_gen_init(&g, 5, 3);
+    for (i = 0; i < 8; i++)
+    {
+        memset(noisy + n, 0x55, 17);
+        n += 17;
+        len = rtcm_gen_frame(&g, 1077, 0, frame);
+        if (i == 3) frame[len / 2] ^= 0x10;
+        memcpy(noisy + n, frame, len);
+        n += len;
+    }
+    for (pos = 0; pos < (unsigned int)n; pos += nused)
+    {
+        input_rtcm3_rcv(noisy + pos, n - pos, &rcv, &nused, &st);
+        if (st == 1) nepoch++;
+    }
+    UNIT_CHECK_EQ(nepoch, 7);
+    UNIT_CHECK(stat.nerr >= 1);   /* and any false preamble inside it */
+}
+
+/* a stream with every kind of damage, each intact frame has to come out:
+   flipped bits, cut frames, preamble bytes with and without a plausible
+   header in front of frames and inside their bodies, runs of garbage */
+static int corrupt_stream(unsigned char *out, int size, int *nintact)
+{
+    rtcm_gen_t g;
+    unsigned char frame[RTCM_GEN_FRAME_MAX];
+    static const int types[] = {1077, 1087, 1097, 1127, 1074, 1019, 1005, 1012};
+    int i, k, n = 0, len;
+
+    *nintact = 0;
+    rtcm_gen_init(&g, 77, 5);
+    for (i = 0; n + 2 * RTCM_GEN_FRAME_MAX + 64 < size; i++)
+    {
+        len = rtcm_gen_frame(&g, types[i % 8], 0, frame);
+        switch (rtcm_gen_rand(&g) % 8)
+        {
+        case 0:     /* bit error */
+            frame[3 + rtcm_gen_rand(&g) % (len - 3)] ^= (unsigned char)(1 << rtcm_gen_rand(&g) % 8);
+            break;
+        case 1:     /* cut short, the next frame follows */
+            len = 3 + rtcm_gen_rand(&g) % (len - 3);
+            break;
+        case 2:     /* false preamble with a zero reserved field right before */
+            out[n++] = 0xD3;
+            out[n++] = 0x00;
+            out[n++] = (unsigned char)rtcm_gen_rand(&g);
+            (*nintact)++;
+            break;
+        case 3:     /* false preamble with reserved bits set */
+            out[n++] = 0xD3;
+            out[n++] = 0xFC | (rtcm_gen_rand(&g) & 3);
+            (*nintact)++;
+            break;
+        case 4:     /* garbage, rich in preambles */
+            for (k = rtcm_gen_rand(&g) % 40; k > 0; k--)
+            {
+                out[n++] = (rtcm_gen_rand(&g) & 1) ? 0xD3 : (unsigned char)rtcm_gen_rand(&g);
+            }
+            (*nintact)++;
+            break;
+        default:
+            (*nintact)++;
+            break;
+        }
+        memcpy(out + n, frame, len);
+        n += len;
+    }
+    return n;
+}
+
+static void test_corruption_replay(void)
+{
+    static rtcm_stat_t stat;
+    static unsigned char bad[4 * STREAM_MAX];
+    unsigned int pos, nused, chunk;
+    int i, n, nintact, stat1;
+    rtcm_gen_t g;
+    rtcmrcv_t rcv;
+
+    n = corrupt_stream(bad, sizeof(bad), &nintact);
+    UNIT_CHECK(nintact > 100);
+    gnss_rcv(&rcv, ROVER);
+
+    /* whole spans */
+    memset(&gnss, 0, sizeof(gnss));
+    rtcm_attach_stat(&rcv, &stat);
+    for (pos = 0; pos < (unsigned int)n; pos += nused)
+    {
+        input_rtcm3_rcv(bad + pos, n - pos, &rcv, &nused, NULL);
+    }
+    UNIT_CHECK_EQ(stat.nmsg, nintact);
+    UNIT_CHECK(stat.nerr > 0);
+
+    /* a byte at a time */
+    memset(&gnss, 0, sizeof(gnss));
+    rtcm_attach_stat(&rcv, &stat);
+    for (i = 0; i < n; i++) input_rtcm3_rcv_byte(bad[i], &rcv);
+    UNIT_CHECK_EQ(stat.nmsg, nintact);
+    UNIT_CHECK_EQ(stat.nbyte, n);
+
+    /* dma sized chunks of any length */
+    memset(&gnss, 0, sizeof(gnss));
+    rtcm_attach_stat(&rcv, &stat);
+    rtcm_gen_init(&g, 3, 0);
+    for (pos = 0; pos < (unsigned int)n; )
+    {
+        chunk = 1 + rtcm_gen_rand(&g) % 700;
+        if (chunk > n - pos) chunk = n - pos;
+        for (i = 0; i < (int)chunk; i += nused)
+        {
+            input_rtcm3_rcv(bad + pos + i, chunk - i, &rcv, &nused, &stat1);
+        }
+        pos += chunk;
+    }
+    UNIT_CHECK_EQ(stat.nmsg, nintact);
+}
+
+/* whole span into a receiver */
+static void feed_rcv(const unsigned char *data, int len, rtcmrcv_t *rcv)
+{
+    unsigned int pos = 0, nused;
+
+    while (pos < (unsigned int)len)
+    {
+        input_rtcm3_rcv(data + pos, len - pos, rcv, &nused, NULL);
+        pos += nused;
+    }
+}
+
+/* a byte arriving as an epoch completes from the buffer is framed like any
+   other. a false preamble takes in the last frame of one epoch and all of
+   the next; after its parity error both epochs decode from the buffer, the
+   second one on the following byte, which is junk to be skipped */
+static void test_byte_after_epoch(void)
+{
+    static const unsigned char zeros[6] = {0};
+    static unsigned char a[STREAM_MAX / 4], b[STREAM_MAX / 4];
+    static obs_t ref;
+    rtcm_stat_t stat[2];
+    rtcmrcv_t rcv;
+    rtcm_gen_t g;
+    int i, k, na, nb, last = 0, flen, len, nepoch = 0;
+
+    rtcm_gen_init(&g, 1234, 77);
+    g.nsat = 2;
+    na = rtcm_gen_epoch(&g, 4, 0, a, sizeof(a));
+    nb = rtcm_gen_epoch(&g, 4, 0, b, sizeof(b));
+    for (i = 0; i < na; i += flen)              /* start of the last frame of a */
+    {
+        flen = (int)(((a[i + 1] & 3) << 8) | a[i + 2]) + 6;
+        last = i;
+    }
+    flen = na - last + nb;                      /* false frame: header + flen */
+    UNIT_CHECK(flen - 3 <= 1023);
+
+    len = 0;
+    memcpy(stream, a, last);
+    len += last;
+    stream[len++] = 0xd3;
+    stream[len++] = (unsigned char)(((flen - 3) >> 8) & 3);
+    stream[len++] = (unsigned char)(flen - 3);
+    memcpy(stream + len, a + last, na - last);
+    len += na - last;
+    memcpy(stream + len, b, nb);
+    len += nb;
+    memcpy(stream + len, zeros, sizeof(zeros));
+    len += sizeof(zeros);
+    len += rtcm_gen_epoch(&g, 4, 0, stream + len, STREAM_MAX - len);
+
+    for (k = 0; k < 2; k++)
+    {
+        memset(&gnss, 0, sizeof(gnss));
+        memset(stat + k, 0, sizeof(stat[k]));
+        rtcm_rcv_init(&rcv, gnss.rcv + ROVER, gnss.obs + ROVER, &gnss.nav);
+        rtcm_attach_stat(&rcv, stat + k);
+        if (k == 0)
+        {
+            feed_rcv(stream, len, &rcv);
+            ref = gnss.obs[ROVER];
+            continue;
+        }
+        for (i = 0; i < len; i++)
+        {
+            if (input_rtcm3_rcv_byte(stream[i], &rcv) == 1) nepoch++;
+        }
+    }
+    UNIT_CHECK_EQ(nepoch, 3);
+    UNIT_CHECK_EQ(stat[0].nerr, 1);
+    UNIT_CHECK_EQ(stat[1].nbyte, stat[0].nbyte);
+    UNIT_CHECK_EQ(stat[1].nmsg, stat[0].nmsg);
+    UNIT_CHECK_EQ(stat[1].nerr, stat[0].nerr);
+    UNIT_CHECK_EQ(gnss.obs[ROVER].n, ref.n);
+    UNIT_CHECK_MEM(gnss.obs[ROVER].data, ref.data, sizeof(obsd_t) * ref.n);
+}
+
+static int nav_dups(const nav_t *nav)
+{
+    unsigned int i, j;
+    int n = 0;
+
+    for (i = 0; i < nav->n; i++)
+        for (j = i + 1; j < nav->n; j++) n += nav->eph[i].sat == nav->eph[j].sat;
+    for (i = 0; i < nav->ng; i++)
+        for (j = i + 1; j < nav->ng; j++) n += nav->geph[i].sat == nav->geph[j].sat;
+    return n;
+}
+
+/* a satellite not in nav.eph */
+static int free_sat(const nav_t *nav)
+{
+    unsigned int i;
+    int sat;
+
+    for (sat = 1; sat < MAXSAT; sat++)
+    {
+        for (i = 0; i < nav->n && nav->eph[i].sat != sat; i++) ;
+        if (i == nav->n) break;
+    }
+    return sat;
+}
+
+/* two receivers with their own obs index and one nav index on a shared nav
+   decode the same as without indexes, in any interleaving */
+static void test_satslot_receivers(void)
+{
+    static rtcm_t rtcm[4];
+    static obs_t obs[4];
+    static nav_t nav[2];
+    static satslot_t slot[2];
+    static navslot_t navslot;
+    static unsigned char other[STREAM_MAX];
+    rtcmrcv_t rcv[4];
+    rtcm_gen_t g;
+    int i, k, len, len2 = 0, step;
+
+    memset(rtcm, 0, sizeof(rtcm));
+    memset(obs, 0, sizeof(obs));
+    memset(nav, 0, sizeof(nav));
+    len = make_stream(7, 8, 1);
+    rtcm_gen_init(&g, 4321, 12);
+    for (i = 0; i < 8; i++)
+    {
+        len2 += rtcm_gen_epoch(&g, 5, 1, other + len2, STREAM_MAX - len2);
+    }
+    for (k = 0; k < 4; k++)
+    {
+        rtcm_rcv_init(rcv + k, rtcm + k, obs + k, nav + k / 2);
+        rtcm[k].time.time = TEST_TIME;
+    }
+    rtcm_attach_satslot(rcv + 2, slot + 0, &navslot);
+    rtcm_attach_satslot(rcv + 3, slot + 1, &navslot);
+
+    /* plain pair one after the other, indexed pair interleaved */
+    feed_rcv(stream, len, rcv + 0);
+    feed_rcv(other, len2, rcv + 1);
+    for (i = 0, k = 0; i < len || k < len2; i += step, k += step)
+    {
+        step = 97;
+        if (i < len) feed_rcv(stream + i, step < len - i ? step : len - i, rcv + 2);
+        if (k < len2) feed_rcv(other + k, step < len2 - k ? step : len2 - k, rcv + 3);
+    }
+    for (k = 0; k < 2; k++)
+    {
+        UNIT_CHECK_EQ(obs[2 + k].n, obs[k].n);
+        UNIT_CHECK_MEM(obs[2 + k].data, obs[k].data, sizeof(obsd_t) * obs[k].n);
+    }
+    UNIT_CHECK(nav[0].n > 0 && nav[0].ng > 0);
+    UNIT_CHECK_EQ(nav_dups(nav + 1), 0);
+    UNIT_CHECK_EQ(nav[1].n + nav[1].ng, nav[0].n + nav[0].ng);
+}
+
+/* the time memo is per receiver: rover and base frames interleaved hit it
+   as often as a station alone, two headers an epoch, and the times and
+   observations are the ones of the conversions */
+static void test_time_memo(void)
+{
+    static rtcm_t rtcm[4];
+    static obs_t obs[4];
+    static nav_t nav[2];
+    static unsigned char other[STREAM_MAX];
+    rtcmmemo_t memo[2];
+    rtcmrcv_t rcv[4];
+    rtcm_gen_t g;
+    int i, k, len, len2 = 0;
+
+    memset(rtcm, 0, sizeof(rtcm));
+    memset(obs, 0, sizeof(obs));
+    memset(nav, 0, sizeof(nav));
+    len = make_stream(7, 10, 0);
+    rtcm_gen_init(&g, 4321, 12);
+    g.tow_ms += 2 * 86400000 + 37000;
+    for (i = 0; i < 10; i++)
+    {
+        len2 += rtcm_gen_epoch(&g, 7, 0, other + len2, STREAM_MAX - len2);
+    }
+    for (k = 0; k < 4; k++)
+    {
+        rtcm_rcv_init(rcv + k, rtcm + k, obs + k, nav + k % 2);
+        rtcm[k].time.time = TEST_TIME;
+    }
+    rtcm_attach_memo(rcv + 2, memo + 0);
+    rtcm_attach_memo(rcv + 3, memo + 1);
+
+    /* without memo one after the other, with memo interleaved */
+    feed_rcv(stream, len, rcv + 0);
+    feed_rcv(other, len2, rcv + 1);
+    for (i = 0, k = 0; i < len || k < len2; i += 97, k += 97)
+    {
+        if (i < len) feed_rcv(stream + i, 97 < len - i ? 97 : len - i, rcv + 2);
+        if (k < len2) feed_rcv(other + k, 97 < len2 - k ? 97 : len2 - k, rcv + 3);
+    }
+    for (k = 0; k < 2; k++)
+    {
+        UNIT_CHECK_EQ(memo[k].nmiss, 2 * 10);
+        UNIT_CHECK_EQ(memo[k].nhit, 2 * 10);
+        UNIT_CHECK_EQ(rtcm[2 + k].time.time, rtcm[k].time.time);
+        UNIT_CHECK(rtcm[2 + k].time.sec == rtcm[k].time.sec);
+        UNIT_CHECK_EQ(obs[2 + k].n, obs[k].n);
+        UNIT_CHECK_MEM(obs[2 + k].data, obs[k].data, sizeof(obsd_t) * obs[k].n);
+    }
+    UNIT_CHECK(rtcm[0].time.time != rtcm[1].time.time);
+
+    /* a header repeated against the time it was adjusted to hits, one that
+       moves the time on misses */
+    rtcm_attach_memo(rcv + 2, memo + 0);
+    feed_rcv(stream, len, rcv + 2);
+    UNIT_CHECK_EQ(memo[0].nmiss, 2 * 10);
+    UNIT_CHECK_EQ(memo[0].nhit, 2 * 10);
+    rtcm_attach_memo(rcv + 2, NULL);
+    feed_rcv(stream, len, rcv + 2);
+    UNIT_CHECK_EQ(memo[0].nhit + memo[0].nmiss, 4 * 10);
+}
+
+/* get_gnss_time() before the cache: the whole conversion on every call */
+static double utc_tod_ref(time_t sec, time_t msec)
+{
+    gtime_t time;
+    int week, day_sec;
+    double tow;
+
+    time.time = sec;
+    time.sec = 0.0;
+    tow = time2gpst(time, &week);
+    if (tow < 0)
+    {
+        week = 0;
+        tow = sec + (double)msec / 1000;
+    }
+    else
+    {
+        tow += (double)msec / 1000;
+    }
+    time.time = gpst2time(week, 0.0).time + (int)tow;
+    time.sec = tow - (int)tow;
+    time = gpst2utc(time);
+    day_sec = (int)(time.time - (time.time / 86400) * 86400);
+    return (double)(day_sec / 3600) * 10000 + (double)(day_sec % 3600 / 60) * 100
+           + (day_sec % 60 + time.sec) + 0.001;
+}
+
+/* the cached utc time of day is the one of the full conversion to the bit,
+   across the seconds, utc midnight, a leap second change and the mcu time
+   before the gps epoch, and is worked out once a second */
+static void test_utc_tod(void)
+{
+    static const double ep[] = {2021, 6, 1, 0, 0, 0};
+    utctod_t c = { -1, 0, 0.0, 0.0, 0 };
+    time_t midnight = epoch2time(ep).time + 18;     /* utc midnight in gps time */
+    time_t sec, msec;
+    int ok = 1, nsec = 0;
+    time_t last = -1;
+
+    UNIT_CHECK_EQ(get_leap_seconds(), 18);
+    for (sec = midnight - 3; sec <= midnight + 3; sec++)
+    {
+        for (msec = 0; msec < 1000; msec++)
+        {
+            if (utc_tod(&c, sec, msec) != utc_tod_ref(sec, msec)) ok = 0;
+            if (c.sec != last) nsec++;
+            last = c.sec;
+        }
+    }
+    UNIT_CHECK(ok);
+    UNIT_CHECK_EQ(nsec, 7);
+    UNIT_CHECK(utc_tod(&c, midnight - 1, 500) == 235959.501);
+    UNIT_CHECK(utc_tod(&c, midnight, 0) == 0.001);
+
+    /* a new leap second redoes the cached second without it changing */
+    sec = midnight + 100;
+    UNIT_CHECK(utc_tod(&c, sec, 250) == utc_tod_ref(sec, 250));
+    set_leap_seconds(19);
+    UNIT_CHECK(utc_tod(&c, sec, 250) == utc_tod_ref(sec, 250));
+    UNIT_CHECK_EQ(c.leaps, 19);
+    UNIT_CHECK(utc_tod(&c, sec, 250) == 139.251);
+    set_leap_seconds(0);                            /* not known to the sender */
+    UNIT_CHECK_EQ(get_leap_seconds(), 19);
+    set_leap_seconds(18);
+    UNIT_CHECK(utc_tod(&c, sec, 250) == 140.251);
+
+    /* the mcu time before the gps epoch is taken as the time of week */
+    for (msec = 0; msec < 1000; msec += 7)
+    {
+        if (utc_tod(&c, 86400 + 3600, msec) != utc_tod_ref(86400 + 3600, msec)) ok = 0;
+    }
+    UNIT_CHECK(ok);
+}
+
+/* the nav index follows a nav rearranged outside the decoder: swapped
+   entries, a satellite replaced in place and a shorter table */
+static void test_navslot_external(void)
+{
+    static rtcm_t rtcm[2];
+    static nav_t nav[2];
+    static navslot_t navslot;
+    static const int types[] = {1019, 1020};
+    unsigned char frame[RTCM_GEN_FRAME_MAX];
+    rtcmrcv_t rcv[2];
+    rtcm_gen_t g;
+    eph_t tmp;
+    int i, k, len;
+
+    memset(rtcm, 0, sizeof(rtcm));
+    memset(nav, 0, sizeof(nav));
+    for (k = 0; k < 2; k++)
+    {
+        rtcm_rcv_init(rcv + k, rtcm + k, &gnss.obs[k], nav + k);
+        rtcm[k].time.time = TEST_TIME;
+    }
+    rtcm_attach_satslot(rcv + 1, NULL, &navslot);
+
+    rtcm_gen_init(&g, 8, 1);
+    for (i = 0; i < 400; i++)
+    {
+        len = rtcm_gen_frame(&g, types[i % 2], 0, frame);
+        for (k = 0; k < 2; k++) feed_rcv(frame, len, rcv + k);
+
+        if (i == 100 || i == 200 || i == 300)
+        {
+            for (k = 0; k < 2; k++)
+            {
+                tmp = nav[k].eph[0];
+                nav[k].eph[0] = nav[k].eph[1];
+                nav[k].eph[1] = tmp;
+                nav[k].eph[2].sat = free_sat(nav + k);  /* same count */
+                nav[k].eph[3] = nav[k].eph[--nav[k].n];
+                nav[k].geph[0] = nav[k].geph[--nav[k].ng];
+            }
+        }
+        UNIT_CHECK_EQ(nav_dups(nav + 1), 0);
+    }
+    /* gps fits nav.eph and is placed alike, glonass overflows nav.geph, where
+       the index evicts the least recently updated entry instead */
+    UNIT_CHECK_EQ(nav[1].n, nav[0].n);
+    UNIT_CHECK_MEM(nav[1].eph, nav[0].eph, sizeof(eph_t) * nav[0].n);
+    UNIT_CHECK_EQ(nav[1].ng, MAXEPH_R);
+}
+
+/* pool streams each have their own obs index */
+static void test_satslot_pool(void)
+{
+    static rtcm_t work[2];
+    static rtcmhot_t hot[2][3];
+    static obs_t obs[2][3];
+    static nav_t nav[2];
+    static satslot_t slot[3];
+    static navslot_t navslot;
+    rtcmpool_t pool[2];
+    unsigned int pos, nused, s;
+    int k, len;
+
+    memset(nav, 0, sizeof(nav));
+    for (k = 0; k < 2; k++)
+    {
+        rtcm_pool_init(pool + k, work + k, hot[k], obs[k], 3, nav + k);
+        for (s = 0; s < 3; s++) hot[k][s].time.time = TEST_TIME;
+    }
+    rtcm_pool_attach_satslot(pool + 1, slot, &navslot);
+
+    len = make_stream(4, 6, 2);
+    for (k = 0; k < 2; k++)
+    {
+        for (s = 0; s < 3; s++)
+        {
+            for (pos = s; pos < (unsigned int)len; pos += nused)
+            {
+                input_rtcm3_pool(stream + pos, len - pos, s, pool + k, &nused, NULL);
+            }
+        }
+        rtcm_pool_reset(pool + k, 2);
+    }
+    for (s = 0; s < 3; s++)
+    {
+        UNIT_CHECK_EQ(obs[1][s].n, obs[0][s].n);
+        UNIT_CHECK_MEM(obs[1][s].data, obs[0][s].data, sizeof(obsd_t) * obs[0][s].n);
+    }
+    UNIT_CHECK_EQ(obs[0][0].n, 40);
+    UNIT_CHECK_EQ(nav_dups(nav + 1), 0);
+}
+
+/* a pool stream decodes as a receiver of its own however the streams
+   interleave, and only a stream sending rare messages takes cold state */
+static void test_pool_hot_cold(void)
+{
+    static rtcm_t work, rtcm[3];
+    static rtcmhot_t hot[3];
+    static obs_t obs[3], ref[3];
+    static nav_t nav, refnav;
+    static rtcmcold_t cold[3];
+    static rtcm_stat_t stat[3];
+    static unsigned char buf[3][32 * 1024];
+    const rtcmcold_t *c;
+    rtcmpool_t pool;
+    rtcmrcv_t rcv;
+    rtcm_gen_t g;
+    unsigned int len[3], pos[3] = {0, 0, 0}, n, nused;
+    unsigned char frame[RTCM_GEN_FRAME_MAX];
+    int s, e, more, flen;
+
+    rtcm_pool_init(&pool, &work, hot, obs, 3, &nav);
+    rtcm_pool_attach_cold(&pool, cold, 3);
+    rtcm_pool_attach_stat(&pool, stat);
+    memset(&refnav, 0, sizeof(refnav));
+    for (s = 0; s < 3; s++)
+    {
+        hot[s].time.time = TEST_TIME;
+        rtcm[s].time.time = TEST_TIME;
+        rtcm_gen_init(&g, 10 + s, 100 + s);
+        g.nsig = 1 + s;                         /* signal types of its own */
+        len[s] = 0;
+        for (e = 0; e < 8; e++)
+        {
+            if (s > 0 && e % 3 == 1)
+            {
+                len[s] += rtcm_gen_frame(&g, s == 1 ? 999 : 1033, 0, buf[s] + len[s]);
+            }
+            len[s] += rtcm_gen_epoch(&g, 7, 0, buf[s] + len[s], sizeof(buf[s]) - len[s]);
+        }
+        rtcm_rcv_init(&rcv, rtcm + s, ref + s, &refnav);
+        feed_rcv(buf[s], len[s], &rcv);
+    }
+
+    /* spans of 7, 10 and 13 bytes round the streams, frames straddle swaps */
+    do
+    {
+        more = 0;
+        for (s = 0; s < 3; s++)
+        {
+            if (pos[s] >= len[s]) continue;
+            n = len[s] - pos[s] < 7u + 3 * s ? len[s] - pos[s] : 7u + 3 * s;
+            input_rtcm3_pool(buf[s] + pos[s], n, s, &pool, &nused, NULL);
+            pos[s] += nused;
+            more = 1;
+        }
+    } while (more);
+
+    for (s = 0; s < 3; s++)
+    {
+        UNIT_CHECK_EQ(obs[s].n, ref[s].n);
+        UNIT_CHECK_MEM(obs[s].data, ref[s].data, sizeof(obsd_t) * ref[s].n);
+        UNIT_CHECK_EQ(stat[s].nbyte, len[s]);
+        UNIT_CHECK(rtcm_pool_obs(&pool, 100 + s) == obs + s);
+        UNIT_CHECK_EQ(hot[s].memo.nhit, 2 * 8);     /* its own memo, across the swaps */
+    }
+    UNIT_CHECK(obs[0].n > 0);
+
+    /* every stream keeps its own msm signal types */
+    for (s = 0; s < 3; s++)
+    {
+        UNIT_CHECK((c = rtcm_pool_cold(&pool, s)) != NULL);
+        UNIT_CHECK_MEM(c->msmtype, rtcm[s].msmtype, sizeof(c->msmtype));
+    }
+    UNIT_CHECK(memcmp(rtcm[0].msmtype, rtcm[1].msmtype, sizeof(rtcm[0].msmtype)) != 0);
+    UNIT_CHECK(rtcm_pool_cold(&pool, 0)->antdes[0] == 0);
+    UNIT_CHECK((c = rtcm_pool_cold(&pool, 1)) != NULL);
+    UNIT_CHECK_MEM(&c->st_pvt, &rtcm[1].st_pvt, sizeof(c->st_pvt));
+    UNIT_CHECK_MEM(&c->st_epvt, &rtcm[1].st_epvt, sizeof(c->st_epvt));
+    UNIT_CHECK((c = rtcm_pool_cold(&pool, 2)) != NULL);
+    UNIT_CHECK(strcmp(c->antdes, "TRM59800.00     NONE") == 0);
+    UNIT_CHECK(strcmp(c->antsno, "ANT0102") == 0);
+    UNIT_CHECK(strcmp(c->rectype, "GEN RECEIVER") == 0);
+    UNIT_CHECK(strcmp(c->recver, "1.0") == 0);
+    UNIT_CHECK(strcmp(c->recsno, "RCV0102") == 0);
+    UNIT_CHECK_EQ(c->antsetup, 1);
+    UNIT_CHECK_EQ(pool.cold.nused, 3);
+    UNIT_CHECK_EQ(pool.cold.nmiss, 0);
+
+    /* a reset keeps the block of stream 2 */
+    rtcm_pool_reset(&pool, 2);
+    UNIT_CHECK((c = rtcm_pool_cold(&pool, 2)) != NULL);
+    UNIT_CHECK_EQ(c->antdes[0], 0);
+    UNIT_CHECK_EQ(c->msmtype[0][0], 0);
+    UNIT_CHECK_EQ(obs[2].n, 0);
+
+    /* two blocks for three streams: the last one to ask gets none */
+    rtcm_pool_attach_cold(&pool, cold, 2);
+    rtcm_gen_init(&g, 1, 100);
+    flen = rtcm_gen_frame(&g, 1033, 0, frame);
+    for (s = 0; s < 3; s++)
+    {
+        input_rtcm3_pool(frame, flen, s, &pool, &nused, NULL);
+    }
+    UNIT_CHECK(rtcm_pool_cold(&pool, 1) != NULL);
+    UNIT_CHECK(rtcm_pool_cold(&pool, 2) == NULL);
+    UNIT_CHECK_EQ(pool.cold.nmiss, 1);
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* string arguments are not kept, the ring outlives the caller's buffers */
+static void test_trace_strings(void)
+{
+    static uint8_t frame[EVENT_TRACE_FRAME_LEN(EVENT_TRACE_RECORDS)];
+    char name[8] = "abc";
+    const uint8_t *rec;
+    uint16_t len;
+    int i, nlog = 0, len0;
+
+    event_trace_start(EVENT_TRACE_SINK_UART);
+    trace(3, "name=%s n=%d\n", name, 7);
+    len = event_trace_drain(frame, sizeof(frame));
+    rec = frame + EVENT_TRACE_HEADER_LEN;
+    UNIT_CHECK_EQ(len, EVENT_TRACE_FRAME_LEN(1));
+    UNIT_CHECK_EQ(rec[4] | (rec[5] << 8), EVENT_LOG + 3);
+    UNIT_CHECK_EQ(rec[7], 3);
+    UNIT_CHECK_EQ(get32(rec + 12), 0);     /* after the format */
+    UNIT_CHECK_EQ(get32(rec + 16), 7);
+
+    /* each value is read at the width its length modifier gives */
+    trace(3, "%ld %lld %u\n", -5L, (1LL << 40) | 9, 11u);
+    len = event_trace_drain(frame, sizeof(frame));
+    UNIT_CHECK_EQ(len, EVENT_TRACE_FRAME_LEN(1));
+    UNIT_CHECK_EQ(rec[7], 4);
+    UNIT_CHECK_EQ(get32(rec + 12), 0xfffffffbu);
+    UNIT_CHECK_EQ(get32(rec + 16), 9);
+    UNIT_CHECK_EQ(get32(rec + 20), 11);
+
+    memset(&gnss, 0, sizeof(gnss));
+    len0 = make_stream(7, 1, 1);
+    feed_buf(stream, len0, ROVER);
+    len = event_trace_drain(frame, sizeof(frame));
+    event_trace_stop();
+    for (i = 0; i < (len - EVENT_TRACE_FRAME_LEN(0)) / EVENT_TRACE_RECORD_LEN; i++)
+    {
+        rec = frame + EVENT_TRACE_HEADER_LEN + i * EVENT_TRACE_RECORD_LEN;
+        if ((rec[4] | (rec[5] << 8)) >> 8 == EVENT_LOG >> 8) nlog++;
+    }
+    UNIT_CHECK(nlog > 0);
+}
+
+int main(void)
+{
+    UNIT_RUN(test_stat_index);
+    UNIT_RUN(test_msm_epochs);
+    UNIT_RUN(test_code_priority);
+    UNIT_RUN(test_legacy_epochs);
+    UNIT_RUN(test_byte_vs_span);
+    UNIT_RUN(test_byte_after_epoch);
+    UNIT_RUN(test_ephemeris);
+    UNIT_RUN(test_statistics);
+    UNIT_RUN(test_epoch_assembler);
+    UNIT_RUN(test_noise_and_parity);
+    UNIT_RUN(test_corruption_replay);
+    UNIT_RUN(test_satslot_receivers);
+    UNIT_RUN(test_time_memo);
+    UNIT_RUN(test_utc_tod);
+    UNIT_RUN(test_navslot_external);
+    UNIT_RUN(test_satslot_pool);
+    UNIT_RUN(test_pool_hot_cold);
+    UNIT_RUN(test_trace_strings);
+    return unit_end();
+}
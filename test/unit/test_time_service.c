@@ -0,0 +1,203 @@
+/** ***************************************************************************
+ * @file   test_time_service.c
+ * @brief  PPS disciplined time stamps against a drifting crystal and a
+ *         jittery edge isr
+ *
+ * The cycle counter runs off a crystal CRYSTAL_PPM fast that drifts
+ * CRYSTAL_DRIFT ppm a second, warming up. Time goes in 1 ms steps with the
+ * timer isr's time_service_tick(); the PPS edge at .5 s of each second is
+ * taken by its isr some latency later, and the stamps of random events in
+ * between are compared with the true time.
+ ******************************************************************************/
+#include <math.h>
+#include <stdlib.h>
+#include "unit.h"
+#include "stm32f4xx_hal.h"
+#include "hal_host.h"
+#include "time_service.h"
+
+#define CRYSTAL_PPM     23.0
+#define CRYSTAL_DRIFT   0.002           /* ppm/s */
+#define SETTLE_S        30              /* residuals counted from here */
+
+typedef struct {
+    double lat_us;              /* fixed isr latency */
+    double jitter_us;           /* uniform on top */
+    double spike;               /* share of edges held up by a higher isr */
+    double spike_us;
+    int    lost_from, lost_to;  /* seconds without PPS */
+} pps_isr_t;
+
+typedef struct {
+    unsigned int n;
+    double sum, sumsq;
+    double min, max;
+} resid_t;
+
+static uint64_t host_count;     /* the cycle counter, 64 bits */
+static uint64_t count_base;
+
+static double urand(void)
+{
+    return rand() / (RAND_MAX + 1.0);
+}
+
+/* crystal counts at true time t s */
+static uint64_t crystal_count(double t)
+{
+    return count_base + (uint64_t)(HOST_CORE_CLOCK * (t + 1e-6 * (CRYSTAL_PPM * t + 0.5 * CRYSTAL_DRIFT * t * t)));
+}
+
+static void clock_to(double t)
+{
+    uint64_t target = crystal_count(t);
+
+    host_cycles_advance((uint32_t)(target - host_count));
+    host_count = target;
+}
+
+/* counter frequency against SystemCoreClock at t, ppb */
+static double crystal_ppb(double t)
+{
+    return (CRYSTAL_PPM + CRYSTAL_DRIFT * t) * 1e3;
+}
+
+static void resid_add(resid_t *r, double e)
+{
+    if (r->n == 0 || e < r->min) r->min = e;
+    if (r->n == 0 || e > r->max) r->max = e;
+    r->n++;
+    r->sum += e;
+    r->sumsq += e * e;
+}
+
+static double resid_mean(const resid_t *r)
+{
+    return r->sum / r->n;
+}
+
+static double resid_sigma(const resid_t *r)
+{
+    double m = resid_mean(r);
+
+    return sqrt(r->sumsq / r->n - m * m);
+}
+
+/* seconds of 1 ms steps from true time 0, stamp errors in us after SETTLE_S
+   into r, those while the PPS is lost into gap (NULL: into r as well) */
+static void run(const pps_isr_t *isr, int seconds, resid_t *r, resid_t *gap)
+{
+    double t, lat, e;
+    int ms, sec;
+
+    count_base = host_count;
+    time_service_init();
+    srand(23);
+    for (ms = 0; ms < seconds * 1000; ms++)
+    {
+        t = ms * 1e-3;
+        clock_to(t);
+        time_service_tick();
+
+        sec = ms / 1000;
+        if (ms % 1000 == 500 && (sec < isr->lost_from || sec >= isr->lost_to))
+        {
+            lat = isr->lat_us + urand() * isr->jitter_us;
+            if (urand() < isr->spike)
+                lat += isr->spike_us;
+            clock_to(t + lat * 1e-6);
+            time_service_pps(time_count(), (int64_t)ms * 1000);
+        }
+
+        /* an event late in the step, after any edge; now_gps() truncates */
+        if (ms % 7 == 3 && sec >= SETTLE_S)
+        {
+            t += (0.1 + 0.8 * urand()) * 1e-3;
+            clock_to(t);
+            e = (double)now_gps() + 0.5 - t * 1e6;
+            if (gap != NULL && sec >= isr->lost_from && sec < isr->lost_to)
+                resid_add(gap, e);
+            else
+                resid_add(r, e);
+        }
+    }
+}
+
+/* a clean edge: two to lock, then on the true time and frequency */
+static void test_lock(void)
+{
+    pps_isr_t isr = {0.5, 0, 0, 0, 0, 0};
+    time_service_stat_t st;
+    resid_t r = {0};
+
+    run(&isr, 120, &r, NULL);
+    time_service_stat(&st);
+    UNIT_CHECK_EQ(st.locked, 2);
+    UNIT_CHECK_EQ(st.steps, 2);
+    UNIT_CHECK_EQ(st.clamped, 0);
+    UNIT_CHECK_EQ(st.pps, 120);
+    /* behind by the latency, less what the loop lags the drift; the
+       spread is the step of the us */
+    UNIT_CHECK(fabs(resid_mean(&r) + 0.5) < 0.5);
+    UNIT_CHECK(r.max - r.min < 1.5);
+    UNIT_CHECK(fabs(st.freq_ppb - crystal_ppb(120)) < 50);
+}
+
+/* 2 us of isr jitter is averaged down, not passed on */
+static void test_jitter(void)
+{
+    pps_isr_t isr = {0.5, 2.0, 0, 0, 0, 0};
+    time_service_stat_t st;
+    resid_t r = {0};
+
+    run(&isr, 600, &r, NULL);
+    time_service_stat(&st);
+    UNIT_CHECK_EQ(st.steps, 2);
+    UNIT_CHECK(fabs(resid_mean(&r) + 1.5) < 0.5);
+    UNIT_CHECK(resid_sigma(&r) < 0.5);
+    UNIT_CHECK(r.max - resid_mean(&r) < 1.5 && resid_mean(&r) - r.min < 1.5);
+    UNIT_CHECK(fabs(st.freq_ppb - crystal_ppb(600)) < 50);
+}
+
+/* edges held up 30 us are clamped, the clock hardly moves */
+static void test_spikes(void)
+{
+    pps_isr_t isr = {0.5, 2.0, 0.02, 30.0, 0, 0};
+    time_service_stat_t st;
+    resid_t r = {0};
+
+    run(&isr, 600, &r, NULL);
+    time_service_stat(&st);
+    UNIT_CHECK_EQ(st.steps, 2);
+    UNIT_CHECK(st.clamped > 0);
+    UNIT_CHECK(resid_sigma(&r) < 1.0);
+    UNIT_CHECK(r.max - resid_mean(&r) < 6.0 && resid_mean(&r) - r.min < 6.0);
+}
+
+/* a minute without PPS runs on the frequency estimate; the edge after it
+   sets the phase and the one after that the frequency, as at the start */
+static void test_pps_lost(void)
+{
+    pps_isr_t isr = {0.5, 2.0, 0, 0, 100, 160};
+    time_service_stat_t st;
+    resid_t r = {0}, gap = {0};
+
+    run(&isr, 300, &r, &gap);
+    time_service_stat(&st);
+    UNIT_CHECK_EQ(st.locked, 2);
+    UNIT_CHECK_EQ(st.steps, 4);
+    UNIT_CHECK_EQ(st.pps, 240);
+    /* the drift over the minute, 0.06 ppm on average */
+    UNIT_CHECK(gap.n > 0 && gap.max < 10.0 && gap.min > -10.0);
+    UNIT_CHECK(resid_sigma(&r) < 1.5 && r.max < 10.0 && r.min > -10.0);
+    UNIT_CHECK(fabs(st.freq_ppb - crystal_ppb(300)) < 100);
+}
+
+int main(void)
+{
+    UNIT_RUN(test_lock);
+    UNIT_RUN(test_jitter);
+    UNIT_RUN(test_spikes);
+    UNIT_RUN(test_pps_lost);
+    return unit_end();
+}
@@ -0,0 +1,111 @@
+/** ***************************************************************************
+ * @file   test_ucb.c
+ * @brief  ucb packet code <-> type lookups, built-in and user packets
+ ******************************************************************************/
+#include "unit.h"
+#include "ucb_packet.h"
+#include "user_message.h"
+
+extern ucb_packet_t ucbPackets[];
+extern usr_packet_t userInputPackets[];
+extern usr_packet_t userOutputPackets[];
+
+static void test_round_trip(void)
+{
+    const ucb_packet_t *pkt;
+    uint8_t bytes[2];
+    int n = 0;
+
+    for (pkt = ucbPackets; pkt->packetType != UCB_PKT_NONE; pkt++, n++)
+    {
+        bytes[0] = (uint8_t)(pkt->packetCode >> 8);
+        bytes[1] = (uint8_t)pkt->packetCode;
+        UNIT_CHECK_EQ(UcbPacketBytesToPacketType(bytes), pkt->packetType);
+        if (pkt->packetType == UCB_USER_OUT)
+        {
+            continue;
+        }
+        UNIT_CHECK(UcbPacketPacketTypeToBytes((UcbPacketType)pkt->packetType, bytes));
+        UNIT_CHECK_EQ((bytes[0] << 8) | bytes[1], pkt->packetCode);
+    }
+    UNIT_CHECK(n > 20);
+}
+
+static void test_unknown(void)
+{
+    uint8_t bytes[2] = {'Z', 'Z'};
+
+    UNIT_CHECK_EQ(UcbPacketBytesToPacketType(bytes), UCB_ERROR_INVALID_TYPE);
+    bytes[0] = bytes[1] = 0;
+    UNIT_CHECK_EQ(UcbPacketBytesToPacketType(bytes), UCB_ERROR_INVALID_TYPE);
+    UNIT_CHECK(!UcbPacketPacketTypeToBytes(UCB_READ_CAL, bytes));
+    UNIT_CHECK_EQ(bytes[0] | bytes[1], 0);
+}
+
+/* every code against a walk of the tables, built-in first, then the user
+   packets, as the lookups before the generated hash did */
+static int walk(uint16_t code)
+{
+    const ucb_packet_t *pkt;
+    const usr_packet_t *usr;
+
+    for (pkt = ucbPackets; pkt->packetType != UCB_PKT_NONE; pkt++)
+    {
+        if (pkt->packetCode == code) return pkt->packetType;
+    }
+    for (usr = &userInputPackets[1]; usr->packetType != USR_IN_MAX; usr++)
+    {
+        if (((usr->packetCode[0] << 8) | usr->packetCode[1]) == code) return UCB_USER_IN;
+    }
+    for (usr = &userOutputPackets[1]; usr->packetType != USR_OUT_MAX; usr++)
+    {
+        if (((usr->packetCode[0] << 8) | usr->packetCode[1]) == code) return UCB_USER_OUT;
+    }
+    return UCB_ERROR_INVALID_TYPE;
+}
+
+static void test_all_codes(void)
+{
+    uint8_t bytes[2];
+    int code, bad = 0;
+
+    for (code = 0; code < 0x10000; code++)
+    {
+        bytes[0] = (uint8_t)(code >> 8);
+        bytes[1] = (uint8_t)code;
+        if ((int)UcbPacketBytesToPacketType(bytes) != walk((uint16_t)code)) bad++;
+    }
+    UNIT_CHECK_EQ(bad, 0);
+}
+
+static void test_user(void)
+{
+    uint8_t bytes[2] = {'i', 'N'};
+
+    UNIT_CHECK_EQ(UcbPacketBytesToPacketType(bytes), UCB_USER_OUT);
+    bytes[0] = 'p';
+    bytes[1] = 'G';
+    UNIT_CHECK_EQ(UcbPacketBytesToPacketType(bytes), UCB_USER_IN);
+
+    userOutputPacketType = USR_OUT_STATUS;
+    UNIT_CHECK(UcbPacketPacketTypeToBytes(UCB_USER_OUT, bytes));
+    UNIT_CHECK_MEM(bytes, "sT", 2);
+    userOutputPacketType = USR_OUT_SCALED1;
+}
+
+static void test_direction(void)
+{
+    UNIT_CHECK(UcbPacketIsAnInputPacket(UCB_PING));
+    UNIT_CHECK(!UcbPacketIsAnInputPacket(UCB_SCALED_1));
+    UNIT_CHECK(UcbPacketIsAnOutputPacket(UCB_SCALED_1));
+}
+
+int main(void)
+{
+    UNIT_RUN(test_round_trip);
+    UNIT_RUN(test_unknown);
+    UNIT_RUN(test_all_codes);
+    UNIT_RUN(test_user);
+    UNIT_RUN(test_direction);
+    return unit_end();
+}